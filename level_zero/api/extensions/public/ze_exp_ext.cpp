@@ -7,7 +7,13 @@
 
 #include "level_zero/api/extensions/public/ze_exp_ext.h"
 
+#include "level_zero/core/source/cmdlist/cmdlist.h"
+#include "level_zero/core/source/cmdqueue/cmdqueue.h"
+#include "level_zero/core/source/event/event.h"
+#include "level_zero/core/source/fence/fence.h"
+#include "level_zero/core/source/helpers/host_synchronize_multiple.h"
 #include "level_zero/core/source/kernel/kernel.h"
+#include "level_zero/tools/source/sysman/sysman.h"
 
 #if defined(__cplusplus)
 extern "C" {
@@ -22,6 +28,153 @@ zeKernelSetGlobalOffsetExp(
     return L0::Kernel::fromHandle(hKernel)->setGlobalOffsetExp(offsetX, offsetY, offsetZ);
 }
 
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListAppendLaunchMutableKernel(
+    ze_command_list_handle_t hCommandList,
+    ze_kernel_handle_t hKernel,
+    const ze_group_count_t *pLaunchFuncArgs,
+    ze_event_handle_t hSignalEvent,
+    uint32_t numWaitEvents,
+    ze_event_handle_t *phWaitEvents,
+    uint32_t *pCommandId) {
+    return L0::CommandList::fromHandle(hCommandList)->appendLaunchMutableKernel(hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents, pCommandId);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListUpdateMutableKernelArgument(
+    ze_command_list_handle_t hCommandList,
+    uint32_t commandId,
+    uint32_t argIndex,
+    size_t argSize,
+    const void *pArgValue) {
+    return L0::CommandList::fromHandle(hCommandList)->updateMutableKernelArgument(commandId, argIndex, argSize, pArgValue);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListUpdateMutableGroupCount(
+    ze_command_list_handle_t hCommandList,
+    uint32_t commandId,
+    const ze_group_count_t *pLaunchFuncArgs) {
+    return L0::CommandList::fromHandle(hCommandList)->updateMutableGroupCount(commandId, pLaunchFuncArgs);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListSetKernelTimingHistogram(
+    ze_command_list_handle_t hCommandList,
+    void *pHistogram) {
+    static_assert(ZEX_KERNEL_TIMING_HISTOGRAM_BUCKETS == L0::CommandList::kernelTimingHistogramBuckets, "kernel timing histogram size mismatch");
+    return L0::CommandList::fromHandle(hCommandList)->setKernelTimingHistogram(pHistogram);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListAppendSWTagRangeBegin(
+    ze_command_list_handle_t hCommandList,
+    const char *name) {
+    return L0::CommandList::fromHandle(hCommandList)->appendSWTagRangeMarker(name, true);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListAppendSWTagRangeEnd(
+    ze_command_list_handle_t hCommandList) {
+    return L0::CommandList::fromHandle(hCommandList)->appendSWTagRangeMarker(nullptr, false);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexEventPoolSetHostWaitSpinTime(
+    ze_event_pool_handle_t hEventPool,
+    uint64_t spinTimeNs) {
+    L0::EventPool::fromHandle(hEventPool)->setHostWaitSpinTime(spinTimeNs);
+    return ZE_RESULT_SUCCESS;
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexEventHostSynchronizeMultiple(
+    uint32_t numEvents,
+    ze_event_handle_t *phEvents,
+    zex_wait_mode_t mode,
+    uint64_t timeout,
+    uint32_t *pSignaledIndex) {
+    if (numEvents == 0) {
+        return ZE_RESULT_ERROR_INVALID_SIZE;
+    }
+    if (phEvents == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    if (mode != ZEX_WAIT_MODE_ALL && mode != ZEX_WAIT_MODE_ANY) {
+        return ZE_RESULT_ERROR_INVALID_ENUMERATION;
+    }
+    return L0::hostSynchronizeMultiple<L0::Event>(numEvents, phEvents, mode == ZEX_WAIT_MODE_ALL, timeout, pSignaledIndex);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexFenceHostSynchronizeMultiple(
+    uint32_t numFences,
+    ze_fence_handle_t *phFences,
+    zex_wait_mode_t mode,
+    uint64_t timeout,
+    uint32_t *pSignaledIndex) {
+    if (numFences == 0) {
+        return ZE_RESULT_ERROR_INVALID_SIZE;
+    }
+    if (phFences == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    if (mode != ZEX_WAIT_MODE_ALL && mode != ZEX_WAIT_MODE_ANY) {
+        return ZE_RESULT_ERROR_INVALID_ENUMERATION;
+    }
+    return L0::hostSynchronizeMultiple<L0::Fence>(numFences, phFences, mode == ZEX_WAIT_MODE_ALL, timeout, pSignaledIndex);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexSysmanDeviceStartTelemetrySampling(
+    zes_device_handle_t hDevice,
+    uint32_t periodUs,
+    uint32_t capacity) {
+    return L0::SysmanDevice::fromHandle(hDevice)->telemetrySamplingStart(periodUs, capacity);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexSysmanDeviceReadTelemetrySamples(
+    zes_device_handle_t hDevice,
+    uint32_t *pCount,
+    zex_sysman_telemetry_sample_t *pSamples) {
+    return L0::SysmanDevice::fromHandle(hDevice)->telemetrySamplesRead(pCount, pSamples);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexSysmanDeviceStopTelemetrySampling(
+    zes_device_handle_t hDevice) {
+    return L0::SysmanDevice::fromHandle(hDevice)->telemetrySamplingStop();
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandQueueGetSubmissionStatistics(
+    ze_command_queue_handle_t hCommandQueue,
+    zex_command_queue_submission_statistics_t *pStatistics) {
+    static_assert(ZEX_SUBMISSION_WAIT_TIME_BUCKETS == NEO::waitTimeHistogramBuckets, "wait time histogram size mismatch");
+    if (pStatistics == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    auto statistics = L0::CommandQueue::fromHandle(hCommandQueue)->getSubmissionStatistics();
+    pStatistics->flushes = statistics.flushes;
+    pStatistics->ringBufferSwitches = statistics.ringBufferSwitches;
+    pStatistics->stallingPipeControls = statistics.stallingPipeControls;
+    pStatistics->stateBaseAddressReprogrammings = statistics.stateBaseAddressReprogrammings;
+    pStatistics->cacheFlushes = statistics.cacheFlushes;
+    pStatistics->kmdNotifySleeps = statistics.kmdNotifySleeps;
+    for (uint32_t i = 0; i < NEO::waitTimeHistogramBuckets; i++) {
+        pStatistics->waitTimeHistogram[i] = statistics.waitTimeHistogram[i];
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandQueueSetSliceCount(
+    ze_command_queue_handle_t hCommandQueue,
+    uint32_t sliceCount) {
+    return L0::CommandQueue::fromHandle(hCommandQueue)->setSliceCount(sliceCount);
+}
+
 #if defined(__cplusplus)
 } // extern "C"
 #endif
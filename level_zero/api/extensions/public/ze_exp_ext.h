@@ -8,3 +8,248 @@
 #pragma once
 
 #include <level_zero/ze_api.h>
+#include <level_zero/zes_api.h>
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Appends a kernel launch whose arguments and group count can be patched
+///        in place once the command list is closed.
+///
+/// @details
+///     - The returned command id identifies the launch in subsequent
+///       zexCommandListUpdateMutable* calls until the command list is reset.
+///     - Not supported on immediate command lists.
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListAppendLaunchMutableKernel(
+    ze_command_list_handle_t hCommandList,
+    ze_kernel_handle_t hKernel,
+    const ze_group_count_t *pLaunchFuncArgs,
+    ze_event_handle_t hSignalEvent,
+    uint32_t numWaitEvents,
+    ze_event_handle_t *phWaitEvents,
+    uint32_t *pCommandId);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Patches a buffer or scalar argument of a mutable kernel launch.
+///
+/// @details
+///     - Must not be called while the command list is executing.
+///     - Local memory, image, sampler and bindless arguments are not mutable.
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListUpdateMutableKernelArgument(
+    ze_command_list_handle_t hCommandList,
+    uint32_t commandId,
+    uint32_t argIndex,
+    size_t argSize,
+    const void *pArgValue);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Patches the group count of a mutable kernel launch.
+///
+/// @details
+///     - Must not be called while the command list is executing.
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListUpdateMutableGroupCount(
+    ze_command_list_handle_t hCommandList,
+    uint32_t commandId,
+    const ze_group_count_t *pLaunchFuncArgs);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Number of 32-bit counters in a kernel timing histogram.
+#define ZEX_KERNEL_TIMING_HISTOGRAM_BUCKETS 16
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Makes kernels appended to the command list count their execution
+///        time in a histogram updated by the device.
+///
+/// @details
+///     - pHistogram points to ZEX_KERNEL_TIMING_HISTOGRAM_BUCKETS zero-initialized
+///       uint32_t counters in a USM allocation; host allocations may be read
+///       at any time without synchronizing with the device.
+///     - Counts are cumulative: bucket i counts kernels shorter than 2^i
+///       microseconds, the last bucket counts all kernels.
+///     - The time is measured by the command streamer up to a stalling
+///       PIPE_CONTROL after each walker, so timed kernels do not overlap.
+///     - Applies to launches appended afterwards, including copy and fill
+///       kernels used by the runtime; predicated launches are not counted.
+///     - Passing nullptr stops counting. Not supported on copy-only lists.
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListSetKernelTimingHistogram(
+    ze_command_list_handle_t hCommandList,
+    void *pHistogram);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Opens a named range in the software tags of the command list.
+///
+/// @details
+///     - Ranges are recorded only when the EnableSWTags debug setting is on,
+///       otherwise the call does nothing.
+///     - Names longer than 63 characters are truncated.
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListAppendSWTagRangeBegin(
+    ze_command_list_handle_t hCommandList,
+    const char *name);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Closes the innermost range opened with zexCommandListAppendSWTagRangeBegin.
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListAppendSWTagRangeEnd(
+    ze_command_list_handle_t hCommandList);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Sets how long host waits on events from the pool poll before sleeping.
+///
+/// @details
+///     - Applies to zeEventHostSynchronize calls without a timeout. Once the
+///       spin time elapses, the thread sleeps in the kernel until the engine
+///       completes its last submission, then checks the event again.
+///     - UINT64_MAX keeps polling until the event is signaled.
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexEventPoolSetHostWaitSpinTime(
+    ze_event_pool_handle_t hEventPool,
+    uint64_t spinTimeNs);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Condition ending a multiple object host wait.
+typedef enum _zex_wait_mode_t {
+    ZEX_WAIT_MODE_ALL = 0,                ///< wait until all objects are signaled
+    ZEX_WAIT_MODE_ANY = 1,                ///< wait until any object is signaled
+    ZEX_WAIT_MODE_FORCE_UINT32 = 0x7fffffff
+} zex_wait_mode_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Waits on the host for all or any of the events with a single call.
+///
+/// @details
+///     - All events are polled in one loop, so the timeout bounds the whole
+///       wait and the call returns as soon as the wait condition is met.
+///     - In ZEX_WAIT_MODE_ANY, pSignaledIndex (optional) receives the index of
+///       a signaled event; it is not written in ZEX_WAIT_MODE_ALL.
+///     - Timeout semantics follow zeEventHostSynchronize; returns
+///       ZE_RESULT_NOT_READY if the condition is not met in time.
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexEventHostSynchronizeMultiple(
+    uint32_t numEvents,
+    ze_event_handle_t *phEvents,
+    zex_wait_mode_t mode,
+    uint64_t timeout,
+    uint32_t *pSignaledIndex);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Waits on the host for all or any of the fences with a single call.
+///
+/// @details
+///     - Same semantics as zexEventHostSynchronizeMultiple, for fences.
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexFenceHostSynchronizeMultiple(
+    uint32_t numFences,
+    ze_fence_handle_t *phFences,
+    zex_wait_mode_t mode,
+    uint64_t timeout,
+    uint32_t *pSignaledIndex);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Maximum number of engine groups reported in a telemetry sample.
+#define ZEX_SYSMAN_TELEMETRY_MAX_ENGINES 16
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief One sample collected by the sysman telemetry sampler.
+///
+/// @details
+///     - Values that could not be read keep the defaults of
+///       zesPowerGetEnergyCounter, zesFrequencyGetState and zesEngineGetActivity
+///       failures: zero energy, -1 frequency, zero engine stats.
+typedef struct _zex_sysman_telemetry_sample_t {
+    uint64_t timestamp;                                             ///< host monotonic time of the sample, in microseconds
+    zes_power_energy_counter_t energy;                              ///< energy counter of the first power domain
+    double actualFrequency;                                         ///< actual frequency of the first frequency domain, in MHz
+    uint32_t numEngines;                                            ///< number of valid entries in engineStats
+    zes_engine_stats_t engineStats[ZEX_SYSMAN_TELEMETRY_MAX_ENGINES]; ///< activity of engine groups, in zesDeviceEnumEngineGroups order
+} zex_sysman_telemetry_sample_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Starts a runtime thread that samples device telemetry periodically.
+///
+/// @details
+///     - Samples are stored in a ring buffer of the given capacity and are
+///       drained with zexSysmanDeviceReadTelemetrySamples.
+///     - When the ring buffer is full, new samples are dropped until the
+///       client drains it.
+///     - Returns ZE_RESULT_ERROR_HANDLE_OBJECT_IN_USE if sampling is already running.
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexSysmanDeviceStartTelemetrySampling(
+    zes_device_handle_t hDevice,
+    uint32_t periodUs,
+    uint32_t capacity);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Moves samples collected so far to the caller, oldest first.
+///
+/// @details
+///     - If *pCount is zero, it is set to the number of samples available.
+///     - Otherwise up to *pCount samples are copied to pSamples and *pCount is
+///       set to the number of samples copied.
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexSysmanDeviceReadTelemetrySamples(
+    zes_device_handle_t hDevice,
+    uint32_t *pCount,
+    zex_sysman_telemetry_sample_t *pSamples);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Stops the telemetry sampling thread and discards undrained samples.
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexSysmanDeviceStopTelemetrySampling(
+    zes_device_handle_t hDevice);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Number of buckets in the submission wait time histogram.
+#define ZEX_SUBMISSION_WAIT_TIME_BUCKETS 16
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Submission counters of the engines used by a command queue.
+///
+/// @details
+///     - Counters accumulate from engine creation and are shared by all
+///       queues submitting to the same engine.
+typedef struct _zex_command_queue_submission_statistics_t {
+    uint64_t flushes;                                                ///< number of submissions flushed to the engine
+    uint64_t ringBufferSwitches;                                     ///< number of direct submission ring buffer switches
+    uint64_t stallingPipeControls;                                   ///< number of stalling PIPE_CONTROLs programmed by the runtime
+    uint64_t stateBaseAddressReprogrammings;                         ///< number of STATE_BASE_ADDRESS reprogrammings
+    uint64_t cacheFlushes;                                           ///< number of data cache flushes programmed by the runtime
+    uint64_t kmdNotifySleeps;                                        ///< number of waits that fell back to sleeping in the kernel
+    uint64_t waitTimeHistogram[ZEX_SUBMISSION_WAIT_TIME_BUCKETS];    ///< bucket i counts host waits shorter than 2^i microseconds,
+                                                                     ///< the last bucket also counts all longer waits
+} zex_command_queue_submission_statistics_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Reads the submission counters of the engines used by the command queue.
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandQueueGetSubmissionStatistics(
+    ze_command_queue_handle_t hCommandQueue,
+    zex_command_queue_submission_statistics_t *pStatistics);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Sets how many slices execute work submitted by the command queue.
+///
+/// @details
+///     - Applies to subsequent zeCommandQueueExecuteCommandLists calls; zero
+///       restores all slices of the device.
+///     - Lowering the slice count saves power for memory-bound or small
+///       kernels. Switching it reconfigures the context, so it should not
+///       change on every submission.
+///     - Honored on Linux when the kernel supports context SSEU changes,
+///       ignored otherwise.
+///     - Returns ZE_RESULT_ERROR_INVALID_ARGUMENT if sliceCount exceeds the
+///       number of slices of the device.
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandQueueSetSliceCount(
+    ze_command_queue_handle_t hCommandQueue,
+    uint32_t sliceCount);
+
+#if defined(__cplusplus)
+} // extern "C"
+#endif
@@ -165,8 +165,14 @@ Kernel *BuiltinFunctionsLibImpl::getPageFaultFunction() {
 std::unique_ptr<BuiltinFunctionsLibImpl::BuiltinData> BuiltinFunctionsLibImpl::loadBuiltIn(NEO::EBuiltInOps::Type builtin, const char *builtInName) {
     using BuiltInCodeType = NEO::BuiltinCode::ECodeType;
 
-    auto builtInCodeType = NEO::DebugManager.flags.RebuildPrecompiledKernels.get() ? BuiltInCodeType::Intermediate : BuiltInCodeType::Binary;
-    auto builtInCode = builtInsLib->getBuiltinsLib().getBuiltinCode(builtin, builtInCodeType, *device->getNEODevice());
+    auto &builtinsLib = builtInsLib->getBuiltinsLib();
+    auto builtInCode = builtinsLib.getCachedBuiltinCode(builtin, "", "ze", *device->getNEODevice());
+    bool storeInCompilerCache = NEO::BuiltinsLib::isCompilerCacheEnabled() && builtInCode.resource.empty();
+    if (builtInCode.resource.empty()) {
+        auto builtInCodeType = NEO::DebugManager.flags.RebuildPrecompiledKernels.get() ? BuiltInCodeType::Intermediate : BuiltInCodeType::Binary;
+        builtInCode = builtinsLib.getBuiltinCode(builtin, builtInCodeType, *device->getNEODevice());
+        storeInCompilerCache &= (builtInCode.type != BuiltInCodeType::Binary);
+    }
 
     ze_result_t res;
     std::unique_ptr<Module> module;
@@ -180,6 +186,14 @@ std::unique_ptr<BuiltinFunctionsLibImpl::BuiltinData> BuiltinFunctionsLibImpl::l
 
     module.reset(Module::fromHandle(moduleHandle));
 
+    if (storeInCompilerCache) {
+        size_t binarySize = 0u;
+        module->getNativeBinary(&binarySize, nullptr);
+        std::vector<uint8_t> binary(binarySize);
+        module->getNativeBinary(&binarySize, binary.data());
+        builtinsLib.cacheBuiltinBinary(builtin, "", "ze", *device->getNEODevice(), ArrayRef<const char>(reinterpret_cast<const char *>(binary.data()), binary.size()));
+    }
+
     std::unique_ptr<Kernel> kernel;
     ze_kernel_handle_t kernelHandle;
     ze_kernel_desc_t kernelDesc = {};
@@ -112,15 +112,11 @@ bool CommandList::isCopyOnly() const {
 }
 
 NEO::PreemptionMode CommandList::obtainFunctionPreemptionMode(Kernel *kernel) {
-    auto functionAttributes = kernel->getImmutableData()->getDescriptor().kernelAttributes;
-    NEO::PreemptionFlags flags = {};
-    flags.flags.disabledMidThreadPreemptionKernel = functionAttributes.flags.requiresDisabledMidThreadPreemption;
-    flags.flags.usesFencesForReadWriteImages = functionAttributes.flags.usesFencesForReadWriteImages;
-    flags.flags.deviceSupportsVmePreemption = device->getDeviceInfo().vmeAvcSupportsPreemption;
-    flags.flags.disablePerCtxtPreemptionGranularityControl = device->getHwInfo().workaroundTable.waDisablePerCtxtPreemptionGranularityControl;
-    flags.flags.disableLSQCROPERFforOCL = device->getHwInfo().workaroundTable.waDisableLSQCROPERFforOCL;
-
-    return NEO::PreemptionHelper::taskPreemptionMode(device->getDevicePreemptionMode(), flags);
+    auto preemptionMode = kernel->getImmutableData()->getPreemptionMode();
+    if (preemptionMode != NEO::PreemptionMode::Initial) {
+        return preemptionMode;
+    }
+    return KernelImmutableData::computePreemptionMode(*device, kernel->getImmutableData()->getDescriptor());
 }
 
 } // namespace L0
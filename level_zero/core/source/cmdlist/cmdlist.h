@@ -16,6 +16,7 @@
 #include <level_zero/ze_api.h>
 #include <level_zero/zet_api.h>
 
+#include <string>
 #include <vector>
 
 struct _ze_command_list_handle_t {};
@@ -28,6 +29,7 @@ struct Kernel;
 struct CommandList : _ze_command_list_handle_t {
     static constexpr uint32_t defaultNumIddsPerBlock = 64u;
     static constexpr uint32_t commandListimmediateIddsPerBlock = 1u;
+    static constexpr uint32_t kernelTimingHistogramBuckets = 16u;
 
     CommandList() = delete;
     CommandList(uint32_t numIddsPerBlock) : commandContainer(numIddsPerBlock) {}
@@ -77,12 +79,19 @@ struct CommandList : _ze_command_list_handle_t {
                                                             const uint32_t *pNumLaunchArguments,
                                                             const ze_group_count_t *pLaunchArgumentsBuffer, ze_event_handle_t hEvent,
                                                             uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) = 0;
+    virtual ze_result_t appendLaunchMutableKernel(ze_kernel_handle_t hKernel, const ze_group_count_t *pThreadGroupDimensions,
+                                                  ze_event_handle_t hEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents,
+                                                  uint32_t *pCommandId) = 0;
+    virtual ze_result_t updateMutableKernelArgument(uint32_t commandId, uint32_t argIndex, size_t argSize, const void *pArgValue) = 0;
+    virtual ze_result_t updateMutableGroupCount(uint32_t commandId, const ze_group_count_t *pThreadGroupDimensions) = 0;
+    virtual ze_result_t setKernelTimingHistogram(void *pHistogram) = 0;
+    virtual ze_result_t appendSWTagRangeMarker(const char *name, bool begin) = 0;
     virtual ze_result_t appendMemAdvise(ze_device_handle_t hDevice, const void *ptr, size_t size,
                                         ze_memory_advice_t advice) = 0;
     virtual ze_result_t appendMemoryCopy(void *dstptr, const void *srcptr, size_t size,
                                          ze_event_handle_t hSignalEvent, uint32_t numWaitEvents,
                                          ze_event_handle_t *phWaitEvents) = 0;
-    virtual ze_result_t appendPageFaultCopy(NEO::GraphicsAllocation *dstptr, NEO::GraphicsAllocation *srcptr, size_t size, bool flushHost) = 0;
+    virtual ze_result_t appendPageFaultCopy(NEO::GraphicsAllocation *dstptr, NEO::GraphicsAllocation *srcptr, size_t offset, size_t size, bool flushHost) = 0;
     virtual ze_result_t appendMemoryCopyRegion(void *dstPtr,
                                                const ze_copy_region_t *dstRegion,
                                                uint32_t dstPitch,
@@ -136,6 +145,7 @@ struct CommandList : _ze_command_list_handle_t {
                                         const ze_command_queue_desc_t *desc,
                                         bool internalUsage, NEO::EngineGroupType engineGroupType,
                                         ze_result_t &resultValue);
+    static bool isFlushTaskSubmissionPreferred(const NEO::CommandStreamReceiver &csr, NEO::EngineGroupType engineGroupType, bool internalUsage);
 
     static CommandList *fromHandle(ze_command_list_handle_t handle) {
         return static_cast<CommandList *>(handle);
@@ -169,6 +179,10 @@ struct CommandList : _ze_command_list_handle_t {
         return this->printfFunctionContainer;
     }
 
+    const std::vector<std::string> &getLaunchedKernelNames() const {
+        return this->launchedKernelNames;
+    }
+
     void storePrintfFunction(Kernel *kernel);
     void removeDeallocationContainerData();
     void removeHostPtrAllocations();
@@ -185,9 +199,16 @@ struct CommandList : _ze_command_list_handle_t {
     };
 
     CommandQueue *cmdQImmediate = nullptr;
+    NEO::CommandStreamReceiver *csr = nullptr;
     uint32_t cmdListType = CommandListType::TYPE_REGULAR;
+    bool isFlushTaskSubmissionEnabled = false;
+    bool isSyncModeQueue = false;
     Device *device = nullptr;
     std::vector<Kernel *> printfFunctionContainer;
+    // recorded only while launch overhead profiling is enabled
+    std::vector<std::string> launchedKernelNames;
+    NEO::CommandStreamReceiver *lastSubmissionCsr = nullptr;
+    uint32_t lastSubmissionTaskCount = 0u;
 
     virtual ze_result_t executeCommandListImmediate(bool performMigration) = 0;
     virtual ze_result_t initialize(Device *device, NEO::EngineGroupType engineGroupType) = 0;
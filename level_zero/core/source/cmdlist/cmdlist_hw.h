@@ -7,11 +7,15 @@
 
 #pragma once
 
+#include "shared/source/command_container/command_encoder.h"
+
 #include "level_zero/core/source/builtin/builtin_functions_lib.h"
 #include "level_zero/core/source/cmdlist/cmdlist_imp.h"
 
 #include "igfxfmid.h"
 
+#include <array>
+
 namespace NEO {
 enum class ImageType;
 }
@@ -29,6 +33,11 @@ struct AlignedAllocationData {
     bool needsFlush = false;
 };
 
+struct MutableKernelCommand {
+    Kernel *kernel = nullptr;
+    NEO::EncodedDispatchLocations locations;
+};
+
 struct EventPool;
 struct Event;
 
@@ -89,6 +98,16 @@ struct CommandListCoreFamily : CommandListImp {
                                                     ze_event_handle_t hEvent,
                                                     uint32_t numWaitEvents,
                                                     ze_event_handle_t *phWaitEvents) override;
+    ze_result_t appendLaunchMutableKernel(ze_kernel_handle_t hKernel,
+                                          const ze_group_count_t *pThreadGroupDimensions,
+                                          ze_event_handle_t hEvent,
+                                          uint32_t numWaitEvents,
+                                          ze_event_handle_t *phWaitEvents,
+                                          uint32_t *pCommandId) override;
+    ze_result_t updateMutableKernelArgument(uint32_t commandId, uint32_t argIndex, size_t argSize, const void *pArgValue) override;
+    ze_result_t updateMutableGroupCount(uint32_t commandId, const ze_group_count_t *pThreadGroupDimensions) override;
+    ze_result_t setKernelTimingHistogram(void *pHistogram) override;
+    ze_result_t appendSWTagRangeMarker(const char *name, bool begin) override;
     ze_result_t appendMemAdvise(ze_device_handle_t hDevice,
                                 const void *ptr, size_t size,
                                 ze_memory_advice_t advice) override;
@@ -97,6 +116,7 @@ struct CommandListCoreFamily : CommandListImp {
                                  ze_event_handle_t *phWaitEvents) override;
     ze_result_t appendPageFaultCopy(NEO::GraphicsAllocation *dstptr,
                                     NEO::GraphicsAllocation *srcptr,
+                                    size_t offset,
                                     size_t size,
                                     bool flushHost) override;
     ze_result_t appendMemoryCopyRegion(void *dstPtr,
@@ -212,6 +232,10 @@ struct CommandListCoreFamily : CommandListImp {
 
     ze_result_t setGlobalWorkSizeIndirect(NEO::CrossThreadDataOffset offsets[3], void *crossThreadAddress, uint32_t lws[3]);
     void appendWriteKernelTimestamp(ze_event_handle_t hEvent, bool beforeWalker, bool maskLsb);
+    ze_result_t appendQueryKernelTimestampsWithStores(uint32_t numEvents, ze_event_handle_t *phEvents, uint64_t dstAddress,
+                                                      const size_t *pOffsets, ze_event_handle_t hSignalEvent,
+                                                      uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents);
+    void appendCopyTimestampToQword(uint64_t srcAddress, uint64_t dstAddress);
     void appendEventForProfiling(ze_event_handle_t hEvent, bool beforeWalker);
     void appendEventForProfilingAllWalkers(ze_event_handle_t hEvent, bool beforeWalker);
     void appendEventForProfilingCopyCommand(ze_event_handle_t hEvent, bool beforeWalker);
@@ -222,6 +246,19 @@ struct CommandListCoreFamily : CommandListImp {
     uint64_t getInputBufferSize(NEO::ImageType imageType, uint64_t bytesPerPixel, const ze_image_region_t *region);
     MOCKABLE_VIRTUAL AlignedAllocationData getAlignedAllocation(Device *device, const void *buffer, uint64_t bufferSize);
     ze_result_t addEventsToCmdList(uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents);
+    void markStallingPipeControl(bool dcFlushed);
+    bool isPrecededByStallingPipeControl(bool dcFlushRequired) const;
+
+    std::vector<MutableKernelCommand> mutableKernelCommands;
+    NEO::EncodedDispatchLocations *mutableDispatchLocations = nullptr;
+
+    NEO::GraphicsAllocation *kernelTimingHistogramAllocation = nullptr;
+    uint64_t kernelTimingHistogramAddress = 0u;
+    std::array<uint32_t, kernelTimingHistogramBuckets - 1> kernelTimingThresholds = {};
+
+    // command stream position right behind the last CS stalling PIPE_CONTROL, barriers recorded there are redundant
+    const void *stallingPipeControlEnd = nullptr;
+    bool stallingPipeControlDcFlushed = false;
 };
 
 template <PRODUCT_FAMILY gfxProductFamily>
@@ -24,16 +24,22 @@
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
+#include "shared/source/utilities/launch_overhead_profiler.h"
+#include "shared/source/utilities/software_tags_manager.h"
 
 #include "level_zero/core/source/cmdlist/cmdlist_hw.h"
 #include "level_zero/core/source/device/device_imp.h"
 #include "level_zero/core/source/event/event.h"
 #include "level_zero/core/source/image/image.h"
+#include "level_zero/core/source/kernel/kernel_imp.h"
 #include "level_zero/core/source/module/module.h"
 
 #include "pipe_control_args.h"
 
 #include <algorithm>
+#include <cmath>
+#include <limits>
 
 namespace L0 {
 
@@ -65,6 +71,8 @@ void CommandListCoreFamily<gfxCoreFamily>::programThreadArbitrationPolicy(Device
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::reset() {
     printfFunctionContainer.clear();
+    launchedKernelNames.clear();
+    mutableKernelCommands.clear();
     removeDeallocationContainerData();
     removeHostPtrAllocations();
     commandContainer.reset();
@@ -74,6 +82,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::reset() {
     unifiedMemoryControls.indirectSharedAllocationsAllowed = false;
     commandListPreemptionMode = device->getDevicePreemptionMode();
     commandListPerThreadScratchSize = 0u;
+    stallingPipeControlEnd = nullptr;
 
     if (!isCopyOnly()) {
         if (!NEO::ApiSpecificConfig::getBindlessConfiguration()) {
@@ -139,6 +148,11 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernel(ze_kernel_h
                                                                      ze_event_handle_t hEvent,
                                                                      uint32_t numWaitEvents,
                                                                      ze_event_handle_t *phWaitEvents) {
+    auto kernel = Kernel::fromHandle(hKernel);
+    NEO::ScopedKernelLaunch kernelLaunch(kernel ? kernel->getKernelDescriptor().kernelMetadata.kernelName.c_str() : nullptr);
+    if (kernelLaunch.profiler && cmdListType == CommandListType::TYPE_REGULAR) {
+        launchedKernelNames.push_back(kernel->getKernelDescriptor().kernelMetadata.kernelName);
+    }
 
     ze_result_t ret = addEventsToCmdList(numWaitEvents, phWaitEvents);
     if (ret) {
@@ -214,6 +228,189 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchMultipleKernelsInd
     return ret;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchMutableKernel(ze_kernel_handle_t hKernel,
+                                                                            const ze_group_count_t *pThreadGroupDimensions,
+                                                                            ze_event_handle_t hEvent,
+                                                                            uint32_t numWaitEvents,
+                                                                            ze_event_handle_t *phWaitEvents,
+                                                                            uint32_t *pCommandId) {
+    if (cmdListType == CommandListType::TYPE_IMMEDIATE) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    if (pThreadGroupDimensions == nullptr || pCommandId == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    ze_result_t ret = addEventsToCmdList(numWaitEvents, phWaitEvents);
+    if (ret) {
+        return ret;
+    }
+
+    MutableKernelCommand command;
+    command.kernel = Kernel::fromHandle(hKernel);
+    mutableDispatchLocations = &command.locations;
+    ret = appendLaunchKernelWithParams(hKernel, pThreadGroupDimensions,
+                                       hEvent, false, false);
+    mutableDispatchLocations = nullptr;
+    if (ret) {
+        return ret;
+    }
+
+    *pCommandId = static_cast<uint32_t>(mutableKernelCommands.size());
+    mutableKernelCommands.push_back(command);
+
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::updateMutableKernelArgument(uint32_t commandId, uint32_t argIndex,
+                                                                              size_t argSize, const void *pArgValue) {
+    using RENDER_SURFACE_STATE = typename GfxFamily::RENDER_SURFACE_STATE;
+
+    if (commandId >= mutableKernelCommands.size()) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto &command = mutableKernelCommands[commandId];
+    auto kernel = static_cast<KernelImp *>(command.kernel);
+
+    const auto &explicitArgs = kernel->getKernelDescriptor().payloadMappings.explicitArgs;
+    if (argIndex >= explicitArgs.size()) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    // Only arguments living entirely in cross thread data and surface states can be patched in place,
+    // anything changing the layout of the dispatch (SLM, images, samplers, bindless) requires recording again
+    const auto &arg = explicitArgs[argIndex];
+    if (arg.is<NEO::ArgDescriptor::ArgTPointer>()) {
+        if (arg.getTraits().getAddressQualifier() == NEO::KernelArgMetadata::AddrLocal ||
+            NEO::isValidOffset(arg.as<NEO::ArgDescPointer>().bindless)) {
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        }
+    } else if (false == arg.is<NEO::ArgDescriptor::ArgTValue>()) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    auto ret = kernel->setArgumentValue(argIndex, argSize, pArgValue);
+    if (ret != ZE_RESULT_SUCCESS) {
+        return ret;
+    }
+    if (kernel->getKernelRequiresUncachedMocs() && (false == containsStatelessUncachedResource)) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    auto srcCrossThreadData = kernel->getCrossThreadData();
+    auto dstCrossThreadData = command.locations.crossThreadData;
+    if (arg.is<NEO::ArgDescriptor::ArgTValue>()) {
+        for (const auto &element : arg.as<NEO::ArgDescValue>().elements) {
+            memcpy_s(ptrOffset(dstCrossThreadData, element.offset), element.size,
+                     ptrOffset(srcCrossThreadData, element.offset), element.size);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    const auto &argAsPointer = arg.as<NEO::ArgDescPointer>();
+    if (NEO::isValidOffset(argAsPointer.stateless)) {
+        memcpy_s(ptrOffset(dstCrossThreadData, argAsPointer.stateless), argAsPointer.pointerSize,
+                 ptrOffset(srcCrossThreadData, argAsPointer.stateless), argAsPointer.pointerSize);
+    }
+    if (NEO::isValidOffset(argAsPointer.bindful) && command.locations.surfaceStates) {
+        memcpy_s(ptrOffset(command.locations.surfaceStates, argAsPointer.bindful), sizeof(RENDER_SURFACE_STATE),
+                 ptrOffset(kernel->getSurfaceStateHeapData(), argAsPointer.bindful), sizeof(RENDER_SURFACE_STATE));
+    }
+
+    auto allocation = kernel->getResidencyContainer()[argIndex];
+    if (allocation) {
+        commandContainer.addToResidencyContainer(allocation);
+    }
+
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::updateMutableGroupCount(uint32_t commandId, const ze_group_count_t *pThreadGroupDimensions) {
+    using WALKER_TYPE = typename GfxFamily::WALKER_TYPE;
+
+    if (commandId >= mutableKernelCommands.size()) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    if (pThreadGroupDimensions == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    auto &command = mutableKernelCommands[commandId];
+    auto kernel = command.kernel;
+
+    kernel->setGroupCount(pThreadGroupDimensions->groupCountX,
+                          pThreadGroupDimensions->groupCountY,
+                          pThreadGroupDimensions->groupCountZ);
+
+    const auto &dispatchTraits = kernel->getKernelDescriptor().payloadMappings.dispatchTraits;
+    auto srcCrossThreadData = kernel->getCrossThreadData();
+    auto dstCrossThreadData = command.locations.crossThreadData;
+    for (uint32_t i = 0; i < 3; i++) {
+        for (auto offset : {dispatchTraits.numWorkGroups[i], dispatchTraits.globalWorkSize[i]}) {
+            if (NEO::isValidOffset(offset)) {
+                memcpy_s(ptrOffset(dstCrossThreadData, offset), sizeof(uint32_t),
+                         ptrOffset(srcCrossThreadData, offset), sizeof(uint32_t));
+            }
+        }
+    }
+
+    auto walker = reinterpret_cast<WALKER_TYPE *>(command.locations.walkerCmd);
+    walker->setThreadGroupIdXDimension(pThreadGroupDimensions->groupCountX);
+    walker->setThreadGroupIdYDimension(pThreadGroupDimensions->groupCountY);
+    walker->setThreadGroupIdZDimension(pThreadGroupDimensions->groupCountZ);
+
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::setKernelTimingHistogram(void *pHistogram) {
+    if (pHistogram == nullptr) {
+        kernelTimingHistogramAllocation = nullptr;
+        kernelTimingHistogramAddress = 0u;
+        return ZE_RESULT_SUCCESS;
+    }
+    if (isCopyOnly()) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    auto allocData = device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(pHistogram);
+    if (allocData == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    // bucket i counts kernels shorter than 2^i microseconds
+    auto timerResolution = device->getNEODevice()->getProfilingTimerResolution();
+    for (uint32_t i = 0; i < kernelTimingThresholds.size(); i++) {
+        auto thresholdNs = static_cast<double>(1000ull << i);
+        kernelTimingThresholds[i] = static_cast<uint32_t>(std::min(std::ceil(thresholdNs / timerResolution),
+                                                                   static_cast<double>(std::numeric_limits<uint32_t>::max())));
+    }
+
+    kernelTimingHistogramAllocation = allocData->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex());
+    kernelTimingHistogramAddress = reinterpret_cast<uint64_t>(pHistogram);
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendSWTagRangeMarker(const char *name, bool begin) {
+    if (begin && name == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    if (!NEO::DebugManager.flags.EnableSWTags.get()) {
+        return ZE_RESULT_SUCCESS;
+    }
+
+    auto neoDevice = device->getNEODevice();
+    auto tagsManager = neoDevice->getRootDeviceEnvironment().tagsManager.get();
+    if (begin) {
+        tagsManager->insertTag<GfxFamily, NEO::SWTags::UserRangeBeginTag>(*commandContainer.getCommandStream(), *neoDevice, name);
+    } else {
+        tagsManager->insertTag<GfxFamily, NEO::SWTags::UserRangeEndTag>(*commandContainer.getCommandStream(), *neoDevice);
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendEventReset(ze_event_handle_t hEvent) {
     using POST_SYNC_OPERATION = typename GfxFamily::PIPE_CONTROL::POST_SYNC_OPERATION;
@@ -238,6 +435,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendEventReset(ze_event_hand
             Event::STATE_CLEARED,
             commandContainer.getDevice()->getHardwareInfo(),
             args);
+        markStallingPipeControl(args.dcFlushEnable);
     }
 
     return ZE_RESULT_SUCCESS;
@@ -257,9 +455,10 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendBarrier(ze_event_handle_
     if (!hSignalEvent) {
         if (isCopyOnly()) {
             NEO::EncodeMiFlushDW<GfxFamily>::programMiFlushDw(*commandContainer.getCommandStream(), 0, 0, false, false);
-        } else {
+        } else if (!isPrecededByStallingPipeControl(false)) {
             NEO::PipeControlArgs args;
             NEO::MemorySynchronizationCommands<GfxFamily>::addPipeControl(*commandContainer.getCommandStream(), args);
+            markStallingPipeControl(args.dcFlushEnable);
         }
     } else {
         appendSignalEventPostWalker(hSignalEvent);
@@ -657,8 +856,27 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMemAdvise(ze_device_hand
                                                                   const void *ptr, size_t size,
                                                                   ze_memory_advice_t advice) {
 
-    auto allocData = device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(ptr);
+    auto svmAllocsManager = device->getDriverHandle()->getSvmAllocsManager();
+    auto allocData = svmAllocsManager->getSVMAlloc(ptr);
     if (allocData) {
+        auto memAdviseFlags = allocData->memAdviseFlags;
+        switch (advice) {
+        case ZE_MEMORY_ADVICE_SET_READ_MOSTLY:
+            memAdviseFlags.readMostly = 1;
+            break;
+        case ZE_MEMORY_ADVICE_CLEAR_READ_MOSTLY:
+            memAdviseFlags.readMostly = 0;
+            break;
+        case ZE_MEMORY_ADVICE_SET_PREFERRED_LOCATION:
+            memAdviseFlags.devicePreferredLocation = 1;
+            break;
+        case ZE_MEMORY_ADVICE_CLEAR_PREFERRED_LOCATION:
+            memAdviseFlags.devicePreferredLocation = 0;
+            break;
+        default:
+            break;
+        }
+        svmAllocsManager->setMemAdviseFlags(ptr, memAdviseFlags);
         return ZE_RESULT_SUCCESS;
     }
     return ZE_RESULT_ERROR_UNKNOWN;
@@ -786,7 +1004,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMemoryCopyBlitRegion(NEO
     if (copyOneCommand) {
         NEO::BlitCommandsHelper<GfxFamily>::dispatchBlitCommandsRegion(blitProperties, *commandContainer.getCommandStream(), *device->getNEODevice()->getExecutionEnvironment()->rootDeviceEnvironments[device->getRootDeviceIndex()]);
     } else {
-        NEO::BlitCommandsHelper<GfxFamily>::dispatchBlitCommandsForBufferPerRow(blitProperties, *commandContainer.getCommandStream(), *device->getNEODevice()->getExecutionEnvironment()->rootDeviceEnvironments[device->getRootDeviceIndex()]);
+        NEO::BlitCommandsHelper<GfxFamily>::dispatchBlitCommands(blitProperties, *commandContainer.getCommandStream(), *device->getNEODevice()->getExecutionEnvironment()->rootDeviceEnvironments[device->getRootDeviceIndex()]);
     }
     appendSignalEventPostWalker(hSignalEvent);
     return ZE_RESULT_SUCCESS;
@@ -822,7 +1040,13 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendCopyImageBlit(NEO::Graph
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(NEO::GraphicsAllocation *dstptr,
                                                                       NEO::GraphicsAllocation *srcptr,
-                                                                      size_t size, bool flushHost) {
+                                                                      size_t offset, size_t size, bool flushHost) {
+
+    if (isCopyOnly()) {
+        return appendMemoryCopyBlit(static_cast<uintptr_t>(dstptr->getGpuAddress() + offset), dstptr, 0u,
+                                    static_cast<uintptr_t>(srcptr->getGpuAddress() + offset), srcptr, 0u,
+                                    static_cast<uint32_t>(size));
+    }
 
     auto lock = device->getBuiltinFunctionsLib()->obtainUniqueOwnership();
 
@@ -839,8 +1063,8 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(NEO::Graph
         return ZE_RESULT_ERROR_UNKNOWN;
     }
 
-    auto dstValPtr = static_cast<uintptr_t>(dstptr->getGpuAddress());
-    auto srcValPtr = static_cast<uintptr_t>(srcptr->getGpuAddress());
+    auto dstValPtr = static_cast<uintptr_t>(dstptr->getGpuAddress() + offset);
+    auto srcValPtr = static_cast<uintptr_t>(srcptr->getGpuAddress() + offset);
 
     builtinFunction->setArgBufferWithAlloc(0, dstValPtr, dstptr);
     builtinFunction->setArgBufferWithAlloc(1, srcValPtr, srcptr);
@@ -1155,6 +1379,10 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMemoryPrefetch(const voi
                                                                        size_t count) {
     auto allocData = device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(ptr);
     if (allocData) {
+        auto pageFaultManager = device->getDriverHandle()->getMemoryManager()->getPageFaultManager();
+        if (pageFaultManager && allocData->memoryType == InternalMemoryType::SHARED_UNIFIED_MEMORY) {
+            pageFaultManager->moveAllocationToGpuDomainAsync(const_cast<void *>(ptr));
+        }
         return ZE_RESULT_SUCCESS;
     }
     return ZE_RESULT_ERROR_UNKNOWN;
@@ -1341,30 +1569,32 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendBlitFill(void *ptr,
                                                                  uint32_t numWaitEvents,
                                                                  ze_event_handle_t *phWaitEvents) {
     auto neoDevice = device->getNEODevice();
-    if (NEO::HwHelper::get(device->getHwInfo().platform.eRenderCoreFamily).getMaxFillPaternSizeForCopyEngine() < patternSize) {
+    auto maxPatternSize = NEO::HwHelper::get(device->getHwInfo().platform.eRenderCoreFamily).getMaxFillPaternSizeForCopyEngine();
+    uint32_t patternToCommand[4] = {};
+    auto colorFillPatternSize = NEO::BlitHelper::narrowFillPattern(patternToCommand, pattern, patternSize, maxPatternSize);
+    if (colorFillPatternSize == 0) {
         return ZE_RESULT_ERROR_INVALID_SIZE;
-    } else {
-        ze_result_t ret = addEventsToCmdList(numWaitEvents, phWaitEvents);
-        if (ret) {
-            return ret;
-        }
-        appendEventForProfiling(hSignalEvent, true);
-        NEO::GraphicsAllocation *gpuAllocation = device->getDriverHandle()->getDriverSystemMemoryAllocation(ptr,
-                                                                                                            size,
-                                                                                                            neoDevice->getRootDeviceIndex(),
-                                                                                                            nullptr);
-        if (gpuAllocation == nullptr) {
-            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
-        }
-        commandContainer.addToResidencyContainer(gpuAllocation);
-        uint32_t patternToCommand[4] = {};
-        memcpy_s(&patternToCommand, sizeof(patternToCommand), pattern, patternSize);
-        NEO::BlitCommandsHelper<GfxFamily>::dispatchBlitMemoryColorFill(gpuAllocation, patternToCommand, patternSize,
-                                                                        *commandContainer.getCommandStream(),
-                                                                        size,
-                                                                        *neoDevice->getExecutionEnvironment()->rootDeviceEnvironments[device->getRootDeviceIndex()]);
-        appendSignalEventPostWalker(hSignalEvent);
     }
+    ze_result_t ret = addEventsToCmdList(numWaitEvents, phWaitEvents);
+    if (ret) {
+        return ret;
+    }
+    appendEventForProfiling(hSignalEvent, true);
+    uintptr_t dstGpuAddress = 0;
+    NEO::GraphicsAllocation *gpuAllocation = device->getDriverHandle()->getDriverSystemMemoryAllocation(ptr,
+                                                                                                        size,
+                                                                                                        neoDevice->getRootDeviceIndex(),
+                                                                                                        &dstGpuAddress);
+    if (gpuAllocation == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    commandContainer.addToResidencyContainer(gpuAllocation);
+    colorFillPatternSize = NEO::BlitHelper::widenFillPattern(patternToCommand, colorFillPatternSize, dstGpuAddress, size, maxPatternSize);
+    NEO::BlitCommandsHelper<GfxFamily>::dispatchBlitMemoryColorFill(gpuAllocation, dstGpuAddress, patternToCommand, colorFillPatternSize,
+                                                                    *commandContainer.getCommandStream(),
+                                                                    size,
+                                                                    *neoDevice->getExecutionEnvironment()->rootDeviceEnvironments[device->getRootDeviceIndex()]);
+    appendSignalEventPostWalker(hSignalEvent);
     return ZE_RESULT_SUCCESS;
 }
 
@@ -1492,10 +1722,31 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendSignalEvent(ze_event_han
             ptrOffset(baseAddr, eventSignalOffset), Event::STATE_SIGNALED,
             commandContainer.getDevice()->getHardwareInfo(),
             args);
+        markStallingPipeControl(args.dcFlushEnable);
     }
     return ZE_RESULT_SUCCESS;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamily<gfxCoreFamily>::markStallingPipeControl(bool dcFlushed) {
+    auto commandStream = commandContainer.getCommandStream();
+    stallingPipeControlEnd = ptrOffset(commandStream->getCpuBase(), commandStream->getUsed());
+    stallingPipeControlDcFlushed = dcFlushed;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamily<gfxCoreFamily>::isPrecededByStallingPipeControl(bool dcFlushRequired) const {
+    // immediate lists submit in between appends, so only regular lists are recorded as a whole
+    if (NEO::DebugManager.flags.ElideRedundantPipeControls.get() == 0 ||
+        cmdListType != CommandListType::TYPE_REGULAR ||
+        stallingPipeControlEnd == nullptr) {
+        return false;
+    }
+    auto commandStream = commandContainer.getCommandStream();
+    return stallingPipeControlEnd == ptrOffset(commandStream->getCpuBase(), commandStream->getUsed()) &&
+           (stallingPipeControlDcFlushed || !dcFlushRequired);
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendWaitOnEvents(uint32_t numEvents,
                                                                      ze_event_handle_t *phEvent) {
@@ -1516,9 +1767,10 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendWaitOnEvents(uint32_t nu
     if (dcFlushRequired) {
         if (isCopyOnly()) {
             NEO::EncodeMiFlushDW<GfxFamily>::programMiFlushDw(*commandContainer.getCommandStream(), 0, 0, false, false);
-        } else {
+        } else if (!isPrecededByStallingPipeControl(true)) {
             NEO::PipeControlArgs args(true);
             NEO::MemorySynchronizationCommands<GfxFamily>::addPipeControl(*commandContainer.getCommandStream(), args);
+            markStallingPipeControl(args.dcFlushEnable);
         }
     }
 
@@ -1646,6 +1898,16 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendQueryKernelTimestamps(
     auto dstptrAllocationStruct = getAlignedAllocation(this->device, dstptr, sizeof(ze_kernel_timestamp_result_t) * numEvents);
     commandContainer.addToResidencyContainer(dstptrAllocationStruct.alloc);
 
+    bool useStoreCommands = !isCopyOnly() && NEO::DebugManager.flags.EnableQueryKernelTimestampsWithStores.get() != 0;
+    for (uint32_t i = 0u; i < numEvents && useStoreCommands; ++i) {
+        // reducing several packets to min start / max end needs the builtin kernel
+        useStoreCommands = Event::fromHandle(phEvents[i])->getPacketsInUse() <= 1u;
+    }
+    if (useStoreCommands) {
+        return appendQueryKernelTimestampsWithStores(numEvents, phEvents, dstptrAllocationStruct.alignedAllocationPtr + dstptrAllocationStruct.offset,
+                                                     pOffsets, hSignalEvent, numWaitEvents, phWaitEvents);
+    }
+
     std::unique_ptr<EventData[]> timestampsData = std::make_unique<EventData[]>(numEvents);
 
     for (uint32_t i = 0u; i < numEvents; ++i) {
@@ -1725,6 +1987,55 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendQueryKernelTimestamps(
     return ZE_RESULT_SUCCESS;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendQueryKernelTimestampsWithStores(
+    uint32_t numEvents, ze_event_handle_t *phEvents, uint64_t dstAddress,
+    const size_t *pOffsets, ze_event_handle_t hSignalEvent,
+    uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+
+    ze_result_t ret = addEventsToCmdList(numWaitEvents, phWaitEvents);
+    if (ret) {
+        return ret;
+    }
+    appendEventForProfiling(hSignalEvent, true);
+
+    // GPR R0 is loaded one dword at a time, so its upper half stays zero and each
+    // 32-bit packet field is stored as a zero-extended qword, as the builtin kernel does
+    NEO::EncodeSetMMIO<GfxFamily>::encodeIMM(commandContainer, CS_GPR_R0 + sizeof(uint32_t), 0u, true);
+
+    auto useOnlyGlobalTimestamps = NEO::HwHelper::get(device->getHwInfo().platform.eRenderCoreFamily).useOnlyGlobalTimestamps();
+
+    for (uint32_t i = 0u; i < numEvents; ++i) {
+        auto event = Event::fromHandle(phEvents[i]);
+        commandContainer.addToResidencyContainer(&event->getAllocation());
+
+        auto srcAddress = event->getGpuAddress();
+        auto dstResultAddress = dstAddress + (pOffsets ? pOffsets[i] : i * sizeof(ze_kernel_timestamp_result_t));
+        auto contextStartOffset = useOnlyGlobalTimestamps ? offsetof(TimestampPacketStorage::Packet, globalStart) : offsetof(TimestampPacketStorage::Packet, contextStart);
+        auto contextEndOffset = useOnlyGlobalTimestamps ? offsetof(TimestampPacketStorage::Packet, globalEnd) : offsetof(TimestampPacketStorage::Packet, contextEnd);
+
+        appendCopyTimestampToQword(srcAddress + offsetof(TimestampPacketStorage::Packet, globalStart),
+                                   dstResultAddress + offsetof(ze_kernel_timestamp_result_t, global.kernelStart));
+        appendCopyTimestampToQword(srcAddress + offsetof(TimestampPacketStorage::Packet, globalEnd),
+                                   dstResultAddress + offsetof(ze_kernel_timestamp_result_t, global.kernelEnd));
+        appendCopyTimestampToQword(srcAddress + contextStartOffset,
+                                   dstResultAddress + offsetof(ze_kernel_timestamp_result_t, context.kernelStart));
+        appendCopyTimestampToQword(srcAddress + contextEndOffset,
+                                   dstResultAddress + offsetof(ze_kernel_timestamp_result_t, context.kernelEnd));
+    }
+
+    appendSignalEventPostWalker(hSignalEvent);
+
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamily<gfxCoreFamily>::appendCopyTimestampToQword(uint64_t srcAddress, uint64_t dstAddress) {
+    NEO::EncodeSetMMIO<GfxFamily>::encodeMEM(commandContainer, CS_GPR_R0, srcAddress);
+    NEO::EncodeStoreMMIO<GfxFamily>::encode(*commandContainer.getCommandStream(), CS_GPR_R0, dstAddress);
+    NEO::EncodeStoreMMIO<GfxFamily>::encode(*commandContainer.getCommandStream(), CS_GPR_R0 + sizeof(uint32_t), dstAddress + sizeof(uint32_t));
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::reserveSpace(size_t size, void **ptr) {
     auto availableSpace = commandContainer.getCommandStream()->getAvailableSpace();
@@ -15,6 +15,7 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/residency_container.h"
 #include "shared/source/unified_memory/unified_memory.h"
+#include "shared/source/utilities/launch_overhead_profiler.h"
 #include "shared/source/utilities/software_tags_manager.h"
 
 #include "level_zero/core/source/kernel/kernel_imp.h"
@@ -50,12 +51,15 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(z
     auto kernelPreemptionMode = obtainFunctionPreemptionMode(kernel);
     commandListPreemptionMode = std::min(commandListPreemptionMode, kernelPreemptionMode);
 
-    kernel->patchGlobalOffset();
+    {
+        NEO::ScopedLaunchPhase launchPhase(NEO::LaunchOverheadProfiler::Phase::argumentPatching);
+        kernel->patchGlobalOffset();
 
-    if (!isIndirect) {
-        kernel->setGroupCount(pThreadGroupDimensions->groupCountX,
-                              pThreadGroupDimensions->groupCountY,
-                              pThreadGroupDimensions->groupCountZ);
+        if (!isIndirect) {
+            kernel->setGroupCount(pThreadGroupDimensions->groupCountX,
+                                  pThreadGroupDimensions->groupCountY,
+                                  pThreadGroupDimensions->groupCountZ);
+        }
     }
 
     if (isIndirect && pThreadGroupDimensions) {
@@ -91,18 +95,28 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(z
             kernel->getKernelDescriptor().kernelMetadata.kernelName.c_str());
     }
 
-    NEO::EncodeDispatchKernel<GfxFamily>::encode(commandContainer,
-                                                 reinterpret_cast<const void *>(pThreadGroupDimensions),
-                                                 isIndirect,
-                                                 isPredicate,
-                                                 kernel,
-                                                 0,
-                                                 false,
-                                                 neoDevice,
-                                                 commandListPreemptionMode,
-                                                 this->containsStatelessUncachedResource,
-                                                 partitionCount,
-                                                 internalUsage);
+    // a predicated walker may not run, so its time is not counted
+    const bool countKernelTiming = kernelTimingHistogramAllocation && !isPredicate;
+    if (countKernelTiming) {
+        NEO::EncodeDurationHistogram<GfxFamily>::encodeStart(commandContainer);
+    }
+
+    {
+        NEO::ScopedLaunchPhase launchPhase(NEO::LaunchOverheadProfiler::Phase::encoding);
+        NEO::EncodeDispatchKernel<GfxFamily>::encode(commandContainer,
+                                                     reinterpret_cast<const void *>(pThreadGroupDimensions),
+                                                     isIndirect,
+                                                     isPredicate,
+                                                     kernel,
+                                                     0,
+                                                     false,
+                                                     neoDevice,
+                                                     commandListPreemptionMode,
+                                                     this->containsStatelessUncachedResource,
+                                                     partitionCount,
+                                                     internalUsage,
+                                                     isIndirect ? nullptr : mutableDispatchLocations);
+    }
 
     if (neoDevice->getDebugger()) {
         auto *ssh = commandContainer.getIndirectHeap(NEO::HeapType::SURFACE_STATE);
@@ -115,6 +129,14 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(z
                                                          debugSurface, neoDevice->getGmmHelper(), kernelImp->getKernelDescriptor().kernelAttributes.flags.useGlobalAtomics, 1u);
     }
 
+    if (countKernelTiming) {
+        NEO::PipeControlArgs args = {};
+        NEO::MemorySynchronizationCommands<GfxFamily>::addPipeControl(*commandContainer.getCommandStream(), args);
+        NEO::EncodeDurationHistogram<GfxFamily>::encodeUpdate(commandContainer, kernelTimingHistogramAddress,
+                                                              kernelTimingThresholds.data(), kernelTimingHistogramBuckets);
+        commandContainer.addToResidencyContainer(kernelTimingHistogramAllocation);
+    }
+
     appendSignalEventPostWalker(hEvent);
 
     commandContainer.addToResidencyContainer(functionImmutableData->getIsaGraphicsAllocation());
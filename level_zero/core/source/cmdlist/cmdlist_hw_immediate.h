@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -17,10 +17,16 @@ struct Event;
 template <GFXCORE_FAMILY gfxCoreFamily>
 struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFamily> {
     using BaseClass = CommandListCoreFamily<gfxCoreFamily>;
-    using BaseClass::executeCommandListImmediate;
 
     using BaseClass::BaseClass;
 
+    static constexpr size_t minCommandStreamSpaceForAppend = 64 * MemoryConstants::kiloByte;
+
+    ~CommandListCoreFamilyImmediate() override;
+
+    ze_result_t executeCommandListImmediate(bool performMigration) override;
+    ze_result_t executeCommandListImmediateWithFlushTask(bool performMigration);
+
     ze_result_t appendLaunchKernel(ze_kernel_handle_t hKernel,
                                    const ze_group_count_t *pThreadGroupDimensions,
                                    ze_event_handle_t hEvent, uint32_t numWaitEvents,
@@ -65,7 +71,7 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     ze_result_t appendEventReset(ze_event_handle_t hEvent) override;
 
     ze_result_t appendPageFaultCopy(NEO::GraphicsAllocation *dstptr, NEO::GraphicsAllocation *srcptr,
-                                    size_t size, bool flushHost) override;
+                                    size_t offset, size_t size, bool flushHost) override;
 
     ze_result_t appendWaitOnEvents(uint32_t numEvents, ze_event_handle_t *phEvent) override;
 
@@ -89,6 +95,13 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
                                         ze_event_handle_t hEvent,
                                         uint32_t numWaitEvents,
                                         ze_event_handle_t *phWaitEvents) override;
+
+  protected:
+    ze_result_t executeSpilledCommandListImmediate(bool performMigration);
+    void checkAvailableSpace();
+
+    size_t cmdListCurrentStartOffset = 0u;
+    uint32_t cmdBufferTaskCount = 0u;
 };
 
 template <PRODUCT_FAMILY gfxProductFamily>
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,18 +7,189 @@
 
 #pragma once
 
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/command_stream/csr_definitions.h"
+#include "shared/source/command_stream/thread_arbitration_policy.h"
+#include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/memory_manager/unified_memory_manager.h"
+#include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
+#include "shared/source/utilities/launch_overhead_profiler.h"
+
 #include "level_zero/core/source/cmdlist/cmdlist_hw_immediate.h"
+#include "level_zero/core/source/driver/driver_handle_imp.h"
+
+#include <cstring>
 
 namespace L0 {
+template <GFXCORE_FAMILY gfxCoreFamily>
+CommandListCoreFamilyImmediate<gfxCoreFamily>::~CommandListCoreFamilyImmediate() {
+    if (this->isFlushTaskSubmissionEnabled) {
+        this->csr->waitForCompletionWithTimeout(false, 0, this->cmdBufferTaskCount);
+    }
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::executeCommandListImmediate(bool performMigration) {
+    if (this->isFlushTaskSubmissionEnabled) {
+        return executeCommandListImmediateWithFlushTask(performMigration);
+    }
+    return BaseClass::executeCommandListImmediate(performMigration);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::executeCommandListImmediateWithFlushTask(bool performMigration) {
+    if (this->commandContainer.getCmdBufferAllocations().size() > 1u) {
+        return executeSpilledCommandListImmediate(performMigration);
+    }
+
+    auto commandStream = this->commandContainer.getCommandStream();
+
+    auto neoDevice = this->device->getNEODevice();
+    auto lockCSR = this->csr->obtainUniqueOwnership();
+
+    auto &residencyContainer = this->commandContainer.getResidencyContainer();
+    if (this->hasIndirectAllocationsAllowed()) {
+        auto svmAllocsManager = this->device->getDriverHandle()->getSvmAllocsManager();
+        svmAllocsManager->addInternalAllocationsToResidencyContainer(neoDevice->getRootDeviceIndex(),
+                                                                     residencyContainer,
+                                                                     this->getUnifiedMemoryControls().generateMask());
+    }
+    this->commandContainer.removeDuplicatesFromResidencyContainer();
+
+    NEO::PageFaultManager *pageFaultManager = nullptr;
+    if (performMigration) {
+        pageFaultManager = this->device->getDriverHandle()->getMemoryManager()->getPageFaultManager();
+    }
+
+    for (auto alloc : residencyContainer) {
+        if (alloc == nullptr) {
+            continue;
+        }
+        if (pageFaultManager &&
+            (alloc->getAllocationType() == NEO::GraphicsAllocation::AllocationType::SVM_GPU ||
+             alloc->getAllocationType() == NEO::GraphicsAllocation::AllocationType::SVM_CPU)) {
+            pageFaultManager->moveAllocationToGpuDomain(reinterpret_cast<void *>(alloc->getGpuAddress()));
+        }
+        this->csr->makeResident(*alloc);
+    }
+
+    if (pageFaultManager) {
+        auto driverHandleImp = static_cast<DriverHandleImp *>(this->device->getDriverHandle());
+        std::lock_guard<std::mutex> lock(driverHandleImp->sharedMakeResidentAllocationsLock);
+        for (auto alloc : driverHandleImp->sharedMakeResidentAllocations) {
+            pageFaultManager->moveAllocationToGpuDomain(reinterpret_cast<void *>(alloc.second->getGpuAddress()));
+        }
+    }
+
+    auto perThreadScratchSize = this->getCommandListPerThreadScratchSize();
+    if (perThreadScratchSize > 0 && NEO::DebugManager.flags.SizeScratchForBuiltKernels.get() != 0) {
+        perThreadScratchSize = std::max(perThreadScratchSize, this->device->getNEODevice()->getMaxKernelPerThreadScratchSize());
+        this->csr->getScratchSpaceController()->shrinkScratchSpace(perThreadScratchSize, this->csr->peekTaskCount(), this->csr->getOsContext());
+    }
+    this->csr->setRequiredScratchSizes(perThreadScratchSize, 0u);
+    this->device->activateMetricGroups();
+
+    NEO::DispatchFlags dispatchFlags(
+        {},                                                  //csrDependencies
+        nullptr,                                             //barrierTimestampPacketNodes
+        {},                                                  //pipelineSelectArgs
+        nullptr,                                             //flushStampReference
+        NEO::QueueThrottle::MEDIUM,                          //throttle
+        this->getCommandListPreemptionMode(),                //preemptionMode
+        NEO::GrfConfig::NotApplicable,                       //numGrfRequired
+        NEO::L3CachingSettings::l3CacheOn,                   //l3CacheSettings
+        NEO::ThreadArbitrationPolicy::NotPresent,            //threadArbitrationPolicy
+        NEO::AdditionalKernelExecInfo::NotApplicable,        //additionalKernelExecInfo
+        NEO::KernelExecutionType::NotApplicable,             //kernelExecutionType
+        NEO::MemoryCompressionState::NotApplicable,          //memoryCompressionState
+        NEO::QueueSliceCount::defaultSliceCount,             //sliceCount
+        this->isSyncModeQueue,                               //blocking
+        true,                                                //dcFlush
+        false,                                               //useSLM
+        true,                                                //guardCommandBufferWithPipeControl
+        false,                                               //GSBA32BitRequired
+        false,                                               //requiresCoherency
+        false,                                               //lowPriority
+        true,                                                //implicitFlush
+        this->csr->isNTo1SubmissionModelEnabled(),           //outOfOrderExecutionAllowed
+        false,                                               //epilogueRequired
+        false,                                               //usePerDssBackedBuffer
+        false,                                               //useSingleSubdevice
+        false,                                               //useGlobalAtomics
+        1u                                                   //numDevicesInContext
+    );
+
+    auto completionStamp = this->csr->flushTask(*commandStream,
+                                                this->cmdListCurrentStartOffset,
+                                                *this->commandContainer.getIndirectHeap(NEO::HeapType::DYNAMIC_STATE),
+                                                *this->commandContainer.getIndirectHeap(NEO::HeapType::INDIRECT_OBJECT),
+                                                *this->commandContainer.getIndirectHeap(NEO::HeapType::SURFACE_STATE),
+                                                this->csr->peekTaskLevel(),
+                                                dispatchFlags,
+                                                *neoDevice);
+    lockCSR.unlock();
+
+    if (completionStamp.taskCount == NEO::CompletionStamp::failed) {
+        // drop the rejected commands so they are not submitted with the next append
+        this->cmdListCurrentStartOffset = commandStream->getUsed();
+        residencyContainer.clear();
+        return ZE_RESULT_ERROR_UNKNOWN;
+    }
+
+    this->cmdBufferTaskCount = completionStamp.taskCount;
+    this->cmdListCurrentStartOffset = commandStream->getUsed();
+    residencyContainer.clear();
+
+    if (this->isSyncModeQueue || !this->printfFunctionContainer.empty()) {
+        this->csr->waitForCompletionWithTimeout(false, 0, completionStamp.taskCount);
+        for (auto kernel : this->printfFunctionContainer) {
+            kernel->printPrintfOutput();
+        }
+        this->printfFunctionContainer.clear();
+    }
+
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::executeSpilledCommandListImmediate(bool performMigration) {
+    // the append continued in another command buffer, which flushTask cannot chain to,
+    // so the list is executed through the command queue with the already flushed commands replaced by MI_NOOPs
+    if (this->cmdListCurrentStartOffset > 0u) {
+        this->csr->waitForCompletionWithTimeout(false, 0, this->cmdBufferTaskCount);
+        memset(this->commandContainer.getCmdBufferAllocations()[0]->getUnderlyingBuffer(), 0, this->cmdListCurrentStartOffset);
+    }
+    auto ret = BaseClass::executeCommandListImmediate(performMigration);
+    this->cmdListCurrentStartOffset = 0u;
+    return ret;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamilyImmediate<gfxCoreFamily>::checkAvailableSpace() {
+    if (!this->isFlushTaskSubmissionEnabled) {
+        return;
+    }
+    if (this->commandContainer.getCommandStream()->getAvailableSpace() < minCommandStreamSpaceForAppend) {
+        // commands flushed earlier may still be executing from this buffer, recycle it only when they are done
+        this->csr->waitForCompletionWithTimeout(false, 0, this->cmdBufferTaskCount);
+        this->reset();
+        this->cmdListCurrentStartOffset = 0u;
+    }
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernel(
     ze_kernel_handle_t hKernel, const ze_group_count_t *pThreadGroupDimensions,
     ze_event_handle_t hEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    // the launch covers the immediate submission as well
+    auto kernel = Kernel::fromHandle(hKernel);
+    NEO::ScopedKernelLaunch kernelLaunch(kernel ? kernel->getKernelDescriptor().kernelMetadata.kernelName.c_str() : nullptr);
 
+    checkAvailableSpace();
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernel(hKernel, pThreadGroupDimensions,
                                                                         hEvent, numWaitEvents, phWaitEvents);
     if (ret == ZE_RESULT_SUCCESS) {
-        executeCommandListImmediate(true);
+        ret = executeCommandListImmediate(true);
     }
     return ret;
 }
@@ -27,10 +198,11 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernelInd
     ze_kernel_handle_t hKernel, const ze_group_count_t *pDispatchArgumentsBuffer,
     ze_event_handle_t hEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
 
+    checkAvailableSpace();
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelIndirect(hKernel, pDispatchArgumentsBuffer,
                                                                                 hEvent, numWaitEvents, phWaitEvents);
     if (ret == ZE_RESULT_SUCCESS) {
-        executeCommandListImmediate(true);
+        ret = executeCommandListImmediate(true);
     }
     return ret;
 }
@@ -41,9 +213,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendBarrier(
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
 
+    checkAvailableSpace();
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendBarrier(hSignalEvent, numWaitEvents, phWaitEvents);
     if (ret == ZE_RESULT_SUCCESS) {
-        executeCommandListImmediate(true);
+        ret = executeCommandListImmediate(true);
     }
     return ret;
 }
@@ -57,10 +230,11 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopy(
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
 
+    checkAvailableSpace();
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendMemoryCopy(dstptr, srcptr, size, hSignalEvent,
                                                                       numWaitEvents, phWaitEvents);
     if (ret == ZE_RESULT_SUCCESS) {
-        executeCommandListImmediate(true);
+        ret = executeCommandListImmediate(true);
     }
     return ret;
 }
@@ -78,11 +252,12 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopyRegio
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
 
+    checkAvailableSpace();
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendMemoryCopyRegion(dstPtr, dstRegion, dstPitch, dstSlicePitch,
                                                                             srcPtr, srcRegion, srcPitch, srcSlicePitch,
                                                                             hSignalEvent, numWaitEvents, phWaitEvents);
     if (ret == ZE_RESULT_SUCCESS) {
-        executeCommandListImmediate(true);
+        ret = executeCommandListImmediate(true);
     }
     return ret;
 }
@@ -93,44 +268,49 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryFill(void
                                                                             ze_event_handle_t hSignalEvent,
                                                                             uint32_t numWaitEvents,
                                                                             ze_event_handle_t *phWaitEvents) {
+    checkAvailableSpace();
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendMemoryFill(ptr, pattern, patternSize, size, hSignalEvent, numWaitEvents, phWaitEvents);
     if (ret == ZE_RESULT_SUCCESS) {
-        executeCommandListImmediate(true);
+        ret = executeCommandListImmediate(true);
     }
     return ret;
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendSignalEvent(ze_event_handle_t hEvent) {
+    checkAvailableSpace();
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendSignalEvent(hEvent);
     if (ret == ZE_RESULT_SUCCESS) {
-        executeCommandListImmediate(true);
+        ret = executeCommandListImmediate(true);
     }
     return ret;
 }
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendEventReset(ze_event_handle_t hEvent) {
+    checkAvailableSpace();
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendEventReset(hEvent);
     if (ret == ZE_RESULT_SUCCESS) {
-        executeCommandListImmediate(true);
+        ret = executeCommandListImmediate(true);
     }
     return ret;
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
-ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendPageFaultCopy(NEO::GraphicsAllocation *dstptr, NEO::GraphicsAllocation *srcptr, size_t size, bool flushHost) {
-    auto ret = CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(dstptr, srcptr, size, flushHost);
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendPageFaultCopy(NEO::GraphicsAllocation *dstptr, NEO::GraphicsAllocation *srcptr, size_t offset, size_t size, bool flushHost) {
+    checkAvailableSpace();
+    auto ret = CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(dstptr, srcptr, offset, size, flushHost);
     if (ret == ZE_RESULT_SUCCESS) {
-        executeCommandListImmediate(false);
+        ret = executeCommandListImmediate(false);
     }
     return ret;
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWaitOnEvents(uint32_t numEvents, ze_event_handle_t *phEvent) {
+    checkAvailableSpace();
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendWaitOnEvents(numEvents, phEvent);
     if (ret == ZE_RESULT_SUCCESS) {
-        executeCommandListImmediate(true);
+        ret = executeCommandListImmediate(true);
     }
     return ret;
 }
@@ -139,9 +319,10 @@ template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWriteGlobalTimestamp(
     uint64_t *dstptr, ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    checkAvailableSpace();
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendWriteGlobalTimestamp(dstptr, hSignalEvent, numWaitEvents, phWaitEvents);
     if (ret == ZE_RESULT_SUCCESS) {
-        executeCommandListImmediate(true);
+        ret = executeCommandListImmediate(true);
     }
     return ret;
 }
@@ -163,10 +344,11 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyFromMe
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
 
+    checkAvailableSpace();
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendImageCopyFromMemory(hDstImage, srcPtr, pDstRegion, hEvent,
                                                                                numWaitEvents, phWaitEvents);
     if (ret == ZE_RESULT_SUCCESS) {
-        executeCommandListImmediate(true);
+        ret = executeCommandListImmediate(true);
     }
     return ret;
 }
@@ -180,10 +362,11 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyToMemo
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
 
+    checkAvailableSpace();
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendImageCopyToMemory(dstPtr, hSrcImage, pSrcRegion, hEvent,
                                                                              numWaitEvents, phWaitEvents);
     if (ret == ZE_RESULT_SUCCESS) {
-        executeCommandListImmediate(true);
+        ret = executeCommandListImmediate(true);
     }
     return ret;
 }
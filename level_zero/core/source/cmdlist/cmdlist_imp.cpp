@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,7 +9,10 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/command_stream/linear_stream.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/debugger/debugger.h"
 #include "shared/source/device/device.h"
+#include "shared/source/helpers/api_specific_config.h"
 #include "shared/source/helpers/engine_node_helper.h"
 #include "shared/source/indirect_heap/indirect_heap.h"
 
@@ -94,7 +97,11 @@ CommandList *CommandList::createImmediate(uint32_t productFamily, Device *device
 
         NEO::CommandStreamReceiver *csr = nullptr;
         auto deviceImp = static_cast<DeviceImp *>(device);
-        if (internalUsage) {
+        if (internalUsage && NEO::EngineGroupType::Copy == engineGroupType) {
+            auto internalCopyEngine = deviceImp->neoDevice->getInternalCopyEngine();
+            UNRECOVERABLE_IF(nullptr == internalCopyEngine);
+            csr = internalCopyEngine->commandStreamReceiver;
+        } else if (internalUsage) {
             csr = deviceImp->neoDevice->getInternalEngine().commandStreamReceiver;
         } else {
             device->getCsrForOrdinalAndIndex(&csr, desc->ordinal, desc->index);
@@ -110,7 +117,10 @@ CommandList *CommandList::createImmediate(uint32_t productFamily, Device *device
         }
 
         commandList->cmdQImmediate = commandQueue;
+        commandList->csr = csr;
         commandList->cmdListType = CommandListType::TYPE_IMMEDIATE;
+        commandList->isSyncModeQueue = (desc->mode == ZE_COMMAND_QUEUE_MODE_SYNCHRONOUS);
+        commandList->isFlushTaskSubmissionEnabled = isFlushTaskSubmissionPreferred(*csr, engineGroupType, internalUsage);
         commandList->commandListPreemptionMode = device->getDevicePreemptionMode();
         return commandList;
     }
@@ -118,4 +128,16 @@ CommandList *CommandList::createImmediate(uint32_t productFamily, Device *device
     return commandList;
 }
 
+bool CommandList::isFlushTaskSubmissionPreferred(const NEO::CommandStreamReceiver &csr, NEO::EngineGroupType engineGroupType, bool internalUsage) {
+    if (NEO::EngineGroupType::Copy == engineGroupType ||
+        NEO::ApiSpecificConfig::getBindlessConfiguration() ||
+        NEO::Debugger::isDebugEnabled(internalUsage)) {
+        return false;
+    }
+    if (NEO::DebugManager.flags.EnableFlushTaskSubmission.get() != -1) {
+        return !!NEO::DebugManager.flags.EnableFlushTaskSubmission.get();
+    }
+    return csr.isDirectSubmissionEnabled();
+}
+
 } // namespace L0
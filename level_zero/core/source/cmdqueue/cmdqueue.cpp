@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -19,6 +19,8 @@
 #include "hw_helpers.h"
 #include "igfxfmid.h"
 
+#include <algorithm>
+
 namespace L0 {
 
 CommandQueueAllocatorFn commandQueueFactory[IGFX_MAX_PRODUCT] = {};
@@ -43,6 +45,36 @@ ze_result_t CommandQueueImp::initialize(bool copyOnly, bool isInternal) {
     return returnValue;
 }
 
+void CommandQueueImp::mergeSortedResidencyContainers(const std::vector<const NEO::ResidencyContainer *> &sortedContainers, NEO::ResidencyContainer &output) {
+    using Cursor = std::pair<NEO::ResidencyContainer::const_iterator, NEO::ResidencyContainer::const_iterator>;
+    auto laterAllocationFirst = [](const Cursor &lhs, const Cursor &rhs) { return *lhs.first > *rhs.first; };
+
+    std::vector<Cursor> cursors;
+    cursors.reserve(sortedContainers.size());
+    for (auto container : sortedContainers) {
+        if (!container->empty()) {
+            cursors.emplace_back(container->begin(), container->end());
+        }
+    }
+    std::make_heap(cursors.begin(), cursors.end(), laterAllocationFirst);
+
+    NEO::GraphicsAllocation *lastMerged = nullptr;
+    while (!cursors.empty()) {
+        std::pop_heap(cursors.begin(), cursors.end(), laterAllocationFirst);
+        auto &cursor = cursors.back();
+        auto allocation = *cursor.first;
+        if (allocation != lastMerged) {
+            output.push_back(allocation);
+            lastMerged = allocation;
+        }
+        if (++cursor.first == cursor.second) {
+            cursors.pop_back();
+        } else {
+            std::push_heap(cursors.begin(), cursors.end(), laterAllocationFirst);
+        }
+    }
+}
+
 void CommandQueueImp::reserveLinearStreamSize(size_t size) {
     UNRECOVERABLE_IF(commandStream == nullptr);
     if (commandStream->getAvailableSpace() < size) {
@@ -58,17 +90,50 @@ void CommandQueueImp::submitBatchBuffer(size_t offset, NEO::ResidencyContainer &
     UNRECOVERABLE_IF(csr == nullptr);
 
     NEO::BatchBuffer batchBuffer(commandStream->getGraphicsAllocation(), offset, 0u, nullptr, false, false,
-                                 NEO::QueueThrottle::HIGH, NEO::QueueSliceCount::defaultSliceCount,
+                                 NEO::QueueThrottle::HIGH, sliceCount,
                                  commandStream->getUsed(), commandStream, endingCmdPtr, false);
 
     csr->submitBatchBuffer(batchBuffer, residencyContainer);
     buffers.setCurrentFlushStamp(csr->obtainCurrentFlushStamp());
 }
 
+void CommandQueueImp::submitBatchBufferCoalesced(size_t offset, NEO::ResidencyContainer &residencyContainer, void *endingCmdPtr,
+                                                 std::unique_lock<std::recursive_mutex> &csrLock) {
+    UNRECOVERABLE_IF(csr == nullptr);
+
+    NEO::BatchBuffer batchBuffer(commandStream->getGraphicsAllocation(), offset, 0u, nullptr, false, false,
+                                 NEO::QueueThrottle::HIGH, sliceCount,
+                                 commandStream->getUsed(), commandStream, endingCmdPtr, false);
+
+    auto flushRequired = csr->recordBatchBufferForCoalescing(batchBuffer, residencyContainer, *device->getNEODevice());
+    this->taskCount = csr->peekTaskCount();
+    csr->unregisterCoalescingSubmitter();
+
+    // release CSR so submissions from other queues can be chained before flush
+    csrLock.unlock();
+    csr->waitForCoalescedSubmission(this->taskCount, flushRequired,
+                                    std::chrono::microseconds(NEO::DebugManager.flags.SubmissionCoalescingWindowUs.get()));
+    csrLock.lock();
+
+    buffers.setCurrentFlushStamp(csr->obtainCurrentFlushStamp());
+}
+
 ze_result_t CommandQueueImp::synchronize(uint64_t timeout) {
     return synchronizeByPollingForTaskCount(timeout);
 }
 
+NEO::SubmissionStatistics CommandQueueImp::getSubmissionStatistics() {
+    return csr->getSubmissionStatistics();
+}
+
+ze_result_t CommandQueueImp::setSliceCount(uint32_t sliceCount) {
+    if (sliceCount > device->getHwInfo().gtSystemInfo.SliceCount) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    this->sliceCount = sliceCount;
+    return ZE_RESULT_SUCCESS;
+}
+
 ze_result_t CommandQueueImp::synchronizeByPollingForTaskCount(uint64_t timeout) {
     UNRECOVERABLE_IF(csr == nullptr);
 
@@ -80,11 +145,13 @@ ze_result_t CommandQueueImp::synchronizeByPollingForTaskCount(uint64_t timeout)
         timeoutMicroseconds = NEO::TimeoutControls::maxTimeout;
     }
 
+    auto waitStart = std::chrono::steady_clock::now();
     csr->waitForCompletionWithTimeout(enableTimeout, timeoutMicroseconds, this->taskCount);
 
     if (*csr->getTagAddress() < taskCountToWait) {
         return ZE_RESULT_NOT_READY;
     }
+    csr->getSubmissionCounters().recordWaitTime(waitStart);
 
     printFunctionsPrintfOutput();
 
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "shared/source/command_stream/csr_definitions.h"
+
 #include "level_zero/core/source/device/device.h"
 #include <level_zero/ze_api.h>
 
@@ -39,6 +41,8 @@ struct CommandQueue : _ze_command_queue_handle_t {
                                         void *phCommands,
                                         ze_fence_handle_t hFence) = 0;
     virtual ze_result_t synchronize(uint64_t timeout) = 0;
+    virtual NEO::SubmissionStatistics getSubmissionStatistics() = 0;
+    virtual ze_result_t setSliceCount(uint32_t sliceCount) = 0;
 
     static CommandQueue *create(uint32_t productFamily, Device *device, NEO::CommandStreamReceiver *csr,
                                 const ze_command_queue_desc_t *desc, bool isCopyOnly, bool isInternal, ze_result_t &resultValue);
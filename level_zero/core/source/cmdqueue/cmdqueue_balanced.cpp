@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/core/source/cmdqueue/cmdqueue_balanced.h"
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+
+#include "level_zero/core/source/cmdlist/cmdlist.h"
+
+#include <algorithm>
+
+namespace L0 {
+
+CommandQueue *BalancedCommandQueue::create(uint32_t productFamily, Device *device, const std::vector<NEO::CommandStreamReceiver *> &csrs,
+                                           const ze_command_queue_desc_t *desc, ze_result_t &returnValue) {
+    auto commandQueue = new BalancedCommandQueue();
+    returnValue = ZE_RESULT_SUCCESS;
+
+    for (auto csr : csrs) {
+        auto engineQueue = CommandQueue::create(productFamily, device, csr, desc, false, false, returnValue);
+        if (returnValue != ZE_RESULT_SUCCESS) {
+            commandQueue->destroy();
+            return nullptr;
+        }
+        commandQueue->engineQueues.push_back(static_cast<CommandQueueImp *>(engineQueue));
+    }
+
+    return commandQueue;
+}
+
+ze_result_t BalancedCommandQueue::createFence(const ze_fence_desc_t *desc, ze_fence_handle_t *phFence) {
+    // fences only poll their own allocation, so any engine queue can own them
+    return engineQueues[0]->createFence(desc, phFence);
+}
+
+ze_result_t BalancedCommandQueue::destroy() {
+    for (auto engineQueue : engineQueues) {
+        engineQueue->destroy();
+    }
+    delete this;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t BalancedCommandQueue::executeCommandLists(uint32_t numCommandLists,
+                                                      ze_command_list_handle_t *phCommandLists,
+                                                      ze_fence_handle_t hFence, bool performMigration) {
+    std::lock_guard<std::mutex> lock(selectionMutex);
+
+    auto engineIndex = selectEngineQueue();
+    auto engineQueue = engineQueues[engineIndex];
+    auto csr = engineQueue->getCsr();
+
+    auto &dependencies = engineQueue->crossEngineDependencies;
+    dependencies.clear();
+    for (auto i = 0u; i < numCommandLists; i++) {
+        auto commandList = CommandList::fromHandle(phCommandLists[i]);
+        if (commandList->lastSubmissionCsr != nullptr && commandList->lastSubmissionCsr != csr &&
+            isTaskPending(commandList->lastSubmissionCsr, commandList->lastSubmissionTaskCount)) {
+            addDependency(dependencies, commandList->lastSubmissionCsr, commandList->lastSubmissionTaskCount);
+        }
+    }
+
+    // the queue is in order, so work moving to another engine waits for the last submission on the previous one;
+    // this also makes a signaled fence imply completion of everything submitted before it
+    auto previousQueue = engineQueues[lastEngineQueue];
+    if (previousQueue != engineQueue && isTaskPending(previousQueue->getCsr(), previousQueue->getTaskCount())) {
+        addDependency(dependencies, previousQueue->getCsr(), previousQueue->getTaskCount());
+    }
+
+    lastEngineQueue = engineIndex;
+    return engineQueue->executeCommandLists(numCommandLists, phCommandLists, hFence, performMigration);
+}
+
+ze_result_t BalancedCommandQueue::executeCommands(uint32_t numCommands,
+                                                  void *phCommands,
+                                                  ze_fence_handle_t hFence) {
+    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ze_result_t BalancedCommandQueue::synchronize(uint64_t timeout) {
+    for (auto engineQueue : engineQueues) {
+        auto ret = engineQueue->synchronize(timeout);
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+NEO::SubmissionStatistics BalancedCommandQueue::getSubmissionStatistics() {
+    NEO::SubmissionStatistics statistics;
+    for (auto engineQueue : engineQueues) {
+        auto engineStatistics = engineQueue->getSubmissionStatistics();
+        statistics.flushes += engineStatistics.flushes;
+        statistics.ringBufferSwitches += engineStatistics.ringBufferSwitches;
+        statistics.stallingPipeControls += engineStatistics.stallingPipeControls;
+        statistics.stateBaseAddressReprogrammings += engineStatistics.stateBaseAddressReprogrammings;
+        statistics.cacheFlushes += engineStatistics.cacheFlushes;
+        statistics.kmdNotifySleeps += engineStatistics.kmdNotifySleeps;
+        for (uint32_t i = 0; i < NEO::waitTimeHistogramBuckets; i++) {
+            statistics.waitTimeHistogram[i] += engineStatistics.waitTimeHistogram[i];
+        }
+    }
+    return statistics;
+}
+
+ze_result_t BalancedCommandQueue::setSliceCount(uint32_t sliceCount) {
+    for (auto engineQueue : engineQueues) {
+        auto ret = engineQueue->setSliceCount(sliceCount);
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+uint32_t BalancedCommandQueue::getOutstandingTaskCount(CommandQueueImp *engineQueue) {
+    auto csr = engineQueue->getCsr();
+    auto completedTaskCount = *csr->getTagAddress();
+    auto submittedTaskCount = csr->peekTaskCount();
+    return submittedTaskCount > completedTaskCount ? submittedTaskCount - completedTaskCount : 0u;
+}
+
+bool BalancedCommandQueue::isTaskPending(NEO::CommandStreamReceiver *csr, uint32_t taskCount) {
+    return *csr->getTagAddress() < taskCount;
+}
+
+size_t BalancedCommandQueue::selectEngineQueue() {
+    // ties keep the previous engine, so idle or serial workloads do not hop between engines
+    auto selected = lastEngineQueue;
+    auto selectedLoad = getOutstandingTaskCount(engineQueues[selected]);
+    for (size_t i = 0; i < engineQueues.size() && selectedLoad > 0; i++) {
+        auto load = getOutstandingTaskCount(engineQueues[i]);
+        if (load < selectedLoad) {
+            selected = i;
+            selectedLoad = load;
+        }
+    }
+    return selected;
+}
+
+void BalancedCommandQueue::addDependency(std::vector<CommandQueueImp::CrossEngineDependency> &dependencies,
+                                         NEO::CommandStreamReceiver *csr, uint32_t taskCount) {
+    for (auto &dependency : dependencies) {
+        if (dependency.csr == csr) {
+            dependency.taskCount = std::max(dependency.taskCount, taskCount);
+            return;
+        }
+    }
+    dependencies.push_back({csr, taskCount});
+}
+
+} // namespace L0
@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "level_zero/core/source/cmdqueue/cmdqueue_imp.h"
+
+#include <mutex>
+#include <vector>
+
+namespace L0 {
+
+// Spreads executeCommandLists calls over the engines of one engine group.
+// Each call goes to the engine with the fewest outstanding tasks. A call moved
+// to another engine waits with a semaphore for the previous engine's last task,
+// and lists still running on another engine are waited for the same way, so
+// submissions stay in order and fences cover every engine used by the queue.
+struct BalancedCommandQueue : public CommandQueue {
+    static CommandQueue *create(uint32_t productFamily, Device *device, const std::vector<NEO::CommandStreamReceiver *> &csrs,
+                                const ze_command_queue_desc_t *desc, ze_result_t &returnValue);
+
+    ze_result_t createFence(const ze_fence_desc_t *desc, ze_fence_handle_t *phFence) override;
+    ze_result_t destroy() override;
+    ze_result_t executeCommandLists(uint32_t numCommandLists,
+                                    ze_command_list_handle_t *phCommandLists,
+                                    ze_fence_handle_t hFence, bool performMigration) override;
+    ze_result_t executeCommands(uint32_t numCommands,
+                                void *phCommands,
+                                ze_fence_handle_t hFence) override;
+    ze_result_t synchronize(uint64_t timeout) override;
+    NEO::SubmissionStatistics getSubmissionStatistics() override;
+    ze_result_t setSliceCount(uint32_t sliceCount) override;
+
+  protected:
+    static uint32_t getOutstandingTaskCount(CommandQueueImp *engineQueue);
+    static bool isTaskPending(NEO::CommandStreamReceiver *csr, uint32_t taskCount);
+    size_t selectEngineQueue();
+    static void addDependency(std::vector<CommandQueueImp::CrossEngineDependency> &dependencies,
+                              NEO::CommandStreamReceiver *csr, uint32_t taskCount);
+
+    std::vector<CommandQueueImp *> engineQueues;
+    size_t lastEngineQueue = 0u;
+    std::mutex selectionMutex;
+};
+
+} // namespace L0
@@ -23,6 +23,7 @@
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 #include "shared/source/unified_memory/unified_memory.h"
+#include "shared/source/utilities/launch_overhead_profiler.h"
 #include "shared/source/utilities/software_tags_manager.h"
 
 #include "level_zero/core/source/cmdlist/cmdlist.h"
@@ -64,6 +65,8 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
     ze_command_list_handle_t *phCommandLists,
     ze_fence_handle_t hFence,
     bool performMigration) {
+    // kernels are launched into the lists earlier, their flush time is attributed here
+    NEO::ScopedLaunchSubmission launchSubmission;
 
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
     using MI_BATCH_BUFFER_START = typename GfxFamily::MI_BATCH_BUFFER_START;
@@ -71,12 +74,22 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
 
     using PIPE_CONTROL = typename GfxFamily::PIPE_CONTROL;
     using POST_SYNC_OPERATION = typename PIPE_CONTROL::POST_SYNC_OPERATION;
+    using MI_SEMAPHORE_WAIT = typename GfxFamily::MI_SEMAPHORE_WAIT;
+
+    // announced before blocking on the CSR, so a coalescing leader can wait for this submission
+    bool coalescingAnnounced = NEO::DebugManager.flags.SubmissionCoalescingWindowUs.get() > 0;
+    if (coalescingAnnounced) {
+        csr->registerCoalescingSubmitter();
+    }
 
     auto lockCSR = csr->obtainUniqueOwnership();
 
     for (auto i = 0u; i < numCommandLists; i++) {
         auto commandList = CommandList::fromHandle(phCommandLists[i]);
         if (peekIsCopyOnlyCommandQueue() != commandList->isCopyOnly()) {
+            if (coalescingAnnounced) {
+                csr->unregisterCoalescingSubmitter();
+            }
             return ZE_RESULT_ERROR_INVALID_COMMAND_LIST_TYPE;
         }
     }
@@ -118,7 +131,11 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
         spaceForResidency += residencyContainerSpaceForPreemption;
     }
 
-    bool directSubmissionEnabled = csr->isDirectSubmissionEnabled();
+    bool directSubmissionEnabled = isCopyOnlyCommandQueue ? csr->isBlitterDirectSubmissionEnabled() : csr->isDirectSubmissionEnabled();
+    bool coalesceSubmission = coalescingAnnounced && !directSubmissionEnabled;
+    if (coalescingAnnounced && !coalesceSubmission) {
+        csr->unregisterCoalescingSubmitter();
+    }
 
     L0::Fence *fence = nullptr;
 
@@ -128,6 +145,7 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
     uint32_t perThreadScratchSpaceSize = 0;
     for (auto i = 0u; i < numCommandLists; i++) {
         auto commandList = CommandList::fromHandle(phCommandLists[i]);
+        launchSubmission.addKernels(commandList->getLaunchedKernelNames());
 
         bool indirectAllocationsAllowed = commandList->hasIndirectAllocationsAllowed();
         if (indirectAllocationsAllowed) {
@@ -164,8 +182,10 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
 
     size_t linearStreamSizeEstimate = totalCmdBuffers * sizeof(MI_BATCH_BUFFER_START);
     linearStreamSizeEstimate += csr->getCmdsSizeForHardwareContext();
+    linearStreamSizeEstimate += crossEngineDependencies.size() * NEO::EncodeSempahore<GfxFamily>::getSizeMiSemaphoreWait();
+    spaceForResidency += crossEngineDependencies.size();
 
-    if (directSubmissionEnabled) {
+    if (directSubmissionEnabled || coalesceSubmission) {
         linearStreamSizeEstimate += sizeof(MI_BATCH_BUFFER_START);
     } else {
         linearStreamSizeEstimate += sizeof(MI_BATCH_BUFFER_END);
@@ -182,6 +202,12 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
     residencyContainer.reserve(spaceForResidency);
 
     auto scratchSpaceController = csr->getScratchSpaceController();
+    if (perThreadScratchSpaceSize > 0 && NEO::DebugManager.flags.SizeScratchForBuiltKernels.get() != 0) {
+        // scratch is shared by all queues of the engine, sizing it for every loaded kernel avoids later front end reprogramming
+        perThreadScratchSpaceSize = std::max(perThreadScratchSpaceSize, neoDevice->getMaxKernelPerThreadScratchSize());
+        scratchSpaceController->shrinkScratchSpace(perThreadScratchSpaceSize, csr->peekTaskCount(), csr->getOsContext());
+    }
+
     bool gsbaStateDirty = false;
     bool frontEndStateDirty = false;
     handleScratchSpace(residencyContainer,
@@ -210,7 +236,7 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
     }
 
     if (NEO::DebugManager.flags.EnableSWTags.get()) {
-        linearStreamSizeEstimate += NEO::SWTagsManager::estimateSpaceForSWTags<GfxFamily>();
+        linearStreamSizeEstimate += NEO::SWTagsManager::estimateSpaceForSWTags<GfxFamily>(numCommandLists);
     }
 
     linearStreamSizeEstimate += isCopyOnlyCommandQueue ? NEO::EncodeMiFlushDW<GfxFamily>::getMiFlushDwCmdSizeForDataWrite() : NEO::MemorySynchronizationCommands<GfxFamily>::getSizeForPipeControlWithPostSyncOperation(device->getHwInfo());
@@ -239,6 +265,16 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
 
     csr->programHardwareContext(child);
 
+    for (auto &dependency : crossEngineDependencies) {
+        auto tagAllocation = dependency.csr->getTagAllocation();
+        residencyContainer.push_back(tagAllocation);
+        NEO::EncodeSempahore<GfxFamily>::addMiSemaphoreWaitCommand(child,
+                                                                  tagAllocation->getGpuAddress(),
+                                                                  dependency.taskCount,
+                                                                  MI_SEMAPHORE_WAIT::COMPARE_OPERATION::COMPARE_OPERATION_SAD_GREATER_THAN_OR_EQUAL_SDD);
+    }
+    crossEngineDependencies.clear();
+
     if (NEO::Debugger::isDebugEnabled(internalUsage) && device->getL0Debugger()) {
         residencyContainer.push_back(device->getL0Debugger()->getSbaTrackingBuffer(csr->getOsContext().getContextId()));
     }
@@ -333,18 +369,25 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
                                        commandList->getPrintfFunctionContainer().begin(),
                                        commandList->getPrintfFunctionContainer().end());
 
-        for (auto alloc : commandList->commandContainer.getResidencyContainer()) {
-            if (residencyContainer.end() ==
-                std::find(residencyContainer.begin(), residencyContainer.end(), alloc)) {
-                residencyContainer.push_back(alloc);
-
-                if (performMigration) {
-                    if (alloc &&
-                        (alloc->getAllocationType() == NEO::GraphicsAllocation::AllocationType::SVM_GPU ||
-                         alloc->getAllocationType() == NEO::GraphicsAllocation::AllocationType::SVM_CPU)) {
-                        pageFaultManager->moveAllocationToGpuDomain(reinterpret_cast<void *>(alloc->getGpuAddress()));
-                    }
-                }
+        auto &commandListResidency = commandList->commandContainer.getResidencyContainer();
+        if (!std::is_sorted(commandListResidency.begin(), commandListResidency.end())) {
+            // closed lists are already sorted, only lists modified after close need it
+            commandList->commandContainer.removeDuplicatesFromResidencyContainer();
+        }
+        commandListResidencyContainers.push_back(&commandListResidency);
+    }
+
+    auto commandListResidencyStart = residencyContainer.size();
+    mergeSortedResidencyContainers(commandListResidencyContainers, residencyContainer);
+    commandListResidencyContainers.clear();
+
+    if (performMigration) {
+        for (auto i = commandListResidencyStart; i < residencyContainer.size(); i++) {
+            auto alloc = residencyContainer[i];
+            if (alloc &&
+                (alloc->getAllocationType() == NEO::GraphicsAllocation::AllocationType::SVM_GPU ||
+                 alloc->getAllocationType() == NEO::GraphicsAllocation::AllocationType::SVM_CPU)) {
+                pageFaultManager->moveAllocationToGpuDomain(reinterpret_cast<void *>(alloc->getGpuAddress()));
             }
         }
     }
@@ -385,6 +428,11 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
     if (directSubmissionEnabled) {
         endingCmd = child.getSpace(0);
         NEO::EncodeBatchBufferStartOrEnd<GfxFamily>::programBatchBufferStart(&child, 0ull, false);
+    } else if (coalesceSubmission) {
+        // reserve space for MI_BATCH_BUFFER_START chaining next coalesced submission
+        endingCmd = child.getSpace(sizeof(MI_BATCH_BUFFER_START));
+        memset(endingCmd, 0, sizeof(MI_BATCH_BUFFER_START));
+        *reinterpret_cast<MI_BATCH_BUFFER_END *>(endingCmd) = GfxFamily::cmdInitBatchBufferEnd;
     } else {
         MI_BATCH_BUFFER_END cmd = GfxFamily::cmdInitBatchBufferEnd;
         auto buffer = child.getSpaceForCmd<MI_BATCH_BUFFER_END>();
@@ -396,9 +444,19 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
         memset(paddingPtr, 0, padding);
     }
 
-    submitBatchBuffer(ptrDiff(child.getCpuBase(), commandStream->getCpuBase()), residencyContainer, endingCmd);
+    if (coalesceSubmission) {
+        submitBatchBufferCoalesced(ptrDiff(child.getCpuBase(), commandStream->getCpuBase()), residencyContainer, endingCmd, lockCSR);
+    } else {
+        submitBatchBuffer(ptrDiff(child.getCpuBase(), commandStream->getCpuBase()), residencyContainer, endingCmd);
+
+        this->taskCount = csr->peekTaskCount();
+    }
 
-    this->taskCount = csr->peekTaskCount();
+    for (auto i = 0u; i < numCommandLists; i++) {
+        auto commandList = CommandList::fromHandle(phCommandLists[i]);
+        commandList->lastSubmissionCsr = csr;
+        commandList->lastSubmissionTaskCount = this->taskCount;
+    }
 
     csr->makeSurfacePackNonResident(residencyContainer);
 
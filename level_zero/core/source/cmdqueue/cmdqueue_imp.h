@@ -14,6 +14,7 @@
 
 #include "level_zero/core/source/cmdqueue/cmdqueue.h"
 
+#include <mutex>
 #include <vector>
 
 namespace NEO {
@@ -68,6 +69,10 @@ struct CommandQueueImp : public CommandQueue {
 
     ze_result_t synchronize(uint64_t timeout) override;
 
+    NEO::SubmissionStatistics getSubmissionStatistics() override;
+
+    ze_result_t setSliceCount(uint32_t sliceCount) override;
+
     ze_result_t initialize(bool copyOnly, bool isInternal);
 
     Device *getDevice() { return device; }
@@ -80,23 +85,36 @@ struct CommandQueueImp : public CommandQueue {
     ze_command_queue_mode_t getSynchronousMode();
     virtual void dispatchTaskCountWrite(NEO::LinearStream &commandStream, bool flushDataCache) = 0;
 
+    struct CrossEngineDependency {
+        NEO::CommandStreamReceiver *csr;
+        uint32_t taskCount;
+    };
+    // waited for with semaphores at the start of the next executeCommandLists
+    std::vector<CrossEngineDependency> crossEngineDependencies;
+
   protected:
     MOCKABLE_VIRTUAL void submitBatchBuffer(size_t offset, NEO::ResidencyContainer &residencyContainer, void *endingCmdPtr);
+    void submitBatchBufferCoalesced(size_t offset, NEO::ResidencyContainer &residencyContainer, void *endingCmdPtr,
+                                    std::unique_lock<std::recursive_mutex> &csrLock);
 
     ze_result_t synchronizeByPollingForTaskCount(uint64_t timeout);
 
     void printFunctionsPrintfOutput();
 
+    static void mergeSortedResidencyContainers(const std::vector<const NEO::ResidencyContainer *> &sortedContainers, NEO::ResidencyContainer &output);
+
     Device *device = nullptr;
     NEO::CommandStreamReceiver *csr = nullptr;
     const ze_command_queue_desc_t desc;
     NEO::LinearStream *commandStream = nullptr;
     std::atomic<uint32_t> taskCount{0};
+    uint64_t sliceCount = NEO::QueueSliceCount::defaultSliceCount;
     std::vector<Kernel *> printfFunctionContainer;
     bool gpgpuEnabled = false;
     CommandBufferManager buffers;
     NEO::ResidencyContainer residencyContainer;
     NEO::HeapContainer heapContainer;
+    std::vector<const NEO::ResidencyContainer *> commandListResidencyContainers;
 };
 
 } // namespace L0
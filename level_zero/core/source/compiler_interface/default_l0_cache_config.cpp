@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,10 @@ NEO::CompilerCacheConfig getDefaultL0CompilerCacheConfig() {
     std::unique_ptr<NEO::SettingsReader> settingsReader(NEO::SettingsReader::createOsReader(false, keyName));
     ret.cacheDir = settingsReader->getSetting(settingsReader->appSpecificLocation(keyName), static_cast<std::string>(L0_CACHE_LOCATION));
 
+    std::string maxSizeKeyName = registryPath;
+    maxSizeKeyName += "l0_c_cache_max_size";
+    ret.cacheSize = static_cast<uint64_t>(settingsReader->getSetting(settingsReader->appSpecificLocation(maxSizeKeyName), static_cast<int64_t>(0)));
+
     ret.cacheFileExtension = ".l0_c_cache";
 
     return ret;
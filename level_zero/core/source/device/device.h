@@ -130,6 +130,7 @@ struct Device : _ze_device_handle_t {
     virtual SysmanDevice *getSysmanHandle() = 0;
     virtual ze_result_t getCsrForOrdinalAndIndex(NEO::CommandStreamReceiver **csr, uint32_t ordinal, uint32_t index) = 0;
     virtual ze_result_t getCsrForLowPriority(NEO::CommandStreamReceiver **csr) = 0;
+    virtual ze_result_t getCsrForHighPriority(NEO::CommandStreamReceiver **csr, NEO::EngineGroupType engineGroupType) = 0;
     virtual ze_result_t mapOrdinalForAvailableEngineGroup(uint32_t *ordinal) = 0;
 };
 
@@ -34,6 +34,7 @@
 #include "level_zero/core/source/builtin/builtin_functions_lib.h"
 #include "level_zero/core/source/cmdlist/cmdlist.h"
 #include "level_zero/core/source/cmdqueue/cmdqueue.h"
+#include "level_zero/core/source/cmdqueue/cmdqueue_balanced.h"
 #include "level_zero/core/source/driver/driver_handle_imp.h"
 #include "level_zero/core/source/event/event.h"
 #include "level_zero/core/source/hw_helpers/l0_hw_helper.h"
@@ -91,6 +92,9 @@ ze_result_t DeviceImp::createCommandList(const ze_command_list_desc_t *desc,
     mapOrdinalForAvailableEngineGroup(&engineGroupIndex);
     ze_result_t returnValue = ZE_RESULT_SUCCESS;
     *commandList = CommandList::create(productFamily, this, static_cast<NEO::EngineGroupType>(engineGroupIndex), returnValue);
+    if (*commandList && (desc->flags & ZE_COMMAND_LIST_FLAG_RELAXED_ORDERING)) {
+        CommandList::fromHandle(*commandList)->commandContainer.keepSlmEnabledL3Config = true;
+    }
 
     return returnValue;
 }
@@ -116,9 +120,14 @@ ze_result_t DeviceImp::createCommandQueue(const ze_command_queue_desc_t *desc,
     if (desc->priority == ZE_COMMAND_QUEUE_PRIORITY_PRIORITY_LOW) {
         getCsrForLowPriority(&csr);
     } else {
-        auto ret = getCsrForOrdinalAndIndex(&csr, desc->ordinal, desc->index);
-        if (ret != ZE_RESULT_SUCCESS) {
-            return ret;
+        if (desc->priority == ZE_COMMAND_QUEUE_PRIORITY_PRIORITY_HIGH) {
+            getCsrForHighPriority(&csr, static_cast<NEO::EngineGroupType>(engineGroupIndex));
+        }
+        if (csr == nullptr) {
+            auto ret = getCsrForOrdinalAndIndex(&csr, desc->ordinal, desc->index);
+            if (ret != ZE_RESULT_SUCCESS) {
+                return ret;
+            }
         }
     }
 
@@ -129,6 +138,20 @@ ze_result_t DeviceImp::createCommandQueue(const ze_command_queue_desc_t *desc,
     auto &hwHelper = NEO::HwHelper::get(platform.eRenderCoreFamily);
     bool isCopyOnly = hwHelper.isCopyOnlyEngineType(static_cast<NEO::EngineGroupType>(engineGroupIndex));
 
+    auto &engineGroup = getActiveDevice()->getEngineGroups()[engineGroupIndex];
+    if (NEO::DebugManager.flags.EnableCommandQueueLoadBalancing.get() == 1 &&
+        !isCopyOnly && desc->priority != ZE_COMMAND_QUEUE_PRIORITY_PRIORITY_LOW && !csr->getOsContext().isHighPriority() && engineGroup.size() > 1) {
+        std::vector<NEO::CommandStreamReceiver *> csrs;
+        for (auto &engine : engineGroup) {
+            if (!getActiveDevice()->ensureEngineInitialized(engine)) {
+                return ZE_RESULT_ERROR_UNKNOWN;
+            }
+            csrs.push_back(engine.commandStreamReceiver);
+        }
+        *commandQueue = BalancedCommandQueue::create(platform.eProductFamily, this, csrs, desc, returnValue);
+        return returnValue;
+    }
+
     *commandQueue = CommandQueue::create(platform.eProductFamily, this, csr, desc, isCopyOnly, false, returnValue);
 
     return returnValue;
@@ -615,7 +638,8 @@ Device *Device::create(DriverHandle *driverHandle, NEO::Device *neoDevice, uint3
 
     if (neoDevice->getCompilerInterface()) {
         auto hwInfo = neoDevice->getHardwareInfo();
-        if (neoDevice->getPreemptionMode() == NEO::PreemptionMode::MidThread || neoDevice->getDebugger()) {
+        if ((neoDevice->getPreemptionMode() == NEO::PreemptionMode::MidThread || neoDevice->getDebugger()) &&
+            !NEO::SipKernel::isInitializationDeferred(neoDevice->getDebugger() != nullptr)) {
             auto sipType = NEO::SipKernel::getSipKernelType(hwInfo.platform.eRenderCoreFamily, neoDevice->getDebugger());
             NEO::initSipKernel(sipType, *neoDevice);
         }
@@ -634,9 +658,11 @@ Device *Device::create(DriverHandle *driverHandle, NEO::Device *neoDevice, uint3
         cmdQueueDesc.stype = ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC;
         cmdQueueDesc.mode = ZE_COMMAND_QUEUE_MODE_SYNCHRONOUS;
         ze_result_t returnValue = ZE_RESULT_SUCCESS;
+        // transfers use the internal copy context when present, so faults do not wait behind compute work
+        auto engineGroupType = neoDevice->getInternalCopyEngine() ? NEO::EngineGroupType::Copy : NEO::EngineGroupType::RenderCompute;
         device->pageFaultCommandList =
             CommandList::createImmediate(
-                device->neoDevice->getHardwareInfo().platform.eProductFamily, device, &cmdQueueDesc, true, NEO::EngineGroupType::RenderCompute, returnValue);
+                device->neoDevice->getHardwareInfo().platform.eProductFamily, device, &cmdQueueDesc, true, engineGroupType, returnValue);
     }
 
     if (device->getSourceLevelDebugger()) {
@@ -802,7 +828,11 @@ ze_result_t DeviceImp::getCsrForOrdinalAndIndex(NEO::CommandStreamReceiver **csr
     if (index >= activeDevice->getEngineGroups()[engineGroupIndex].size()) {
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
-    *csr = activeDevice->getEngineGroups()[engineGroupIndex][index].commandStreamReceiver;
+    auto &engine = activeDevice->getEngineGroups()[engineGroupIndex][index];
+    if (!activeDevice->ensureEngineInitialized(engine)) {
+        return ZE_RESULT_ERROR_UNKNOWN;
+    }
+    *csr = engine.commandStreamReceiver;
     return ZE_RESULT_SUCCESS;
 }
 
@@ -810,6 +840,9 @@ ze_result_t DeviceImp::getCsrForLowPriority(NEO::CommandStreamReceiver **csr) {
     NEO::Device *activeDevice = getActiveDevice();
     for (auto &it : activeDevice->getEngines()) {
         if (it.osContext->isLowPriority()) {
+            if (!activeDevice->ensureEngineInitialized(it)) {
+                return ZE_RESULT_ERROR_UNKNOWN;
+            }
             *csr = it.commandStreamReceiver;
             return ZE_RESULT_SUCCESS;
         }
@@ -819,6 +852,23 @@ ze_result_t DeviceImp::getCsrForLowPriority(NEO::CommandStreamReceiver **csr) {
     return ZE_RESULT_ERROR_UNKNOWN;
 }
 
+ze_result_t DeviceImp::getCsrForHighPriority(NEO::CommandStreamReceiver **csr, NEO::EngineGroupType engineGroupType) {
+    NEO::Device *activeDevice = getActiveDevice();
+    auto &hwInfo = activeDevice->getHardwareInfo();
+    auto &hwHelper = NEO::HwHelper::get(hwInfo.platform.eRenderCoreFamily);
+    for (auto &it : activeDevice->getEngines()) {
+        if (it.osContext->isHighPriority() && hwHelper.getEngineGroupType(it.getEngineType(), hwInfo) == engineGroupType) {
+            if (!activeDevice->ensureEngineInitialized(it)) {
+                return ZE_RESULT_ERROR_UNKNOWN;
+            }
+            *csr = it.commandStreamReceiver;
+            return ZE_RESULT_SUCCESS;
+        }
+    }
+    // high priority contexts are created only on request, queues fall back to the regular engines
+    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
 ze_result_t DeviceImp::mapOrdinalForAvailableEngineGroup(uint32_t *ordinal) {
     NEO::Device *activeDevice = getActiveDevice();
     auto engines = activeDevice->getEngineGroups();
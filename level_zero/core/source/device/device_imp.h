@@ -15,6 +15,8 @@
 #include "level_zero/tools/source/debug/debug_session.h"
 #include "level_zero/tools/source/metrics/metric.h"
 
+#include <mutex>
+
 namespace L0 {
 struct SysmanDevice;
 
@@ -84,6 +86,7 @@ struct DeviceImp : public Device {
     SysmanDevice *getSysmanHandle() override;
     ze_result_t getCsrForOrdinalAndIndex(NEO::CommandStreamReceiver **csr, uint32_t ordinal, uint32_t index) override;
     ze_result_t getCsrForLowPriority(NEO::CommandStreamReceiver **csr) override;
+    ze_result_t getCsrForHighPriority(NEO::CommandStreamReceiver **csr, NEO::EngineGroupType engineGroupType) override;
     ze_result_t mapOrdinalForAvailableEngineGroup(uint32_t *ordinal) override;
     NEO::Device *getActiveDevice() const;
     void getDeviceMemoryName(std::string &memoryName);
@@ -98,6 +101,8 @@ struct DeviceImp : public Device {
     std::vector<Device *> subDevices;
     DriverHandle *driverHandle = nullptr;
     CommandList *pageFaultCommandList = nullptr;
+    // page faults on different allocations are handled concurrently and share the list
+    std::mutex pageFaultCommandListLock;
 
     bool resourcesReleased = false;
     void releaseResources();
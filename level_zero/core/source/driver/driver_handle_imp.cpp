@@ -146,7 +146,7 @@ ze_result_t DriverHandleImp::getMemAllocProperties(const void *ptr,
     }
 
     pMemAllocProperties->type = parseUSMType(alloc->memoryType);
-    pMemAllocProperties->id = alloc->gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress();
+    pMemAllocProperties->id = alloc->getGpuAddress();
 
     if (phDevice != nullptr) {
         if (alloc->device == nullptr) {
@@ -179,6 +179,10 @@ ze_result_t DriverHandleImp::getMemAllocProperties(const void *ptr,
 }
 
 DriverHandleImp::~DriverHandleImp() {
+    if (this->svmAllocsManager) {
+        this->svmAllocsManager->releaseDeviceUsmPools();
+        this->svmAllocsManager->releaseSystemAllocations();
+    }
     for (auto &device : this->devices) {
         delete device;
     }
@@ -188,6 +192,15 @@ DriverHandleImp::~DriverHandleImp() {
     }
 }
 
+void DriverHandleImp::prepareForFastTeardown() {
+    for (auto &device : this->devices) {
+        device->getNEODevice()->prepareForFastTeardown();
+    }
+    if (!this->devices.empty()) {
+        this->devices[0]->getNEODevice()->getExecutionEnvironment()->prepareForFastTeardown();
+    }
+}
+
 ze_result_t DriverHandleImp::initialize(std::vector<std::unique_ptr<NEO::Device>> neoDevices) {
     if (enablePciIdDeviceOrder) {
         sortNeoDevices(neoDevices);
@@ -357,7 +370,15 @@ ze_result_t DriverHandleImp::createEventPool(const ze_event_pool_desc_t *desc,
 
 ze_result_t DriverHandleImp::openEventPoolIpcHandle(ze_ipc_event_pool_handle_t hIpc,
                                                     ze_event_pool_handle_t *phEventPool) {
-    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    EventPool *eventPool = EventPool::openIpcHandle(this, hIpc);
+
+    if (eventPool == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    *phEventPool = eventPool->toHandle();
+
+    return ZE_RESULT_SUCCESS;
 }
 
 void DriverHandleImp::createHostPointerManager() {
@@ -64,6 +64,7 @@ struct DriverHandleImp : public DriverHandle {
     ze_result_t checkMemoryAccessFromDevice(Device *device, const void *ptr) override;
     NEO::SVMAllocsManager *getSvmAllocsManager() override;
     ze_result_t initialize(std::vector<std::unique_ptr<NEO::Device>> neoDevices);
+    void prepareForFastTeardown();
     bool findAllocationDataForRange(const void *buffer,
                                     size_t size,
                                     NEO::SvmAllocationData **allocData) override;
@@ -85,6 +86,7 @@ struct DriverHandleImp : public DriverHandle {
                                                                      uintptr_t *gpuAddress) override;
     void createHostPointerManager();
     void sortNeoDevices(std::vector<std::unique_ptr<NEO::Device>> &neoDevices);
+    uint64_t getIpcHandleIdentity(uint64_t handle);
 
     std::unique_ptr<HostPointerManager> hostPointerManager;
     // Experimental functions
@@ -93,6 +95,14 @@ struct DriverHandleImp : public DriverHandle {
     std::mutex sharedMakeResidentAllocationsLock;
     std::map<void *, NEO::GraphicsAllocation *> sharedMakeResidentAllocations;
 
+    struct IpcImport {
+        void *ptr;
+        uint32_t refCount;
+    };
+    // keyed by root device index and OS identity of the imported buffer
+    std::mutex ipcImportsLock;
+    std::map<std::pair<uint32_t, uint64_t>, IpcImport> ipcImports;
+
     std::vector<Device *> devices;
     // Spec extensions
     const std::vector<std::pair<std::string, uint32_t>> extensionsSupported = {
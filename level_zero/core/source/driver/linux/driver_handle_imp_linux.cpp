@@ -10,6 +10,8 @@
 
 #include "level_zero/core/source/driver/driver_handle_imp.h"
 
+#include <sys/stat.h>
+
 namespace L0 {
 
 bool comparePciIdBusNumber(std::unique_ptr<NEO::Device> &neoDevice1, std::unique_ptr<NEO::Device> &neoDevice2) {
@@ -32,4 +34,13 @@ void DriverHandleImp::sortNeoDevices(std::vector<std::unique_ptr<NEO::Device>> &
     std::sort(neoDevices.begin(), neoDevices.end(), comparePciIdBusNumber);
 }
 
+uint64_t DriverHandleImp::getIpcHandleIdentity(uint64_t handle) {
+    // every dma-buf has its own inode, shared by all fds referring to it
+    struct stat fdStat = {};
+    if (fstat(static_cast<int>(handle), &fdStat) == 0) {
+        return static_cast<uint64_t>(fdStat.st_ino);
+    }
+    return handle;
+}
+
 } // namespace L0
\ No newline at end of file
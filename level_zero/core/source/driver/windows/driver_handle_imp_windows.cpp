@@ -12,4 +12,8 @@ namespace L0 {
 void DriverHandleImp::sortNeoDevices(std::vector<std::unique_ptr<NEO::Device>> &neoDevices) {
 }
 
+uint64_t DriverHandleImp::getIpcHandleIdentity(uint64_t handle) {
+    return handle;
+}
+
 } // namespace L0
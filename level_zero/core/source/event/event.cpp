@@ -14,6 +14,7 @@
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/memory_operations_handler.h"
@@ -21,8 +22,10 @@
 
 #include "level_zero/core/source/device/device.h"
 #include "level_zero/core/source/device/device_imp.h"
+#include "level_zero/core/source/driver/driver_handle_imp.h"
 #include "level_zero/tools/source/metrics/metric.h"
 
+#include <algorithm>
 #include <queue>
 #include <unordered_map>
 
@@ -71,6 +74,22 @@ ze_result_t EventPoolImp::initialize(DriverHandle *driver, uint32_t numDevices,
                                                       deviceBitfield};
     unifiedMemoryProperties.alignment = eventAlignment;
 
+    if (isEventPoolShareable) {
+        // userptr backed pools cannot be exported, so IPC pools get their own buffer object on the first device
+        // and are accessed from the host through a mapping of it
+        unifiedMemoryProperties.flags.shareable = true;
+        auto memoryManager = driver->getMemoryManager();
+        auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(unifiedMemoryProperties);
+        if (!allocation) {
+            return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
+        }
+        eventPoolAllocations->addAllocation(allocation);
+        if (!memoryManager->lockResource(allocation)) {
+            return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
     void *eventPoolPtr = driver->getMemoryManager()->createMultiGraphicsAllocationInSystemMemoryPool(rootDeviceIndices,
                                                                                                      unifiedMemoryProperties,
                                                                                                      *eventPoolAllocations);
@@ -81,7 +100,53 @@ ze_result_t EventPoolImp::initialize(DriverHandle *driver, uint32_t numDevices,
     return ZE_RESULT_SUCCESS;
 }
 
+ze_result_t EventPoolImp::initializeFromIpcHandle(DriverHandle *driver, const ze_ipc_event_pool_handle_t &ipcHandle) {
+    IpcEventPoolData poolData = {};
+    memcpy_s(&poolData, sizeof(poolData), ipcHandle.data, sizeof(poolData));
+
+    for (auto device : static_cast<DriverHandleImp *>(driver)->devices) {
+        if (device->getNEODevice()->getRootDeviceIndex() == poolData.rootDeviceIndex) {
+            this->devices.push_back(device);
+            break;
+        }
+    }
+    if (this->devices.empty()) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    numEvents = static_cast<size_t>(poolData.numEvents);
+    if (poolData.isTimestamp) {
+        isEventPoolUsedForTimestamp = true;
+        eventSize = timestampEventSize;
+    }
+    isEventPoolShareable = true;
+    isImportedFromIpcHandle = true;
+
+    eventPoolAllocations = new NEO::MultiGraphicsAllocation(poolData.rootDeviceIndex);
+
+    NEO::AllocationProperties unifiedMemoryProperties{poolData.rootDeviceIndex,
+                                                      alignUp<size_t>(numEvents * eventSize, MemoryConstants::pageSize64k),
+                                                      isEventPoolUsedForTimestamp ? NEO::GraphicsAllocation::AllocationType::TIMESTAMP_PACKET_TAG_BUFFER
+                                                                                  : NEO::GraphicsAllocation::AllocationType::BUFFER_HOST_MEMORY,
+                                                      devices[0]->getNEODevice()->getDeviceBitfield()};
+    auto memoryManager = driver->getMemoryManager();
+    auto allocation = memoryManager->createGraphicsAllocationFromSharedHandle(static_cast<NEO::osHandle>(poolData.handle),
+                                                                              unifiedMemoryProperties,
+                                                                              false);
+    if (!allocation) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    eventPoolAllocations->addAllocation(allocation);
+    if (!memoryManager->lockResource(allocation)) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
 EventPoolImp::~EventPoolImp() {
+    if (eventPoolAllocations == nullptr) {
+        return;
+    }
     auto graphicsAllocations = eventPoolAllocations->getGraphicsAllocations();
     auto memoryManager = devices[0]->getDriverHandle()->getMemoryManager();
     for (auto gpuAllocation : graphicsAllocations) {
@@ -92,11 +157,28 @@ EventPoolImp::~EventPoolImp() {
 }
 
 ze_result_t EventPoolImp::getIpcHandle(ze_ipc_event_pool_handle_t *pIpcHandle) {
-    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    if (!isEventPoolShareable) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    auto rootDeviceIndex = getDevice()->getNEODevice()->getRootDeviceIndex();
+    auto allocation = eventPoolAllocations->getGraphicsAllocation(rootDeviceIndex);
+
+    IpcEventPoolData poolData = {};
+    poolData.handle = allocation->peekInternalHandle(getDevice()->getDriverHandle()->getMemoryManager());
+    poolData.numEvents = numEvents;
+    poolData.rootDeviceIndex = rootDeviceIndex;
+    poolData.isTimestamp = isEventPoolUsedForTimestamp;
+
+    memcpy_s(pIpcHandle->data, sizeof(pIpcHandle->data), &poolData, sizeof(poolData));
+    return ZE_RESULT_SUCCESS;
 }
 
 ze_result_t EventPoolImp::closeIpcHandle() {
-    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    if (!isEventPoolShareable) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    return ZE_RESULT_SUCCESS;
 }
 
 ze_result_t EventPoolImp::destroy() {
@@ -125,13 +207,16 @@ Event *Event::create(EventPool *eventPool, const ze_event_desc_t *desc, Device *
 
     auto alloc = eventPool->getAllocation().getGraphicsAllocation(device->getNEODevice()->getRootDeviceIndex());
 
-    uint64_t baseHostAddr = reinterpret_cast<uint64_t>(alloc->getUnderlyingBuffer());
+    auto hostBuffer = alloc->isLocked() ? alloc->getLockedPtr() : alloc->getUnderlyingBuffer();
+    uint64_t baseHostAddr = reinterpret_cast<uint64_t>(hostBuffer);
     event->hostAddress = reinterpret_cast<void *>(baseHostAddr + (desc->index * eventPool->getEventSize()));
     event->gpuAddress = alloc->getGpuAddress() + (desc->index * eventPool->getEventSize());
     event->signalScope = desc->signal;
     event->waitScope = desc->wait;
     event->csr = static_cast<DeviceImp *>(device)->neoDevice->getDefaultEngine().commandStreamReceiver;
-    event->reset();
+    if (!eventPool->isImportedFromIpcHandle) {
+        event->reset();
+    }
 
     return event;
 }
@@ -173,7 +258,8 @@ ze_result_t EventImp::calculateProfilingData() {
 
 void EventImp::assignTimestampData(void *address) {
     auto baseAddr = reinterpret_cast<uint64_t>(address);
-    uint32_t packetsToCopy = packetsInUse ? packetsInUse : NEO::TimestampPacketSizeControl::preferredPacketCount;
+    // calculateProfilingData reads only the packets in use, the first one at least
+    uint32_t packetsToCopy = std::max(packetsInUse, 1u);
 
     auto copyData = [&](uint32_t &timestampField, auto tsAddr) {
         memcpy_s(static_cast<void *>(&timestampField), sizeof(uint32_t), reinterpret_cast<void *>(tsAddr), sizeof(uint32_t));
@@ -213,15 +299,9 @@ ze_result_t EventImp::queryStatus() {
 ze_result_t EventImp::hostEventSetValueTimestamps(uint32_t eventVal) {
 
     auto baseAddr = reinterpret_cast<uint64_t>(hostAddress);
-    auto signalScopeFlag = this->signalScope;
 
     auto eventTsSetFunc = [&](auto tsAddr) {
-        auto tsptr = reinterpret_cast<void *>(tsAddr);
-
-        memcpy_s(tsptr, sizeof(uint32_t), static_cast<void *>(&eventVal), sizeof(uint32_t));
-        if (!signalScopeFlag) {
-            NEO::CpuIntrinsics::clFlush(tsptr);
-        }
+        memcpy_s(reinterpret_cast<void *>(tsAddr), sizeof(uint32_t), static_cast<void *>(&eventVal), sizeof(uint32_t));
     };
 
     for (uint32_t i = 0; i < NEO::TimestampPacketSizeControl::preferredPacketCount; i++) {
@@ -231,7 +311,21 @@ ze_result_t EventImp::hostEventSetValueTimestamps(uint32_t eventVal) {
         eventTsSetFunc(baseAddr + offsetof(TimestampPacketStorage::Packet, globalEnd));
         baseAddr += sizeof(struct TimestampPacketStorage::Packet);
     }
-    assignTimestampData(hostAddress);
+    if (!this->signalScope) {
+        // packets share cache lines, so each line is flushed once after all of them are written
+        auto packetsSize = NEO::TimestampPacketSizeControl::preferredPacketCount * sizeof(struct TimestampPacketStorage::Packet);
+        for (size_t offset = 0; offset < packetsSize; offset += MemoryConstants::cacheLineSize) {
+            NEO::CpuIntrinsics::clFlush(ptrOffset(hostAddress, offset));
+        }
+    }
+
+    // the host copy is known without reading the packets back
+    for (auto &packet : timestampsData->packets) {
+        packet.contextStart = eventVal;
+        packet.globalStart = eventVal;
+        packet.contextEnd = eventVal;
+        packet.globalEnd = eventVal;
+    }
 
     return ZE_RESULT_SUCCESS;
 }
@@ -254,6 +348,24 @@ ze_result_t EventImp::hostSignal() {
     return hostEventSetValue(Event::STATE_SIGNALED);
 }
 
+uint64_t EventImp::getHostWaitSpinTime() const {
+    return eventPool->getHostWaitSpinTime();
+}
+
+bool EventImp::sleepUntilCsrCompletesSubmission(FlushStamp &lastWaitedFlushStamp) {
+    auto csr = getCsr();
+    if (csr->isDirectSubmissionEnabled() || *csr->getTagAddress() >= csr->peekTaskCount()) {
+        return false;
+    }
+    auto flushStamp = csr->obtainCurrentFlushStamp();
+    if (flushStamp == lastWaitedFlushStamp) {
+        // submission not flushed yet, waiting on the same stamp again would return immediately
+        return false;
+    }
+    lastWaitedFlushStamp = flushStamp;
+    return csr->waitForFlushStamp(flushStamp);
+}
+
 ze_result_t EventImp::hostSynchronize(uint64_t timeout) {
     std::chrono::high_resolution_clock::time_point time1, time2;
     uint64_t timeDiff = 0;
@@ -267,6 +379,11 @@ ze_result_t EventImp::hostSynchronize(uint64_t timeout) {
         return queryStatus();
     }
 
+    const bool infiniteTimeout = timeout == std::numeric_limits<uint32_t>::max() || timeout == std::numeric_limits<uint64_t>::max();
+    const auto spinTimeNs = getHostWaitSpinTime();
+    const bool kmdSleepAllowed = infiniteTimeout && spinTimeNs != std::numeric_limits<uint64_t>::max();
+    FlushStamp lastWaitedFlushStamp = 0;
+
     time1 = std::chrono::high_resolution_clock::now();
     while (true) {
         ret = queryStatus();
@@ -274,17 +391,21 @@ ze_result_t EventImp::hostSynchronize(uint64_t timeout) {
             return ZE_RESULT_SUCCESS;
         }
 
+        if (kmdSleepAllowed && timeDiff >= spinTimeNs && sleepUntilCsrCompletesSubmission(lastWaitedFlushStamp)) {
+            continue;
+        }
+
         std::this_thread::yield();
         NEO::CpuIntrinsics::pause();
 
-        if (timeout == std::numeric_limits<uint32_t>::max()) {
+        if (infiniteTimeout && !kmdSleepAllowed) {
             continue;
         }
 
         time2 = std::chrono::high_resolution_clock::now();
         timeDiff = std::chrono::duration_cast<std::chrono::nanoseconds>(time2 - time1).count();
 
-        if (timeDiff >= timeout) {
+        if (!infiniteTimeout && timeDiff >= timeout) {
             break;
         }
     }
@@ -340,6 +461,20 @@ EventPool *EventPool::create(DriverHandle *driver, uint32_t numDevices,
         delete eventPool;
         return nullptr;
     }
+    if (NEO::DebugManager.flags.EventHostWaitSpinTimeUs.get() != -1) {
+        eventPool->setHostWaitSpinTime(static_cast<uint64_t>(NEO::DebugManager.flags.EventHostWaitSpinTimeUs.get()) * 1000u);
+    }
+    return eventPool;
+}
+
+EventPool *EventPool::openIpcHandle(DriverHandle *driver, const ze_ipc_event_pool_handle_t &ipcHandle) {
+    auto eventPool = new EventPoolImp(driver, 0, nullptr, 0, 0);
+
+    ze_result_t result = eventPool->initializeFromIpcHandle(driver, ipcHandle);
+    if (result) {
+        delete eventPool;
+        return nullptr;
+    }
     return eventPool;
 }
 
@@ -14,6 +14,8 @@
 #include "level_zero/core/source/driver/driver_handle.h"
 #include <level_zero/ze_api.h>
 
+#include <limits>
+
 struct _ze_event_handle_t {};
 
 struct _ze_event_pool_handle_t {};
@@ -32,6 +34,9 @@ struct Event : _ze_event_handle_t {
     virtual ze_result_t queryStatus() = 0;
     virtual ze_result_t reset() = 0;
     virtual ze_result_t queryKernelTimestamp(ze_kernel_timestamp_result_t *dstptr) = 0;
+    // infinite host waits poll this long before they sleep in the kernel, UINT64_MAX never sleeps
+    virtual uint64_t getHostWaitSpinTime() const { return std::numeric_limits<uint64_t>::max(); }
+    virtual bool sleepUntilCsrCompletesSubmission(FlushStamp &lastWaitedFlushStamp) { return false; }
     enum State : uint32_t {
         STATE_SIGNALED = 0u,
         STATE_CLEARED = static_cast<uint32_t>(-1),
@@ -51,6 +56,8 @@ struct Event : _ze_event_handle_t {
     uint64_t getGpuAddress() { return gpuAddress; }
     void *getHostAddress() { return hostAddress; }
     uint32_t getPacketsInUse() { return packetsInUse; }
+    NEO::CommandStreamReceiver *getCsr() { return csr; }
+    void setCsr(NEO::CommandStreamReceiver *csr) { this->csr = csr; }
     uint64_t getTimestampPacketAddress();
 
     void *hostAddress = nullptr;
@@ -91,6 +98,10 @@ struct EventImp : public Event {
 
     ze_result_t queryKernelTimestamp(ze_kernel_timestamp_result_t *dstptr) override;
 
+    uint64_t getHostWaitSpinTime() const override;
+
+    bool sleepUntilCsrCompletesSubmission(FlushStamp &lastWaitedFlushStamp) override;
+
     Device *device;
     EventPool *eventPool;
 
@@ -104,6 +115,7 @@ struct EventImp : public Event {
 
 struct EventPool : _ze_event_pool_handle_t {
     static EventPool *create(DriverHandle *driver, uint32_t numDevices, ze_device_handle_t *phDevices, const ze_event_pool_desc_t *desc);
+    static EventPool *openIpcHandle(DriverHandle *driver, const ze_ipc_event_pool_handle_t &ipcHandle);
     virtual ~EventPool() = default;
     virtual ze_result_t destroy() = 0;
     virtual ze_result_t getIpcHandle(ze_ipc_event_pool_handle_t *pIpcHandle) = 0;
@@ -121,16 +133,28 @@ struct EventPool : _ze_event_pool_handle_t {
 
     virtual uint32_t getEventSize() = 0;
 
+    void setHostWaitSpinTime(uint64_t spinTimeNs) { hostWaitSpinTimeNs = spinTimeNs; }
+    uint64_t getHostWaitSpinTime() const { return hostWaitSpinTimeNs; }
+
     bool isEventPoolUsedForTimestamp = false;
+    bool isEventPoolShareable = false;
+    // pools opened from an IPC handle observe events owned by the exporting process and never reset them
+    bool isImportedFromIpcHandle = false;
 
   protected:
     NEO::MultiGraphicsAllocation *eventPoolAllocations = nullptr;
+    // infinite host waits on events of this pool poll this long, then sleep in the kernel
+    uint64_t hostWaitSpinTimeNs = std::numeric_limits<uint64_t>::max();
 };
 
 struct EventPoolImp : public EventPool {
     EventPoolImp(DriverHandle *driver, uint32_t numDevices, ze_device_handle_t *phDevices, uint32_t numEvents, ze_event_pool_flags_t flags) : numEvents(numEvents) {
         if (flags & ZE_EVENT_POOL_FLAG_KERNEL_TIMESTAMP) {
             isEventPoolUsedForTimestamp = true;
+            eventSize = timestampEventSize;
+        }
+        if (flags & ZE_EVENT_POOL_FLAG_IPC) {
+            isEventPoolShareable = true;
         }
     }
 
@@ -138,6 +162,7 @@ struct EventPoolImp : public EventPool {
                            uint32_t numDevices,
                            ze_device_handle_t *phDevices,
                            uint32_t numEvents);
+    ze_result_t initializeFromIpcHandle(DriverHandle *driver, const ze_ipc_event_pool_handle_t &ipcHandle);
 
     ~EventPoolImp();
 
@@ -158,8 +183,20 @@ struct EventPoolImp : public EventPool {
     size_t numEvents;
 
   protected:
-    const uint32_t eventSize = static_cast<uint32_t>(alignUp(NEO::TimestampPacketSizeControl::preferredPacketCount * sizeof(struct TimestampPacketStorage::Packet),
-                                                             MemoryConstants::cacheLineSize));
+    struct IpcEventPoolData {
+        uint64_t handle;
+        uint64_t numEvents;
+        uint32_t rootDeviceIndex;
+        uint32_t isTimestamp;
+    };
+    static_assert(sizeof(IpcEventPoolData) <= ZE_MAX_IPC_HANDLE_SIZE, "IPC event pool data does not fit in the IPC handle");
+
+    static constexpr uint32_t timestampEventSize = static_cast<uint32_t>(alignUp(NEO::TimestampPacketSizeControl::preferredPacketCount * sizeof(struct TimestampPacketStorage::Packet),
+                                                                                 MemoryConstants::cacheLineSize));
+    // events without timestamps only hold their state, signaled and waited on as a single qword
+    static constexpr uint32_t counterEventSize = static_cast<uint32_t>(sizeof(uint64_t));
+
+    uint32_t eventSize = counterEventSize;
     const uint32_t eventAlignment = MemoryConstants::cacheLineSize;
 };
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "shared/source/command_stream/csr_definitions.h"
+#include "shared/source/helpers/completion_stamp.h"
 
 #include "level_zero/core/source/cmdqueue/cmdqueue.h"
 #include "level_zero/core/source/cmdqueue/cmdqueue_imp.h"
@@ -27,6 +28,10 @@ struct Fence : _ze_fence_handle_t {
     virtual ze_result_t queryStatus() = 0;
     virtual ze_result_t reset() = 0;
 
+    // fences are always polled, infinite host waits never sleep in the kernel
+    uint64_t getHostWaitSpinTime() const { return std::numeric_limits<uint64_t>::max(); }
+    bool sleepUntilCsrCompletesSubmission(NEO::FlushStamp &lastWaitedFlushStamp) { return false; }
+
     static Fence *fromHandle(ze_fence_handle_t handle) { return static_cast<Fence *>(handle); }
 
     inline ze_fence_handle_t toHandle() { return this; }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,9 +7,28 @@
 
 #include "level_zero/core/source/get_extension_function_lookup_map.h"
 
+#include "level_zero/api/extensions/public/ze_exp_ext.h"
+
 namespace L0 {
 std::unordered_map<std::string, void *> getExtensionFunctionsLookupMap() {
-    return std::unordered_map<std::string, void *>();
+    std::unordered_map<std::string, void *> lookupMap;
+
+    lookupMap["zexCommandListAppendLaunchMutableKernel"] = reinterpret_cast<void *>(zexCommandListAppendLaunchMutableKernel);
+    lookupMap["zexCommandListUpdateMutableKernelArgument"] = reinterpret_cast<void *>(zexCommandListUpdateMutableKernelArgument);
+    lookupMap["zexCommandListUpdateMutableGroupCount"] = reinterpret_cast<void *>(zexCommandListUpdateMutableGroupCount);
+    lookupMap["zexCommandListSetKernelTimingHistogram"] = reinterpret_cast<void *>(zexCommandListSetKernelTimingHistogram);
+    lookupMap["zexCommandListAppendSWTagRangeBegin"] = reinterpret_cast<void *>(zexCommandListAppendSWTagRangeBegin);
+    lookupMap["zexCommandListAppendSWTagRangeEnd"] = reinterpret_cast<void *>(zexCommandListAppendSWTagRangeEnd);
+    lookupMap["zexEventPoolSetHostWaitSpinTime"] = reinterpret_cast<void *>(zexEventPoolSetHostWaitSpinTime);
+    lookupMap["zexEventHostSynchronizeMultiple"] = reinterpret_cast<void *>(zexEventHostSynchronizeMultiple);
+    lookupMap["zexFenceHostSynchronizeMultiple"] = reinterpret_cast<void *>(zexFenceHostSynchronizeMultiple);
+    lookupMap["zexSysmanDeviceStartTelemetrySampling"] = reinterpret_cast<void *>(zexSysmanDeviceStartTelemetrySampling);
+    lookupMap["zexSysmanDeviceReadTelemetrySamples"] = reinterpret_cast<void *>(zexSysmanDeviceReadTelemetrySamples);
+    lookupMap["zexSysmanDeviceStopTelemetrySampling"] = reinterpret_cast<void *>(zexSysmanDeviceStopTelemetrySampling);
+    lookupMap["zexCommandQueueGetSubmissionStatistics"] = reinterpret_cast<void *>(zexCommandQueueGetSubmissionStatistics);
+    lookupMap["zexCommandQueueSetSliceCount"] = reinterpret_cast<void *>(zexCommandQueueSetSliceCount);
+
+    return lookupMap;
 }
 
 } // namespace L0
\ No newline at end of file
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/utilities/cpuintrinsics.h"
+#include "shared/source/utilities/stackvec.h"
+
+#include <level_zero/ze_api.h>
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <thread>
+
+namespace L0 {
+
+// Polls events or fences in a single loop instead of synchronizing them one by one.
+// Signaled objects are dropped from the polled set; with waitAll == false the first signaled one ends the wait.
+// Timeout semantics follow hostSynchronize: zero polls once, UINT32_MAX and UINT64_MAX wait until signaled.
+// Infinite waits sleep in the kernel on the first pending object once the shortest host wait spin time passes.
+template <typename ObjectT, typename HandleT>
+ze_result_t hostSynchronizeMultiple(uint32_t numObjects, HandleT *handles, bool waitAll, uint64_t timeout, uint32_t *signaledIndex) {
+    StackVec<uint32_t, 32> pendingIndices;
+    uint64_t spinTimeNs = std::numeric_limits<uint64_t>::max();
+    for (uint32_t i = 0; i < numObjects; i++) {
+        pendingIndices.push_back(i);
+        spinTimeNs = std::min(spinTimeNs, ObjectT::fromHandle(handles[i])->getHostWaitSpinTime());
+    }
+
+    const bool infiniteTimeout = timeout == std::numeric_limits<uint32_t>::max() || timeout == std::numeric_limits<uint64_t>::max();
+    const bool kmdSleepAllowed = infiniteTimeout && spinTimeNs != std::numeric_limits<uint64_t>::max();
+    uint32_t sleepingIndex = numObjects;
+    uint64_t lastWaitedFlushStamp = 0;
+    uint64_t timeDiff = 0;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    while (true) {
+        size_t stillPending = 0;
+        for (auto index : pendingIndices) {
+            // hostSynchronize without timeout is a single status query that also handles AUB mode
+            if (ObjectT::fromHandle(handles[index])->hostSynchronize(0u) != ZE_RESULT_SUCCESS) {
+                pendingIndices[stillPending++] = index;
+            } else if (!waitAll) {
+                if (signaledIndex) {
+                    *signaledIndex = index;
+                }
+                return ZE_RESULT_SUCCESS;
+            }
+        }
+        pendingIndices.resize(stillPending);
+        if (pendingIndices.size() == 0) {
+            return ZE_RESULT_SUCCESS;
+        }
+        if (timeout == 0) {
+            return ZE_RESULT_NOT_READY;
+        }
+
+        if (kmdSleepAllowed && timeDiff >= spinTimeNs) {
+            if (sleepingIndex != pendingIndices[0]) {
+                sleepingIndex = pendingIndices[0];
+                lastWaitedFlushStamp = 0;
+            }
+            if (ObjectT::fromHandle(handles[sleepingIndex])->sleepUntilCsrCompletesSubmission(lastWaitedFlushStamp)) {
+                continue;
+            }
+        }
+
+        std::this_thread::yield();
+        NEO::CpuIntrinsics::pause();
+
+        if (infiniteTimeout && !kmdSleepAllowed) {
+            continue;
+        }
+
+        timeDiff = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start).count();
+        if (!infiniteTimeout && timeDiff >= timeout) {
+            return ZE_RESULT_NOT_READY;
+        }
+    }
+}
+
+} // namespace L0
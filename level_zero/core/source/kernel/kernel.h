@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "shared/source/command_stream/preemption_mode.h"
 #include "shared/source/kernel/dispatch_kernel_encoder_interface.h"
 #include "shared/source/kernel/kernel_descriptor.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
@@ -38,6 +39,10 @@ struct KernelImmutableData {
                     uint32_t computeUnitsUsedForSratch,
                     NEO::GraphicsAllocation *globalConstBuffer, NEO::GraphicsAllocation *globalVarBuffer, bool internalKernel);
 
+    void setKernelInfo(NEO::KernelInfo *kernelInfo);
+    void setIsaParentAllocation(NEO::GraphicsAllocation *parentAllocation, uint64_t offset, size_t size);
+    bool isInitialized() const { return nullptr != getIsaGraphicsAllocation(); }
+
     const std::vector<NEO::GraphicsAllocation *> &getResidencyContainer() const {
         return residencyContainer;
     }
@@ -47,7 +52,8 @@ struct KernelImmutableData {
     }
 
     uint32_t getIsaSize() const;
-    NEO::GraphicsAllocation *getIsaGraphicsAllocation() const { return isaGraphicsAllocation.get(); }
+    NEO::GraphicsAllocation *getIsaGraphicsAllocation() const { return (nullptr != isaParentAllocation) ? isaParentAllocation : isaGraphicsAllocation.get(); }
+    uint64_t getIsaOffsetInParentAllocation() const { return isaOffsetInParentAllocation; }
 
     const uint8_t *getCrossThreadDataTemplate() const { return crossThreadDataTemplate.get(); }
 
@@ -63,6 +69,10 @@ struct KernelImmutableData {
 
     const NEO::KernelInfo *getKernelInfo() const { return kernelInfo; }
 
+    // Initial until initialize() chose the mode, appends then compute it themselves
+    NEO::PreemptionMode getPreemptionMode() const { return preemptionMode; }
+    static NEO::PreemptionMode computePreemptionMode(Device &device, const NEO::KernelDescriptor &kernelDescriptor);
+
   protected:
     MOCKABLE_VIRTUAL void createRelocatedDebugData(NEO::GraphicsAllocation *globalConstBuffer,
                                                    NEO::GraphicsAllocation *globalVarBuffer);
@@ -71,6 +81,11 @@ struct KernelImmutableData {
     NEO::KernelInfo *kernelInfo = nullptr;
     NEO::KernelDescriptor *kernelDescriptor = nullptr;
     std::unique_ptr<NEO::GraphicsAllocation> isaGraphicsAllocation = nullptr;
+    NEO::GraphicsAllocation *isaParentAllocation = nullptr;
+    uint64_t isaOffsetInParentAllocation = 0u;
+    size_t isaSubAllocationSize = 0u;
+
+    NEO::PreemptionMode preemptionMode = NEO::PreemptionMode::Initial;
 
     uint32_t crossThreadDataSize = 0;
     std::unique_ptr<uint8_t[]> crossThreadDataTemplate = nullptr;
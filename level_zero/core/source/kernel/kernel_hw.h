@@ -46,12 +46,6 @@ struct KernelHw : public KernelImp {
             DEBUG_BREAK_IF(baseAddress != (baseAddress & sshAlignmentMask));
             offset = 0;
         }
-        void *surfaceStateAddress = nullptr;
-        if (NEO::isValidOffset(argInfo.bindless)) {
-            surfaceStateAddress = patchBindlessSurfaceState(alloc, argInfo.bindless);
-        } else {
-            surfaceStateAddress = ptrOffset(surfaceStateHeapData.get(), argInfo.bindful);
-        }
         uint64_t bufferAddressForSsh = baseAddress;
         auto alignment = NEO::EncodeSurfaceState<GfxFamily>::getSurfaceBaseAddressAlignment();
         size_t bufferSizeForSsh = ptrDiff(alloc->getGpuAddress(), bufferAddressForSsh);
@@ -65,6 +59,13 @@ struct KernelHw : public KernelImp {
         }
         auto mocs = this->module->getDevice()->getMOCS(l3Enabled, false);
 
+        void *surfaceStateAddress = nullptr;
+        if (NEO::isValidOffset(argInfo.bindless)) {
+            surfaceStateAddress = patchBindlessSurfaceState(alloc, argInfo.bindless, {bufferAddressForSsh, bufferSizeForSsh, mocs});
+        } else {
+            surfaceStateAddress = ptrOffset(surfaceStateHeapData.get(), argInfo.bindful);
+        }
+
         NEO::Device *neoDevice = module->getDevice()->getNEODevice();
         NEO::EncodeSurfaceState<GfxFamily>::encodeBuffer(surfaceStateAddress, bufferAddressForSsh, bufferSizeForSsh, mocs,
                                                          false, false, false, neoDevice->getNumAvailableDevices(),
@@ -7,6 +7,8 @@
 
 #include "level_zero/core/source/kernel/kernel_imp.h"
 
+#include "shared/source/command_stream/preemption.h"
+#include "shared/source/device/device_info.h"
 #include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/blit_commands_helper.h"
 #include "shared/source/helpers/hw_info.h"
@@ -92,14 +94,38 @@ inline void patchWithImplicitSurface(ArrayRef<uint8_t> crossThreadData, ArrayRef
     }
 }
 
+void KernelImmutableData::setKernelInfo(NEO::KernelInfo *kernelInfo) {
+    UNRECOVERABLE_IF(kernelInfo == nullptr);
+    this->kernelInfo = kernelInfo;
+    this->kernelDescriptor = &kernelInfo->kernelDescriptor;
+}
+
+void KernelImmutableData::setIsaParentAllocation(NEO::GraphicsAllocation *parentAllocation, uint64_t offset, size_t size) {
+    UNRECOVERABLE_IF(nullptr != isaGraphicsAllocation);
+    UNRECOVERABLE_IF(offset + size > parentAllocation->getUnderlyingBufferSize());
+    this->isaParentAllocation = parentAllocation;
+    this->isaOffsetInParentAllocation = offset;
+    this->isaSubAllocationSize = size;
+}
+
+NEO::PreemptionMode KernelImmutableData::computePreemptionMode(Device &device, const NEO::KernelDescriptor &kernelDescriptor) {
+    auto &functionAttributes = kernelDescriptor.kernelAttributes;
+    NEO::PreemptionFlags flags = {};
+    flags.flags.disabledMidThreadPreemptionKernel = functionAttributes.flags.requiresDisabledMidThreadPreemption;
+    flags.flags.usesFencesForReadWriteImages = functionAttributes.flags.usesFencesForReadWriteImages;
+    flags.flags.deviceSupportsVmePreemption = device.getDeviceInfo().vmeAvcSupportsPreemption;
+    flags.flags.disablePerCtxtPreemptionGranularityControl = device.getHwInfo().workaroundTable.waDisablePerCtxtPreemptionGranularityControl;
+    flags.flags.disableLSQCROPERFforOCL = device.getHwInfo().workaroundTable.waDisableLSQCROPERFforOCL;
+
+    return NEO::PreemptionHelper::taskPreemptionMode(device.getDevicePreemptionMode(), flags);
+}
+
 void KernelImmutableData::initialize(NEO::KernelInfo *kernelInfo, Device *device,
                                      uint32_t computeUnitsUsedForSratch,
                                      NEO::GraphicsAllocation *globalConstBuffer,
                                      NEO::GraphicsAllocation *globalVarBuffer, bool internalKernel) {
 
-    UNRECOVERABLE_IF(kernelInfo == nullptr);
-    this->kernelInfo = kernelInfo;
-    this->kernelDescriptor = &kernelInfo->kernelDescriptor;
+    setKernelInfo(kernelInfo);
 
     auto neoDevice = device->getNEODevice();
     auto memoryManager = device->getNEODevice()->getMemoryManager();
@@ -107,28 +133,34 @@ void KernelImmutableData::initialize(NEO::KernelInfo *kernelInfo, Device *device
     auto kernelIsaSize = kernelInfo->heapInfo.KernelHeapSize;
     const auto allocType = internalKernel ? NEO::GraphicsAllocation::AllocationType::KERNEL_ISA_INTERNAL : NEO::GraphicsAllocation::AllocationType::KERNEL_ISA;
 
-    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(
-        {neoDevice->getRootDeviceIndex(), kernelIsaSize, allocType, neoDevice->getDeviceBitfield()});
-    UNRECOVERABLE_IF(allocation == nullptr);
+    auto allocation = isaParentAllocation;
+    if (nullptr == allocation) {
+        allocation = memoryManager->allocateGraphicsMemoryWithProperties(
+            {neoDevice->getRootDeviceIndex(), kernelIsaSize, allocType, neoDevice->getDeviceBitfield()});
+        UNRECOVERABLE_IF(allocation == nullptr);
+        isaGraphicsAllocation.reset(allocation);
+    }
 
     auto &hwInfo = neoDevice->getHardwareInfo();
     auto &hwHelper = NEO::HwHelper::get(hwInfo.platform.eRenderCoreFamily);
 
     if (kernelInfo->heapInfo.pKernelHeap != nullptr && internalKernel == false) {
         NEO::MemoryTransferHelper::transferMemoryToAllocation(hwHelper.isBlitCopyRequiredForLocalMemory(hwInfo, *allocation),
-                                                              *neoDevice, allocation, 0, kernelInfo->heapInfo.pKernelHeap,
-                                                              static_cast<size_t>(kernelIsaSize));
+                                                              *neoDevice, allocation, static_cast<size_t>(isaOffsetInParentAllocation),
+                                                              kernelInfo->heapInfo.pKernelHeap, static_cast<size_t>(kernelIsaSize));
     }
 
-    isaGraphicsAllocation.reset(allocation);
-
     if (neoDevice->getDebugger() && kernelInfo->kernelDescriptor.external.debugData.get()) {
-        createRelocatedDebugData(globalConstBuffer, globalVarBuffer);
+        // only the source level debugger is notified with relocated debug data, the L0 debugger registers the ELF as is
+        if (neoDevice->getSourceLevelDebugger()) {
+            createRelocatedDebugData(globalConstBuffer, globalVarBuffer);
+        }
         if (device->getL0Debugger()) {
             device->getL0Debugger()->registerElf(kernelInfo->kernelDescriptor.external.debugData.get(), allocation);
         }
     }
 
+    this->preemptionMode = computePreemptionMode(*device, *kernelDescriptor);
     this->crossThreadDataSize = this->kernelDescriptor->kernelAttributes.crossThreadDataSize;
 
     ArrayRef<uint8_t> crossThredDataArrayRef;
@@ -215,8 +247,8 @@ void KernelImmutableData::createRelocatedDebugData(NEO::GraphicsAllocation *glob
 
             memcpy_s(kernelInfo->kernelDescriptor.external.relocatedDebugData.get(), size, kernelInfo->kernelDescriptor.external.debugData->vIsa, kernelInfo->kernelDescriptor.external.debugData->vIsaSize);
 
-            NEO::Linker::SegmentInfo textSegment = {getIsaGraphicsAllocation()->getGpuAddress(),
-                                                    getIsaGraphicsAllocation()->getUnderlyingBufferSize()};
+            NEO::Linker::SegmentInfo textSegment = {static_cast<uintptr_t>(getIsaGraphicsAllocation()->getGpuAddress() + isaOffsetInParentAllocation),
+                                                    getIsaSize()};
 
             NEO::Linker::applyDebugDataRelocations(decodedElf, ArrayRef<uint8_t>(kernelInfo->kernelDescriptor.external.relocatedDebugData.get(), size),
                                                    textSegment, globalData, constData);
@@ -225,6 +257,9 @@ void KernelImmutableData::createRelocatedDebugData(NEO::GraphicsAllocation *glob
 }
 
 uint32_t KernelImmutableData::getIsaSize() const {
+    if (nullptr != isaParentAllocation) {
+        return static_cast<uint32_t>(isaSubAllocationSize);
+    }
     return static_cast<uint32_t>(isaGraphicsAllocation->getUnderlyingBufferSize());
 }
 
@@ -545,6 +580,13 @@ ze_result_t KernelImp::setArgBuffer(uint32_t argIndex, size_t argSize, const voi
                                                                                                              1u,
                                                                                                              module->getDevice()->getRootDeviceIndex(),
                                                                                                              &gpuAddress);
+    if (nullptr == alloc && module->getDevice()->getNEODevice()->areSharedSystemAllocationsAllowed()) {
+        // malloc'd pointers get the range around them bound at the same GPU address
+        alloc = module->getDevice()->getDriverHandle()->getSvmAllocsManager()->getSystemAllocationForGpuAccess(requestedAddress,
+                                                                                                                module->getDevice()->getRootDeviceIndex(),
+                                                                                                                module->getDevice()->getNEODevice()->getDeviceBitfield());
+        gpuAddress = reinterpret_cast<uintptr_t>(requestedAddress);
+    }
     if (nullptr == alloc) {
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
@@ -561,7 +603,7 @@ ze_result_t KernelImp::setArgImage(uint32_t argIndex, size_t argSize, const void
 
     const auto image = Image::fromHandle(*static_cast<const ze_image_handle_t *>(argVal));
     if (kernelImmData->getDescriptor().kernelAttributes.imageAddressingMode == NEO::KernelDescriptor::Bindless) {
-        image->copySurfaceStateToSSH(patchBindlessSurfaceState(image->getAllocation(), arg.bindless), 0u, isMediaBlockImage);
+        image->copySurfaceStateToSSH(patchBindlessSurfaceState(image->getAllocation(), arg.bindless, {}), 0u, isMediaBlockImage);
     } else {
         image->copySurfaceStateToSSH(surfaceStateHeapData.get(), arg.bindful, isMediaBlockImage);
     }
@@ -653,7 +695,7 @@ ze_result_t KernelImp::initialize(const ze_kernel_desc_t *desc) {
         NEO::MemoryTransferHelper::transferMemoryToAllocation(hwHelper.isBlitCopyRequiredForLocalMemory(hwInfo, *isaAllocation),
                                                               *neoDevice,
                                                               isaAllocation,
-                                                              0,
+                                                              static_cast<size_t>(this->kernelImmData->getIsaOffsetInParentAllocation()),
                                                               this->kernelImmData->getKernelInfo()->heapInfo.pKernelHeap,
                                                               static_cast<size_t>(this->kernelImmData->getKernelInfo()->heapInfo.KernelHeapSize));
     }
@@ -786,11 +828,11 @@ void KernelImp::setDebugSurface() {
                                  *device->getNEODevice());
     }
 }
-void *KernelImp::patchBindlessSurfaceState(NEO::GraphicsAllocation *alloc, uint32_t bindless) {
+void *KernelImp::patchBindlessSurfaceState(NEO::GraphicsAllocation *alloc, uint32_t bindless, const NEO::SurfaceStateView &view) {
     auto &hwHelper = NEO::HwHelper::get(this->module->getDevice()->getHwInfo().platform.eRenderCoreFamily);
     auto surfaceStateSize = hwHelper.getRenderSurfaceStateSize();
     NEO::BindlessHeapsHelper *bindlessHeapsHelper = this->module->getDevice()->getNEODevice()->getBindlessHeapsHelper();
-    auto ssInHeap = bindlessHeapsHelper->allocateSSInHeap(surfaceStateSize, alloc, NEO::BindlessHeapsHelper::GLOBAL_SSH);
+    auto ssInHeap = bindlessHeapsHelper->allocateSSInHeap(surfaceStateSize, alloc, NEO::BindlessHeapsHelper::GLOBAL_SSH, view);
     this->residencyContainer.push_back(ssInHeap.heapAllocation);
     auto patchLocation = ptrOffset(getCrossThreadData(), bindless);
     auto patchValue = hwHelper.getBindlessSurfaceExtendedMessageDescriptorValue(static_cast<uint32_t>(ssInHeap.surfaceStateOffset));
@@ -854,4 +896,8 @@ NEO::GraphicsAllocation *KernelImp::getIsaAllocation() const {
     return getImmutableData()->getIsaGraphicsAllocation();
 }
 
+uint64_t KernelImp::getIsaOffsetInParentAllocation() const {
+    return getImmutableData()->getIsaOffsetInParentAllocation();
+}
+
 } // namespace L0
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "shared/source/helpers/bindless_heaps_helper.h"
 #include "shared/source/kernel/dispatch_kernel_encoder_interface.h"
 #include "shared/source/unified_memory/unified_memory.h"
 
@@ -111,9 +112,11 @@ struct KernelImp : Kernel {
     }
 
     NEO::GraphicsAllocation *getIsaAllocation() const override;
+    uint64_t getIsaOffsetInParentAllocation() const override;
 
     uint32_t getRequiredWorkgroupOrder() const override { return requiredWorkgroupOrder; }
     bool requiresGenerationOfLocalIdsByRuntime() const override { return kernelRequiresGenerationOfLocalIdsByRuntime; }
+    NEO::InterfaceDescriptorTemplate *getInterfaceDescriptorTemplate() override { return &interfaceDescriptorTemplate; }
     bool getKernelRequiresUncachedMocs() { return kernelRequiresUncachedMocs; }
 
     uint32_t *getGlobalOffsets() override {
@@ -144,7 +147,7 @@ struct KernelImp : Kernel {
     void createPrintfBuffer();
     void setDebugSurface();
     virtual void evaluateIfRequiresGenerationOfLocalIdsByRuntime(const NEO::KernelDescriptor &kernelDescriptor) = 0;
-    void *patchBindlessSurfaceState(NEO::GraphicsAllocation *alloc, uint32_t bindless);
+    void *patchBindlessSurfaceState(NEO::GraphicsAllocation *alloc, uint32_t bindless, const NEO::SurfaceStateView &view);
 
     const KernelImmutableData *kernelImmData = nullptr;
     Module *module = nullptr;
@@ -186,6 +189,8 @@ struct KernelImp : Kernel {
     ze_cache_config_flags_t cacheConfigFlags = 0u;
 
     bool kernelHasIndirectAccess = true;
+
+    NEO::InterfaceDescriptorTemplate interfaceDescriptorTemplate;
 };
 
 } // namespace L0
@@ -1,17 +1,28 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
+#include "shared/source/execution_environment/execution_environment.h"
+#include "shared/source/utilities/trace_events.h"
+
 #include "level_zero/core/source/driver/driver_handle_imp.h"
 
 using namespace L0;
 
 void __attribute__((destructor)) driverHandleDestructor() {
+    if (GlobalDriver != nullptr && NEO::ExecutionEnvironment::isFastProcessTeardownEnabled()) {
+        // driver is leaked on purpose, closing the process releases device memory and contexts at once
+        GlobalDriver->prepareForFastTeardown();
+        GlobalDriver = nullptr;
+        NEO::TraceEvents::destroy();
+        return;
+    }
     if (GlobalDriver != nullptr) {
         delete GlobalDriver;
         GlobalDriver = nullptr;
     }
+    NEO::TraceEvents::destroy();
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
  *
  */
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/memory_manager/memory_manager.h"
 
@@ -63,15 +64,42 @@ ze_result_t DriverHandleImp::openIpcMemHandle(ze_device_handle_t hDevice, ze_ipc
              reinterpret_cast<void *>(pIpcHandle.data),
              sizeof(handle));
 
+    if (!NEO::DebugManager.flags.EnableIpcImportCache.get()) {
+        *ptr = this->importFdHandle(hDevice, handle);
+        if (nullptr == *ptr) {
+            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    // the same buffer reaches this process under a new fd on every transfer, so look it up by its identity
+    auto key = std::make_pair(Device::fromHandle(hDevice)->getRootDeviceIndex(), getIpcHandleIdentity(handle));
+    std::lock_guard<std::mutex> lock(ipcImportsLock);
+    auto import = ipcImports.find(key);
+    if (import != ipcImports.end()) {
+        import->second.refCount++;
+        *ptr = import->second.ptr;
+        return ZE_RESULT_SUCCESS;
+    }
+
     *ptr = this->importFdHandle(hDevice, handle);
     if (nullptr == *ptr) {
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
+    ipcImports[key] = {*ptr, 1u};
 
     return ZE_RESULT_SUCCESS;
 }
 
 ze_result_t DriverHandleImp::closeIpcMemHandle(const void *ptr) {
+    // imports stay mapped after the last close, reopening is cheap until the allocation is freed
+    std::lock_guard<std::mutex> lock(ipcImportsLock);
+    for (auto &import : ipcImports) {
+        if (import.second.ptr == ptr && import.second.refCount > 0) {
+            import.second.refCount--;
+            break;
+        }
+    }
     return ZE_RESULT_SUCCESS;
 }
 
@@ -99,11 +127,11 @@ ze_result_t DriverHandleImp::getMemAddressRange(const void *ptr, void **pBase, s
         alloc = allocData->gpuAllocations.getDefaultGraphicsAllocation();
         if (pBase) {
             uint64_t *allocBase = reinterpret_cast<uint64_t *>(pBase);
-            *allocBase = alloc->getGpuAddress();
+            *allocBase = allocData->getGpuAddress();
         }
 
         if (pSize) {
-            *pSize = alloc->getUnderlyingBufferSize();
+            *pSize = allocData->isPooled() ? NEO::UnifiedMemoryPool::getSizeClass(allocData->size) : alloc->getUnderlyingBufferSize();
         }
 
         return ZE_RESULT_SUCCESS;
@@ -257,6 +285,12 @@ ze_result_t DriverHandleImp::freeMem(const void *ptr) {
     if (allocation == nullptr) {
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
+    {
+        std::lock_guard<std::mutex> lock(ipcImportsLock);
+        for (auto import = ipcImports.begin(); import != ipcImports.end();) {
+            import = (import->second.ptr == ptr) ? ipcImports.erase(import) : std::next(import);
+        }
+    }
     svmAllocsManager->freeSVMAlloc(const_cast<void *>(ptr));
     if (svmAllocsManager->getSvmMapOperation(ptr)) {
         svmAllocsManager->removeSvmMapOperation(ptr);
@@ -11,13 +11,17 @@
 #include "shared/source/compiler_interface/linker.h"
 #include "shared/source/device/device.h"
 #include "shared/source/device_binary_format/device_binary_formats.h"
+#include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/api_specific_config.h"
 #include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
+#include "shared/source/program/program_info_serializer.h"
 #include "shared/source/program/program_initialization.h"
 #include "shared/source/source_level_debugger/source_level_debugger.h"
+#include "shared/source/utilities/parallel_for.h"
+#include "shared/source/utilities/trace_events.h"
 
 #include "opencl/source/program/kernel_info.h"
 
@@ -36,6 +40,7 @@ namespace L0 {
 namespace BuildOptions {
 NEO::ConstStringRef optDisable = "-ze-opt-disable";
 NEO::ConstStringRef greaterThan4GbRequired = "-ze-opt-greater-than-4GB-buffer-required";
+NEO::ConstStringRef largeGrf = "-ze-opt-large-register-file";
 NEO::ConstStringRef hasBufferOffsetArg = "-ze-intel-has-buffer-offset-arg";
 NEO::ConstStringRef debugKernelEnable = "-ze-kernel-debug-enable";
 } // namespace BuildOptions
@@ -131,6 +136,8 @@ bool ModuleTranslationUnit::buildFromSpirV(const char *input, uint32_t inputSize
     inputArgs.apiOptions = ArrayRef<const char>(options.c_str(), options.length());
     inputArgs.internalOptions = ArrayRef<const char>(internalOptions.c_str(), internalOptions.length());
     inputArgs.specializedValues = this->specConstantsValues;
+    inputArgs.allowCaching = (false == device->getNEODevice()->getDeviceInfo().debuggerActive) && (nullptr == device->getL0Debugger());
+    inputArgs.allowMappedCachedBinary = true;
     NEO::TranslationOutput compilerOuput = {};
     auto compilerErr = compilerInterface->build(*device->getNEODevice(), inputArgs, compilerOuput);
     this->updateBuildLog(compilerOuput.frontendCompilerLog);
@@ -142,6 +149,8 @@ bool ModuleTranslationUnit::buildFromSpirV(const char *input, uint32_t inputSize
     this->irBinarySize = compilerOuput.intermediateRepresentation.size;
     this->unpackedDeviceBinary = std::move(compilerOuput.deviceBinary.mem);
     this->unpackedDeviceBinarySize = compilerOuput.deviceBinary.size;
+    this->mappedDeviceBinary = std::move(compilerOuput.mappedDeviceBinary);
+    this->cachedFileHash = std::move(compilerOuput.cachedFileHash);
     this->debugData = std::move(compilerOuput.debugData.mem);
     this->debugDataSize = compilerOuput.debugData.size;
 
@@ -195,27 +204,71 @@ bool ModuleTranslationUnit::createFromNativeBinary(const char *input, size_t inp
     }
 }
 
-bool ModuleTranslationUnit::processUnpackedBinary() {
-    if (0 == unpackedDeviceBinarySize) {
+ArrayRef<const uint8_t> ModuleTranslationUnit::getUnpackedDeviceBinary() const {
+    if (nullptr != this->mappedDeviceBinary) {
+        return this->mappedDeviceBinary->getData();
+    }
+    return ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(this->unpackedDeviceBinary.get()), this->unpackedDeviceBinarySize);
+}
+
+bool ModuleTranslationUnit::loadProgramInfoFromCache(ArrayRef<const uint8_t> deviceBinary) {
+    auto compilerInterface = device->getNEODevice()->getCompilerInterface();
+    if (nullptr == compilerInterface) {
         return false;
     }
-    auto blob = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(this->unpackedDeviceBinary.get()), this->unpackedDeviceBinarySize);
-    NEO::SingleDeviceBinary binary = {};
-    binary.deviceBinary = blob;
-    std::string decodeErrors;
-    std::string decodeWarnings;
 
-    NEO::DecodeError decodeError;
-    NEO::DeviceBinaryFormat singleDeviceBinaryFormat;
-    std::tie(decodeError, singleDeviceBinaryFormat) = NEO::decodeSingleDeviceBinary(programInfo, binary, decodeErrors, decodeWarnings);
-    if (decodeWarnings.empty() == false) {
-        PRINT_DEBUG_STRING(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr, "%s\n", decodeWarnings.c_str());
+    size_t programInfoBlobSize = 0U;
+    auto programInfoBlob = compilerInterface->loadCachedProgramInfo(this->cachedFileHash, programInfoBlobSize);
+    if (nullptr == programInfoBlob) {
+        return false;
     }
 
-    if (NEO::DecodeError::Success != decodeError) {
-        PRINT_DEBUG_STRING(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr, "%s\n", decodeErrors.c_str());
+    return NEO::deserializeProgramInfo(ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(programInfoBlob.get()), programInfoBlobSize), deviceBinary, programInfo);
+}
+
+void ModuleTranslationUnit::storeProgramInfoInCache(ArrayRef<const uint8_t> deviceBinary) {
+    auto compilerInterface = device->getNEODevice()->getCompilerInterface();
+    if (nullptr == compilerInterface) {
+        return;
+    }
+
+    std::vector<uint8_t> programInfoBlob;
+    if (NEO::serializeProgramInfo(programInfo, deviceBinary, programInfoBlob)) {
+        compilerInterface->cacheProgramInfo(this->cachedFileHash, programInfoBlob);
+    }
+}
+
+bool ModuleTranslationUnit::processUnpackedBinary() {
+    auto blob = getUnpackedDeviceBinary();
+    if (blob.empty()) {
         return false;
     }
+    bool programInfoCacheEnabled = (NEO::DebugManager.flags.EnableProgramInfoCache.get() == 1) && (false == this->cachedFileHash.empty());
+    if ((false == programInfoCacheEnabled) || (false == loadProgramInfoFromCache(blob))) {
+        NEO::SingleDeviceBinary binary = {};
+        binary.deviceBinary = blob;
+        std::string decodeErrors;
+        std::string decodeWarnings;
+
+        NEO::DecodeError decodeError;
+        NEO::DeviceBinaryFormat singleDeviceBinaryFormat;
+        {
+            NEO::ScopedTraceEvent traceEvent("decodeBinary", NEO::TraceEvents::Category::compile);
+            std::tie(decodeError, singleDeviceBinaryFormat) = NEO::decodeSingleDeviceBinary(programInfo, binary, decodeErrors, decodeWarnings);
+        }
+        if (decodeWarnings.empty() == false) {
+            PRINT_DEBUG_STRING(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr, "%s\n", decodeWarnings.c_str());
+        }
+
+        if (NEO::DecodeError::Success != decodeError) {
+            PRINT_DEBUG_STRING(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr, "%s\n", decodeErrors.c_str());
+            return false;
+        }
+
+        if (programInfoCacheEnabled) {
+            storeProgramInfoInCache(blob);
+        }
+    }
 
     processDebugData();
 
@@ -270,7 +323,7 @@ bool ModuleTranslationUnit::processUnpackedBinary() {
     singleDeviceBinary.buildOptions = this->options;
     singleDeviceBinary.targetDevice.coreFamily = gfxCore;
     singleDeviceBinary.targetDevice.stepping = stepping;
-    singleDeviceBinary.deviceBinary = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(this->unpackedDeviceBinary.get()), this->unpackedDeviceBinarySize);
+    singleDeviceBinary.deviceBinary = blob;
     singleDeviceBinary.intermediateRepresentation = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(this->irBinary.get()), this->irBinarySize);
     singleDeviceBinary.debugData = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(this->debugData.get()), this->debugDataSize);
     std::string packWarnings;
@@ -341,7 +394,13 @@ ModuleImp::ModuleImp(Device *device, ModuleBuildLog *moduleBuildLog, ModuleType
 }
 
 ModuleImp::~ModuleImp() {
+    for (auto &kernelImmData : kernelImmDatas) {
+        device->getNEODevice()->unregisterKernelPerThreadScratchSize(kernelImmData->getDescriptor().kernelAttributes.perThreadScratchSize[0]);
+    }
     kernelImmDatas.clear();
+    for (auto isaHeap : isaHeaps) {
+        device->getNEODevice()->getMemoryManager()->freeGraphicsMemory(isaHeap);
+    }
 }
 
 bool ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neoDevice) {
@@ -366,6 +425,12 @@ bool ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neoDevice)
         return false;
     }
 
+    if (success && (desc->format == ZE_MODULE_FORMAT_IL_SPIRV) &&
+        (NEO::DebugManager.flags.EnableAutoLargeGrfSelection.get() == 1) &&
+        (false == NEO::CompilerOptions::contains(internalBuildOptions, NEO::CompilerOptions::largeGrf))) {
+        selectLargeGrfVariant(desc, buildOptions, internalBuildOptions);
+    }
+
     verifyDebugCapabilities();
 
     this->updateBuildLog(neoDevice);
@@ -374,13 +439,33 @@ bool ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neoDevice)
         return false;
     }
 
-    kernelImmDatas.reserve(this->translationUnit->programInfo.kernelInfos.size());
-    for (auto &ki : this->translationUnit->programInfo.kernelInfos) {
+    auto &kernelInfos = this->translationUnit->programInfo.kernelInfos;
+    kernelImmDatas.reserve(kernelInfos.size());
+    for (auto &kernelInfo : kernelInfos) {
         std::unique_ptr<KernelImmutableData> kernelImmData{new KernelImmutableData(this->device)};
-        kernelImmData->initialize(ki, device, device->getNEODevice()->getDeviceInfo().computeUnitsUsedForScratch,
-                                  this->translationUnit->globalConstBuffer, this->translationUnit->globalVarBuffer,
-                                  this->type == ModuleType::Builtin);
+        kernelImmData->setKernelInfo(kernelInfo);
         kernelImmDatas.push_back(std::move(kernelImmData));
+        device->getNEODevice()->registerKernelPerThreadScratchSize(kernelInfo->kernelDescriptor.kernelAttributes.perThreadScratchSize[0]);
+    }
+
+    lazyKernelIsaUpload = (NEO::DebugManager.flags.EnableLazyKernelIsaUpload.get() == 1) &&
+                          (nullptr == device->getNEODevice()->getDebugger()) &&
+                          (this->type != ModuleType::Builtin);
+    if (lazyKernelIsaUpload) {
+        auto &linkerInput = this->translationUnit->programInfo.linkerInput;
+        if (linkerInput && linkerInput->getExportedFunctionsSegmentId() >= 0) {
+            initializeKernelImmutableData(static_cast<size_t>(linkerInput->getExportedFunctionsSegmentId()));
+        }
+    } else {
+        NEO::ScopedTraceEvent traceEvent("isaUpload", NEO::TraceEvents::Category::compile);
+        if ((NEO::DebugManager.flags.EnableSharedModuleIsaAllocation.get() == 1) &&
+            (nullptr == device->getNEODevice()->getDebugger())) {
+            createSharedIsaAllocations();
+        }
+        auto workersCount = (nullptr != device->getNEODevice()->getDebugger()) ? 1u : NEO::getKernelAllocationWorkersCount(*device->getNEODevice(), kernelInfos.size());
+        NEO::ParallelFor::run(kernelInfos.size(), workersCount, [this](size_t kernelId) {
+            initializeKernelImmutableData(kernelId);
+        });
     }
     this->maxGroupSize = static_cast<uint32_t>(this->translationUnit->device->getNEODevice()->getDeviceInfo().maxWorkGroupSize);
 
@@ -412,12 +497,97 @@ bool ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neoDevice)
 const KernelImmutableData *ModuleImp::getKernelImmutableData(const char *functionName) const {
     for (auto &kernelImmData : kernelImmDatas) {
         if (kernelImmData->getDescriptor().kernelMetadata.kernelName.compare(functionName) == 0) {
+            if (lazyKernelIsaUpload) {
+                std::lock_guard<std::mutex> lock(kernelInitializationMutex);
+                if (false == kernelImmData->isInitialized()) {
+                    initializeKernelImmutableData(static_cast<size_t>(&kernelImmData - &kernelImmDatas[0]));
+                }
+            }
             return kernelImmData.get();
         }
     }
     return nullptr;
 }
 
+void ModuleImp::createSharedIsaAllocations() {
+    auto &kernelInfos = this->translationUnit->programInfo.kernelInfos;
+    std::vector<size_t> isaHeapSizes;
+    std::vector<std::pair<size_t, uint64_t>> isaPlacements;
+    isaPlacements.reserve(kernelInfos.size());
+    for (auto &kernelInfo : kernelInfos) {
+        size_t kernelIsaSize = kernelInfo->heapInfo.KernelHeapSize;
+        if (isaHeapSizes.empty() ||
+            ((isaHeapSizes.back() != 0u) && (alignUp(isaHeapSizes.back(), isaSubAllocationAlignment) + kernelIsaSize > maxIsaHeapSize))) {
+            isaHeapSizes.push_back(0u);
+        }
+        auto offset = alignUp(isaHeapSizes.back(), isaSubAllocationAlignment);
+        isaPlacements.push_back({isaHeapSizes.size() - 1, offset});
+        isaHeapSizes.back() = offset + kernelIsaSize;
+    }
+
+    auto neoDevice = device->getNEODevice();
+    const auto allocType = (this->type == ModuleType::Builtin) ? NEO::GraphicsAllocation::AllocationType::KERNEL_ISA_INTERNAL : NEO::GraphicsAllocation::AllocationType::KERNEL_ISA;
+    isaHeaps.reserve(isaHeapSizes.size());
+    for (auto isaHeapSize : isaHeapSizes) {
+        auto isaHeap = neoDevice->getMemoryManager()->allocateGraphicsMemoryWithProperties(
+            {neoDevice->getRootDeviceIndex(), isaHeapSize, allocType, neoDevice->getDeviceBitfield()});
+        UNRECOVERABLE_IF(isaHeap == nullptr);
+        isaHeaps.push_back(isaHeap);
+    }
+
+    for (size_t kernelId = 0u; kernelId < kernelInfos.size(); kernelId++) {
+        kernelImmDatas[kernelId]->setIsaParentAllocation(isaHeaps[isaPlacements[kernelId].first], isaPlacements[kernelId].second,
+                                                         kernelInfos[kernelId]->heapInfo.KernelHeapSize);
+    }
+}
+
+void ModuleImp::initializeKernelImmutableData(size_t kernelId) const {
+    auto kernelImmData = kernelImmDatas[kernelId].get();
+    kernelImmData->initialize(this->translationUnit->programInfo.kernelInfos[kernelId], device, device->getNEODevice()->getDeviceInfo().computeUnitsUsedForScratch,
+                              this->translationUnit->globalConstBuffer, this->translationUnit->globalVarBuffer,
+                              this->type == ModuleType::Builtin);
+
+    if (false == patchedIsaStorage.empty()) {
+        this->device->getDriverHandle()->getMemoryManager()->copyMemoryToAllocation(kernelImmData->getIsaGraphicsAllocation(),
+                                                                                    static_cast<size_t>(kernelImmData->getIsaOffsetInParentAllocation()),
+                                                                                    patchedIsaStorage[kernelId].data(),
+                                                                                    patchedIsaStorage[kernelId].size());
+    }
+}
+
+static uint64_t getTotalPerThreadScratchSize(const NEO::ProgramInfo &programInfo) {
+    uint64_t totalScratchSize = 0u;
+    for (auto &kernelInfo : programInfo.kernelInfos) {
+        totalScratchSize += kernelInfo->kernelDescriptor.kernelAttributes.perThreadScratchSize[0];
+    }
+    return totalScratchSize;
+}
+
+std::unique_ptr<ModuleTranslationUnit> ModuleImp::createTranslationUnit() {
+    return std::make_unique<ModuleTranslationUnit>(this->device);
+}
+
+void ModuleImp::selectLargeGrfVariant(const ze_module_desc_t *desc, const std::string &buildOptions, const std::string &internalBuildOptions) {
+    // scratch use of a default GRF build is register spill; the large GRF build halves EU thread occupancy,
+    // so it is kept only when it actually spills less. Both variants land in the compiler cache.
+    auto defaultGrfScratchSize = getTotalPerThreadScratchSize(this->translationUnit->programInfo);
+    if (defaultGrfScratchSize == 0u) {
+        return;
+    }
+
+    NEO::ScopedTraceEvent traceEvent("largeGrfBuild", NEO::TraceEvents::Category::compile);
+    auto largeGrfTranslationUnit = createTranslationUnit();
+    auto largeGrfInternalBuildOptions = NEO::CompilerOptions::concatenate(internalBuildOptions, NEO::CompilerOptions::largeGrf);
+    auto success = largeGrfTranslationUnit->buildFromSpirV(reinterpret_cast<const char *>(desc->pInputModule),
+                                                           static_cast<uint32_t>(desc->inputSize),
+                                                           buildOptions.c_str(),
+                                                           largeGrfInternalBuildOptions.c_str(),
+                                                           desc->pConstants);
+    if (success && (getTotalPerThreadScratchSize(largeGrfTranslationUnit->programInfo) < defaultGrfScratchSize)) {
+        this->translationUnit = std::move(largeGrfTranslationUnit);
+    }
+}
+
 void ModuleImp::createBuildOptions(const char *pBuildFlags, std::string &apiOptions, std::string &internalBuildOptions) {
     if (pBuildFlags != nullptr) {
         std::string buildFlags(pBuildFlags);
@@ -425,6 +595,7 @@ void ModuleImp::createBuildOptions(const char *pBuildFlags, std::string &apiOpti
         apiOptions = pBuildFlags;
         moveBuildOption(apiOptions, apiOptions, NEO::CompilerOptions::optDisable, BuildOptions::optDisable);
         moveBuildOption(internalBuildOptions, apiOptions, NEO::CompilerOptions::greaterThan4gbBuffersRequired, BuildOptions::greaterThan4GbRequired);
+        moveBuildOption(internalBuildOptions, apiOptions, NEO::CompilerOptions::largeGrf, BuildOptions::largeGrf);
         moveBuildOption(internalBuildOptions, apiOptions, NEO::CompilerOptions::allowZebin, NEO::CompilerOptions::allowZebin);
 
         createBuildExtraOptions(apiOptions, internalBuildOptions);
@@ -484,7 +655,8 @@ void ModuleImp::copyPatchedSegments(const NEO::Linker::PatchableSegments &isaSeg
                 continue;
             }
             auto segmentId = &kernelImmData - &this->kernelImmDatas[0];
-            this->device->getDriverHandle()->getMemoryManager()->copyMemoryToAllocation(kernelImmData->getIsaGraphicsAllocation(), 0,
+            this->device->getDriverHandle()->getMemoryManager()->copyMemoryToAllocation(kernelImmData->getIsaGraphicsAllocation(),
+                                                                                        static_cast<size_t>(kernelImmData->getIsaOffsetInParentAllocation()),
                                                                                         isaSegmentsForPatching[segmentId].hostPointer,
                                                                                         isaSegmentsForPatching[segmentId].segmentSize);
         }
@@ -493,6 +665,7 @@ void ModuleImp::copyPatchedSegments(const NEO::Linker::PatchableSegments &isaSeg
 
 bool ModuleImp::linkBinary() {
     using namespace NEO;
+    ScopedTraceEvent traceEvent("linkBinary", TraceEvents::Category::compile);
     if (this->translationUnit->programInfo.linkerInput == nullptr) {
         isFullyLinked = true;
         return true;
@@ -513,9 +686,10 @@ bool ModuleImp::linkBinary() {
     }
     if (this->translationUnit->programInfo.linkerInput->getExportedFunctionsSegmentId() >= 0) {
         auto exportedFunctionHeapId = this->translationUnit->programInfo.linkerInput->getExportedFunctionsSegmentId();
-        this->exportedFunctionsSurface = this->kernelImmDatas[exportedFunctionHeapId]->getIsaGraphicsAllocation();
-        exportedFunctions.gpuAddress = static_cast<uintptr_t>(exportedFunctionsSurface->getGpuAddressToPatch());
-        exportedFunctions.segmentSize = exportedFunctionsSurface->getUnderlyingBufferSize();
+        auto &exportedFunctionsImmData = this->kernelImmDatas[exportedFunctionHeapId];
+        this->exportedFunctionsSurface = exportedFunctionsImmData->getIsaGraphicsAllocation();
+        exportedFunctions.gpuAddress = static_cast<uintptr_t>(exportedFunctionsSurface->getGpuAddressToPatch() + exportedFunctionsImmData->getIsaOffsetInParentAllocation());
+        exportedFunctions.segmentSize = exportedFunctionsImmData->getIsaSize();
     }
     Linker::PatchableSegments isaSegmentsForPatching;
     std::vector<std::vector<char>> patchedIsaTempStorage;
@@ -544,9 +718,17 @@ bool ModuleImp::linkBinary() {
             auto error = constructLinkerErrorMessage(unresolvedExternalsInfo, kernelNames);
             moduleBuildLog->appendString(error.c_str(), error.size());
         }
-        return LinkingStatus::LinkedPartially == linkStatus;
+        if (LinkingStatus::LinkedPartially == linkStatus) {
+            // keep the ISA with the resolved relocations applied, a dynamic link then patches only the unresolved externals
+            this->patchedIsaStorage = std::move(patchedIsaTempStorage);
+            return true;
+        }
+        return false;
     } else {
         copyPatchedSegments(isaSegmentsForPatching);
+        if (lazyKernelIsaUpload) {
+            this->patchedIsaStorage = std::move(patchedIsaTempStorage);
+        }
     }
     DBG_LOG(PrintRelocations, NEO::constructRelocationsDebugMessage(this->symbols));
     isFullyLinked = true;
@@ -656,6 +838,9 @@ ze_result_t ModuleImp::getProperties(ze_module_properties_t *pModuleProperties)
 ze_result_t ModuleImp::performDynamicLink(uint32_t numModules,
                                           ze_module_handle_t *phModules,
                                           ze_module_build_log_handle_t *phLinkLog) {
+    // symbols exported by the linked modules, built once per call; the first module exporting a name wins
+    std::unordered_map<std::string, std::pair<const NEO::Linker::RelocatedSymbol *, ModuleImp *>> exportedSymbols;
+    bool exportedSymbolsCollected = false;
 
     for (auto i = 0u; i < numModules; i++) {
         auto moduleId = static_cast<ModuleImp *>(Module::fromHandle(phModules[i]));
@@ -663,37 +848,52 @@ ze_result_t ModuleImp::performDynamicLink(uint32_t numModules,
             continue;
         }
         NEO::Linker::PatchableSegments isaSegmentsForPatching;
-        std::vector<std::vector<char>> patchedIsaTempStorage;
-        uint32_t numPatchedSymbols = 0u;
         if (moduleId->translationUnit->programInfo.linkerInput && moduleId->translationUnit->programInfo.linkerInput->getTraits().requiresPatchingOfInstructionSegments) {
-            patchedIsaTempStorage.reserve(moduleId->kernelImmDatas.size());
-            for (const auto &kernelInfo : moduleId->translationUnit->programInfo.kernelInfos) {
-                auto &kernHeapInfo = kernelInfo->heapInfo;
-                const char *originalIsa = reinterpret_cast<const char *>(kernHeapInfo.pKernelHeap);
-                patchedIsaTempStorage.push_back(std::vector<char>(originalIsa, originalIsa + kernHeapInfo.KernelHeapSize));
-                isaSegmentsForPatching.push_back(NEO::Linker::PatchableSegment{patchedIsaTempStorage.rbegin()->data(), kernHeapInfo.KernelHeapSize});
+            if (moduleId->patchedIsaStorage.empty()) {
+                moduleId->patchedIsaStorage.reserve(moduleId->kernelImmDatas.size());
+                for (const auto &kernelInfo : moduleId->translationUnit->programInfo.kernelInfos) {
+                    auto &kernHeapInfo = kernelInfo->heapInfo;
+                    const char *originalIsa = reinterpret_cast<const char *>(kernHeapInfo.pKernelHeap);
+                    moduleId->patchedIsaStorage.push_back(std::vector<char>(originalIsa, originalIsa + kernHeapInfo.KernelHeapSize));
+                }
             }
-            for (const auto &unresolvedExternal : moduleId->unresolvedExternalsInfo) {
-                for (auto i = 0u; i < numModules; i++) {
-                    auto moduleHandle = static_cast<ModuleImp *>(Module::fromHandle(phModules[i]));
-
-                    auto symbolIt = moduleHandle->symbols.find(unresolvedExternal.unresolvedRelocation.symbolName);
-                    if (symbolIt != moduleHandle->symbols.end()) {
-                        auto relocAddress = ptrOffset(isaSegmentsForPatching[unresolvedExternal.instructionsSegmentId].hostPointer,
-                                                      static_cast<uintptr_t>(unresolvedExternal.unresolvedRelocation.offset));
-
-                        NEO::Linker::patchAddress(relocAddress, symbolIt->second, unresolvedExternal.unresolvedRelocation);
-                        numPatchedSymbols++;
-                        moduleId->importedSymbolAllocations.insert(moduleHandle->exportedFunctionsSurface);
-                        break;
+            for (auto &isa : moduleId->patchedIsaStorage) {
+                isaSegmentsForPatching.push_back(NEO::Linker::PatchableSegment{isa.data(), isa.size()});
+            }
+
+            if (false == exportedSymbolsCollected) {
+                for (auto j = 0u; j < numModules; j++) {
+                    auto moduleHandle = static_cast<ModuleImp *>(Module::fromHandle(phModules[j]));
+                    for (const auto &symbol : moduleHandle->symbols) {
+                        exportedSymbols.emplace(symbol.first, std::make_pair(&symbol.second, moduleHandle));
                     }
                 }
+                exportedSymbolsCollected = true;
             }
+
+            // externals resolved here stay patched in the kept ISA, so a later link only retries the remaining ones
+            NEO::Linker::UnresolvedExternals remainingExternals;
+            for (const auto &unresolvedExternal : moduleId->unresolvedExternalsInfo) {
+                auto symbolIt = exportedSymbols.find(unresolvedExternal.unresolvedRelocation.symbolName);
+                if (symbolIt == exportedSymbols.end()) {
+                    remainingExternals.push_back(unresolvedExternal);
+                    continue;
+                }
+                auto relocAddress = ptrOffset(isaSegmentsForPatching[unresolvedExternal.instructionsSegmentId].hostPointer,
+                                              static_cast<uintptr_t>(unresolvedExternal.unresolvedRelocation.offset));
+
+                NEO::Linker::patchAddress(relocAddress, *symbolIt->second.first, unresolvedExternal.unresolvedRelocation);
+                moduleId->importedSymbolAllocations.insert(symbolIt->second.second->exportedFunctionsSurface);
+            }
+            moduleId->unresolvedExternalsInfo = std::move(remainingExternals);
         }
-        if (numPatchedSymbols != moduleId->unresolvedExternalsInfo.size()) {
+        if (false == moduleId->unresolvedExternalsInfo.empty()) {
             return ZE_RESULT_ERROR_MODULE_LINK_FAILURE;
         }
         moduleId->copyPatchedSegments(isaSegmentsForPatching);
+        if (false == moduleId->lazyKernelIsaUpload) {
+            moduleId->patchedIsaStorage.clear();
+        }
         moduleId->isFullyLinked = true;
     }
     return ZE_RESULT_SUCCESS;
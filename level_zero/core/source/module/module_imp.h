@@ -9,6 +9,7 @@
 
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/compiler_interface/linker.h"
+#include "shared/source/helpers/constants.h"
 #include "shared/source/program/program_info.h"
 #include "shared/source/utilities/const_stringref.h"
 
@@ -18,13 +19,16 @@
 #include "igfxfmid.h"
 
 #include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 namespace L0 {
 
 namespace BuildOptions {
 extern NEO::ConstStringRef optDisable;
 extern NEO::ConstStringRef greaterThan4GbRequired;
+extern NEO::ConstStringRef largeGrf;
 extern NEO::ConstStringRef hasBufferOffsetArg;
 extern NEO::ConstStringRef debugKernelEnable;
 } // namespace BuildOptions
@@ -38,6 +42,9 @@ struct ModuleTranslationUnit {
     MOCKABLE_VIRTUAL bool processUnpackedBinary();
     void updateBuildLog(const std::string &newLogEntry);
     void processDebugData();
+    ArrayRef<const uint8_t> getUnpackedDeviceBinary() const;
+    bool loadProgramInfoFromCache(ArrayRef<const uint8_t> deviceBinary);
+    void storeProgramInfoInCache(ArrayRef<const uint8_t> deviceBinary);
     L0::Device *device = nullptr;
 
     NEO::GraphicsAllocation *globalConstBuffer = nullptr;
@@ -53,6 +60,8 @@ struct ModuleTranslationUnit {
 
     std::unique_ptr<char[]> unpackedDeviceBinary;
     size_t unpackedDeviceBinarySize = 0U;
+    std::unique_ptr<NEO::MappedFile> mappedDeviceBinary;
+    std::string cachedFileHash;
 
     std::unique_ptr<char[]> packedDeviceBinary;
     size_t packedDeviceBinarySize = 0U;
@@ -65,6 +74,9 @@ struct ModuleTranslationUnit {
 };
 
 struct ModuleImp : public Module {
+    static constexpr size_t isaSubAllocationAlignment = MemoryConstants::cacheLineSize;
+    static constexpr size_t maxIsaHeapSize = 2 * MemoryConstants::megaByte;
+
     ModuleImp() = delete;
 
     ModuleImp(Device *device, ModuleBuildLog *moduleBuildLog, ModuleType type);
@@ -120,6 +132,10 @@ struct ModuleImp : public Module {
   protected:
     void copyPatchedSegments(const NEO::Linker::PatchableSegments &isaSegmentsForPatching);
     void verifyDebugCapabilities();
+    void selectLargeGrfVariant(const ze_module_desc_t *desc, const std::string &buildOptions, const std::string &internalBuildOptions);
+    MOCKABLE_VIRTUAL std::unique_ptr<ModuleTranslationUnit> createTranslationUnit();
+    void initializeKernelImmutableData(size_t kernelId) const;
+    void createSharedIsaAllocations();
 
     Device *device = nullptr;
     PRODUCT_FAMILY productFamily{};
@@ -134,6 +150,10 @@ struct ModuleImp : public Module {
     ModuleType type;
     NEO::Linker::UnresolvedExternals unresolvedExternalsInfo{};
     std::set<NEO::GraphicsAllocation *> importedSymbolAllocations{};
+    bool lazyKernelIsaUpload = false;
+    mutable std::mutex kernelInitializationMutex;
+    std::vector<std::vector<char>> patchedIsaStorage;
+    std::vector<NEO::GraphicsAllocation *> isaHeaps;
 };
 
 bool moveBuildOption(std::string &dstOptionsSet, std::string &srcOptionSet, NEO::ConstStringRef dstOptionName, NEO::ConstStringRef srcOptionName);
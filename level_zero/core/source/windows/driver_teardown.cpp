@@ -1,10 +1,12 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
+#include "shared/source/utilities/trace_events.h"
+
 #include "level_zero/core/source/driver/driver_handle_imp.h"
 
 #include <windows.h>
@@ -17,6 +19,7 @@ BOOL APIENTRY DllMain(HINSTANCE hinstDLL, DWORD fdwReason, LPVOID lpvReserved) {
             delete GlobalDriver;
             GlobalDriver = nullptr;
         }
+        NEO::TraceEvents::destroy();
     }
     return TRUE;
 }
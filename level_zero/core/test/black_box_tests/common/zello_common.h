@@ -7,6 +7,9 @@
 
 #include <level_zero/ze_api.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
 #include <cstring>
 #include <fstream>
 #include <iostream>
@@ -54,6 +57,57 @@ inline bool isParamEnabled(int argc, char *argv[], const char *shortName, const
     return false;
 }
 
+inline const char *getParamString(int argc, char *argv[], const char *shortName, const char *longName) {
+    for (int i = 1; i < argc - 1; i++) {
+        if ((0 == strcmp(argv[i], shortName)) || (0 == strcmp(argv[i], longName))) {
+            return argv[i + 1];
+        }
+    }
+    return nullptr;
+}
+
+template <typename T>
+inline T getParamValue(int argc, char *argv[], const char *shortName, const char *longName, T defaultValue) {
+    auto value = getParamString(argc, argv, shortName, longName);
+    if (value == nullptr) {
+        return defaultValue;
+    }
+    return static_cast<T>(std::strtoull(value, nullptr, 10));
+}
+
+inline double toMicroseconds(std::chrono::steady_clock::duration duration) {
+    return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+inline double median(std::vector<double> &samples) {
+    std::sort(samples.begin(), samples.end());
+    return samples[samples.size() / 2];
+}
+
+inline double percentile(const std::vector<double> &sortedSamples, double fraction) {
+    auto index = static_cast<size_t>(fraction * static_cast<double>(sortedSamples.size() - 1));
+    return sortedSamples[index];
+}
+
+// returns the string value of a "key":"value" pair from a single line of JSON
+inline std::string getJsonString(const std::string &line, const char *key) {
+    auto start = line.find(key);
+    if (start == std::string::npos) {
+        return "";
+    }
+    start += strlen(key);
+    return line.substr(start, line.find('"', start) - start);
+}
+
+// prints the benchmark results and also writes them to the file given with -o / --output
+inline void writeBenchmarkOutput(int argc, char *argv[], const std::string &json) {
+    std::cout << json;
+    auto outputFile = getParamString(argc, argv, "-o", "--output");
+    if (outputFile) {
+        std::ofstream(outputFile) << json;
+    }
+}
+
 inline bool isVerbose(int argc, char *argv[]) {
     bool enabled = isParamEnabled(argc, argv, "-v", "--verbose");
     if (enabled == false) {
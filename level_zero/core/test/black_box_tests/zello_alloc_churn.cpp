@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "zello_common.h"
+
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+
+extern bool verbose;
+bool verbose = false;
+
+// Measures zeMemAllocDevice and zeMemFree latency distributions over allocation sizes and reports them as JSON.
+// In the used mode every allocation is filled on a synchronous immediate command list right before it is freed,
+// so the free hits an allocation that has been made resident and used by the GPU. The fill is complete before
+// zeMemFree is called, as freeing memory still in use by the device is not allowed.
+
+using Clock = std::chrono::steady_clock;
+
+struct Result {
+    std::string operation;
+    std::string mode;
+    size_t size;
+    double p50Us;
+    double p99Us;
+    double p999Us;
+};
+
+void addResults(std::vector<Result> &results, const char *mode, size_t size, std::vector<double> &allocSamples, std::vector<double> &freeSamples) {
+    std::sort(allocSamples.begin(), allocSamples.end());
+    std::sort(freeSamples.begin(), freeSamples.end());
+    results.push_back({"alloc", mode, size, percentile(allocSamples, 0.5), percentile(allocSamples, 0.99), percentile(allocSamples, 0.999)});
+    results.push_back({"free", mode, size, percentile(freeSamples, 0.5), percentile(freeSamples, 0.99), percentile(freeSamples, 0.999)});
+}
+
+void measureChurn(ze_context_handle_t context, ze_device_handle_t device, ze_command_list_handle_t usedCmdList,
+                  size_t size, uint32_t iterations, std::vector<Result> &results) {
+    ze_device_mem_alloc_desc_t deviceDesc = {ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC};
+    std::vector<double> allocSamples;
+    std::vector<double> freeSamples;
+    uint8_t pattern = 0xa5;
+
+    for (uint32_t i = 0; i < iterations; i++) {
+        void *ptr = nullptr;
+        auto start = Clock::now();
+        SUCCESS_OR_TERMINATE(zeMemAllocDevice(context, &deviceDesc, size, 0u, device, &ptr));
+        allocSamples.push_back(toMicroseconds(Clock::now() - start));
+
+        if (usedCmdList) {
+            SUCCESS_OR_TERMINATE(zeCommandListAppendMemoryFill(usedCmdList, ptr, &pattern, sizeof(pattern), size, nullptr, 0, nullptr));
+        }
+
+        start = Clock::now();
+        SUCCESS_OR_TERMINATE(zeMemFree(context, ptr));
+        freeSamples.push_back(toMicroseconds(Clock::now() - start));
+    }
+    addResults(results, usedCmdList ? "used" : "idle", size, allocSamples, freeSamples);
+}
+
+std::string toJson(const std::vector<Result> &results, uint32_t iterations) {
+    std::ostringstream json;
+    json << "{\"benchmark\":\"zello_alloc_churn\",\"api\":\"level_zero\",\"unit\":\"us\",\"iterations\":" << iterations << ",\"results\":[";
+    for (size_t i = 0; i < results.size(); i++) {
+        json << (i ? "," : "") << "\n{\"operation\":\"" << results[i].operation << "\",\"mode\":\"" << results[i].mode
+             << "\",\"size\":" << results[i].size << ",\"p50\":" << results[i].p50Us << ",\"p99\":" << results[i].p99Us
+             << ",\"p999\":" << results[i].p999Us << "}";
+    }
+    json << "\n]}\n";
+    return json.str();
+}
+
+int main(int argc, char *argv[]) {
+    verbose = isVerbose(argc, argv);
+    auto iterations = std::max(getParamValue(argc, argv, "-i", "--iterations", 10000u), 1u);
+
+    ze_context_handle_t context = nullptr;
+    auto devices = zelloInitContextAndGetDevices(context);
+    auto device = devices[0];
+
+    ze_device_properties_t deviceProperties = {ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES};
+    SUCCESS_OR_TERMINATE(zeDeviceGetProperties(device, &deviceProperties));
+
+    ze_command_queue_desc_t queueDesc = {ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC};
+    queueDesc.ordinal = getCommandQueueOrdinal(device);
+    queueDesc.mode = ZE_COMMAND_QUEUE_MODE_SYNCHRONOUS;
+    ze_command_list_handle_t usedCmdList;
+    SUCCESS_OR_TERMINATE(zeCommandListCreateImmediate(context, device, &queueDesc, &usedCmdList));
+
+    const size_t sizes[] = {64u, 4096u, 64u * 1024u, 1024u * 1024u, 16u * 1024u * 1024u};
+    std::vector<Result> results;
+    for (auto size : sizes) {
+        if (size > deviceProperties.maxMemAllocSize) {
+            continue;
+        }
+        // warm up, so the first touch of every heap stays out of the samples
+        std::vector<Result> warmUp;
+        measureChurn(context, device, nullptr, size, 10u, warmUp);
+
+        measureChurn(context, device, nullptr, size, iterations, results);
+        measureChurn(context, device, usedCmdList, size, iterations, results);
+        if (verbose) {
+            std::cerr << size << " : idle alloc p50 " << results[results.size() - 4].p50Us << " us, used free p99 " << results.back().p99Us << " us\n";
+        }
+    }
+
+    SUCCESS_OR_TERMINATE(zeCommandListDestroy(usedCmdList));
+    SUCCESS_OR_TERMINATE(zeContextDestroy(context));
+
+    writeBenchmarkOutput(argc, argv, toJson(results, iterations));
+    return 0;
+}
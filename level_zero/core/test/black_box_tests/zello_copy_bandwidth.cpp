@@ -0,0 +1,219 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "zello_common.h"
+
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+
+extern bool verbose;
+bool verbose = false;
+
+// Sweeps transfer sizes over every memory kind pair and engine and reports the achieved bandwidth as JSON.
+// Copies on the compute queue group are executed with builtin kernels, the copy-only group uses the blitter
+// and the cpu engine is a plain memcpy, measured only when both sides are host accessible.
+
+using Clock = std::chrono::steady_clock;
+constexpr size_t memoryAlignment = 4096u;
+
+enum class MemoryKind {
+    device,
+    hostUsm,
+    sharedUsm,
+    userPtr
+};
+
+const char *getMemoryKindName(MemoryKind kind) {
+    switch (kind) {
+    case MemoryKind::device:
+        return "device";
+    case MemoryKind::hostUsm:
+        return "host_usm";
+    case MemoryKind::sharedUsm:
+        return "shared_usm";
+    default:
+        return "userptr";
+    }
+}
+
+bool isHostAccessible(MemoryKind kind) {
+    return kind != MemoryKind::device;
+}
+
+struct Engine {
+    std::string name;
+    uint32_t ordinal;
+    bool cpu;
+    ze_command_list_handle_t cmdList = nullptr;
+};
+
+struct Result {
+    std::string transfer;
+    std::string engine;
+    size_t size;
+    double bandwidthGBps;
+};
+
+void *allocate(ze_context_handle_t context, ze_device_handle_t device, MemoryKind kind, size_t size) {
+    void *ptr = nullptr;
+    ze_device_mem_alloc_desc_t deviceDesc = {ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC};
+    ze_host_mem_alloc_desc_t hostDesc = {ZE_STRUCTURE_TYPE_HOST_MEM_ALLOC_DESC};
+    switch (kind) {
+    case MemoryKind::device:
+        SUCCESS_OR_TERMINATE(zeMemAllocDevice(context, &deviceDesc, size, memoryAlignment, device, &ptr));
+        break;
+    case MemoryKind::hostUsm:
+        SUCCESS_OR_TERMINATE(zeMemAllocHost(context, &hostDesc, size, memoryAlignment, &ptr));
+        break;
+    case MemoryKind::sharedUsm:
+        SUCCESS_OR_TERMINATE(zeMemAllocShared(context, &deviceDesc, &hostDesc, size, memoryAlignment, device, &ptr));
+        break;
+    default:
+        ptr = new char[size];
+        break;
+    }
+    return ptr;
+}
+
+void release(ze_context_handle_t context, MemoryKind kind, void *ptr) {
+    if (kind == MemoryKind::userPtr) {
+        delete[] static_cast<char *>(ptr);
+        return;
+    }
+    SUCCESS_OR_TERMINATE(zeMemFree(context, ptr));
+}
+
+uint32_t getIterations(size_t size) {
+    constexpr size_t bytesPerMeasurement = 256u * 1024u * 1024u;
+    return static_cast<uint32_t>(std::min<size_t>(std::max<size_t>(bytesPerMeasurement / size, 4u), 1000u));
+}
+
+double measureBandwidth(Engine &engine, void *dst, const void *src, size_t size) {
+    auto iterations = getIterations(size);
+    if (!engine.cpu) {
+        // warm up, so residency and state setup stay out of the measurement
+        SUCCESS_OR_TERMINATE(zeCommandListAppendMemoryCopy(engine.cmdList, dst, src, size, nullptr, 0, nullptr));
+    }
+    auto start = Clock::now();
+    for (uint32_t i = 0; i < iterations; i++) {
+        if (engine.cpu) {
+            memcpy(dst, src, size);
+        } else {
+            SUCCESS_OR_TERMINATE(zeCommandListAppendMemoryCopy(engine.cmdList, dst, src, size, nullptr, 0, nullptr));
+        }
+    }
+    auto seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    return static_cast<double>(size) * iterations / seconds / 1e9;
+}
+
+std::vector<Engine> getEngines(ze_context_handle_t context, ze_device_handle_t device) {
+    std::vector<Engine> engines;
+    uint32_t numQueueGroups = 0;
+    SUCCESS_OR_TERMINATE(zeDeviceGetCommandQueueGroupProperties(device, &numQueueGroups, nullptr));
+    std::vector<ze_command_queue_group_properties_t> queueProperties(numQueueGroups);
+    SUCCESS_OR_TERMINATE(zeDeviceGetCommandQueueGroupProperties(device, &numQueueGroups, queueProperties.data()));
+
+    bool computeFound = false;
+    bool copyFound = false;
+    for (uint32_t i = 0; i < numQueueGroups; i++) {
+        if ((queueProperties[i].flags & ZE_COMMAND_QUEUE_GROUP_PROPERTY_FLAG_COMPUTE) && !computeFound) {
+            engines.push_back({"compute", i, false});
+            computeFound = true;
+        } else if ((queueProperties[i].flags & ZE_COMMAND_QUEUE_GROUP_PROPERTY_FLAG_COPY) && !copyFound) {
+            engines.push_back({"copy", i, false});
+            copyFound = true;
+        }
+    }
+    for (auto &engine : engines) {
+        ze_command_queue_desc_t descriptor = {ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC};
+        descriptor.ordinal = engine.ordinal;
+        descriptor.mode = ZE_COMMAND_QUEUE_MODE_SYNCHRONOUS;
+        SUCCESS_OR_TERMINATE(zeCommandListCreateImmediate(context, device, &descriptor, &engine.cmdList));
+    }
+    engines.push_back({"cpu", 0u, true});
+    return engines;
+}
+
+std::string toJson(const std::vector<Result> &results) {
+    std::ostringstream json;
+    json << "{\"benchmark\":\"zello_copy_bandwidth\",\"api\":\"level_zero\",\"unit\":\"GB/s\",\"results\":[";
+    for (size_t i = 0; i < results.size(); i++) {
+        json << (i ? "," : "") << "\n{\"transfer\":\"" << results[i].transfer << "\",\"engine\":\"" << results[i].engine
+             << "\",\"size\":" << results[i].size << ",\"bandwidth\":" << results[i].bandwidthGBps << "}";
+    }
+    json << "\n]}\n";
+    return json.str();
+}
+
+int main(int argc, char *argv[]) {
+    verbose = isVerbose(argc, argv);
+    size_t minSize = getParamValue<size_t>(argc, argv, "-b", "--min-size", 64u);
+    size_t maxSize = getParamValue<size_t>(argc, argv, "-e", "--max-size", 256u * 1024u * 1024u);
+
+    ze_context_handle_t context = nullptr;
+    auto devices = zelloInitContextAndGetDevices(context);
+    auto device = devices[0];
+
+    ze_device_properties_t deviceProperties = {ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES};
+    SUCCESS_OR_TERMINATE(zeDeviceGetProperties(device, &deviceProperties));
+    maxSize = std::min<size_t>(maxSize, deviceProperties.maxMemAllocSize);
+    minSize = std::max<size_t>(std::min(minSize, maxSize), 1u);
+
+    const MemoryKind kinds[] = {MemoryKind::device, MemoryKind::hostUsm, MemoryKind::sharedUsm, MemoryKind::userPtr};
+    const std::pair<MemoryKind, MemoryKind> transfers[] = {
+        {MemoryKind::hostUsm, MemoryKind::device},
+        {MemoryKind::device, MemoryKind::hostUsm},
+        {MemoryKind::device, MemoryKind::device},
+        {MemoryKind::sharedUsm, MemoryKind::device},
+        {MemoryKind::device, MemoryKind::sharedUsm},
+        {MemoryKind::userPtr, MemoryKind::device},
+        {MemoryKind::device, MemoryKind::userPtr},
+        {MemoryKind::hostUsm, MemoryKind::sharedUsm},
+        {MemoryKind::userPtr, MemoryKind::hostUsm},
+    };
+
+    // a source and a destination buffer of the maximal size per kind, so device to device copies do not overlap
+    std::vector<std::pair<void *, void *>> buffers;
+    for (auto kind : kinds) {
+        buffers.push_back({allocate(context, device, kind, maxSize), allocate(context, device, kind, maxSize)});
+    }
+
+    auto engines = getEngines(context, device);
+    std::vector<Result> results;
+    for (auto &transfer : transfers) {
+        auto src = buffers[static_cast<size_t>(transfer.first)].first;
+        auto dst = buffers[static_cast<size_t>(transfer.second)].second;
+        std::string transferName = std::string(getMemoryKindName(transfer.first)) + "_to_" + getMemoryKindName(transfer.second);
+
+        for (auto &engine : engines) {
+            if (engine.cpu && !(isHostAccessible(transfer.first) && isHostAccessible(transfer.second))) {
+                continue;
+            }
+            for (size_t size = minSize; size <= maxSize; size *= 2) {
+                results.push_back({transferName, engine.name, size, measureBandwidth(engine, dst, src, size)});
+                if (verbose) {
+                    std::cerr << transferName << " " << engine.name << " " << size << " : " << results.back().bandwidthGBps << " GB/s\n";
+                }
+            }
+        }
+    }
+
+    for (auto &engine : engines) {
+        if (engine.cmdList) {
+            SUCCESS_OR_TERMINATE(zeCommandListDestroy(engine.cmdList));
+        }
+    }
+    for (size_t i = 0; i < buffers.size(); i++) {
+        release(context, kinds[i], buffers[i].first);
+        release(context, kinds[i], buffers[i].second);
+    }
+    SUCCESS_OR_TERMINATE(zeContextDestroy(context));
+
+    writeBenchmarkOutput(argc, argv, toJson(results));
+    return 0;
+}
@@ -0,0 +1,241 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "zello_common.h"
+#include "zello_compile.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <dirent.h>
+#include <map>
+#include <sstream>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern bool verbose;
+bool verbose = false;
+
+// Loads a corpus of OpenCL C sources (.cl) and SPIR-V modules (.spv) through zeModuleCreate with the compiler
+// cache disabled, cold and warm, and reports wall time per module and driver phases per mode as JSON.
+// Every mode runs in a fresh child process; the phases are taken from the runtime trace (TraceEventsFile).
+// OpenCL C sources are translated to SPIR-V with ocloc before the measurement, so only the driver side is timed.
+
+const char *defaultSources[] = {
+    R"===(
+__kernel void kernel_copy(__global char *dst, __global char *src){
+    uint gid = get_global_id(0);
+    dst[gid] = src[gid];
+}
+)===",
+    R"===(
+__constant int coefficients[4] = {1, 2, 3, 4};
+__global int counter = 0;
+int filter(__global const int *src, uint gid){
+    return src[gid] * coefficients[gid % 4];
+}
+__kernel void kernel_filter(__global int *dst, __global const int *src){
+    uint gid = get_global_id(0);
+    dst[gid] = filter(src, gid);
+    atomic_inc(&counter);
+}
+__kernel void kernel_reduce(__global int *dst, __local int *scratch){
+    uint lid = get_local_id(0);
+    scratch[lid] = lid;
+    barrier(CLK_LOCAL_MEM_FENCE);
+    if (lid == 0) {
+        int sum = 0;
+        for (uint i = 0; i < get_local_size(0); i++) {
+            sum += scratch[i];
+        }
+        dst[get_group_id(0)] = sum;
+    }
+}
+)==="};
+
+// build covers the IGC compile including the compiler cache lookup
+const char *driverPhases[] = {"build", "decodeBinary", "isaUpload", "linkBinary"};
+
+struct ModuleInput {
+    std::string name;
+    std::vector<uint8_t> spirV;
+};
+
+struct ModeResult {
+    std::string mode;
+    std::map<std::string, double> moduleTimesMs;
+    std::map<std::string, double> phaseTimesMs;
+};
+
+bool endsWith(const std::string &text, const std::string &suffix) {
+    return text.size() >= suffix.size() && 0 == text.compare(text.size() - suffix.size(), suffix.size(), suffix);
+}
+
+std::vector<uint8_t> toSpirV(const std::string &source) {
+    std::string buildLog;
+    auto spirV = compileToSpirV(source, "", buildLog);
+    if (buildLog.size() > 0) {
+        std::cerr << "Build log " << buildLog;
+    }
+    SUCCESS_OR_TERMINATE((0 == spirV.size()));
+    return spirV;
+}
+
+std::vector<ModuleInput> loadCorpus(const char *corpusDir) {
+    std::vector<ModuleInput> corpus;
+    if (corpusDir == nullptr) {
+        for (size_t i = 0; i < sizeof(defaultSources) / sizeof(defaultSources[0]); i++) {
+            corpus.push_back({"builtin_" + std::to_string(i), toSpirV(defaultSources[i])});
+        }
+        return corpus;
+    }
+
+    auto dir = opendir(corpusDir);
+    SUCCESS_OR_TERMINATE_BOOL(dir == nullptr);
+    while (auto entry = readdir(dir)) {
+        std::string name = entry->d_name;
+        if (!endsWith(name, ".cl") && !endsWith(name, ".spv")) {
+            continue;
+        }
+        std::ifstream file(std::string(corpusDir) + "/" + name, std::ios::binary);
+        std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        if (endsWith(name, ".cl")) {
+            corpus.push_back({name, toSpirV(content)});
+        } else {
+            corpus.push_back({name, std::vector<uint8_t>(content.begin(), content.end())});
+        }
+    }
+    closedir(dir);
+    return corpus;
+}
+
+int runChild(const char *corpusDir, const char *resultFile) {
+    auto corpus = loadCorpus(corpusDir);
+
+    ze_context_handle_t context = nullptr;
+    auto devices = zelloInitContextAndGetDevices(context);
+    auto device = devices[0];
+
+    std::ofstream result(resultFile);
+    for (auto &input : corpus) {
+        ze_module_desc_t moduleDesc = {ZE_STRUCTURE_TYPE_MODULE_DESC};
+        moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
+        moduleDesc.pInputModule = input.spirV.data();
+        moduleDesc.inputSize = input.spirV.size();
+        moduleDesc.pBuildFlags = "";
+        ze_module_handle_t module;
+        auto start = std::chrono::steady_clock::now();
+        SUCCESS_OR_TERMINATE(zeModuleCreate(context, device, &moduleDesc, &module, nullptr));
+        result << input.name << " " << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() << "\n";
+        SUCCESS_OR_TERMINATE(zeModuleDestroy(module));
+    }
+
+    SUCCESS_OR_TERMINATE(zeContextDestroy(context));
+    return 0;
+}
+
+void readChildResults(const std::string &resultFile, const std::string &traceFile, ModeResult &modeResult) {
+    std::ifstream result(resultFile);
+    std::string name;
+    double timeMs = 0.0;
+    while (result >> name >> timeMs) {
+        modeResult.moduleTimesMs[name] = timeMs;
+    }
+
+    std::ifstream trace(traceFile);
+    std::string line;
+    while (std::getline(trace, line)) {
+        auto durPos = line.find("\"dur\":");
+        if (durPos == std::string::npos) {
+            continue;
+        }
+        modeResult.phaseTimesMs[getJsonString(line, "\"name\":\"")] += std::atof(line.c_str() + durPos + strlen("\"dur\":")) / 1000.0;
+    }
+}
+
+bool runMode(const char *mode, const std::string &cacheDir, bool cacheDisabled, const std::string &workDir, const char *corpusDir, ModeResult &modeResult) {
+    auto resultFile = workDir + "/result_" + mode + ".txt";
+    auto traceFile = workDir + "/trace_" + mode + ".json";
+
+    auto pid = fork();
+    if (pid == 0) {
+        // debug keys are read at library load, so they have to be set before exec
+        setenv("NEOReadDebugKeys", "1", 1);
+        setenv("TraceEventsFile", traceFile.c_str(), 1);
+        setenv("l0_c_cache_dir", cacheDir.c_str(), 1);
+        if (cacheDisabled) {
+            // binaries larger than the cache size are never stored, so every lookup misses
+            setenv("l0_c_cache_max_size", "1", 1);
+        }
+        if (corpusDir) {
+            execl("/proc/self/exe", "zello_module_load", "--child", resultFile.c_str(), "--corpus", corpusDir, nullptr);
+        } else {
+            execl("/proc/self/exe", "zello_module_load", "--child", resultFile.c_str(), nullptr);
+        }
+        _exit(1);
+    }
+    int status = 0;
+    if (pid < 0 || waitpid(pid, &status, 0) != pid || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        std::cerr << "child process for " << mode << " mode failed\n";
+        return false;
+    }
+    modeResult.mode = mode;
+    readChildResults(resultFile, traceFile, modeResult);
+    return true;
+}
+
+std::string toJson(const std::vector<ModeResult> &results) {
+    std::ostringstream json;
+    json << "{\"benchmark\":\"zello_module_load\",\"unit\":\"ms\",\"results\":[";
+    for (size_t i = 0; i < results.size(); i++) {
+        auto &modeResult = results[i];
+        json << (i ? "," : "") << "\n{\"mode\":\"" << modeResult.mode << "\",\"phases\":{";
+        for (size_t phase = 0; phase < sizeof(driverPhases) / sizeof(driverPhases[0]); phase++) {
+            auto it = modeResult.phaseTimesMs.find(driverPhases[phase]);
+            json << (phase ? "," : "") << "\"" << driverPhases[phase] << "\":" << (it != modeResult.phaseTimesMs.end() ? it->second : 0.0);
+        }
+        json << "},\"modules\":{";
+        bool first = true;
+        for (auto &module : modeResult.moduleTimesMs) {
+            json << (first ? "" : ",") << "\"" << module.first << "\":" << module.second;
+            first = false;
+        }
+        json << "}}";
+    }
+    json << "\n]}\n";
+    return json.str();
+}
+
+int main(int argc, char *argv[]) {
+    verbose = isVerbose(argc, argv);
+    auto corpusDir = getParamString(argc, argv, "-d", "--corpus");
+    auto childResultFile = getParamString(argc, argv, "-c", "--child");
+    if (childResultFile) {
+        return runChild(corpusDir, childResultFile);
+    }
+
+    char workDirTemplate[] = "/tmp/zello_module_load_XXXXXX";
+    SUCCESS_OR_TERMINATE_BOOL(mkdtemp(workDirTemplate) == nullptr);
+    std::string workDir = workDirTemplate;
+
+    auto disabledCacheDir = workDir + "/cache_disabled";
+    auto cacheDir = workDir + "/cache";
+    SUCCESS_OR_TERMINATE_BOOL(mkdir(disabledCacheDir.c_str(), 0777) != 0);
+    SUCCESS_OR_TERMINATE_BOOL(mkdir(cacheDir.c_str(), 0777) != 0);
+
+    // the cold run populates the cache directory, the warm run builds every module from it
+    std::vector<ModeResult> results(3);
+    bool success = runMode("disabled", disabledCacheDir, true, workDir, corpusDir, results[0]) &&
+                   runMode("cold", cacheDir, false, workDir, corpusDir, results[1]) &&
+                   runMode("warm", cacheDir, false, workDir, corpusDir, results[2]);
+    if (!success) {
+        return 1;
+    }
+
+    writeBenchmarkOutput(argc, argv, toJson(results));
+    return 0;
+}
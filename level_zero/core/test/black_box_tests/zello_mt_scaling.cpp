@@ -0,0 +1,263 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "zello_common.h"
+#include "zello_compile.h"
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <sstream>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+
+extern bool verbose;
+bool verbose = false;
+
+// Runs the same host-side workload (allocate, set kernel arguments, enqueue, free) on 1..N threads sharing one
+// context and one engine, and reports the throughput curve as JSON. Every thread count runs in a fresh child
+// process with TraceEventsFile set, so the time threads spent blocked on each driver mutex is reported per point.
+
+const char *moduleSource = R"===(
+__kernel void kernel_copy(__global char *dst, __global char *src){
+    uint gid = get_global_id(0);
+    dst[gid] = src[gid];
+}
+)===";
+
+using Clock = std::chrono::steady_clock;
+constexpr size_t allocSize = 4096u;
+const char *phases[] = {"alloc", "set_arg", "enqueue", "free"};
+constexpr size_t phaseCount = sizeof(phases) / sizeof(phases[0]);
+
+struct PhaseTimes {
+    double seconds[phaseCount] = {};
+};
+
+struct ScalingPoint {
+    uint32_t threadCount;
+    double opsPerSecond;
+    double phaseUs[phaseCount];
+    std::map<std::string, std::pair<uint32_t, double>> lockWaits;
+};
+
+// one iteration per loop: device and shared allocation, both kernel arguments, a kernel launch and a copy from
+// malloc-ed memory on the thread's own immediate command list, then both frees
+void runWorker(ze_context_handle_t context, ze_device_handle_t device, ze_module_handle_t module, uint32_t iterations, PhaseTimes &times) {
+    ze_kernel_handle_t kernel;
+    ze_kernel_desc_t kernelDesc = {ZE_STRUCTURE_TYPE_KERNEL_DESC};
+    kernelDesc.pKernelName = "kernel_copy";
+    SUCCESS_OR_TERMINATE(zeKernelCreate(module, &kernelDesc, &kernel));
+    SUCCESS_OR_TERMINATE(zeKernelSetGroupSize(kernel, 64u, 1u, 1u));
+    ze_group_count_t groupCount = {allocSize / 64u, 1u, 1u};
+
+    ze_command_queue_desc_t queueDesc = {ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC};
+    queueDesc.ordinal = getCommandQueueOrdinal(device);
+    queueDesc.mode = ZE_COMMAND_QUEUE_MODE_SYNCHRONOUS;
+    ze_command_list_handle_t cmdList;
+    SUCCESS_OR_TERMINATE(zeCommandListCreateImmediate(context, device, &queueDesc, &cmdList));
+
+    std::vector<char> hostMemory(allocSize);
+    ze_device_mem_alloc_desc_t deviceDesc = {ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC};
+    ze_host_mem_alloc_desc_t hostDesc = {ZE_STRUCTURE_TYPE_HOST_MEM_ALLOC_DESC};
+
+    for (uint32_t i = 0; i < iterations; i++) {
+        void *deviceBuffer = nullptr;
+        void *sharedBuffer = nullptr;
+        auto start = Clock::now();
+        SUCCESS_OR_TERMINATE(zeMemAllocDevice(context, &deviceDesc, allocSize, 0u, device, &deviceBuffer));
+        SUCCESS_OR_TERMINATE(zeMemAllocShared(context, &deviceDesc, &hostDesc, allocSize, 0u, device, &sharedBuffer));
+        auto allocated = Clock::now();
+        SUCCESS_OR_TERMINATE(zeKernelSetArgumentValue(kernel, 0, sizeof(deviceBuffer), &deviceBuffer));
+        SUCCESS_OR_TERMINATE(zeKernelSetArgumentValue(kernel, 1, sizeof(sharedBuffer), &sharedBuffer));
+        auto argsSet = Clock::now();
+        SUCCESS_OR_TERMINATE(zeCommandListAppendLaunchKernel(cmdList, kernel, &groupCount, nullptr, 0, nullptr));
+        SUCCESS_OR_TERMINATE(zeCommandListAppendMemoryCopy(cmdList, deviceBuffer, hostMemory.data(), allocSize, nullptr, 0, nullptr));
+        auto enqueued = Clock::now();
+        SUCCESS_OR_TERMINATE(zeMemFree(context, sharedBuffer));
+        SUCCESS_OR_TERMINATE(zeMemFree(context, deviceBuffer));
+        auto freed = Clock::now();
+
+        times.seconds[0] += std::chrono::duration<double>(allocated - start).count();
+        times.seconds[1] += std::chrono::duration<double>(argsSet - allocated).count();
+        times.seconds[2] += std::chrono::duration<double>(enqueued - argsSet).count();
+        times.seconds[3] += std::chrono::duration<double>(freed - enqueued).count();
+    }
+
+    SUCCESS_OR_TERMINATE(zeCommandListDestroy(cmdList));
+    SUCCESS_OR_TERMINATE(zeKernelDestroy(kernel));
+}
+
+int runChild(uint32_t threadCount, uint32_t iterations, const char *resultFile) {
+    std::string buildLog;
+    auto spirV = compileToSpirV(moduleSource, "", buildLog);
+    if (buildLog.size() > 0) {
+        std::cerr << "Build log " << buildLog;
+    }
+    SUCCESS_OR_TERMINATE((0 == spirV.size()));
+
+    ze_context_handle_t context = nullptr;
+    auto devices = zelloInitContextAndGetDevices(context);
+    auto device = devices[0];
+
+    ze_module_handle_t module;
+    ze_module_desc_t moduleDesc = {ZE_STRUCTURE_TYPE_MODULE_DESC};
+    moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
+    moduleDesc.pInputModule = spirV.data();
+    moduleDesc.inputSize = spirV.size();
+    moduleDesc.pBuildFlags = "";
+    SUCCESS_OR_TERMINATE(zeModuleCreate(context, device, &moduleDesc, &module, nullptr));
+
+    // warm up on a single thread, so engine initialization and first-use allocations stay out of the measurement
+    PhaseTimes warmUp;
+    runWorker(context, device, module, 10u, warmUp);
+
+    std::vector<PhaseTimes> times(threadCount);
+    auto start = Clock::now();
+    std::vector<std::thread> threads;
+    for (uint32_t threadId = 0; threadId < threadCount; threadId++) {
+        threads.emplace_back(runWorker, context, device, module, iterations, std::ref(times[threadId]));
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    auto seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    SUCCESS_OR_TERMINATE(zeModuleDestroy(module));
+    SUCCESS_OR_TERMINATE(zeContextDestroy(context));
+
+    std::ofstream result(resultFile);
+    result << "ops_per_second " << static_cast<double>(threadCount) * iterations / seconds << "\n";
+    for (size_t phase = 0; phase < phaseCount; phase++) {
+        double total = 0.0;
+        for (auto &threadTimes : times) {
+            total += threadTimes.seconds[phase];
+        }
+        result << phases[phase] << " " << total * 1e6 / (static_cast<double>(threadCount) * iterations) << "\n";
+    }
+    return 0;
+}
+
+bool readChildResults(const std::string &resultFile, const std::string &traceFile, ScalingPoint &point) {
+    std::ifstream result(resultFile);
+    std::string name;
+    double value = 0.0;
+    bool throughputFound = false;
+    while (result >> name >> value) {
+        if (name == "ops_per_second") {
+            point.opsPerSecond = value;
+            throughputFound = true;
+        }
+        for (size_t phase = 0; phase < phaseCount; phase++) {
+            if (name == phases[phase]) {
+                point.phaseUs[phase] = value;
+            }
+        }
+    }
+
+    // every lock event is the time one thread spent blocked on a contended mutex
+    std::ifstream trace(traceFile);
+    std::string line;
+    while (std::getline(trace, line)) {
+        auto durPos = line.find("\"dur\":");
+        if (durPos == std::string::npos || getJsonString(line, "\"cat\":\"") != "lock") {
+            continue;
+        }
+        auto &lockWait = point.lockWaits[getJsonString(line, "\"name\":\"")];
+        lockWait.first++;
+        lockWait.second += std::atof(line.c_str() + durPos + strlen("\"dur\":")) / 1000.0;
+    }
+    return throughputFound;
+}
+
+bool runPoint(uint32_t threadCount, uint32_t iterations, const std::string &workDir, ScalingPoint &point) {
+    auto resultFile = workDir + "/result_" + std::to_string(threadCount) + ".txt";
+    auto traceFile = workDir + "/trace_" + std::to_string(threadCount) + ".json";
+    auto threadCountArg = std::to_string(threadCount);
+    auto iterationsArg = std::to_string(iterations);
+
+    auto pid = fork();
+    if (pid == 0) {
+        // debug keys are read at library load, so they have to be set before exec
+        setenv("NEOReadDebugKeys", "1", 1);
+        setenv("TraceEventsFile", traceFile.c_str(), 1);
+        execl("/proc/self/exe", "zello_mt_scaling", "--child", threadCountArg.c_str(), "--iterations", iterationsArg.c_str(),
+              "--result", resultFile.c_str(), nullptr);
+        _exit(1);
+    }
+    int status = 0;
+    if (pid < 0 || waitpid(pid, &status, 0) != pid || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        std::cerr << "child process for " << threadCount << " threads failed\n";
+        return false;
+    }
+    point.threadCount = threadCount;
+    return readChildResults(resultFile, traceFile, point);
+}
+
+std::string toJson(const std::vector<ScalingPoint> &points, uint32_t iterations) {
+    std::map<std::string, double> totalLockWaitMs;
+    for (auto &point : points) {
+        for (auto &lockWait : point.lockWaits) {
+            totalLockWaitMs[lockWait.first] += lockWait.second.second;
+        }
+    }
+    auto mostContended = std::max_element(totalLockWaitMs.begin(), totalLockWaitMs.end(),
+                                          [](const auto &a, const auto &b) { return a.second < b.second; });
+
+    std::ostringstream json;
+    json << "{\"benchmark\":\"zello_mt_scaling\",\"iterations_per_thread\":" << iterations
+         << ",\"most_contended_lock\":\"" << (mostContended != totalLockWaitMs.end() ? mostContended->first : "") << "\",\"results\":[";
+    for (size_t i = 0; i < points.size(); i++) {
+        auto &point = points[i];
+        json << (i ? "," : "") << "\n{\"threads\":" << point.threadCount << ",\"ops_per_second\":" << point.opsPerSecond
+             << ",\"scaling\":" << point.opsPerSecond / points[0].opsPerSecond << ",\"phase_us\":{";
+        for (size_t phase = 0; phase < phaseCount; phase++) {
+            json << (phase ? "," : "") << "\"" << phases[phase] << "\":" << point.phaseUs[phase];
+        }
+        json << "},\"lock_waits\":[";
+        bool first = true;
+        for (auto &lockWait : point.lockWaits) {
+            json << (first ? "" : ",") << "{\"lock\":\"" << lockWait.first << "\",\"count\":" << lockWait.second.first
+                 << ",\"wait_ms\":" << lockWait.second.second << "}";
+            first = false;
+        }
+        json << "]}";
+    }
+    json << "\n]}\n";
+    return json.str();
+}
+
+int main(int argc, char *argv[]) {
+    verbose = isVerbose(argc, argv);
+    auto iterations = std::max(getParamValue(argc, argv, "-i", "--iterations", 1000u), 1u);
+    auto childThreadCount = getParamValue(argc, argv, "-c", "--child", 0u);
+    if (childThreadCount > 0) {
+        return runChild(childThreadCount, iterations, getParamString(argc, argv, "-r", "--result"));
+    }
+    auto maxThreadCount = std::max(getParamValue(argc, argv, "-t", "--threads", std::max(std::thread::hardware_concurrency(), 1u)), 1u);
+
+    char workDirTemplate[] = "/tmp/zello_mt_scaling_XXXXXX";
+    SUCCESS_OR_TERMINATE_BOOL(mkdtemp(workDirTemplate) == nullptr);
+    std::string workDir = workDirTemplate;
+
+    // thread counts double up to the maximum, which is always measured
+    std::vector<ScalingPoint> points;
+    for (uint32_t threadCount = 1; threadCount <= maxThreadCount; threadCount = (threadCount == maxThreadCount) ? threadCount + 1 : std::min(threadCount * 2, maxThreadCount)) {
+        ScalingPoint point = {};
+        if (!runPoint(threadCount, iterations, workDir, point)) {
+            return 1;
+        }
+        if (verbose) {
+            std::cerr << threadCount << " threads : " << point.opsPerSecond << " ops/s\n";
+        }
+        points.push_back(point);
+    }
+
+    writeBenchmarkOutput(argc, argv, toJson(points, iterations));
+    return 0;
+}
@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "zello_common.h"
+#include "zello_compile.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <map>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern bool verbose;
+bool verbose = false;
+
+// Every scenario runs in a fresh child process, so driver initialization is measured from a cold start.
+// Driver internal phases are taken from the runtime trace (TraceEventsFile), which is written at driver unload.
+
+const char *moduleSource = R"===(
+__kernel void kernel_copy(__global char *dst, __global char *src){
+    uint gid = get_global_id(0);
+    dst[gid] = src[gid];
+}
+)===";
+
+const char *driverPhases[] = {"deviceDiscovery", "hardwareInfoSetup", "memoryManagerInit", "engineCreation", "sipKernelLoad", "build"};
+
+class StepTimer {
+  public:
+    void step(const char *name) {
+        auto now = std::chrono::steady_clock::now();
+        std::cout << "  " << std::left << std::setw(28) << name << std::right << std::setw(12) << std::fixed << std::setprecision(3)
+                  << std::chrono::duration<double, std::milli>(now - last).count() << " ms\n";
+        last = now;
+    }
+
+  protected:
+    std::chrono::steady_clock::time_point last = std::chrono::steady_clock::now();
+};
+
+int runChild() {
+    // compile to SPIR-V up front, only the driver side of the module build is measured
+    std::string buildLog;
+    auto spirV = compileToSpirV(moduleSource, "", buildLog);
+    SUCCESS_OR_TERMINATE((0 == spirV.size()));
+
+    StepTimer timer;
+    SUCCESS_OR_TERMINATE(zeInit(ZE_INIT_FLAG_GPU_ONLY));
+    timer.step("zeInit");
+
+    uint32_t driverCount = 1;
+    ze_driver_handle_t driverHandle;
+    SUCCESS_OR_TERMINATE(zeDriverGet(&driverCount, &driverHandle));
+    uint32_t deviceCount = 1;
+    ze_device_handle_t device;
+    SUCCESS_OR_TERMINATE(zeDeviceGet(driverHandle, &deviceCount, &device));
+    timer.step("zeDriverGet + zeDeviceGet");
+
+    ze_context_handle_t context;
+    ze_context_desc_t contextDesc = {};
+    SUCCESS_OR_TERMINATE(zeContextCreate(driverHandle, &contextDesc, &context));
+    timer.step("zeContextCreate");
+
+    ze_command_queue_handle_t cmdQueue;
+    ze_command_list_handle_t cmdList;
+    SUCCESS_OR_TERMINATE(createCommandQueue(context, device, cmdQueue));
+    SUCCESS_OR_TERMINATE(createCommandList(context, device, cmdList));
+    timer.step("queue + list creation");
+
+    ze_module_handle_t module;
+    ze_module_desc_t moduleDesc = {};
+    moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
+    moduleDesc.pInputModule = spirV.data();
+    moduleDesc.inputSize = spirV.size();
+    moduleDesc.pBuildFlags = "";
+    SUCCESS_OR_TERMINATE(zeModuleCreate(context, device, &moduleDesc, &module, nullptr));
+    ze_kernel_handle_t kernel;
+    ze_kernel_desc_t kernelDesc = {};
+    kernelDesc.pKernelName = "kernel_copy";
+    SUCCESS_OR_TERMINATE(zeKernelCreate(module, &kernelDesc, &kernel));
+    timer.step("zeModuleCreate");
+
+    constexpr size_t allocSize = 4096;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    void *srcBuffer = nullptr;
+    void *dstBuffer = nullptr;
+    SUCCESS_OR_TERMINATE(zeMemAllocShared(context, &deviceDesc, &hostDesc, allocSize, 1, device, &srcBuffer));
+    SUCCESS_OR_TERMINATE(zeMemAllocShared(context, &deviceDesc, &hostDesc, allocSize, 1, device, &dstBuffer));
+    timer.step("buffer allocation");
+
+    SUCCESS_OR_TERMINATE(zeKernelSetGroupSize(kernel, 32u, 1u, 1u));
+    SUCCESS_OR_TERMINATE(zeKernelSetArgumentValue(kernel, 0, sizeof(dstBuffer), &dstBuffer));
+    SUCCESS_OR_TERMINATE(zeKernelSetArgumentValue(kernel, 1, sizeof(srcBuffer), &srcBuffer));
+    ze_group_count_t dispatchTraits = {allocSize / 32u, 1u, 1u};
+    SUCCESS_OR_TERMINATE(zeCommandListAppendLaunchKernel(cmdList, kernel, &dispatchTraits, nullptr, 0, nullptr));
+    SUCCESS_OR_TERMINATE(zeCommandListClose(cmdList));
+    SUCCESS_OR_TERMINATE(zeCommandQueueExecuteCommandLists(cmdQueue, 1, &cmdList, nullptr));
+    SUCCESS_OR_TERMINATE(zeCommandQueueSynchronize(cmdQueue, std::numeric_limits<uint64_t>::max()));
+    timer.step("first kernel launch");
+
+    SUCCESS_OR_TERMINATE(zeMemFree(context, dstBuffer));
+    SUCCESS_OR_TERMINATE(zeMemFree(context, srcBuffer));
+    SUCCESS_OR_TERMINATE(zeKernelDestroy(kernel));
+    SUCCESS_OR_TERMINATE(zeModuleDestroy(module));
+    SUCCESS_OR_TERMINATE(zeCommandListDestroy(cmdList));
+    SUCCESS_OR_TERMINATE(zeCommandQueueDestroy(cmdQueue));
+    SUCCESS_OR_TERMINATE(zeContextDestroy(context));
+    return 0;
+}
+
+void printDriverPhases(const std::string &traceFile) {
+    std::map<std::string, double> phaseTimesMs;
+    std::ifstream trace(traceFile);
+    std::string line;
+    while (std::getline(trace, line)) {
+        auto durPos = line.find("\"dur\":");
+        if (durPos == std::string::npos) {
+            continue;
+        }
+        phaseTimesMs[getJsonString(line, "\"name\":\"")] += std::atof(line.c_str() + durPos + strlen("\"dur\":")) / 1000.0;
+    }
+
+    std::cout << " driver phases (nested, summed over all threads):\n";
+    for (auto phase : driverPhases) {
+        std::cout << "  " << std::left << std::setw(28) << phase << std::right << std::setw(12) << std::fixed << std::setprecision(3)
+                  << phaseTimesMs[phase] << " ms\n";
+    }
+}
+
+bool runScenario(const char *name, const std::string &workDir, const std::string &traceFile) {
+    std::cout << name << ":\n"
+              << std::flush;
+    auto pid = fork();
+    if (pid == 0) {
+        // debug keys are read at library load, so they have to be set before exec
+        setenv("NEOReadDebugKeys", "1", 1);
+        setenv("TraceEventsFile", traceFile.c_str(), 1);
+        setenv("l0_c_cache_dir", workDir.c_str(), 1);
+        execl("/proc/self/exe", "zello_startup", "--child", nullptr);
+        _exit(1);
+    }
+    int status = 0;
+    if (pid < 0 || waitpid(pid, &status, 0) != pid || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        std::cout << " child process failed\n";
+        return false;
+    }
+    printDriverPhases(traceFile);
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    verbose = isVerbose(argc, argv);
+    if (isParamEnabled(argc, argv, "-c", "--child")) {
+        return runChild();
+    }
+
+    char workDirTemplate[] = "/tmp/zello_startup_XXXXXX";
+    SUCCESS_OR_TERMINATE_BOOL(mkdtemp(workDirTemplate) == nullptr);
+    std::string workDir = workDirTemplate;
+
+    // the first run populates the compiler cache, the second one builds the module from it
+    bool success = runScenario("Cold start, compiler cache miss", workDir, workDir + "/trace_miss.json") &&
+                   runScenario("Cold start, compiler cache hit", workDir, workDir + "/trace_hit.json");
+
+    std::cout << "\nStartup benchmark " << (success ? "PASSED" : "FAILED") << ", traces kept in " << workDir << "\n";
+    return success ? 0 : 1;
+}
@@ -0,0 +1,266 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "zello_common.h"
+#include "zello_compile.h"
+
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+#include <thread>
+
+extern bool verbose;
+bool verbose = false;
+
+// Measures submission paths end to end on hardware and reports them as JSON, one object per metric.
+// Latencies are medians over all iterations, throughput is taken over the whole batch.
+
+const char *moduleSource = R"===(
+__kernel void kernel_empty(){
+}
+)===";
+
+using Clock = std::chrono::steady_clock;
+
+struct BenchmarkContext {
+    ze_context_handle_t context;
+    ze_device_handle_t device;
+    ze_module_handle_t module;
+    ze_kernel_handle_t kernel;
+    ze_group_count_t groupCount = {1u, 1u, 1u};
+    uint32_t iterations = 1000u;
+};
+
+struct Result {
+    std::string name;
+    std::string unit;
+    double value;
+};
+
+ze_command_list_handle_t createImmediateCommandList(BenchmarkContext &bench, ze_command_queue_mode_t mode) {
+    ze_command_queue_desc_t descriptor = {ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC};
+    descriptor.ordinal = getCommandQueueOrdinal(bench.device);
+    descriptor.mode = mode;
+    ze_command_list_handle_t cmdList;
+    SUCCESS_OR_TERMINATE(zeCommandListCreateImmediate(bench.context, bench.device, &descriptor, &cmdList));
+    return cmdList;
+}
+
+ze_event_pool_handle_t createEventPool(BenchmarkContext &bench, uint32_t count) {
+    ze_event_pool_desc_t eventPoolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC};
+    eventPoolDesc.count = count;
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+    ze_event_pool_handle_t eventPool;
+    SUCCESS_OR_TERMINATE(zeEventPoolCreate(bench.context, &eventPoolDesc, 1, &bench.device, &eventPool));
+    return eventPool;
+}
+
+ze_event_handle_t createEvent(ze_event_pool_handle_t eventPool, uint32_t index) {
+    ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC};
+    eventDesc.index = index;
+    eventDesc.signal = ZE_EVENT_SCOPE_FLAG_HOST;
+    eventDesc.wait = ZE_EVENT_SCOPE_FLAG_HOST;
+    ze_event_handle_t event;
+    SUCCESS_OR_TERMINATE(zeEventCreate(eventPool, &eventDesc, &event));
+    return event;
+}
+
+// time from appending an empty kernel to a synchronous immediate command list until the call returns
+Result measureImmediateLaunchLatency(BenchmarkContext &bench) {
+    auto cmdList = createImmediateCommandList(bench, ZE_COMMAND_QUEUE_MODE_SYNCHRONOUS);
+    std::vector<double> samples;
+    for (uint32_t i = 0; i < bench.iterations; i++) {
+        auto start = Clock::now();
+        SUCCESS_OR_TERMINATE(zeCommandListAppendLaunchKernel(cmdList, bench.kernel, &bench.groupCount, nullptr, 0, nullptr));
+        samples.push_back(toMicroseconds(Clock::now() - start));
+    }
+    SUCCESS_OR_TERMINATE(zeCommandListDestroy(cmdList));
+    return {"immediate_launch_latency", "us", median(samples)};
+}
+
+// full cycle of a regular command list with one empty kernel: reset, record, close, execute and synchronize
+Result measureRegularLaunchLatency(BenchmarkContext &bench) {
+    ze_command_queue_handle_t cmdQueue;
+    ze_command_list_handle_t cmdList;
+    SUCCESS_OR_TERMINATE(createCommandQueue(bench.context, bench.device, cmdQueue));
+    SUCCESS_OR_TERMINATE(createCommandList(bench.context, bench.device, cmdList));
+    std::vector<double> samples;
+    for (uint32_t i = 0; i < bench.iterations; i++) {
+        auto start = Clock::now();
+        SUCCESS_OR_TERMINATE(zeCommandListReset(cmdList));
+        SUCCESS_OR_TERMINATE(zeCommandListAppendLaunchKernel(cmdList, bench.kernel, &bench.groupCount, nullptr, 0, nullptr));
+        SUCCESS_OR_TERMINATE(zeCommandListClose(cmdList));
+        SUCCESS_OR_TERMINATE(zeCommandQueueExecuteCommandLists(cmdQueue, 1, &cmdList, nullptr));
+        SUCCESS_OR_TERMINATE(zeCommandQueueSynchronize(cmdQueue, std::numeric_limits<uint64_t>::max()));
+        samples.push_back(toMicroseconds(Clock::now() - start));
+    }
+    SUCCESS_OR_TERMINATE(zeCommandListDestroy(cmdList));
+    SUCCESS_OR_TERMINATE(zeCommandQueueDestroy(cmdQueue));
+    return {"regular_launch_latency", "us", median(samples)};
+}
+
+// executing an already closed command list, i.e. the submission cost without recording
+Result measureRegularResubmitLatency(BenchmarkContext &bench) {
+    ze_command_queue_handle_t cmdQueue;
+    ze_command_list_handle_t cmdList;
+    SUCCESS_OR_TERMINATE(createCommandQueue(bench.context, bench.device, cmdQueue));
+    SUCCESS_OR_TERMINATE(createCommandList(bench.context, bench.device, cmdList));
+    SUCCESS_OR_TERMINATE(zeCommandListAppendLaunchKernel(cmdList, bench.kernel, &bench.groupCount, nullptr, 0, nullptr));
+    SUCCESS_OR_TERMINATE(zeCommandListClose(cmdList));
+    std::vector<double> samples;
+    for (uint32_t i = 0; i < bench.iterations; i++) {
+        auto start = Clock::now();
+        SUCCESS_OR_TERMINATE(zeCommandQueueExecuteCommandLists(cmdQueue, 1, &cmdList, nullptr));
+        SUCCESS_OR_TERMINATE(zeCommandQueueSynchronize(cmdQueue, std::numeric_limits<uint64_t>::max()));
+        samples.push_back(toMicroseconds(Clock::now() - start));
+    }
+    SUCCESS_OR_TERMINATE(zeCommandListDestroy(cmdList));
+    SUCCESS_OR_TERMINATE(zeCommandQueueDestroy(cmdQueue));
+    return {"regular_resubmit_latency", "us", median(samples)};
+}
+
+// every thread appends to its own asynchronous immediate command list, the last launch signals an event
+std::vector<Result> measureLaunchThroughput(BenchmarkContext &bench, uint32_t threadCount) {
+    std::vector<double> launchesPerSecond(threadCount, 0.0);
+    auto worker = [&](uint32_t threadId) {
+        auto cmdList = createImmediateCommandList(bench, ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS);
+        auto eventPool = createEventPool(bench, 1);
+        auto event = createEvent(eventPool, 0);
+
+        auto start = Clock::now();
+        for (uint32_t i = 0; i < bench.iterations; i++) {
+            auto signalEvent = (i + 1 == bench.iterations) ? event : nullptr;
+            SUCCESS_OR_TERMINATE(zeCommandListAppendLaunchKernel(cmdList, bench.kernel, &bench.groupCount, signalEvent, 0, nullptr));
+        }
+        SUCCESS_OR_TERMINATE(zeEventHostSynchronize(event, std::numeric_limits<uint64_t>::max()));
+        launchesPerSecond[threadId] = bench.iterations / std::chrono::duration<double>(Clock::now() - start).count();
+
+        SUCCESS_OR_TERMINATE(zeEventDestroy(event));
+        SUCCESS_OR_TERMINATE(zeEventPoolDestroy(eventPool));
+        SUCCESS_OR_TERMINATE(zeCommandListDestroy(cmdList));
+    };
+
+    std::vector<std::thread> threads;
+    for (uint32_t threadId = 0; threadId < threadCount; threadId++) {
+        threads.emplace_back(worker, threadId);
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    double total = 0.0;
+    for (auto value : launchesPerSecond) {
+        total += value;
+    }
+    return {{"launches_per_second_per_thread", "1/s", total / threadCount},
+            {"launches_per_second_total", "1/s", total}};
+}
+
+// host signal appended to an asynchronous immediate command list until the host observes it
+Result measureEventSignalToHostLatency(BenchmarkContext &bench) {
+    auto cmdList = createImmediateCommandList(bench, ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS);
+    auto eventPool = createEventPool(bench, 1);
+    auto event = createEvent(eventPool, 0);
+    std::vector<double> samples;
+    for (uint32_t i = 0; i < bench.iterations; i++) {
+        SUCCESS_OR_TERMINATE(zeEventHostReset(event));
+        auto start = Clock::now();
+        SUCCESS_OR_TERMINATE(zeCommandListAppendSignalEvent(cmdList, event));
+        SUCCESS_OR_TERMINATE(zeEventHostSynchronize(event, std::numeric_limits<uint64_t>::max()));
+        samples.push_back(toMicroseconds(Clock::now() - start));
+    }
+    SUCCESS_OR_TERMINATE(zeEventDestroy(event));
+    SUCCESS_OR_TERMINATE(zeEventPoolDestroy(eventPool));
+    SUCCESS_OR_TERMINATE(zeCommandListDestroy(cmdList));
+    return {"event_signal_to_host_latency", "us", median(samples)};
+}
+
+// resubmission alternating between two queues, reported as the extra cost over staying on one queue
+Result measureQueueSwitchCost(BenchmarkContext &bench, double sameQueueLatency) {
+    ze_command_queue_handle_t cmdQueues[2];
+    ze_command_list_handle_t cmdList;
+    SUCCESS_OR_TERMINATE(createCommandQueue(bench.context, bench.device, cmdQueues[0]));
+    SUCCESS_OR_TERMINATE(createCommandQueue(bench.context, bench.device, cmdQueues[1]));
+    SUCCESS_OR_TERMINATE(createCommandList(bench.context, bench.device, cmdList));
+    SUCCESS_OR_TERMINATE(zeCommandListAppendLaunchKernel(cmdList, bench.kernel, &bench.groupCount, nullptr, 0, nullptr));
+    SUCCESS_OR_TERMINATE(zeCommandListClose(cmdList));
+    std::vector<double> samples;
+    for (uint32_t i = 0; i < bench.iterations; i++) {
+        auto cmdQueue = cmdQueues[i % 2];
+        auto start = Clock::now();
+        SUCCESS_OR_TERMINATE(zeCommandQueueExecuteCommandLists(cmdQueue, 1, &cmdList, nullptr));
+        SUCCESS_OR_TERMINATE(zeCommandQueueSynchronize(cmdQueue, std::numeric_limits<uint64_t>::max()));
+        samples.push_back(toMicroseconds(Clock::now() - start));
+    }
+    SUCCESS_OR_TERMINATE(zeCommandListDestroy(cmdList));
+    SUCCESS_OR_TERMINATE(zeCommandQueueDestroy(cmdQueues[1]));
+    SUCCESS_OR_TERMINATE(zeCommandQueueDestroy(cmdQueues[0]));
+    return {"queue_switch_cost", "us", median(samples) - sameQueueLatency};
+}
+
+std::string toJson(const std::vector<Result> &results, uint32_t iterations, uint32_t threadCount) {
+    std::ostringstream json;
+    json << "{\"benchmark\":\"zello_submission_benchmark\",\"iterations\":" << iterations << ",\"threads\":" << threadCount << ",\"results\":[";
+    for (size_t i = 0; i < results.size(); i++) {
+        json << (i ? "," : "") << "\n{\"name\":\"" << results[i].name << "\",\"unit\":\"" << results[i].unit << "\",\"value\":" << results[i].value << "}";
+    }
+    json << "\n]}\n";
+    return json.str();
+}
+
+int main(int argc, char *argv[]) {
+    verbose = isVerbose(argc, argv);
+
+    BenchmarkContext bench;
+    bench.iterations = std::max(getParamValue(argc, argv, "-i", "--iterations", 1000u), 1u);
+    auto threadCount = std::max(getParamValue(argc, argv, "-t", "--threads", std::max(std::thread::hardware_concurrency() / 2, 1u)), 1u);
+
+    bench.context = nullptr;
+    auto devices = zelloInitContextAndGetDevices(bench.context);
+    bench.device = devices[0];
+
+    std::string buildLog;
+    auto spirV = compileToSpirV(moduleSource, "", buildLog);
+    if (buildLog.size() > 0) {
+        std::cerr << "Build log " << buildLog;
+    }
+    SUCCESS_OR_TERMINATE((0 == spirV.size()));
+
+    ze_module_desc_t moduleDesc = {ZE_STRUCTURE_TYPE_MODULE_DESC};
+    moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
+    moduleDesc.pInputModule = spirV.data();
+    moduleDesc.inputSize = spirV.size();
+    moduleDesc.pBuildFlags = "";
+    SUCCESS_OR_TERMINATE(zeModuleCreate(bench.context, bench.device, &moduleDesc, &bench.module, nullptr));
+    ze_kernel_desc_t kernelDesc = {ZE_STRUCTURE_TYPE_KERNEL_DESC};
+    kernelDesc.pKernelName = "kernel_empty";
+    SUCCESS_OR_TERMINATE(zeKernelCreate(bench.module, &kernelDesc, &bench.kernel));
+    SUCCESS_OR_TERMINATE(zeKernelSetGroupSize(bench.kernel, 1u, 1u, 1u));
+
+    // warm up, so one-time allocations and state programming stay out of the samples
+    auto warmUpIterations = bench.iterations;
+    bench.iterations = 10u;
+    measureImmediateLaunchLatency(bench);
+    bench.iterations = warmUpIterations;
+
+    std::vector<Result> results;
+    results.push_back(measureImmediateLaunchLatency(bench));
+    results.push_back(measureRegularLaunchLatency(bench));
+    results.push_back(measureRegularResubmitLatency(bench));
+    for (auto &result : measureLaunchThroughput(bench, threadCount)) {
+        results.push_back(result);
+    }
+    results.push_back(measureEventSignalToHostLatency(bench));
+    results.push_back(measureQueueSwitchCost(bench, results[2].value));
+
+    SUCCESS_OR_TERMINATE(zeKernelDestroy(bench.kernel));
+    SUCCESS_OR_TERMINATE(zeModuleDestroy(bench.module));
+    SUCCESS_OR_TERMINATE(zeContextDestroy(bench.context));
+
+    writeBenchmarkOutput(argc, argv, toJson(results, bench.iterations, threadCount));
+    return 0;
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -42,6 +42,9 @@ struct WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>
     using BaseClass::getHostPtrAlloc;
     using BaseClass::hostPtrMap;
     using BaseClass::initialize;
+    using BaseClass::kernelTimingHistogramAllocation;
+    using BaseClass::kernelTimingThresholds;
+    using BaseClass::mutableKernelCommands;
 
     WhiteBox() : ::L0::CommandListCoreFamily<gfxCoreFamily>(BaseClass::defaultNumIddsPerBlock) {}
 };
@@ -178,6 +181,31 @@ struct MockCommandList : public CommandList {
                       uint32_t numWaitEvents,
                       ze_event_handle_t *phWaitEvents));
 
+    ADDMETHOD_NOBASE(appendLaunchMutableKernel, ze_result_t, ZE_RESULT_SUCCESS,
+                     (ze_kernel_handle_t hKernel,
+                      const ze_group_count_t *pThreadGroupDimensions,
+                      ze_event_handle_t hEvent,
+                      uint32_t numWaitEvents,
+                      ze_event_handle_t *phWaitEvents,
+                      uint32_t *pCommandId));
+
+    ADDMETHOD_NOBASE(updateMutableKernelArgument, ze_result_t, ZE_RESULT_SUCCESS,
+                     (uint32_t commandId,
+                      uint32_t argIndex,
+                      size_t argSize,
+                      const void *pArgValue));
+
+    ADDMETHOD_NOBASE(updateMutableGroupCount, ze_result_t, ZE_RESULT_SUCCESS,
+                     (uint32_t commandId,
+                      const ze_group_count_t *pThreadGroupDimensions));
+
+    ADDMETHOD_NOBASE(setKernelTimingHistogram, ze_result_t, ZE_RESULT_SUCCESS,
+                     (void *pHistogram));
+
+    ADDMETHOD_NOBASE(appendSWTagRangeMarker, ze_result_t, ZE_RESULT_SUCCESS,
+                     (const char *name,
+                      bool begin));
+
     ADDMETHOD_NOBASE(appendMemAdvise, ze_result_t, ZE_RESULT_SUCCESS,
                      (ze_device_handle_t hDevice,
                       const void *ptr,
@@ -195,6 +223,7 @@ struct MockCommandList : public CommandList {
     ADDMETHOD_NOBASE(appendPageFaultCopy, ze_result_t, ZE_RESULT_SUCCESS,
                      (NEO::GraphicsAllocation * dstptr,
                       NEO::GraphicsAllocation *srcptr,
+                      size_t offset,
                       size_t size,
                       bool flushHost));
 
@@ -23,8 +23,11 @@ struct WhiteBox<::L0::CommandQueue> : public ::L0::CommandQueueImp {
     using BaseClass::commandStream;
     using BaseClass::csr;
     using BaseClass::device;
+    using BaseClass::mergeSortedResidencyContainers;
     using BaseClass::printfFunctionContainer;
+    using BaseClass::sliceCount;
     using BaseClass::synchronizeByPollingForTaskCount;
+    using BaseClass::taskCount;
     using CommandQueue::commandQueuePreemptionMode;
     using CommandQueue::internalUsage;
 
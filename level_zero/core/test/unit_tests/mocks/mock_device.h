@@ -244,6 +244,10 @@ struct Mock<Device> : public Device {
         return ZE_RESULT_SUCCESS;
     }
 
+    ze_result_t getCsrForHighPriority(NEO::CommandStreamReceiver **csr, NEO::EngineGroupType engineGroupType) override {
+        return ZE_RESULT_SUCCESS;
+    }
+
     ze_result_t mapOrdinalForAvailableEngineGroup(uint32_t *ordinal) override {
         return ZE_RESULT_SUCCESS;
     }
@@ -24,8 +24,10 @@ struct WhiteBox<::L0::Module> : public ::L0::ModuleImp {
     using BaseClass::BaseClass;
     using BaseClass::device;
     using BaseClass::exportedFunctionsSurface;
+    using BaseClass::isaHeaps;
     using BaseClass::isFullyLinked;
     using BaseClass::kernelImmDatas;
+    using BaseClass::lazyKernelIsaUpload;
     using BaseClass::symbols;
     using BaseClass::translationUnit;
     using BaseClass::type;
@@ -8,6 +8,7 @@
 #include "shared/source/gmm_helper/gmm_helper.h"
 #include "shared/source/helpers/register_offsets.h"
 #include "shared/test/common/cmd_parse/gen_cmd_parse.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
 
 #include "opencl/test/unit_test/mocks/mock_memory_manager.h"
@@ -149,6 +150,45 @@ TEST_F(CommandListCreate, givenValidPtrThenAppendMemAdviseReturnsSuccess) {
     ASSERT_EQ(res, ZE_RESULT_SUCCESS);
 }
 
+TEST_F(CommandListCreate, givenValidPtrWhenAppendingMemAdviseThenAdviseFlagsAreStoredInAllocationData) {
+    size_t size = 10;
+    size_t alignment = 1u;
+    void *ptr = nullptr;
+
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    auto res = driverHandle->allocDeviceMem(device->toHandle(),
+                                            &deviceDesc,
+                                            size, alignment, &ptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    EXPECT_NE(nullptr, ptr);
+    auto allocData = driverHandle->getSvmAllocsManager()->getSVMAlloc(ptr);
+    ASSERT_NE(nullptr, allocData);
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, returnValue));
+    ASSERT_NE(nullptr, commandList);
+
+    res = commandList->appendMemAdvise(device, ptr, size, ZE_MEMORY_ADVICE_SET_READ_MOSTLY);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    EXPECT_EQ(1u, allocData->memAdviseFlags.readMostly);
+
+    res = commandList->appendMemAdvise(device, ptr, size, ZE_MEMORY_ADVICE_SET_PREFERRED_LOCATION);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    EXPECT_EQ(1u, allocData->memAdviseFlags.readMostly);
+    EXPECT_EQ(1u, allocData->memAdviseFlags.devicePreferredLocation);
+
+    res = commandList->appendMemAdvise(device, ptr, size, ZE_MEMORY_ADVICE_CLEAR_READ_MOSTLY);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    EXPECT_EQ(0u, allocData->memAdviseFlags.readMostly);
+
+    res = commandList->appendMemAdvise(device, ptr, size, ZE_MEMORY_ADVICE_CLEAR_PREFERRED_LOCATION);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    EXPECT_EQ(0u, allocData->memAdviseFlags.devicePreferredLocation);
+
+    res = driverHandle->freeMem(ptr);
+    ASSERT_EQ(res, ZE_RESULT_SUCCESS);
+}
+
 TEST_F(CommandListCreate, givenValidPtrThenAppendMemoryPrefetchReturnsSuccess) {
     size_t size = 10;
     size_t alignment = 1u;
@@ -230,6 +270,117 @@ TEST_F(CommandListCreate, givenNonInternalUsageCommandListThenIsInternalReturnsF
     EXPECT_FALSE(commandList0->isInternal());
 }
 
+TEST_F(CommandListCreate, givenDirectSubmissionDisabledWhenImmediateCommandListIsCreatedThenFlushTaskSubmissionIsNotUsed) {
+    const ze_command_queue_desc_t desc = {};
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::createImmediate(productFamily, device, &desc, false, NEO::EngineGroupType::RenderCompute, returnValue));
+    ASSERT_NE(nullptr, commandList);
+
+    EXPECT_EQ(commandList->csr->isDirectSubmissionEnabled(), commandList->isFlushTaskSubmissionEnabled);
+}
+
+TEST_F(CommandListCreate, givenFlushTaskSubmissionForcedWhenImmediateCommandListIsCreatedThenItIsUsedOnlyForComputeEngines) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableFlushTaskSubmission.set(1);
+
+    ze_command_queue_desc_t desc = {};
+    desc.mode = ZE_COMMAND_QUEUE_MODE_SYNCHRONOUS;
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::createImmediate(productFamily, device, &desc, false, NEO::EngineGroupType::RenderCompute, returnValue));
+    ASSERT_NE(nullptr, commandList);
+    EXPECT_TRUE(commandList->isFlushTaskSubmissionEnabled);
+    EXPECT_TRUE(commandList->isSyncModeQueue);
+
+    auto &csr = *neoDevice->getDefaultEngine().commandStreamReceiver;
+    EXPECT_TRUE(CommandList::isFlushTaskSubmissionPreferred(csr, NEO::EngineGroupType::Compute, false));
+    EXPECT_FALSE(CommandList::isFlushTaskSubmissionPreferred(csr, NEO::EngineGroupType::Copy, false));
+
+    NEO::DebugManager.flags.EnableFlushTaskSubmission.set(0);
+    EXPECT_FALSE(CommandList::isFlushTaskSubmissionPreferred(csr, NEO::EngineGroupType::Compute, false));
+}
+
+TEST_F(CommandListCreate, givenFlushTaskSubmissionEnabledWhenAppendingToImmediateCommandListThenCommandsAreFlushedThroughCsrWithoutCommandQueue) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableFlushTaskSubmission.set(1);
+
+    ze_command_queue_desc_t desc = {};
+    desc.mode = ZE_COMMAND_QUEUE_MODE_SYNCHRONOUS;
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::createImmediate(productFamily, device, &desc, false, NEO::EngineGroupType::RenderCompute, returnValue));
+    ASSERT_NE(nullptr, commandList);
+    auto csr = commandList->csr;
+    auto commandQueue = static_cast<CommandQueueImp *>(commandList->cmdQImmediate);
+    auto commandQueueTaskCount = commandQueue->getTaskCount();
+    auto csrTaskCount = csr->peekTaskCount();
+    auto commandStream = commandList->commandContainer.getCommandStream();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendBarrier(nullptr, 0, nullptr));
+    EXPECT_EQ(csrTaskCount + 1, csr->peekTaskCount());
+    EXPECT_EQ(commandQueueTaskCount, commandQueue->getTaskCount());
+    auto usedAfterFirstAppend = commandStream->getUsed();
+    EXPECT_NE(0u, usedAfterFirstAppend);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendBarrier(nullptr, 0, nullptr));
+    EXPECT_EQ(csrTaskCount + 2, csr->peekTaskCount());
+    EXPECT_LT(usedAfterFirstAppend, commandStream->getUsed());
+    EXPECT_EQ(1u, commandList->commandContainer.getCmdBufferAllocations().size());
+}
+
+TEST_F(CommandListCreate, givenFlushTaskSubmissionEnabledWhenCommandStreamIsAlmostFullThenItIsRecycledBeforeAppend) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableFlushTaskSubmission.set(1);
+
+    ze_command_queue_desc_t desc = {};
+    desc.mode = ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS;
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::createImmediate(productFamily, device, &desc, false, NEO::EngineGroupType::RenderCompute, returnValue));
+    ASSERT_NE(nullptr, commandList);
+    EXPECT_FALSE(commandList->isSyncModeQueue);
+
+    auto commandStream = commandList->commandContainer.getCommandStream();
+    commandStream->getSpace(commandStream->getAvailableSpace() - 1024u);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendBarrier(nullptr, 0, nullptr));
+
+    EXPECT_GT(commandStream->getAvailableSpace(), commandStream->getMaxAvailableSpace() / 2);
+    EXPECT_EQ(1u, commandList->commandContainer.getCmdBufferAllocations().size());
+}
+
+TEST_F(CommandListCreate, givenFlushTaskSubmissionEnabledWhenAppendSpillsIntoNextCommandBufferThenListIsExecutedThroughCommandQueueWithoutFlushedCommands) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableFlushTaskSubmission.set(1);
+
+    ze_command_queue_desc_t desc = {};
+    desc.mode = ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS;
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::createImmediate(productFamily, device, &desc, false, NEO::EngineGroupType::RenderCompute, returnValue));
+    ASSERT_NE(nullptr, commandList);
+    auto commandQueue = static_cast<CommandQueueImp *>(commandList->cmdQImmediate);
+    auto &cmdBufferAllocations = commandList->commandContainer.getCmdBufferAllocations();
+    auto firstCmdBuffer = cmdBufferAllocations[0];
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendBarrier(nullptr, 0, nullptr));
+    auto flushedSize = commandList->commandContainer.getCommandStream()->getUsed();
+    ASSERT_NE(0u, flushedSize);
+    auto commandQueueTaskCount = commandQueue->getTaskCount();
+
+    commandList->commandContainer.allocateNextCommandBuffer();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendBarrier(nullptr, 0, nullptr));
+
+    EXPECT_NE(commandQueueTaskCount, commandQueue->getTaskCount());
+    EXPECT_EQ(1u, cmdBufferAllocations.size());
+    EXPECT_EQ(firstCmdBuffer, cmdBufferAllocations[0]);
+    std::vector<uint8_t> noops(flushedSize, 0u);
+    EXPECT_EQ(0, memcmp(noops.data(), firstCmdBuffer->getUnderlyingBuffer(), flushedSize));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendBarrier(nullptr, 0, nullptr));
+    EXPECT_NE(0u, commandList->commandContainer.getCommandStream()->getUsed());
+}
+
 TEST_F(CommandListCreate, givenImmediateCommandListThenCustomNumIddPerBlockUsed) {
     const ze_command_queue_desc_t desc = {};
 
@@ -598,6 +749,9 @@ using AppendQueryKernelTimestamps = CommandListCreate;
 using TestPlatforms = IsAtLeastProduct<IGFX_SKYLAKE>;
 
 HWTEST2_F(AppendQueryKernelTimestamps, givenCommandListWhenAppendQueryKernelTimestampsWithoutOffsetsThenProperBuiltinWasAdded, TestPlatforms) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableQueryKernelTimestampsWithStores.set(0);
+
     std::unique_ptr<MockDeviceForSpv<false>> testDevice = std::unique_ptr<MockDeviceForSpv<false>>(new MockDeviceForSpv<false>(device->getNEODevice(), device->getNEODevice()->getExecutionEnvironment(), driverHandle.get()));
     testDevice->builtins.reset(new MockBuiltinFunctionsLibImplTimestamps(testDevice.get(), testDevice->getNEODevice()->getBuiltIns()));
     testDevice->getBuiltinFunctionsLib()->initBuiltinKernel(L0::Builtin::QueryKernelTimestamps);
@@ -656,6 +810,9 @@ HWTEST2_F(AppendQueryKernelTimestamps, givenCommandListWhenAppendQueryKernelTime
 }
 
 HWTEST2_F(AppendQueryKernelTimestamps, givenCommandListWhenAppendQueryKernelTimestampsWithOffsetsThenProperBuiltinWasAdded, TestPlatforms) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableQueryKernelTimestampsWithStores.set(0);
+
     std::unique_ptr<MockDeviceForSpv<false>> testDevice = std::unique_ptr<MockDeviceForSpv<false>>(new MockDeviceForSpv<false>(device->getNEODevice(), device->getNEODevice()->getExecutionEnvironment(), driverHandle.get()));
     testDevice->builtins.reset(new MockBuiltinFunctionsLibImplTimestamps(testDevice.get(), testDevice->getNEODevice()->getBuiltIns()));
     testDevice->getBuiltinFunctionsLib()->initBuiltinKernel(L0::Builtin::QueryKernelTimestamps);
@@ -719,6 +876,9 @@ HWTEST2_F(AppendQueryKernelTimestamps, givenCommandListWhenAppendQueryKernelTime
 }
 
 HWTEST2_F(AppendQueryKernelTimestamps, givenCommandListWhenAppendQueryKernelTimestampsWithEventsNumberBiggerThanMaxWorkItemSizeThenProperGroupSizeAndGroupCountIsSet, TestPlatforms) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableQueryKernelTimestampsWithStores.set(0);
+
     std::unique_ptr<MockDeviceForSpv<false>> testDevice = std::unique_ptr<MockDeviceForSpv<false>>(new MockDeviceForSpv<false>(device->getNEODevice(), device->getNEODevice()->getExecutionEnvironment(), driverHandle.get()));
     testDevice->builtins.reset(new MockBuiltinFunctionsLibImplTimestamps(testDevice.get(), testDevice->getNEODevice()->getBuiltIns()));
     testDevice->getBuiltinFunctionsLib()->initBuiltinKernel(L0::Builtin::QueryKernelTimestamps);
@@ -768,6 +928,9 @@ HWTEST2_F(AppendQueryKernelTimestamps, givenCommandListWhenAppendQueryKernelTime
 }
 
 HWTEST2_F(AppendQueryKernelTimestamps, givenCommandListWhenAppendQueryKernelTimestampsAndInvalidResultSuggestGroupSizeThenUnknownResultReturned, TestPlatforms) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableQueryKernelTimestampsWithStores.set(0);
+
     class MockQueryKernelTimestampsKernel : public L0::KernelImp {
       public:
         ze_result_t suggestGroupSize(uint32_t globalSizeX, uint32_t globalSizeY,
@@ -846,6 +1009,9 @@ HWTEST2_F(AppendQueryKernelTimestamps, givenCommandListWhenAppendQueryKernelTime
 }
 
 HWTEST2_F(AppendQueryKernelTimestamps, givenCommandListWhenAppendQueryKernelTimestampsAndInvalidResultSetGroupSizeThenUnknownResultReturned, TestPlatforms) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableQueryKernelTimestampsWithStores.set(0);
+
     class MockQueryKernelTimestampsKernel : public L0::KernelImp {
       public:
         ze_result_t suggestGroupSize(uint32_t globalSizeX, uint32_t globalSizeY,
@@ -930,6 +1096,47 @@ HWTEST2_F(AppendQueryKernelTimestamps, givenCommandListWhenAppendQueryKernelTime
     driverHandle->freeMem(alloc);
 }
 
+HWTEST2_F(AppendQueryKernelTimestamps, givenSinglePacketEventsWhenAppendQueryKernelTimestampsThenTimestampsAreCopiedWithRegisterStoresInsteadOfBuiltin, TestPlatforms) {
+    using MI_LOAD_REGISTER_MEM = typename FamilyType::MI_LOAD_REGISTER_MEM;
+    using MI_STORE_REGISTER_MEM = typename FamilyType::MI_STORE_REGISTER_MEM;
+
+    MockCommandListForAppendLaunchKernel<gfxCoreFamily> commandList;
+    commandList.initialize(device, NEO::EngineGroupType::RenderCompute);
+
+    MockEvent event;
+    event.waitScope = ZE_EVENT_SCOPE_FLAG_HOST;
+    event.signalScope = ZE_EVENT_SCOPE_FLAG_HOST;
+    event.increasePacketsInUse();
+
+    void *alloc;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    auto result = driverHandle->allocDeviceMem(device, &deviceDesc, 128, 1, &alloc);
+    EXPECT_EQ(result, ZE_RESULT_SUCCESS);
+    ze_event_handle_t events[2] = {event.toHandle(), event.toHandle()};
+
+    result = commandList.appendQueryKernelTimestamps(2u, events, alloc, nullptr, nullptr, 0u, nullptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(nullptr, commandList.cmdListHelper.isaAllocation);
+
+    GenCmdList cmdList;
+    ASSERT_TRUE(FamilyType::PARSE::parseCommandBuffer(
+        cmdList, ptrOffset(commandList.commandContainer.getCommandStream()->getCpuBase(), 0), commandList.commandContainer.getCommandStream()->getUsed()));
+
+    auto loadRegisterMems = findAll<MI_LOAD_REGISTER_MEM *>(cmdList.begin(), cmdList.end());
+    auto storeRegisterMems = findAll<MI_STORE_REGISTER_MEM *>(cmdList.begin(), cmdList.end());
+    EXPECT_EQ(8u, loadRegisterMems.size());
+    EXPECT_EQ(16u, storeRegisterMems.size());
+
+    auto dstAddress = reinterpret_cast<uint64_t>(alloc);
+    auto firstLoad = genCmdCast<MI_LOAD_REGISTER_MEM *>(*loadRegisterMems[0]);
+    EXPECT_EQ(event.getGpuAddress() + offsetof(TimestampPacketStorage::Packet, globalStart), firstLoad->getMemoryAddress());
+    auto lastStore = genCmdCast<MI_STORE_REGISTER_MEM *>(*storeRegisterMems[15]);
+    EXPECT_EQ(dstAddress + sizeof(ze_kernel_timestamp_result_t) + offsetof(ze_kernel_timestamp_result_t, context.kernelEnd) + sizeof(uint32_t),
+              lastStore->getMemoryAddress());
+
+    driverHandle->freeMem(alloc);
+}
+
 HWTEST_F(CommandListCreate, givenCommandListWithCopyOnlyWhenAppendSignalEventThenMiFlushDWIsProgrammed) {
     using MI_FLUSH_DW = typename FamilyType::MI_FLUSH_DW;
     ze_result_t returnValue;
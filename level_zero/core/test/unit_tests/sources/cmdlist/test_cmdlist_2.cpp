@@ -145,6 +145,20 @@ HWTEST2_F(CommandListCreate, givenCommandListWhenMemoryCopyCalledThenAppendMemor
     EXPECT_GT(cmdList.appendMemoryCopyBlitCalledTimes, 0u);
 }
 
+HWTEST2_F(CommandListCreate, givenCopyOnlyCommandListWhenPageFaultCopyIsAppendedThenBlitIsUsed, Platforms) {
+    MockCommandListHw<gfxCoreFamily> cmdList;
+    cmdList.initialize(device, NEO::EngineGroupType::Copy);
+    NEO::MockGraphicsAllocation mockAllocationSrc(0, NEO::GraphicsAllocation::AllocationType::SVM_CPU,
+                                                  reinterpret_cast<void *>(0x1234), 0x1000, 0, sizeof(uint32_t),
+                                                  MemoryPool::System4KBPages);
+    NEO::MockGraphicsAllocation mockAllocationDst(0, NEO::GraphicsAllocation::AllocationType::SVM_GPU,
+                                                  reinterpret_cast<void *>(0x2345), 0x1000, 0, sizeof(uint32_t),
+                                                  MemoryPool::System4KBPages);
+    auto ret = cmdList.appendPageFaultCopy(&mockAllocationDst, &mockAllocationSrc, 0x100, 0x200, false);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, ret);
+    EXPECT_EQ(1u, cmdList.appendMemoryCopyBlitCalledTimes);
+}
+
 HWTEST2_F(CommandListCreate, givenCommandListWhenMemoryCopyRegionCalledThenAppendMemoryCopyWithappendMemoryCopyWithBliterCalled, Platforms) {
     MockCommandListHw<gfxCoreFamily> cmdList;
     cmdList.initialize(device, NEO::EngineGroupType::Copy);
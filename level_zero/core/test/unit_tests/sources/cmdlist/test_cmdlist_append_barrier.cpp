@@ -7,6 +7,7 @@
 
 #include "shared/source/command_container/command_encoder.h"
 #include "shared/test/common/cmd_parse/gen_cmd_parse.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 
 #include "test.h"
 
@@ -79,5 +80,39 @@ HWTEST_F(CommandListAppendBarrier, GivenEventVsNoEventWhenAppendingBarrierThenCo
 
     ASSERT_LE(sizeWithoutEvent, sizeWithEvent);
 }
+
+HWTEST_F(CommandListAppendBarrier, GivenBarrierAppendedTwiceWhenNothingIsRecordedInBetweenThenSecondBarrierIsSkipped) {
+    auto result = commandList->appendBarrier(nullptr, 0, nullptr);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    auto usedSpaceAfterFirstBarrier = commandList->commandContainer.getCommandStream()->getUsed();
+
+    result = commandList->appendBarrier(nullptr, 0, nullptr);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(usedSpaceAfterFirstBarrier, commandList->commandContainer.getCommandStream()->getUsed());
+}
+
+HWTEST_F(CommandListAppendBarrier, GivenSignalEventWhenAppendingBarrierRightAfterThenBarrierIsSkipped) {
+    auto result = commandList->appendSignalEvent(event->toHandle());
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    auto usedSpaceAfterSignal = commandList->commandContainer.getCommandStream()->getUsed();
+
+    result = commandList->appendBarrier(nullptr, 0, nullptr);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(usedSpaceAfterSignal, commandList->commandContainer.getCommandStream()->getUsed());
+}
+
+HWTEST_F(CommandListAppendBarrier, GivenElideRedundantPipeControlsDisabledWhenAppendingBarrierTwiceThenBothBarriersAreProgrammed) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.ElideRedundantPipeControls.set(0);
+
+    auto result = commandList->appendBarrier(nullptr, 0, nullptr);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    auto usedSpaceAfterFirstBarrier = commandList->commandContainer.getCommandStream()->getUsed();
+
+    result = commandList->appendBarrier(nullptr, 0, nullptr);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_LT(usedSpaceAfterFirstBarrier, commandList->commandContainer.getCommandStream()->getUsed());
+}
+
 } // namespace ult
 } // namespace L0
\ No newline at end of file
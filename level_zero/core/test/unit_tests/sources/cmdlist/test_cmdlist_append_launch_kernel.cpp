@@ -14,6 +14,7 @@
 
 #include "test.h"
 
+#include "level_zero/api/extensions/public/ze_exp_ext.h"
 #include "level_zero/core/source/cmdlist/cmdlist_hw_immediate.h"
 #include "level_zero/core/test/unit_tests/fixtures/module_fixture.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_cmdlist.h"
@@ -84,6 +85,37 @@ HWTEST_F(CommandListAppendLaunchKernelSWTags, givenEnableSWTagsWhenAppendLaunchK
     EXPECT_TRUE(tagFound);
 }
 
+HWTEST_F(CommandListAppendLaunchKernelSWTags, givenEnableSWTagsWhenAppendingRangeMarkersThenBeginAndEndTagsAreInserted) {
+    using MI_NOOP = typename FamilyType::MI_NOOP;
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, returnValue));
+    auto cmdStream = commandList->commandContainer.getCommandStream();
+    auto usedSpaceBefore = cmdStream->getUsed();
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, zexCommandListAppendSWTagRangeBegin(commandList->toHandle(), nullptr));
+    EXPECT_EQ(usedSpaceBefore, cmdStream->getUsed());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexCommandListAppendSWTagRangeBegin(commandList->toHandle(), "frame"));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexCommandListAppendSWTagRangeEnd(commandList->toHandle()));
+    ASSERT_EQ(usedSpaceBefore + 4 * sizeof(MI_NOOP), cmdStream->getUsed());
+
+    auto noops = reinterpret_cast<MI_NOOP *>(ptrOffset(cmdStream->getCpuBase(), usedSpaceBefore));
+    EXPECT_EQ(NEO::SWTags::BaseTag::getMarkerNoopID(SWTags::OpCode::UserRangeBegin), noops[0].getIdentificationNumber());
+    EXPECT_EQ(NEO::SWTags::BaseTag::getMarkerNoopID(SWTags::OpCode::UserRangeEnd), noops[2].getIdentificationNumber());
+}
+
+HWTEST_F(CommandListAppendLaunchKernel, givenSWTagsDisabledWhenAppendingRangeMarkersThenNothingIsInserted) {
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, returnValue));
+    auto cmdStream = commandList->commandContainer.getCommandStream();
+    auto usedSpaceBefore = cmdStream->getUsed();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexCommandListAppendSWTagRangeBegin(commandList->toHandle(), "frame"));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexCommandListAppendSWTagRangeEnd(commandList->toHandle()));
+    EXPECT_EQ(usedSpaceBefore, cmdStream->getUsed());
+}
+
 HWTEST_F(CommandListAppendLaunchKernel, givenKernelWithIndirectAllocationsAllowedThenCommandListReturnsExpectedIndirectAllocationsAllowed) {
     createKernel();
     kernel->unifiedMemoryControls.indirectDeviceAllocationsAllowed = true;
@@ -1009,5 +1041,168 @@ HWCMDTEST_F(IGFX_GEN8_CORE, CommandListAppendLaunchKernel, givenAppendLaunchMult
     device->getDriverHandle()->freeMem(reinterpret_cast<void *>(numLaunchArgs));
 }
 
+HWTEST2_F(CommandListAppendLaunchKernel, givenMutableKernelLaunchWhenUpdatingGroupCountThenWalkerAndCrossThreadDataArePatchedInPlace, SklPlusMatcher) {
+    using WALKER_TYPE = typename FamilyType::WALKER_TYPE;
+    createKernel();
+    auto commandList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+    commandList->initialize(device, NEO::EngineGroupType::RenderCompute);
+
+    ze_group_count_t groupCount{1, 1, 1};
+    uint32_t commandId = std::numeric_limits<uint32_t>::max();
+    auto result = commandList->appendLaunchMutableKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr, &commandId);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(0u, commandId);
+    commandList->close();
+    auto usedSpace = commandList->commandContainer.getCommandStream()->getUsed();
+
+    ze_group_count_t newGroupCount{4, 3, 2};
+    result = commandList->updateMutableGroupCount(commandId, &newGroupCount);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(usedSpace, commandList->commandContainer.getCommandStream()->getUsed());
+
+    auto &locations = commandList->mutableKernelCommands[commandId].locations;
+    auto walker = reinterpret_cast<WALKER_TYPE *>(locations.walkerCmd);
+    EXPECT_EQ(4u, walker->getThreadGroupIdXDimension());
+    EXPECT_EQ(3u, walker->getThreadGroupIdYDimension());
+    EXPECT_EQ(2u, walker->getThreadGroupIdZDimension());
+
+    const auto &numWorkGroups = kernel->getKernelDescriptor().payloadMappings.dispatchTraits.numWorkGroups;
+    uint32_t expectedGroupCount[3] = {4, 3, 2};
+    for (uint32_t i = 0; i < 3; i++) {
+        if (NEO::isValidOffset(numWorkGroups[i])) {
+            EXPECT_EQ(expectedGroupCount[i], *reinterpret_cast<uint32_t *>(ptrOffset(locations.crossThreadData, numWorkGroups[i])));
+        }
+    }
+}
+
+HWTEST2_F(CommandListAppendLaunchKernel, givenMutableKernelLaunchWhenUpdatingBufferArgumentThenCrossThreadDataIsPatchedAndAllocationIsResident, SklPlusMatcher) {
+    createKernel();
+    auto commandList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+    commandList->initialize(device, NEO::EngineGroupType::RenderCompute);
+
+    ze_group_count_t groupCount{1, 1, 1};
+    uint32_t commandId = 0u;
+    auto result = commandList->appendLaunchMutableKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr, &commandId);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    commandList->close();
+
+    void *buffer = nullptr;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    result = device->getDriverHandle()->allocDeviceMem(device->toHandle(), &deviceDesc, 4096u, 4096u, &buffer);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    result = commandList->updateMutableKernelArgument(commandId, 0u, sizeof(buffer), &buffer);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+
+    auto allocation = device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(buffer)->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex());
+    auto &residencyContainer = commandList->commandContainer.getResidencyContainer();
+    EXPECT_NE(residencyContainer.end(), std::find(residencyContainer.begin(), residencyContainer.end(), allocation));
+
+    const auto &arg = kernel->getKernelDescriptor().payloadMappings.explicitArgs[0].as<NEO::ArgDescPointer>();
+    if (NEO::isValidOffset(arg.stateless)) {
+        auto &locations = commandList->mutableKernelCommands[commandId].locations;
+        uint64_t patchedAddress = 0u;
+        memcpy_s(&patchedAddress, sizeof(patchedAddress), ptrOffset(locations.crossThreadData, arg.stateless), arg.pointerSize);
+        EXPECT_EQ(allocation->getGpuAddress(), patchedAddress);
+    }
+
+    device->getDriverHandle()->freeMem(buffer);
+}
+
+HWTEST2_F(CommandListAppendLaunchKernel, givenMutableKernelLaunchWhenUpdatingImageArgumentOrUnknownCommandThenErrorIsReturned, SklPlusMatcher) {
+    createKernel();
+    auto commandList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+    commandList->initialize(device, NEO::EngineGroupType::RenderCompute);
+
+    ze_group_count_t groupCount{1, 1, 1};
+    uint32_t commandId = 0u;
+    auto result = commandList->appendLaunchMutableKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr, &commandId);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    commandList->close();
+
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->updateMutableKernelArgument(commandId, 3u, sizeof(ze_image_handle_t), nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateMutableKernelArgument(commandId, numKernelArguments, 0u, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateMutableKernelArgument(commandId + 1, 0u, 0u, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateMutableGroupCount(commandId + 1, &groupCount));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, commandList->updateMutableGroupCount(commandId, nullptr));
+
+    commandList->reset();
+    EXPECT_TRUE(commandList->mutableKernelCommands.empty());
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateMutableGroupCount(commandId, &groupCount));
+}
+
+HWTEST2_F(CommandListAppendLaunchKernel, givenImmediateCommandListWhenAppendingMutableKernelThenUnsupportedFeatureIsReturned, SklPlusMatcher) {
+    createKernel();
+    auto commandList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+    commandList->initialize(device, NEO::EngineGroupType::RenderCompute);
+    commandList->cmdListType = CommandList::CommandListType::TYPE_IMMEDIATE;
+
+    ze_group_count_t groupCount{1, 1, 1};
+    uint32_t commandId = 0u;
+    auto result = commandList->appendLaunchMutableKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr, &commandId);
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, result);
+    EXPECT_TRUE(commandList->mutableKernelCommands.empty());
+}
+
+HWTEST2_F(CommandListAppendLaunchKernel, givenKernelTimingHistogramWhenAppendingLaunchKernelThenEachBucketIsUpdatedAfterWalker, SklPlusMatcher) {
+    using MI_STORE_REGISTER_MEM = typename FamilyType::MI_STORE_REGISTER_MEM;
+    using WALKER_TYPE = typename FamilyType::WALKER_TYPE;
+
+    createKernel();
+    auto commandList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+    commandList->initialize(device, NEO::EngineGroupType::RenderCompute);
+
+    void *histogram = nullptr;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    auto result = device->getDriverHandle()->allocDeviceMem(device->toHandle(), &deviceDesc, 4096u, 4096u, &histogram);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    uint32_t notUsm[CommandList::kernelTimingHistogramBuckets] = {};
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->setKernelTimingHistogram(notUsm));
+    EXPECT_EQ(nullptr, commandList->kernelTimingHistogramAllocation);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->setKernelTimingHistogram(histogram));
+    EXPECT_NE(nullptr, commandList->kernelTimingHistogramAllocation);
+    EXPECT_LT(0u, commandList->kernelTimingThresholds[0]);
+    for (uint32_t i = 1; i < commandList->kernelTimingThresholds.size(); i++) {
+        EXPECT_LT(commandList->kernelTimingThresholds[i - 1], commandList->kernelTimingThresholds[i]);
+    }
+
+    ze_group_count_t groupCount{1, 1, 1};
+    result = commandList->appendLaunchKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->setKernelTimingHistogram(nullptr));
+    result = commandList->appendLaunchKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    GenCmdList cmdList;
+    ASSERT_TRUE(FamilyType::PARSE::parseCommandBuffer(
+        cmdList, ptrOffset(commandList->commandContainer.getCommandStream()->getCpuBase(), 0), commandList->commandContainer.getCommandStream()->getUsed()));
+
+    auto walkers = findAll<WALKER_TYPE *>(cmdList.begin(), cmdList.end());
+    ASSERT_EQ(2u, walkers.size());
+
+    auto histogramAddress = reinterpret_cast<uint64_t>(histogram);
+    uint32_t bucketStores = 0u;
+    for (auto itor = walkers[0]; itor != walkers[1]; itor++) {
+        auto storeRegMem = genCmdCast<MI_STORE_REGISTER_MEM *>(*itor);
+        if (storeRegMem && storeRegMem->getMemoryAddress() == histogramAddress + bucketStores * sizeof(uint32_t)) {
+            EXPECT_EQ(CS_GPR_R12, storeRegMem->getRegisterAddress());
+            bucketStores++;
+        }
+    }
+    EXPECT_EQ(CommandList::kernelTimingHistogramBuckets, bucketStores);
+
+    for (auto itor = walkers[1]; itor != cmdList.end(); itor++) {
+        auto storeRegMem = genCmdCast<MI_STORE_REGISTER_MEM *>(*itor);
+        if (storeRegMem) {
+            EXPECT_NE(CS_GPR_R12, storeRegMem->getRegisterAddress());
+        }
+    }
+
+    device->getDriverHandle()->freeMem(histogram);
+}
+
 } // namespace ult
 } // namespace L0
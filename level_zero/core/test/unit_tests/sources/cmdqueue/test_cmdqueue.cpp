@@ -22,6 +22,8 @@
 #include "opencl/test/unit_test/mocks/mock_memory_manager.h"
 #include "test.h"
 
+#include "level_zero/api/extensions/public/ze_exp_ext.h"
+#include "level_zero/core/source/cmdqueue/cmdqueue_balanced.h"
 #include "level_zero/core/source/context/context.h"
 #include "level_zero/core/source/driver/driver_handle_imp.h"
 #include "level_zero/core/test/unit_tests/fixtures/device_fixture.h"
@@ -97,6 +99,62 @@ TEST_F(CommandQueueCreate, whenSynchronizeByPollingTaskCountThenCallsPrintOutput
     commandQueue->destroy();
 }
 
+TEST_F(CommandQueueCreate, whenSynchronizeCompletesThenWaitIsCountedInSubmissionStatistics) {
+    const ze_command_queue_desc_t desc{};
+    ze_result_t returnValue;
+    auto commandQueue = whitebox_cast(CommandQueue::create(productFamily,
+                                                           device,
+                                                           neoDevice->getDefaultEngine().commandStreamReceiver,
+                                                           &desc,
+                                                           false,
+                                                           false,
+                                                           returnValue));
+
+    auto countWaits = [](const zex_command_queue_submission_statistics_t &statistics) {
+        uint64_t waits = 0u;
+        for (auto bucket : statistics.waitTimeHistogram) {
+            waits += bucket;
+        }
+        return waits;
+    };
+
+    zex_command_queue_submission_statistics_t statisticsBefore = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexCommandQueueGetSubmissionStatistics(commandQueue->toHandle(), &statisticsBefore));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandQueue->synchronizeByPollingForTaskCount(0u));
+
+    zex_command_queue_submission_statistics_t statistics = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexCommandQueueGetSubmissionStatistics(commandQueue->toHandle(), &statistics));
+    EXPECT_EQ(countWaits(statisticsBefore) + 1, countWaits(statistics));
+    EXPECT_EQ(statisticsBefore.flushes, statistics.flushes);
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, zexCommandQueueGetSubmissionStatistics(commandQueue->toHandle(), nullptr));
+
+    commandQueue->destroy();
+}
+
+TEST_F(CommandQueueCreate, whenSettingSliceCountThenOnlyCountsUpToDeviceSliceCountAreAccepted) {
+    const ze_command_queue_desc_t desc{};
+    ze_result_t returnValue;
+    auto commandQueue = whitebox_cast(CommandQueue::create(productFamily,
+                                                           device,
+                                                           neoDevice->getDefaultEngine().commandStreamReceiver,
+                                                           &desc,
+                                                           false,
+                                                           false,
+                                                           returnValue));
+    auto deviceSliceCount = device->getHwInfo().gtSystemInfo.SliceCount;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexCommandQueueSetSliceCount(commandQueue->toHandle(), 1u));
+    EXPECT_EQ(1u, commandQueue->sliceCount);
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zexCommandQueueSetSliceCount(commandQueue->toHandle(), deviceSliceCount + 1));
+    EXPECT_EQ(1u, commandQueue->sliceCount);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexCommandQueueSetSliceCount(commandQueue->toHandle(), 0u));
+    EXPECT_EQ(NEO::QueueSliceCount::defaultSliceCount, commandQueue->sliceCount);
+
+    commandQueue->destroy();
+}
+
 TEST_F(CommandQueueCreate, whenReserveLinearStreamThenBufferAllocationSwitched) {
     const ze_command_queue_desc_t desc{};
     ze_result_t returnValue;
@@ -126,6 +184,25 @@ TEST_F(CommandQueueCreate, whenReserveLinearStreamThenBufferAllocationSwitched)
     commandQueue->destroy();
 }
 
+TEST(CommandQueueResidencyMerge, givenSortedResidencyContainersWhenMergingThenOutputIsSortedAndContainsEachAllocationOnce) {
+    MockGraphicsAllocation allocations[5];
+
+    NEO::ResidencyContainer first = {&allocations[0], &allocations[2], &allocations[4]};
+    NEO::ResidencyContainer second = {&allocations[1], &allocations[2]};
+    NEO::ResidencyContainer empty;
+    NEO::ResidencyContainer third = {&allocations[3], &allocations[4]};
+
+    NEO::GraphicsAllocation *queueAllocation = reinterpret_cast<NEO::GraphicsAllocation *>(0x1234);
+    NEO::ResidencyContainer output = {queueAllocation};
+    CommandQueue::mergeSortedResidencyContainers({&first, &second, &empty, &third}, output);
+
+    ASSERT_EQ(6u, output.size());
+    EXPECT_EQ(queueAllocation, output[0]);
+    for (auto i = 0u; i < 5u; i++) {
+        EXPECT_EQ(&allocations[i], output[i + 1]);
+    }
+}
+
 TEST_F(CommandQueueCreate, whenCreatingCommandQueueWithInvalidProductFamilyThenFailureIsReturned) {
     const ze_command_queue_desc_t desc = {};
     ze_result_t returnValue;
@@ -470,6 +547,54 @@ TEST_F(CommandQueueCreate, givenCmdQueueWithBlitCopyWhenExecutingCopyBlitCommand
     commandQueue->destroy();
 }
 
+template <typename GfxFamily>
+struct MockCsrHwBlitterDirectSubmission : public MockCsrHw2<GfxFamily> {
+    using MockCsrHw2<GfxFamily>::MockCsrHw2;
+
+    bool isBlitterDirectSubmissionEnabled() const override {
+        return true;
+    }
+
+    bool flush(NEO::BatchBuffer &batchBuffer, NEO::ResidencyContainer &allocationsForResidency) override {
+        flushedEndCmdPtr = batchBuffer.endCmdPtr;
+        return MockCsrHw2<GfxFamily>::flush(batchBuffer, allocationsForResidency);
+    }
+
+    void *flushedEndCmdPtr = nullptr;
+};
+
+HWTEST_F(CommandQueueCreate, givenCopyOnlyCmdQueueAndBlitterDirectSubmissionEnabledWhenExecutingCommandListsThenBatchBufferEndsWithBatchBufferStart) {
+    using MI_BATCH_BUFFER_START = typename FamilyType::MI_BATCH_BUFFER_START;
+    const ze_command_queue_desc_t desc = {};
+    ze_result_t returnValue;
+
+    MockCsrHwBlitterDirectSubmission<FamilyType> csr(*neoDevice->getExecutionEnvironment(), 0, neoDevice->getDeviceBitfield());
+    csr.initializeTagAllocation();
+    csr.setupContext(*neoDevice->getDefaultEngine().osContext);
+
+    L0::CommandQueue *commandQueue = CommandQueue::create(productFamily,
+                                                          device,
+                                                          &csr,
+                                                          &desc,
+                                                          true,
+                                                          false,
+                                                          returnValue);
+    ASSERT_NE(nullptr, commandQueue);
+
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::Copy, returnValue));
+    ASSERT_NE(nullptr, commandList);
+
+    auto commandListHandle = commandList->toHandle();
+    auto status = commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, status);
+
+    ASSERT_NE(nullptr, csr.flushedEndCmdPtr);
+    auto endCmd = genCmdCast<MI_BATCH_BUFFER_START *>(csr.flushedEndCmdPtr);
+    EXPECT_NE(nullptr, endCmd);
+
+    commandQueue->destroy();
+}
+
 using CommandQueueDestroySupport = IsAtLeastProduct<IGFX_SKYLAKE>;
 using CommandQueueDestroy = Test<DeviceFixture>;
 
@@ -673,6 +798,56 @@ TEST_F(DeviceCreateCommandQueueTest, givenLowPriorityDescAndWithoutLowPriorityCs
     EXPECT_THROW(res = device->createCommandQueue(&desc, &commandQueueHandle), std::exception);
 }
 
+struct HighPriorityEngineDeviceFixture : public DeviceFixture {
+    void SetUp() override {
+        DebugManager.flags.EnableHighPriorityEngine.set(1);
+        DeviceFixture::SetUp();
+    }
+
+    DebugManagerStateRestore restorer;
+};
+
+using DeviceCreateHighPriorityCommandQueueTest = Test<HighPriorityEngineDeviceFixture>;
+TEST_F(DeviceCreateHighPriorityCommandQueueTest, givenHighPriorityDescWhenCreateCommandQueueIsCalledThenHighPriorityCsrIsAssigned) {
+    ze_command_queue_desc_t desc{};
+    desc.ordinal = 0u;
+    desc.index = 0u;
+    desc.priority = ZE_COMMAND_QUEUE_PRIORITY_PRIORITY_HIGH;
+
+    ze_command_queue_handle_t commandQueueHandle = {};
+
+    ze_result_t res = device->createCommandQueue(&desc, &commandQueueHandle);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    auto commandQueue = static_cast<CommandQueueImp *>(L0::CommandQueue::fromHandle(commandQueueHandle));
+    EXPECT_NE(commandQueue, nullptr);
+    EXPECT_TRUE(commandQueue->getCsr()->getOsContext().isHighPriority());
+    uint32_t engineGroupIndex = 0u;
+    device->mapOrdinalForAvailableEngineGroup(&engineGroupIndex);
+    NEO::CommandStreamReceiver *csr = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, device->getCsrForHighPriority(&csr, static_cast<NEO::EngineGroupType>(engineGroupIndex)));
+    EXPECT_EQ(commandQueue->getCsr(), csr);
+    commandQueue->destroy();
+}
+
+TEST_F(DeviceCreateCommandQueueTest, givenHighPriorityDescAndWithoutHighPriorityCsrWhenCreateCommandQueueIsCalledThenCsrIsAssignedWithOrdinalAndIndex) {
+    ze_command_queue_desc_t desc{};
+    desc.ordinal = 0u;
+    desc.index = 0u;
+    desc.priority = ZE_COMMAND_QUEUE_PRIORITY_PRIORITY_HIGH;
+
+    ze_command_queue_handle_t commandQueueHandle = {};
+
+    ze_result_t res = device->createCommandQueue(&desc, &commandQueueHandle);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    auto commandQueue = static_cast<CommandQueueImp *>(L0::CommandQueue::fromHandle(commandQueueHandle));
+    EXPECT_NE(commandQueue, nullptr);
+    EXPECT_FALSE(commandQueue->getCsr()->getOsContext().isHighPriority());
+    NEO::CommandStreamReceiver *csr = nullptr;
+    device->getCsrForOrdinalAndIndex(&csr, 0u, 0u);
+    EXPECT_EQ(commandQueue->getCsr(), csr);
+    commandQueue->destroy();
+}
+
 using MultiDeviceCreateCommandQueueTest = Test<MultiDeviceFixture>;
 
 TEST_F(MultiDeviceCreateCommandQueueTest, givenLowPriorityDescWhenCreateCommandQueueIsCalledThenLowPriorityCsrIsAssigned) {
@@ -765,12 +940,14 @@ class MockCommandQueue : public L0::CommandQueueHw<gfxCoreFamily> {
     using BaseClass::residencyContainer;
 
     NEO::HeapContainer mockHeapContainer;
+    uint32_t requestedPerThreadScratchSpaceSize = 0u;
     void handleScratchSpace(NEO::ResidencyContainer &residency,
                             NEO::HeapContainer &heapContainer,
                             NEO::ScratchSpaceController *scratchController,
                             bool &gsbaState, bool &frontEndState,
                             uint32_t perThreadScratchSpaceSize) override {
         this->mockHeapContainer = heapContainer;
+        this->requestedPerThreadScratchSpaceSize = perThreadScratchSpaceSize;
     }
 
     void programFrontEnd(uint64_t scratchAddress, uint32_t perThreadScratchSpaceSize, NEO::LinearStream &commandStream) override {
@@ -829,6 +1006,44 @@ HWTEST2_F(CommandQueueDestroy, givenCommandQueueAndCommandListWithWhenBindlessEn
     commandList->destroy();
 }
 
+HWTEST2_F(CommandQueueDestroy, givenKernelWithLargerScratchBuiltForDeviceWhenExecutingCommandListWithScratchThenScratchIsSizedForThatKernel, CommandQueueExecuteTestSupport) {
+    ze_command_queue_desc_t desc = {};
+    NEO::CommandStreamReceiver *csr;
+    device->getCsrForOrdinalAndIndex(&csr, 0u, 0u);
+    auto commandQueue = new MockCommandQueue<gfxCoreFamily>(device, csr, &desc);
+    commandQueue->initialize(false, false);
+    auto commandList = new CommandListCoreFamily<gfxCoreFamily>();
+    commandList->initialize(device, NEO::EngineGroupType::Compute);
+    auto commandListHandle = commandList->toHandle();
+
+    neoDevice->registerKernelPerThreadScratchSize(0x2000u);
+    neoDevice->registerKernelPerThreadScratchSize(0x400u);
+    EXPECT_EQ(0x2000u, neoDevice->getMaxKernelPerThreadScratchSize());
+
+    commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false);
+    EXPECT_EQ(0u, commandQueue->requestedPerThreadScratchSpaceSize);
+
+    commandList->setCommandListPerThreadScratchSize(0x400u);
+    commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false);
+    EXPECT_EQ(0x2000u, commandQueue->requestedPerThreadScratchSpaceSize);
+
+    {
+        DebugManagerStateRestore dbgRestorer;
+        DebugManager.flags.SizeScratchForBuiltKernels.set(0);
+        commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false);
+        EXPECT_EQ(0x400u, commandQueue->requestedPerThreadScratchSpaceSize);
+    }
+
+    neoDevice->unregisterKernelPerThreadScratchSize(0x2000u);
+    EXPECT_EQ(0x400u, neoDevice->getMaxKernelPerThreadScratchSize());
+    commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false);
+    EXPECT_EQ(0x400u, commandQueue->requestedPerThreadScratchSpaceSize);
+
+    neoDevice->unregisterKernelPerThreadScratchSize(0x400u);
+    commandQueue->destroy();
+    commandList->destroy();
+}
+
 using ExecuteCommandListTests = Test<ContextFixture>;
 HWTEST2_F(ExecuteCommandListTests, givenExecuteCommandListWhenItReturnsThenContainersAreEmpty, CommandQueueExecuteTestSupport) {
     ze_command_queue_desc_t desc = {};
@@ -858,6 +1073,28 @@ HWTEST2_F(ExecuteCommandListTests, givenExecuteCommandListWhenItReturnsThenConta
     alignedFree(alloc);
 }
 
+HWTEST2_F(ExecuteCommandListTests, givenSubmissionCoalescingWhenNoOtherSubmissionIsPendingThenCommandListIsFlushedWithoutWaitingForWindow, CommandQueueExecuteTestSupport) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.SubmissionCoalescingWindowUs.set(60 * 1000 * 1000);
+
+    ze_command_queue_desc_t desc = {};
+    NEO::CommandStreamReceiver *csr;
+    device->getCsrForOrdinalAndIndex(&csr, 0u, 0u);
+    auto commandQueue = new MockCommandQueue<gfxCoreFamily>(device, csr, &desc);
+    commandQueue->initialize(false, false);
+    auto commandList = new CommandListCoreFamily<gfxCoreFamily>();
+    commandList->initialize(device, NEO::EngineGroupType::Compute);
+    auto commandListHandle = commandList->toHandle();
+
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false));
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(30));
+    EXPECT_EQ(csr->peekTaskCount(), commandQueue->getTaskCount());
+
+    commandQueue->destroy();
+    commandList->destroy();
+}
+
 HWTEST2_F(ExecuteCommandListTests, givenCommandQueueHavingTwoB2BCommandListsThenMVSDirtyFlagAndGSBADirtyFlagAreSetOnlyOnce, CommandQueueExecuteTestSupport) {
     ze_command_queue_desc_t desc = {};
     NEO::CommandStreamReceiver *csr;
@@ -1401,5 +1638,91 @@ TEST_F(CommandQueueInitTests, givenMultipleSubDevicesWhenInitializingThenAllocat
 
     commandQueue->destroy();
 }
+
+struct WhiteBoxBalancedCommandQueue : public BalancedCommandQueue {
+    using BalancedCommandQueue::engineQueues;
+};
+
+HWTEST2_F(ExecuteCommandListTests, givenBalancedCommandQueueWhenFirstEngineIsBusyThenCommandListIsSubmittedToIdleEngineAfterWaitingForItsPreviousSubmission, CommandQueueExecuteSupport) {
+    using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
+    auto &engines = neoDevice->getEngines();
+    ASSERT_LE(2u, engines.size());
+    auto busyCsr = static_cast<NEO::UltCommandStreamReceiver<FamilyType> *>(engines[0].commandStreamReceiver);
+    auto idleCsr = static_cast<NEO::UltCommandStreamReceiver<FamilyType> *>(engines[1].commandStreamReceiver);
+    ASSERT_NE(busyCsr, idleCsr);
+
+    ze_command_queue_desc_t desc = {};
+    ze_result_t returnValue;
+    auto commandQueue = static_cast<WhiteBoxBalancedCommandQueue *>(BalancedCommandQueue::create(productFamily, device, {busyCsr, idleCsr}, &desc, returnValue));
+    ASSERT_NE(nullptr, commandQueue);
+    ASSERT_EQ(2u, commandQueue->engineQueues.size());
+
+    *busyCsr->getTagAddress() = 0u;
+    busyCsr->taskCount = 5u;
+    *idleCsr->getTagAddress() = idleCsr->peekTaskCount();
+
+    auto commandList = std::unique_ptr<CommandList>(whitebox_cast(CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, returnValue)));
+    commandList->close();
+    commandList->lastSubmissionCsr = busyCsr;
+    commandList->lastSubmissionTaskCount = 5u;
+    auto commandListHandle = commandList->toHandle();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false));
+    EXPECT_EQ(idleCsr, commandList->lastSubmissionCsr);
+
+    auto idleEngineQueue = whitebox_cast(static_cast<L0::CommandQueue *>(commandQueue->engineQueues[1]));
+    GenCmdList cmdList;
+    ASSERT_TRUE(FamilyType::PARSE::parseCommandBuffer(
+        cmdList, idleEngineQueue->commandStream->getCpuBase(), idleEngineQueue->commandStream->getUsed()));
+    auto semaphores = findAll<MI_SEMAPHORE_WAIT *>(cmdList.begin(), cmdList.end());
+    ASSERT_EQ(1u, semaphores.size());
+    auto semaphore = genCmdCast<MI_SEMAPHORE_WAIT *>(*semaphores[0]);
+    EXPECT_EQ(busyCsr->getTagAllocation()->getGpuAddress(), semaphore->getSemaphoreGraphicsAddress());
+    EXPECT_EQ(5u, semaphore->getSemaphoreDataDword());
+    EXPECT_TRUE(idleEngineQueue->crossEngineDependencies.empty());
+
+    *busyCsr->getTagAddress() = 5u;
+    commandQueue->destroy();
+}
+
+HWTEST2_F(ExecuteCommandListTests, givenBalancedCommandQueueWhenSubmissionMovesToAnotherEngineThenItWaitsForLastTaskOfPreviousEngine, CommandQueueExecuteSupport) {
+    using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
+    auto &engines = neoDevice->getEngines();
+    ASSERT_LE(2u, engines.size());
+    auto busyCsr = static_cast<NEO::UltCommandStreamReceiver<FamilyType> *>(engines[0].commandStreamReceiver);
+    auto idleCsr = static_cast<NEO::UltCommandStreamReceiver<FamilyType> *>(engines[1].commandStreamReceiver);
+    ASSERT_NE(busyCsr, idleCsr);
+
+    ze_command_queue_desc_t desc = {};
+    ze_result_t returnValue;
+    auto commandQueue = static_cast<WhiteBoxBalancedCommandQueue *>(BalancedCommandQueue::create(productFamily, device, {busyCsr, idleCsr}, &desc, returnValue));
+    ASSERT_NE(nullptr, commandQueue);
+
+    *busyCsr->getTagAddress() = 0u;
+    busyCsr->taskCount = 5u;
+    whitebox_cast(static_cast<L0::CommandQueue *>(commandQueue->engineQueues[0]))->taskCount = 3u;
+    *idleCsr->getTagAddress() = idleCsr->peekTaskCount();
+
+    auto commandList = std::unique_ptr<CommandList>(whitebox_cast(CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, returnValue)));
+    commandList->close();
+    auto commandListHandle = commandList->toHandle();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandQueue->executeCommandLists(1, &commandListHandle, nullptr, false));
+    EXPECT_EQ(idleCsr, commandList->lastSubmissionCsr);
+
+    auto idleEngineQueue = whitebox_cast(static_cast<L0::CommandQueue *>(commandQueue->engineQueues[1]));
+    GenCmdList cmdList;
+    ASSERT_TRUE(FamilyType::PARSE::parseCommandBuffer(
+        cmdList, idleEngineQueue->commandStream->getCpuBase(), idleEngineQueue->commandStream->getUsed()));
+    auto semaphores = findAll<MI_SEMAPHORE_WAIT *>(cmdList.begin(), cmdList.end());
+    ASSERT_EQ(1u, semaphores.size());
+    auto semaphore = genCmdCast<MI_SEMAPHORE_WAIT *>(*semaphores[0]);
+    EXPECT_EQ(busyCsr->getTagAllocation()->getGpuAddress(), semaphore->getSemaphoreGraphicsAddress());
+    EXPECT_EQ(3u, semaphore->getSemaphoreDataDword());
+
+    *busyCsr->getTagAddress() = 5u;
+    commandQueue->destroy();
+}
+
 } // namespace ult
 } // namespace L0
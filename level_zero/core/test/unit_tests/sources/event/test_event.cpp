@@ -5,10 +5,12 @@
  *
  */
 
+#include "opencl/test/unit_test/libult/ult_command_stream_receiver.h"
 #include "opencl/test/unit_test/mocks/mock_memory_manager.h"
 #include "opencl/test/unit_test/mocks/mock_memory_operations_handler.h"
 #include "test.h"
 
+#include "level_zero/api/extensions/public/ze_exp_ext.h"
 #include "level_zero/core/source/driver/driver_handle_imp.h"
 #include "level_zero/core/test/unit_tests/fixtures/device_fixture.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_event.h"
@@ -48,6 +50,27 @@ TEST_F(EventPoolCreate, givenTimestampEventsThenEventSizeSufficientForAllKernelT
     EXPECT_EQ(kernelTimestampsSize, eventPool->getEventSize());
 }
 
+TEST_F(EventPoolCreate, givenEventsWithoutTimestampsThenEachEventTakesSingleQword) {
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.count = 4;
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+
+    std::unique_ptr<L0::EventPool> eventPool(EventPool::create(driverHandle.get(), 0, nullptr, &eventPoolDesc));
+    ASSERT_NE(nullptr, eventPool);
+    EXPECT_EQ(sizeof(uint64_t), eventPool->getEventSize());
+
+    ze_event_desc_t eventDesc = {};
+    eventDesc.index = 3;
+    std::unique_ptr<L0::Event> event(Event::create(eventPool.get(), &eventDesc, device));
+    ASSERT_NE(nullptr, event);
+
+    auto allocation = eventPool->getAllocation().getGraphicsAllocation(device->getNEODevice()->getRootDeviceIndex());
+    EXPECT_EQ(allocation->getGpuAddress() + 3 * sizeof(uint64_t), event->getGpuAddress());
+    EXPECT_EQ(ZE_RESULT_NOT_READY, event->queryStatus());
+    event->hostSignal();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->queryStatus());
+}
+
 TEST_F(EventPoolCreate, givenAnEventIsCreatedFromThisEventPoolThenEventContainsDeviceCommandStreamReceiver) {
     ze_event_pool_desc_t eventPoolDesc = {};
     eventPoolDesc.count = 1;
@@ -122,6 +145,40 @@ TEST_F(EventPoolCreate, givenCloseIpcHandleCalledReturnsNotSupported) {
     EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, result);
 }
 
+TEST_F(EventPoolCreate, givenIpcEventPoolWhenIpcHandleIsOpenedThenImportedPoolSharesEventLayout) {
+    ze_event_pool_desc_t eventPoolDesc = {};
+    eventPoolDesc.count = 4;
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_IPC | ZE_EVENT_POOL_FLAG_KERNEL_TIMESTAMP;
+
+    std::unique_ptr<L0::EventPool> eventPool(EventPool::create(driverHandle.get(), 0, nullptr, &eventPoolDesc));
+    ASSERT_NE(nullptr, eventPool);
+
+    ze_ipc_event_pool_handle_t ipcHandle = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, eventPool->getIpcHandle(&ipcHandle));
+
+    ze_event_pool_handle_t hImportedPool = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, driverHandle->openEventPoolIpcHandle(ipcHandle, &hImportedPool));
+    ASSERT_NE(nullptr, hImportedPool);
+
+    auto importedPool = static_cast<EventPoolImp *>(EventPool::fromHandle(hImportedPool));
+    EXPECT_TRUE(importedPool->isImportedFromIpcHandle);
+    EXPECT_TRUE(importedPool->isEventPoolUsedForTimestamp);
+    EXPECT_EQ(4u, importedPool->getNumEvents());
+    EXPECT_EQ(eventPool->getEventSize(), importedPool->getEventSize());
+    EXPECT_EQ(device, importedPool->getDevice());
+
+    ze_event_desc_t eventDesc = {};
+    eventDesc.index = 2;
+    ze_event_handle_t hEvent = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, importedPool->createEvent(&eventDesc, &hEvent));
+    auto importedAllocation = importedPool->getAllocation().getGraphicsAllocation(device->getNEODevice()->getRootDeviceIndex());
+    EXPECT_EQ(importedAllocation->getGpuAddress() + 2 * importedPool->getEventSize(), Event::fromHandle(hEvent)->getGpuAddress());
+
+    Event::fromHandle(hEvent)->destroy();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, importedPool->destroy());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, eventPool->closeIpcHandle());
+}
+
 TEST_F(EventCreate, givenAnEventCreatedThenTheEventHasTheDeviceCommandStreamReceiverSet) {
     ze_event_pool_desc_t eventPoolDesc = {
         ZE_STRUCTURE_TYPE_EVENT_POOL_DESC,
@@ -219,6 +276,135 @@ TEST_F(EventSynchronizeTest, givenCallToEventHostSynchronizeWithTimeoutNonZeroAn
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
 }
 
+HWTEST_F(EventSynchronizeTest, givenHostWaitSpinTimeElapsedWhenSynchronizingWithoutTimeoutThenThreadSleepsOnCsrFlushStampUntilEventIsSignaled) {
+    struct SleepingCsr : public NEO::UltCommandStreamReceiver<FamilyType> {
+        SleepingCsr(const NEO::ExecutionEnvironment &executionEnvironment, const DeviceBitfield deviceBitfield)
+            : NEO::UltCommandStreamReceiver<FamilyType>(const_cast<NEO::ExecutionEnvironment &>(executionEnvironment), 0, deviceBitfield) {
+            this->tagAddress = &tag;
+        }
+        bool waitForFlushStamp(FlushStamp &flushStampToWait) override {
+            waitedFlushStamps.push_back(flushStampToWait);
+            *static_cast<uint32_t *>(eventToSignal->getHostAddress()) = Event::STATE_SIGNALED;
+            return true;
+        }
+        std::vector<FlushStamp> waitedFlushStamps;
+        Event *eventToSignal = nullptr;
+        uint32_t tag = 0u;
+    };
+
+    auto csr = std::make_unique<SleepingCsr>(*device->getNEODevice()->getExecutionEnvironment(), device->getNEODevice()->getDeviceBitfield());
+    csr->taskCount = 1u;
+    csr->flushStamp->setStamp(5u);
+    csr->eventToSignal = event.get();
+    event->setCsr(csr.get());
+
+    eventPool->setHostWaitSpinTime(0u);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->hostSynchronize(std::numeric_limits<uint64_t>::max()));
+    ASSERT_EQ(1u, csr->waitedFlushStamps.size());
+    EXPECT_EQ(5u, csr->waitedFlushStamps[0]);
+
+    event->reset();
+    eventPool->setHostWaitSpinTime(std::numeric_limits<uint64_t>::max());
+    EXPECT_EQ(ZE_RESULT_NOT_READY, event->hostSynchronize(10));
+    EXPECT_EQ(1u, csr->waitedFlushStamps.size());
+}
+
+class EventSynchronizeMultipleTest : public Test<DeviceFixture> {
+  public:
+    void SetUp() override {
+        DeviceFixture::SetUp();
+        ze_event_pool_desc_t eventPoolDesc = {};
+        eventPoolDesc.count = numEvents;
+        eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+
+        eventPool = std::unique_ptr<L0::EventPool>(L0::EventPool::create(driverHandle.get(), 0, nullptr, &eventPoolDesc));
+        ASSERT_NE(nullptr, eventPool);
+        for (uint32_t i = 0; i < numEvents; i++) {
+            ze_event_desc_t eventDesc = {};
+            eventDesc.index = i;
+            events[i].reset(L0::Event::create(eventPool.get(), &eventDesc, device));
+            ASSERT_NE(nullptr, events[i]);
+            eventHandles[i] = events[i]->toHandle();
+        }
+    }
+
+    void TearDown() override {
+        DeviceFixture::TearDown();
+    }
+
+    static constexpr uint32_t numEvents = 3u;
+    std::unique_ptr<L0::EventPool> eventPool = nullptr;
+    std::unique_ptr<L0::Event> events[numEvents];
+    ze_event_handle_t eventHandles[numEvents] = {};
+};
+
+TEST_F(EventSynchronizeMultipleTest, givenOneSignaledEventWhenSynchronizingMultipleInAnyModeThenItsIndexIsReturned) {
+    *static_cast<uint64_t *>(events[1]->getHostAddress()) = Event::STATE_SIGNALED;
+
+    uint32_t signaledIndex = 0u;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexEventHostSynchronizeMultiple(numEvents, eventHandles, ZEX_WAIT_MODE_ANY, 10u, &signaledIndex));
+    EXPECT_EQ(1u, signaledIndex);
+}
+
+TEST_F(EventSynchronizeMultipleTest, givenNotAllEventsSignaledWhenSynchronizingMultipleInAllModeThenNotReadyIsReturnedUntilAllAreSignaled) {
+    *static_cast<uint64_t *>(events[0]->getHostAddress()) = Event::STATE_SIGNALED;
+    *static_cast<uint64_t *>(events[2]->getHostAddress()) = Event::STATE_SIGNALED;
+    EXPECT_EQ(ZE_RESULT_NOT_READY, zexEventHostSynchronizeMultiple(numEvents, eventHandles, ZEX_WAIT_MODE_ALL, 0u, nullptr));
+    EXPECT_EQ(ZE_RESULT_NOT_READY, zexEventHostSynchronizeMultiple(numEvents, eventHandles, ZEX_WAIT_MODE_ALL, 10u, nullptr));
+
+    *static_cast<uint64_t *>(events[1]->getHostAddress()) = Event::STATE_SIGNALED;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexEventHostSynchronizeMultiple(numEvents, eventHandles, ZEX_WAIT_MODE_ALL, std::numeric_limits<uint64_t>::max(), nullptr));
+}
+
+TEST_F(EventSynchronizeMultipleTest, givenNoEventSignaledWhenSynchronizingMultipleInAnyModeWithTimeoutThenNotReadyIsReturned) {
+    uint32_t signaledIndex = numEvents;
+    EXPECT_EQ(ZE_RESULT_NOT_READY, zexEventHostSynchronizeMultiple(numEvents, eventHandles, ZEX_WAIT_MODE_ANY, 10u, &signaledIndex));
+    EXPECT_EQ(numEvents, signaledIndex);
+}
+
+HWTEST_F(EventSynchronizeMultipleTest, givenHostWaitSpinTimeElapsedWhenSynchronizingMultipleWithUint32MaxTimeoutThenThreadSleepsOnCsrUntilAnyEventIsSignaled) {
+    struct SleepingCsr : public NEO::UltCommandStreamReceiver<FamilyType> {
+        SleepingCsr(const NEO::ExecutionEnvironment &executionEnvironment, const DeviceBitfield deviceBitfield)
+            : NEO::UltCommandStreamReceiver<FamilyType>(const_cast<NEO::ExecutionEnvironment &>(executionEnvironment), 0, deviceBitfield) {
+            this->tagAddress = &tag;
+        }
+        bool waitForFlushStamp(FlushStamp &flushStampToWait) override {
+            waitedFlushStamps.push_back(flushStampToWait);
+            *static_cast<uint32_t *>(eventToSignal->getHostAddress()) = Event::STATE_SIGNALED;
+            return true;
+        }
+        std::vector<FlushStamp> waitedFlushStamps;
+        Event *eventToSignal = nullptr;
+        uint32_t tag = 0u;
+    };
+
+    auto csr = std::make_unique<SleepingCsr>(*device->getNEODevice()->getExecutionEnvironment(), device->getNEODevice()->getDeviceBitfield());
+    csr->taskCount = 1u;
+    csr->flushStamp->setStamp(5u);
+    csr->eventToSignal = events[2].get();
+    for (auto &event : events) {
+        event->setCsr(csr.get());
+    }
+
+    eventPool->setHostWaitSpinTime(0u);
+    uint32_t signaledIndex = numEvents;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexEventHostSynchronizeMultiple(numEvents, eventHandles, ZEX_WAIT_MODE_ANY, std::numeric_limits<uint32_t>::max(), &signaledIndex));
+    EXPECT_EQ(2u, signaledIndex);
+    ASSERT_EQ(1u, csr->waitedFlushStamps.size());
+    EXPECT_EQ(5u, csr->waitedFlushStamps[0]);
+
+    events[2]->reset();
+    eventPool->setHostWaitSpinTime(std::numeric_limits<uint64_t>::max());
+    EXPECT_EQ(ZE_RESULT_NOT_READY, zexEventHostSynchronizeMultiple(numEvents, eventHandles, ZEX_WAIT_MODE_ANY, 10u, nullptr));
+    EXPECT_EQ(1u, csr->waitedFlushStamps.size());
+}
+
+TEST_F(EventSynchronizeMultipleTest, givenInvalidArgumentsWhenSynchronizingMultipleThenErrorIsReturned) {
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_SIZE, zexEventHostSynchronizeMultiple(0u, eventHandles, ZEX_WAIT_MODE_ANY, 0u, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, zexEventHostSynchronizeMultiple(numEvents, nullptr, ZEX_WAIT_MODE_ANY, 0u, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ENUMERATION, zexEventHostSynchronizeMultiple(numEvents, eventHandles, static_cast<zex_wait_mode_t>(2), 0u, nullptr));
+}
+
 struct EventCreateAllocationResidencyTest : public ::testing::Test {
     void SetUp() override {
         neoDevice = NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(NEO::defaultHwInfo.get());
@@ -286,6 +472,24 @@ TEST_F(TimestampEventCreate, givenEventTimestampsCreatedWhenResetIsInvokeThenCor
     EXPECT_EQ(0u, event->getPacketsInUse());
 }
 
+TEST_F(TimestampEventCreate, givenTimestampEventWhenSignaledFromHostThenAllPacketsAndHostCopyAreSignaled) {
+    event->hostSignal();
+
+    auto packets = static_cast<TimestampPacketStorage::Packet *>(event->hostAddress);
+    for (auto i = 0u; i < NEO::TimestampPacketSizeControl::preferredPacketCount; i++) {
+        EXPECT_EQ(Event::State::STATE_SIGNALED, packets[i].contextStart);
+        EXPECT_EQ(Event::State::STATE_SIGNALED, packets[i].globalStart);
+        EXPECT_EQ(Event::State::STATE_SIGNALED, packets[i].contextEnd);
+        EXPECT_EQ(Event::State::STATE_SIGNALED, packets[i].globalEnd);
+
+        auto &packet = event->timestampsData->packets[i];
+        EXPECT_EQ(Event::State::STATE_SIGNALED, packet.contextStart);
+        EXPECT_EQ(Event::State::STATE_SIGNALED, packet.globalStart);
+        EXPECT_EQ(Event::State::STATE_SIGNALED, packet.contextEnd);
+        EXPECT_EQ(Event::State::STATE_SIGNALED, packet.globalEnd);
+    }
+}
+
 TEST_F(TimestampEventCreate, givenSingleTimestampEventThenAllocationSizeCreatedForAllTimestamps) {
     auto allocation = &eventPool->getAllocation();
     ASSERT_NE(nullptr, allocation);
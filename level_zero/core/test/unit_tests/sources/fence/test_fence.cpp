@@ -9,6 +9,7 @@
 
 #include "test.h"
 
+#include "level_zero/api/extensions/public/ze_exp_ext.h"
 #include "level_zero/core/source/fence/fence.h"
 #include "level_zero/core/test/unit_tests/fixtures/device_fixture.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_cmdqueue.h"
@@ -63,5 +64,37 @@ TEST_F(FenceTest, whenQueryingStatusAndStateSignaledThenReturnSuccess) {
     fence->destroy();
 }
 
+TEST_F(FenceTest, givenOneSignaledFenceWhenSynchronizingMultipleThenAnyModeReturnsItsIndexAndAllModeIsNotReady) {
+    auto csr = std::make_unique<MockCommandStreamReceiver>(*neoDevice->getExecutionEnvironment(), 0, neoDevice->getDeviceBitfield());
+    Mock<CommandQueue> cmdQueue(device, csr.get());
+    Fence *fences[2] = {Fence::create(&cmdQueue, nullptr), Fence::create(&cmdQueue, nullptr)};
+    ze_fence_handle_t fenceHandles[2] = {fences[0]->toHandle(), fences[1]->toHandle()};
+
+    *static_cast<uint64_t *>(fences[1]->getAllocation().getUnderlyingBuffer()) = Fence::STATE_SIGNALED;
+
+    uint32_t signaledIndex = 0u;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexFenceHostSynchronizeMultiple(2u, fenceHandles, ZEX_WAIT_MODE_ANY, 10u, &signaledIndex));
+    EXPECT_EQ(1u, signaledIndex);
+    EXPECT_EQ(ZE_RESULT_NOT_READY, zexFenceHostSynchronizeMultiple(2u, fenceHandles, ZEX_WAIT_MODE_ALL, 0u, nullptr));
+    EXPECT_EQ(ZE_RESULT_NOT_READY, zexFenceHostSynchronizeMultiple(2u, fenceHandles, ZEX_WAIT_MODE_ALL, 10u, nullptr));
+
+    *static_cast<uint64_t *>(fences[0]->getAllocation().getUnderlyingBuffer()) = Fence::STATE_SIGNALED;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexFenceHostSynchronizeMultiple(2u, fenceHandles, ZEX_WAIT_MODE_ALL, std::numeric_limits<uint32_t>::max(), nullptr));
+
+    fences[0]->destroy();
+    fences[1]->destroy();
+}
+
+TEST_F(FenceTest, givenInvalidArgumentsWhenSynchronizingMultipleFencesThenErrorIsReturned) {
+    Mock<CommandQueue> cmdQueue(device, nullptr);
+    auto fence = Fence::create(&cmdQueue, nullptr);
+    ze_fence_handle_t fenceHandle = fence->toHandle();
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_SIZE, zexFenceHostSynchronizeMultiple(0u, &fenceHandle, ZEX_WAIT_MODE_ANY, 0u, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, zexFenceHostSynchronizeMultiple(1u, nullptr, ZEX_WAIT_MODE_ANY, 0u, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ENUMERATION, zexFenceHostSynchronizeMultiple(1u, &fenceHandle, static_cast<zex_wait_mode_t>(2), 0u, nullptr));
+    fence->destroy();
+}
+
 } // namespace ult
 } // namespace L0
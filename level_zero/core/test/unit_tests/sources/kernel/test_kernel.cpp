@@ -8,6 +8,7 @@
 #include "shared/source/device_binary_format/patchtokens_decoder.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_device.h"
+#include "shared/test/common/mocks/mock_elf.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
 #include "shared/test/unit_test/device_binary_format/patchtokens_tests.h"
 
@@ -1054,6 +1055,22 @@ TEST_F(KernelIsaTests, givenKernelAllocationInLocalMemoryWhenCreatingWithDisallo
     device->getNEODevice()->getMemoryManager()->freeGraphicsMemory(kernelInfo.kernelAllocation);
 }
 
+TEST_F(KernelIsaTests, givenKernelRequiringDisabledMidThreadPreemptionWhenInitializingImmutableDataThenPreemptionModeIsCachedOnce) {
+    uint32_t kernelHeap = 0;
+    KernelInfo kernelInfo;
+    kernelInfo.heapInfo.KernelHeapSize = 1;
+    kernelInfo.heapInfo.pKernelHeap = &kernelHeap;
+    kernelInfo.kernelDescriptor.kernelAttributes.flags.requiresDisabledMidThreadPreemption = true;
+
+    KernelImmutableData kernelImmutableData(device);
+    EXPECT_EQ(NEO::PreemptionMode::Initial, kernelImmutableData.getPreemptionMode());
+
+    kernelImmutableData.initialize(&kernelInfo, device, 0, nullptr, nullptr, true);
+    EXPECT_NE(NEO::PreemptionMode::Initial, kernelImmutableData.getPreemptionMode());
+    EXPECT_NE(NEO::PreemptionMode::MidThread, kernelImmutableData.getPreemptionMode());
+    EXPECT_EQ(KernelImmutableData::computePreemptionMode(*device, kernelInfo.kernelDescriptor), kernelImmutableData.getPreemptionMode());
+}
+
 TEST_F(KernelIsaTests, givenKernelInfoWhenInitializingImmutableDataWithInternalIsaThenCorrectAllocationTypeIsUsed) {
     uint32_t kernelHeap = 0;
     KernelInfo kernelInfo;
@@ -1125,6 +1142,37 @@ TEST_F(KernelIsaTests, givenDebugONAndKernelDegugInfoWhenInitializingImmutableDa
     EXPECT_EQ(kernelInfo.kernelDescriptor.external.debugData->vIsaSize, static_cast<uint32_t>(123));
 }
 
+TEST_F(KernelIsaTests, givenL0DebuggerAndRelocatableKernelDebugInfoWhenInitializingImmutableDataThenElfIsRegisteredWithoutRelocatingDebugData) {
+    uint32_t kernelHeap = 0;
+    KernelInfo kernelInfo;
+    kernelInfo.heapInfo.KernelHeapSize = 1;
+    kernelInfo.heapInfo.pKernelHeap = &kernelHeap;
+    auto elf = MockElfEncoder<>::createRelocateableDebugDataElf();
+    auto debugData = new DebugData;
+    debugData->vIsa = reinterpret_cast<char *>(elf.data());
+    debugData->vIsaSize = static_cast<uint32_t>(elf.size());
+    kernelInfo.kernelDescriptor.external.debugData.reset(debugData);
+    class MockDebugger : public DebuggerL0 {
+      public:
+        MockDebugger(NEO::Device *neodev) : DebuggerL0(neodev) {
+        }
+        void registerElf(NEO::DebugData *debugData, NEO::GraphicsAllocation *isaAllocation) override {
+            registeredElf = debugData->vIsa;
+        };
+        size_t getSbaTrackingCommandsSize(size_t trackedAddressCount) override { return static_cast<size_t>(0); };
+        void programSbaTrackingCommands(NEO::LinearStream &cmdStream, const SbaAddresses &sba) override{};
+        const char *registeredElf = nullptr;
+    };
+    MockDebugger *debugger = new MockDebugger(neoDevice);
+
+    neoDevice->getExecutionEnvironment()->rootDeviceEnvironments[0]->debugger.reset(static_cast<NEO::Debugger *>(debugger));
+    KernelImmutableData kernelImmutableData(device);
+
+    kernelImmutableData.initialize(&kernelInfo, device, 0, nullptr, nullptr, false);
+    EXPECT_EQ(reinterpret_cast<char *>(elf.data()), debugger->registeredElf);
+    EXPECT_EQ(nullptr, kernelInfo.kernelDescriptor.external.relocatedDebugData);
+}
+
 TEST_F(KernelIsaTests, givenDebugONAndNoKernelDegugInfoWhenInitializingImmutableDataThenDoNotRegisterElf) {
     uint32_t kernelHeap = 0;
     KernelInfo kernelInfo;
@@ -1168,7 +1216,7 @@ TEST_F(KernelImpPatchBindlessTest, GivenKernelImpWhenPatchBindlessOffsetCalledTh
     auto patchLocation = ptrOffset(kernel.getCrossThreadData(), bindless);
     auto patchValue = hwHelper.getBindlessSurfaceExtendedMessageDescriptorValue(static_cast<uint32_t>(expectedSsInHeap.surfaceStateOffset));
 
-    auto ssPtr = kernel.patchBindlessSurfaceState(&alloc, bindless);
+    auto ssPtr = kernel.patchBindlessSurfaceState(&alloc, bindless, {});
 
     EXPECT_EQ(ssPtr, expectedSsInHeap.ssPtr);
     EXPECT_TRUE(memcmp(const_cast<uint8_t *>(patchLocation), &patchValue, sizeof(patchValue)) == 0);
@@ -1196,7 +1244,8 @@ HWTEST2_F(KernelImpPatchBindlessTest, GivenKernelImpWhenSetSurfaceStateBindlessT
     void *buffer = reinterpret_cast<void *>(gpuAddress);
 
     NEO::MockGraphicsAllocation mockAllocation(buffer, gpuAddress, size);
-    auto expectedSsInHeap = device->getNEODevice()->getBindlessHeapsHelper()->allocateSSInHeap(size, &mockAllocation, NEO::BindlessHeapsHelper::GLOBAL_SSH);
+    NEO::SurfaceStateView expectedView = {gpuAddress, alignUp(size, NEO::EncodeSurfaceState<FamilyType>::getSurfaceBaseAddressAlignment()), device->getMOCS(true, false)};
+    auto expectedSsInHeap = device->getNEODevice()->getBindlessHeapsHelper()->allocateSSInHeap(size, &mockAllocation, NEO::BindlessHeapsHelper::GLOBAL_SSH, expectedView);
 
     memset(expectedSsInHeap.ssPtr, 0, size);
     auto surfaceStateBefore = *reinterpret_cast<RENDER_SURFACE_STATE *>(expectedSsInHeap.ssPtr);
@@ -717,6 +717,7 @@ TEST_F(MemoryIPCTests,
 struct DriverHandleGetIpcHandleMock : public DriverHandleImp {
     void *importFdHandle(ze_device_handle_t hDevice, uint64_t handle) override {
         EXPECT_EQ(handle, static_cast<uint64_t>(mockFd));
+        importFdHandleCalled++;
         if (mockFd == allocationMap.second) {
             return allocationMap.first;
         }
@@ -745,6 +746,7 @@ struct DriverHandleGetIpcHandleMock : public DriverHandleImp {
     }
 
     const int mockFd = 999;
+    uint32_t importFdHandleCalled = 0u;
     std::pair<void *, int> allocationMap;
 };
 
@@ -794,6 +796,54 @@ TEST_F(MemoryGetIpcHandleTest,
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
 }
 
+TEST_F(MemoryGetIpcHandleTest,
+       givenIpcImportCacheEnabledWhenOpeningIpcHandleAgainThenCachedPointerIsReturnedWithoutImport) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableIpcImportCache.set(true);
+
+    size_t size = 10;
+    size_t alignment = 1u;
+    void *ptr = nullptr;
+
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    ze_result_t result = driverHandle->allocDeviceMem(device->toHandle(),
+                                                      &deviceDesc,
+                                                      size, alignment, &ptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+
+    ze_ipc_mem_handle_t ipcHandle = {};
+    result = driverHandle->getIpcMemHandle(ptr, &ipcHandle);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+
+    ze_ipc_memory_flag_t flags = {};
+    void *ipcPtr = nullptr;
+    result = driverHandle->openIpcMemHandle(device->toHandle(), ipcHandle, flags, &ipcPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(ptr, ipcPtr);
+    EXPECT_EQ(1u, driverHandle->importFdHandleCalled);
+
+    void *ipcPtr2 = nullptr;
+    result = driverHandle->openIpcMemHandle(device->toHandle(), ipcHandle, flags, &ipcPtr2);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(ipcPtr, ipcPtr2);
+    EXPECT_EQ(1u, driverHandle->importFdHandleCalled);
+    ASSERT_EQ(1u, driverHandle->ipcImports.size());
+    EXPECT_EQ(2u, driverHandle->ipcImports.begin()->second.refCount);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, driverHandle->closeIpcMemHandle(ipcPtr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, driverHandle->closeIpcMemHandle(ipcPtr2));
+    ASSERT_EQ(1u, driverHandle->ipcImports.size());
+    EXPECT_EQ(0u, driverHandle->ipcImports.begin()->second.refCount);
+
+    result = driverHandle->openIpcMemHandle(device->toHandle(), ipcHandle, flags, &ipcPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(1u, driverHandle->importFdHandleCalled);
+
+    result = driverHandle->freeMem(ptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_TRUE(driverHandle->ipcImports.empty());
+}
+
 using DeviceMemorySizeTest = Test<DeviceFixture>;
 
 TEST_F(DeviceMemorySizeTest, givenSizeGreaterThanLimitThenDeviceAllocationFails) {
@@ -7,6 +7,7 @@
 
 #include "shared/source/gmm_helper/gmm.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
+#include "shared/source/helpers/aligned_memory.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_elf.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
@@ -98,6 +99,62 @@ HWTEST_F(ModuleTest, givenBuiltinModuleWhenCreatedThenCorrectAllocationTypeIsUse
     EXPECT_EQ(NEO::GraphicsAllocation::AllocationType::KERNEL_ISA_INTERNAL, kernel->getIsaAllocation()->getAllocationType());
 }
 
+HWTEST_F(ModuleTest, givenSharedModuleIsaAllocationEnabledWhenModuleIsCreatedThenKernelsAreSubAllocatedFromSharedIsaHeap) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableSharedModuleIsaAllocation.set(1);
+    createModuleFromBinary();
+
+    auto whiteboxModule = whitebox_cast(module.get());
+    ASSERT_EQ(1u, whiteboxModule->isaHeaps.size());
+    auto isaHeap = whiteboxModule->isaHeaps[0];
+    EXPECT_EQ(NEO::GraphicsAllocation::AllocationType::KERNEL_ISA, isaHeap->getAllocationType());
+
+    for (auto &kernelImmData : whiteboxModule->kernelImmDatas) {
+        EXPECT_EQ(isaHeap, kernelImmData->getIsaGraphicsAllocation());
+        EXPECT_TRUE(isAligned(kernelImmData->getIsaOffsetInParentAllocation(), ModuleImp::isaSubAllocationAlignment));
+        EXPECT_EQ(kernelImmData->getKernelInfo()->heapInfo.KernelHeapSize, kernelImmData->getIsaSize());
+        EXPECT_LE(kernelImmData->getIsaOffsetInParentAllocation() + kernelImmData->getIsaSize(), isaHeap->getUnderlyingBufferSize());
+    }
+
+    createKernel();
+    EXPECT_EQ(isaHeap, kernel->getIsaAllocation());
+    EXPECT_EQ(kernel->getImmutableData()->getIsaOffsetInParentAllocation(), kernel->getIsaOffsetInParentAllocation());
+}
+
+HWTEST_F(ModuleTest, givenLazyKernelIsaUploadEnabledWhenModuleIsCreatedThenIsaIsAllocatedOnFirstKernelCreate) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableLazyKernelIsaUpload.set(1);
+    createModuleFromBinary();
+
+    auto whiteboxModule = whitebox_cast(module.get());
+    EXPECT_TRUE(whiteboxModule->lazyKernelIsaUpload);
+    for (auto &kernelImmData : whiteboxModule->kernelImmDatas) {
+        EXPECT_FALSE(kernelImmData->isInitialized());
+        EXPECT_EQ(nullptr, kernelImmData->getIsaGraphicsAllocation());
+    }
+
+    createKernel();
+    auto isaAllocation = kernel->getIsaAllocation();
+    ASSERT_NE(nullptr, isaAllocation);
+    EXPECT_EQ(NEO::GraphicsAllocation::AllocationType::KERNEL_ISA, isaAllocation->getAllocationType());
+
+    auto kernelImmData = module->getKernelImmutableData(kernelName.c_str());
+    EXPECT_TRUE(kernelImmData->isInitialized());
+    EXPECT_EQ(isaAllocation, kernelImmData->getIsaGraphicsAllocation());
+}
+
+HWTEST_F(ModuleTest, givenLazyKernelIsaUploadEnabledWhenBuiltinModuleIsCreatedThenIsaIsAllocatedEagerly) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableLazyKernelIsaUpload.set(1);
+    createModuleFromBinary(ModuleType::Builtin);
+
+    auto whiteboxModule = whitebox_cast(module.get());
+    EXPECT_FALSE(whiteboxModule->lazyKernelIsaUpload);
+    for (auto &kernelImmData : whiteboxModule->kernelImmDatas) {
+        EXPECT_TRUE(kernelImmData->isInitialized());
+    }
+}
+
 using ModuleTestSupport = IsWithinProducts<IGFX_SKYLAKE, IGFX_TIGERLAKE_LP>;
 
 HWTEST2_F(ModuleTest, givenNonPatchedTokenThenSurfaceBaseAddressIsCorrectlySet, ModuleTestSupport) {
@@ -598,6 +655,58 @@ TEST_F(ModuleDynamicLinkTests, givenModuleWithUnresolvedSymbolWhenTheOtherModule
     EXPECT_EQ(gpuAddress, *reinterpret_cast<uint64_t *>(ptrOffset(isaPtr, offset)));
 }
 
+TEST_F(ModuleDynamicLinkTests, givenModuleWithTwoUnresolvedSymbolsWhenOnlyOneIsDefinedThenItStaysPatchedAndNextLinkResolvesOnlyTheRemainingOne) {
+    uint64_t gpuAddress0 = 0x12345;
+    uint64_t gpuAddress1 = 0x67890;
+    uint32_t offset0 = 0x20;
+    uint32_t offset1 = 0x40;
+
+    NEO::Linker::RelocationInfo unresolvedRelocation0;
+    unresolvedRelocation0.symbolName = "unresolved0";
+    unresolvedRelocation0.offset = offset0;
+    unresolvedRelocation0.type = NEO::Linker::RelocationInfo::Type::Address;
+    NEO::Linker::RelocationInfo unresolvedRelocation1 = unresolvedRelocation0;
+    unresolvedRelocation1.symbolName = "unresolved1";
+    unresolvedRelocation1.offset = offset1;
+
+    char kernelHeap[MemoryConstants::pageSize] = {};
+
+    auto kernelInfo = std::make_unique<NEO::KernelInfo>();
+    kernelInfo->heapInfo.pKernelHeap = kernelHeap;
+    kernelInfo->heapInfo.KernelHeapSize = MemoryConstants::pageSize;
+    module0->getTranslationUnit()->programInfo.kernelInfos.push_back(kernelInfo.release());
+
+    auto linkerInput = std::make_unique<::WhiteBox<NEO::LinkerInput>>();
+    linkerInput->traits.requiresPatchingOfInstructionSegments = true;
+
+    module0->getTranslationUnit()->programInfo.linkerInput = std::move(linkerInput);
+    module0->unresolvedExternalsInfo.push_back({unresolvedRelocation0, 0u});
+    module0->unresolvedExternalsInfo.push_back({unresolvedRelocation1, 0u});
+
+    auto kernelImmData = std::make_unique<WhiteBox<::L0::KernelImmutableData>>(device);
+    kernelImmData->isaGraphicsAllocation.reset(neoDevice->getMemoryManager()->allocateGraphicsMemoryWithProperties(
+        {device->getRootDeviceIndex(), MemoryConstants::pageSize, NEO::GraphicsAllocation::AllocationType::KERNEL_ISA, neoDevice->getDeviceBitfield()}));
+
+    auto isaPtr = kernelImmData->getIsaGraphicsAllocation()->getUnderlyingBuffer();
+
+    module0->kernelImmDatas.push_back(std::move(kernelImmData));
+
+    NEO::SymbolInfo symbolInfo{};
+    module1->symbols[unresolvedRelocation0.symbolName] = NEO::Linker::RelocatedSymbol{symbolInfo, gpuAddress0};
+
+    std::vector<ze_module_handle_t> hModules = {module0->toHandle(), module1->toHandle()};
+    EXPECT_EQ(ZE_RESULT_ERROR_MODULE_LINK_FAILURE, module0->performDynamicLink(2, hModules.data(), nullptr));
+    ASSERT_EQ(1u, module0->unresolvedExternalsInfo.size());
+    EXPECT_EQ(unresolvedRelocation1.symbolName, module0->unresolvedExternalsInfo[0].unresolvedRelocation.symbolName);
+
+    module1->symbols[unresolvedRelocation1.symbolName] = NEO::Linker::RelocatedSymbol{symbolInfo, gpuAddress1};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, module0->performDynamicLink(2, hModules.data(), nullptr));
+    EXPECT_TRUE(module0->unresolvedExternalsInfo.empty());
+
+    EXPECT_EQ(gpuAddress0, *reinterpret_cast<uint64_t *>(ptrOffset(isaPtr, offset0)));
+    EXPECT_EQ(gpuAddress1, *reinterpret_cast<uint64_t *>(ptrOffset(isaPtr, offset1)));
+}
+
 class DeviceModuleSetArgBufferTest : public ModuleFixture, public ::testing::Test {
   public:
     void SetUp() override {
@@ -896,6 +1005,94 @@ HWTEST_F(ModuleTranslationUnitTest, WhenBuildOptionsAreNullThenReuseExistingOpti
     EXPECT_NE(pMockCompilerInterface->inputInternalOptions.find("cl-intel-greater-than-4GB-buffer-required"), std::string::npos);
 }
 
+HWTEST_F(ModuleTranslationUnitTest, givenNoDebuggerWhenBuildingFromSpirVThenCompilerCacheIsAllowed) {
+    struct MockCompilerInterface : CompilerInterface {
+        TranslationOutput::ErrorCode build(const NEO::Device &device,
+                                           const TranslationInput &input,
+                                           TranslationOutput &output) override {
+            receivedAllowCaching = input.allowCaching;
+            receivedAllowMappedCachedBinary = input.allowMappedCachedBinary;
+            return TranslationOutput::ErrorCode::BuildFailure;
+        }
+        bool receivedAllowCaching = false;
+        bool receivedAllowMappedCachedBinary = false;
+    };
+    auto pMockCompilerInterface = new MockCompilerInterface;
+    auto &rootDeviceEnvironment = this->neoDevice->executionEnvironment->rootDeviceEnvironments[this->neoDevice->getRootDeviceIndex()];
+    rootDeviceEnvironment->compilerInterface.reset(pMockCompilerInterface);
+
+    L0::ModuleTranslationUnit moduleTu(this->device);
+    auto ret = moduleTu.buildFromSpirV("", 0U, nullptr, "", nullptr);
+    EXPECT_FALSE(ret);
+    EXPECT_TRUE(pMockCompilerInterface->receivedAllowCaching);
+    EXPECT_TRUE(pMockCompilerInterface->receivedAllowMappedCachedBinary);
+}
+
+HWTEST_F(ModuleTranslationUnitTest, givenProgramInfoCacheEnabledWhenBuildingCachedBinaryTwiceThenSecondBuildRestoresDecodedProgramInfoFromCache) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableProgramInfoCache.set(1);
+
+    struct MockCompilerInterface : CompilerInterface {
+        TranslationOutput::ErrorCode build(const NEO::Device &device,
+                                           const TranslationInput &input,
+                                           TranslationOutput &output) override {
+            output.deviceBinary.mem = makeCopy(deviceBinary.data(), deviceBinary.size());
+            output.deviceBinary.size = deviceBinary.size();
+            output.cachedFileHash = "cached_hash";
+            return TranslationOutput::ErrorCode::Success;
+        }
+        bool cacheProgramInfo(const std::string &kernelFileHash, const std::vector<uint8_t> &programInfoBlob) override {
+            cachedProgramInfoHash = kernelFileHash;
+            cachedProgramInfo = programInfoBlob;
+            return true;
+        }
+        std::unique_ptr<char[]> loadCachedProgramInfo(const std::string &kernelFileHash, size_t &programInfoBlobSize) override {
+            ++loadCalled;
+            programInfoBlobSize = cachedProgramInfo.size();
+            if (cachedProgramInfo.empty()) {
+                return nullptr;
+            }
+            return makeCopy(reinterpret_cast<const char *>(cachedProgramInfo.data()), cachedProgramInfo.size());
+        }
+        std::vector<uint8_t> deviceBinary;
+        std::vector<uint8_t> cachedProgramInfo;
+        std::string cachedProgramInfoHash;
+        uint32_t loadCalled = 0U;
+    };
+
+    std::string validZeInfo = std::string("version :\'") + toString(zeInfoDecoderVersion) + R"===('
+kernels:
+    - name : some_kernel
+      execution_env :
+        simd_size : 8
+)===";
+    ZebinTestData::ValidEmptyProgram zebin;
+    zebin.removeSection(NEO::Elf::SHT_ZEBIN::SHT_ZEBIN_ZEINFO, NEO::Elf::SectionsNamesZebin::zeInfo);
+    zebin.appendSection(NEO::Elf::SHT_ZEBIN::SHT_ZEBIN_ZEINFO, NEO::Elf::SectionsNamesZebin::zeInfo, ArrayRef<const uint8_t>::fromAny(validZeInfo.data(), validZeInfo.size()));
+    zebin.appendSection(NEO::Elf::SHT_PROGBITS, NEO::Elf::SectionsNamesZebin::textPrefix.str() + "some_kernel", {});
+    zebin.elfHeader->machine = device->getNEODevice()->getHardwareInfo().platform.eProductFamily;
+
+    auto pMockCompilerInterface = new MockCompilerInterface;
+    pMockCompilerInterface->deviceBinary = zebin.storage;
+    auto &rootDeviceEnvironment = this->neoDevice->executionEnvironment->rootDeviceEnvironments[this->neoDevice->getRootDeviceIndex()];
+    rootDeviceEnvironment->compilerInterface.reset(pMockCompilerInterface);
+
+    L0::ModuleTranslationUnit coldModuleTu(this->device);
+    EXPECT_TRUE(coldModuleTu.buildFromSpirV("", 0U, nullptr, "", nullptr));
+    EXPECT_EQ(1U, pMockCompilerInterface->loadCalled);
+    EXPECT_STREQ("cached_hash", pMockCompilerInterface->cachedProgramInfoHash.c_str());
+    EXPECT_FALSE(pMockCompilerInterface->cachedProgramInfo.empty());
+
+    L0::ModuleTranslationUnit warmModuleTu(this->device);
+    EXPECT_TRUE(warmModuleTu.buildFromSpirV("", 0U, nullptr, "", nullptr));
+    EXPECT_EQ(2U, pMockCompilerInterface->loadCalled);
+    ASSERT_EQ(1U, warmModuleTu.programInfo.kernelInfos.size());
+    EXPECT_STREQ("some_kernel", warmModuleTu.programInfo.kernelInfos[0]->kernelDescriptor.kernelMetadata.kernelName.c_str());
+    EXPECT_EQ(8U, warmModuleTu.programInfo.kernelInfos[0]->kernelDescriptor.kernelAttributes.simdSize);
+    EXPECT_NE(nullptr, warmModuleTu.programInfo.decodedElf.elfFileHeader);
+    EXPECT_NE(nullptr, warmModuleTu.programInfo.linkerInput.get());
+}
+
 TEST(BuildOptions, givenNoSrcOptionNameInSrcNamesWhenMovingBuildOptionsThenFalseIsReturned) {
     std::string srcNames = NEO::CompilerOptions::concatenate(NEO::CompilerOptions::fastRelaxedMath, NEO::CompilerOptions::finiteMathOnly);
     std::string dstNames;
@@ -943,6 +1140,87 @@ TEST_F(ModuleTest, givenInternalOptionsWhenBuildFlagsIsNullPtrAndBindlessEnabled
     EXPECT_TRUE(NEO::CompilerOptions::contains(internalBuildOptions, NEO::CompilerOptions::bindlessMode));
 }
 
+TEST_F(ModuleTest, givenLargeGrfBuildFlagWhenCreatingBuildOptionsThenLargeGrfInternalOptionIsPassed) {
+    auto module = std::make_unique<ModuleImp>(device, nullptr, ModuleType::User);
+    ASSERT_NE(nullptr, module);
+
+    std::string buildOptions;
+    std::string internalBuildOptions;
+
+    module->createBuildOptions(BuildOptions::largeGrf.data(), buildOptions, internalBuildOptions);
+
+    EXPECT_TRUE(NEO::CompilerOptions::contains(internalBuildOptions, NEO::CompilerOptions::largeGrf));
+    EXPECT_FALSE(NEO::CompilerOptions::contains(buildOptions, BuildOptions::largeGrf));
+}
+
+struct ModuleWithLargeGrfVariant : public L0::ModuleImp {
+    using ModuleImp::ModuleImp;
+    using ModuleImp::selectLargeGrfVariant;
+    using ModuleImp::translationUnit;
+
+    struct TranslationUnitWithScratch : public L0::ModuleTranslationUnit {
+        TranslationUnitWithScratch(L0::Device *device, uint32_t perThreadScratchSize)
+            : L0::ModuleTranslationUnit(device), perThreadScratchSize(perThreadScratchSize) {}
+
+        bool processUnpackedBinary() override {
+            auto kernelInfo = new KernelInfo();
+            kernelInfo->kernelDescriptor.kernelAttributes.perThreadScratchSize[0] = perThreadScratchSize;
+            programInfo.kernelInfos.push_back(kernelInfo);
+            return true;
+        }
+
+        uint32_t perThreadScratchSize = 0u;
+    };
+
+    std::unique_ptr<L0::ModuleTranslationUnit> createTranslationUnit() override {
+        return std::make_unique<TranslationUnitWithScratch>(device, largeGrfPerThreadScratchSize);
+    }
+
+    uint32_t largeGrfPerThreadScratchSize = 0u;
+};
+
+TEST_F(ModuleTest, givenSpillingModuleWhenSelectingLargeGrfVariantThenBuildSpillingLessAndItsBuildLogAreKept) {
+    struct MockCompilerInterface : CompilerInterface {
+        TranslationOutput::ErrorCode build(const NEO::Device &device,
+                                           const TranslationInput &input,
+                                           TranslationOutput &output) override {
+            std::string internalOptions(input.internalOptions.begin(), input.internalOptions.size());
+            output.backendCompilerLog = NEO::CompilerOptions::contains(internalOptions, NEO::CompilerOptions::largeGrf) ? "large GRF build" : "default GRF build";
+            return TranslationOutput::ErrorCode::Success;
+        }
+    };
+    auto &rootDeviceEnvironment = neoDevice->executionEnvironment->rootDeviceEnvironments[neoDevice->getRootDeviceIndex()];
+    rootDeviceEnvironment->compilerInterface.reset(new MockCompilerInterface);
+
+    ze_module_desc_t moduleDesc = {};
+    moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
+    moduleDesc.pInputModule = reinterpret_cast<const uint8_t *>("");
+    moduleDesc.inputSize = 0u;
+
+    for (auto largeGrfPerThreadScratchSize : {0x40u, 0x200u}) {
+        auto moduleBuildLog = ModuleBuildLog::create();
+        ModuleWithLargeGrfVariant module(device, moduleBuildLog, ModuleType::User);
+        module.largeGrfPerThreadScratchSize = largeGrfPerThreadScratchSize;
+        module.translationUnit = std::make_unique<ModuleWithLargeGrfVariant::TranslationUnitWithScratch>(device, 0x100u);
+        EXPECT_TRUE(module.translationUnit->buildFromSpirV("", 0u, "", "", nullptr));
+
+        module.selectLargeGrfVariant(&moduleDesc, "", "");
+        module.updateBuildLog(neoDevice);
+
+        bool largeGrfSelected = largeGrfPerThreadScratchSize < 0x100u;
+        auto &kernelAttributes = module.translationUnit->programInfo.kernelInfos[0]->kernelDescriptor.kernelAttributes;
+        EXPECT_EQ(largeGrfSelected ? largeGrfPerThreadScratchSize : 0x100u, kernelAttributes.perThreadScratchSize[0]);
+
+        size_t buildLogSize = 0u;
+        moduleBuildLog->getString(&buildLogSize, nullptr);
+        std::string buildLog(buildLogSize, '\0');
+        moduleBuildLog->getString(&buildLogSize, &buildLog[0]);
+        EXPECT_EQ(largeGrfSelected, std::string::npos != buildLog.find("large GRF build"));
+        EXPECT_EQ(largeGrfSelected, std::string::npos == buildLog.find("default GRF build"));
+        moduleBuildLog->destroy();
+    }
+}
+
 TEST_F(ModuleTest, givenInternalOptionsWhenBindlessDisabledThenBindlesOptionsNotPassed) {
     DebugManagerStateRestore restorer;
     DebugManager.flags.UseBindlessMode.set(0);
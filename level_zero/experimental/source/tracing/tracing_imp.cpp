@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -294,7 +294,12 @@ ze_result_t APITracerContextImp::finalizeDisableImpTracingWait(struct APITracerI
 }
 
 void *APITracerContextImp::getActiveTracersList() {
-    tracer_array_t *stableTracerArray = nullptr;
+    tracer_array_t *stableTracerArray = activeTracerArray.load(std::memory_order_relaxed);
+
+    // the empty array is never retired, so no per-thread reference has to be published for it
+    if (stableTracerArray == &emptyTracerArray) {
+        return stableTracerArray;
+    }
 
     if (!myThreadPrivateTracerData.testAndSetThreadTracerDataInitializedAndOnList()) {
         return nullptr;
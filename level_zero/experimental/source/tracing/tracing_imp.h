@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "shared/source/utilities/stackvec.h"
+
 #include "level_zero/experimental/source/tracing/tracing.h"
 #include "level_zero/experimental/source/tracing/tracing_barrier_imp.h"
 #include "level_zero/experimental/source/tracing/tracing_cmdlist_imp.h"
@@ -142,12 +144,14 @@ class APITracerCallbackStateImp {
     void *pUserData;
 };
 
+constexpr size_t maxOnStackTracers = 4;
+
 template <class T>
 class APITracerCallbackDataImp {
   public:
     T apiOrdinal = {};
-    std::vector<L0::APITracerCallbackStateImp<T>> prologCallbacks;
-    std::vector<L0::APITracerCallbackStateImp<T>> epilogCallbacks;
+    StackVec<L0::APITracerCallbackStateImp<T>, maxOnStackTracers> prologCallbacks;
+    StackVec<L0::APITracerCallbackStateImp<T>, maxOnStackTracers> epilogCallbacks;
 };
 
 #define ZE_HANDLE_TRACER_RECURSION(ze_api_ptr, ...) \
@@ -189,24 +193,29 @@ template <typename TFunction_pointer, typename TParams, typename TTracer, typena
 ze_result_t APITracerWrapperImp(TFunction_pointer zeApiPtr,
                                 TParams paramsStruct,
                                 TTracer apiOrdinal,
-                                TTracerPrologCallbacks prologCallbacks,
-                                TTracerEpilogCallbacks epilogCallbacks,
+                                const TTracerPrologCallbacks &prologCallbacks,
+                                const TTracerEpilogCallbacks &epilogCallbacks,
                                 Args &&...args) {
     ze_result_t ret = ZE_RESULT_SUCCESS;
-    std::vector<APITracerCallbackStateImp<TTracer>> *callbacks_prologs = &prologCallbacks;
 
-    std::vector<void *> ppTracerInstanceUserData;
-    ppTracerInstanceUserData.resize(callbacks_prologs->size());
+    if (prologCallbacks.size() == 0 && epilogCallbacks.size() == 0) {
+        ret = zeApiPtr(args...);
+        L0::tracingInProgress = 0;
+        L0::pGlobalAPITracerContextImp->releaseActivetracersList();
+        return ret;
+    }
+
+    StackVec<void *, maxOnStackTracers> ppTracerInstanceUserData;
+    ppTracerInstanceUserData.resize(prologCallbacks.size(), nullptr);
 
-    for (size_t i = 0; i < callbacks_prologs->size(); i++) {
-        if (callbacks_prologs->at(i).current_api_callback != nullptr)
-            callbacks_prologs->at(i).current_api_callback(paramsStruct, ret, callbacks_prologs->at(i).pUserData, &ppTracerInstanceUserData[i]);
+    for (size_t i = 0; i < prologCallbacks.size(); i++) {
+        if (prologCallbacks[i].current_api_callback != nullptr)
+            prologCallbacks[i].current_api_callback(paramsStruct, ret, prologCallbacks[i].pUserData, &ppTracerInstanceUserData[i]);
     }
     ret = zeApiPtr(args...);
-    std::vector<APITracerCallbackStateImp<TTracer>> *callbacksEpilogs = &epilogCallbacks;
-    for (size_t i = 0; i < callbacksEpilogs->size(); i++) {
-        if (callbacksEpilogs->at(i).current_api_callback != nullptr)
-            callbacksEpilogs->at(i).current_api_callback(paramsStruct, ret, callbacksEpilogs->at(i).pUserData, &ppTracerInstanceUserData[i]);
+    for (size_t i = 0; i < epilogCallbacks.size(); i++) {
+        if (epilogCallbacks[i].current_api_callback != nullptr)
+            epilogCallbacks[i].current_api_callback(paramsStruct, ret, epilogCallbacks[i].pUserData, &ppTracerInstanceUserData[i]);
     }
     L0::tracingInProgress = 0;
     L0::pGlobalAPITracerContextImp->releaseActivetracersList();
@@ -213,6 +213,29 @@ TEST_F(zeAPITracingCoreTests, WhenCallingTracerWrapperWithOnePrologAndNoEpilogWi
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
 }
 
+TEST_F(zeAPITracingCoreTests, GivenNoTracerEnabledWhenGettingActiveTracersListThenEmptyListIsReturnedWithoutPublishingThreadReference) {
+    auto tracerArray = static_cast<tracer_array_t *>(pGlobalAPITracerContextImp->getActiveTracersList());
+    ASSERT_NE(nullptr, tracerArray);
+    EXPECT_EQ(0u, tracerArray->tracerArrayCount);
+    EXPECT_EQ(nullptr, myThreadPrivateTracerData.tracerArrayPointer.load());
+    pGlobalAPITracerContextImp->releaseActivetracersList();
+}
+
+TEST_F(zeAPITracingCoreTests, WhenCallingTracerWrapperWithNoCallbacksThenApiIsCalledAndTracingInProgressIsCleared) {
+    MockCommandList commandList;
+    ze_command_list_close_params_t tracerParams;
+    ze_command_list_handle_t command_list_handle = commandList.toHandle();
+    tracerParams.phCommandList = &command_list_handle;
+
+    APITracerCallbackDataImp<ze_pfnCommandListCloseCb_t> apiCallbackData;
+    L0::tracingInProgress = 1;
+
+    auto result = APITracerWrapperImp(zeCommandListClose, &tracerParams, apiCallbackData.apiOrdinal,
+                                      apiCallbackData.prologCallbacks, apiCallbackData.epilogCallbacks, *tracerParams.phCommandList);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(0, L0::tracingInProgress);
+}
+
 TEST_F(zeAPITracingCoreTests, WhenCallingTracerWrapperWithOneSetOfPrologEpilogsWithUserDataAndUserDataMatchingInPrologAndEpilogThenReturnSuccess) {
     MockCommandList commandList;
     ze_result_t result;
@@ -15,6 +15,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <dirent.h>
+#include <fcntl.h>
 #include <unistd.h>
 
 namespace L0 {
@@ -37,93 +38,82 @@ FsAccess *FsAccess::create() {
     return new FsAccess();
 }
 
-ze_result_t FsAccess::read(const std::string file, uint64_t &val) {
-    // Read a single line from text file without trailing newline
-    std::ifstream fs;
+FsAccess::~FsAccess() {
+    for (auto &cachedFd : fdCache) {
+        ::close(cachedFd.second);
+    }
+}
 
-    fs.open(file.c_str());
-    if (fs.fail()) {
-        return getResult(errno);
+ze_result_t FsAccess::readCached(const std::string &file, std::string &val) {
+    // Re-read the file from offset 0 through a descriptor kept open across calls,
+    // so polling an attribute costs one pread instead of open, read and close
+    auto it = fdCache.find(file);
+    bool wasCached = (it != fdCache.end());
+    int fd = -1;
+    if (wasCached) {
+        fd = it->second;
+    } else {
+        fd = ::open(file.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            return getResult(errno);
+        }
+        fdCache[file] = fd;
     }
-    fs >> val;
-    if (fs.fail()) {
-        fs.close();
-        return getResult(errno);
+
+    std::array<char, maxCachedReadSize> buf;
+    ssize_t len = ::pread(fd, buf.data(), buf.size() - 1, 0);
+    if (len < 0) {
+        int err = errno;
+        ::close(fd);
+        fdCache.erase(file);
+        // the file may have been recreated since it was opened, e.g. on device rebind
+        if (wasCached) {
+            return readCached(file, val);
+        }
+        return getResult(err);
     }
-    fs.close();
+    val.assign(buf.data(), static_cast<size_t>(len));
     return ZE_RESULT_SUCCESS;
 }
 
-ze_result_t FsAccess::read(const std::string file, double &val) {
-    // Read a single line from text file without trailing newline
-    std::ifstream fs;
-
-    fs.open(file.c_str());
-    if (fs.fail()) {
-        return getResult(errno);
+template <typename T>
+ze_result_t FsAccess::readValue(const std::string &file, T &val) {
+    // Read the first token of a text file
+    std::string contents;
+    {
+        std::lock_guard<std::mutex> lock(fdCacheMutex);
+        ze_result_t result = readCached(file, contents);
+        if (ZE_RESULT_SUCCESS != result) {
+            return result;
+        }
     }
-    fs >> val;
-    if (fs.fail()) {
-        fs.close();
-        return getResult(errno);
+    std::istringstream stream(contents);
+    stream >> val;
+    if (stream.fail()) {
+        return ZE_RESULT_ERROR_UNKNOWN;
     }
-    fs.close();
     return ZE_RESULT_SUCCESS;
 }
 
-ze_result_t FsAccess::read(const std::string file, int32_t &val) {
-    // Read a single line from text file without trailing newline
-    std::ifstream fs;
+ze_result_t FsAccess::read(const std::string file, uint64_t &val) {
+    return readValue(file, val);
+}
 
-    fs.open(file.c_str());
-    if (fs.fail()) {
-        return getResult(errno);
-    }
-    fs >> val;
-    if (fs.fail()) {
-        fs.close();
-        return getResult(errno);
-    }
-    fs.close();
-    return ZE_RESULT_SUCCESS;
+ze_result_t FsAccess::read(const std::string file, double &val) {
+    return readValue(file, val);
 }
 
-ze_result_t FsAccess::read(const std::string file, uint32_t &val) {
-    // Read a single line from text file without trailing newline
-    std::ifstream fs;
+ze_result_t FsAccess::read(const std::string file, int32_t &val) {
+    return readValue(file, val);
+}
 
-    fs.open(file.c_str());
-    if (fs.fail()) {
-        return getResult(errno);
-    }
-    fs >> val;
-    if (fs.fail()) {
-        fs.close();
-        return getResult(errno);
-    }
-    fs.close();
-    return ZE_RESULT_SUCCESS;
+ze_result_t FsAccess::read(const std::string file, uint32_t &val) {
+    return readValue(file, val);
 }
+
 ze_result_t FsAccess::read(const std::string file, std::string &val) {
-    // Read a single line from text file without trailing newline
-    std::ifstream fs;
     val.clear();
-
-    fs.open(file.c_str());
-    if (fs.fail()) {
-        return getResult(errno);
-    }
-    fs >> val;
-    if (fs.fail()) {
-        fs.close();
-        return getResult(errno);
-    }
-    fs.close();
-    // Strip trailing newline
-    if (val.back() == '\n') {
-        val.pop_back();
-    }
-    return ZE_RESULT_SUCCESS;
+    return readValue(file, val);
 }
 
 ze_result_t FsAccess::read(const std::string file, std::vector<std::string> &val) {
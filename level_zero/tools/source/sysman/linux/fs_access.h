@@ -13,6 +13,8 @@
 #include <fstream>
 #include <iostream>
 #include <list>
+#include <map>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <sys/stat.h>
@@ -26,7 +28,7 @@ namespace L0 {
 class FsAccess {
   public:
     static FsAccess *create();
-    virtual ~FsAccess() = default;
+    virtual ~FsAccess();
 
     virtual ze_result_t canRead(const std::string file);
     virtual ze_result_t canWrite(const std::string file);
@@ -51,6 +53,15 @@ class FsAccess {
 
   protected:
     FsAccess();
+
+    static constexpr size_t maxCachedReadSize = 4096u;
+
+    template <typename T>
+    ze_result_t readValue(const std::string &file, T &val);
+    ze_result_t readCached(const std::string &file, std::string &val);
+
+    std::map<std::string, int> fdCache;
+    std::mutex fdCacheMutex;
 };
 
 class ProcfsAccess : private FsAccess {
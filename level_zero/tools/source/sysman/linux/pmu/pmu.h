@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -15,6 +15,8 @@ class PmuInterface {
     virtual ~PmuInterface() = default;
     virtual int64_t pmuInterfaceOpen(uint64_t config, int group, uint32_t format) = 0;
     virtual int pmuReadSingle(int fd, uint64_t *data, ssize_t sizeOfdata) = 0;
+    virtual int64_t pmuCounterGroupAdd(uint64_t config) = 0;
+    virtual int pmuCounterGroupRead(uint32_t counterIndex, uint64_t *data) = 0;
     static PmuInterface *create(LinuxSysmanImp *pLinuxSysmanImp);
 };
 
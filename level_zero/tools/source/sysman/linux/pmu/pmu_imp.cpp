@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -81,6 +81,46 @@ int PmuInterfaceImp::pmuReadSingle(int fd, uint64_t *data, ssize_t sizeOfdata) {
     return 0;
 }
 
+int64_t PmuInterfaceImp::pmuCounterGroupAdd(uint64_t config) {
+    std::lock_guard<std::mutex> lock(counterGroupMutex);
+    int groupFd = counterGroupFds.empty() ? -1 : static_cast<int>(counterGroupFds[0]);
+    int64_t fd = pmuInterfaceOpen(config, groupFd, PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_GROUP);
+    if (fd < 0) {
+        return fd;
+    }
+    counterGroupFds.push_back(fd);
+    // a new member is only reported from the next group read on
+    counterGroupSample.clear();
+    counterGroupSampleConsumed.assign(counterGroupFds.size(), true);
+    return static_cast<int64_t>(counterGroupFds.size() - 1);
+}
+
+int PmuInterfaceImp::pmuCounterGroupRead(uint32_t counterIndex, uint64_t *data) {
+    std::lock_guard<std::mutex> lock(counterGroupMutex);
+    if (counterIndex >= counterGroupFds.size()) {
+        return -1;
+    }
+    if (counterGroupSampleConsumed[counterIndex]) {
+        // Group read format: number of counters, time enabled, then one value per counter
+        std::vector<uint64_t> sample(2 + counterGroupFds.size());
+        if (pmuReadSingle(static_cast<int>(counterGroupFds[0]), sample.data(), static_cast<ssize_t>(sample.size() * sizeof(uint64_t))) < 0) {
+            return -1;
+        }
+        counterGroupSample.swap(sample);
+        counterGroupSampleConsumed.assign(counterGroupFds.size(), false);
+    }
+    counterGroupSampleConsumed[counterIndex] = true;
+    data[0] = counterGroupSample[2 + counterIndex];
+    data[1] = counterGroupSample[1];
+    return 0;
+}
+
+PmuInterfaceImp::~PmuInterfaceImp() {
+    for (auto fd : counterGroupFds) {
+        close(static_cast<int>(fd));
+    }
+}
+
 PmuInterfaceImp::PmuInterfaceImp(LinuxSysmanImp *pLinuxSysmanImp) {
     pSysfsAccess = &pLinuxSysmanImp->getSysfsAccess();
     pFsAccess = &pLinuxSysmanImp->getFsAccess();
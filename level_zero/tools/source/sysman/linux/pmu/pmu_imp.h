@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,8 +10,10 @@
 #include "level_zero/tools/source/sysman/linux/pmu/pmu.h"
 
 #include <linux/perf_event.h>
+#include <mutex>
 #include <string>
 #include <sys/sysinfo.h>
+#include <vector>
 
 namespace L0 {
 
@@ -19,13 +21,23 @@ class PmuInterfaceImp : public PmuInterface, NEO::NonCopyableOrMovableClass {
   public:
     PmuInterfaceImp() = delete;
     PmuInterfaceImp(LinuxSysmanImp *pLinuxSysmanImp);
-    ~PmuInterfaceImp() override = default;
+    ~PmuInterfaceImp() override;
     int64_t pmuInterfaceOpen(uint64_t config, int group, uint32_t format) override;
     MOCKABLE_VIRTUAL int pmuReadSingle(int fd, uint64_t *data, ssize_t sizeOfdata) override;
+    int64_t pmuCounterGroupAdd(uint64_t config) override;
+    int pmuCounterGroupRead(uint32_t counterIndex, uint64_t *data) override;
 
   protected:
     MOCKABLE_VIRTUAL int64_t perfEventOpen(perf_event_attr *attr, pid_t pid, int cpu, int groupFd, uint64_t flags);
 
+    // Counters added to the group are opened as one perf event group. A single read of
+    // the group leader returns all of them with one timestamp, which is then handed out
+    // to each counter once before the group is read again.
+    std::vector<int64_t> counterGroupFds;
+    std::vector<uint64_t> counterGroupSample;
+    std::vector<bool> counterGroupSampleConsumed;
+    std::mutex counterGroupMutex;
+
   private:
     uint32_t getEventType();
     FsAccess *pFsAccess = nullptr;
@@ -6,6 +6,7 @@
  */
 
 #pragma once
+#include "level_zero/api/extensions/public/ze_exp_ext.h"
 #include "level_zero/tools/source/sysman/diagnostics/diagnostics.h"
 #include "level_zero/tools/source/sysman/engine/engine.h"
 #include "level_zero/tools/source/sysman/events/events.h"
@@ -55,6 +56,9 @@ struct SysmanDevice : _ze_device_handle_t {
     virtual ze_result_t firmwareGet(uint32_t *pCount, zes_firmware_handle_t *phFirmware) = 0;
     virtual ze_result_t deviceEventRegister(zes_event_type_flags_t events) = 0;
     virtual bool deviceEventListen(zes_event_type_flags_t &pEvent, uint32_t timeout) = 0;
+    virtual ze_result_t telemetrySamplingStart(uint32_t periodUs, uint32_t capacity) = 0;
+    virtual ze_result_t telemetrySamplesRead(uint32_t *pCount, zex_sysman_telemetry_sample_t *pSamples) = 0;
+    virtual ze_result_t telemetrySamplingStop() = 0;
     virtual ~SysmanDevice() = default;
 };
 
@@ -38,9 +38,12 @@ SysmanDeviceImp::SysmanDeviceImp(ze_device_handle_t hDevice) {
     pFirmwareHandleContext = new FirmwareHandleContext(pOsSysman);
     pDiagnosticsHandleContext = new DiagnosticsHandleContext(pOsSysman);
     pPerformanceHandleContext = new PerformanceHandleContext(pOsSysman);
+    pTelemetrySampler = new TelemetrySampler(this);
 }
 
 SysmanDeviceImp::~SysmanDeviceImp() {
+    // the sampling thread uses the handles below
+    freeResource(pTelemetrySampler);
     freeResource(pPerformanceHandleContext);
     freeResource(pDiagnosticsHandleContext);
     freeResource(pFirmwareHandleContext);
@@ -146,6 +149,18 @@ bool SysmanDeviceImp::deviceEventListen(zes_event_type_flags_t &pEvent, uint32_t
     return pEvents->eventListen(pEvent, timeout);
 }
 
+ze_result_t SysmanDeviceImp::telemetrySamplingStart(uint32_t periodUs, uint32_t capacity) {
+    return pTelemetrySampler->start(periodUs, capacity);
+}
+
+ze_result_t SysmanDeviceImp::telemetrySamplesRead(uint32_t *pCount, zex_sysman_telemetry_sample_t *pSamples) {
+    return pTelemetrySampler->read(pCount, pSamples);
+}
+
+ze_result_t SysmanDeviceImp::telemetrySamplingStop() {
+    return pTelemetrySampler->stop();
+}
+
 ze_result_t SysmanDeviceImp::deviceGetState(zes_device_state_t *pState) {
     return pGlobalOperations->deviceGetState(pState);
 }
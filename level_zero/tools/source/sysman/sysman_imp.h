@@ -10,6 +10,7 @@
 
 #include "level_zero/tools/source/sysman/os_sysman.h"
 #include "level_zero/tools/source/sysman/sysman.h"
+#include "level_zero/tools/source/sysman/telemetry/telemetry_sampler.h"
 #include <level_zero/zes_api.h>
 
 #include <unordered_map>
@@ -43,6 +44,7 @@ struct SysmanDeviceImp : SysmanDevice, NEO::NonCopyableOrMovableClass {
     FirmwareHandleContext *pFirmwareHandleContext = nullptr;
     DiagnosticsHandleContext *pDiagnosticsHandleContext = nullptr;
     PerformanceHandleContext *pPerformanceHandleContext = nullptr;
+    TelemetrySampler *pTelemetrySampler = nullptr;
 
     ze_result_t performanceGet(uint32_t *pCount, zes_perf_handle_t *phPerformance) override;
     ze_result_t powerGet(uint32_t *pCount, zes_pwr_handle_t *phPower) override;
@@ -67,6 +69,9 @@ struct SysmanDeviceImp : SysmanDevice, NEO::NonCopyableOrMovableClass {
     ze_result_t firmwareGet(uint32_t *pCount, zes_firmware_handle_t *phFirmware) override;
     ze_result_t deviceEventRegister(zes_event_type_flags_t events) override;
     bool deviceEventListen(zes_event_type_flags_t &pEvent, uint32_t timeout) override;
+    ze_result_t telemetrySamplingStart(uint32_t periodUs, uint32_t capacity) override;
+    ze_result_t telemetrySamplesRead(uint32_t *pCount, zex_sysman_telemetry_sample_t *pSamples) override;
+    ze_result_t telemetrySamplingStop() override;
 
   private:
     template <typename T>
@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/tools/source/sysman/telemetry/telemetry_sampler.h"
+
+#include "level_zero/tools/source/sysman/sysman_imp.h"
+
+#include <algorithm>
+
+namespace L0 {
+
+TelemetrySampler::~TelemetrySampler() {
+    stop();
+}
+
+ze_result_t TelemetrySampler::start(uint32_t periodUs, uint32_t capacity) {
+    if (periodUs == 0 || capacity == 0) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    std::lock_guard<std::mutex> lock(controlMutex);
+    if (samplingThread) {
+        return ZE_RESULT_ERROR_HANDLE_OBJECT_IN_USE;
+    }
+    samples = std::make_unique<SpscRingBuffer<zex_sysman_telemetry_sample_t>>(capacity);
+    period = std::chrono::microseconds(periodUs);
+    keepRunning = true;
+    samplingThread = NEO::Thread::create(samplingThreadFunc, this);
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t TelemetrySampler::read(uint32_t *pCount, zex_sysman_telemetry_sample_t *pSamples) {
+    std::lock_guard<std::mutex> lock(controlMutex);
+    if (!samplingThread) {
+        return ZE_RESULT_ERROR_UNINITIALIZED;
+    }
+    if (*pCount == 0 || pSamples == nullptr) {
+        *pCount = static_cast<uint32_t>(samples->size());
+        return ZE_RESULT_SUCCESS;
+    }
+    *pCount = static_cast<uint32_t>(samples->pop(pSamples, *pCount));
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t TelemetrySampler::stop() {
+    std::lock_guard<std::mutex> lock(controlMutex);
+    if (!samplingThread) {
+        return ZE_RESULT_ERROR_UNINITIALIZED;
+    }
+    {
+        std::lock_guard<std::mutex> wakeLock(wakeMutex);
+        keepRunning = false;
+    }
+    wakeCondition.notify_one();
+    samplingThread->join();
+    samplingThread.reset();
+    samples.reset();
+    return ZE_RESULT_SUCCESS;
+}
+
+void *TelemetrySampler::samplingThreadFunc(void *arg) {
+    auto sampler = reinterpret_cast<TelemetrySampler *>(arg);
+    auto nextSampleTime = std::chrono::steady_clock::now();
+    zex_sysman_telemetry_sample_t sample = {};
+    while (sampler->keepRunning) {
+        sampler->collectSample(sample);
+        // a full buffer drops the new sample, the consumer owns the oldest ones
+        sampler->samples->push(sample);
+
+        // sleeping until an absolute time keeps the period from drifting by the sampling cost
+        nextSampleTime += sampler->period;
+        std::unique_lock<std::mutex> lock(sampler->wakeMutex);
+        sampler->wakeCondition.wait_until(lock, nextSampleTime, [sampler] { return !sampler->keepRunning; });
+    }
+    return nullptr;
+}
+
+void TelemetrySampler::collectSample(zex_sysman_telemetry_sample_t &sample) {
+    sample = {};
+    sample.timestamp = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+
+    auto &powerHandles = pSysmanDevice->pPowerHandleContext->handleList;
+    if (!powerHandles.empty() && ZE_RESULT_SUCCESS != powerHandles[0]->powerGetEnergyCounter(&sample.energy)) {
+        sample.energy = {};
+    }
+
+    sample.actualFrequency = -1.0;
+    auto &frequencyHandles = pSysmanDevice->pFrequencyHandleContext->handleList;
+    zes_freq_state_t frequencyState = {};
+    if (!frequencyHandles.empty() && ZE_RESULT_SUCCESS == frequencyHandles[0]->frequencyGetState(&frequencyState)) {
+        sample.actualFrequency = frequencyState.actual;
+    }
+
+    auto &engineHandles = pSysmanDevice->pEngineHandleContext->handleList;
+    sample.numEngines = static_cast<uint32_t>(std::min(engineHandles.size(), static_cast<size_t>(ZEX_SYSMAN_TELEMETRY_MAX_ENGINES)));
+    for (uint32_t i = 0; i < sample.numEngines; i++) {
+        if (ZE_RESULT_SUCCESS != engineHandles[i]->engineGetActivity(&sample.engineStats[i])) {
+            sample.engineStats[i] = {};
+        }
+    }
+}
+
+} // namespace L0
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/os_interface/os_thread.h"
+
+#include "level_zero/api/extensions/public/ze_exp_ext.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace L0 {
+
+struct SysmanDeviceImp;
+
+// Ring buffer with one producer and one consumer thread. Neither side takes a lock;
+// the producer fails to push when the buffer is full instead of overwriting entries.
+template <typename T>
+class SpscRingBuffer : NEO::NonCopyableOrMovableClass {
+  public:
+    SpscRingBuffer(size_t capacity) : entries(capacity + 1) {}
+
+    bool push(const T &entry) {
+        auto writePosition = writeIndex.load(std::memory_order_relaxed);
+        auto nextWritePosition = (writePosition + 1) % entries.size();
+        if (nextWritePosition == readIndex.load(std::memory_order_acquire)) {
+            return false;
+        }
+        entries[writePosition] = entry;
+        writeIndex.store(nextWritePosition, std::memory_order_release);
+        return true;
+    }
+
+    size_t pop(T *out, size_t maxCount) {
+        auto readPosition = readIndex.load(std::memory_order_relaxed);
+        auto writePosition = writeIndex.load(std::memory_order_acquire);
+        size_t count = 0;
+        while (readPosition != writePosition && count < maxCount) {
+            out[count++] = entries[readPosition];
+            readPosition = (readPosition + 1) % entries.size();
+        }
+        readIndex.store(readPosition, std::memory_order_release);
+        return count;
+    }
+
+    size_t size() const {
+        auto readPosition = readIndex.load(std::memory_order_acquire);
+        auto writePosition = writeIndex.load(std::memory_order_acquire);
+        return (writePosition + entries.size() - readPosition) % entries.size();
+    }
+
+  protected:
+    std::vector<T> entries;
+    std::atomic<size_t> readIndex{0};
+    std::atomic<size_t> writeIndex{0};
+};
+
+// Samples power, frequency and engine activity of a device from a runtime thread,
+// so monitoring clients drain samples in bulk instead of polling each getter.
+class TelemetrySampler : NEO::NonCopyableOrMovableClass {
+  public:
+    TelemetrySampler(SysmanDeviceImp *pSysmanDevice) : pSysmanDevice(pSysmanDevice) {}
+    MOCKABLE_VIRTUAL ~TelemetrySampler();
+
+    ze_result_t start(uint32_t periodUs, uint32_t capacity);
+    ze_result_t read(uint32_t *pCount, zex_sysman_telemetry_sample_t *pSamples);
+    ze_result_t stop();
+
+  protected:
+    static void *samplingThreadFunc(void *arg);
+    MOCKABLE_VIRTUAL void collectSample(zex_sysman_telemetry_sample_t &sample);
+
+    SysmanDeviceImp *pSysmanDevice = nullptr;
+    std::unique_ptr<NEO::Thread> samplingThread;
+    std::unique_ptr<SpscRingBuffer<zex_sysman_telemetry_sample_t>> samples;
+    std::chrono::microseconds period{0};
+    std::atomic<bool> keepRunning{false};
+    std::mutex controlMutex;
+    std::mutex wakeMutex;
+    std::condition_variable wakeCondition;
+};
+
+} // namespace L0
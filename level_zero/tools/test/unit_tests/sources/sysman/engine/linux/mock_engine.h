@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -76,8 +76,12 @@ struct Mock<MockPmuInterfaceImp> : public MockPmuInterfaceImp {
         return -1;
     }
     int mockedPmuReadSingleAndSuccessReturn(int fd, uint64_t *data, ssize_t sizeOfdata) {
-        data[0] = mockActiveTime;
+        auto numberOfCounters = static_cast<size_t>(sizeOfdata) / sizeof(uint64_t) - 2;
+        data[0] = numberOfCounters;
         data[1] = mockTimestamp;
+        for (size_t i = 0; i < numberOfCounters; i++) {
+            data[2 + i] = mockActiveTime;
+        }
         return 0;
     }
     int mockedPmuReadSingleAndFailureReturn(int fd, uint64_t *data, ssize_t sizeOfdata) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -130,6 +130,22 @@ TEST_F(ZesEngineFixture, GivenValidEngineHandleAndIntegratedDeviceWhenCallingZes
     }
 }
 
+TEST_F(ZesEngineFixture, GivenValidEngineHandlesWhenCallingZesEngineGetActivityForEachEngineThenBusyCountersAreReadOnceAsAGroup) {
+    zes_engine_stats_t stats = {};
+    auto handles = getEngineHandles(handleComponentCount);
+    EXPECT_EQ(handleComponentCount, handles.size());
+
+    EXPECT_CALL(*pPmuInterface.get(), pmuReadSingle(_, _, (2 + handleComponentCount) * sizeof(uint64_t)))
+        .Times(2);
+    for (auto handle : handles) {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zesEngineGetActivity(handle, &stats));
+    }
+    // a counter whose value from the last group read was already returned triggers a new read
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zesEngineGetActivity(handles[0], &stats));
+    EXPECT_EQ(mockActiveTime / microSecondsToNanoSeconds, stats.activeTime);
+    EXPECT_EQ(mockTimestamp / microSecondsToNanoSeconds, stats.timestamp);
+}
+
 TEST_F(ZesEngineFixture, GivenValidEngineHandleAndDiscreteDeviceWhenCallingZesEngineGetActivityThenVerifyCallReturnsSuccess) {
     auto pMemoryManagerTest = std::make_unique<::testing::NiceMock<MockMemoryManagerInEngineSysman>>(*neoDevice->getExecutionEnvironment());
     pMemoryManagerTest->localMemorySupported[0] = true;
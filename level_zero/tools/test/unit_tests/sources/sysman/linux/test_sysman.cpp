@@ -42,7 +42,7 @@ TEST_F(SysmanDeviceFixture, GivenCreateFsAccessHandleWhenCallinggetFsAccessThenC
 }
 
 TEST_F(SysmanDeviceFixture, GivenValidPathnameWhenCallingFsAccessExistsThenSuccessIsReturned) {
-    auto FsAccess = pLinuxSysmanImp->getFsAccess();
+    auto &FsAccess = pLinuxSysmanImp->getFsAccess();
 
     char cwd[PATH_MAX];
     std::string path = getcwd(cwd, PATH_MAX);
@@ -50,12 +50,33 @@ TEST_F(SysmanDeviceFixture, GivenValidPathnameWhenCallingFsAccessExistsThenSucce
 }
 
 TEST_F(SysmanDeviceFixture, GivenInvalidPathnameWhenCallingFsAccessExistsThenErrorIsReturned) {
-    auto FsAccess = pLinuxSysmanImp->getFsAccess();
+    auto &FsAccess = pLinuxSysmanImp->getFsAccess();
 
     std::string path = "noSuchFileOrDirectory";
     EXPECT_FALSE(FsAccess.fileExists(path));
 }
 
+TEST_F(SysmanDeviceFixture, GivenFileReadOnceWhenFileContentsChangeAndFileIsReadAgainThenNewValueIsReturned) {
+    auto &FsAccess = pLinuxSysmanImp->getFsAccess();
+    std::string path = "sysmanFsAccessReadTestFile";
+
+    std::ofstream(path) << 100 << std::endl;
+    uint64_t val = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, FsAccess.read(path, val));
+    EXPECT_EQ(100u, val);
+
+    std::ofstream(path) << 2000 << std::endl;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, FsAccess.read(path, val));
+    EXPECT_EQ(2000u, val);
+
+    std::ofstream(path) << "notANumber" << std::endl;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, FsAccess.read(path, val));
+
+    std::remove(path.c_str());
+    std::string str;
+    EXPECT_EQ(ZE_RESULT_ERROR_NOT_AVAILABLE, FsAccess.read("noSuchFileOrDirectory", str));
+}
+
 TEST_F(SysmanDeviceFixture, GivenCreateSysfsAccessHandleWhenCallinggetSysfsAccessThenCreatedSysfsAccessHandleHandleWillBeRetrieved) {
     if (pLinuxSysmanImp->pSysfsAccess != nullptr) {
         //delete previously allocated pSysfsAccess
@@ -127,7 +148,7 @@ TEST_F(SysmanMultiDeviceFixture, GivenValidDeviceHandleHavingSubdevicesWhenValid
 
 TEST_F(SysmanMultiDeviceFixture, GivenValidEffectiveUserIdCheckWhetherPermissionsReturnedByIsRootUserAreCorrect) {
     int euid = geteuid();
-    auto pFsAccess = pLinuxSysmanImp->getFsAccess();
+    auto &pFsAccess = pLinuxSysmanImp->getFsAccess();
     if (euid == 0) {
         EXPECT_EQ(true, pFsAccess.isRootUser());
     } else {
@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/api/extensions/public/ze_exp_ext.h"
+#include "level_zero/tools/source/sysman/telemetry/telemetry_sampler.h"
+#include "level_zero/tools/test/unit_tests/sources/sysman/linux/mock_sysman_fixture.h"
+
+#include <thread>
+
+namespace L0 {
+namespace ult {
+
+TEST(SpscRingBufferTest, GivenFullRingBufferWhenPushingThenEntryIsDroppedAndPoppedEntriesKeepOrder) {
+    SpscRingBuffer<uint32_t> ringBuffer(2);
+    EXPECT_TRUE(ringBuffer.push(1));
+    EXPECT_TRUE(ringBuffer.push(2));
+    EXPECT_FALSE(ringBuffer.push(3));
+    EXPECT_EQ(2u, ringBuffer.size());
+
+    uint32_t entries[2] = {};
+    EXPECT_EQ(1u, ringBuffer.pop(entries, 1));
+    EXPECT_EQ(1u, entries[0]);
+    EXPECT_TRUE(ringBuffer.push(4));
+    EXPECT_EQ(2u, ringBuffer.pop(entries, 2));
+    EXPECT_EQ(2u, entries[0]);
+    EXPECT_EQ(4u, entries[1]);
+    EXPECT_EQ(0u, ringBuffer.size());
+}
+
+TEST_F(SysmanDeviceFixture, GivenSamplingNotStartedWhenReadingOrStoppingTelemetrySamplingThenUninitializedIsReturned) {
+    uint32_t count = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNINITIALIZED, zexSysmanDeviceReadTelemetrySamples(device->toHandle(), &count, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_UNINITIALIZED, zexSysmanDeviceStopTelemetrySampling(device->toHandle()));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zexSysmanDeviceStartTelemetrySampling(device->toHandle(), 0u, 16u));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zexSysmanDeviceStartTelemetrySampling(device->toHandle(), 100u, 0u));
+}
+
+TEST_F(SysmanDeviceFixture, GivenTelemetrySamplingStartedWhenReadingSamplesThenSamplesAreReturnedInOrder) {
+    auto hDevice = device->toHandle();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexSysmanDeviceStartTelemetrySampling(hDevice, 100u, 16u));
+    EXPECT_EQ(ZE_RESULT_ERROR_HANDLE_OBJECT_IN_USE, zexSysmanDeviceStartTelemetrySampling(hDevice, 100u, 16u));
+
+    uint32_t count = 0;
+    for (int retry = 0; retry < 5000 && count < 2u; retry++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        count = 0;
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zexSysmanDeviceReadTelemetrySamples(hDevice, &count, nullptr));
+    }
+    ASSERT_GE(count, 2u);
+
+    count = 2;
+    zex_sysman_telemetry_sample_t samples[2] = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexSysmanDeviceReadTelemetrySamples(hDevice, &count, samples));
+    EXPECT_EQ(2u, count);
+    EXPECT_LT(samples[0].timestamp, samples[1].timestamp);
+    EXPECT_EQ(pSysmanDeviceImp->pEngineHandleContext->handleList.size(), samples[0].numEngines);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexSysmanDeviceStopTelemetrySampling(hDevice));
+    EXPECT_EQ(ZE_RESULT_ERROR_UNINITIALIZED, zexSysmanDeviceStopTelemetrySampling(hDevice));
+}
+
+} // namespace ult
+} // namespace L0
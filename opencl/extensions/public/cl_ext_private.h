@@ -185,3 +185,50 @@ typedef struct _cl_queue_family_properties_intel {
     cl_uint count;
     char name[CL_QUEUE_FAMILY_MAX_NAME_SIZE_INTEL];
 } cl_queue_family_properties_intel;
+
+/******************************
+*   MEMORY USAGE STATISTICS   *
+*******************************/
+
+typedef struct _cl_device_memory_usage_intel {
+    cl_ulong liveBytes;
+    cl_ulong peakBytes;
+    cl_ulong allocationCount;
+    cl_ulong osHandleCount;
+} cl_device_memory_usage_intel;
+
+/******************************
+*   SUBMISSION STATISTICS     *
+*******************************/
+
+#define CL_QUEUE_SUBMISSION_WAIT_TIME_BUCKETS_INTEL 16
+
+typedef struct _cl_queue_submission_statistics_intel {
+    cl_ulong flushes;
+    cl_ulong ringBufferSwitches;
+    cl_ulong stallingPipeControls;
+    cl_ulong stateBaseAddressReprogrammings;
+    cl_ulong cacheFlushes;
+    cl_ulong kmdNotifySleeps;
+    /* bucket i counts waits shorter than 2^i microseconds, the last bucket also counts all longer waits */
+    cl_ulong waitTimeHistogram[CL_QUEUE_SUBMISSION_WAIT_TIME_BUCKETS_INTEL];
+} cl_queue_submission_statistics_intel;
+
+/******************************
+*   RECORDED COMMAND BUFFERS  *
+*******************************/
+
+typedef struct _cl_command_buffer_intel *cl_command_buffer_intel;
+
+/******************************
+*   GPU TIMELINE SAMPLING     *
+*******************************/
+
+/* sampling is per engine: the queue only selects the engine, samples cover every queue submitting to it */
+/* all times are host nanoseconds, GPU timestamps are converted with the device timer resolution */
+typedef struct _cl_engine_timeline_sample_intel {
+    cl_uint taskCount;
+    cl_ulong submitTime;
+    cl_ulong startTime;
+    cl_ulong endTime;
+} cl_engine_timeline_sample_intel;
@@ -10,15 +10,18 @@
 #include "shared/source/aub/aub_center.h"
 #include "shared/source/built_ins/built_ins.h"
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/command_stream/gpu_timeline_sampler.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/get_info.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/kernel_helpers.h"
+#include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/os_interface/device_factory.h"
 #include "shared/source/os_interface/os_context.h"
+#include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 #include "shared/source/utilities/api_intercept.h"
 #include "shared/source/utilities/stackvec.h"
 
@@ -26,6 +29,7 @@
 #include "opencl/source/api/additional_extensions.h"
 #include "opencl/source/built_ins/vme_builtin.h"
 #include "opencl/source/cl_device/cl_device.h"
+#include "opencl/source/command_queue/cl_command_buffer.h"
 #include "opencl/source/command_queue/command_queue.h"
 #include "opencl/source/context/context.h"
 #include "opencl/source/context/driver_diagnostics.h"
@@ -469,6 +473,13 @@ cl_int CL_API_CALL clReleaseContext(cl_context context) {
     DBG_LOG_INPUTS("context", context);
     Context *pContext = castToObject<Context>(context);
     if (pContext) {
+        // programs released by the application while built in the background are freed here at the latest
+        for (const auto &clDevice : pContext->getDevices()) {
+            auto compilerInterface = clDevice->getRootDeviceEnvironment().compilerInterface.get();
+            if (nullptr != compilerInterface) {
+                compilerInterface->retireBuildJobs();
+            }
+        }
         pContext->release();
         TRACING_EXIT(clReleaseContext, &retVal);
         return retVal;
@@ -1489,6 +1500,8 @@ cl_int CL_API_CALL clReleaseProgram(cl_program program) {
     DBG_LOG_INPUTS("program", program);
     auto pProgram = castToObject<Program>(program);
     if (pProgram) {
+        // drops references held by completed background builds, possibly including one to this program
+        pProgram->retireAsyncBuilds();
         pProgram->release();
         TRACING_EXIT(clReleaseProgram, &retVal);
         return retVal;
@@ -1525,8 +1538,12 @@ cl_int CL_API_CALL clBuildProgram(cl_program program,
         retVal = Program::processInputDevices(deviceVectorPtr, numDevices, deviceList, pProgram->getDevices());
     }
     if (CL_SUCCESS == retVal) {
-        retVal = pProgram->build(*deviceVectorPtr, options, clCacheEnabled);
-        pProgram->invokeCallback(funcNotify, userData);
+        if ((nullptr != funcNotify) && (DebugManager.flags.EnableAsyncProgramBuild.get() == 1)) {
+            retVal = pProgram->buildAsync(*deviceVectorPtr, options, clCacheEnabled, funcNotify, userData);
+        } else {
+            retVal = pProgram->build(*deviceVectorPtr, options, clCacheEnabled);
+            pProgram->invokeCallback(funcNotify, userData);
+        }
     }
 
     TRACING_EXIT(clBuildProgram, &retVal);
@@ -3987,7 +4004,7 @@ cl_int clGetMemAllocInfoINTEL(
         if (!unifiedMemoryAllocation) {
             return changeGetInfoStatusToCLResultType(info.set<void *>(nullptr));
         }
-        return changeGetInfoStatusToCLResultType(info.set<uint64_t>(unifiedMemoryAllocation->gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress()));
+        return changeGetInfoStatusToCLResultType(info.set<uint64_t>(unifiedMemoryAllocation->getGpuAddress()));
     }
     case CL_MEM_ALLOC_SIZE_INTEL: {
         if (!unifiedMemoryAllocation) {
@@ -4112,6 +4129,13 @@ cl_int clEnqueueMigrateMemINTEL(
     retVal = validateObjects(WithCastToInternal(commandQueue, &pCommandQueue), ptr, EventWaitList(numEventsInWaitList, eventWaitList));
 
     if (retVal == CL_SUCCESS) {
+        auto pageFaultManager = pCommandQueue->getContext().getMemoryManager()->getPageFaultManager();
+        auto svmData = pCommandQueue->getContext().getSVMAllocsManager()->getSVMAlloc(ptr);
+        if (pageFaultManager && svmData && svmData->memoryType == InternalMemoryType::SHARED_UNIFIED_MEMORY &&
+            (flags & CL_MIGRATE_MEM_OBJECT_HOST) == 0) {
+            pageFaultManager->moveAllocationToGpuDomainAsync(const_cast<void *>(ptr));
+        }
+
         pCommandQueue->enqueueMarkerWithWaitList(numEventsInWaitList, eventWaitList, event);
 
         if (event) {
@@ -4363,6 +4387,18 @@ void *CL_API_CALL clGetExtensionFunctionAddress(const char *funcName) {
     RETURN_FUNC_PTR_IF_EXIST(clGetKernelMaxConcurrentWorkGroupCountINTEL);
     RETURN_FUNC_PTR_IF_EXIST(clGetKernelSuggestedLocalWorkSizeINTEL);
     RETURN_FUNC_PTR_IF_EXIST(clEnqueueNDCountKernelINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clGetDeviceMemoryUsageINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clGetEventProfilingDurationsINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clGetCommandQueueSubmissionStatisticsINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clCreateCommandBufferINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clCommandNDRangeKernelINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clCommandBufferSetKernelArgINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clFinalizeCommandBufferINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clEnqueueCommandBufferINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clReleaseCommandBufferINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clWaitForAnyEventINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clSetEngineTimelineSamplingINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clGetEngineTimelineSamplesINTEL);
 
     void *ret = sharingFactory.getExtensionFunctionAddress(funcName);
     if (ret != nullptr) {
@@ -5948,6 +5984,309 @@ cl_int CL_API_CALL clEnqueueNDCountKernelINTEL(cl_command_queue commandQueue,
     return retVal;
 }
 
+cl_int CL_API_CALL clGetDeviceMemoryUsageINTEL(cl_device_id device,
+                                               cl_bool localMemory,
+                                               cl_device_memory_usage_intel *memoryUsage) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("device", device, "localMemory", localMemory, "memoryUsage", memoryUsage);
+
+    ClDevice *pDevice = nullptr;
+    retVal = validateObjects(WithCastToInternal(device, &pDevice));
+    if (CL_SUCCESS != retVal) {
+        return retVal;
+    }
+    if (memoryUsage == nullptr) {
+        retVal = CL_INVALID_VALUE;
+        return retVal;
+    }
+
+    auto memoryManager = pDevice->getMemoryManager();
+    auto usage = memoryManager->getMemoryUsageStatistics(pDevice->getRootDeviceIndex()).getTotalUsage(localMemory == CL_TRUE);
+    memoryUsage->liveBytes = usage.liveBytes;
+    memoryUsage->peakBytes = usage.peakBytes;
+    memoryUsage->allocationCount = usage.allocationCount;
+    memoryUsage->osHandleCount = usage.osHandleCount;
+
+    return retVal;
+}
+
+cl_int CL_API_CALL clGetEventProfilingDurationsINTEL(cl_uint numEvents,
+                                                     const cl_event *eventList,
+                                                     cl_ulong *durations) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("numEvents", numEvents, "eventList", eventList, "durations", durations);
+
+    if (numEvents == 0 || eventList == nullptr || durations == nullptr) {
+        retVal = CL_INVALID_VALUE;
+        return retVal;
+    }
+
+    retVal = Event::getProfilingDurations(numEvents, eventList, durations);
+    return retVal;
+}
+
+cl_int CL_API_CALL clGetCommandQueueSubmissionStatisticsINTEL(cl_command_queue commandQueue,
+                                                              cl_bool copyEngine,
+                                                              cl_queue_submission_statistics_intel *statistics) {
+    static_assert(CL_QUEUE_SUBMISSION_WAIT_TIME_BUCKETS_INTEL == waitTimeHistogramBuckets, "wait time histogram size mismatch");
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandQueue", commandQueue, "copyEngine", copyEngine, "statistics", statistics);
+
+    CommandQueue *pCommandQueue = nullptr;
+    retVal = validateObjects(WithCastToInternal(commandQueue, &pCommandQueue));
+    if (CL_SUCCESS != retVal) {
+        return retVal;
+    }
+    auto csr = copyEngine ? pCommandQueue->getBcsCommandStreamReceiver() : &pCommandQueue->getGpgpuCommandStreamReceiver();
+    if (statistics == nullptr || csr == nullptr) {
+        retVal = CL_INVALID_VALUE;
+        return retVal;
+    }
+
+    auto submissionStatistics = csr->getSubmissionStatistics();
+    statistics->flushes = submissionStatistics.flushes;
+    statistics->ringBufferSwitches = submissionStatistics.ringBufferSwitches;
+    statistics->stallingPipeControls = submissionStatistics.stallingPipeControls;
+    statistics->stateBaseAddressReprogrammings = submissionStatistics.stateBaseAddressReprogrammings;
+    statistics->cacheFlushes = submissionStatistics.cacheFlushes;
+    statistics->kmdNotifySleeps = submissionStatistics.kmdNotifySleeps;
+    for (uint32_t i = 0; i < waitTimeHistogramBuckets; i++) {
+        statistics->waitTimeHistogram[i] = submissionStatistics.waitTimeHistogram[i];
+    }
+
+    return retVal;
+}
+
+cl_command_buffer_intel CL_API_CALL clCreateCommandBufferINTEL(cl_command_queue commandQueue,
+                                                              cl_int *errcodeRet) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandQueue", commandQueue);
+
+    cl_command_buffer_intel commandBuffer = nullptr;
+    CommandQueue *pCommandQueue = nullptr;
+    retVal = validateObjects(WithCastToInternal(commandQueue, &pCommandQueue));
+    if (CL_SUCCESS == retVal) {
+        // replay relies on in-order execution to chain the recorded launches
+        if (pCommandQueue->isOOQEnabled()) {
+            retVal = CL_INVALID_COMMAND_QUEUE;
+        } else {
+            commandBuffer = new ClCommandBuffer(pCommandQueue);
+        }
+    }
+
+    if (errcodeRet) {
+        *errcodeRet = retVal;
+    }
+    return commandBuffer;
+}
+
+cl_int CL_API_CALL clCommandNDRangeKernelINTEL(cl_command_buffer_intel commandBuffer,
+                                               cl_kernel kernel,
+                                               cl_uint workDim,
+                                               const size_t *globalWorkOffset,
+                                               const size_t *globalWorkSize,
+                                               const size_t *localWorkSize,
+                                               cl_uint *commandIndex) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandBuffer", commandBuffer, "kernel", kernel, "workDim", workDim,
+                   "globalWorkSize", NEO::FileLoggerInstance().getSizes(globalWorkSize, workDim, false),
+                   "localWorkSize", NEO::FileLoggerInstance().getSizes(localWorkSize, workDim, true),
+                   "commandIndex", commandIndex);
+
+    auto pCommandBuffer = castToObject<ClCommandBuffer>(commandBuffer);
+    if (pCommandBuffer == nullptr) {
+        retVal = CL_INVALID_VALUE;
+        return retVal;
+    }
+
+    MultiDeviceKernel *pMultiDeviceKernel = nullptr;
+    retVal = validateObjects(WithCastToInternal(kernel, &pMultiDeviceKernel));
+    if (CL_SUCCESS != retVal) {
+        return retVal;
+    }
+    if (pMultiDeviceKernel->getKernel(pCommandBuffer->getCommandQueue()->getDevice().getRootDeviceIndex()) == nullptr) {
+        retVal = CL_INVALID_KERNEL;
+        return retVal;
+    }
+
+    retVal = pCommandBuffer->recordNDRangeKernel(pMultiDeviceKernel, workDim, globalWorkOffset, globalWorkSize, localWorkSize, commandIndex);
+    return retVal;
+}
+
+cl_int CL_API_CALL clCommandBufferSetKernelArgINTEL(cl_command_buffer_intel commandBuffer,
+                                                    cl_uint commandIndex,
+                                                    cl_uint argIndex,
+                                                    size_t argSize,
+                                                    const void *argValue) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandBuffer", commandBuffer, "commandIndex", commandIndex, "argIndex", argIndex,
+                   "argSize", argSize, "argValue", argValue);
+
+    auto pCommandBuffer = castToObject<ClCommandBuffer>(commandBuffer);
+    if (pCommandBuffer == nullptr) {
+        retVal = CL_INVALID_VALUE;
+        return retVal;
+    }
+
+    retVal = pCommandBuffer->setKernelArg(commandIndex, argIndex, argSize, argValue);
+    return retVal;
+}
+
+cl_int CL_API_CALL clFinalizeCommandBufferINTEL(cl_command_buffer_intel commandBuffer) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandBuffer", commandBuffer);
+
+    auto pCommandBuffer = castToObject<ClCommandBuffer>(commandBuffer);
+    if (pCommandBuffer == nullptr) {
+        retVal = CL_INVALID_VALUE;
+        return retVal;
+    }
+
+    retVal = pCommandBuffer->finalize();
+    return retVal;
+}
+
+cl_int CL_API_CALL clEnqueueCommandBufferINTEL(cl_command_buffer_intel commandBuffer,
+                                               cl_uint numEventsInWaitList,
+                                               const cl_event *eventWaitList,
+                                               cl_event *event) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandBuffer", commandBuffer, "numEventsInWaitList", numEventsInWaitList,
+                   "eventWaitList", NEO::FileLoggerInstance().getEvents(reinterpret_cast<const uintptr_t *>(eventWaitList), numEventsInWaitList),
+                   "event", NEO::FileLoggerInstance().getEvents(reinterpret_cast<const uintptr_t *>(event), 1));
+
+    auto pCommandBuffer = castToObject<ClCommandBuffer>(commandBuffer);
+    if (pCommandBuffer == nullptr) {
+        retVal = CL_INVALID_VALUE;
+        return retVal;
+    }
+
+    retVal = validateObjects(EventWaitList(numEventsInWaitList, eventWaitList));
+    if (CL_SUCCESS != retVal) {
+        return retVal;
+    }
+
+    retVal = pCommandBuffer->enqueue(numEventsInWaitList, eventWaitList, event);
+    return retVal;
+}
+
+cl_int CL_API_CALL clReleaseCommandBufferINTEL(cl_command_buffer_intel commandBuffer) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandBuffer", commandBuffer);
+
+    auto pCommandBuffer = castToObject<ClCommandBuffer>(commandBuffer);
+    if (pCommandBuffer == nullptr) {
+        retVal = CL_INVALID_VALUE;
+        return retVal;
+    }
+
+    pCommandBuffer->release();
+    return retVal;
+}
+
+cl_int CL_API_CALL clWaitForAnyEventINTEL(cl_uint numEvents,
+                                          const cl_event *eventList,
+                                          cl_uint *signaledIndex) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("eventList", NEO::FileLoggerInstance().getEvents(reinterpret_cast<const uintptr_t *>(eventList), numEvents),
+                   "signaledIndex", signaledIndex);
+
+    if (numEvents == 0 || eventList == nullptr) {
+        retVal = CL_INVALID_VALUE;
+        return retVal;
+    }
+    for (cl_uint i = 0; i < numEvents && retVal == CL_SUCCESS; i++) {
+        retVal = validateObjects(eventList[i]);
+    }
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
+
+    auto context = castToObjectOrAbort<Event>(eventList[0])->getContext();
+    for (cl_uint i = 1; i < numEvents; i++) {
+        if (castToObjectOrAbort<Event>(eventList[i])->getContext() != context) {
+            retVal = CL_INVALID_CONTEXT;
+            return retVal;
+        }
+    }
+
+    retVal = Event::waitForAnyEvent(numEvents, eventList, signaledIndex);
+    return retVal;
+}
+
+// sampling is configured on the queue's GPGPU engine and covers every queue submitting to it
+cl_int CL_API_CALL clSetEngineTimelineSamplingINTEL(cl_command_queue commandQueue,
+                                                    cl_uint samplingPeriod) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandQueue", commandQueue, "samplingPeriod", samplingPeriod);
+
+    CommandQueue *pCommandQueue = nullptr;
+    retVal = validateObjects(WithCastToInternal(commandQueue, &pCommandQueue));
+    if (CL_SUCCESS != retVal) {
+        return retVal;
+    }
+
+    pCommandQueue->getGpgpuCommandStreamReceiver().setGpuTimelineSamplingPeriod(pCommandQueue->getDevice(), samplingPeriod);
+    return retVal;
+}
+
+cl_int CL_API_CALL clGetEngineTimelineSamplesINTEL(cl_command_queue commandQueue,
+                                                   cl_uint numSamples,
+                                                   cl_engine_timeline_sample_intel *samples,
+                                                   cl_uint *numSamplesRet) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandQueue", commandQueue, "numSamples", numSamples, "samples", samples, "numSamplesRet", numSamplesRet);
+
+    CommandQueue *pCommandQueue = nullptr;
+    retVal = validateObjects(WithCastToInternal(commandQueue, &pCommandQueue));
+    if (CL_SUCCESS != retVal) {
+        return retVal;
+    }
+    if ((numSamples > 0 && samples == nullptr) || (samples == nullptr && numSamplesRet == nullptr)) {
+        retVal = CL_INVALID_VALUE;
+        return retVal;
+    }
+
+    auto &csr = pCommandQueue->getGpgpuCommandStreamReceiver();
+    std::vector<GpuTimelineSampler::Sample> completedSamples(GpuTimelineSampler::ringSize);
+    uint32_t completedCount = 0u;
+    {
+        auto lock = csr.obtainUniqueOwnership();
+        if (csr.getGpuTimelineSampler()) {
+            completedCount = csr.getGpuTimelineSampler()->readSamples(completedSamples.data(), GpuTimelineSampler::ringSize);
+        }
+    }
+
+    if (samples) {
+        // the newest samples are returned when fewer are requested than completed
+        auto firstSample = completedCount > numSamples ? completedCount - numSamples : 0u;
+        for (auto i = firstSample; i < completedCount; i++) {
+            auto &sample = samples[i - firstSample];
+            sample.taskCount = completedSamples[i].taskCount;
+            sample.submitTime = completedSamples[i].submitTimeNs;
+            sample.startTime = completedSamples[i].gpuStartTimeNs;
+            sample.endTime = completedSamples[i].gpuEndTimeNs;
+        }
+        completedCount -= firstSample;
+    }
+    if (numSamplesRet) {
+        *numSamplesRet = completedCount;
+    }
+    return retVal;
+}
+
 cl_int CL_API_CALL clSetContextDestructorCallback(cl_context context,
                                                   void(CL_CALLBACK *pfnNotify)(cl_context /* context */, void * /* user_data */),
                                                   void *userData) {
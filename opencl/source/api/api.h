@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -1059,6 +1059,68 @@ cl_int CL_API_CALL clEnqueueNDCountKernelINTEL(
     const cl_event *eventWaitList,
     cl_event *event);
 
+cl_int CL_API_CALL clGetDeviceMemoryUsageINTEL(
+    cl_device_id device,
+    cl_bool localMemory,
+    cl_device_memory_usage_intel *memoryUsage);
+
+cl_int CL_API_CALL clGetEventProfilingDurationsINTEL(
+    cl_uint numEvents,
+    const cl_event *eventList,
+    cl_ulong *durations);
+
+cl_int CL_API_CALL clGetCommandQueueSubmissionStatisticsINTEL(
+    cl_command_queue commandQueue,
+    cl_bool copyEngine,
+    cl_queue_submission_statistics_intel *statistics);
+
+cl_command_buffer_intel CL_API_CALL clCreateCommandBufferINTEL(
+    cl_command_queue commandQueue,
+    cl_int *errcodeRet);
+
+cl_int CL_API_CALL clCommandNDRangeKernelINTEL(
+    cl_command_buffer_intel commandBuffer,
+    cl_kernel kernel,
+    cl_uint workDim,
+    const size_t *globalWorkOffset,
+    const size_t *globalWorkSize,
+    const size_t *localWorkSize,
+    cl_uint *commandIndex);
+
+cl_int CL_API_CALL clCommandBufferSetKernelArgINTEL(
+    cl_command_buffer_intel commandBuffer,
+    cl_uint commandIndex,
+    cl_uint argIndex,
+    size_t argSize,
+    const void *argValue);
+
+cl_int CL_API_CALL clFinalizeCommandBufferINTEL(
+    cl_command_buffer_intel commandBuffer);
+
+cl_int CL_API_CALL clEnqueueCommandBufferINTEL(
+    cl_command_buffer_intel commandBuffer,
+    cl_uint numEventsInWaitList,
+    const cl_event *eventWaitList,
+    cl_event *event);
+
+cl_int CL_API_CALL clReleaseCommandBufferINTEL(
+    cl_command_buffer_intel commandBuffer);
+
+cl_int CL_API_CALL clWaitForAnyEventINTEL(
+    cl_uint numEvents,
+    const cl_event *eventList,
+    cl_uint *signaledIndex);
+
+cl_int CL_API_CALL clSetEngineTimelineSamplingINTEL(
+    cl_command_queue commandQueue,
+    cl_uint samplingPeriod);
+
+cl_int CL_API_CALL clGetEngineTimelineSamplesINTEL(
+    cl_command_queue commandQueue,
+    cl_uint numSamples,
+    cl_engine_timeline_sample_intel *samples,
+    cl_uint *numSamplesRet);
+
 // OpenCL 2.2
 
 cl_int CL_API_CALL clSetProgramReleaseCallback(
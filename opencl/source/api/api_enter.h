@@ -1,16 +1,18 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "shared/source/utilities/perf_profiler.h"
+#include "shared/source/utilities/trace_events.h"
 
 #include "opencl/source/utilities/logger.h"
 
-#define API_ENTER(retValPointer) \
-    LoggerApiEnterWrapper<NEO::FileLogger<globalDebugFunctionalityLevel>::enabled()> ApiWrapperForSingleCall(__FUNCTION__, retValPointer)
+#define API_ENTER(retValPointer)                                                                                                       \
+    LoggerApiEnterWrapper<NEO::FileLogger<globalDebugFunctionalityLevel>::enabled()> ApiWrapperForSingleCall(__FUNCTION__, retValPointer); \
+    NEO::ScopedTraceEvent ApiTraceEventForSingleCall(__FUNCTION__, NEO::TraceEvents::Category::api)
 
 #if KMD_PROFILING == 1
 #undef API_ENTER
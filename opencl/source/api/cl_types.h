@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -19,6 +19,9 @@ struct ClDispatch {
 struct _cl_accelerator_intel : public ClDispatch {
 };
 
+struct _cl_command_buffer_intel : public ClDispatch {
+};
+
 struct _cl_command_queue : public ClDispatch {
 };
 
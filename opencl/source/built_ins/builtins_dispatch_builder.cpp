@@ -13,6 +13,7 @@
 #include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/built_ins_helper.h"
 #include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/hw_helper.h"
 
 #include "opencl/source/built_ins/aux_translation_builtin.h"
 #include "opencl/source/built_ins/built_ins.inl"
@@ -59,12 +60,20 @@ class BuiltInOp<EBuiltInOps::CopyBufferToBuffer> : public BuiltinDispatchInfoBui
         const auto srcMisalignment = srcMiddleStart % sizeof(uint32_t);
         const auto isSrcMisaligned = srcMisalignment != 0u;
 
+        // when src middle is cache line aligned as well, each work item moves whole blocks
+        const auto useWideMiddle = (false == isSrcMisaligned) && (srcMiddleStart % middleAlignment == 0) && isBufferBlockSizeSupported(wideMiddleElSize);
+        if (useWideMiddle) {
+            middleElSize = wideMiddleElSize;
+        }
+
         auto middleSizeEls = middleSizeBytes / middleElSize; // num work items in middle walker
 
         // Set-up ISA
         kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::Left, kernLeftLeftover->getKernel(clDevice.getRootDeviceIndex()));
         if (isSrcMisaligned) {
             kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::Middle, kernMiddleMisaligned->getKernel(clDevice.getRootDeviceIndex()));
+        } else if (useWideMiddle) {
+            kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::Middle, kernMiddleWide->getKernel(clDevice.getRootDeviceIndex()));
         } else {
             kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::Middle, kernMiddle->getKernel(clDevice.getRootDeviceIndex()));
         }
@@ -117,10 +126,13 @@ class BuiltInOp<EBuiltInOps::CopyBufferToBuffer> : public BuiltinDispatchInfoBui
     }
 
   protected:
+    static constexpr size_t wideMiddleElSize = sizeof(uint32_t) * 16;
     MultiDeviceKernel *kernLeftLeftover = nullptr;
     MultiDeviceKernel *kernMiddle = nullptr;
+    MultiDeviceKernel *kernMiddleWide = nullptr;
     MultiDeviceKernel *kernMiddleMisaligned = nullptr;
     MultiDeviceKernel *kernRightLeftover = nullptr;
+
     BuiltInOp(BuiltIns &kernelsLib, ClDevice &device, bool populateKernels)
         : BuiltinDispatchInfoBuilder(kernelsLib, device) {
         if (populateKernels) {
@@ -128,6 +140,7 @@ class BuiltInOp<EBuiltInOps::CopyBufferToBuffer> : public BuiltinDispatchInfoBui
                      "",
                      "CopyBufferToBufferLeftLeftover", kernLeftLeftover,
                      "CopyBufferToBufferMiddle", kernMiddle,
+                     "CopyBufferToBufferMiddleWide", kernMiddleWide,
                      "CopyBufferToBufferMiddleMisaligned", kernMiddleMisaligned,
                      "CopyBufferToBufferRightLeftover", kernRightLeftover);
         }
@@ -143,6 +156,7 @@ class BuiltInOp<EBuiltInOps::CopyBufferToBufferStateless> : public BuiltInOp<EBu
                  CompilerOptions::greaterThan4gbBuffersRequired,
                  "CopyBufferToBufferLeftLeftover", kernLeftLeftover,
                  "CopyBufferToBufferMiddle", kernMiddle,
+                 "CopyBufferToBufferMiddleWide", kernMiddleWide,
                  "CopyBufferToBufferMiddleMisaligned", kernMiddleMisaligned,
                  "CopyBufferToBufferRightLeftover", kernRightLeftover);
     }
@@ -300,11 +314,17 @@ class BuiltInOp<EBuiltInOps::FillBuffer> : public BuiltinDispatchInfoBuilder {
 
         uintptr_t middleSizeBytes = operationParams.size.x - leftSize - rightSize; // calc middle size
 
+        // middle is always cache line aligned, so each work item can fill whole blocks
+        const auto useWideMiddle = isBufferBlockSizeSupported(wideMiddleElSize);
+        if (useWideMiddle) {
+            middleElSize = wideMiddleElSize;
+        }
+
         auto middleSizeEls = middleSizeBytes / middleElSize; // num work items in middle walker
 
         // Set-up ISA
         kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::Left, kernLeftLeftover->getKernel(clDevice.getRootDeviceIndex()));
-        kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::Middle, kernMiddle->getKernel(clDevice.getRootDeviceIndex()));
+        kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::Middle, (useWideMiddle ? kernMiddleWide : kernMiddle)->getKernel(clDevice.getRootDeviceIndex()));
         kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::Right, kernRightLeftover->getKernel(clDevice.getRootDeviceIndex()));
 
         DEBUG_BREAK_IF((operationParams.srcMemObj == nullptr) || (operationParams.srcOffset != 0));
@@ -328,7 +348,7 @@ class BuiltInOp<EBuiltInOps::FillBuffer> : public BuiltinDispatchInfoBuilder {
 
         // Set-up patternSizeInEls
         kernelSplit1DBuilder.setArg(SplitDispatch::RegionCoordX::Left, 3, static_cast<OffsetType>(operationParams.srcMemObj->getSize()));
-        kernelSplit1DBuilder.setArg(SplitDispatch::RegionCoordX::Middle, 3, static_cast<OffsetType>(operationParams.srcMemObj->getSize() / middleElSize));
+        kernelSplit1DBuilder.setArg(SplitDispatch::RegionCoordX::Middle, 3, static_cast<OffsetType>(operationParams.srcMemObj->getSize() / sizeof(uint32_t)));
         kernelSplit1DBuilder.setArg(SplitDispatch::RegionCoordX::Right, 3, static_cast<OffsetType>(operationParams.srcMemObj->getSize()));
 
         // Set-up work sizes
@@ -346,8 +366,10 @@ class BuiltInOp<EBuiltInOps::FillBuffer> : public BuiltinDispatchInfoBuilder {
     }
 
   protected:
+    static constexpr size_t wideMiddleElSize = sizeof(uint32_t) * 16;
     MultiDeviceKernel *kernLeftLeftover = nullptr;
     MultiDeviceKernel *kernMiddle = nullptr;
+    MultiDeviceKernel *kernMiddleWide = nullptr;
     MultiDeviceKernel *kernRightLeftover = nullptr;
 
     BuiltInOp(BuiltIns &kernelsLib, ClDevice &device, bool populateKernels)
@@ -357,6 +379,7 @@ class BuiltInOp<EBuiltInOps::FillBuffer> : public BuiltinDispatchInfoBuilder {
                      "",
                      "FillBufferLeftLeftover", kernLeftLeftover,
                      "FillBufferMiddle", kernMiddle,
+                     "FillBufferMiddleWide", kernMiddleWide,
                      "FillBufferRightLeftover", kernRightLeftover);
         }
     }
@@ -370,6 +393,7 @@ class BuiltInOp<EBuiltInOps::FillBufferStateless> : public BuiltInOp<EBuiltInOps
                  CompilerOptions::greaterThan4gbBuffersRequired,
                  "FillBufferLeftLeftover", kernLeftLeftover,
                  "FillBufferMiddle", kernMiddle,
+                 "FillBufferMiddleWide", kernMiddleWide,
                  "FillBufferRightLeftover", kernRightLeftover);
     }
     bool buildDispatchInfos(MultiDispatchInfo &multiDispatchInfos) const override {
@@ -798,6 +822,11 @@ void BuiltInOwnershipWrapper::takeOwnership(BuiltinDispatchInfoBuilder &inputBui
     }
 }
 
+bool BuiltinDispatchInfoBuilder::isBufferBlockSizeSupported(size_t blockSize) const {
+    auto &hwInfo = clDevice.getHardwareInfo();
+    return HwHelper::get(hwInfo.platform.eRenderCoreFamily).getBuiltinCopyFillBlockSize(hwInfo) >= blockSize;
+}
+
 std::unique_ptr<Program> BuiltinDispatchInfoBuilder::createProgramFromCode(const BuiltinCode &bc, const ClDeviceVector &deviceVector) {
     std::unique_ptr<Program> ret;
     const char *data = bc.resource.data();
@@ -46,6 +46,7 @@ struct BuiltinOpParams {
     Vec3<size_t> srcOffset = {0, 0, 0};
     Vec3<size_t> dstOffset = {0, 0, 0};
     Vec3<size_t> size = {0, 0, 0};
+    size_t patternSize = 0;
     size_t srcRowPitch = 0;
     size_t dstRowPitch = 0;
     size_t srcSlicePitch = 0;
@@ -103,6 +104,8 @@ class BuiltinDispatchInfoBuilder {
 
     cl_int grabKernels() { return CL_SUCCESS; }
 
+    bool isBufferBlockSizeSupported(size_t blockSize) const;
+
     std::unique_ptr<Program> prog;
     std::vector<std::unique_ptr<MultiDeviceKernel>> usedKernels;
     BuiltIns &kernelsLib;
@@ -6,15 +6,31 @@
  */
 
 #include "opencl/source/cl_device/cl_device.h"
+#include "opencl/source/program/program.h"
 
 namespace NEO {
 template <typename... KernelsDescArgsT>
 void BuiltinDispatchInfoBuilder::populate(EBuiltInOps::Type op, ConstStringRef options, KernelsDescArgsT &&...desc) {
-    auto src = kernelsLib.getBuiltinsLib().getBuiltinCode(op, BuiltinCode::ECodeType::Any, clDevice.getDevice());
+    auto &builtinsLib = kernelsLib.getBuiltinsLib();
+    auto src = builtinsLib.getCachedBuiltinCode(op, options, "ocl", clDevice.getDevice());
+    bool storeInCompilerCache = BuiltinsLib::isCompilerCacheEnabled() && src.resource.empty();
+    if (src.resource.empty()) {
+        src = builtinsLib.getBuiltinCode(op, BuiltinCode::ECodeType::Any, clDevice.getDevice());
+        storeInCompilerCache &= (src.type != BuiltinCode::ECodeType::Binary);
+    }
     ClDeviceVector deviceVector;
     deviceVector.push_back(&clDevice);
     prog.reset(BuiltinDispatchInfoBuilder::createProgramFromCode(src, deviceVector).release());
     prog->build(deviceVector, options.data(), kernelsLib.isCacheingEnabled());
+    if (storeInCompilerCache) {
+        size_t binarySize = 0u;
+        prog->getInfo(CL_PROGRAM_BINARY_SIZES, sizeof(binarySize), &binarySize, nullptr);
+        auto binary = std::make_unique<unsigned char[]>(binarySize);
+        auto binaryPtr = binary.get();
+        if (binarySize > 0u && CL_SUCCESS == prog->getInfo(CL_PROGRAM_BINARIES, sizeof(binaryPtr), &binaryPtr, nullptr)) {
+            builtinsLib.cacheBuiltinBinary(op, options, "ocl", clDevice.getDevice(), ArrayRef<const char>(reinterpret_cast<const char *>(binaryPtr), binarySize));
+        }
+    }
     grabKernels(std::forward<KernelsDescArgsT>(desc)...);
 }
 } // namespace NEO
@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/command_queue/cl_command_buffer.h"
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+
+#include "opencl/source/command_queue/command_queue.h"
+#include "opencl/source/kernel/multi_device_kernel.h"
+
+namespace NEO {
+
+ClCommandBuffer::ClCommandBuffer(CommandQueue *commandQueue) : commandQueue(commandQueue) {
+    commandQueue->incRefInternal();
+}
+
+ClCommandBuffer::~ClCommandBuffer() {
+    for (auto &command : commands) {
+        command.kernel->release();
+    }
+    commandQueue->decRefInternal();
+}
+
+cl_int ClCommandBuffer::recordNDRangeKernel(MultiDeviceKernel *multiDeviceKernel, cl_uint workDim, const size_t *globalWorkOffset,
+                                            const size_t *globalWorkSize, const size_t *localWorkSize, cl_uint *commandIndex) {
+    if (finalized) {
+        return CL_INVALID_OPERATION;
+    }
+    if (workDim < 1 || workDim > 3) {
+        return CL_INVALID_WORK_DIMENSION;
+    }
+    if (globalWorkSize == nullptr) {
+        return CL_INVALID_GLOBAL_WORK_SIZE;
+    }
+
+    cl_int retVal = CL_SUCCESS;
+    auto clonedKernel = MultiDeviceKernel::create(multiDeviceKernel->getProgram(), multiDeviceKernel->getKernelInfos(), &retVal);
+    if (retVal != CL_SUCCESS) {
+        if (clonedKernel) {
+            clonedKernel->release();
+        }
+        return retVal;
+    }
+    retVal = clonedKernel->cloneKernel(multiDeviceKernel);
+    if (retVal != CL_SUCCESS) {
+        clonedKernel->release();
+        return retVal;
+    }
+
+    RecordedKernel command;
+    command.kernel = clonedKernel;
+    command.workDim = workDim;
+    command.hasGlobalWorkOffset = (globalWorkOffset != nullptr);
+    command.hasLocalWorkSize = (localWorkSize != nullptr);
+    for (cl_uint dim = 0; dim < workDim; dim++) {
+        command.globalWorkOffset[dim] = globalWorkOffset ? globalWorkOffset[dim] : 0u;
+        command.globalWorkSize[dim] = globalWorkSize[dim];
+        command.localWorkSize[dim] = localWorkSize ? localWorkSize[dim] : 0u;
+    }
+
+    if (commandIndex) {
+        *commandIndex = static_cast<cl_uint>(commands.size());
+    }
+    commands.push_back(command);
+    return CL_SUCCESS;
+}
+
+cl_int ClCommandBuffer::setKernelArg(cl_uint commandIndex, cl_uint argIndex, size_t argSize, const void *argValue) {
+    if (commandIndex >= commands.size()) {
+        return CL_INVALID_VALUE;
+    }
+    auto kernel = commands[commandIndex].kernel;
+    if (kernel->getKernelArguments().size() <= argIndex) {
+        return CL_INVALID_ARG_INDEX;
+    }
+    auto retVal = kernel->checkCorrectImageAccessQualifier(argIndex, argSize, argValue);
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
+    return kernel->setArg(argIndex, argSize, argValue);
+}
+
+cl_int ClCommandBuffer::finalize() {
+    if (finalized) {
+        return CL_INVALID_OPERATION;
+    }
+    finalized = true;
+    return CL_SUCCESS;
+}
+
+cl_int ClCommandBuffer::enqueue(cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event) {
+    if (!finalized) {
+        return CL_INVALID_OPERATION;
+    }
+    if (commands.empty()) {
+        return commandQueue->enqueueMarkerWithWaitList(numEventsInWaitList, eventWaitList, event);
+    }
+
+    auto rootDeviceIndex = commandQueue->getDevice().getRootDeviceIndex();
+    auto &csr = commandQueue->getGpgpuCommandStreamReceiver();
+    auto lock = csr.obtainUniqueOwnership();
+    auto dispatchMode = csr.getDispatchMode();
+    csr.overrideDispatchPolicy(DispatchMode::BatchedDispatch);
+
+    // the queue is in-order, so the wait list gates the first launch and the event of the last launch covers the replay
+    cl_int retVal = CL_SUCCESS;
+    for (size_t i = 0; i < commands.size() && retVal == CL_SUCCESS; i++) {
+        auto &command = commands[i];
+        bool firstCommand = (i == 0);
+        bool lastCommand = (i + 1 == commands.size());
+        retVal = commandQueue->enqueueKernel(command.kernel->getKernel(rootDeviceIndex),
+                                             command.workDim,
+                                             command.hasGlobalWorkOffset ? command.globalWorkOffset.data() : nullptr,
+                                             command.globalWorkSize.data(),
+                                             command.hasLocalWorkSize ? command.localWorkSize.data() : nullptr,
+                                             firstCommand ? numEventsInWaitList : 0u,
+                                             firstCommand ? eventWaitList : nullptr,
+                                             lastCommand ? event : nullptr);
+    }
+
+    csr.overrideDispatchPolicy(dispatchMode);
+    csr.flushBatchedSubmissions();
+    return retVal;
+}
+
+} // namespace NEO
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "opencl/extensions/public/cl_ext_private.h"
+#include "opencl/source/api/cl_types.h"
+#include "opencl/source/helpers/base_object.h"
+
+#include <array>
+#include <vector>
+
+namespace NEO {
+class CommandQueue;
+class MultiDeviceKernel;
+
+template <>
+struct OpenCLObjectMapper<_cl_command_buffer_intel> {
+    typedef class ClCommandBuffer DerivedType;
+};
+
+// Kernel launches recorded once for an in-order queue and replayed many times.
+// Every recorded launch owns a clone of its kernel, so arguments are captured at record time
+// and can be patched later without affecting the source kernel. A replay goes through the regular
+// enqueue path with the CSR in batched dispatch mode, so the submission aggregator sends all
+// launches to the GPU in a single submission.
+class ClCommandBuffer : public BaseObject<_cl_command_buffer_intel> {
+  public:
+    static const cl_ulong objectMagic = 0x7C3E5A1D92B84F60LL;
+
+    ClCommandBuffer(CommandQueue *commandQueue);
+    ~ClCommandBuffer() override;
+
+    cl_int recordNDRangeKernel(MultiDeviceKernel *multiDeviceKernel, cl_uint workDim, const size_t *globalWorkOffset,
+                               const size_t *globalWorkSize, const size_t *localWorkSize, cl_uint *commandIndex);
+    cl_int setKernelArg(cl_uint commandIndex, cl_uint argIndex, size_t argSize, const void *argValue);
+    cl_int finalize();
+    cl_int enqueue(cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event);
+
+    CommandQueue *getCommandQueue() const { return commandQueue; }
+    size_t getCommandsCount() const { return commands.size(); }
+    MultiDeviceKernel *getRecordedKernel(cl_uint commandIndex) const { return commands[commandIndex].kernel; }
+    bool isFinalized() const { return finalized; }
+
+  protected:
+    struct RecordedKernel {
+        MultiDeviceKernel *kernel = nullptr;
+        cl_uint workDim = 0;
+        bool hasGlobalWorkOffset = false;
+        bool hasLocalWorkSize = false;
+        std::array<size_t, 3> globalWorkOffset = {};
+        std::array<size_t, 3> globalWorkSize = {};
+        std::array<size_t, 3> localWorkSize = {};
+    };
+
+    CommandQueue *commandQueue = nullptr;
+    std::vector<RecordedKernel> commands;
+    bool finalized = false;
+};
+} // namespace NEO
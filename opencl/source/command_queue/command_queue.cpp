@@ -12,10 +12,13 @@
 #include "shared/source/helpers/array_count.h"
 #include "shared/source/helpers/engine_node_helper.h"
 #include "shared/source/helpers/get_info.h"
+#include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/helpers/timestamp_packet.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
+#include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/utilities/api_intercept.h"
 #include "shared/source/utilities/tag_allocator.h"
@@ -38,6 +41,7 @@
 
 #include "CL/cl_ext.h"
 
+#include <algorithm>
 #include <limits>
 #include <map>
 
@@ -98,6 +102,11 @@ CommandQueue::~CommandQueue() {
     }
 
     if (device) {
+        if (!deferredPrintfOutputs.empty()) {
+            CommandQueue::waitUntilComplete(taskCount, bcsTaskCount, flushStamp->peekStamp(), false);
+            printDeferredPrintfOutput(taskCount);
+        }
+
         auto storageForAllocation = gpgpuEngine->commandStreamReceiver->getInternalAllocationStorage();
 
         if (commandStream) {
@@ -108,8 +117,15 @@ CommandQueue::~CommandQueue() {
         if (this->perfCountersEnabled) {
             device->getPerformanceCounters()->shutdown();
         }
+
+        for (auto &stagingBuffer : stagingBuffers) {
+            if (stagingBuffer.allocation) {
+                device->getMemoryManager()->checkGpuUsageAndDestroyGraphicsAllocations(stagingBuffer.allocation);
+            }
+        }
     }
 
+    crossEngineTimestampPacketNodes.reset();
     timestampPacketContainer.reset();
     //for normal queue, decrement ref count on context
     //special queue is owned by context so ref count doesn't have to be decremented
@@ -314,6 +330,14 @@ cl_int CommandQueue::enqueueReleaseSharedObjects(cl_uint numObjects, const cl_me
 }
 
 void CommandQueue::updateFromCompletionStamp(const CompletionStamp &completionStamp, Event *outEvent) {
+    if (completionStamp.taskCount == CompletionStamp::failed) {
+        // nothing was submitted, terminate the event instead of waiting for a task count that never comes
+        if (outEvent) {
+            outEvent->updateCompletionStamp(taskCount, bcsTaskCount, taskLevel, flushStamp->peekStamp());
+            outEvent->setStatus(CL_OUT_OF_RESOURCES);
+        }
+        return;
+    }
     DEBUG_BREAK_IF(this->taskLevel > completionStamp.taskLevel);
     DEBUG_BREAK_IF(this->taskCount > completionStamp.taskCount);
     if (completionStamp.taskCount != CompletionStamp::notReady) {
@@ -370,9 +394,13 @@ cl_int CommandQueue::enqueueWriteMemObjForUnmap(MemObj *memObj, void *mappedPtr,
             auto mipIdx = getMipLevelOriginIdx(image->peekClMemObjType());
             UNRECOVERABLE_IF(mipIdx >= 4);
             writeOrigin[mipIdx] = unmapInfo.mipLevel;
-            retVal = enqueueWriteImage(image, CL_FALSE, writeOrigin, &unmapInfo.size[0],
-                                       image->getHostPtrRowPitch(), image->getHostPtrSlicePitch(), mappedPtr, memObj->getMapAllocation(getDevice().getRootDeviceIndex()),
-                                       eventsRequest.numEventsInWaitList, eventsRequest.eventWaitList, eventsRequest.outEvent);
+            if (isCpuDetilingForMapAllowed(*image, &unmapInfo.size[0], eventsRequest)) {
+                retVal = transferTiledImageDataOnCpu(*image, mappedPtr, writeOrigin, &unmapInfo.size[0], false, eventsRequest);
+            } else {
+                retVal = enqueueWriteImage(image, CL_FALSE, writeOrigin, &unmapInfo.size[0],
+                                           image->getHostPtrRowPitch(), image->getHostPtrSlicePitch(), mappedPtr, memObj->getMapAllocation(getDevice().getRootDeviceIndex()),
+                                           eventsRequest.numEventsInWaitList, eventsRequest.eventWaitList, eventsRequest.outEvent);
+            }
         }
     } else {
         retVal = enqueueMarkerWithWaitList(eventsRequest.numEventsInWaitList, eventsRequest.eventWaitList, eventsRequest.outEvent);
@@ -388,6 +416,31 @@ cl_int CommandQueue::enqueueWriteMemObjForUnmap(MemObj *memObj, void *mappedPtr,
     return retVal;
 }
 
+bool CommandQueue::isCpuDetilingForMapAllowed(Image &image, const size_t *region, const EventsRequest &eventsRequest) {
+    // the copy is done synchronously, so it cannot wait for user events signaled later
+    return eventsRequest.numEventsInWaitList == 0 && !isQueueBlocked() &&
+           image.isCpuDetilingAllowed(region, getDevice().getRootDeviceIndex());
+}
+
+cl_int CommandQueue::transferTiledImageDataOnCpu(Image &image, void *hostPtr, const size_t *origin, const size_t *region, bool toHostPtr, EventsRequest &eventsRequest) {
+    auto retVal = finish();
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
+
+    image.transferTiledData(hostPtr, origin, region, getDevice().getRootDeviceIndex(), toHostPtr);
+    if (!toHostPtr) {
+        auto graphicsAllocation = image.getGraphicsAllocation(getDevice().getRootDeviceIndex());
+        graphicsAllocation->setAubWritable(true, GraphicsAllocation::defaultBank);
+        graphicsAllocation->setTbxWritable(true, GraphicsAllocation::defaultBank);
+    }
+
+    if (eventsRequest.outEvent) {
+        retVal = enqueueMarkerWithWaitList(0, nullptr, eventsRequest.outEvent);
+    }
+    return retVal;
+}
+
 void *CommandQueue::enqueueReadMemObjForMap(TransferProperties &transferProperties, EventsRequest &eventsRequest, cl_int &errcodeRet) {
     void *basePtr = transferProperties.memObj->getBasePtrForMap(getDevice().getRootDeviceIndex());
     size_t mapPtrOffset = transferProperties.memObj->calculateOffsetForMapping(transferProperties.offset) + transferProperties.mipPtrOffset;
@@ -402,7 +455,13 @@ void *CommandQueue::enqueueReadMemObjForMap(TransferProperties &transferProperti
         return nullptr;
     }
 
-    if (transferProperties.memObj->peekClMemObjType() == CL_MEM_OBJECT_BUFFER) {
+    if (transferProperties.mapFlags == CL_MAP_WRITE_INVALIDATE_REGION) {
+        // mapped contents are undefined, only ordering against previous commands is kept
+        errcodeRet = enqueueMarkerWithWaitList(eventsRequest.numEventsInWaitList, eventsRequest.eventWaitList, eventsRequest.outEvent);
+        if (errcodeRet == CL_SUCCESS && transferProperties.blocking) {
+            errcodeRet = finish();
+        }
+    } else if (transferProperties.memObj->peekClMemObjType() == CL_MEM_OBJECT_BUFFER) {
         auto buffer = castToObject<Buffer>(transferProperties.memObj);
         errcodeRet = enqueueReadBuffer(buffer, transferProperties.blocking, transferProperties.offset[0], transferProperties.size[0],
                                        returnPtr, transferProperties.memObj->getMapAllocation(getDevice().getRootDeviceIndex()), eventsRequest.numEventsInWaitList,
@@ -413,10 +472,14 @@ void *CommandQueue::enqueueReadMemObjForMap(TransferProperties &transferProperti
         auto mipIdx = getMipLevelOriginIdx(image->peekClMemObjType());
         UNRECOVERABLE_IF(mipIdx >= 4);
         readOrigin[mipIdx] = transferProperties.mipLevel;
-        errcodeRet = enqueueReadImage(image, transferProperties.blocking, readOrigin, &transferProperties.size[0],
-                                      image->getHostPtrRowPitch(), image->getHostPtrSlicePitch(),
-                                      returnPtr, transferProperties.memObj->getMapAllocation(getDevice().getRootDeviceIndex()), eventsRequest.numEventsInWaitList,
-                                      eventsRequest.eventWaitList, eventsRequest.outEvent);
+        if (isCpuDetilingForMapAllowed(*image, &transferProperties.size[0], eventsRequest)) {
+            errcodeRet = transferTiledImageDataOnCpu(*image, returnPtr, readOrigin, &transferProperties.size[0], true, eventsRequest);
+        } else {
+            errcodeRet = enqueueReadImage(image, transferProperties.blocking, readOrigin, &transferProperties.size[0],
+                                          image->getHostPtrRowPitch(), image->getHostPtrSlicePitch(),
+                                          returnPtr, transferProperties.memObj->getMapAllocation(getDevice().getRootDeviceIndex()), eventsRequest.numEventsInWaitList,
+                                          eventsRequest.eventWaitList, eventsRequest.outEvent);
+        }
     }
 
     if (errcodeRet != CL_SUCCESS) {
@@ -431,7 +494,7 @@ void *CommandQueue::enqueueReadMemObjForMap(TransferProperties &transferProperti
 }
 
 void *CommandQueue::enqueueMapMemObject(TransferProperties &transferProperties, EventsRequest &eventsRequest, cl_int &errcodeRet) {
-    if (transferProperties.memObj->mappingOnCpuAllowed()) {
+    if (transferProperties.memObj->mappingOnCpuAllowed() || transferProperties.memObj->lockForDirectMapping(getDevice().getRootDeviceIndex())) {
         return cpuDataTransferHandler(transferProperties, eventsRequest, errcodeRet);
     } else {
         return enqueueReadMemObjForMap(transferProperties, eventsRequest, errcodeRet);
@@ -440,7 +503,7 @@ void *CommandQueue::enqueueMapMemObject(TransferProperties &transferProperties,
 
 cl_int CommandQueue::enqueueUnmapMemObject(TransferProperties &transferProperties, EventsRequest &eventsRequest) {
     cl_int retVal = CL_SUCCESS;
-    if (transferProperties.memObj->mappingOnCpuAllowed()) {
+    if (transferProperties.memObj->mappingOnCpuAllowed() || transferProperties.memObj->lockForDirectMapping(getDevice().getRootDeviceIndex())) {
         cpuDataTransferHandler(transferProperties, eventsRequest, retVal);
     } else {
         retVal = enqueueWriteMemObjForUnmap(transferProperties.memObj, transferProperties.ptr, eventsRequest);
@@ -456,6 +519,13 @@ void *CommandQueue::enqueueMapBuffer(Buffer *buffer, cl_bool blockingMap,
     TransferProperties transferProperties(buffer, CL_COMMAND_MAP_BUFFER, mapFlags, blockingMap != CL_FALSE, &offset, &size, nullptr, false, getDevice().getRootDeviceIndex());
     EventsRequest eventsRequest(numEventsInWaitList, eventWaitList, event);
 
+    buffer->getCompressionUsage().cpuAccesses++;
+
+    errcodeRet = buffer->createLazyBacking(getDevice().getRootDeviceIndex());
+    if (errcodeRet != CL_SUCCESS) {
+        return nullptr;
+    }
+
     return enqueueMapMemObject(transferProperties, eventsRequest, errcodeRet);
 }
 
@@ -504,7 +574,7 @@ void CommandQueue::enqueueBlockedMapUnmapOperation(const cl_event *eventWaitList
                                                    MemObj *memObj,
                                                    MemObjSizeArray &copySize,
                                                    MemObjOffsetArray &copyOffset,
-                                                   bool readOnly,
+                                                   bool skipTransfer,
                                                    EventBuilder &externalEventBuilder) {
     EventBuilder internalEventBuilder;
     EventBuilder *eventBuilder;
@@ -519,7 +589,7 @@ void CommandQueue::enqueueBlockedMapUnmapOperation(const cl_event *eventWaitList
     }
 
     //store task data in event
-    auto cmd = std::unique_ptr<Command>(new CommandMapUnmap(opType, *memObj, copySize, copyOffset, readOnly, *this));
+    auto cmd = std::unique_ptr<Command>(new CommandMapUnmap(opType, *memObj, copySize, copyOffset, skipTransfer, *this));
     eventBuilder->getEvent()->setCommand(std::move(cmd));
 
     //bind output event with input events
@@ -590,27 +660,33 @@ void CommandQueue::waitForEventsFromDifferentRootDeviceIndex(cl_uint numEventsIn
                                                              StackVec<cl_event, 8> &waitListCurrentRootDeviceIndex, bool &isEventWaitListFromPreviousRootDevice) {
     isEventWaitListFromPreviousRootDevice = false;
 
-    for (auto &rootDeviceIndex : context->getRootDeviceIndices()) {
-        CommandQueue *commandQueuePreviousRootDevice = nullptr;
-        auto maxTaskCountPreviousRootDevice = 0u;
-
-        if (this->getDevice().getRootDeviceIndex() != rootDeviceIndex) {
-            for (auto eventId = 0u; eventId < numEventsInWaitList; eventId++) {
-                auto event = castToObject<Event>(eventWaitList[eventId]);
-
-                if (event->getCommandQueue() && event->getCommandQueue()->getDevice().getRootDeviceIndex() == rootDeviceIndex) {
-                    maxTaskCountPreviousRootDevice = std::max(maxTaskCountPreviousRootDevice, event->peekTaskCount());
-                    commandQueuePreviousRootDevice = event->getCommandQueue();
-                    isEventWaitListFromPreviousRootDevice = true;
-                }
-            }
+    // task counts are only comparable within one CSR, so wait for each CSR of the other root devices separately
+    StackVec<std::pair<CommandStreamReceiver *, uint32_t>, 8> taskCountsToWait;
+    for (auto eventId = 0u; eventId < numEventsInWaitList; eventId++) {
+        auto event = castToObject<Event>(eventWaitList[eventId]);
+        auto eventQueue = event->getCommandQueue();
+        if (eventQueue == nullptr || eventQueue->getDevice().getRootDeviceIndex() == this->getDevice().getRootDeviceIndex()) {
+            continue;
+        }
+        isEventWaitListFromPreviousRootDevice = true;
 
-            if (maxTaskCountPreviousRootDevice) {
-                commandQueuePreviousRootDevice->getCommandStreamReceiver(false).waitForCompletionWithTimeout(false, 0, maxTaskCountPreviousRootDevice);
-            }
+        auto csr = &eventQueue->getGpgpuCommandStreamReceiver();
+        auto taskCount = event->peekTaskCount();
+        if (*csr->getTagAddress() >= taskCount) {
+            continue;
+        }
+        auto taskCountToWait = std::find_if(taskCountsToWait.begin(), taskCountsToWait.end(), [csr](const auto &entry) { return entry.first == csr; });
+        if (taskCountToWait == taskCountsToWait.end()) {
+            taskCountsToWait.push_back({csr, taskCount});
+        } else {
+            taskCountToWait->second = std::max(taskCountToWait->second, taskCount);
         }
     }
 
+    for (auto &taskCountToWait : taskCountsToWait) {
+        taskCountToWait.first->waitForCompletionWithTimeout(false, 0, taskCountToWait.second);
+    }
+
     if (isEventWaitListFromPreviousRootDevice) {
         for (auto eventId = 0u; eventId < numEventsInWaitList; eventId++) {
             auto event = castToObject<Event>(eventWaitList[eventId]);
@@ -657,7 +733,16 @@ void CommandQueue::obtainNewTimestampPacketNodes(size_t numberOfNodes, Timestamp
     previousNodes.swapNodes(*timestampPacketContainer);
 
     if ((previousNodes.peekNodes().size() > 0) && (previousNodes.peekNodes()[0]->getAllocator() != allocator)) {
-        clearAllDependencies = false;
+        if (isOOQEnabled()) {
+            // commands on the other engine are ordered only by events, barriers and markers
+            if (!crossEngineTimestampPacketNodes) {
+                crossEngineTimestampPacketNodes = std::make_unique<TimestampPacketContainer>();
+            }
+            crossEngineTimestampPacketNodes->resolveDependencies(false);
+            crossEngineTimestampPacketNodes->assignAndIncrementNodesRefCounts(previousNodes);
+        } else {
+            clearAllDependencies = false;
+        }
     }
 
     previousNodes.resolveDependencies(clearAllDependencies);
@@ -669,6 +754,28 @@ void CommandQueue::obtainNewTimestampPacketNodes(size_t numberOfNodes, Timestamp
     }
 }
 
+void CommandQueue::obtainCrossEngineDependencies(TimestampPacketContainer &dependencies, bool clearPendingNodes) {
+    if (!isOOQEnabled() || !timestampPacketContainer) {
+        return;
+    }
+
+    TimestampPacketContainer candidateNodes;
+    candidateNodes.assignAndIncrementNodesRefCounts(*timestampPacketContainer);
+    if (crossEngineTimestampPacketNodes) {
+        candidateNodes.assignAndIncrementNodesRefCounts(*crossEngineTimestampPacketNodes);
+        crossEngineTimestampPacketNodes->resolveDependencies(clearPendingNodes);
+    }
+
+    // gpgpu work is covered by the stalling pipe control, only blits need to be waited for
+    auto gpgpuAllocator = getGpgpuCommandStreamReceiver().getTimestampPacketAllocator();
+    for (auto node : candidateNodes.peekNodes()) {
+        if (node->getAllocator() != gpgpuAllocator && !node->canBeReleased()) {
+            node->incRefCount();
+            dependencies.add(node);
+        }
+    }
+}
+
 size_t CommandQueue::estimateTimestampPacketNodesCount(const MultiDispatchInfo &dispatchInfo) const {
     size_t nodesCount = dispatchInfo.size();
     auto mainKernel = dispatchInfo.peekMainKernel();
@@ -733,6 +840,38 @@ bool CommandQueue::bufferCpuCopyAllowed(Buffer *buffer, cl_command_type commandT
     return false;
 }
 
+bool CommandQueue::svmMemcpyCpuCopyAllowed(const SvmAllocationData *dstSvmData, const SvmAllocationData *srcSvmData, cl_bool blocking, size_t size,
+                                           cl_uint numEventsInWaitList, const cl_event *eventWaitList) {
+    if (DebugManager.flags.DoCpuCopyOnSvmMemcpy.get() == 0) {
+        return false;
+    }
+
+    // only host USM and system memory are accessible by the CPU without migration or mapping
+    auto isCpuAccessible = [](const SvmAllocationData *svmData) {
+        return svmData == nullptr || svmData->memoryType == InternalMemoryType::HOST_UNIFIED_MEMORY;
+    };
+    if (!isCpuAccessible(dstSvmData) || !isCpuAccessible(srcSvmData)) {
+        return false;
+    }
+
+    // aub and tbx dumps would miss the copy
+    if (getGpgpuCommandStreamReceiver().getType() != CommandStreamReceiverType::CSR_HW) {
+        return false;
+    }
+
+    // finish() only covers this queue, so events from other queues would not be waited for
+    if (blocking == CL_FALSE || numEventsInWaitList != 0) {
+        return false;
+    }
+
+    if (DebugManager.flags.DoCpuCopyOnSvmMemcpy.get() == 1) {
+        return true;
+    }
+
+    // both sides are in system memory, so only integrated devices can beat the CPU on large copies
+    return !getDevice().getHardwareInfo().capabilityTable.isIntegratedDevice || size <= Buffer::maxBufferSizeForReadWriteOnCpu;
+}
+
 bool CommandQueue::queueDependenciesClearRequired() const {
     return isOOQEnabled() || DebugManager.flags.OmitTimestampPacketDependencies.get();
 }
@@ -755,6 +894,10 @@ bool CommandQueue::blitEnqueueAllowed(cl_command_type cmdType) const {
     case CL_COMMAND_SVM_MEMCPY:
     case CL_COMMAND_READ_IMAGE:
     case CL_COMMAND_WRITE_IMAGE:
+    case CL_COMMAND_COPY_IMAGE:
+    case CL_COMMAND_COPY_IMAGE_TO_BUFFER:
+    case CL_COMMAND_COPY_BUFFER_TO_IMAGE:
+    case CL_COMMAND_FILL_BUFFER:
         return blitterSupported && blitEnqueueAllowed;
     default:
         return false;
@@ -762,6 +905,14 @@ bool CommandQueue::blitEnqueueAllowed(cl_command_type cmdType) const {
 }
 
 bool CommandQueue::blitEnqueuePreferred(cl_command_type cmdType, const BuiltinOpParams &builtinOpParams) const {
+    if (cmdType == CL_COMMAND_FILL_BUFFER) {
+        if (DebugManager.flags.PreferCopyEngineForFillBuffer.get() != -1) {
+            return static_cast<bool>(DebugManager.flags.PreferCopyEngineForFillBuffer.get());
+        }
+        // large fills, like zeroing whole buffers, leave the EUs free for kernels
+        return builtinOpParams.size.x >= minSizeForBlitFill;
+    }
+
     bool isLocalToLocal = false;
 
     if (cmdType == CL_COMMAND_COPY_BUFFER &&
@@ -786,12 +937,119 @@ bool CommandQueue::blitEnqueuePreferred(cl_command_type cmdType, const BuiltinOp
     return true;
 }
 
-bool CommandQueue::blitEnqueueImageAllowed(const size_t *origin, const size_t *region) {
+bool CommandQueue::isAuxResolveCompleted(const GraphicsAllocation &allocation) const {
+    if (DebugManager.flags.SkipResolvedAuxTranslation.get() == 0 || !allocation.isAuxResolved()) {
+        return false;
+    }
+    // translations are skipped without programming any dependency, so the resolving blit has to be done already
+    auto bcsCsr = getBcsCommandStreamReceiver();
+    if (bcsCsr == nullptr) {
+        return false;
+    }
+    auto contextId = bcsCsr->getOsContext().getContextId();
+    return allocation.isUsedByOsContext(contextId) && allocation.getTaskCount(contextId) <= *bcsCsr->getTagAddress();
+}
+
+GraphicsAllocation *CommandQueue::getAuxTranslationAllocation(const KernelObjForAuxTranslation &kernelObj) const {
+    if (kernelObj.type == KernelObjForAuxTranslation::Type::MEM_OBJ) {
+        auto buffer = static_cast<Buffer *>(kernelObj.object);
+        return buffer->getGraphicsAllocation(device->getRootDeviceIndex());
+    }
+    DEBUG_BREAK_IF(kernelObj.type != KernelObjForAuxTranslation::Type::GFX_ALLOC);
+    return static_cast<GraphicsAllocation *>(kernelObj.object);
+}
+
+void CommandQueue::removeResolvedReadOnlyKernelObjs(KernelObjsForAuxTranslation &kernelObjsForAuxTranslation) const {
+    // nothing is compressed there before the kernel and nothing is written by it
+    for (auto kernelObj = kernelObjsForAuxTranslation.begin(); kernelObj != kernelObjsForAuxTranslation.end();) {
+        if (kernelObj->readOnly && isAuxResolveCompleted(*getAuxTranslationAllocation(*kernelObj))) {
+            kernelObj = kernelObjsForAuxTranslation.erase(kernelObj);
+        } else {
+            kernelObj++;
+        }
+    }
+}
+
+size_t CommandQueue::getSplitCopyBlitSize(size_t size, bool blitAllowed, cl_uint numEventsInWaitList, const cl_event *eventWaitList) {
+    auto blitterPercentage = DebugManager.flags.SplitCopyBufferBlitterPercentage.get();
+    if (blitterPercentage <= 0 || blitterPercentage >= 100 || !blitAllowed || isCopyOnly) {
+        return 0u;
+    }
+
+    auto minSize = DebugManager.flags.SplitCopyBufferMinSize.get() != -1 ? static_cast<size_t>(DebugManager.flags.SplitCopyBufferMinSize.get())
+                                                                           : minSizeForSplitCopy;
+    if (size < minSize) {
+        return 0u;
+    }
+
+    // both parts are ordered with timestamp packets, blocked enqueues would be unblocked separately
+    if (!getGpgpuCommandStreamReceiver().peekTimestampPacketWriteEnabled() || isQueueBlocked() ||
+        Event::checkUserEventDependencies(numEventsInWaitList, eventWaitList)) {
+        return 0u;
+    }
+
+    return alignDown(size / 100 * static_cast<size_t>(blitterPercentage), MemoryConstants::cacheLineSize);
+}
+
+size_t CommandQueue::getStagingWriteChunkSize(size_t size, cl_uint numEventsInWaitList, const cl_event *eventWaitList) {
+    if (DebugManager.flags.EnableStagingWriteBuffer.get() != 1) {
+        return 0u;
+    }
+
+    auto chunkSize = DebugManager.flags.StagingWriteBufferChunkSize.get() > 0 ? static_cast<size_t>(DebugManager.flags.StagingWriteBufferChunkSize.get())
+                                                                               : defaultStagingWriteChunkSize;
+    if (size <= chunkSize) {
+        return 0u;
+    }
+
+    // chunks are ordered only by the in-order queue and the event is attached to the last one
+    if (isOOQEnabled() || isProfilingEnabled() || isQueueBlocked() ||
+        Event::checkUserEventDependencies(numEventsInWaitList, eventWaitList)) {
+        return 0u;
+    }
+
+    return chunkSize;
+}
+
+GraphicsAllocation *CommandQueue::obtainStagingBuffer(size_t chunkSize) {
+    if (stagingBuffers.empty()) {
+        stagingBuffers.resize(stagingBuffersCount);
+    }
+
+    auto &stagingBuffer = stagingBuffers[nextStagingBuffer];
+    if (stagingBuffer.allocation && stagingBuffer.allocation->getUnderlyingBufferSize() < chunkSize) {
+        device->getMemoryManager()->checkGpuUsageAndDestroyGraphicsAllocations(stagingBuffer.allocation);
+        stagingBuffer.allocation = nullptr;
+    }
+
+    if (stagingBuffer.allocation == nullptr) {
+        stagingBuffer.allocation = device->getMemoryManager()->allocateGraphicsMemoryWithProperties({getDevice().getRootDeviceIndex(), chunkSize,
+                                                                                                     GraphicsAllocation::AllocationType::INTERNAL_HOST_MEMORY,
+                                                                                                     getDevice().getDeviceBitfield()});
+    } else if (!isCompleted(stagingBuffer.gpgpuTaskCount, stagingBuffer.bcsTaskCount)) {
+        waitUntilComplete(stagingBuffer.gpgpuTaskCount, stagingBuffer.bcsTaskCount, flushStamp->peekStamp(), false);
+    }
+
+    return stagingBuffer.allocation;
+}
+
+void CommandQueue::releaseStagingBuffer() {
+    auto &stagingBuffer = stagingBuffers[nextStagingBuffer];
+    stagingBuffer.gpgpuTaskCount = taskCount;
+    stagingBuffer.bcsTaskCount = bcsTaskCount;
+    nextStagingBuffer = (nextStagingBuffer + 1) % stagingBuffers.size();
+}
+
+bool CommandQueue::blitEnqueueImageAllowed(const size_t *origin, const size_t *region, const Image &image) {
     auto blitEnqueuImageAllowed = false;
 
     if (DebugManager.flags.EnableBlitterForReadWriteImage.get() != -1) {
         blitEnqueuImageAllowed = DebugManager.flags.EnableBlitterForReadWriteImage.get();
         blitEnqueuImageAllowed &= (origin[0] + region[0] <= BlitterConstants::maxBlitWidth) && (origin[1] + region[1] <= BlitterConstants::maxBlitHeight);
+
+        // mip levels are not addressable by the blitter and planar images can be copied only plane by plane
+        blitEnqueuImageAllowed &= !isMipMapped(image.getImageDesc());
+        blitEnqueuImageAllowed &= !IsNV12Image(&image.getImageFormat()) || image.isImageFromImage();
     }
 
     return blitEnqueuImageAllowed;
@@ -900,6 +1158,18 @@ void CommandQueue::aubCaptureHook(bool &blocking, bool &clearAllDependencies, co
     }
 }
 
+uint64_t CommandQueue::selectDynamicSliceCount(uint64_t threadGroupCount) {
+    auto requestedSliceCount = HwHelper::getSliceCountForThreadGroups(device->getHardwareInfo(), threadGroupCount);
+    // keep the slice configuration for a minimal number of submissions so it does not flip on every enqueue
+    if (dynamicSliceCount == QueueSliceCount::defaultSliceCount ||
+        (requestedSliceCount != dynamicSliceCount && submissionsWithDynamicSliceCount >= minSubmissionsPerDynamicSliceCount)) {
+        dynamicSliceCount = requestedSliceCount;
+        submissionsWithDynamicSliceCount = 0u;
+    }
+    submissionsWithDynamicSliceCount++;
+    return dynamicSliceCount;
+}
+
 void CommandQueue::waitUntilComplete(bool blockedQueue, PrintfHandler *printfHandler) {
     if (blockedQueue) {
         while (isQueueBlocked()) {
@@ -913,4 +1183,30 @@ void CommandQueue::waitUntilComplete(bool blockedQueue, PrintfHandler *printfHan
     }
 }
 
+bool CommandQueue::isPrintfOutputDeferrable() const {
+    return DebugManager.flags.EnableAsyncPrintfOutput.get();
+}
+
+void CommandQueue::deferPrintfOutput(std::unique_ptr<PrintfHandler> printfHandler) {
+    // the kernel owns the printf strings map, keep it alive until the output is printed
+    printfHandler->getKernel()->incRefInternal();
+    {
+        std::lock_guard<std::mutex> lock(deferredPrintfOutputsMtx);
+        deferredPrintfOutputs.emplace_back(taskCount, std::move(printfHandler));
+    }
+    printDeferredPrintfOutput(*getGpgpuCommandStreamReceiver().getTagAddress());
+}
+
+void CommandQueue::printDeferredPrintfOutput(uint32_t completedTaskCount) {
+    std::lock_guard<std::mutex> lock(deferredPrintfOutputsMtx);
+    auto printed = deferredPrintfOutputs.begin();
+    for (; printed != deferredPrintfOutputs.end() && printed->first <= completedTaskCount; printed++) {
+        printed->second->printEnqueueOutput();
+        auto kernel = printed->second->getKernel();
+        printed->second.reset();
+        kernel->decRefInternal();
+    }
+    deferredPrintfOutputs.erase(deferredPrintfOutputs.begin(), printed);
+}
+
 } // namespace NEO
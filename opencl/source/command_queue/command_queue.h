@@ -16,6 +16,8 @@
 
 #include <atomic>
 #include <cstdint>
+#include <mutex>
+#include <vector>
 
 namespace NEO {
 class BarrierCommand;
@@ -35,6 +37,7 @@ class PerformanceCounters;
 struct CompletionStamp;
 struct DispatchGlobalsArgs;
 struct MultiDispatchInfo;
+struct SvmAllocationData;
 
 enum class QueuePriority {
     LOW,
@@ -218,6 +221,10 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     MOCKABLE_VIRTUAL void waitUntilComplete(uint32_t gpgpuTaskCountToWait, uint32_t bcsTaskCountToWait, FlushStamp flushStampToWait, bool useQuickKmdSleep);
     void waitUntilComplete(bool blockedQueue, PrintfHandler *printfHandler);
 
+    bool isPrintfOutputDeferrable() const;
+    void deferPrintfOutput(std::unique_ptr<PrintfHandler> printfHandler);
+    void printDeferredPrintfOutput(uint32_t completedTaskCount);
+
     static uint32_t getTaskLevelFromWaitList(uint32_t taskLevel,
                                              cl_uint numEventsInWaitList,
                                              const cl_event *eventWaitList);
@@ -295,7 +302,7 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
                                          MemObj *memObj,
                                          MemObjSizeArray &copySize,
                                          MemObjOffsetArray &copyOffset,
-                                         bool readOnly,
+                                         bool skipTransfer,
                                          EventBuilder &externalEventBuilder);
 
     MOCKABLE_VIRTUAL bool setupDebugSurface(Kernel *kernel);
@@ -332,12 +339,15 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     size_t estimateTimestampPacketNodesCount(const MultiDispatchInfo &dispatchInfo) const;
 
     uint64_t getSliceCount() const { return sliceCount; }
+    uint64_t selectDynamicSliceCount(uint64_t threadGroupCount);
 
     uint64_t dispatchHints = 0;
 
   protected:
     void *enqueueReadMemObjForMap(TransferProperties &transferProperties, EventsRequest &eventsRequest, cl_int &errcodeRet);
     cl_int enqueueWriteMemObjForUnmap(MemObj *memObj, void *mappedPtr, EventsRequest &eventsRequest);
+    bool isCpuDetilingForMapAllowed(Image &image, const size_t *region, const EventsRequest &eventsRequest);
+    cl_int transferTiledImageDataOnCpu(Image &image, void *hostPtr, const size_t *origin, const size_t *region, bool toHostPtr, EventsRequest &eventsRequest);
 
     void *enqueueMapMemObject(TransferProperties &transferProperties, EventsRequest &eventsRequest, cl_int &errcodeRet);
     cl_int enqueueUnmapMemObject(TransferProperties &transferProperties, EventsRequest &eventsRequest);
@@ -346,20 +356,44 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     bool isBlockedCommandStreamRequired(uint32_t commandType, const EventsRequest &eventsRequest, bool blockedQueue) const;
 
     MOCKABLE_VIRTUAL void obtainNewTimestampPacketNodes(size_t numberOfNodes, TimestampPacketContainer &previousNodes, bool clearAllDependencies, bool blitEnqueue);
+    void obtainCrossEngineDependencies(TimestampPacketContainer &dependencies, bool clearPendingNodes);
     void storeProperties(const cl_queue_properties *properties);
     void processProperties(const cl_queue_properties *properties);
     void processPropertiesExtra(const cl_queue_properties *properties);
     void overrideEngine(aub_stream::EngineType engineType);
     bool bufferCpuCopyAllowed(Buffer *buffer, cl_command_type commandType, cl_bool blocking, size_t size, void *ptr,
                               cl_uint numEventsInWaitList, const cl_event *eventWaitList);
+    bool svmMemcpyCpuCopyAllowed(const SvmAllocationData *dstSvmData, const SvmAllocationData *srcSvmData, cl_bool blocking, size_t size,
+                                 cl_uint numEventsInWaitList, const cl_event *eventWaitList);
+    MOCKABLE_VIRTUAL cl_int enqueueSVMMemcpyOnCpu(void *dstPtr, const void *srcPtr, size_t size, cl_event *event);
     void providePerformanceHint(TransferProperties &transferProperties);
     bool queueDependenciesClearRequired() const;
     bool blitEnqueueAllowed(cl_command_type cmdType) const;
     bool blitEnqueuePreferred(cl_command_type cmdType, const BuiltinOpParams &builtinOpParams) const;
-    MOCKABLE_VIRTUAL bool blitEnqueueImageAllowed(const size_t *origin, const size_t *region);
+    bool isAuxResolveCompleted(const GraphicsAllocation &allocation) const;
+    GraphicsAllocation *getAuxTranslationAllocation(const KernelObjForAuxTranslation &kernelObj) const;
+    void removeResolvedReadOnlyKernelObjs(KernelObjsForAuxTranslation &kernelObjsForAuxTranslation) const;
+    size_t getSplitCopyBlitSize(size_t size, bool blitAllowed, cl_uint numEventsInWaitList, const cl_event *eventWaitList);
+    size_t getStagingWriteChunkSize(size_t size, cl_uint numEventsInWaitList, const cl_event *eventWaitList);
+    GraphicsAllocation *obtainStagingBuffer(size_t chunkSize);
+    void releaseStagingBuffer();
+    MOCKABLE_VIRTUAL bool blitEnqueueImageAllowed(const size_t *origin, const size_t *region, const Image &image);
     void aubCaptureHook(bool &blocking, bool &clearAllDependencies, const MultiDispatchInfo &multiDispatchInfo);
     virtual bool obtainTimestampPacketForCacheFlush(bool isCacheFlushRequired) const = 0;
 
+    static constexpr size_t minSizeForSplitCopy = static_cast<size_t>(64 * MemoryConstants::megaByte);
+    static constexpr size_t minSizeForBlitFill = static_cast<size_t>(64 * MemoryConstants::megaByte);
+    static constexpr size_t defaultStagingWriteChunkSize = static_cast<size_t>(2 * MemoryConstants::megaByte);
+    static constexpr size_t stagingBuffersCount = 3u;
+
+    struct StagingBuffer {
+        GraphicsAllocation *allocation = nullptr;
+        uint32_t gpgpuTaskCount = 0;
+        uint32_t bcsTaskCount = 0;
+    };
+    std::vector<StagingBuffer> stagingBuffers;
+    size_t nextStagingBuffer = 0u;
+
     Context *context = nullptr;
     ClDevice *device = nullptr;
     EngineControl *gpgpuEngine = nullptr;
@@ -377,6 +411,9 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     QueueThrottle throttle = QueueThrottle::MEDIUM;
     EnqueueProperties::Operation latestSentEnqueueType = EnqueueProperties::Operation::None;
     uint64_t sliceCount = QueueSliceCount::defaultSliceCount;
+    static constexpr uint32_t minSubmissionsPerDynamicSliceCount = 8u;
+    uint64_t dynamicSliceCount = QueueSliceCount::defaultSliceCount;
+    uint32_t submissionsWithDynamicSliceCount = 0u;
     uint32_t bcsTaskCount = 0;
 
     bool perfCountersEnabled = false;
@@ -388,7 +425,13 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     bool isSpecialCommandQueue = false;
     bool requiresCacheFlushAfterWalker = false;
 
+    // printf outputs of non-blocking enqueues with the task count they complete at, printed in enqueue order
+    std::vector<std::pair<uint32_t, std::unique_ptr<PrintfHandler>>> deferredPrintfOutputs;
+    std::mutex deferredPrintfOutputsMtx;
+
     std::unique_ptr<TimestampPacketContainer> timestampPacketContainer;
+    // out of order queue only: last nodes of each run of enqueues on an engine, waited for by barriers and markers
+    std::unique_ptr<TimestampPacketContainer> crossEngineTimestampPacketNodes;
 };
 
 using CommandQueueCreateFunc = CommandQueue *(*)(Context *context, ClDevice *device, const cl_queue_properties *properties, bool internalUsage);
@@ -47,6 +47,10 @@ class CommandQueueHw : public CommandQueue {
             priority = QueuePriority::MEDIUM;
         } else if (clPriority & static_cast<cl_queue_priority_khr>(CL_QUEUE_PRIORITY_HIGH_KHR)) {
             priority = QueuePriority::HIGH;
+            auto highPriorityEngine = device->getDeviceById(0)->tryGetEngine(getChosenEngineType(device->getHardwareInfo()), EngineUsage::HighPriority);
+            if (highPriorityEngine) {
+                this->gpgpuEngine = highPriorityEngine;
+            }
         }
 
         auto clThrottle = getCmdQueueProperties<cl_queue_throttle_khr>(properties, CL_QUEUE_THROTTLE_KHR);
@@ -354,6 +358,13 @@ class CommandQueueHw : public CommandQueue {
     template <uint32_t cmdType>
     void enqueueBlit(const MultiDispatchInfo &multiDispatchInfo, cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event, bool blocking);
 
+    template <size_t surfaceCount>
+    void enqueueSplitCopyBuffer(const BuiltinOpParams &builtinOpParams, size_t blitSize, Surface *(&surfaces)[surfaceCount],
+                                EBuiltInOps::Type builtInOperation, cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event);
+
+    cl_int enqueueStagingWriteBuffer(Buffer *buffer, cl_bool blockingWrite, size_t offset, size_t size, const void *ptr, size_t chunkSize,
+                                     EBuiltInOps::Type builtInOperation, bool blitAllowed, cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event);
+
     template <uint32_t commandType>
     CompletionStamp enqueueNonBlocked(Surface **surfacesForResidency,
                                       size_t surfaceCount,
@@ -435,7 +446,11 @@ class CommandQueueHw : public CommandQueue {
         bool profilingRequired = (this->isProfilingEnabled() && eventsRequest.outEvent);
         bool perfCountersRequired = (this->isPerfCountersEnabled() && eventsRequest.outEvent);
 
-        if (isBlockedCommandStreamRequired(commandType, eventsRequest, blockedQueue)) {
+        // cross-engine dependencies of a blocked barrier or marker are programmed into its own command stream
+        bool blockedCrossEngineDependencies = blockedQueue && (CL_COMMAND_BARRIER == commandType || CL_COMMAND_MARKER == commandType) &&
+                                              !csrDependencies.empty();
+
+        if (isBlockedCommandStreamRequired(commandType, eventsRequest, blockedQueue) || blockedCrossEngineDependencies) {
             constexpr size_t additionalAllocationSize = CSRequirements::csOverfetchSize;
             constexpr size_t allocationSize = MemoryConstants::pageSize64k - CSRequirements::csOverfetchSize;
             commandStream = new LinearStream();
@@ -172,7 +172,7 @@ bool CommandQueueHw<Family>::isGpgpuSubmissionForBcsRequired(bool queueBlocked)
 template <typename Family>
 void CommandQueueHw<Family>::setupEvent(EventBuilder &eventBuilder, cl_event *outEvent, uint32_t cmdType) {
     if (outEvent) {
-        eventBuilder.create<Event>(this, cmdType, CompletionStamp::notReady, 0);
+        eventBuilder.createRecyclable(this, cmdType, CompletionStamp::notReady, 0);
         auto eventObj = eventBuilder.getEvent();
         *outEvent = eventObj;
 
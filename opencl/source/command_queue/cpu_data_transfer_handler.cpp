@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,8 @@
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/device/device.h"
 #include "shared/source/helpers/get_info.h"
+#include "shared/source/utilities/cpu_copy.h"
+#include "shared/source/utilities/cpuintrinsics.h"
 
 #include "opencl/source/command_queue/command_queue.h"
 #include "opencl/source/context/context.h"
@@ -25,10 +27,18 @@ void *CommandQueue::cpuDataTransferHandler(TransferProperties &transferPropertie
     EventBuilder eventBuilder;
     bool eventCompleted = false;
     bool mapOperation = transferProperties.cmdType == CL_COMMAND_MAP_BUFFER || transferProperties.cmdType == CL_COMMAND_MAP_IMAGE;
+    bool invalidateRegion = mapOperation && transferProperties.mapFlags == CL_MAP_WRITE_INVALIDATE_REGION;
     ErrorCodeHelper err(&retVal, CL_SUCCESS);
+    // local memory buffer mapped through its locked CPU mapping, no staging copies are needed
+    void *directMappingPtr = nullptr;
+    if (mapOperation || transferProperties.cmdType == CL_COMMAND_UNMAP_MEM_OBJECT) {
+        directMappingPtr = transferProperties.memObj->lockForDirectMapping(getDevice().getRootDeviceIndex());
+    }
 
     if (mapOperation) {
-        returnPtr = ptrOffset(transferProperties.memObj->getCpuAddressForMapping(),
+        auto mappingBasePtr = directMappingPtr ? ptrOffset(directMappingPtr, transferProperties.memObj->getOffset())
+                                               : transferProperties.memObj->getCpuAddressForMapping();
+        returnPtr = ptrOffset(mappingBasePtr,
                               transferProperties.memObj->calculateOffsetForMapping(transferProperties.offset) + transferProperties.mipPtrOffset);
 
         if (!transferProperties.memObj->addMappedPtr(returnPtr, transferProperties.memObj->calculateMappedPtrLength(transferProperties.size),
@@ -42,10 +52,16 @@ void *CommandQueue::cpuDataTransferHandler(TransferProperties &transferPropertie
             return nullptr;
         }
         transferProperties.memObj->removeMappedPtr(unmapInfo.ptr);
+        if (directMappingPtr && !unmapInfo.readOnly) {
+            // drain write combining buffers of this thread and drop stale GPU cache lines before the next GPU access,
+            // on every engine of the device as the next kernel may run on another queue
+            CpuIntrinsics::sfence();
+            getDevice().getMemoryManager()->registerFullCacheFlushOnAllEngines(getDevice().getRootDeviceIndex());
+        }
     }
 
     if (eventsRequest.outEvent) {
-        eventBuilder.create<Event>(this, transferProperties.cmdType, CompletionStamp::notReady, CompletionStamp::notReady);
+        eventBuilder.createRecyclable(this, transferProperties.cmdType, CompletionStamp::notReady, CompletionStamp::notReady);
         outEventObj = eventBuilder.getEvent();
         outEventObj->setQueueTimeStamp();
         outEventObj->setCPUProfilingPath(true);
@@ -76,7 +92,7 @@ void *CommandQueue::cpuDataTransferHandler(TransferProperties &transferPropertie
                                         transferProperties.memObj,
                                         mapOperation ? transferProperties.size : unmapInfo.size,
                                         mapOperation ? transferProperties.offset : unmapInfo.offset,
-                                        mapOperation ? transferProperties.mapFlags == CL_MAP_READ : unmapInfo.readOnly,
+                                        mapOperation ? invalidateRegion : unmapInfo.readOnly,
                                         eventBuilder);
     }
 
@@ -97,6 +113,13 @@ void *CommandQueue::cpuDataTransferHandler(TransferProperties &transferPropertie
                 finish();
                 eventCompleted = true;
             }
+            if (directMappingPtr && !invalidateRegion) {
+                // GPU writes may still sit in GPU caches, flush them before the host reads the memory
+                auto &csr = getGpgpuCommandStreamReceiver();
+                csr.flushTagUpdate();
+                auto flushStampToWait = csr.obtainCurrentFlushStamp();
+                csr.waitForFlushStamp(flushStampToWait);
+            }
         }
 
         if (outEventObj) {
@@ -106,20 +129,20 @@ void *CommandQueue::cpuDataTransferHandler(TransferProperties &transferPropertie
         UNRECOVERABLE_IF((transferProperties.memObj->isMemObjZeroCopy() == false) && isMipMapped(transferProperties.memObj));
         switch (transferProperties.cmdType) {
         case CL_COMMAND_MAP_BUFFER:
-            if (!transferProperties.memObj->isMemObjZeroCopy()) {
+            if (!transferProperties.memObj->isMemObjZeroCopy() && !directMappingPtr && !invalidateRegion) {
                 transferProperties.memObj->transferDataToHostPtr(transferProperties.size, transferProperties.offset);
                 eventCompleted = true;
             }
             break;
         case CL_COMMAND_MAP_IMAGE:
-            if (!transferProperties.memObj->isMemObjZeroCopy()) {
+            if (!transferProperties.memObj->isMemObjZeroCopy() && !invalidateRegion) {
                 transferProperties.memObj->transferDataToHostPtr(transferProperties.size, transferProperties.offset);
                 eventCompleted = true;
             }
             break;
         case CL_COMMAND_UNMAP_MEM_OBJECT:
             if (!transferProperties.memObj->isMemObjZeroCopy()) {
-                if (!unmapInfo.readOnly) {
+                if (!unmapInfo.readOnly && !directMappingPtr) {
                     transferProperties.memObj->transferDataFromHostPtr(unmapInfo.size, unmapInfo.offset);
                 }
                 eventCompleted = true;
@@ -129,11 +152,11 @@ void *CommandQueue::cpuDataTransferHandler(TransferProperties &transferPropertie
             }
             break;
         case CL_COMMAND_READ_BUFFER:
-            memcpy_s(transferProperties.ptr, transferProperties.size[0], transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0]);
+            CpuCopy::copy(transferProperties.ptr, transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0]);
             eventCompleted = true;
             break;
         case CL_COMMAND_WRITE_BUFFER:
-            memcpy_s(transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0], transferProperties.ptr, transferProperties.size[0]);
+            CpuCopy::copy(transferProperties.getCpuPtrForReadWrite(), transferProperties.ptr, transferProperties.size[0]);
             eventCompleted = true;
             modifySimulationFlags = true;
             break;
@@ -167,6 +190,36 @@ void *CommandQueue::cpuDataTransferHandler(TransferProperties &transferPropertie
     return returnPtr; // only map returns pointer
 }
 
+cl_int CommandQueue::enqueueSVMMemcpyOnCpu(void *dstPtr, const void *srcPtr, size_t size, cl_event *event) {
+    Event *outEventObj = nullptr;
+    EventBuilder eventBuilder;
+    if (event) {
+        eventBuilder.createRecyclable(this, CL_COMMAND_SVM_MEMCPY, CompletionStamp::notReady, CompletionStamp::notReady);
+        outEventObj = eventBuilder.getEvent();
+        outEventObj->setQueueTimeStamp();
+        outEventObj->setCPUProfilingPath(true);
+        *event = outEventObj;
+        outEventObj->setSubmitTimeStamp();
+    }
+
+    // in order semantics, previously enqueued work may still use the memory
+    auto retVal = finish();
+
+    if (outEventObj) {
+        outEventObj->setStartTimeStamp();
+    }
+
+    CpuCopy::copy(dstPtr, srcPtr, size);
+
+    if (outEventObj) {
+        outEventObj->setEndTimeStamp();
+        outEventObj->updateTaskCount(this->taskCount, this->bcsTaskCount);
+        outEventObj->flushStamp->replaceStampObject(this->flushStamp->getStampReference());
+        outEventObj->setStatus(CL_COMPLETE);
+    }
+    return retVal;
+}
+
 void CommandQueue::providePerformanceHint(TransferProperties &transferProperties) {
     switch (transferProperties.cmdType) {
     case CL_COMMAND_MAP_BUFFER:
@@ -10,11 +10,13 @@
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/helpers/array_count.h"
 #include "shared/source/helpers/engine_node_helper.h"
+#include "shared/source/helpers/hw_helper.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/surface.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/program/sync_buffer_handler.h"
+#include "shared/source/utilities/launch_overhead_profiler.h"
 #include "shared/source/utilities/range.h"
 #include "shared/source/utilities/tag_allocator.h"
 
@@ -76,6 +78,13 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface *(&surfaces)[surfaceCount
             if (!kernelObjsForAuxTranslation.empty()) {
                 auxTranslationMode = HwHelperHw<GfxFamily>::get().getAuxTranslationMode(device->getHardwareInfo());
             }
+
+            if (AuxTranslationMode::Blit == auxTranslationMode) {
+                removeResolvedReadOnlyKernelObjs(kernelObjsForAuxTranslation);
+                if (kernelObjsForAuxTranslation.empty()) {
+                    auxTranslationMode = AuxTranslationMode::None;
+                }
+            }
         }
 
         if (AuxTranslationMode::Builtin == auxTranslationMode) {
@@ -159,6 +168,9 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
         return;
     }
 
+    auto mainKernel = multiDispatchInfo.peekMainKernel();
+    ScopedKernelLaunch kernelLaunch(mainKernel ? mainKernel->getKernelInfo(device->getRootDeviceIndex()).kernelDescriptor.kernelMetadata.kernelName.c_str() : nullptr);
+
     StackVec<cl_event, 8> waitListCurrentRootDeviceIndex;
     bool isEventWaitListFromPreviousRootDevice = false;
 
@@ -231,6 +243,15 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
         }
     }
 
+    auto &crossEngineNodes = timestampPacketDependencies.crossEngineNodes;
+    if ((CL_COMMAND_BARRIER == commandType || CL_COMMAND_MARKER == commandType) && numEventsInWaitList == 0 &&
+        getGpgpuCommandStreamReceiver().peekTimestampPacketWriteEnabled()) {
+        obtainCrossEngineDependencies(crossEngineNodes, CL_COMMAND_BARRIER == commandType);
+        if (crossEngineNodes.peekNodes().size() > 0) {
+            csrDeps.push_back(&crossEngineNodes);
+        }
+    }
+
     auto &commandStream = *obtainCommandStream<commandType>(csrDeps, false, blockQueue, multiDispatchInfo, eventsRequest,
                                                             blockedCommandsData, surfacesForResidency, numSurfaceForResidency);
     auto commandStreamStart = commandStream.getUsed();
@@ -240,6 +261,23 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
                                              eventsRequest, blockQueue);
     }
 
+    if (context->getResolvesRequiredInKernels()) {
+        for (auto &dispatchInfo : multiDispatchInfo) {
+            if (dispatchInfo.getKernel()) {
+                dispatchInfo.getKernel()->resetAuxResolvedStateOfArgs(device->getRootDeviceIndex());
+            }
+        }
+    }
+
+    if (DebugManager.flags.AdaptiveBufferCompression.get() != 0 &&
+        HwHelper::renderCompressedBuffersSupported(device->getHardwareInfo())) {
+        for (auto &dispatchInfo : multiDispatchInfo) {
+            if (dispatchInfo.getKernel()) {
+                dispatchInfo.getKernel()->updateCompressionUsageOfArgs(device->getRootDeviceIndex());
+            }
+        }
+    }
+
     if (eventBuilder.getEvent() && getGpgpuCommandStreamReceiver().peekTimestampPacketWriteEnabled()) {
         eventBuilder.getEvent()->addTimestampPacketNodes(*timestampPacketContainer);
         eventBuilder.getEvent()->addTimestampPacketNodes(timestampPacketDependencies.nonAuxToAuxNodes);
@@ -268,6 +306,12 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
                 }
             }
         }
+        if (crossEngineNodes.peekNodes().size() > 0) {
+            flushDependenciesForNonKernelCommand = true;
+            if (eventBuilder.getEvent()) {
+                eventBuilder.getEvent()->addTimestampPacketNodes(crossEngineNodes);
+            }
+        }
         if (flushDependenciesForNonKernelCommand) {
             TimestampPacketHelper::programCsrDependencies<GfxFamily>(commandStream, csrDeps, getGpgpuCommandStreamReceiver().getOsContext().getNumSupportedDevices());
         }
@@ -377,6 +421,8 @@ void CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
 
     if (blocking) {
         waitUntilComplete(blockQueue, printfHandler.get());
+    } else if (printfHandler) {
+        deferPrintfOutput(std::move(printfHandler));
     }
 }
 
@@ -433,16 +479,19 @@ void CommandQueueHw<GfxFamily>::processDispatchForKernels(const MultiDispatchInf
         hwPerfCounter = event->getHwPerfCounterNode();
     }
 
-    HardwareInterface<GfxFamily>::dispatchWalker(
-        *this,
-        multiDispatchInfo,
-        csrDeps,
-        blockedCommandsData,
-        hwTimeStamps,
-        hwPerfCounter,
-        &timestampPacketDependencies,
-        timestampPacketContainer.get(),
-        commandType);
+    {
+        ScopedLaunchPhase launchPhase(LaunchOverheadProfiler::Phase::encoding);
+        HardwareInterface<GfxFamily>::dispatchWalker(
+            *this,
+            multiDispatchInfo,
+            csrDeps,
+            blockedCommandsData,
+            hwTimeStamps,
+            hwPerfCounter,
+            &timestampPacketDependencies,
+            timestampPacketContainer.get(),
+            commandType);
+    }
 
     if (DebugManager.flags.AddPatchInfoCommentsForAUBDump.get()) {
         for (auto &dispatchInfo : multiDispatchInfo) {
@@ -475,7 +524,7 @@ BlitProperties CommandQueueHw<GfxFamily>::processDispatchForBlitEnqueue(const Mu
         blitProperties.csrDependencies.push_back(&timestampPacketDependencies.barrierNodes);
     }
 
-    auto currentTimestampPacketNode = timestampPacketContainer->peekNodes().at(0);
+    auto currentTimestampPacketNode = timestampPacketContainer->peekNodes()[0];
     blitProperties.outputTimestampPacket = currentTimestampPacketNode;
 
     if (commandStream) {
@@ -502,37 +551,26 @@ void CommandQueueHw<GfxFamily>::processDispatchForBlitAuxTranslation(const Multi
                                                                      BlitPropertiesContainer &blitPropertiesContainer,
                                                                      TimestampPacketDependencies &timestampPacketDependencies,
                                                                      const EventsRequest &eventsRequest, bool queueBlocked) {
-    auto rootDeviceIndex = getDevice().getRootDeviceIndex();
     auto nodesAllocator = getGpgpuCommandStreamReceiver().getTimestampPacketAllocator();
-    auto numKernelObjs = multiDispatchInfo.getKernelObjsForAuxTranslation()->size();
-    blitPropertiesContainer.resize(numKernelObjs * 2);
+    auto clearColorAllocation = getGpgpuCommandStreamReceiver().getClearColorAllocation();
 
-    auto bufferIndex = 0;
+    // all AuxToNonAux translations go first, followed by all NonAuxToAux ones
     for (auto &kernelObj : *multiDispatchInfo.getKernelObjsForAuxTranslation()) {
-        GraphicsAllocation *allocation = nullptr;
-        if (kernelObj.type == KernelObjForAuxTranslation::Type::MEM_OBJ) {
-            auto buffer = static_cast<Buffer *>(kernelObj.object);
-            allocation = buffer->getGraphicsAllocation(rootDeviceIndex);
-        } else {
-            DEBUG_BREAK_IF(kernelObj.type != KernelObjForAuxTranslation::Type::GFX_ALLOC);
-            allocation = static_cast<GraphicsAllocation *>(kernelObj.object);
-        }
-        {
-            // Aux to NonAux
-            blitPropertiesContainer[bufferIndex] = BlitProperties::constructPropertiesForAuxTranslation(
-                AuxTranslationDirection::AuxToNonAux, allocation, getGpgpuCommandStreamReceiver().getClearColorAllocation());
-            auto auxToNonAuxNode = nodesAllocator->getTag();
-            timestampPacketDependencies.auxToNonAuxNodes.add(auxToNonAuxNode);
+        auto allocation = getAuxTranslationAllocation(kernelObj);
+        if (kernelObj.readOnly || !isAuxResolveCompleted(*allocation)) {
+            blitPropertiesContainer.push_back(BlitProperties::constructPropertiesForAuxTranslation(
+                AuxTranslationDirection::AuxToNonAux, allocation, clearColorAllocation));
+            timestampPacketDependencies.auxToNonAuxNodes.add(nodesAllocator->getTag());
         }
+    }
 
-        {
-            // NonAux to Aux
-            blitPropertiesContainer[bufferIndex + numKernelObjs] = BlitProperties::constructPropertiesForAuxTranslation(
-                AuxTranslationDirection::NonAuxToAux, allocation, getGpgpuCommandStreamReceiver().getClearColorAllocation());
-            auto nonAuxToAuxNode = nodesAllocator->getTag();
-            timestampPacketDependencies.nonAuxToAuxNodes.add(nonAuxToAuxNode);
+    for (auto &kernelObj : *multiDispatchInfo.getKernelObjsForAuxTranslation()) {
+        // read only objects are left resolved, the next enqueue using them skips the translation
+        if (!kernelObj.readOnly || DebugManager.flags.SkipResolvedAuxTranslation.get() == 0) {
+            blitPropertiesContainer.push_back(BlitProperties::constructPropertiesForAuxTranslation(
+                AuxTranslationDirection::NonAuxToAux, getAuxTranslationAllocation(kernelObj), clearColorAllocation));
+            timestampPacketDependencies.nonAuxToAuxNodes.add(nodesAllocator->getTag());
         }
-        bufferIndex++;
     }
 
     if (!queueBlocked) {
@@ -554,7 +592,7 @@ void CommandQueueHw<GfxFamily>::processDispatchForCacheFlush(Surface **surfaces,
 
     uint64_t postSyncAddress = 0;
     if (getGpgpuCommandStreamReceiver().peekTimestampPacketWriteEnabled()) {
-        auto timestampPacketNodeForPostSync = timestampPacketContainer->peekNodes().at(0);
+        auto timestampPacketNodeForPostSync = timestampPacketContainer->peekNodes()[0];
         timestampPacketNodeForPostSync->setProfilingCapable(false);
         postSyncAddress = TimestampPacketHelper::getContextEndGpuAddress(*timestampPacketNodeForPostSync);
     }
@@ -679,7 +717,9 @@ CompletionStamp CommandQueueHw<GfxFamily>::enqueueNonBlocked(
     auto implicitFlush = false;
 
     if (printfHandler) {
-        blocking = true;
+        if (!isPrintfOutputDeferrable()) {
+            blocking = true;
+        }
         printfHandler->makeResident(getGpgpuCommandStreamReceiver());
     }
 
@@ -781,6 +821,16 @@ CompletionStamp CommandQueueHw<GfxFamily>::enqueueNonBlocked(
 
     auto memoryCompressionState = getGpgpuCommandStreamReceiver().getMemoryCompressionState(auxTranslationRequired);
 
+    auto sliceCount = getSliceCount();
+    if (sliceCount == QueueSliceCount::defaultSliceCount && DebugManager.flags.EnableDynamicQueueSliceCount.get() == 1) {
+        uint64_t threadGroupCount = 0u;
+        for (auto &dispatchInfo : multiDispatchInfo) {
+            auto &numberOfWorkgroups = dispatchInfo.getNumberOfWorkgroups();
+            threadGroupCount += numberOfWorkgroups.x * numberOfWorkgroups.y * numberOfWorkgroups.z;
+        }
+        sliceCount = selectDynamicSliceCount(threadGroupCount);
+    }
+
     DispatchFlags dispatchFlags(
         {},                                                                                         //csrDependencies
         &timestampPacketDependencies.barrierNodes,                                                  //barrierTimestampPacketNodes
@@ -794,7 +844,7 @@ CompletionStamp CommandQueueHw<GfxFamily>::enqueueNonBlocked(
         kernel->getAdditionalKernelExecInfo(),                                                      //additionalKernelExecInfo
         kernel->getExecutionType(),                                                                 //kernelExecutionType
         memoryCompressionState,                                                                     //memoryCompressionState
-        getSliceCount(),                                                                            //sliceCount
+        sliceCount,                                                                                 //sliceCount
         blocking,                                                                                   //blocking
         shouldFlushDC(commandType, printfHandler) || allocNeedsFlushDC,                             //dcFlush
         multiDispatchInfo.usesSlm() || multiDispatchInfo.peekParentKernel(),                        //useSLM
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,8 +32,14 @@ cl_int CommandQueueHw<GfxFamily>::enqueueCopyBuffer(
 
     auto rootDeviceIndex = getDevice().getRootDeviceIndex();
 
-    srcBuffer->getMigrateableMultiGraphicsAllocation().ensureMemoryOnDevice(*getDevice().getMemoryManager(), rootDeviceIndex);
-    dstBuffer->getMigrateableMultiGraphicsAllocation().ensureMemoryOnDevice(*getDevice().getMemoryManager(), rootDeviceIndex);
+    cl_int retVal = srcBuffer->ensureMemoryOnDevice(*getDevice().getMemoryManager(), rootDeviceIndex);
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
+    retVal = dstBuffer->ensureMemoryOnDevice(*getDevice().getMemoryManager(), rootDeviceIndex);
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
 
     auto eBuiltInOpsType = EBuiltInOps::CopyBufferToBuffer;
 
@@ -48,14 +54,51 @@ cl_int CommandQueueHw<GfxFamily>::enqueueCopyBuffer(
     dc.dstOffset = {dstOffset, 0, 0};
     dc.size = {size, 0, 0};
 
-    MultiDispatchInfo dispatchInfo(dc);
-
     MemObjSurface s1(srcBuffer);
     MemObjSurface s2(dstBuffer);
     Surface *surfaces[] = {&s1, &s2};
     auto blitAllowed = blitEnqueueAllowed(CL_COMMAND_COPY_BUFFER);
+
+    auto blitSize = getSplitCopyBlitSize(size, blitAllowed, numEventsInWaitList, eventWaitList);
+    if (blitSize > 0) {
+        enqueueSplitCopyBuffer(dc, blitSize, surfaces, eBuiltInOpsType, numEventsInWaitList, eventWaitList, event);
+        return CL_SUCCESS;
+    }
+
+    MultiDispatchInfo dispatchInfo(dc);
     dispatchBcsOrGpgpuEnqueue<CL_COMMAND_COPY_BUFFER>(dispatchInfo, surfaces, eBuiltInOpsType, numEventsInWaitList, eventWaitList, event, false, blitAllowed);
 
     return CL_SUCCESS;
 }
+
+template <typename GfxFamily>
+template <size_t surfaceCount>
+void CommandQueueHw<GfxFamily>::enqueueSplitCopyBuffer(const BuiltinOpParams &builtinOpParams, size_t blitSize, Surface *(&surfaces)[surfaceCount],
+                                                       EBuiltInOps::Type builtInOperation, cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event) {
+    TimestampPacketContainer previousNodes;
+    previousNodes.assignAndIncrementNodesRefCounts(*timestampPacketContainer);
+
+    BuiltinOpParams blitParams = builtinOpParams;
+    blitParams.size.x = blitSize;
+    MultiDispatchInfo blitDispatchInfo(blitParams);
+    enqueueBlit<CL_COMMAND_COPY_BUFFER>(blitDispatchInfo, numEventsInWaitList, eventWaitList, nullptr, false);
+
+    // the compute part waits for the same work as the blit part, so both engines copy concurrently
+    TimestampPacketContainer blitNodes;
+    blitNodes.swapNodes(*timestampPacketContainer);
+    timestampPacketContainer->swapNodes(previousNodes);
+
+    BuiltinOpParams kernelParams = builtinOpParams;
+    kernelParams.srcOffset.x += blitSize;
+    kernelParams.dstOffset.x += blitSize;
+    kernelParams.size.x -= blitSize;
+    MultiDispatchInfo kernelDispatchInfo(kernelParams);
+    dispatchBcsOrGpgpuEnqueue<CL_COMMAND_COPY_BUFFER>(kernelDispatchInfo, surfaces, builtInOperation, numEventsInWaitList, eventWaitList, event, false, false);
+
+    // later enqueues and the out event complete only after both parts
+    timestampPacketContainer->assignAndIncrementNodesRefCounts(blitNodes);
+    if (event) {
+        castToObjectOrAbort<Event>(*event)->addTimestampPacketNodes(blitNodes);
+    }
+}
 } // namespace NEO
@@ -35,8 +35,14 @@ cl_int CommandQueueHw<GfxFamily>::enqueueCopyBufferRect(
 
     auto rootDeviceIndex = getDevice().getRootDeviceIndex();
 
-    srcBuffer->getMigrateableMultiGraphicsAllocation().ensureMemoryOnDevice(*getDevice().getMemoryManager(), rootDeviceIndex);
-    dstBuffer->getMigrateableMultiGraphicsAllocation().ensureMemoryOnDevice(*getDevice().getMemoryManager(), rootDeviceIndex);
+    cl_int retVal = srcBuffer->ensureMemoryOnDevice(*getDevice().getMemoryManager(), rootDeviceIndex);
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
+    retVal = dstBuffer->ensureMemoryOnDevice(*getDevice().getMemoryManager(), rootDeviceIndex);
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
 
     auto eBuiltInOps = EBuiltInOps::CopyBufferRect;
     if (forceStateless(std::max(srcBuffer->getSize(), dstBuffer->getSize()))) {
@@ -33,17 +33,22 @@ cl_int CommandQueueHw<GfxFamily>::enqueueCopyBufferToImage(
 
     auto rootDeviceIndex = getDevice().getRootDeviceIndex();
 
-    srcBuffer->getMigrateableMultiGraphicsAllocation().ensureMemoryOnDevice(*getDevice().getMemoryManager(), rootDeviceIndex);
-    dstImage->getMigrateableMultiGraphicsAllocation().ensureMemoryOnDevice(*getDevice().getMemoryManager(), rootDeviceIndex);
+    cl_int retVal = srcBuffer->ensureMemoryOnDevice(*getDevice().getMemoryManager(), rootDeviceIndex);
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
+    retVal = dstImage->ensureMemoryOnDevice(*getDevice().getMemoryManager(), rootDeviceIndex);
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
 
     auto eBuiltInOpsType = EBuiltInOps::CopyBufferToImage3d;
     if (forceStateless(srcBuffer->getSize())) {
         eBuiltInOpsType = EBuiltInOps::CopyBufferToImage3dStateless;
     }
 
-    auto &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(eBuiltInOpsType,
-                                                                            this->getClDevice());
-    BuiltInOwnershipWrapper builtInLock(builder);
+    cl_command_type cmdType = CL_COMMAND_COPY_BUFFER_TO_IMAGE;
+    auto blitAllowed = blitEnqueueAllowed(cmdType) && blitEnqueueImageAllowed(dstOrigin, region, *dstImage);
 
     MemObjSurface srcBufferSurf(srcBuffer);
     MemObjSurface dstImgSurf(dstImage);
@@ -60,15 +65,8 @@ cl_int CommandQueueHw<GfxFamily>::enqueueCopyBufferToImage(
     }
 
     MultiDispatchInfo dispatchInfo(dc);
-    builder.buildDispatchInfos(dispatchInfo);
 
-    enqueueHandler<CL_COMMAND_COPY_BUFFER_TO_IMAGE>(
-        surfaces,
-        false,
-        dispatchInfo,
-        numEventsInWaitList,
-        eventWaitList,
-        event);
+    dispatchBcsOrGpgpuEnqueue<CL_COMMAND_COPY_BUFFER_TO_IMAGE>(dispatchInfo, surfaces, eBuiltInOpsType, numEventsInWaitList, eventWaitList, event, false, blitAllowed);
 
     return CL_SUCCESS;
 }
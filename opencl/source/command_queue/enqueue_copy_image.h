@@ -34,12 +34,18 @@ cl_int CommandQueueHw<GfxFamily>::enqueueCopyImage(
 
     auto rootDeviceIndex = getDevice().getRootDeviceIndex();
 
-    srcImage->getMigrateableMultiGraphicsAllocation().ensureMemoryOnDevice(*getDevice().getMemoryManager(), rootDeviceIndex);
-    dstImage->getMigrateableMultiGraphicsAllocation().ensureMemoryOnDevice(*getDevice().getMemoryManager(), rootDeviceIndex);
+    cl_int retVal = srcImage->ensureMemoryOnDevice(*getDevice().getMemoryManager(), rootDeviceIndex);
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
+    retVal = dstImage->ensureMemoryOnDevice(*getDevice().getMemoryManager(), rootDeviceIndex);
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
 
-    auto &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyImageToImage3d,
-                                                                            this->getClDevice());
-    BuiltInOwnershipWrapper builtInLock(builder);
+    cl_command_type cmdType = CL_COMMAND_COPY_IMAGE;
+    auto blitAllowed = blitEnqueueAllowed(cmdType) && blitEnqueueImageAllowed(srcOrigin, region, *srcImage) &&
+                       blitEnqueueImageAllowed(dstOrigin, region, *dstImage);
 
     MemObjSurface srcImgSurf(srcImage);
     MemObjSurface dstImgSurf(dstImage);
@@ -60,15 +66,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueCopyImage(
 
     MultiDispatchInfo di(dc);
 
-    builder.buildDispatchInfos(di);
-
-    enqueueHandler<CL_COMMAND_COPY_IMAGE>(
-        surfaces,
-        false,
-        di,
-        numEventsInWaitList,
-        eventWaitList,
-        event);
+    dispatchBcsOrGpgpuEnqueue<CL_COMMAND_COPY_IMAGE>(di, surfaces, EBuiltInOps::CopyImageToImage3d, numEventsInWaitList, eventWaitList, event, false, blitAllowed);
 
     return CL_SUCCESS;
 }
@@ -33,16 +33,21 @@ cl_int CommandQueueHw<GfxFamily>::enqueueCopyImageToBuffer(
 
     auto rootDeviceIndex = getDevice().getRootDeviceIndex();
 
-    srcImage->getMigrateableMultiGraphicsAllocation().ensureMemoryOnDevice(*getDevice().getMemoryManager(), rootDeviceIndex);
-    dstBuffer->getMigrateableMultiGraphicsAllocation().ensureMemoryOnDevice(*getDevice().getMemoryManager(), rootDeviceIndex);
+    cl_int retVal = srcImage->ensureMemoryOnDevice(*getDevice().getMemoryManager(), rootDeviceIndex);
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
+    retVal = dstBuffer->ensureMemoryOnDevice(*getDevice().getMemoryManager(), rootDeviceIndex);
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
 
     auto eBuiltInOpsType = EBuiltInOps::CopyImage3dToBuffer;
     if (forceStateless(dstBuffer->getSize())) {
         eBuiltInOpsType = EBuiltInOps::CopyImage3dToBufferStateless;
     }
-    auto &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(eBuiltInOpsType,
-                                                                            this->getClDevice());
-    BuiltInOwnershipWrapper builtInLock(builder);
+    cl_command_type cmdType = CL_COMMAND_COPY_IMAGE_TO_BUFFER;
+    auto blitAllowed = blitEnqueueAllowed(cmdType) && blitEnqueueImageAllowed(srcOrigin, region, *srcImage);
 
     MemObjSurface srcImgSurf(srcImage);
     MemObjSurface dstBufferSurf(dstBuffer);
@@ -59,15 +64,8 @@ cl_int CommandQueueHw<GfxFamily>::enqueueCopyImageToBuffer(
     }
 
     MultiDispatchInfo dispatchInfo(dc);
-    builder.buildDispatchInfos(dispatchInfo);
 
-    enqueueHandler<CL_COMMAND_COPY_IMAGE_TO_BUFFER>(
-        surfaces,
-        false,
-        dispatchInfo,
-        numEventsInWaitList,
-        eventWaitList,
-        event);
+    dispatchBcsOrGpgpuEnqueue<CL_COMMAND_COPY_IMAGE_TO_BUFFER>(dispatchInfo, surfaces, eBuiltInOpsType, numEventsInWaitList, eventWaitList, event, false, blitAllowed);
 
     return CL_SUCCESS;
 }
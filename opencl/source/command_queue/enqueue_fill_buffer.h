@@ -8,6 +8,8 @@
 #pragma once
 #include "shared/source/built_ins/built_ins.h"
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/helpers/blit_commands_helper.h"
+#include "shared/source/helpers/hw_helper.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/memory_manager.h"
 
@@ -35,7 +37,19 @@ cl_int CommandQueueHw<GfxFamily>::enqueueFillBuffer(
 
     auto rootDeviceIndex = getDevice().getRootDeviceIndex();
 
-    buffer->getMigrateableMultiGraphicsAllocation().ensureMemoryOnDevice(*getDevice().getMemoryManager(), rootDeviceIndex);
+    cl_int retVal = buffer->ensureMemoryOnDevice(*getDevice().getMemoryManager(), rootDeviceIndex);
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
+
+    // the blitter fills with the pattern itself, the kernel reads it from the pattern allocation
+    uint32_t colorFillPattern[4] = {};
+    auto maxColorFillPatternSize = HwHelper::get(getDevice().getHardwareInfo().platform.eRenderCoreFamily).getMaxFillPaternSizeForCopyEngine();
+    auto colorFillPatternSize = BlitHelper::narrowFillPattern(colorFillPattern, pattern, patternSize, maxColorFillPatternSize);
+    if (isCopyOnly && colorFillPatternSize == 0) {
+        // copy only queues cannot fall back to the fill kernel
+        return CL_INVALID_OPERATION;
+    }
 
     auto commandStreamReceieverOwnership = getGpgpuCommandStreamReceiver().obtainUniqueOwnership();
     auto storageWithAllocations = getGpgpuCommandStreamReceiver().getInternalAllocationStorage();
@@ -62,10 +76,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueFillBuffer(
         eBuiltInOps = EBuiltInOps::FillBufferStateless;
     }
 
-    auto &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(eBuiltInOps,
-                                                                            this->getClDevice());
-
-    BuiltInOwnershipWrapper builtInLock(builder);
+    auto blitAllowed = blitEnqueueAllowed(CL_COMMAND_FILL_BUFFER) && colorFillPatternSize != 0;
 
     BuiltinOpParams dc;
     auto multiGraphicsAllocation = MultiGraphicsAllocation(getDevice().getRootDeviceIndex());
@@ -74,24 +85,18 @@ cl_int CommandQueueHw<GfxFamily>::enqueueFillBuffer(
     MemObj patternMemObj(this->context, 0, {}, 0, 0, alignUp(patternSize, 4), patternAllocation->getUnderlyingBuffer(),
                          patternAllocation->getUnderlyingBuffer(), std::move(multiGraphicsAllocation), false, false, true);
     dc.srcMemObj = &patternMemObj;
+    dc.srcPtr = colorFillPattern;
+    dc.patternSize = colorFillPatternSize;
     dc.dstMemObj = buffer;
     dc.dstOffset = {offset, 0, 0};
     dc.size = {size, 0, 0};
 
-    MultiDispatchInfo dispatchInfo(dc);
-    builder.buildDispatchInfos(dispatchInfo);
-
     MemObjSurface s1(buffer);
     GeneralSurface s2(patternAllocation);
     Surface *surfaces[] = {&s1, &s2};
 
-    enqueueHandler<CL_COMMAND_FILL_BUFFER>(
-        surfaces,
-        false,
-        dispatchInfo,
-        numEventsInWaitList,
-        eventWaitList,
-        event);
+    MultiDispatchInfo dispatchInfo(dc);
+    dispatchBcsOrGpgpuEnqueue<CL_COMMAND_FILL_BUFFER>(dispatchInfo, surfaces, eBuiltInOps, numEventsInWaitList, eventWaitList, event, false, blitAllowed);
 
     auto storageForAllocation = getGpgpuCommandStreamReceiver().getInternalAllocationStorage();
     storageForAllocation->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(patternAllocation), REUSABLE_ALLOCATION, taskCount);
@@ -32,7 +32,10 @@ cl_int CommandQueueHw<GfxFamily>::enqueueFillImage(
 
     auto rootDeviceIndex = getDevice().getRootDeviceIndex();
 
-    image->getMigrateableMultiGraphicsAllocation().ensureMemoryOnDevice(*getDevice().getMemoryManager(), rootDeviceIndex);
+    cl_int retVal = image->ensureMemoryOnDevice(*getDevice().getMemoryManager(), rootDeviceIndex);
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
 
     auto &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::FillImage3d,
                                                                             this->getClDevice());
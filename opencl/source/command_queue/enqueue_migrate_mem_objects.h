@@ -30,7 +30,10 @@ cl_int CommandQueueHw<GfxFamily>::enqueueMigrateMemObjects(cl_uint numMemObjects
 
     for (unsigned int object = 0; object < numMemObjects; object++) {
         auto memObject = castToObject<MemObj>(memObjects[object]);
-        memObject->getMigrateableMultiGraphicsAllocation().ensureMemoryOnDevice(*getDevice().getMemoryManager(), rootDeviceIndex);
+        auto retVal = memObject->ensureMemoryOnDevice(*getDevice().getMemoryManager(), rootDeviceIndex);
+        if (retVal != CL_SUCCESS) {
+            return retVal;
+        }
     }
 
     enqueueHandler<CL_COMMAND_MIGRATE_MEM_OBJECTS>(surfaces,
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -301,6 +301,10 @@ cl_int CommandQueueHw<GfxFamily>::enqueueSVMMemcpy(cl_bool blockingCopy,
         copyType = SvmToHost;
     }
 
+    if (svmMemcpyCpuCopyAllowed(dstSvmData, srcSvmData, blockingCopy, size, numEventsInWaitList, eventWaitList)) {
+        return enqueueSVMMemcpyOnCpu(dstPtr, srcPtr, size, event);
+    }
+
     auto pageFaultManager = context->getMemoryManager()->getPageFaultManager();
     if (dstSvmData && pageFaultManager) {
         pageFaultManager->moveAllocationToGpuDomain(reinterpret_cast<void *>(dstSvmData->gpuAllocations.getGraphicsAllocation(rootDeviceIndex)->getGpuAddress()));
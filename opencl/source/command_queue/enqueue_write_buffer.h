@@ -16,6 +16,7 @@
 #include "opencl/source/mem_obj/buffer.h"
 #include "opencl/source/memory_manager/mem_obj_surface.h"
 
+#include <algorithm>
 #include <new>
 
 namespace NEO {
@@ -34,7 +35,10 @@ cl_int CommandQueueHw<GfxFamily>::enqueueWriteBuffer(
 
     auto rootDeviceIndex = getDevice().getRootDeviceIndex();
 
-    buffer->getMigrateableMultiGraphicsAllocation().ensureMemoryOnDevice(*getDevice().getMemoryManager(), rootDeviceIndex);
+    cl_int retVal = buffer->ensureMemoryOnDevice(*getDevice().getMemoryManager(), rootDeviceIndex);
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
 
     const cl_command_type cmdType = CL_COMMAND_WRITE_BUFFER;
     auto isMemTransferNeeded = buffer->isMemObjZeroCopy() ? buffer->checkIfMemoryTransferIsRequired(offset, 0, ptr, cmdType) : true;
@@ -47,7 +51,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueWriteBuffer(
         auto svmEntry = this->getContext().getSVMAllocsManager()->getSVMAlloc(ptr);
         if (svmEntry) {
             memoryType = svmEntry->memoryType;
-            if ((svmEntry->gpuAllocations.getGraphicsAllocation(rootDeviceIndex)->getGpuAddress() + svmEntry->size) < (castToUint64(ptr) + size)) {
+            if ((svmEntry->gpuAllocations.getGraphicsAllocation(rootDeviceIndex)->getGpuAddress() + svmEntry->offsetInAllocation + svmEntry->size) < (castToUint64(ptr) + size)) {
                 return CL_INVALID_OPERATION;
             }
 
@@ -78,13 +82,22 @@ cl_int CommandQueueHw<GfxFamily>::enqueueWriteBuffer(
         eBuiltInOps = EBuiltInOps::CopyBufferToBufferStateless;
     }
 
+    auto blitAllowed = blitEnqueueAllowed(cmdType);
+
+    if (!mapAllocation) {
+        auto stagingChunkSize = getStagingWriteChunkSize(size, numEventsInWaitList, eventWaitList);
+        if (stagingChunkSize > 0) {
+            return enqueueStagingWriteBuffer(buffer, blockingWrite, offset, size, ptr, stagingChunkSize, eBuiltInOps, blitAllowed,
+                                             numEventsInWaitList, eventWaitList, event);
+        }
+    }
+
     void *srcPtr = const_cast<void *>(ptr);
 
     HostPtrSurface hostPtrSurf(srcPtr, size, true);
     MemObjSurface bufferSurf(buffer);
     GeneralSurface mapSurface;
     Surface *surfaces[] = {&bufferSurf, nullptr};
-    auto blitAllowed = blitEnqueueAllowed(cmdType);
 
     if (mapAllocation) {
         surfaces[1] = &mapSurface;
@@ -126,4 +139,46 @@ cl_int CommandQueueHw<GfxFamily>::enqueueWriteBuffer(
 
     return CL_SUCCESS;
 }
+
+template <typename GfxFamily>
+cl_int CommandQueueHw<GfxFamily>::enqueueStagingWriteBuffer(Buffer *buffer, cl_bool blockingWrite, size_t offset, size_t size, const void *ptr, size_t chunkSize,
+                                                            EBuiltInOps::Type builtInOperation, bool blitAllowed, cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event) {
+    // the source is copied chunk by chunk to pinned staging buffers instead of pinning the whole range,
+    // CPU copy of the next chunk overlaps with the GPU copy of the previous one
+    MemObjSurface bufferSurf(buffer);
+    GeneralSurface stagingSurface;
+    Surface *surfaces[] = {&bufferSurf, &stagingSurface};
+
+    for (size_t chunkOffset = 0; chunkOffset < size; chunkOffset += chunkSize) {
+        auto currentChunkSize = std::min(chunkSize, size - chunkOffset);
+        bool firstChunk = (chunkOffset == 0);
+        bool lastChunk = (chunkOffset + currentChunkSize == size);
+
+        auto stagingBuffer = obtainStagingBuffer(chunkSize);
+        if (stagingBuffer == nullptr) {
+            return CL_OUT_OF_RESOURCES;
+        }
+        memcpy_s(stagingBuffer->getUnderlyingBuffer(), currentChunkSize, ptrOffset(ptr, chunkOffset), currentChunkSize);
+        stagingSurface.setGraphicsAllocation(stagingBuffer);
+
+        BuiltinOpParams dc;
+        dc.srcPtr = reinterpret_cast<void *>(stagingBuffer->getGpuAddress());
+        dc.dstMemObj = buffer;
+        dc.dstOffset = {offset + chunkOffset, 0, 0};
+        dc.size = {currentChunkSize, 0, 0};
+        dc.transferAllocation = stagingBuffer;
+
+        MultiDispatchInfo dispatchInfo(dc);
+        dispatchBcsOrGpgpuEnqueue<CL_COMMAND_WRITE_BUFFER>(dispatchInfo, surfaces, builtInOperation,
+                                                           firstChunk ? numEventsInWaitList : 0u, firstChunk ? eventWaitList : nullptr,
+                                                           lastChunk ? event : nullptr, lastChunk ? blockingWrite : false, blitAllowed);
+        releaseStagingBuffer();
+
+        if (!lastChunk) {
+            flush();
+        }
+    }
+
+    return CL_SUCCESS;
+}
 } // namespace NEO
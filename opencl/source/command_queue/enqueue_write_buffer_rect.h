@@ -36,7 +36,10 @@ cl_int CommandQueueHw<GfxFamily>::enqueueWriteBufferRect(
 
     auto rootDeviceIndex = getDevice().getRootDeviceIndex();
 
-    buffer->getMigrateableMultiGraphicsAllocation().ensureMemoryOnDevice(*getDevice().getMemoryManager(), rootDeviceIndex);
+    cl_int retVal = buffer->ensureMemoryOnDevice(*getDevice().getMemoryManager(), rootDeviceIndex);
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
 
     const cl_command_type cmdType = CL_COMMAND_WRITE_BUFFER_RECT;
     auto isMemTransferNeeded = true;
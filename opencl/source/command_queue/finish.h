@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,7 @@ cl_int CommandQueueHw<GfxFamily>::finish() {
 
     // Stall until HW reaches CQ taskCount
     waitUntilComplete(taskCountToWaitFor, this->bcsTaskCount, flushStampToWaitFor, false);
+    printDeferredPrintfOutput(taskCountToWaitFor);
 
     return CL_SUCCESS;
 }
@@ -8,6 +8,7 @@
 #pragma once
 #include "shared/source/helpers/engine_node_helper.h"
 #include "shared/source/os_interface/os_context.h"
+#include "shared/source/utilities/launch_overhead_profiler.h"
 
 #include "opencl/source/command_queue/hardware_interface_base.inl"
 
@@ -80,37 +81,67 @@ inline void HardwareInterface<GfxFamily>::programWalker(
     size_t startWorkGroups[3] = {startOfWorkgroups.x, startOfWorkgroups.y, startOfWorkgroups.z};
     size_t numWorkGroups[3] = {numberOfWorkgroups.x, numberOfWorkgroups.y, numberOfWorkgroups.z};
 
+    std::array<size_t, 14> walkerKey = {{globalOffsets[0], globalOffsets[1], globalOffsets[2],
+                                         startWorkGroups[0], startWorkGroups[1], startWorkGroups[2],
+                                         numWorkGroups[0], numWorkGroups[1], numWorkGroups[2],
+                                         localWorkSizes[0], localWorkSizes[1], localWorkSizes[2],
+                                         simd, dim}};
+    auto &dispatchTemplate = kernel.getDispatchTemplate(rootDeviceIndex);
+    bool useDispatchTemplate = DebugManager.flags.EnableDispatchTemplateCache.get() != 0;
+
+    // thread data fields do not overlap with the ones programmed below for timestamps and indirect state
+    bool walkerFromTemplate = false;
+    if (useDispatchTemplate) {
+        std::lock_guard<std::mutex> lock(kernel.getDispatchTemplateMutex());
+        if (dispatchTemplate.walkerKey == walkerKey && dispatchTemplate.walker.size() == sizeof(walkerCmd)) {
+            memcpy_s(&walkerCmd, sizeof(walkerCmd), dispatchTemplate.walker.data(), sizeof(walkerCmd));
+            walkerFromTemplate = true;
+        }
+    }
+    if (false == walkerFromTemplate) {
+        GpgpuWalkerHelper<GfxFamily>::setGpgpuWalkerThreadData(&walkerCmd, kernel.getKernelInfo(rootDeviceIndex).kernelDescriptor,
+                                                               globalOffsets, startWorkGroups,
+                                                               numWorkGroups, localWorkSizes, simd, dim,
+                                                               false, false, 0u);
+
+        EncodeDispatchKernel<GfxFamily>::encodeAdditionalWalkerFields(commandQueue.getDevice().getHardwareInfo(), walkerCmd);
+
+        if (useDispatchTemplate) {
+            auto walkerBytes = reinterpret_cast<const uint8_t *>(&walkerCmd);
+            std::lock_guard<std::mutex> lock(kernel.getDispatchTemplateMutex());
+            dispatchTemplate.walkerKey = walkerKey;
+            dispatchTemplate.walker.assign(walkerBytes, walkerBytes + sizeof(walkerCmd));
+        }
+    }
+
     if (currentTimestampPacketNodes && commandQueue.getGpgpuCommandStreamReceiver().peekTimestampPacketWriteEnabled()) {
-        auto timestampPacketNode = currentTimestampPacketNodes->peekNodes().at(currentDispatchIndex);
+        auto timestampPacketNode = currentTimestampPacketNodes->peekNodes()[currentDispatchIndex];
         GpgpuWalkerHelper<GfxFamily>::setupTimestampPacket(&commandStream, &walkerCmd, timestampPacketNode, commandQueue.getDevice().getRootDeviceEnvironment());
     }
 
     auto isCcsUsed = EngineHelpers::isCcs(commandQueue.getGpgpuEngine().osContext->getEngineType());
     auto kernelUsesLocalIds = HardwareCommandsHelper<GfxFamily>::kernelUsesLocalIds(kernel, rootDeviceIndex);
 
-    HardwareCommandsHelper<GfxFamily>::sendIndirectState(
-        commandStream,
-        dsh,
-        ioh,
-        ssh,
-        kernel,
-        kernel.getKernelStartOffset(true, kernelUsesLocalIds, isCcsUsed, rootDeviceIndex),
-        simd,
-        localWorkSizes,
-        offsetInterfaceDescriptorTable,
-        interfaceDescriptorIndex,
-        preemptionMode,
-        &walkerCmd,
-        nullptr,
-        true,
-        commandQueue.getDevice());
-
-    GpgpuWalkerHelper<GfxFamily>::setGpgpuWalkerThreadData(&walkerCmd, kernel.getKernelInfo(rootDeviceIndex).kernelDescriptor,
-                                                           globalOffsets, startWorkGroups,
-                                                           numWorkGroups, localWorkSizes, simd, dim,
-                                                           false, false, 0u);
-
-    EncodeDispatchKernel<GfxFamily>::encodeAdditionalWalkerFields(commandQueue.getDevice().getHardwareInfo(), walkerCmd);
+    {
+        ScopedLaunchPhase launchPhase(LaunchOverheadProfiler::Phase::argumentPatching);
+        HardwareCommandsHelper<GfxFamily>::sendIndirectState(
+            commandStream,
+            dsh,
+            ioh,
+            ssh,
+            kernel,
+            kernel.getKernelStartOffset(true, kernelUsesLocalIds, isCcsUsed, rootDeviceIndex),
+            simd,
+            localWorkSizes,
+            offsetInterfaceDescriptorTable,
+            interfaceDescriptorIndex,
+            preemptionMode,
+            &walkerCmd,
+            nullptr,
+            true,
+            commandQueue.getDevice());
+    }
+
     *walkerCmdBuf = walkerCmd;
 }
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,6 +27,9 @@ namespace NEO {
 //big cores like SKL have 8EU * 7 HW threads per subslice and are considered as highThreadCount devices
 constexpr uint32_t highThreadCountThreshold = 56u;
 
+//upper bound of local work sizes remembered per kernel, so kernels enqueued with ever changing gws do not grow without limit
+constexpr size_t maxLocalWorkSizeCacheEntries = 64u;
+
 static const uint32_t optimalHardwareThreadCountGeneric[] = {32, 16, 8, 4, 2, 1};
 
 static const uint32_t primeNumbers[] = {
@@ -420,8 +423,29 @@ Vec3<size_t> computeWorkgroupSize(const DispatchInfo &dispatchInfo) {
         const auto &hwInfo = device.getHardwareInfo();
         auto &hwHelper = HwHelper::get(hwInfo.platform.eRenderCoreFamily);
         auto isSimulation = device.isSimulation();
+        auto &localWorkSizeCache = kernel->getLocalWorkSizeCache(rootDeviceIndex);
+        Kernel::LocalWorkSizeKey cacheKey = {dispatchInfo.getGWS().x, dispatchInfo.getGWS().y, dispatchInfo.getGWS().z, dispatchInfo.getDim(),
+                                             kernel->getSlmTotalSize(rootDeviceIndex), kernel->getMaxKernelWorkGroupSize(rootDeviceIndex),
+                                             DebugManager.flags.EnableComputeWorkSizeND.get(), DebugManager.flags.EnableComputeWorkSizeSquared.get()};
+        bool useCache = DebugManager.flags.EnableLocalWorkSizeCache.get() != 0;
+        bool foundInCache = false;
+        Vec3<size_t> cachedLocalWorkSize{0, 0, 0};
+        if (useCache) {
+            // the same kernel may be enqueued on several queues concurrently
+            std::lock_guard<std::mutex> lock(kernel->getLocalWorkSizeCacheMutex());
+            auto cacheEntry = localWorkSizeCache.find(cacheKey);
+            if (cacheEntry != localWorkSizeCache.end()) {
+                cachedLocalWorkSize = cacheEntry->second;
+                foundInCache = true;
+            }
+        }
+
         if (kernel->requiresLimitedWorkgroupSize(rootDeviceIndex) && hwHelper.isSpecialWorkgroupSizeRequired(hwInfo, isSimulation)) {
             setSpecialWorkgroupSize(workGroupSize);
+        } else if (foundInCache) {
+            workGroupSize[0] = cachedLocalWorkSize.x;
+            workGroupSize[1] = cachedLocalWorkSize.y;
+            workGroupSize[2] = cachedLocalWorkSize.z;
         } else if (DebugManager.flags.EnableComputeWorkSizeND.get()) {
             WorkSizeInfo wsInfo(dispatchInfo);
             size_t workItems[3] = {dispatchInfo.getGWS().x, dispatchInfo.getGWS().y, dispatchInfo.getGWS().z};
@@ -438,6 +462,13 @@ Vec3<size_t> computeWorkgroupSize(const DispatchInfo &dispatchInfo) {
                 computeWorkgroupSize2D(maxWorkGroupSize, workGroupSize, workItems, simd);
             }
         }
+        if (useCache && false == foundInCache) {
+            std::lock_guard<std::mutex> lock(kernel->getLocalWorkSizeCacheMutex());
+            if (localWorkSizeCache.size() >= maxLocalWorkSizeCacheEntries) {
+                localWorkSizeCache.clear();
+            }
+            localWorkSizeCache[cacheKey] = {workGroupSize[0], workGroupSize[1], workGroupSize[2]};
+        }
     }
     DBG_LOG(PrintLWSSizes, "Input GWS enqueueBlocked", dispatchInfo.getGWS().x, dispatchInfo.getGWS().y, dispatchInfo.getGWS().z,
             " Driver deduced LWS", workGroupSize[0], workGroupSize[1], workGroupSize[2]);
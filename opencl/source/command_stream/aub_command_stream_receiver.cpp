@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -84,6 +84,18 @@ static auto sizeMemoryWriteHeader = sizeof(CmdServicesMemTraceMemoryWrite) - siz
 extern const size_t g_dwordCountMax;
 
 void AubFileStream::open(const char *filePath) {
+    // memory writes come as many small chunks, a large buffer turns them into few big file writes
+    writeBufferSize = defaultWriteBufferSize;
+    // negative sizes other than -1 are rejected as well, they would convert to a huge size_t
+    if (NEO::DebugManager.flags.AubDumpWriteBufferSize.get() >= 0) {
+        writeBufferSize = static_cast<size_t>(NEO::DebugManager.flags.AubDumpWriteBufferSize.get());
+    }
+    if (writeBufferSize > 0u && !fileHandle.is_open()) {
+        // the buffer has to be set before the file is opened to take effect
+        auto newWriteBuffer = std::make_unique<char[]>(writeBufferSize);
+        fileHandle.rdbuf()->pubsetbuf(newWriteBuffer.get(), static_cast<std::streamsize>(writeBufferSize));
+        writeBuffer = std::move(newWriteBuffer);
+    }
     fileHandle.open(filePath, std::ofstream::binary);
     fileName.assign(filePath);
 }
@@ -30,6 +30,7 @@ class AUBCommandStreamReceiverHw : public CommandStreamReceiverSimulatedHw<GfxFa
     using ExternalAllocationsContainer = std::vector<AllocationView>;
     using BaseClass::getParametersForWriteMemory;
     using BaseClass::osContext;
+    using BaseClass::writtenPages;
 
   public:
     using CommandStreamReceiverSimulatedCommonHw<GfxFamily>::initAdditionalMMIO;
@@ -145,6 +145,8 @@ void AUBCommandStreamReceiverHw<GfxFamily>::initFile(const std::string &fileName
             // try adding <familycodename>_aub
             UNRECOVERABLE_IF(true);
         }
+        // a new file holds none of the pages written to the previous one
+        writtenPages.clear();
         // Add the file header
         auto &hwInfo = this->peekHwInfo();
         auto &hwHelper = NEO::HwHelper::get(hwInfo.platform.eRenderCoreFamily);
@@ -627,8 +629,12 @@ void AUBCommandStreamReceiverHw<GfxFamily>::writeMemory(uint64_t gpuAddress, voi
     }
 
     AubHelperHw<GfxFamily> aubHelperHw(this->isLocalMemoryEnabled());
+    bool skipUnchangedPages = DebugManager.flags.AUBDumpSkipUnchangedPages.get() == 1;
 
     PageWalker walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+        if (skipUnchangedPages && this->isPageUnchanged(physAddress, gpuAddress + offset, entryBits, ptrOffset(cpuAddress, offset), size)) {
+            return;
+        }
         AUB::reserveAddressGGTTAndWriteMmeory(*stream, static_cast<uintptr_t>(gpuAddress), cpuAddress, physAddress, size, offset, entryBits,
                                               aubHelperHw);
     };
@@ -12,6 +12,8 @@
 #include "aub_mapper.h"
 #include "third_party/aub_stream/headers/hardware_context.h"
 
+#include <unordered_map>
+
 namespace aub_stream {
 class AubManager;
 struct AubStream;
@@ -31,6 +33,16 @@ class CommandStreamReceiverSimulatedCommonHw : public CommandStreamReceiverHw<Gf
     bool getParametersForWriteMemory(GraphicsAllocation &graphicsAllocation, uint64_t &gpuAddress, void *&cpuAddress, size_t &size) const;
     void freeEngineInfo(AddressMapper &gttRemap);
     MOCKABLE_VIRTUAL uint32_t getDeviceIndex() const;
+    bool isPageUnchanged(uint64_t physAddress, uint64_t gpuAddress, uint64_t entryBits, const void *memory, size_t size);
+
+    struct WrittenPage {
+        uint64_t gpuAddress = 0u;
+        uint64_t entryBits = 0u;
+        size_t size = 0u;
+        uint64_t contentHash = 0u;
+    };
+    // pages already sent to the simulator or file keyed by physical address, rewritten only when their mapping or contents change
+    std::unordered_map<uint64_t, WrittenPage> writtenPages;
 
   public:
     CommandStreamReceiverSimulatedCommonHw(ExecutionEnvironment &executionEnvironment,
@@ -11,6 +11,8 @@
 #include "shared/source/gmm_helper/gmm.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
 #include "shared/source/gmm_helper/resource_info.h"
+#include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/address_mapper.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
@@ -108,6 +110,19 @@ template <typename GfxFamily>
 uint32_t CommandStreamReceiverSimulatedCommonHw<GfxFamily>::getDeviceIndex() const {
     return osContext->getDeviceBitfield().any() ? static_cast<uint32_t>(Math::log2(static_cast<uint32_t>(osContext->getDeviceBitfield().to_ulong()))) : 0u;
 }
+
+template <typename GfxFamily>
+bool CommandStreamReceiverSimulatedCommonHw<GfxFamily>::isPageUnchanged(uint64_t physAddress, uint64_t gpuAddress, uint64_t entryBits, const void *memory, size_t size) {
+    auto contentHash = Hash::hash(reinterpret_cast<const char *>(memory), size);
+    auto &writtenPage = writtenPages[physAddress];
+    if (writtenPage.gpuAddress == gpuAddress && writtenPage.entryBits == entryBits &&
+        writtenPage.size == size && writtenPage.contentHash == contentHash) {
+        return true;
+    }
+    writtenPage = {gpuAddress, entryBits, size, contentHash};
+    return false;
+}
+
 template <typename GfxFamily>
 CommandStreamReceiverSimulatedCommonHw<GfxFamily>::CommandStreamReceiverSimulatedCommonHw(ExecutionEnvironment &executionEnvironment,
                                                                                           uint32_t rootDeviceIndex,
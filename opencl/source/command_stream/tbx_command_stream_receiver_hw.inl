@@ -407,8 +407,12 @@ template <typename GfxFamily>
 void TbxCommandStreamReceiverHw<GfxFamily>::writeMemory(uint64_t gpuAddress, void *cpuAddress, size_t size, uint32_t memoryBank, uint64_t entryBits) {
 
     AubHelperHw<GfxFamily> aubHelperHw(this->localMemoryEnabled);
+    bool skipUnchangedPages = DebugManager.flags.TbxSkipUnchangedPages.get() == 1;
 
     PageWalker walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+        if (skipUnchangedPages && this->isPageUnchanged(physAddress, gpuAddress + offset, entryBits, ptrOffset(cpuAddress, offset), size)) {
+            return;
+        }
         AUB::reserveAddressGGTTAndWriteMmeory(tbxStream, static_cast<uintptr_t>(gpuAddress), cpuAddress, physAddress, size, offset, entryBits,
                                               aubHelperHw);
     };
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,10 @@ CompilerCacheConfig getDefaultClCompilerCacheConfig() {
     std::unique_ptr<SettingsReader> settingsReader(SettingsReader::createOsReader(false, keyName));
     ret.cacheDir = settingsReader->getSetting(settingsReader->appSpecificLocation(keyName), static_cast<std::string>(CL_CACHE_LOCATION));
 
+    std::string maxSizeKeyName = oclRegPath;
+    maxSizeKeyName += "cl_cache_max_size";
+    ret.cacheSize = static_cast<uint64_t>(settingsReader->getSetting(settingsReader->appSpecificLocation(maxSizeKeyName), static_cast<int64_t>(0)));
+
     ret.cacheFileExtension = ".cl_cache";
 
     return ret;
@@ -21,6 +21,7 @@
 #include "opencl/source/cl_device/cl_device.h"
 #include "opencl/source/command_queue/command_queue.h"
 #include "opencl/source/device_queue/device_queue.h"
+#include "opencl/source/event/event.h"
 #include "opencl/source/execution_environment/cl_execution_environment.h"
 #include "opencl/source/gtpin/gtpin_notify.h"
 #include "opencl/source/helpers/get_info_status_mapper.h"
@@ -50,12 +51,17 @@ Context::Context(
 Context::~Context() {
     delete[] properties;
 
+    for (auto &recycledBufferAllocation : recycledBufferAllocations) {
+        memoryManager->checkGpuUsageAndDestroyGraphicsAllocations(recycledBufferAllocation.allocation);
+    }
+
     for (auto rootDeviceIndex = 0u; rootDeviceIndex < specialQueues.size(); rootDeviceIndex++) {
         if (specialQueues[rootDeviceIndex]) {
             delete specialQueues[rootDeviceIndex];
         }
     }
     if (svmAllocsManager) {
+        svmAllocsManager->releaseSystemAllocations();
         delete svmAllocsManager;
     }
     if (driverDiagnostics) {
@@ -73,6 +79,9 @@ Context::~Context() {
     delete schedulerBuiltIn->pProgram;
     schedulerBuiltIn->pKernel = nullptr;
     schedulerBuiltIn->pProgram = nullptr;
+    for (auto eventMemory : recycledEventMemory) {
+        ::operator delete(eventMemory);
+    }
 }
 
 cl_int Context::setDestructorCallback(void(CL_CALLBACK *funcNotify)(cl_context, void *),
@@ -466,4 +475,61 @@ void Context::setupContextType() {
     }
 }
 
+void *Context::obtainEventMemory() {
+    {
+        std::lock_guard<std::mutex> lock(recycledEventMemoryMutex);
+        if (!recycledEventMemory.empty()) {
+            auto eventMemory = recycledEventMemory.back();
+            recycledEventMemory.pop_back();
+            return eventMemory;
+        }
+    }
+    return ::operator new(sizeof(Event));
+}
+
+GraphicsAllocation *Context::obtainRecycledBufferAllocation(uint32_t rootDeviceIndex, size_t size, GraphicsAllocation::AllocationType allocationType, const MemoryProperties &memoryProperties) {
+    std::lock_guard<std::mutex> lock(recycledBufferAllocationsMutex);
+    for (auto it = recycledBufferAllocations.begin(); it != recycledBufferAllocations.end(); ++it) {
+        auto allocation = it->allocation;
+        // a plain buffer placed in system memory is retyped as host memory when it is created
+        bool typeMatches = allocation->getAllocationType() == allocationType ||
+                           (allocationType == GraphicsAllocation::AllocationType::BUFFER &&
+                            allocation->getAllocationType() == GraphicsAllocation::AllocationType::BUFFER_HOST_MEMORY &&
+                            !memoryManager->isLocalMemorySupported(rootDeviceIndex));
+        if (allocation->getRootDeviceIndex() != rootDeviceIndex || it->size != size || !typeMatches ||
+            it->memoryProperties.allFlags != memoryProperties.allFlags || it->memoryProperties.allAllocFlags != memoryProperties.allAllocFlags) {
+            continue;
+        }
+        if (memoryManager->isAllocationInUse(*allocation)) {
+            continue;
+        }
+        recycledBufferAllocations.erase(it);
+        return allocation;
+    }
+    return nullptr;
+}
+
+bool Context::recycleBufferAllocation(GraphicsAllocation *allocation, size_t size, const MemoryProperties &memoryProperties) {
+    if (DebugManager.flags.EnableBufferAllocationRecycling.get() != 1 || isSharedContext || rootDeviceIndices.size() != 1) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(recycledBufferAllocationsMutex);
+    if (recycledBufferAllocations.size() >= maxRecycledBufferAllocations) {
+        return false;
+    }
+    recycledBufferAllocations.push_back({allocation, size, memoryProperties});
+    return true;
+}
+
+void Context::recycleEventMemory(void *eventMemory) {
+    {
+        std::lock_guard<std::mutex> lock(recycledEventMemoryMutex);
+        if (recycledEventMemory.size() < maxRecycledEvents) {
+            recycledEventMemory.push_back(eventMemory);
+            return;
+        }
+    }
+    ::operator delete(eventMemory);
+}
+
 } // namespace NEO
@@ -9,6 +9,9 @@
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/common_types.h"
 #include "shared/source/helpers/vec.h"
+#include "shared/source/memory_manager/compression_selector.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_properties/memory_properties_flags.h"
 
 #include "opencl/source/cl_device/cl_device_vector.h"
 #include "opencl/source/context/context_type.h"
@@ -157,11 +160,20 @@ class Context : public BaseObject<_cl_context> {
     void setResolvesRequiredInKernels(bool resolves) {
         resolvesRequiredInKernels = resolves;
     }
+    CompressionUsageStatistics &getBufferCompressionUsage() {
+        return bufferCompressionUsage;
+    }
     const ClDeviceVector &getDevices() const {
         return devices;
     }
     const std::map<uint32_t, DeviceBitfield> &getDeviceBitfields() const { return deviceBitfields; };
 
+    void *obtainEventMemory();
+    void recycleEventMemory(void *eventMemory);
+
+    GraphicsAllocation *obtainRecycledBufferAllocation(uint32_t rootDeviceIndex, size_t size, GraphicsAllocation::AllocationType allocationType, const MemoryProperties &memoryProperties);
+    bool recycleBufferAllocation(GraphicsAllocation *allocation, size_t size, const MemoryProperties &memoryProperties);
+
   protected:
     struct BuiltInKernel {
         const char *pSource = nullptr;
@@ -204,5 +216,22 @@ class Context : public BaseObject<_cl_context> {
 
     bool interopUserSync = false;
     bool resolvesRequiredInKernels = false;
+    CompressionUsageStatistics bufferCompressionUsage;
+
+    // memory of released events, reused for events created later on this context
+    static constexpr size_t maxRecycledEvents = 64u;
+    std::vector<void *> recycledEventMemory;
+    std::mutex recycledEventMemoryMutex;
+
+    // allocations of released buffers, reused by buffers created later with the same size and properties
+    // once the GPU is done with them
+    struct RecycledBufferAllocation {
+        GraphicsAllocation *allocation;
+        size_t size;
+        MemoryProperties memoryProperties;
+    };
+    static constexpr size_t maxRecycledBufferAllocations = 16u;
+    std::vector<RecycledBufferAllocation> recycledBufferAllocations;
+    std::mutex recycledBufferAllocationsMutex;
 };
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -36,6 +36,12 @@ void AsyncEventsHandler::registerEvent(Event *event) {
     asyncCond.notify_one();
 }
 
+void AsyncEventsHandler::wakeUp() {
+    // called also from processList while asyncMtx is held, a wake up missed by the sleeping thread is bounded by maxIdleWaitTime
+    wakeUpRequested = true;
+    asyncCond.notify_one();
+}
+
 Event *AsyncEventsHandler::processList() {
     uint32_t lowestTaskCount = CompletionStamp::notReady;
     Event *sleepCandidate = nullptr;
@@ -74,13 +80,21 @@ void *AsyncEventsHandler::asyncProcess(void *arg) {
         if (self->list.empty()) {
             self->asyncCond.wait(lock);
         }
+        self->wakeUpRequested = false;
         lock.unlock();
 
         sleepCandidate = self->processList();
         if (sleepCandidate) {
             sleepCandidate->wait(true, true);
+            continue;
         }
-        std::this_thread::yield();
+
+        // nothing is submitted to the GPU yet, sleep until an event gets unblocked or registered
+        lock.lock();
+        if (!self->list.empty() && self->registerList.empty() && !self->wakeUpRequested && self->allowAsyncProcess) {
+            self->asyncCond.wait_for(lock, maxIdleWaitTime);
+        }
+        lock.unlock();
     }
     return nullptr;
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #pragma once
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
@@ -21,8 +22,12 @@ class AsyncEventsHandler {
     AsyncEventsHandler();
     virtual ~AsyncEventsHandler();
     void registerEvent(Event *event);
+    void wakeUp();
     void closeThread();
 
+    // bound on sleeping while registered events are not submitted yet and no wake up arrives
+    static constexpr std::chrono::milliseconds maxIdleWaitTime{100};
+
   protected:
     Event *processList();
     static void *asyncProcess(void *arg);
@@ -37,5 +42,6 @@ class AsyncEventsHandler {
     std::mutex asyncMtx;
     std::condition_variable asyncCond;
     std::atomic<bool> allowAsyncProcess;
+    std::atomic<bool> wakeUpRequested{false};
 };
 } // namespace NEO
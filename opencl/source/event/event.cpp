@@ -13,9 +13,11 @@
 #include "shared/source/helpers/get_info.h"
 #include "shared/source/helpers/timestamp_packet.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
+#include "shared/source/utilities/cpuintrinsics.h"
 #include "shared/source/utilities/range.h"
 #include "shared/source/utilities/stackvec.h"
 #include "shared/source/utilities/tag_allocator.h"
+#include "shared/source/utilities/trace_events.h"
 
 #include "opencl/extensions/public/cl_ext_private.h"
 #include "opencl/source/api/cl_types.h"
@@ -27,6 +29,10 @@
 #include "opencl/source/helpers/hardware_commands_helper.h"
 #include "opencl/source/mem_obj/mem_obj.h"
 
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
 #define OCLRT_NUM_TIMESTAMP_BITS (32)
 
 namespace NEO {
@@ -144,6 +150,26 @@ Event::~Event() {
     unblockEventsBlockedByThis(executionStatus);
 }
 
+Event *Event::createRecyclable(CommandQueue *cmdQueue, cl_command_type cmdType,
+                               uint32_t taskLevel, uint32_t taskCount) {
+    auto context = cmdQueue->getContextPtr();
+    if (context == nullptr || DebugManager.flags.EnableEventRecycling.get() == 0) {
+        return new Event(cmdQueue, cmdType, taskLevel, taskCount);
+    }
+    auto event = new (context->obtainEventMemory()) Event(cmdQueue, cmdType, taskLevel, taskCount);
+    event->recyclable = true;
+    return event;
+}
+
+void Event::recycle(Event *event) {
+    // the event holds the last internal reference of its context in some cases, keep it alive until the memory is returned
+    auto context = event->ctx;
+    context->incRefInternal();
+    event->~Event();
+    context->recycleEventMemory(event);
+    context->decRefInternal();
+}
+
 cl_int Event::getEventProfilingInfo(cl_profiling_info paramName,
                                     size_t paramValueSize,
                                     void *paramValue,
@@ -252,7 +278,7 @@ cl_ulong Event::getDelta(cl_ulong startTime,
 bool Event::calcProfilingData() {
     if (!dataCalculated && !profilingCpuPath) {
         if (timestampPacketContainer && timestampPacketContainer->peekNodes().size() > 0) {
-            const auto timestamps = timestampPacketContainer->peekNodes();
+            const auto &timestamps = timestampPacketContainer->peekNodes();
 
             if (DebugManager.flags.PrintTimestampPacketContents.get()) {
                 for (auto i = 0u; i < timestamps.size(); i++) {
@@ -335,6 +361,10 @@ void Event::calculateProfilingDataInternal(uint64_t contextStartTS, uint64_t con
     endTimeStamp = startTimeStamp + cpuDuration;
     completeTimeStamp = startTimeStamp + cpuCompleteDuration;
 
+    if (auto traceEvents = TraceEvents::get()) {
+        traceEvents->recordGpuRange("gpuCommand", startTimeStamp, endTimeStamp);
+    }
+
     if (DebugManager.flags.ReturnRawGpuTimestamps.get()) {
         startTimeStamp = contextStartTS;
         endTimeStamp = contextEndTS;
@@ -344,8 +374,62 @@ void Event::calculateProfilingDataInternal(uint64_t contextStartTS, uint64_t con
     dataCalculated = true;
 }
 
+bool Event::getProfilingDurationTicks(uint64_t &ticks, double &nsPerTick) {
+    if (isUserEvent() != CL_FALSE || !profilingEnabled || cmdQueue == nullptr || !updateStatusAndCheckCompletion()) {
+        return false;
+    }
+
+    if (profilingCpuPath || DebugManager.flags.ReturnRawGpuTimestamps.get()) {
+        calcProfilingData();
+        ticks = endTimeStamp - startTimeStamp;
+        nsPerTick = 1.0;
+        return true;
+    }
+
+    uint64_t startTS = 0u;
+    uint64_t endTS = 0u;
+    if (timestampPacketContainer && timestampPacketContainer->peekNodes().size() > 0) {
+        Event::getBoundaryTimestampValues(timestampPacketContainer.get(), startTS, endTS);
+    } else if (timeStampNode) {
+        auto timestamps = timeStampNode->tagForCpuAccess;
+        if (HwHelper::get(cmdQueue->getDevice().getHardwareInfo().platform.eRenderCoreFamily).useOnlyGlobalTimestamps()) {
+            startTS = timestamps->GlobalStartTS;
+            endTS = timestamps->GlobalEndTS;
+        } else {
+            startTS = timestamps->ContextStartTS;
+            endTS = timestamps->ContextEndTS;
+        }
+    } else {
+        return false;
+    }
+    ticks = getDelta(startTS, endTS);
+    nsPerTick = cmdQueue->getDevice().getDeviceInfo().profilingTimerResolution;
+    return true;
+}
+
+cl_int Event::getProfilingDurations(cl_uint numEvents, const cl_event *eventList, cl_ulong *durations) {
+    std::vector<double> nsPerTick(numEvents);
+    for (cl_uint i = 0; i < numEvents; i++) {
+        auto event = castToObject<Event>(eventList[i]);
+        if (event == nullptr) {
+            return CL_INVALID_EVENT;
+        }
+        uint64_t ticks = 0u;
+        if (!event->getProfilingDurationTicks(ticks, nsPerTick[i])) {
+            return CL_PROFILING_INFO_NOT_AVAILABLE;
+        }
+        durations[i] = ticks;
+    }
+
+    // converting in a separate pass over plain arrays lets the compiler vectorize it
+    for (cl_uint i = 0; i < numEvents; i++) {
+        durations[i] = static_cast<cl_ulong>(durations[i] * nsPerTick[i]);
+    }
+    return CL_SUCCESS;
+}
+
 void Event::getBoundaryTimestampValues(TimestampPacketContainer *timestampContainer, uint64_t &globalStartTS, uint64_t &globalEndTS) {
-    const auto timestamps = timestampContainer->peekNodes();
+    const auto &timestamps = timestampContainer->peekNodes();
 
     globalStartTS = timestamps[0]->tagForCpuAccess->packets[0].globalStart;
     globalEndTS = timestamps[0]->tagForCpuAccess->packets[0].globalEnd;
@@ -386,6 +470,9 @@ inline bool Event::wait(bool blocking, bool useQuickKmdSleep) {
 
 void Event::updateExecutionStatus() {
     if (taskLevel == CompletionStamp::notReady) {
+        if (DebugManager.flags.TrackParentEvents.get()) {
+            updateTrackedAncestors();
+        }
         return;
     }
 
@@ -428,6 +515,7 @@ void Event::addChild(Event &childEvent) {
     childEventsToNotify.pushRefFrontOne(childEvent);
     DBG_LOG(EventsDebugEnable, "addChild: Parent event:", this, "child:", &childEvent);
     if (DebugManager.flags.TrackParentEvents.get()) {
+        std::lock_guard<std::mutex> lock(childEvent.parentEventsMutex);
         childEvent.parentEvents.push_back(this);
     }
     if (executionStatus == CL_COMPLETE) {
@@ -435,6 +523,40 @@ void Event::addChild(Event &childEvent) {
     }
 }
 
+void Event::updateTrackedAncestors() {
+    // a single pass over the tracked chain: only ancestors which are not blocked themselves can progress,
+    // their submission or completion unblocks the rest of the chain
+    std::vector<Event *> eventsToVisit;
+    std::vector<Event *> visitedEvents;
+    auto takeParents = [&eventsToVisit](Event &event) {
+        std::lock_guard<std::mutex> lock(event.parentEventsMutex);
+        for (auto parent : event.parentEvents) {
+            parent->incRefInternal();
+            eventsToVisit.push_back(parent);
+        }
+    };
+
+    takeParents(*this);
+    while (!eventsToVisit.empty()) {
+        auto event = eventsToVisit.back();
+        eventsToVisit.pop_back();
+        if (std::find(visitedEvents.begin(), visitedEvents.end(), event) != visitedEvents.end()) {
+            event->decRefInternal();
+            continue;
+        }
+        visitedEvents.push_back(event);
+        if (event->peekIsBlocked()) {
+            takeParents(*event);
+        } else if (!event->isUserEvent()) {
+            event->updateExecutionStatus();
+        }
+    }
+
+    for (auto event : visitedEvents) {
+        event->decRefInternal();
+    }
+}
+
 void Event::unblockEventsBlockedByThis(int32_t transitionStatus) {
 
     int32_t status = transitionStatus;
@@ -534,8 +656,13 @@ void Event::submitCommand(bool abortTasks) {
         if (profilingCpuPath && this->isProfilingEnabled()) {
             setEndTimeStamp();
         }
-        updateTaskCount(complStamp.taskCount, cmdQueue->peekBcsTaskCount());
-        flushStamp->setStamp(complStamp.flushStamp);
+        if (complStamp.taskCount == CompletionStamp::failed) {
+            updateTaskCount(cmdQueue->getGpgpuCommandStreamReceiver().peekTaskCount(), cmdQueue->peekBcsTaskCount());
+            transitionExecutionStatus(CL_OUT_OF_RESOURCES);
+        } else {
+            updateTaskCount(complStamp.taskCount, cmdQueue->peekBcsTaskCount());
+            flushStamp->setStamp(complStamp.flushStamp);
+        }
         submittedCmd.exchange(cmdToProcess.release());
     } else if (profilingCpuPath && endTimeStamp == 0) {
         setEndTimeStamp();
@@ -560,15 +687,7 @@ cl_int Event::waitForEvents(cl_uint numEvents,
         return CL_SUCCESS;
     }
 
-    //flush all command queues
-    for (const cl_event *it = eventList, *end = eventList + numEvents; it != end; ++it) {
-        Event *event = castToObjectOrAbort<Event>(*it);
-        if (event->cmdQueue) {
-            if (event->taskLevel != CompletionStamp::notReady) {
-                event->cmdQueue->flush();
-            }
-        }
-    }
+    flushQueuesOfEvents(numEvents, eventList);
 
     using WorkerListT = StackVec<cl_event, 64>;
     WorkerListT workerList1(eventList, eventList + numEvents);
@@ -598,11 +717,75 @@ cl_int Event::waitForEvents(cl_uint numEvents,
     return CL_SUCCESS;
 }
 
+cl_int Event::waitForAnyEvent(cl_uint numEvents,
+                              const cl_event *eventList,
+                              cl_uint *signaledIndex) {
+    flushQueuesOfEvents(numEvents, eventList);
+
+    // all events are polled until the KMD notify delay of the first event with a known task count passes,
+    // then the wait blocks on that event so the CSR can sleep in the KMD or download the tag in TBX mode
+    auto waitStart = std::chrono::steady_clock::now();
+    while (true) {
+        Event *blockingEvent = nullptr;
+        for (cl_uint i = 0; i < numEvents; i++) {
+            Event *event = castToObjectOrAbort<Event>(eventList[i]);
+            if (event->updateStatusAndCheckCompletion()) {
+                if (event->peekExecutionStatus() < CL_COMPLETE) {
+                    return CL_EXEC_STATUS_ERROR_FOR_EVENTS_IN_WAIT_LIST;
+                }
+                if (signaledIndex) {
+                    *signaledIndex = i;
+                }
+                return CL_SUCCESS;
+            }
+            if (blockingEvent == nullptr && event->cmdQueue && event->taskCount != CompletionStamp::notReady) {
+                blockingEvent = event;
+            }
+        }
+
+        if (blockingEvent) {
+            auto &csr = blockingEvent->cmdQueue->getGpgpuCommandStreamReceiver();
+            auto &kmdNotifyProperties = blockingEvent->cmdQueue->getDevice().getHardwareInfo().capabilityTable.kmdNotifyProperties;
+            // simulated CSRs only update the tag when waited on, without KMD notify a blocking wait would poll one tag only
+            bool blockNow = csr.getType() != CommandStreamReceiverType::CSR_HW;
+            if (!blockNow && kmdNotifyProperties.enableKmdNotify) {
+                auto waitTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - waitStart).count();
+                blockNow = waitTime >= kmdNotifyProperties.delayKmdNotifyMicroseconds;
+            }
+            if (blockNow) {
+                blockingEvent->wait(true, false);
+                continue;
+            }
+        }
+
+        std::this_thread::yield();
+        CpuIntrinsics::pause();
+    }
+}
+
+void Event::flushQueuesOfEvents(cl_uint numEvents, const cl_event *eventList) {
+    for (const cl_event *it = eventList, *end = eventList + numEvents; it != end; ++it) {
+        Event *event = castToObjectOrAbort<Event>(*it);
+        if (event->cmdQueue) {
+            if (event->taskLevel != CompletionStamp::notReady) {
+                event->cmdQueue->flush();
+            }
+        }
+    }
+}
+
 uint32_t Event::getTaskLevel() {
     return taskLevel;
 }
 
 inline void Event::unblockEventBy(Event &event, uint32_t taskLevel, int32_t transitionStatus) {
+    {
+        std::lock_guard<std::mutex> lock(parentEventsMutex);
+        auto parent = std::find(parentEvents.begin(), parentEvents.end(), &event);
+        if (parent != parentEvents.end()) {
+            parentEvents.erase(parent);
+        }
+    }
     int32_t numEventsBlockingThis = --parentCount;
     DEBUG_BREAK_IF(numEventsBlockingThis < 0);
 
@@ -628,6 +811,11 @@ inline void Event::unblockEventBy(Event &event, uint32_t taskLevel, int32_t tran
 
     //event may be completed after this operation, transtition the state to not block others.
     this->updateExecutionStatus();
+
+    if (ctx && peekHasCallbacks() && !isUserEvent() && DebugManager.flags.EnableAsyncEventsHandler.get()) {
+        // task count is known now, let the handler wait for it instead of sleeping
+        ctx->getAsyncEventsHandler().wakeUp();
+    }
 }
 
 bool Event::updateStatusAndCheckCompletion() {
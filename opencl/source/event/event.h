@@ -20,6 +20,7 @@
 
 #include <atomic>
 #include <cstdint>
+#include <mutex>
 #include <vector>
 
 namespace NEO {
@@ -88,6 +89,13 @@ class Event : public BaseObject<_cl_event>, public IDNode<Event> {
 
     ~Event() override;
 
+    // events created this way reuse memory of events released on the same context
+    static Event *createRecyclable(CommandQueue *cmdQueue, cl_command_type cmdType,
+                                   uint32_t taskLevel, uint32_t taskCount);
+    DeleterFuncType getCustomDeleter() const {
+        return recyclable ? &Event::recycle : nullptr;
+    }
+
     uint32_t getCompletionStamp() const;
     void updateCompletionStamp(uint32_t taskCount, uint32_t bcsTaskCount, uint32_t tasklevel, FlushStamp flushStamp);
     cl_ulong getDelta(cl_ulong startTime,
@@ -131,6 +139,11 @@ class Event : public BaseObject<_cl_event>, public IDNode<Event> {
     static cl_int waitForEvents(cl_uint numEvents,
                                 const cl_event *eventList);
 
+    // returns once any event completes, signaledIndex receives its position in eventList
+    static cl_int waitForAnyEvent(cl_uint numEvents,
+                                  const cl_event *eventList,
+                                  cl_uint *signaledIndex);
+
     void setCommand(std::unique_ptr<Command> newCmd) {
         UNRECOVERABLE_IF(cmdToSubmit.load());
         cmdToSubmit.exchange(newCmd.release());
@@ -270,6 +283,7 @@ class Event : public BaseObject<_cl_event>, public IDNode<Event> {
     }
 
     virtual void updateExecutionStatus();
+    void updateTrackedAncestors();
     void tryFlushEvent();
 
     uint32_t peekTaskCount() const {
@@ -304,7 +318,13 @@ class Event : public BaseObject<_cl_event>, public IDNode<Event> {
 
     static void getBoundaryTimestampValues(TimestampPacketContainer *timestampContainer, uint64_t &globalStartTS, uint64_t &globalEndTS);
 
+    static cl_int getProfilingDurations(cl_uint numEvents, const cl_event *eventList, cl_ulong *durations);
+
   protected:
+    static void flushQueuesOfEvents(cl_uint numEvents, const cl_event *eventList);
+
+    static void recycle(Event *event);
+
     Event(Context *ctx, CommandQueue *cmdQueue, cl_command_type cmdType,
           uint32_t taskLevel, uint32_t taskCount);
 
@@ -327,6 +347,7 @@ class Event : public BaseObject<_cl_event>, public IDNode<Event> {
     }
 
     bool calcProfilingData();
+    bool getProfilingDurationTicks(uint64_t &ticks, double &nsPerTick);
     MOCKABLE_VIRTUAL void calculateProfilingDataInternal(uint64_t contextStartTS, uint64_t contextEndTS, uint64_t *contextCompleteTS, uint64_t globalStartTS);
     MOCKABLE_VIRTUAL void synchronizeTaskCount() {
         while (this->taskCount == CompletionStamp::notReady)
@@ -353,6 +374,7 @@ class Event : public BaseObject<_cl_event>, public IDNode<Event> {
     Context *ctx;
     CommandQueue *cmdQueue;
     cl_command_type cmdType;
+    bool recyclable = false;
 
     // callbacks to be executed when this event changes its execution state
     IFList<Callback, true, true> callbacks[(uint32_t)ECallbackTarget::MAX];
@@ -377,8 +399,9 @@ class Event : public BaseObject<_cl_event>, public IDNode<Event> {
     std::unique_ptr<TimestampPacketContainer> timestampPacketContainer;
     //number of events this event depends on
     std::atomic<int> parentCount;
-    //event parents
+    //event parents which did not unblock this event yet, tracked with TrackParentEvents
     std::vector<Event *> parentEvents;
+    std::mutex parentEventsMutex;
 
   private:
     // can be accessed only with updateTaskCount
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -20,6 +20,10 @@ EventBuilder::~EventBuilder() {
     finalize();
 }
 
+void EventBuilder::createRecyclable(CommandQueue *cmdQueue, cl_command_type cmdType, uint32_t taskLevel, uint32_t taskCount) {
+    event = Event::createRecyclable(cmdQueue, cmdType, taskLevel, taskCount);
+}
+
 void EventBuilder::addParentEvent(Event &newParentEvent) {
     bool duplicate = false;
     for (Event *parent : parentEvents) {
@@ -15,6 +15,7 @@
 
 namespace NEO {
 
+class CommandQueue;
 class Event;
 
 class EventBuilder {
@@ -24,6 +25,8 @@ class EventBuilder {
         event = new EventType(std::forward<ArgsT>(args)...);
     }
 
+    void createRecyclable(CommandQueue *cmdQueue, cl_command_type cmdType, uint32_t taskLevel, uint32_t taskCount);
+
     EventBuilder() = default;
     EventBuilder(const EventBuilder &) = delete;
     EventBuilder &operator=(const EventBuilder &) = delete;
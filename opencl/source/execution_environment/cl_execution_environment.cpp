@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -19,7 +19,14 @@ AsyncEventsHandler *ClExecutionEnvironment::getAsyncEventsHandler() const {
     return asyncEventsHandler.get();
 }
 
+void ClExecutionEnvironment::prepareForFastTeardown() {
+    ExecutionEnvironment::prepareForFastTeardown();
+    asyncEventsHandler.reset();
+}
+
 ClExecutionEnvironment::~ClExecutionEnvironment() {
-    asyncEventsHandler->closeThread();
+    if (asyncEventsHandler) {
+        asyncEventsHandler->closeThread();
+    }
 };
 } // namespace NEO
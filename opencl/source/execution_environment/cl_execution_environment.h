@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -17,6 +17,7 @@ class ClExecutionEnvironment : public ExecutionEnvironment {
     ClExecutionEnvironment();
     AsyncEventsHandler *getAsyncEventsHandler() const;
     ~ClExecutionEnvironment() override;
+    void prepareForFastTeardown() override;
 
   protected:
     std::unique_ptr<AsyncEventsHandler> asyncEventsHandler;
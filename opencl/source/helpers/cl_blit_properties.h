@@ -1,12 +1,15 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #pragma once
+#include "shared/source/execution_environment/execution_environment.h"
+#include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/blit_commands_helper.h"
+#include "shared/source/helpers/hw_helper.h"
 
 #include "opencl/source/built_ins/builtins_dispatch_builder.h"
 #include "opencl/source/mem_obj/image.h"
@@ -50,6 +53,26 @@ struct ClBlitProperties {
                                                                     builtinOpParams.dstRowPitch, builtinOpParams.dstSlicePitch, clearColorAllocation);
         }
 
+        if (BlitterConstants::BlitDirection::PatternToBuffer == blitDirection) {
+            auto dstAllocation = builtinOpParams.dstMemObj->getGraphicsAllocation(rootDeviceIndex);
+            auto dstGpuAddress = dstAllocation->getGpuAddress() + builtinOpParams.dstMemObj->getOffset() + builtinOpParams.dstOffset.x;
+
+            uint32_t fillPattern[4] = {};
+            memcpy_s(fillPattern, sizeof(fillPattern), builtinOpParams.srcPtr, builtinOpParams.patternSize);
+            auto &hwInfo = *commandStreamReceiver.peekExecutionEnvironment().rootDeviceEnvironments[rootDeviceIndex]->getHardwareInfo();
+            auto maxPatternSize = HwHelper::get(hwInfo.platform.eRenderCoreFamily).getMaxFillPaternSizeForCopyEngine();
+            auto fillPatternSize = BlitHelper::widenFillPattern(fillPattern, builtinOpParams.patternSize, dstGpuAddress, builtinOpParams.size.x, maxPatternSize);
+
+            return BlitProperties::constructPropertiesForColorFill(dstAllocation, dstGpuAddress, fillPattern, fillPatternSize,
+                                                                   builtinOpParams.size.x, clearColorAllocation);
+        }
+
+        if (BlitterConstants::BlitDirection::ImageToImage == blitDirection ||
+            BlitterConstants::BlitDirection::BufferToImage == blitDirection ||
+            BlitterConstants::BlitDirection::ImageToBuffer == blitDirection) {
+            return constructPropertiesForImageCopy(blitDirection, rootDeviceIndex, clearColorAllocation, builtinOpParams);
+        }
+
         BlitProperties blitProperties{};
         GraphicsAllocation *gpuAllocation = nullptr;
         Vec3<size_t> copyOffset = 0;
@@ -154,6 +177,14 @@ struct ClBlitProperties {
             return BlitterConstants::BlitDirection::HostPtrToImage;
         case CL_COMMAND_READ_IMAGE:
             return BlitterConstants::BlitDirection::ImageToHostPtr;
+        case CL_COMMAND_COPY_IMAGE:
+            return BlitterConstants::BlitDirection::ImageToImage;
+        case CL_COMMAND_COPY_BUFFER_TO_IMAGE:
+            return BlitterConstants::BlitDirection::BufferToImage;
+        case CL_COMMAND_COPY_IMAGE_TO_BUFFER:
+            return BlitterConstants::BlitDirection::ImageToBuffer;
+        case CL_COMMAND_FILL_BUFFER:
+            return BlitterConstants::BlitDirection::PatternToBuffer;
         default:
             UNRECOVERABLE_IF(true);
         }
@@ -192,6 +223,73 @@ struct ClBlitProperties {
         blitProperties.srcSlicePitch = builtinOpParams.dstSlicePitch ? builtinOpParams.dstSlicePitch : blitProperties.srcSize.y * blitProperties.srcRowPitch;
         blitProperties.dstSlicePitch = builtinOpParams.srcSlicePitch ? builtinOpParams.srcSlicePitch : blitProperties.dstSize.y * blitProperties.dstRowPitch;
     }
+
+    static BlitProperties constructPropertiesForImageCopy(BlitterConstants::BlitDirection blitDirection, uint32_t rootDeviceIndex,
+                                                          GraphicsAllocation *clearColorAllocation, const BuiltinOpParams &builtinOpParams) {
+        auto blitProperties = BlitProperties::constructPropertiesForCopyBuffer(builtinOpParams.dstMemObj->getGraphicsAllocation(rootDeviceIndex),
+                                                                               builtinOpParams.srcMemObj->getGraphicsAllocation(rootDeviceIndex),
+                                                                               builtinOpParams.dstOffset, builtinOpParams.srcOffset, builtinOpParams.size,
+                                                                               0, 0, 0, 0, clearColorAllocation);
+        blitProperties.blitDirection = blitDirection;
+
+        auto srcImage = castToObject<Image>(builtinOpParams.srcMemObj);
+        auto dstImage = castToObject<Image>(builtinOpParams.dstMemObj);
+        auto image = srcImage ? srcImage : dstImage;
+        blitProperties.bytesPerPixel = image->getSurfaceFormatInfo().surfaceFormat.ImageElementSizeInBytes;
+
+        if (srcImage) {
+            adjustBlitPropertiesForImageSurface(*srcImage, blitProperties.srcGpuAddress, blitProperties.srcSize,
+                                                blitProperties.srcRowPitch, blitProperties.srcSlicePitch);
+        } else {
+            adjustBlitPropertiesForBufferSurface(blitProperties, *builtinOpParams.srcMemObj, blitProperties.srcGpuAddress, blitProperties.srcOffset,
+                                                 blitProperties.srcSize, blitProperties.srcRowPitch, blitProperties.srcSlicePitch);
+        }
+
+        if (dstImage) {
+            adjustBlitPropertiesForImageSurface(*dstImage, blitProperties.dstGpuAddress, blitProperties.dstSize,
+                                                blitProperties.dstRowPitch, blitProperties.dstSlicePitch);
+        } else {
+            adjustBlitPropertiesForBufferSurface(blitProperties, *builtinOpParams.dstMemObj, blitProperties.dstGpuAddress, blitProperties.dstOffset,
+                                                 blitProperties.dstSize, blitProperties.dstRowPitch, blitProperties.dstSlicePitch);
+        }
+
+        return blitProperties;
+    }
+
+    static void adjustBlitPropertiesForImageSurface(Image &image, uint64_t &gpuAddress, Vec3<uint32_t> &size, size_t &rowPitch, size_t &slicePitch) {
+        // planes of planar formats and images created from buffers start at an offset within the allocation
+        SurfaceOffsets surfaceOffsets;
+        image.getSurfaceOffsets(surfaceOffsets);
+        gpuAddress += surfaceOffsets.offset;
+
+        const auto &imageDesc = image.getImageDesc();
+        size.x = static_cast<uint32_t>(imageDesc.image_width);
+        size.y = static_cast<uint32_t>(imageDesc.image_height ? imageDesc.image_height : 1);
+        size.z = static_cast<uint32_t>(imageDesc.image_depth ? imageDesc.image_depth : 1);
+        rowPitch = imageDesc.image_row_pitch;
+        slicePitch = imageDesc.image_slice_pitch;
+
+        if (imageDesc.image_type == CL_MEM_OBJECT_IMAGE1D_ARRAY) {
+            // layers of 1D arrays are copied as rows
+            size.y = static_cast<uint32_t>(imageDesc.image_array_size);
+            rowPitch = slicePitch;
+        } else if (imageDesc.image_type == CL_MEM_OBJECT_IMAGE2D_ARRAY) {
+            size.z = static_cast<uint32_t>(imageDesc.image_array_size);
+        }
+    }
+
+    static void adjustBlitPropertiesForBufferSurface(const BlitProperties &blitProperties, MemObj &buffer, uint64_t &gpuAddress, Vec3<size_t> &offset,
+                                                     Vec3<uint32_t> &size, size_t &rowPitch, size_t &slicePitch) {
+        // the buffer holds the region tightly packed, starting at a byte offset
+        gpuAddress += buffer.getOffset() + offset.x;
+        offset = 0;
+
+        size = {static_cast<uint32_t>(blitProperties.copySize.x),
+                static_cast<uint32_t>(blitProperties.copySize.y),
+                static_cast<uint32_t>(blitProperties.copySize.z)};
+        rowPitch = blitProperties.copySize.x * blitProperties.bytesPerPixel;
+        slicePitch = rowPitch * blitProperties.copySize.y;
+    }
 };
 
 } // namespace NEO
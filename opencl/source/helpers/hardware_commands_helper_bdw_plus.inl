@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,8 @@
 
 #pragma once
 #include "shared/source/helpers/hw_helper.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/helpers/string.h"
 
 #include "opencl/source/helpers/hardware_commands_helper.h"
 #include "opencl/source/kernel/kernel.h"
@@ -106,6 +108,7 @@ void HardwareCommandsHelper<GfxFamily>::programPerThreadData(
     uint32_t rootDeviceIndex) {
 
     uint32_t grfSize = sizeof(typename GfxFamily::GRF);
+    const auto &workgroupDimensionsOrder = kernel.getKernelInfo(rootDeviceIndex).kernelDescriptor.kernelAttributes.workgroupDimensionsOrder;
 
     sendPerThreadData(
         ioh,
@@ -113,10 +116,9 @@ void HardwareCommandsHelper<GfxFamily>::programPerThreadData(
         grfSize,
         numChannels,
         std::array<uint16_t, 3>{{static_cast<uint16_t>(localWorkSize[0]), static_cast<uint16_t>(localWorkSize[1]), static_cast<uint16_t>(localWorkSize[2])}},
-        std::array<uint8_t, 3>{{kernel.getKernelInfo(rootDeviceIndex).kernelDescriptor.kernelAttributes.workgroupDimensionsOrder[0],
-                                kernel.getKernelInfo(rootDeviceIndex).kernelDescriptor.kernelAttributes.workgroupDimensionsOrder[1],
-                                kernel.getKernelInfo(rootDeviceIndex).kernelDescriptor.kernelAttributes.workgroupDimensionsOrder[2]}},
-        kernel.usesOnlyImages());
+        std::array<uint8_t, 3>{{workgroupDimensionsOrder[0], workgroupDimensionsOrder[1], workgroupDimensionsOrder[2]}},
+        kernel.usesOnlyImages(),
+        &kernel.getProgram()->getLocalIdsCache());
 
     updatePerThreadDataTotal(sizePerThreadData, simd, numChannels, sizePerThreadDataTotal, localWorkItems);
 }
@@ -8,12 +8,35 @@
 #include "opencl/source/helpers/per_thread_data.h"
 
 #include "shared/source/command_stream/linear_stream.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/string.h"
 
+#include <algorithm>
 #include <array>
 
 namespace NEO {
 
+bool LocalIdsCache::copyLocalIds(const Key &key, void *destination, size_t size) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto entry = std::find_if(entries.begin(), entries.end(), [&key](const Entry &cached) { return cached.key == key; });
+    if (entry == entries.end() || entry->localIds.size() != size) {
+        return false;
+    }
+    memcpy_s(destination, size, entry->localIds.data(), size);
+    std::rotate(entries.begin(), entry, entry + 1);
+    return true;
+}
+
+void LocalIdsCache::storeLocalIds(const Key &key, const void *localIds, size_t size) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (entries.size() == maxEntries) {
+        entries.pop_back();
+    }
+    auto data = static_cast<const uint8_t *>(localIds);
+    entries.insert(entries.begin(), Entry{key, std::vector<uint8_t>(data, data + size)});
+}
+
 size_t PerThreadDataHelper::sendPerThreadData(
     LinearStream &indirectHeap,
     uint32_t simd,
@@ -21,16 +44,28 @@ size_t PerThreadDataHelper::sendPerThreadData(
     uint32_t numChannels,
     const std::array<uint16_t, 3> &localWorkSizes,
     const std::array<uint8_t, 3> &workgroupWalkOrder,
-    bool hasKernelOnlyImages) {
+    bool hasKernelOnlyImages,
+    LocalIdsCache *localIdsCache) {
     auto offsetPerThreadData = indirectHeap.getUsed();
     if (numChannels) {
         size_t localWorkSize = static_cast<size_t>(localWorkSizes[0]) * static_cast<size_t>(localWorkSizes[1]) * static_cast<size_t>(localWorkSizes[2]);
         auto sizePerThreadDataTotal = getPerThreadDataSizeTotal(simd, grfSize, numChannels, localWorkSize);
         auto pDest = indirectHeap.getSpace(sizePerThreadDataTotal);
 
+        LocalIdsCache::Key key = {{localWorkSizes[0], localWorkSizes[1], localWorkSizes[2], simd, grfSize, numChannels,
+                                   workgroupWalkOrder[0], workgroupWalkOrder[1], workgroupWalkOrder[2], hasKernelOnlyImages}};
+        bool useCache = localIdsCache != nullptr && DebugManager.flags.EnableLocalIdsCache.get() != 0;
+        if (useCache && localIdsCache->copyLocalIds(key, pDest, sizePerThreadDataTotal)) {
+            return offsetPerThreadData;
+        }
+
         // Generate local IDs
         DEBUG_BREAK_IF(numChannels != 3);
         generateLocalIDs(pDest, static_cast<uint16_t>(simd), localWorkSizes, workgroupWalkOrder, hasKernelOnlyImages, grfSize);
+
+        if (useCache) {
+            localIdsCache->storeLocalIds(key, pDest, sizePerThreadDataTotal);
+        }
     }
     return offsetPerThreadData;
 }
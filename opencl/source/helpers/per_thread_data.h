@@ -14,10 +14,32 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <mutex>
+#include <vector>
 
 namespace NEO {
 class LinearStream;
 
+// local ids generated for recently dispatched work group shapes, most recently used first
+class LocalIdsCache {
+  public:
+    // local work sizes, simd, GRF size, channels, walk order and images only layout
+    using Key = std::array<uint32_t, 10>;
+
+    bool copyLocalIds(const Key &key, void *destination, size_t size);
+    void storeLocalIds(const Key &key, const void *localIds, size_t size);
+
+    static constexpr size_t maxEntries = 8u;
+
+  protected:
+    struct Entry {
+        Key key;
+        std::vector<uint8_t> localIds;
+    };
+    std::vector<Entry> entries;
+    std::mutex mutex;
+};
+
 struct PerThreadDataHelper {
     static inline uint32_t getLocalIdSizePerThread(
         uint32_t simd,
@@ -41,7 +63,8 @@ struct PerThreadDataHelper {
         uint32_t numChannels,
         const std::array<uint16_t, 3> &localWorkSizes,
         const std::array<uint8_t, 3> &workgroupWalkOrder,
-        bool hasKernelOnlyImages);
+        bool hasKernelOnlyImages,
+        LocalIdsCache *localIdsCache = nullptr);
 
     static uint32_t getThreadPayloadSize(const KernelDescriptor &kernelDescriptor, uint32_t grfSize);
 };
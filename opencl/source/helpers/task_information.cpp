@@ -15,7 +15,9 @@
 #include "shared/source/helpers/engine_node_helper.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
+#include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/surface.h"
+#include "shared/source/utilities/cpuintrinsics.h"
 
 #include "opencl/source/built_ins/builtins_dispatch_builder.h"
 #include "opencl/source/cl_device/cl_device.h"
@@ -31,9 +33,9 @@ namespace NEO {
 template void KernelOperation::ResourceCleaner::operator()<LinearStream>(LinearStream *);
 template void KernelOperation::ResourceCleaner::operator()<IndirectHeap>(IndirectHeap *);
 
-CommandMapUnmap::CommandMapUnmap(MapOperationType operationType, MemObj &memObj, MemObjSizeArray &copySize, MemObjOffsetArray &copyOffset, bool readOnly,
+CommandMapUnmap::CommandMapUnmap(MapOperationType operationType, MemObj &memObj, MemObjSizeArray &copySize, MemObjOffsetArray &copyOffset, bool skipTransfer,
                                  CommandQueue &commandQueue)
-    : Command(commandQueue), memObj(memObj), copySize(copySize), copyOffset(copyOffset), readOnly(readOnly), operationType(operationType) {
+    : Command(commandQueue), memObj(memObj), copySize(copySize), copyOffset(copyOffset), skipTransfer(skipTransfer), operationType(operationType) {
     memObj.incRefInternal();
 }
 
@@ -43,12 +45,20 @@ CompletionStamp &CommandMapUnmap::submit(uint32_t taskLevel, bool terminated) {
         return completionStamp;
     }
 
+    Device &device = commandQueue.getDevice();
+    // a directly mapped object has no host copy to keep in sync
+    bool directMapping = memObj.lockForDirectMapping(device.getRootDeviceIndex()) != nullptr;
+    if (directMapping && operationType == UNMAP && !skipTransfer) {
+        // same as an unblocked unmap, registered before this submission so its flushTask emits the flush as well
+        CpuIntrinsics::sfence();
+        device.getMemoryManager()->registerFullCacheFlushOnAllEngines(device.getRootDeviceIndex());
+    }
+
     auto &commandStreamReceiver = commandQueue.getGpgpuCommandStreamReceiver();
     auto commandStreamReceiverOwnership = commandStreamReceiver.obtainUniqueOwnership();
     auto &queueCommandStream = commandQueue.getCS(0);
     size_t offset = queueCommandStream.getUsed();
     MultiDispatchInfo multiDispatch;
-    Device &device = commandQueue.getDevice();
 
     DispatchFlags dispatchFlags(
         {},                                                                          //csrDependencies
@@ -94,13 +104,15 @@ CompletionStamp &CommandMapUnmap::submit(uint32_t taskLevel, bool terminated) {
 
     commandQueue.updateLatestSentEnqueueType(EnqueueProperties::Operation::DependencyResolveOnGpu);
 
-    if (!memObj.isMemObjZeroCopy()) {
+    if (!memObj.isMemObjZeroCopy() && completionStamp.taskCount != CompletionStamp::failed) {
         commandQueue.waitUntilComplete(completionStamp.taskCount, commandQueue.peekBcsTaskCount(), completionStamp.flushStamp, false);
-        if (operationType == MAP) {
-            memObj.transferDataToHostPtr(copySize, copyOffset);
-        } else if (!readOnly) {
-            DEBUG_BREAK_IF(operationType != UNMAP);
-            memObj.transferDataFromHostPtr(copySize, copyOffset);
+        if (!directMapping && !skipTransfer) {
+            if (operationType == MAP) {
+                memObj.transferDataToHostPtr(copySize, copyOffset);
+            } else {
+                DEBUG_BREAK_IF(operationType != UNMAP);
+                memObj.transferDataFromHostPtr(copySize, copyOffset);
+            }
         }
     }
 
@@ -285,7 +297,7 @@ CompletionStamp &CommandComputeKernel::submit(uint32_t taskLevel, bool terminate
         gtpinNotifyFlushTask(completionStamp.taskCount);
     }
 
-    if (printfHandler) {
+    if (printfHandler && completionStamp.taskCount != CompletionStamp::failed) {
         commandQueue.waitUntilComplete(completionStamp.taskCount, commandQueue.peekBcsTaskCount(), completionStamp.flushStamp, false);
         printfHandler.get()->printEnqueueOutput();
     }
@@ -440,6 +452,7 @@ void Command::makeTimestampPacketsResident(CommandStreamReceiver &commandStreamR
     if (timestampPacketDependencies) {
         timestampPacketDependencies->cacheFlushNodes.makeResident(commandStreamReceiver);
         timestampPacketDependencies->previousEnqueueNodes.makeResident(commandStreamReceiver);
+        timestampPacketDependencies->crossEngineNodes.makeResident(commandStreamReceiver);
     }
 }
 
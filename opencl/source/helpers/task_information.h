@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -113,7 +113,7 @@ class Command : public IFNode<Command> {
 
 class CommandMapUnmap : public Command {
   public:
-    CommandMapUnmap(MapOperationType operationType, MemObj &memObj, MemObjSizeArray &copySize, MemObjOffsetArray &copyOffset, bool readOnly,
+    CommandMapUnmap(MapOperationType operationType, MemObj &memObj, MemObjSizeArray &copySize, MemObjOffsetArray &copyOffset, bool skipTransfer,
                     CommandQueue &commandQueue);
     ~CommandMapUnmap() override = default;
     CompletionStamp &submit(uint32_t taskLevel, bool terminated) override;
@@ -122,7 +122,8 @@ class CommandMapUnmap : public Command {
     MemObj &memObj;
     MemObjSizeArray copySize;
     MemObjOffsetArray copyOffset;
-    bool readOnly;
+    // read only unmap or write invalidate map, the data does not have to be copied
+    bool skipTransfer;
     MapOperationType operationType;
 };
 
@@ -154,5 +155,7 @@ class CommandWithoutKernel : public Command {
     using Command::Command;
     CompletionStamp &submit(uint32_t taskLevel, bool terminated) override;
     void dispatchBlitOperation();
+
+    LinearStream *getCommandStream() override { return kernelOperation ? kernelOperation->commandStream.get() : nullptr; }
 };
 } // namespace NEO
@@ -15,6 +15,7 @@
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/api_specific_config.h"
 #include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/bit_helpers.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/get_info.h"
 #include "shared/source/helpers/hw_helper.h"
@@ -398,53 +399,61 @@ cl_int Kernel::initialize() {
                                      kernelInfo.kernelDescriptor.kernelAttributes.hasNonKernelArgAtomic;
 
     provideInitializationHints();
-    // resolve the new kernel info to account for kernel handlers
-    // I think by this time we have decoded the binary and know the number of args etc.
-    // double check this assumption
-    bool usingBuffers = false;
-    bool usingImages = false;
-    auto &defaultKernelInfo = getDefaultKernelInfo();
-    kernelArguments.resize(numArgs);
-    kernelArgHandlers.resize(numArgs);
+    auto argsTemplate = getDefaultKernelInfo().argsTemplate;
+    if (argsTemplate == nullptr) {
+        argsTemplate = createArgsTemplate(getDefaultKernelInfo());
+    }
+    kernelArguments = argsTemplate->kernelArguments;
+    kernelArgHandlers = argsTemplate->kernelArgHandlers;
     kernelArgRequiresCacheFlush.resize(numArgs);
+    allBufferArgsStateful &= argsTemplate->allBufferArgsStateful;
+    if (argsTemplate->usingImagesOnly) {
+        usingImagesOnly = true;
+    }
 
-    for (uint32_t i = 0; i < numArgs; ++i) {
-        storeKernelArg(i, NONE_OBJ, nullptr, nullptr, 0);
+    return CL_SUCCESS;
+}
 
-        // set the argument handler
-        auto &argInfo = defaultKernelInfo.kernelArgInfo[i];
+std::shared_ptr<const KernelArgsTemplate> Kernel::createArgsTemplate(const KernelInfo &kernelInfo) {
+    auto argsTemplate = std::make_shared<KernelArgsTemplate>();
+    auto numArgs = kernelInfo.kernelArgInfo.size();
+    argsTemplate->kernelArguments.resize(numArgs, {NONE_OBJ, nullptr, nullptr, 0, nullptr, 0});
+    argsTemplate->kernelArgHandlers.resize(numArgs);
+
+    bool usingBuffers = false;
+    bool usingImages = false;
+    for (uint32_t i = 0; i < numArgs; ++i) {
+        auto &argInfo = kernelInfo.kernelArgInfo[i];
+        auto &handler = argsTemplate->kernelArgHandlers[i];
+        auto &argType = argsTemplate->kernelArguments[i].type;
         if (argInfo.metadata.addressQualifier == KernelArgMetadata::AddrLocal) {
-            kernelArgHandlers[i] = &Kernel::setArgLocal;
+            handler = &Kernel::setArgLocal;
         } else if (argInfo.isAccelerator) {
-            kernelArgHandlers[i] = &Kernel::setArgAccelerator;
+            handler = &Kernel::setArgAccelerator;
         } else if (argInfo.metadata.typeQualifiers.pipeQual) {
-            kernelArgHandlers[i] = &Kernel::setArgPipe;
-            kernelArguments[i].type = PIPE_OBJ;
+            handler = &Kernel::setArgPipe;
+            argType = PIPE_OBJ;
         } else if (argInfo.isImage) {
-            kernelArgHandlers[i] = &Kernel::setArgImage;
-            kernelArguments[i].type = IMAGE_OBJ;
+            handler = &Kernel::setArgImage;
+            argType = IMAGE_OBJ;
             usingImages = true;
         } else if (argInfo.isSampler) {
-            kernelArgHandlers[i] = &Kernel::setArgSampler;
-            kernelArguments[i].type = SAMPLER_OBJ;
+            handler = &Kernel::setArgSampler;
+            argType = SAMPLER_OBJ;
         } else if (argInfo.isBuffer) {
-            kernelArgHandlers[i] = &Kernel::setArgBuffer;
-            kernelArguments[i].type = BUFFER_OBJ;
+            handler = &Kernel::setArgBuffer;
+            argType = BUFFER_OBJ;
             usingBuffers = true;
-            allBufferArgsStateful &= static_cast<uint32_t>(argInfo.pureStatefulBufferAccess);
+            argsTemplate->allBufferArgsStateful &= static_cast<uint32_t>(argInfo.pureStatefulBufferAccess);
         } else if (argInfo.isDeviceQueue) {
-            kernelArgHandlers[i] = &Kernel::setArgDevQueue;
-            kernelArguments[i].type = DEVICE_QUEUE_OBJ;
+            handler = &Kernel::setArgDevQueue;
+            argType = DEVICE_QUEUE_OBJ;
         } else {
-            kernelArgHandlers[i] = &Kernel::setArgImmediate;
+            handler = &Kernel::setArgImmediate;
         }
     }
-
-    if (usingImages && !usingBuffers) {
-        usingImagesOnly = true;
-    }
-
-    return CL_SUCCESS;
+    argsTemplate->usingImagesOnly = usingImages && !usingBuffers;
+    return argsTemplate;
 }
 
 cl_int Kernel::cloneKernel(Kernel *pSourceKernel) {
@@ -1169,16 +1178,33 @@ inline void Kernel::makeArgsResident(CommandStreamReceiver &commandStreamReceive
                 if (image && image->isImageFromImage()) {
                     commandStreamReceiver.setSamplerCacheFlushRequired(CommandStreamReceiver::SamplerCacheFlushState::samplerCacheFlushBefore);
                 }
-                memObj->getMigrateableMultiGraphicsAllocation().ensureMemoryOnDevice(*executionEnvironment.memoryManager, commandStreamReceiver.getRootDeviceIndex());
+                memObj->ensureMemoryOnDevice(*executionEnvironment.memoryManager, commandStreamReceiver.getRootDeviceIndex());
                 commandStreamReceiver.makeResident(*memObj->getGraphicsAllocation(commandStreamReceiver.getRootDeviceIndex()));
                 if (memObj->getMcsAllocation()) {
                     commandStreamReceiver.makeResident(*memObj->getMcsAllocation());
                 }
             }
+        } else if (auto systemAllocation = getSystemAllocationForArg(argIndex, commandStreamReceiver.getRootDeviceIndex())) {
+            commandStreamReceiver.makeResident(*systemAllocation);
         }
     }
 }
 
+GraphicsAllocation *Kernel::getSystemAllocationForArg(uint32_t argIndex, uint32_t rootDeviceIndex) {
+    // shared system pointers have no allocation of their own, the range around them is bound when the kernel is submitted
+    if (kernelArguments[argIndex].type != SVM_ALLOC_OBJ || kernelArguments[argIndex].value == nullptr ||
+        !getDevice().areSharedSystemAllocationsAllowed() || program->getContextPtr() == nullptr) {
+        return nullptr;
+    }
+    auto svmAllocsManager = getContext().getSVMAllocsManager();
+    if (svmAllocsManager == nullptr) {
+        return nullptr;
+    }
+    auto systemAllocation = svmAllocsManager->getSystemAllocationForGpuAccess(kernelArguments[argIndex].value, rootDeviceIndex, getDevice().getDeviceBitfield());
+    DEBUG_BREAK_IF(systemAllocation == nullptr);
+    return systemAllocation;
+}
+
 void Kernel::performKernelTunning(CommandStreamReceiver &commandStreamReceiver, const Vec3<size_t> &lws, const Vec3<size_t> &gws, const Vec3<size_t> &offsets, TimestampPacketContainer *timestampContainer) {
     auto performTunning = TunningType::DISABLED;
 
@@ -1350,6 +1376,8 @@ void Kernel::getResidency(std::vector<Surface *> &dst, uint32_t rootDeviceIndex)
                 DEBUG_BREAK_IF(memObj == nullptr);
                 dst.push_back(new MemObjSurface(memObj));
             }
+        } else if (auto systemAllocation = getSystemAllocationForArg(argIndex, rootDeviceIndex)) {
+            dst.push_back(new GeneralSurface(systemAllocation));
         }
     }
 
@@ -1447,6 +1475,7 @@ cl_int Kernel::setArgBuffer(uint32_t argIndex,
         auto clMemObj = *clMem;
         DBG_LOG_INPUTS("setArgBuffer cl_mem", clMemObj);
 
+        bool sameBufferAsBefore = (kernelArguments[argIndex].type == BUFFER_OBJ) && (kernelArguments[argIndex].object == clMemObj);
         storeKernelArg(argIndex, BUFFER_OBJ, clMemObj, argVal, argSize);
 
         auto buffer = castToObject<Buffer>(clMemObj);
@@ -1457,6 +1486,9 @@ cl_int Kernel::setArgBuffer(uint32_t argIndex,
             usingSharedObjArgs = true;
         }
         const auto &kernelArgInfo = getKernelInfo(rootDeviceIndex).kernelArgInfo[argIndex];
+        if (buffer->createLazyBacking(rootDeviceIndex) != CL_SUCCESS) {
+            return CL_OUT_OF_RESOURCES;
+        }
         patchBufferOffset(kernelArgInfo, nullptr, nullptr, rootDeviceIndex);
         auto graphicsAllocation = buffer->getGraphicsAllocation(rootDeviceIndex);
 
@@ -1491,9 +1523,31 @@ cl_int Kernel::setArgBuffer(uint32_t argIndex,
         }
 
         if (requiresSshForBuffers(rootDeviceIndex)) {
-            auto surfaceState = ptrOffset(getSurfaceStateHeap(rootDeviceIndex), kernelArgInfo.offsetHeap);
-            buffer->setArgStateful(surfaceState, forceNonAuxMode, disableL3, isAuxTranslationKernel, kernelArgInfo.isReadOnly, pClDevice->getDevice(),
-                                   getDefaultKernelInfo().kernelDescriptor.kernelAttributes.flags.useGlobalAtomics, getTotalNumDevicesInContext());
+            // surface state already in the SSH stays valid while the buffer and the state derived from the kernel do not change,
+            // args do not retain the cl_mem, so a buffer recreated at the same address is told apart by its size and flags
+            auto &argument = kernelArguments[argIndex];
+            auto surfaceStateGpuAddress = graphicsAllocation->getGpuAddress() + buffer->getOffset();
+            uint32_t surfaceStateFlags = (forceNonAuxMode ? 1u : 0u) | (disableL3 ? 2u : 0u) | (isAuxTranslationKernel ? 4u : 0u);
+            bool surfaceStateCached = sameBufferAsBefore && !buffer->peekSharingHandler() &&
+                                      DebugManager.flags.EnableKernelArgSurfaceStateCache.get() != 0 &&
+                                      argument.surfaceStateAllocation == graphicsAllocation &&
+                                      argument.surfaceStateGpuAddress == surfaceStateGpuAddress &&
+                                      argument.surfaceStateSize == buffer->getSize() &&
+                                      argument.surfaceStateMemFlags == buffer->getFlags() &&
+                                      argument.surfaceStateMemFlagsIntel == buffer->getFlagsIntel() &&
+                                      argument.surfaceStateFlags == surfaceStateFlags;
+
+            if (!surfaceStateCached) {
+                auto surfaceState = ptrOffset(getSurfaceStateHeap(rootDeviceIndex), kernelArgInfo.offsetHeap);
+                buffer->setArgStateful(surfaceState, forceNonAuxMode, disableL3, isAuxTranslationKernel, kernelArgInfo.isReadOnly, pClDevice->getDevice(),
+                                       getDefaultKernelInfo().kernelDescriptor.kernelAttributes.flags.useGlobalAtomics, getTotalNumDevicesInContext());
+                argument.surfaceStateAllocation = graphicsAllocation;
+                argument.surfaceStateGpuAddress = surfaceStateGpuAddress;
+                argument.surfaceStateSize = buffer->getSize();
+                argument.surfaceStateMemFlags = buffer->getFlags();
+                argument.surfaceStateMemFlagsIntel = buffer->getFlagsIntel();
+                argument.surfaceStateFlags = surfaceStateFlags;
+            }
         }
 
         kernelArguments[argIndex].isStatelessUncacheable = kernelArgInfo.pureStatefulBufferAccess ? false : buffer->isMemObjUncacheable();
@@ -2550,7 +2604,9 @@ void Kernel::fillWithKernelObjsForAuxTranslation(KernelObjsForAuxTranslation &ke
         if (BUFFER_OBJ == kernelArguments.at(i).type && !kernelInfo.kernelArgInfo.at(i).pureStatefulBufferAccess) {
             auto buffer = castToObject<Buffer>(getKernelArg(i));
             if (buffer && buffer->getMultiGraphicsAllocation().getAllocationType() == GraphicsAllocation::AllocationType::BUFFER_COMPRESSED) {
-                kernelObjsForAuxTranslation.insert({KernelObjForAuxTranslation::Type::MEM_OBJ, buffer});
+                bool readOnly = kernelInfo.kernelArgInfo.at(i).isReadOnly || isValueSet(buffer->getFlags(), CL_MEM_READ_ONLY);
+                auto kernelObj = kernelObjsForAuxTranslation.insert({KernelObjForAuxTranslation::Type::MEM_OBJ, buffer, readOnly});
+                kernelObj.first->readOnly &= readOnly;
                 auto &context = this->program->getContext();
                 if (context.isProvidingPerformanceHints()) {
                     context.providePerformanceHint(CL_CONTEXT_DIAGNOSTICS_LEVEL_BAD_INTEL, KERNEL_ARGUMENT_AUX_TRANSLATION,
@@ -2561,7 +2617,9 @@ void Kernel::fillWithKernelObjsForAuxTranslation(KernelObjsForAuxTranslation &ke
         if (SVM_ALLOC_OBJ == getKernelArguments().at(i).type && !kernelInfo.kernelArgInfo.at(i).pureStatefulBufferAccess) {
             auto svmAlloc = reinterpret_cast<GraphicsAllocation *>(const_cast<void *>(getKernelArg(i)));
             if (svmAlloc && svmAlloc->getAllocationType() == GraphicsAllocation::AllocationType::BUFFER_COMPRESSED) {
-                kernelObjsForAuxTranslation.insert({KernelObjForAuxTranslation::Type::GFX_ALLOC, svmAlloc});
+                bool readOnly = kernelInfo.kernelArgInfo.at(i).isReadOnly;
+                auto kernelObj = kernelObjsForAuxTranslation.insert({KernelObjForAuxTranslation::Type::GFX_ALLOC, svmAlloc, readOnly});
+                kernelObj.first->readOnly &= readOnly;
                 auto &context = this->program->getContext();
                 if (context.isProvidingPerformanceHints()) {
                     context.providePerformanceHint(CL_CONTEXT_DIAGNOSTICS_LEVEL_BAD_INTEL, KERNEL_ARGUMENT_AUX_TRANSLATION,
@@ -2572,6 +2630,45 @@ void Kernel::fillWithKernelObjsForAuxTranslation(KernelObjsForAuxTranslation &ke
     }
 }
 
+void Kernel::resetAuxResolvedStateOfArgs(uint32_t rootDeviceIndex) {
+    // arguments accessed through compressed surface states may be written compressed again,
+    // only the ones translated around this kernel stay resolved
+    auto &kernelInfo = getKernelInfo(rootDeviceIndex);
+    for (uint32_t i = 0; i < getKernelArgsNumber(); i++) {
+        if (auxTranslationRequired && !kernelInfo.kernelArgInfo.at(i).pureStatefulBufferAccess) {
+            continue;
+        }
+        GraphicsAllocation *allocation = nullptr;
+        if (BUFFER_OBJ == kernelArguments.at(i).type) {
+            auto buffer = castToObject<Buffer>(getKernelArg(i));
+            allocation = buffer ? buffer->getGraphicsAllocation(rootDeviceIndex) : nullptr;
+        } else if (SVM_ALLOC_OBJ == kernelArguments.at(i).type) {
+            allocation = reinterpret_cast<GraphicsAllocation *>(const_cast<void *>(getKernelArg(i)));
+        }
+        if (allocation && allocation->isAuxResolved()) {
+            allocation->setAuxResolved(false);
+        }
+    }
+}
+
+void Kernel::updateCompressionUsageOfArgs(uint32_t rootDeviceIndex) {
+    auto &kernelInfo = getKernelInfo(rootDeviceIndex);
+    for (uint32_t i = 0; i < getKernelArgsNumber(); i++) {
+        if (BUFFER_OBJ != kernelArguments.at(i).type) {
+            continue;
+        }
+        auto buffer = castToObject<Buffer>(getKernelArg(i));
+        if (!buffer) {
+            continue;
+        }
+        if (kernelInfo.kernelArgInfo.at(i).pureStatefulBufferAccess) {
+            buffer->getCompressionUsage().statefulAccesses++;
+        } else {
+            buffer->getCompressionUsage().statelessAccesses++;
+        }
+    }
+}
+
 bool Kernel::hasDirectStatelessAccessToHostMemory() const {
     for (uint32_t i = 0; i < getKernelArgsNumber(); i++) {
         if (BUFFER_OBJ == kernelArguments.at(i).type && !getDefaultKernelInfo().kernelArgInfo.at(i).pureStatefulBufferAccess) {
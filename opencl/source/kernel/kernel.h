@@ -29,6 +29,10 @@
 
 #include "csr_properties_flags.h"
 
+#include <array>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 namespace NEO {
@@ -69,6 +73,12 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
         cl_mem_flags svmFlags;
         bool isPatched = false;
         bool isStatelessUncacheable = false;
+        GraphicsAllocation *surfaceStateAllocation = nullptr;
+        uint64_t surfaceStateGpuAddress = 0u;
+        size_t surfaceStateSize = 0u;
+        cl_mem_flags surfaceStateMemFlags = 0u;
+        cl_mem_flags surfaceStateMemFlagsIntel = 0u;
+        uint32_t surfaceStateFlags = 0u;
     };
 
     enum class TunningStatus {
@@ -113,11 +123,20 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
         return pKernel;
     }
 
+    // resolves argument handlers and types once per KernelInfo, so kernels created from it only copy them
+    static std::shared_ptr<const KernelArgsTemplate> createArgsTemplate(const KernelInfo &kernelInfo);
+
     Kernel &operator=(const Kernel &) = delete;
     Kernel(const Kernel &) = delete;
 
     virtual ~Kernel();
 
+    // walker of the previous dispatch, reused as long as the inputs stored in the key do not change
+    struct DispatchTemplate {
+        std::array<size_t, 14> walkerKey = {};
+        std::vector<uint8_t> walker;
+    };
+
     static bool isMemObj(kernelArgType kernelArg) {
         return kernelArg == BUFFER_OBJ || kernelArg == IMAGE_OBJ || kernelArg == PIPE_OBJ;
     }
@@ -126,6 +145,23 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
     void setAuxTranslationRequired(bool onOff) { auxTranslationRequired = onOff; }
     void updateAuxTranslationRequired();
 
+    DispatchTemplate &getDispatchTemplate(uint32_t rootDeviceIndex) {
+        return kernelDeviceInfos[rootDeviceIndex].dispatchTemplate;
+    }
+    // queues may dispatch the same kernel concurrently, so templates are accessed under this lock
+    std::mutex &getDispatchTemplateMutex() {
+        return dispatchTemplateMutex;
+    }
+
+    // local work sizes deduced for previous enqueues, keyed on every input of the deduction
+    using LocalWorkSizeKey = std::array<size_t, 8>;
+    std::map<LocalWorkSizeKey, Vec3<size_t>> &getLocalWorkSizeCache(uint32_t rootDeviceIndex) {
+        return kernelDeviceInfos[rootDeviceIndex].localWorkSizeCache;
+    }
+    std::mutex &getLocalWorkSizeCacheMutex() {
+        return localWorkSizeCacheMutex;
+    }
+
     char *getCrossThreadData(uint32_t rootDeviceIndex) const {
         return kernelDeviceInfos[rootDeviceIndex].crossThreadData;
     }
@@ -348,6 +384,8 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
     }
 
     void fillWithKernelObjsForAuxTranslation(KernelObjsForAuxTranslation &kernelObjsForAuxTranslation, uint32_t rootDeviceIndex);
+    void resetAuxResolvedStateOfArgs(uint32_t rootDeviceIndex);
+    void updateCompressionUsageOfArgs(uint32_t rootDeviceIndex);
 
     MOCKABLE_VIRTUAL bool requiresCacheFlushCommand(const CommandQueue &commandQueue) const;
 
@@ -481,6 +519,7 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
 
     void
     makeArgsResident(CommandStreamReceiver &commandStreamReceiver);
+    GraphicsAllocation *getSystemAllocationForArg(uint32_t argIndex, uint32_t rootDeviceIndex);
 
     void *patchBufferOffset(const KernelArgInfo &argInfo, void *svmPtr, GraphicsAllocation *svmAlloc, uint32_t rootDeviceIndex);
 
@@ -591,8 +630,13 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
 
         GraphicsAllocation *privateSurface = nullptr;
         uint64_t privateSurfaceSize = 0u;
+
+        DispatchTemplate dispatchTemplate;
+        std::map<LocalWorkSizeKey, Vec3<size_t>> localWorkSizeCache;
     };
     std::vector<KernelDeviceInfo> kernelDeviceInfos;
+    std::mutex dispatchTemplateMutex;
+    std::mutex localWorkSizeCacheMutex;
     const uint32_t defaultRootDeviceIndex;
 
     struct KernelConfig {
@@ -640,4 +684,11 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
     MultiDeviceKernel *pMultiDeviceKernel = nullptr;
 };
 
+struct KernelArgsTemplate {
+    std::vector<Kernel::SimpleKernelArgInfo> kernelArguments;
+    std::vector<Kernel::KernelArgHandler> kernelArgHandlers;
+    uint32_t allBufferArgsStateful = CL_TRUE;
+    bool usingImagesOnly = false;
+};
+
 } // namespace NEO
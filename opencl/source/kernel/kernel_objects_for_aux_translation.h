@@ -18,9 +18,12 @@ struct KernelObjForAuxTranslation {
     };
 
     KernelObjForAuxTranslation(Type type, void *object) : type(type), object(object) {}
+    KernelObjForAuxTranslation(Type type, void *object, bool readOnly) : type(type), object(object), readOnly(readOnly) {}
 
     Type type;
     void *object;
+    // not part of the identity: an object passed as several arguments is read only when all of them are
+    mutable bool readOnly = false;
 
     bool operator==(const KernelObjForAuxTranslation &t) const {
         return (this->object == t.object);
@@ -62,7 +62,10 @@ cl_int MultiDeviceKernel::cloneKernel(MultiDeviceKernel *pSourceMultiDeviceKerne
         auto pSrcKernel = pSourceMultiDeviceKernel->getKernel(rootDeviceIndex);
         auto pDstKernel = getKernel(rootDeviceIndex);
         if (pSrcKernel) {
-            pDstKernel->cloneKernel(pSrcKernel);
+            auto retVal = pDstKernel->cloneKernel(pSrcKernel);
+            if (retVal != CL_SUCCESS) {
+                return retVal;
+            }
         }
     }
     return CL_SUCCESS;
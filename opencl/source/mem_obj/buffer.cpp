@@ -71,7 +71,23 @@ Buffer::Buffer(Context *context,
 Buffer::Buffer() : MemObj(nullptr, CL_MEM_OBJECT_BUFFER, {}, 0, 0, 0, nullptr, nullptr, 0, false, false, false) {
 }
 
-Buffer::~Buffer() = default;
+Buffer::~Buffer() {
+    auto allocation = multiGraphicsAllocation.getDefaultGraphicsAllocation();
+    if (context && allocation && !isSubBuffer()) {
+        auto allocationType = allocation->getAllocationType();
+        if (allocationType == GraphicsAllocation::AllocationType::BUFFER ||
+            allocationType == GraphicsAllocation::AllocationType::BUFFER_COMPRESSED) {
+            context->getBufferCompressionUsage().add(compressionUsage);
+        }
+    }
+}
+
+CompressionUsageStatistics &Buffer::getCompressionUsage() {
+    if (isSubBuffer()) {
+        return static_cast<Buffer *>(associatedMemObject)->compressionUsage;
+    }
+    return compressionUsage;
+}
 
 bool Buffer::isSubBuffer() {
     return this->associatedMemObject != nullptr;
@@ -180,8 +196,20 @@ Buffer *Buffer::create(Context *context,
     bool forceCopyHostPtr = false;
     bool copyExecuted = false;
 
+    bool compressionBeneficial = true;
+    if (DebugManager.flags.AdaptiveBufferCompression.get() != 0) {
+        compressionBeneficial = context->getBufferCompressionUsage().isCompressionBeneficial();
+    }
+
+    auto defaultRootDeviceIndex = context->getDevice(0u)->getRootDeviceIndex();
+    bool lazyRootDeviceBacking = DebugManager.flags.EnableLazyMultiRootDeviceBacking.get() && context->getRootDeviceIndices().size() > 1 &&
+                                 hostPtr == nullptr && !context->isSharedContext;
+
     for (auto &rootDeviceIndex : context->getRootDeviceIndices()) {
         allocationInfo[rootDeviceIndex] = {};
+        if (lazyRootDeviceBacking && rootDeviceIndex != defaultRootDeviceIndex) {
+            continue;
+        }
 
         auto hwInfo = (&memoryManager->peekExecutionEnvironment())->rootDeviceEnvironments[rootDeviceIndex]->getHardwareInfo();
 
@@ -190,7 +218,7 @@ Buffer *Buffer::create(Context *context,
             *context,
             HwHelper::renderCompressedBuffersSupported(*hwInfo),
             memoryManager->isLocalMemorySupported(rootDeviceIndex),
-            HwHelper::get(hwInfo->platform.eRenderCoreFamily).isBufferSizeSuitableForRenderCompression(size));
+            HwHelper::get(hwInfo->platform.eRenderCoreFamily).isBufferSizeSuitableForRenderCompression(size) && compressionBeneficial);
 
         if (ptr) {
             if (!memoryProperties.flags.useHostPtr) {
@@ -276,10 +304,15 @@ Buffer *Buffer::create(Context *context,
                                                                                                        *hwInfo, context->getDeviceBitfieldForAllocation(rootDeviceIndex));
                 allocationInfo[rootDeviceIndex].memory = memoryManager->allocateGraphicsMemoryWithProperties(allocProperties, ptr);
             } else {
-                AllocationProperties allocProperties = MemoryPropertiesHelper::getAllocationProperties(rootDeviceIndex, memoryProperties,
-                                                                                                       allocationInfo[rootDeviceIndex].allocateMemory, size, allocationInfo[rootDeviceIndex].allocationType, context->areMultiStorageAllocationsPreferred(),
-                                                                                                       *hwInfo, context->getDeviceBitfieldForAllocation(rootDeviceIndex));
-                allocationInfo[rootDeviceIndex].memory = memoryManager->allocateGraphicsMemoryWithProperties(allocProperties, hostPtr);
+                if (allocationInfo[rootDeviceIndex].allocateMemory && !memoryProperties.flags.useHostPtr) {
+                    allocationInfo[rootDeviceIndex].memory = context->obtainRecycledBufferAllocation(rootDeviceIndex, size, allocationInfo[rootDeviceIndex].allocationType, memoryProperties);
+                }
+                if (!allocationInfo[rootDeviceIndex].memory) {
+                    AllocationProperties allocProperties = MemoryPropertiesHelper::getAllocationProperties(rootDeviceIndex, memoryProperties,
+                                                                                                           allocationInfo[rootDeviceIndex].allocateMemory, size, allocationInfo[rootDeviceIndex].allocationType, context->areMultiStorageAllocationsPreferred(),
+                                                                                                           *hwInfo, context->getDeviceBitfieldForAllocation(rootDeviceIndex));
+                    allocationInfo[rootDeviceIndex].memory = memoryManager->allocateGraphicsMemoryWithProperties(allocProperties, hostPtr);
+                }
                 if (allocationInfo[rootDeviceIndex].memory) {
                     ptr = reinterpret_cast<void *>(allocationInfo[rootDeviceIndex].memory->getUnderlyingBuffer());
                 }
@@ -330,7 +363,7 @@ Buffer *Buffer::create(Context *context,
         }
     }
 
-    auto rootDeviceIndex = context->getDevice(0u)->getRootDeviceIndex();
+    auto rootDeviceIndex = defaultRootDeviceIndex;
     auto memoryStorage = multiGraphicsAllocation.getDefaultGraphicsAllocation()->getUnderlyingBuffer();
 
     pBuffer = createBufferHw(context,
@@ -357,7 +390,12 @@ Buffer *Buffer::create(Context *context,
             ", GPU address: ", allocationInfo[rootDeviceIndex].memory->getGpuAddress(),
             ", memoryPool: ", allocationInfo[rootDeviceIndex].memory->getMemoryPool());
 
+    pBuffer->lazyRootDeviceBacking = lazyRootDeviceBacking;
+
     for (auto &rootDeviceIndex : context->getRootDeviceIndices()) {
+        if (allocationInfo[rootDeviceIndex].memory == nullptr) {
+            continue;
+        }
         if (memoryProperties.flags.useHostPtr) {
             if (!allocationInfo[rootDeviceIndex].zeroCopyAllowed && !allocationInfo[rootDeviceIndex].isHostPtrSVM) {
                 AllocationProperties properties{rootDeviceIndex,
@@ -511,6 +549,13 @@ Buffer *Buffer::createSubBuffer(cl_mem_flags flags,
     DEBUG_BREAK_IF(nullptr == createFunction);
     MemoryProperties memoryProperties =
         MemoryPropertiesHelper::createMemoryProperties(flags, flagsIntel, 0, &this->context->getDevice(0)->getDevice());
+    // sub-buffer gets a copy of the allocations, so all of them have to exist
+    for (auto &rootDeviceIndex : this->context->getRootDeviceIndices()) {
+        errcodeRet = createLazyBacking(rootDeviceIndex);
+        if (errcodeRet != CL_SUCCESS) {
+            return nullptr;
+        }
+    }
     auto buffer = createFunction(this->context, memoryProperties, flags, 0, region->size,
                                  ptrOffset(this->memoryStorage, region->origin),
                                  this->hostPtr ? ptrOffset(this->hostPtr, region->origin) : nullptr,
@@ -532,7 +577,7 @@ Buffer *Buffer::createSubBuffer(cl_mem_flags flags,
 
 uint64_t Buffer::setArgStateless(void *memory, uint32_t patchSize, uint32_t rootDeviceIndex, bool set32BitAddressing) {
     // Subbuffers have offset that graphicsAllocation is not aware of
-    auto graphicsAllocation = multiGraphicsAllocation.getGraphicsAllocation(rootDeviceIndex);
+    auto graphicsAllocation = getGraphicsAllocation(rootDeviceIndex);
     uintptr_t addressToPatch = ((set32BitAddressing) ? static_cast<uintptr_t>(graphicsAllocation->getGpuAddressToPatch()) : static_cast<uintptr_t>(graphicsAllocation->getGpuAddress())) + this->offset;
     DEBUG_BREAK_IF(!(graphicsAllocation->isLocked() || (addressToPatch != 0) || (graphicsAllocation->getGpuBaseAddress() != 0) ||
                      (this->getCpuAddress() == nullptr && graphicsAllocation->peekSharedHandle())));
@@ -612,7 +657,7 @@ bool Buffer::isReadWriteOnCpuAllowed(const Device &device) {
         return false;
     }
 
-    auto graphicsAllocation = multiGraphicsAllocation.getGraphicsAllocation(rootDeviceIndex);
+    auto graphicsAllocation = getGraphicsAllocation(rootDeviceIndex);
 
     if (graphicsAllocation->peekSharedHandle() != 0) {
         return false;
@@ -632,7 +677,7 @@ bool Buffer::isReadWriteOnCpuAllowed(const Device &device) {
 }
 
 bool Buffer::isReadWriteOnCpuPreferred(void *ptr, size_t size, const Device &device) {
-    auto graphicsAllocation = multiGraphicsAllocation.getGraphicsAllocation(device.getRootDeviceIndex());
+    auto graphicsAllocation = getGraphicsAllocation(device.getRootDeviceIndex());
     if (MemoryPool::isSystemMemoryPool(graphicsAllocation->getMemoryPool())) {
         //if buffer is not zero copy and pointer is aligned it will be more beneficial to do the transfer on GPU
         if (!isMemObjZeroCopy() && (reinterpret_cast<uintptr_t>(ptr) & (MemoryConstants::cacheLineSize - 1)) == 0) {
@@ -702,7 +747,7 @@ Buffer *Buffer::createBufferHwFromDevice(const Device *device,
 uint32_t Buffer::getMocsValue(bool disableL3Cache, bool isReadOnlyArgument, uint32_t rootDeviceIndex) const {
     uint64_t bufferAddress = 0;
     size_t bufferSize = 0;
-    auto graphicsAllocation = multiGraphicsAllocation.getGraphicsAllocation(rootDeviceIndex);
+    auto graphicsAllocation = getGraphicsAllocation(rootDeviceIndex);
     if (graphicsAllocation) {
         bufferAddress = graphicsAllocation->getGpuAddress();
         bufferSize = graphicsAllocation->getUnderlyingBufferSize();
@@ -735,14 +780,14 @@ uint32_t Buffer::getSurfaceSize(bool alignSizeForAuxTranslation, uint32_t rootDe
 
 uint64_t Buffer::getBufferAddress(uint32_t rootDeviceIndex) const {
     // The graphics allocation for Host Ptr surface will be created in makeResident call and GPU address is expected to be the same as CPU address
-    auto graphicsAllocation = multiGraphicsAllocation.getGraphicsAllocation(rootDeviceIndex);
+    auto graphicsAllocation = getGraphicsAllocation(rootDeviceIndex);
     auto bufferAddress = (graphicsAllocation != nullptr) ? graphicsAllocation->getGpuAddress() : castToUint64(getHostPtr());
     bufferAddress += this->offset;
     return bufferAddress;
 }
 
 bool Buffer::isCompressed(uint32_t rootDeviceIndex) const {
-    auto graphicsAllocation = multiGraphicsAllocation.getGraphicsAllocation(rootDeviceIndex);
+    auto graphicsAllocation = getGraphicsAllocation(rootDeviceIndex);
     if (graphicsAllocation->getDefaultGmm()) {
         return graphicsAllocation->getDefaultGmm()->isRenderCompressed;
     }
@@ -8,6 +8,7 @@
 #pragma once
 #include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/constants.h"
+#include "shared/source/memory_manager/compression_selector.h"
 
 #include "opencl/extensions/public/cl_ext_private.h"
 #include "opencl/source/context/context_type.h"
@@ -17,6 +18,8 @@
 #include "memory_properties_flags.h"
 
 #include <functional>
+#include <mutex>
+#include <vector>
 
 namespace NEO {
 class Device;
@@ -163,6 +166,8 @@ class Buffer : public MemObj {
 
     bool isCompressed(uint32_t rootDeviceIndex) const;
 
+    CompressionUsageStatistics &getCompressionUsage();
+
   protected:
     Buffer(Context *context,
            MemoryProperties memoryProperties,
@@ -193,6 +198,8 @@ class Buffer : public MemObj {
     static bool isReadOnlyMemoryPermittedByFlags(const MemoryProperties &properties);
 
     void transferData(void *dst, void *src, size_t copySize, size_t copyOffset);
+
+    CompressionUsageStatistics compressionUsage;
 };
 
 template <typename GfxFamily>
@@ -244,6 +251,28 @@ class BufferHw : public Buffer {
 
     typedef typename GfxFamily::RENDER_SURFACE_STATE SURFACE_STATE;
     typename SURFACE_STATE::SURFACE_TYPE surfaceType;
+
+  protected:
+    void clearCachedSurfaceStates() override;
+
+    // encoded surface states reused by setArgStateful, the key covers everything the encoding depends on
+    struct CachedSurfaceState {
+        const Device *device = nullptr;
+        const GraphicsAllocation *graphicsAllocation = nullptr;
+        uint64_t gpuAddress = 0u;
+        size_t numDevicesInContext = 0u;
+        bool isCompressed = false;
+        bool forceNonAuxMode = false;
+        bool disableL3 = false;
+        bool alignSizeForAuxTranslation = false;
+        bool isReadOnlyArgument = false;
+        bool useGlobalAtomics = false;
+        SURFACE_STATE surfaceState;
+    };
+    static constexpr size_t maxCachedSurfaceStates = 8u;
+
+    std::mutex cachedSurfaceStatesMutex;
+    std::vector<CachedSurfaceState> cachedSurfaceStates;
 };
 
 } // namespace NEO
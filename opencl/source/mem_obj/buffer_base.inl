@@ -6,6 +6,7 @@
  */
 
 #include "shared/source/command_container/command_encoder.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
@@ -15,6 +16,7 @@
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/bit_helpers.h"
 #include "shared/source/helpers/populate_factory.h"
+#include "shared/source/helpers/string.h"
 
 #include "opencl/source/helpers/surface_formats.h"
 #include "opencl/source/mem_obj/buffer.h"
@@ -38,6 +40,38 @@ void BufferHw<GfxFamily>::setArgStateful(void *memory, bool forceNonAuxMode, boo
                                          bool isReadOnlyArgument, const Device &device, bool useGlobalAtomics, size_t numDevicesInContext) {
     auto rootDeviceIndex = device.getRootDeviceIndex();
     auto graphicsAllocation = multiGraphicsAllocation.getGraphicsAllocation(rootDeviceIndex);
+
+    CachedSurfaceState key;
+    key.device = &device;
+    key.graphicsAllocation = graphicsAllocation;
+    key.gpuAddress = graphicsAllocation ? graphicsAllocation->getGpuAddress() : 0u;
+    key.numDevicesInContext = numDevicesInContext;
+    key.isCompressed = graphicsAllocation && graphicsAllocation->getDefaultGmm() && graphicsAllocation->getDefaultGmm()->isRenderCompressed;
+    key.forceNonAuxMode = forceNonAuxMode;
+    key.disableL3 = disableL3;
+    key.alignSizeForAuxTranslation = alignSizeForAuxTranslation;
+    key.isReadOnlyArgument = isReadOnlyArgument;
+    key.useGlobalAtomics = useGlobalAtomics;
+    auto isSameKey = [&key](const CachedSurfaceState &cached) {
+        return cached.device == key.device && cached.graphicsAllocation == key.graphicsAllocation && cached.gpuAddress == key.gpuAddress &&
+               cached.numDevicesInContext == key.numDevicesInContext && cached.isCompressed == key.isCompressed &&
+               cached.forceNonAuxMode == key.forceNonAuxMode && cached.disableL3 == key.disableL3 &&
+               cached.alignSizeForAuxTranslation == key.alignSizeForAuxTranslation &&
+               cached.isReadOnlyArgument == key.isReadOnlyArgument && cached.useGlobalAtomics == key.useGlobalAtomics;
+    };
+
+    // a cached state is copied whole, so fields of the destination which encodeBuffer keeps are overwritten
+    bool useCache = DebugManager.flags.EnableBufferSurfaceStateCache.get() == 1;
+    if (useCache) {
+        std::lock_guard<std::mutex> lock(cachedSurfaceStatesMutex);
+        for (auto &cached : cachedSurfaceStates) {
+            if (isSameKey(cached)) {
+                memcpy_s(memory, sizeof(SURFACE_STATE), &cached.surfaceState, sizeof(SURFACE_STATE));
+                return;
+            }
+        }
+    }
+
     const auto isReadOnly = isValueSet(getFlags(), CL_MEM_READ_ONLY) || isReadOnlyArgument;
     EncodeSurfaceState<GfxFamily>::encodeBuffer(memory, getBufferAddress(rootDeviceIndex),
                                                 getSurfaceSize(alignSizeForAuxTranslation, rootDeviceIndex),
@@ -45,5 +79,19 @@ void BufferHw<GfxFamily>::setArgStateful(void *memory, bool forceNonAuxMode, boo
                                                 true, forceNonAuxMode, isReadOnly, device.getNumAvailableDevices(),
                                                 graphicsAllocation, device.getGmmHelper(), useGlobalAtomics, numDevicesInContext);
     appendSurfaceStateExt(memory);
+
+    if (useCache) {
+        std::lock_guard<std::mutex> lock(cachedSurfaceStatesMutex);
+        if (cachedSurfaceStates.size() < maxCachedSurfaceStates) {
+            memcpy_s(&key.surfaceState, sizeof(SURFACE_STATE), memory, sizeof(SURFACE_STATE));
+            cachedSurfaceStates.push_back(key);
+        }
+    }
+}
+
+template <typename GfxFamily>
+void BufferHw<GfxFamily>::clearCachedSurfaceStates() {
+    std::lock_guard<std::mutex> lock(cachedSurfaceStatesMutex);
+    cachedSurfaceStates.clear();
 }
 } // namespace NEO
@@ -19,6 +19,7 @@
 #include "shared/source/helpers/string.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/utilities/compiler_support.h"
+#include "shared/source/utilities/tiled_memcpy.h"
 
 #include "opencl/source/cl_device/cl_device.h"
 #include "opencl/source/cl_device/cl_device_get_cap.inl"
@@ -240,6 +241,15 @@ Image *Image::create(Context *context,
         allocationInfo.resize(maxRootDeviceIndex + 1u);
         bool isParentObject = parentBuffer || parentImage;
 
+        if (parentBuffer) {
+            for (auto &rootDeviceIndex : context->getRootDeviceIndices()) {
+                errcodeRet = parentBuffer->createLazyBacking(rootDeviceIndex);
+                if (errcodeRet != CL_SUCCESS) {
+                    return nullptr;
+                }
+            }
+        }
+
         for (auto &rootDeviceIndex : context->getRootDeviceIndices()) {
             allocationInfo[rootDeviceIndex] = {};
             allocationInfo[rootDeviceIndex].zeroCopyAllowed = false;
@@ -1056,6 +1066,54 @@ void Image::transferDataFromHostPtr(MemObjSizeArray &copySize, MemObjOffsetArray
                  copySize, copyOffset);
 }
 
+bool Image::isCpuDetilingAllowed(const size_t *region, uint32_t rootDeviceIndex) {
+    if (DebugManager.flags.EnableCpuDetilingForImageMap.get() != 1) {
+        return false;
+    }
+    if (imageDesc.image_type != CL_MEM_OBJECT_IMAGE2D || isMipMapped(this) || peekSharingHandler() ||
+        IsNV12Image(&imageFormat) || isImageFromImage()) {
+        return false;
+    }
+    auto &hwInfo = *memoryManager->peekExecutionEnvironment().rootDeviceEnvironments[rootDeviceIndex]->getHardwareInfo();
+    auto mapSize = region[0] * surfaceFormatInfo.surfaceFormat.ImageElementSizeInBytes * region[1];
+    if (!hwInfo.capabilityTable.isIntegratedDevice || mapSize > maxMapSizeForCpuDetiling) {
+        return false;
+    }
+
+    auto graphicsAllocation = multiGraphicsAllocation.getGraphicsAllocation(rootDeviceIndex);
+    auto gmm = graphicsAllocation->getDefaultGmm();
+    if (!gmm || gmm->isRenderCompressed) {
+        return false;
+    }
+    auto tileLayout = HwHelper::get(hwInfo.platform.eRenderCoreFamily).getTileLayoutForCpuAccess(gmm->gmmResourceInfo->getTileModeSurfaceState());
+    auto tiledPitch = gmm->gmmResourceInfo->getRenderPitch();
+    return tileLayout != TileLayout::Linear &&
+           tiledPitch % TiledMemcpy::tileWidthInBytes == 0 &&
+           graphicsAllocation->getUnderlyingBufferSize() >= tiledPitch * alignUp(imageDesc.image_height, TiledMemcpy::tileHeight);
+}
+
+void Image::transferTiledData(void *hostPtr, const size_t *origin, const size_t *region, uint32_t rootDeviceIndex, bool toHostPtr) {
+    auto graphicsAllocation = multiGraphicsAllocation.getGraphicsAllocation(rootDeviceIndex);
+    auto gmm = graphicsAllocation->getDefaultGmm();
+    auto &hwInfo = *memoryManager->peekExecutionEnvironment().rootDeviceEnvironments[rootDeviceIndex]->getHardwareInfo();
+    auto tileLayout = HwHelper::get(hwInfo.platform.eRenderCoreFamily).getTileLayoutForCpuAccess(gmm->gmmResourceInfo->getTileModeSurfaceState());
+    auto tiledPitch = gmm->gmmResourceInfo->getRenderPitch();
+    auto elementSize = surfaceFormatInfo.surfaceFormat.ImageElementSizeInBytes;
+
+    auto wasLocked = graphicsAllocation->isLocked();
+    auto tiledPtr = memoryManager->lockResource(graphicsAllocation);
+    if (toHostPtr) {
+        TiledMemcpy::copyFromTiled(tileLayout, hostPtr, hostPtrRowPitch, tiledPtr, tiledPitch,
+                                   origin[0] * elementSize, origin[1], region[0] * elementSize, region[1]);
+    } else {
+        TiledMemcpy::copyToTiled(tileLayout, tiledPtr, tiledPitch, origin[0] * elementSize, origin[1],
+                                 hostPtr, hostPtrRowPitch, region[0] * elementSize, region[1]);
+    }
+    if (!wasLocked) {
+        memoryManager->unlockResource(graphicsAllocation);
+    }
+}
+
 cl_int Image::writeNV12Planes(const void *hostPtr, size_t hostPtrRowPitch, uint32_t rootDeviceIndex) {
     CommandQueue *cmdQ = context->getSpecialQueue(rootDeviceIndex);
     size_t origin[3] = {0, 0, 0};
@@ -53,6 +53,7 @@ extern ValidateAndCreateImageFunc validateAndCreateImage;
 
 class Image : public MemObj {
   public:
+    static constexpr size_t maxMapSizeForCpuDetiling = MemoryConstants::megaByte;
     const static cl_ulong maskMagic = 0xFFFFFFFFFFFFFFFFLL;
     static const cl_ulong objectMagic = MemObj::objectMagic | 0x01;
 
@@ -184,6 +185,8 @@ class Image : public MemObj {
     static cl_int validateRegionAndOrigin(const size_t *origin, const size_t *region, const cl_image_desc &imgDesc);
 
     cl_int writeNV12Planes(const void *hostPtr, size_t hostPtrRowPitch, uint32_t rootDeviceIndex);
+    bool isCpuDetilingAllowed(const size_t *region, uint32_t rootDeviceIndex);
+    void transferTiledData(void *hostPtr, const size_t *origin, const size_t *region, uint32_t rootDeviceIndex, bool toHostPtr);
     void setMcsSurfaceInfo(const McsSurfaceInfo &info) { mcsSurfaceInfo = info; }
     const McsSurfaceInfo &getMcsSurfaceInfo() { return mcsSurfaceInfo; }
     size_t calculateOffsetForMapping(const MemObjOffsetArray &origin) const override;
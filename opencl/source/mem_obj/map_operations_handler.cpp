@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -40,8 +40,8 @@ bool MapOperationsHandler::isOverlapping(MapInfo &inputMapInfo) {
         auto mappedStartPtr = mapInfo.ptr;
         auto mappedEndPtr = ptrOffset(mappedStartPtr, mapInfo.ptrLength);
 
-        // Requested ptr starts before or inside existing ptr range and overlapping end
-        if (inputStartPtr < mappedEndPtr && inputEndPtr >= mappedStartPtr) {
+        // Requested ptr starts before or inside existing ptr range and overlapping end, adjacent ranges do not overlap
+        if (inputStartPtr < mappedEndPtr && inputEndPtr > mappedStartPtr) {
             return true;
         }
     }
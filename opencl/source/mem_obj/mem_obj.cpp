@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,11 +8,13 @@
 #include "opencl/source/mem_obj/mem_obj.h"
 
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/gmm_helper/gmm.h"
 #include "shared/source/gmm_helper/resource_info.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/bit_helpers.h"
 #include "shared/source/helpers/get_info.h"
+#include "shared/source/helpers/hw_helper.h"
 #include "shared/source/memory_manager/deferred_deleter.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/memory_manager.h"
@@ -22,6 +24,7 @@
 #include "opencl/source/command_queue/command_queue.h"
 #include "opencl/source/context/context.h"
 #include "opencl/source/helpers/get_info_status_mapper.h"
+#include "opencl/source/helpers/memory_properties_helpers.h"
 
 #include <algorithm>
 
@@ -85,7 +88,10 @@ MemObj::~MemObj() {
                 if (needWait && graphicsAllocation->isUsed()) {
                     memoryManager->waitForEnginesCompletion(*graphicsAllocation);
                 }
-                destroyGraphicsAllocation(graphicsAllocation, doAsyncDestructions);
+                if (!isRecyclableBufferAllocation(*graphicsAllocation) ||
+                    !context->recycleBufferAllocation(graphicsAllocation, size, memoryProperties)) {
+                    destroyGraphicsAllocation(graphicsAllocation, doAsyncDestructions);
+                }
                 graphicsAllocation = nullptr;
             }
             if (!associatedMemObject) {
@@ -249,9 +255,53 @@ bool MemObj::isMemObjUncacheableForSurfaceState() const {
 }
 
 GraphicsAllocation *MemObj::getGraphicsAllocation(uint32_t rootDeviceIndex) const {
+    if (lazyRootDeviceBacking) {
+        std::lock_guard<std::mutex> lock(lazyBackingMutex);
+        return multiGraphicsAllocation.getGraphicsAllocation(rootDeviceIndex);
+    }
     return multiGraphicsAllocation.getGraphicsAllocation(rootDeviceIndex);
 }
 
+cl_int MemObj::ensureMemoryOnDevice(MemoryManager &memoryManager, uint32_t rootDeviceIndex) {
+    if (!lazyRootDeviceBacking) {
+        multiGraphicsAllocation.ensureMemoryOnDevice(memoryManager, rootDeviceIndex);
+        return CL_SUCCESS;
+    }
+    auto retVal = createLazyBacking(rootDeviceIndex);
+    if (retVal == CL_SUCCESS) {
+        std::lock_guard<std::mutex> lock(lazyBackingMutex);
+        multiGraphicsAllocation.ensureMemoryOnDevice(memoryManager, rootDeviceIndex);
+    }
+    return retVal;
+}
+
+cl_int MemObj::createLazyBacking(uint32_t rootDeviceIndex) {
+    if (!lazyRootDeviceBacking) {
+        return CL_SUCCESS;
+    }
+    std::lock_guard<std::mutex> lock(lazyBackingMutex);
+    if (multiGraphicsAllocation.getGraphicsAllocation(rootDeviceIndex) != nullptr || context->getRootDeviceIndices().count(rootDeviceIndex) == 0) {
+        return CL_SUCCESS;
+    }
+
+    // system memory storage is shared by all root devices, as when the allocations are created up front
+    auto defaultAllocation = multiGraphicsAllocation.getDefaultGraphicsAllocation();
+    bool allocateMemory = !MemoryPool::isSystemMemoryPool(defaultAllocation->getMemoryPool());
+    auto &hwInfo = *executionEnvironment->rootDeviceEnvironments[rootDeviceIndex]->getHardwareInfo();
+    auto allocationProperties = MemoryPropertiesHelper::getAllocationProperties(rootDeviceIndex, memoryProperties, allocateMemory, size,
+                                                                                defaultAllocation->getAllocationType(), context->areMultiStorageAllocationsPreferred(),
+                                                                                hwInfo, context->getDeviceBitfieldForAllocation(rootDeviceIndex));
+    auto graphicsAllocation = memoryManager->allocateGraphicsMemoryWithProperties(allocationProperties, allocateMemory ? nullptr : memoryStorage);
+    if (graphicsAllocation == nullptr) {
+        return CL_MEM_OBJECT_ALLOCATION_FAILURE;
+    }
+
+    graphicsAllocation->setAllocationType(defaultAllocation->getAllocationType());
+    graphicsAllocation->setMemObjectsAllocationWithWritableFlags(defaultAllocation->isMemObjectsAllocationWithWritableFlags());
+    multiGraphicsAllocation.addAllocation(graphicsAllocation);
+    return CL_SUCCESS;
+}
+
 void MemObj::checkUsageAndReleaseOldAllocation(uint32_t rootDeviceIndex) {
     auto graphicsAllocation = getGraphicsAllocation(rootDeviceIndex);
     if (graphicsAllocation != nullptr && (peekSharingHandler() == nullptr || graphicsAllocation->peekReuseCount() == 0)) {
@@ -263,12 +313,14 @@ void MemObj::resetGraphicsAllocation(GraphicsAllocation *newGraphicsAllocation)
     TakeOwnershipWrapper<MemObj> lock(*this);
     checkUsageAndReleaseOldAllocation(newGraphicsAllocation->getRootDeviceIndex());
     multiGraphicsAllocation.addAllocation(newGraphicsAllocation);
+    clearCachedSurfaceStates();
 }
 
 void MemObj::removeGraphicsAllocation(uint32_t rootDeviceIndex) {
     TakeOwnershipWrapper<MemObj> lock(*this);
     checkUsageAndReleaseOldAllocation(rootDeviceIndex);
     multiGraphicsAllocation.removeAllocation(rootDeviceIndex);
+    clearCachedSurfaceStates();
 }
 
 bool MemObj::readMemObjFlagsInvalid() {
@@ -328,6 +380,20 @@ void MemObj::releaseMapAllocation(uint32_t rootDeviceIndex, bool asyncDestroy) {
     }
 }
 
+bool MemObj::isRecyclableBufferAllocation(const GraphicsAllocation &allocation) const {
+    if (memoryProperties.flags.useHostPtr || peekSharingHandler() || mcsAllocation) {
+        return false;
+    }
+    switch (allocation.getAllocationType()) {
+    case GraphicsAllocation::AllocationType::BUFFER:
+    case GraphicsAllocation::AllocationType::BUFFER_COMPRESSED:
+    case GraphicsAllocation::AllocationType::BUFFER_HOST_MEMORY:
+        return true;
+    default:
+        return false;
+    }
+}
+
 void MemObj::destroyGraphicsAllocation(GraphicsAllocation *allocation, bool asyncDestroy) {
     if (asyncDestroy) {
         memoryManager->checkGpuUsageAndDestroyGraphicsAllocations(allocation);
@@ -395,6 +461,32 @@ bool MemObj::mappingOnCpuAllowed() const {
            MemoryPool::isSystemMemoryPool(graphicsAllocation->getMemoryPool());
 }
 
+bool MemObj::directMappingAllowed() const {
+    auto directMappingMode = DebugManager.flags.EnableDirectMappingForLocalMemoryBuffers.get();
+    if (directMappingMode == 0 || (directMappingMode == -1 && size > maxSizeForDirectMapping)) {
+        return false;
+    }
+    // the application expects its own host pointer to be returned from map
+    if (peekClMemObjType() != CL_MEM_OBJECT_BUFFER || isValueSet(flags, CL_MEM_USE_HOST_PTR) || peekSharingHandler()) {
+        return false;
+    }
+    auto graphicsAllocation = multiGraphicsAllocation.getDefaultGraphicsAllocation();
+    if (MemoryPool::isSystemMemoryPool(graphicsAllocation->getMemoryPool()) || graphicsAllocation->storageInfo.getNumBanks() > 1 ||
+        (graphicsAllocation->getDefaultGmm() && graphicsAllocation->getDefaultGmm()->isRenderCompressed)) {
+        return false;
+    }
+    auto &hwInfo = *executionEnvironment->rootDeviceEnvironments[graphicsAllocation->getRootDeviceIndex()]->getHardwareInfo();
+    return LocalMemoryAccessMode::CpuAccessDisallowed != HwHelper::get(hwInfo.platform.eRenderCoreFamily).getLocalMemoryAccessMode(hwInfo);
+}
+
+void *MemObj::lockForDirectMapping(uint32_t rootDeviceIndex) {
+    if (!directMappingAllowed()) {
+        return nullptr;
+    }
+    // the allocation stays locked until it is freed, so map and unmap see the same result
+    return memoryManager->lockResource(getGraphicsAllocation(rootDeviceIndex));
+}
+
 void MemObj::storeProperties(const cl_mem_properties *properties) {
     if (properties) {
         for (size_t i = 0; properties[i] != 0; i += 2) {
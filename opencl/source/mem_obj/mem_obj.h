@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -22,6 +22,7 @@
 #include <atomic>
 #include <cstdint>
 #include <list>
+#include <mutex>
 #include <vector>
 
 namespace NEO {
@@ -59,6 +60,7 @@ class MemObj : public BaseObject<_cl_mem> {
   public:
     constexpr static cl_ulong maskMagic = 0xFFFFFFFFFFFFFF00LL;
     constexpr static cl_ulong objectMagic = 0xAB2212340CACDD00LL;
+    constexpr static size_t maxSizeForDirectMapping = 64 * MemoryConstants::kiloByte;
 
     MemObj(Context *context,
            cl_mem_object_type memObjectType,
@@ -106,6 +108,8 @@ class MemObj : public BaseObject<_cl_mem> {
     virtual void transferDataFromHostPtr(MemObjSizeArray &copySize, MemObjOffsetArray &copyOffset) { UNRECOVERABLE_IF(true); };
 
     GraphicsAllocation *getGraphicsAllocation(uint32_t rootDeviceIndex) const;
+    cl_int createLazyBacking(uint32_t rootDeviceIndex);
+    cl_int ensureMemoryOnDevice(MemoryManager &memoryManager, uint32_t rootDeviceIndex);
     void resetGraphicsAllocation(GraphicsAllocation *newGraphicsAllocation);
     void removeGraphicsAllocation(uint32_t rootDeviceIndex);
     GraphicsAllocation *getMcsAllocation() { return mcsAllocation; }
@@ -128,8 +132,11 @@ class MemObj : public BaseObject<_cl_mem> {
     Context *getContext() const { return context; }
 
     void destroyGraphicsAllocation(GraphicsAllocation *allocation, bool asyncDestroy);
+    bool isRecyclableBufferAllocation(const GraphicsAllocation &allocation) const;
     bool checkIfMemoryTransferIsRequired(size_t offsetInMemObject, size_t offsetInHostPtr, const void *ptr, cl_command_type cmdType);
     bool mappingOnCpuAllowed() const;
+    bool directMappingAllowed() const;
+    void *lockForDirectMapping(uint32_t rootDeviceIndex);
     virtual size_t calculateOffsetForMapping(const MemObjOffsetArray &offset) const { return offset[0]; }
     size_t calculateMappedPtrLength(const MemObjSizeArray &size) const { return calculateOffsetForMapping(size); }
     cl_mem_object_type peekClMemObjType() const { return memObjectType; }
@@ -157,6 +164,7 @@ class MemObj : public BaseObject<_cl_mem> {
     void getOsSpecificMemObjectInfo(const cl_mem_info &paramName, size_t *srcParamSize, void **srcParam);
     void storeProperties(const cl_mem_properties *properties);
     void checkUsageAndReleaseOldAllocation(uint32_t rootDeviceIndex);
+    virtual void clearCachedSurfaceStates() {}
 
     Context *context;
     cl_mem_object_type memObjectType;
@@ -178,6 +186,9 @@ class MemObj : public BaseObject<_cl_mem> {
     bool isObjectRedescribed;
     MemoryManager *memoryManager = nullptr;
     MultiGraphicsAllocation multiGraphicsAllocation;
+    // backing for root devices other than the default one is allocated on first use
+    bool lazyRootDeviceBacking = false;
+    mutable std::mutex lazyBackingMutex;
     GraphicsAllocation *mcsAllocation = nullptr;
     MultiGraphicsAllocation mapAllocations;
     std::shared_ptr<SharingHandler> sharingHandler;
@@ -23,6 +23,7 @@
 #include "shared/source/os_interface/linux/drm_neo.h"
 #include "shared/source/os_interface/linux/os_context_linux.h"
 #include "shared/source/os_interface/linux/os_interface.h"
+#include "shared/source/utilities/launch_overhead_profiler.h"
 
 #include "opencl/source/os_interface/linux/drm_command_stream.h"
 
@@ -44,6 +45,9 @@ DrmCommandStreamReceiver<GfxFamily>::DrmCommandStreamReceiver(ExecutionEnvironme
     residency.reserve(512);
     execObjectsStorage.reserve(512);
 
+    // allocations are bound to VM by memory operations handler, there is no need to pass them to exec
+    this->skipResidencyForExec = this->drm->isVmBindAvailable() && DebugManager.flags.PassBoundBOToExec.get() != 1;
+
     auto hwInfo = rootDeviceEnvironment->getHardwareInfo();
     auto localMemoryEnabled = HwHelper::get(hwInfo->platform.eRenderCoreFamily).getEnableLocalMemory(*hwInfo);
 
@@ -57,6 +61,8 @@ DrmCommandStreamReceiver<GfxFamily>::DrmCommandStreamReceiver(ExecutionEnvironme
 template <typename GfxFamily>
 bool DrmCommandStreamReceiver<GfxFamily>::flush(BatchBuffer &batchBuffer, ResidencyContainer &allocationsForResidency) {
     this->printDeviceIndex();
+    // submissions without a Device, like blits, still create the DRM context on first use
+    this->osContext->ensureContextInitialized();
     DrmAllocation *alloc = static_cast<DrmAllocation *>(batchBuffer.commandBufferAllocation);
     DEBUG_BREAK_IF(!alloc);
 
@@ -146,7 +152,7 @@ void DrmCommandStreamReceiver<GfxFamily>::exec(const BatchBuffer &batchBuffer, u
                        vmHandleId,
                        drmContextId,
                        this->residency.data(), this->residency.size(),
-                       this->execObjectsStorage.data());
+                       this->execObjectsStorage.data(), true);
     UNRECOVERABLE_IF(err != 0);
 
     this->residency.clear();
@@ -154,6 +160,7 @@ void DrmCommandStreamReceiver<GfxFamily>::exec(const BatchBuffer &batchBuffer, u
 
 template <typename GfxFamily>
 void DrmCommandStreamReceiver<GfxFamily>::processResidency(const ResidencyContainer &inputAllocationsForResidency, uint32_t handleId) {
+    ScopedLaunchPhase launchPhase(LaunchOverheadProfiler::Phase::residency);
     for (auto &alloc : inputAllocationsForResidency) {
         auto drmAlloc = static_cast<DrmAllocation *>(alloc);
         drmAlloc->makeBOsResident(osContext, handleId, &this->residency, false);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -13,7 +13,9 @@ namespace NEO {
 
 template <typename GfxFamily>
 void DrmCommandStreamReceiver<GfxFamily>::flushInternal(const BatchBuffer &batchBuffer, const ResidencyContainer &allocationsForResidency) {
-    this->processResidency(allocationsForResidency, 0u);
+    if (!this->skipResidencyForExec) {
+        this->processResidency(allocationsForResidency, 0u);
+    }
     this->exec(batchBuffer, 0u, static_cast<const OsContextLinux *>(osContext)->getDrmContextIds()[0]);
 }
 
@@ -1,10 +1,13 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
+#include "shared/source/execution_environment/execution_environment.h"
+#include "shared/source/utilities/trace_events.h"
+
 #include "opencl/source/platform/platform.h"
 
 namespace NEO {
@@ -12,7 +15,17 @@ void __attribute__((constructor)) platformsConstructor() {
     platformsImpl = new std::vector<std::unique_ptr<Platform>>;
 }
 void __attribute__((destructor)) platformsDestructor() {
+    if (platformsImpl != nullptr && ExecutionEnvironment::isFastProcessTeardownEnabled()) {
+        // platforms are leaked on purpose, closing the process releases device memory and contexts at once
+        for (auto &platform : *platformsImpl) {
+            platform->prepareForFastTeardown();
+        }
+        platformsImpl = nullptr;
+        TraceEvents::destroy();
+        return;
+    }
     delete platformsImpl;
     platformsImpl = nullptr;
+    TraceEvents::destroy();
 }
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -15,6 +15,7 @@ class GmmPageTableMngr;
 class GraphicsAllocation;
 class WddmMemoryManager;
 class Wddm;
+class WddmSubmissionWorker;
 
 template <typename GfxFamily>
 class WddmCommandStreamReceiver : public DeviceCommandStreamReceiver<GfxFamily> {
@@ -40,5 +41,6 @@ class WddmCommandStreamReceiver : public DeviceCommandStreamReceiver<GfxFamily>
 
     Wddm *wddm;
     COMMAND_BUFFER_HEADER_REC *commandBufferHeader;
+    std::unique_ptr<WddmSubmissionWorker> submissionWorker;
 };
 } // namespace NEO
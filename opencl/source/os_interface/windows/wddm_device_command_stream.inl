@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,6 +30,8 @@
 #include "shared/source/os_interface/windows/os_context_win.h"
 #include "shared/source/os_interface/windows/os_interface.h"
 #include "shared/source/os_interface/windows/wddm_memory_manager.h"
+#include "shared/source/os_interface/windows/wddm_submission_worker.h"
+#include "shared/source/utilities/launch_overhead_profiler.h"
 
 namespace NEO {
 
@@ -59,10 +61,15 @@ WddmCommandStreamReceiver<GfxFamily>::WddmCommandStreamReceiver(ExecutionEnviron
     if (DebugManager.flags.CsrDispatchMode.get()) {
         this->dispatchMode = (DispatchMode)DebugManager.flags.CsrDispatchMode.get();
     }
+
+    if (DebugManager.flags.EnableWddmSubmissionWorker.get() == 1) {
+        submissionWorker = std::make_unique<WddmSubmissionWorker>(*wddm);
+    }
 }
 
 template <typename GfxFamily>
 WddmCommandStreamReceiver<GfxFamily>::~WddmCommandStreamReceiver() {
+    submissionWorker.reset();
     if (commandBufferHeader)
         delete commandBufferHeader;
 }
@@ -109,6 +116,15 @@ bool WddmCommandStreamReceiver<GfxFamily>::flush(BatchBuffer &batchBuffer, Resid
     submitArgs.contextHandle = osContextWin->getWddmContextHandle();
     submitArgs.hwQueueHandle = osContextWin->getHwQueue().handle;
     submitArgs.monitorFence = &osContextWin->getResidencyController().getMonitoredFence();
+    if (submissionWorker) {
+        // the fence of a failed submission was signalled by the worker, the failure is reported from now on
+        if (submissionWorker->hasFailedSubmission()) {
+            return false;
+        }
+        submissionWorker->submit(commandStreamAddress, batchBuffer.usedSize - batchBuffer.startOffset, *commandBufferHeader, submitArgs);
+        flushStamp->setStamp(submitArgs.monitorFence->lastSubmittedFence);
+        return true;
+    }
     auto status = wddm->submit(commandStreamAddress, batchBuffer.usedSize - batchBuffer.startOffset, commandBufferHeader, submitArgs);
 
     flushStamp->setStamp(submitArgs.monitorFence->lastSubmittedFence);
@@ -117,6 +133,7 @@ bool WddmCommandStreamReceiver<GfxFamily>::flush(BatchBuffer &batchBuffer, Resid
 
 template <typename GfxFamily>
 void WddmCommandStreamReceiver<GfxFamily>::processResidency(const ResidencyContainer &allocationsForResidency, uint32_t handleId) {
+    ScopedLaunchPhase launchPhase(LaunchOverheadProfiler::Phase::residency);
     bool success = static_cast<OsContextWin *>(osContext)->getResidencyController().makeResidentResidencyAllocations(allocationsForResidency);
     DEBUG_BREAK_IF(!success);
 }
@@ -134,6 +151,9 @@ WddmMemoryManager *WddmCommandStreamReceiver<GfxFamily>::getMemoryManager() cons
 
 template <typename GfxFamily>
 bool WddmCommandStreamReceiver<GfxFamily>::waitForFlushStamp(FlushStamp &flushStampToWait) {
+    if (submissionWorker && submissionWorker->hasFailedSubmission()) {
+        return false;
+    }
     return wddm->waitFromCpu(flushStampToWait, static_cast<OsContextWin *>(osContext)->getResidencyController().getMonitoredFence());
 }
 
@@ -53,6 +53,13 @@ Platform::~Platform() {
     executionEnvironment.decRefInternal();
 }
 
+void Platform::prepareForFastTeardown() {
+    for (auto clDevice : this->clDevices) {
+        clDevice->getDevice().prepareForFastTeardown();
+    }
+    executionEnvironment.prepareForFastTeardown();
+}
+
 cl_int Platform::getInfo(cl_platform_info paramName,
                          size_t paramValueSize,
                          void *paramValue,
@@ -140,7 +147,8 @@ bool Platform::initialize(std::vector<std::unique_ptr<Device>> devices) {
         this->clDevices.push_back(pClDevice);
 
         auto hwInfo = pClDevice->getHardwareInfo();
-        if (pClDevice->getPreemptionMode() == PreemptionMode::MidThread || pClDevice->isDebuggerActive()) {
+        if ((pClDevice->getPreemptionMode() == PreemptionMode::MidThread || pClDevice->isDebuggerActive()) &&
+            !SipKernel::isInitializationDeferred(pClDevice->isDebuggerActive())) {
             auto sipType = SipKernel::getSipKernelType(hwInfo.platform.eRenderCoreFamily, pClDevice->isDebuggerActive());
             initSipKernel(sipType, *pDevice);
         }
@@ -48,6 +48,7 @@ class Platform : public BaseObject<_cl_platform_id> {
 
     MOCKABLE_VIRTUAL bool initialize(std::vector<std::unique_ptr<Device>> devices);
     bool isInitialized();
+    void prepareForFastTeardown();
 
     size_t getNumDevices() const;
     ClDevice **getClDevices();
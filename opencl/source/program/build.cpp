@@ -33,6 +33,62 @@ cl_int Program::build(
     const ClDeviceVector &deviceVector,
     const char *buildOptions,
     bool enableCaching) {
+    return buildImpl(deviceVector, buildOptions, enableCaching, false);
+}
+
+cl_int Program::buildAsync(const ClDeviceVector &deviceVector, const char *buildOptions, bool enableCaching,
+                           void(CL_CALLBACK *funcNotify)(cl_program program, void *userData), void *userData) {
+    auto defaultClDevice = deviceVector[0];
+    UNRECOVERABLE_IF(defaultClDevice == nullptr);
+    CompilerInterface *pCompilerInterface = defaultClDevice->getDevice().getCompilerInterface();
+    if (nullptr == pCompilerInterface) {
+        auto retVal = build(deviceVector, buildOptions, enableCaching);
+        invokeCallback(funcNotify, userData);
+        return retVal;
+    }
+
+    bool buildNotStarted = false;
+    if (false == buildInProgress.compare_exchange_strong(buildNotStarted, true)) {
+        return CL_INVALID_OPERATION;
+    }
+    if (std::any_of(deviceVector.begin(), deviceVector.end(), [&](auto device) { return CL_BUILD_IN_PROGRESS == deviceBuildInfos[device].buildStatus; })) {
+        buildInProgress = false;
+        return CL_INVALID_OPERATION;
+    }
+    for (const auto &device : deviceVector) {
+        deviceBuildInfos[device].buildStatus = CL_BUILD_IN_PROGRESS;
+    }
+
+    bool hasBuildOptions = (nullptr != buildOptions);
+    std::string buildOptionsCopy = hasBuildOptions ? buildOptions : "";
+    asyncBuildCompilerInterface = pCompilerInterface;
+    this->retain();
+    pCompilerInterface->enqueueBuildJob(
+        [this, deviceVector, hasBuildOptions, buildOptionsCopy, enableCaching, funcNotify, userData]() {
+            this->buildImpl(deviceVector, hasBuildOptions ? buildOptionsCopy.c_str() : nullptr, enableCaching, true);
+            this->invokeCallback(funcNotify, userData);
+        },
+        [this]() { this->release(); });
+    return CL_SUCCESS;
+}
+
+void Program::retireAsyncBuilds() {
+    auto compilerInterface = asyncBuildCompilerInterface.load();
+    if (nullptr != compilerInterface) {
+        compilerInterface->retireBuildJobs();
+    }
+}
+
+cl_int Program::buildImpl(
+    const ClDeviceVector &deviceVector,
+    const char *buildOptions,
+    bool enableCaching,
+    bool buildStatusAlreadyInProgress) {
+    bool buildNotStarted = false;
+    if ((false == buildStatusAlreadyInProgress) && (false == buildInProgress.compare_exchange_strong(buildNotStarted, true))) {
+        return CL_INVALID_OPERATION;
+    }
+
     cl_int retVal = CL_SUCCESS;
     std::string internalOptions;
     initInternalOptions(internalOptions);
@@ -54,7 +110,7 @@ cl_int Program::build(
     }
     do {
         // check to see if a previous build request is in progress
-        if (std::any_of(deviceVector.begin(), deviceVector.end(), [&](auto device) { return CL_BUILD_IN_PROGRESS == deviceBuildInfos[device].buildStatus; })) {
+        if ((false == buildStatusAlreadyInProgress) && std::any_of(deviceVector.begin(), deviceVector.end(), [&](auto device) { return CL_BUILD_IN_PROGRESS == deviceBuildInfos[device].buildStatus; })) {
             retVal = CL_INVALID_OPERATION;
             break;
         }
@@ -203,6 +259,7 @@ cl_int Program::build(
     } else {
         setBuildStatusSuccess(deviceVector, CL_PROGRAM_BINARY_TYPE_EXECUTABLE);
     }
+    buildInProgress = false;
 
     return retVal;
 }
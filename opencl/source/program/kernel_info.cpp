@@ -12,6 +12,7 @@
 #include "shared/source/helpers/kernel_helpers.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/helpers/string.h"
+#include "shared/source/kernel/grf_config.h"
 #include "shared/source/memory_manager/memory_manager.h"
 
 #include "opencl/source/cl_device/cl_device.h"
@@ -142,6 +143,10 @@ WorkSizeInfo::WorkSizeInfo(const DispatchInfo &dispatchInfo) {
     this->coreFamily = device.getHardwareInfo().platform.eRenderCoreFamily;
     this->numThreadsPerSubSlice = static_cast<uint32_t>(device.getSharedDeviceInfo().maxNumEUsPerSubSlice) *
                                   device.getSharedDeviceInfo().numThreadsPerEU;
+    if (kernelInfo.kernelDescriptor.kernelAttributes.numGrfRequired == GrfConfig::LargeGrfNumber) {
+        // the doubled register file leaves room for only half of the hardware threads on each EU
+        this->numThreadsPerSubSlice /= 2;
+    }
     this->localMemSize = static_cast<uint32_t>(device.getSharedDeviceInfo().localMemSize);
     setIfUseImg(kernelInfo);
     setMinWorkGroupSize();
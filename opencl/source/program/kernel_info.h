@@ -21,6 +21,7 @@
 #include <cmath>
 #include <cstdint>
 #include <map>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -34,6 +35,7 @@ class BuiltinDispatchInfoBuilder;
 class Device;
 class Kernel;
 struct KernelInfo;
+struct KernelArgsTemplate;
 class DispatchInfo;
 struct KernelArgumentType;
 class GraphicsAllocation;
@@ -188,6 +190,8 @@ struct KernelInfo {
 
     uint64_t shaderHashCode;
     KernelDescriptor kernelDescriptor;
+    // set once the program is built; kernels fall back to resolving their arguments when missing
+    std::shared_ptr<const KernelArgsTemplate> argsTemplate;
 };
 
 std::string concatenateKernelNames(ArrayRef<KernelInfo *> kernelInfos);
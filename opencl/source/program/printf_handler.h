@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,6 +30,10 @@ class PrintfHandler {
         return printfSurface;
     }
 
+    Kernel *getKernel() {
+        return kernel;
+    }
+
   protected:
     PrintfHandler(ClDevice &device);
 
@@ -38,4 +42,5 @@ class PrintfHandler {
     Kernel *kernel = nullptr;
     GraphicsAllocation *printfSurface = nullptr;
 };
+
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -14,16 +14,20 @@
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/program/program_info.h"
 #include "shared/source/program/program_initialization.h"
+#include "shared/source/utilities/parallel_for.h"
+#include "shared/source/utilities/trace_events.h"
 
 #include "opencl/source/cl_device/cl_device.h"
 #include "opencl/source/context/context.h"
 #include "opencl/source/gtpin/gtpin_notify.h"
+#include "opencl/source/kernel/kernel.h"
 #include "opencl/source/program/kernel_info.h"
 #include "opencl/source/program/program.h"
 
 #include "program_debug_data.h"
 
 #include <algorithm>
+#include <vector>
 
 using namespace iOpenCL;
 
@@ -55,6 +59,7 @@ const KernelInfo *Program::getKernelInfo(size_t ordinal, uint32_t rootDeviceInde
 }
 
 cl_int Program::linkBinary(Device *pDevice, const void *constantsInitData, const void *variablesInitData) {
+    ScopedTraceEvent traceEvent("linkBinary", TraceEvents::Category::compile);
     auto linkerInput = getLinkerInput(pDevice->getRootDeviceIndex());
     if (linkerInput == nullptr) {
         return CL_SUCCESS;
@@ -149,7 +154,10 @@ cl_int Program::processGenBinary(const ClDevice &clDevice) {
 
     DecodeError decodeError;
     DeviceBinaryFormat singleDeviceBinaryFormat;
-    std::tie(decodeError, singleDeviceBinaryFormat) = NEO::decodeSingleDeviceBinary(programInfo, binary, decodeErrors, decodeWarnings);
+    {
+        ScopedTraceEvent traceEvent("decodeBinary", TraceEvents::Category::compile);
+        std::tie(decodeError, singleDeviceBinaryFormat) = NEO::decodeSingleDeviceBinary(programInfo, binary, decodeErrors, decodeWarnings);
+    }
     if (decodeWarnings.empty() == false) {
         PRINT_DEBUG_STRING(DebugManager.flags.PrintDebugMessages.get(), stderr, "%s\n", decodeWarnings.c_str());
     }
@@ -185,27 +193,44 @@ cl_int Program::processProgramInfo(ProgramInfo &src, const ClDevice &clDevice) {
 
     kernelInfoArray = std::move(src.kernelInfos);
     auto svmAllocsManager = context ? context->getSVMAllocsManager() : nullptr;
-    if (src.globalConstants.size != 0) {
-        buildInfos[rootDeviceIndex].constantSurface = allocateGlobalsSurface(svmAllocsManager, clDevice.getDevice(), src.globalConstants.size, true, linkerInput, src.globalConstants.initData);
-    }
-
     buildInfos[rootDeviceIndex].globalVarTotalSize = src.globalVariables.size;
 
-    if (src.globalVariables.size != 0) {
-        buildInfos[rootDeviceIndex].globalSurface = allocateGlobalsSurface(svmAllocsManager, clDevice.getDevice(), src.globalVariables.size, false, linkerInput, src.globalVariables.initData);
-        if (clDevice.areOcl21FeaturesEnabled() == false) {
-            buildInfos[rootDeviceIndex].globalVarTotalSize = 0u;
-        }
+    // the globals surfaces are initialized as two more upload tasks ahead of the kernels' ISA
+    constexpr size_t constantsTaskId = 0u;
+    constexpr size_t variablesTaskId = 1u;
+    constexpr size_t globalsTasksCount = 2u;
+    std::vector<cl_int> kernelAllocationResults(kernelInfoArray.size(), CL_SUCCESS);
+    {
+        ScopedTraceEvent traceEvent("isaUpload", TraceEvents::Category::compile);
+        auto workersCount = getProgramUploadWorkersCount(clDevice.getDevice(), kernelInfoArray.size() + globalsTasksCount, src.globalConstants.size + src.globalVariables.size);
+        ParallelFor::run(kernelInfoArray.size() + globalsTasksCount, workersCount, [&](size_t taskId) {
+            if (taskId == constantsTaskId) {
+                if (src.globalConstants.size != 0) {
+                    buildInfos[rootDeviceIndex].constantSurface = allocateGlobalsSurface(svmAllocsManager, clDevice.getDevice(), src.globalConstants.size, true, linkerInput, src.globalConstants.initData);
+                }
+                return;
+            }
+            if (taskId == variablesTaskId) {
+                if (src.globalVariables.size != 0) {
+                    buildInfos[rootDeviceIndex].globalSurface = allocateGlobalsSurface(svmAllocsManager, clDevice.getDevice(), src.globalVariables.size, false, linkerInput, src.globalVariables.initData);
+                }
+                return;
+            }
+            auto kernelId = taskId - globalsTasksCount;
+            auto kernelInfo = kernelInfoArray[kernelId];
+            if (kernelInfo->heapInfo.KernelHeapSize) {
+                kernelAllocationResults[kernelId] = kernelInfo->createKernelAllocation(clDevice.getDevice(), isBuiltIn) ? CL_SUCCESS : CL_OUT_OF_HOST_MEMORY;
+            }
+        });
+    }
+    if ((src.globalVariables.size != 0) && (clDevice.areOcl21FeaturesEnabled() == false)) {
+        buildInfos[rootDeviceIndex].globalVarTotalSize = 0u;
     }
 
-    for (auto &kernelInfo : kernelInfoArray) {
-        cl_int retVal = CL_SUCCESS;
-        if (kernelInfo->heapInfo.KernelHeapSize) {
-            retVal = kernelInfo->createKernelAllocation(clDevice.getDevice(), isBuiltIn) ? CL_SUCCESS : CL_OUT_OF_HOST_MEMORY;
-        }
-
-        if (retVal != CL_SUCCESS) {
-            return retVal;
+    for (size_t kernelId = 0; kernelId < kernelInfoArray.size(); kernelId++) {
+        auto kernelInfo = kernelInfoArray[kernelId];
+        if (kernelAllocationResults[kernelId] != CL_SUCCESS) {
+            return kernelAllocationResults[kernelId];
         }
 
         if (kernelInfo->hasDeviceEnqueue()) {
@@ -216,6 +241,7 @@ cl_int Program::processProgramInfo(ProgramInfo &src, const ClDevice &clDevice) {
         }
 
         kernelInfo->apply(deviceInfoConstants);
+        kernelInfo->argsTemplate = Kernel::createArgsTemplate(*kernelInfo);
     }
 
     return linkBinary(&clDevice.getDevice(), src.globalConstants.initData, src.globalVariables.initData);
@@ -16,10 +16,12 @@
 #include "opencl/source/api/cl_types.h"
 #include "opencl/source/cl_device/cl_device_vector.h"
 #include "opencl/source/helpers/base_object.h"
+#include "opencl/source/helpers/per_thread_data.h"
 
 #include "cif/builtins/memory/buffer/buffer.h"
 #include "patch_list.h"
 
+#include <atomic>
 #include <list>
 #include <string>
 #include <vector>
@@ -131,6 +133,10 @@ class Program : public BaseObject<_cl_program> {
     cl_int build(const ClDeviceVector &deviceVector, const char *buildOptions, bool enableCaching,
                  std::unordered_map<std::string, BuiltinDispatchInfoBuilder *> &builtinsMap);
 
+    cl_int buildAsync(const ClDeviceVector &deviceVector, const char *buildOptions, bool enableCaching,
+                      void(CL_CALLBACK *funcNotify)(cl_program program, void *userData), void *userData);
+    void retireAsyncBuilds();
+
     MOCKABLE_VIRTUAL cl_int processGenBinary(const ClDevice &clDevice);
     MOCKABLE_VIRTUAL cl_int processProgramInfo(ProgramInfo &dst, const ClDevice &clDevice);
 
@@ -277,6 +283,8 @@ class Program : public BaseObject<_cl_program> {
 
     const ExecutionEnvironment &getExecutionEnvironment() const { return executionEnvironment; }
 
+    LocalIdsCache &getLocalIdsCache() { return localIdsCache; }
+
   protected:
     MOCKABLE_VIRTUAL cl_int createProgramFromBinary(const void *pBinary, size_t binarySize, ClDevice &clDevice);
 
@@ -298,6 +306,8 @@ class Program : public BaseObject<_cl_program> {
     void notifyDebuggerWithSourceCode(ClDevice &clDevice, std::string &filename);
     void prependFilePathToOptions(const std::string &filename);
 
+    cl_int buildImpl(const ClDeviceVector &deviceVector, const char *buildOptions, bool enableCaching, bool buildStatusAlreadyInProgress);
+
     void setBuildStatus(cl_build_status status);
     void setBuildStatusSuccess(const ClDeviceVector &deviceVector, cl_program_binary_type binaryType);
 
@@ -318,6 +328,8 @@ class Program : public BaseObject<_cl_program> {
     };
 
     std::unordered_map<ClDevice *, DeviceBuildInfo> deviceBuildInfos;
+    std::atomic<bool> buildInProgress{false};
+    std::atomic<CompilerInterface *> asyncBuildCompilerInterface{nullptr};
     bool isCreatedFromBinary = false;
 
     std::string sourceCode;
@@ -363,6 +375,7 @@ class Program : public BaseObject<_cl_program> {
     uint32_t maxRootDeviceIndex = std::numeric_limits<uint32_t>::max();
     std::mutex lockMutex;
     uint32_t exposedKernels = 0;
+    LocalIdsCache localIdsCache;
 };
 
 } // namespace NEO
@@ -275,7 +275,13 @@ cl_int CL_API_CALL clEnqueueReleaseGLObjects(cl_command_queue commandQueue, cl_u
             return retVal;
         }
 
-        pCommandQueue->finish();
+        bool releaseWithFence = DebugManager.flags.EnableGlReleaseFenceSync.get() && event != nullptr && !pCommandQueue->isOOQEnabled();
+        if (releaseWithFence) {
+            // GL waits on the ARB sync object of the returned release event instead of the CPU waiting here
+            pCommandQueue->flush();
+        } else {
+            pCommandQueue->finish();
+        }
         retVal = pCommandQueue->enqueueReleaseSharedObjects(numObjects, memObjects, numEventsInWaitList, eventWaitList, event,
                                                             CL_COMMAND_RELEASE_GL_OBJECTS);
     }
@@ -8,6 +8,7 @@
 #include "va_sharing_functions.h"
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/os_interface/linux/sys_calls.h"
 
 #include "opencl/source/sharings/va/va_surface.h"
 
@@ -27,6 +28,11 @@ VASharingFunctions::VASharingFunctions(VADisplay vaDisplay) : vaDisplay(vaDispla
 };
 
 VASharingFunctions::~VASharingFunctions() {
+    for (auto &cachedExport : surfaceExportCache) {
+        for (uint32_t i = 0; i < cachedExport.second.num_objects; i++) {
+            SysCalls::close(cachedExport.second.objects[i].fd);
+        }
+    }
     if (libHandle != nullptr) {
         fdlclose(libHandle);
         libHandle = nullptr;
@@ -42,6 +48,19 @@ bool VASharingFunctions::isVaLibraryAvailable() {
     return false;
 }
 
+bool VASharingFunctions::getCachedSurfaceExport(VASurfaceID vaSurface, VADRMPRIMESurfaceDescriptor &descriptor) const {
+    auto cachedExport = surfaceExportCache.find(vaSurface);
+    if (cachedExport == surfaceExportCache.end()) {
+        return false;
+    }
+    descriptor = cachedExport->second;
+    return true;
+}
+
+void VASharingFunctions::cacheSurfaceExport(VASurfaceID vaSurface, const VADRMPRIMESurfaceDescriptor &descriptor) {
+    surfaceExportCache[vaSurface] = descriptor;
+}
+
 void VASharingFunctions::initFunctions() {
     bool enableVaLibCalls = true;
     if (DebugManager.flags.EnableVaLibCalls.get() != -1) {
@@ -9,8 +9,11 @@
 #include "opencl/source/sharings/sharing.h"
 #include "opencl/source/sharings/va/va_sharing_defines.h"
 
+#include <va/va_drmcommon.h>
+
 #include <functional>
 #include <mutex>
+#include <unordered_map>
 #include <vector>
 
 namespace NEO {
@@ -83,6 +86,10 @@ class VASharingFunctions : public SharingFunctions {
 
     static bool isVaLibraryAvailable();
 
+    // mutex has to be held by the caller
+    bool getCachedSurfaceExport(VASurfaceID vaSurface, VADRMPRIMESurfaceDescriptor &descriptor) const;
+    void cacheSurfaceExport(VASurfaceID vaSurface, const VADRMPRIMESurfaceDescriptor &descriptor);
+
     std::mutex mutex;
 
   protected:
@@ -100,5 +107,8 @@ class VASharingFunctions : public SharingFunctions {
 
     std::vector<VAImageFormat> supported2PlaneFormats;
     std::vector<VAImageFormat> supported3PlaneFormats;
+
+    // exported dma-bufs of surfaces shared with this context, the cache owns their fds
+    std::unordered_map<VASurfaceID, VADRMPRIMESurfaceDescriptor> surfaceExportCache;
 };
 } // namespace NEO
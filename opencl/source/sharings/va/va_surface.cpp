@@ -10,6 +10,7 @@
 #include "shared/source/gmm_helper/gmm.h"
 #include "shared/source/helpers/get_info.h"
 #include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/os_interface/linux/sys_calls.h"
 
 #include "opencl/source/cl_device/cl_device.h"
 #include "opencl/source/context/context.h"
@@ -43,10 +44,18 @@ Image *VASurface::createSharedVaSurface(Context *context, VASharingFunctions *sh
 
     std::unique_lock<std::mutex> lock(sharingFunctions->mutex);
 
-    vaStatus = sharingFunctions->exportSurfaceHandle(*surface,
-                                                     VA_SURFACE_ATTRIB_MEM_TYPE_DRM_PRIME_2,
-                                                     VA_EXPORT_SURFACE_READ_WRITE | VA_EXPORT_SURFACE_SEPARATE_LAYERS,
-                                                     &vaDrmPrimeSurfaceDesc);
+    bool useExportCache = DebugManager.flags.EnableVaSurfaceExportCache.get();
+    if (useExportCache && sharingFunctions->getCachedSurfaceExport(*surface, vaDrmPrimeSurfaceDesc)) {
+        vaStatus = VA_STATUS_SUCCESS;
+    } else {
+        vaStatus = sharingFunctions->exportSurfaceHandle(*surface,
+                                                         VA_SURFACE_ATTRIB_MEM_TYPE_DRM_PRIME_2,
+                                                         VA_EXPORT_SURFACE_READ_WRITE | VA_EXPORT_SURFACE_SEPARATE_LAYERS,
+                                                         &vaDrmPrimeSurfaceDesc);
+        if (useExportCache && VA_STATUS_SUCCESS == vaStatus) {
+            sharingFunctions->cacheSurfaceExport(*surface, vaDrmPrimeSurfaceDesc);
+        }
+    }
     if (VA_STATUS_SUCCESS == vaStatus) {
         imageId = VA_INVALID_ID;
         imgDesc.image_width = vaDrmPrimeSurfaceDesc.width;
@@ -61,6 +70,15 @@ Image *VASurface::createSharedVaSurface(Context *context, VASharingFunctions *sh
         }
         imgInfo.linearStorage = DRM_FORMAT_MOD_LINEAR == vaDrmPrimeSurfaceDesc.objects[0].drm_format_modifier;
         sharedHandle = vaDrmPrimeSurfaceDesc.objects[0].fd;
+        if (useExportCache) {
+            // the allocation closes its shared handle, the cached fd has to stay open
+            auto duplicatedHandle = SysCalls::dup(vaDrmPrimeSurfaceDesc.objects[0].fd);
+            if (duplicatedHandle == -1) {
+                errorCode.set(CL_OUT_OF_RESOURCES);
+                return nullptr;
+            }
+            sharedHandle = static_cast<unsigned int>(duplicatedHandle);
+        }
     } else {
         sharingFunctions->deriveImage(*surface, &vaImage);
         imageId = vaImage.image_id;
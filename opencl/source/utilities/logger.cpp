@@ -251,96 +251,7 @@ const char *FileLogger<DebugLevel>::getAllocationTypeString(GraphicsAllocation c
         return nullptr;
     }
 
-    auto type = graphicsAllocation->getAllocationType();
-
-    switch (type) {
-    case GraphicsAllocation::AllocationType::BUFFER:
-        return "BUFFER";
-    case GraphicsAllocation::AllocationType::BUFFER_COMPRESSED:
-        return "BUFFER_COMPRESSED";
-    case GraphicsAllocation::AllocationType::BUFFER_HOST_MEMORY:
-        return "BUFFER_HOST_MEMORY";
-    case GraphicsAllocation::AllocationType::COMMAND_BUFFER:
-        return "COMMAND_BUFFER";
-    case GraphicsAllocation::AllocationType::CONSTANT_SURFACE:
-        return "CONSTANT_SURFACE";
-    case GraphicsAllocation::AllocationType::DEVICE_QUEUE_BUFFER:
-        return "DEVICE_QUEUE_BUFFER";
-    case GraphicsAllocation::AllocationType::EXTERNAL_HOST_PTR:
-        return "EXTERNAL_HOST_PTR";
-    case GraphicsAllocation::AllocationType::FILL_PATTERN:
-        return "FILL_PATTERN";
-    case GraphicsAllocation::AllocationType::GLOBAL_SURFACE:
-        return "GLOBAL_SURFACE";
-    case GraphicsAllocation::AllocationType::IMAGE:
-        return "IMAGE";
-    case GraphicsAllocation::AllocationType::INDIRECT_OBJECT_HEAP:
-        return "INDIRECT_OBJECT_HEAP";
-    case GraphicsAllocation::AllocationType::INSTRUCTION_HEAP:
-        return "INSTRUCTION_HEAP";
-    case GraphicsAllocation::AllocationType::INTERNAL_HEAP:
-        return "INTERNAL_HEAP";
-    case GraphicsAllocation::AllocationType::INTERNAL_HOST_MEMORY:
-        return "INTERNAL_HOST_MEMORY";
-    case GraphicsAllocation::AllocationType::KERNEL_ISA:
-        return "KERNEL_ISA";
-    case GraphicsAllocation::AllocationType::KERNEL_ISA_INTERNAL:
-        return "KERNEL_ISA_INTERNAL";
-    case GraphicsAllocation::AllocationType::LINEAR_STREAM:
-        return "LINEAR_STREAM";
-    case GraphicsAllocation::AllocationType::MAP_ALLOCATION:
-        return "MAP_ALLOCATION";
-    case GraphicsAllocation::AllocationType::MCS:
-        return "MCS";
-    case GraphicsAllocation::AllocationType::PIPE:
-        return "PIPE";
-    case GraphicsAllocation::AllocationType::PREEMPTION:
-        return "PREEMPTION";
-    case GraphicsAllocation::AllocationType::PRINTF_SURFACE:
-        return "PRINTF_SURFACE";
-    case GraphicsAllocation::AllocationType::PRIVATE_SURFACE:
-        return "PRIVATE_SURFACE";
-    case GraphicsAllocation::AllocationType::PROFILING_TAG_BUFFER:
-        return "PROFILING_TAG_BUFFER";
-    case GraphicsAllocation::AllocationType::SCRATCH_SURFACE:
-        return "SCRATCH_SURFACE";
-    case GraphicsAllocation::AllocationType::SHARED_BUFFER:
-        return "SHARED_BUFFER";
-    case GraphicsAllocation::AllocationType::SHARED_CONTEXT_IMAGE:
-        return "SHARED_CONTEXT_IMAGE";
-    case GraphicsAllocation::AllocationType::SHARED_IMAGE:
-        return "SHARED_IMAGE";
-    case GraphicsAllocation::AllocationType::SHARED_RESOURCE_COPY:
-        return "SHARED_RESOURCE_COPY";
-    case GraphicsAllocation::AllocationType::SURFACE_STATE_HEAP:
-        return "SURFACE_STATE_HEAP";
-    case GraphicsAllocation::AllocationType::SVM_CPU:
-        return "SVM_CPU";
-    case GraphicsAllocation::AllocationType::SVM_GPU:
-        return "SVM_GPU";
-    case GraphicsAllocation::AllocationType::SVM_ZERO_COPY:
-        return "SVM_ZERO_COPY";
-    case GraphicsAllocation::AllocationType::TAG_BUFFER:
-        return "TAG_BUFFER";
-    case GraphicsAllocation::AllocationType::GLOBAL_FENCE:
-        return "GLOBAL_FENCE";
-    case GraphicsAllocation::AllocationType::TIMESTAMP_PACKET_TAG_BUFFER:
-        return "TIMESTAMP_PACKET_TAG_BUFFER";
-    case GraphicsAllocation::AllocationType::UNKNOWN:
-        return "UNKNOWN";
-    case GraphicsAllocation::AllocationType::WRITE_COMBINED:
-        return "WRITE_COMBINED";
-    case GraphicsAllocation::AllocationType::DEBUG_CONTEXT_SAVE_AREA:
-        return "DEBUG_CONTEXT_SAVE_AREA";
-    case GraphicsAllocation::AllocationType::DEBUG_SBA_TRACKING_BUFFER:
-        return "DEBUG_SBA_TRACKING_BUFFER";
-    case GraphicsAllocation::AllocationType::DEBUG_MODULE_AREA:
-        return "DEBUG_MODULE_AREA";
-    case GraphicsAllocation::AllocationType::WORK_PARTITION_SURFACE:
-        return "WORK_PARTITION_SURFACE";
-    default:
-        return "ILLEGAL_VALUE";
-    }
+    return GraphicsAllocation::getAllocationTypeString(graphicsAllocation->getAllocationType());
 }
 
 template class FileLogger<DebugFunctionalityLevel::None>;
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "benchmark_common.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Measures clCreateBuffer and clReleaseMemObject latency distributions over buffer sizes and reports them as JSON.
+// In the busy mode every buffer is filled with a non-blocking enqueue right before it is released,
+// so the release hits a buffer that is still in use by the GPU and goes through the deferred deletion path.
+
+using Clock = std::chrono::steady_clock;
+
+struct Result {
+    std::string operation;
+    std::string mode;
+    size_t size;
+    double p50Us;
+    double p99Us;
+    double p999Us;
+};
+
+void measureChurn(cl_context context, cl_command_queue busyQueue, size_t size, size_t iterations, std::vector<Result> &results) {
+    std::vector<double> createSamples;
+    std::vector<double> releaseSamples;
+    cl_uchar pattern = 0xa5;
+    cl_int err = CL_SUCCESS;
+
+    for (size_t i = 0; i < iterations; i++) {
+        auto start = Clock::now();
+        auto buffer = clCreateBuffer(context, CL_MEM_READ_WRITE, size, nullptr, &err);
+        createSamples.push_back(toMicroseconds(Clock::now() - start));
+        CHECK(err);
+
+        if (busyQueue) {
+            CHECK(clEnqueueFillBuffer(busyQueue, buffer, &pattern, sizeof(pattern), 0, size, 0, nullptr, nullptr));
+            CHECK(clFlush(busyQueue));
+        }
+
+        start = Clock::now();
+        CHECK(clReleaseMemObject(buffer));
+        releaseSamples.push_back(toMicroseconds(Clock::now() - start));
+    }
+    if (busyQueue) {
+        CHECK(clFinish(busyQueue));
+    }
+
+    const char *mode = busyQueue ? "busy" : "idle";
+    std::sort(createSamples.begin(), createSamples.end());
+    std::sort(releaseSamples.begin(), releaseSamples.end());
+    results.push_back({"create", mode, size, percentile(createSamples, 0.5), percentile(createSamples, 0.99), percentile(createSamples, 0.999)});
+    results.push_back({"release", mode, size, percentile(releaseSamples, 0.5), percentile(releaseSamples, 0.99), percentile(releaseSamples, 0.999)});
+}
+
+std::string toJson(const std::vector<Result> &results, size_t iterations) {
+    std::ostringstream json;
+    json << "{\"benchmark\":\"alloc_churn_opencl\",\"api\":\"opencl\",\"unit\":\"us\",\"iterations\":" << iterations << ",\"results\":[";
+    for (size_t i = 0; i < results.size(); i++) {
+        json << (i ? "," : "") << "\n{\"operation\":\"" << results[i].operation << "\",\"mode\":\"" << results[i].mode
+             << "\",\"size\":" << results[i].size << ",\"p50\":" << results[i].p50Us << ",\"p99\":" << results[i].p99Us
+             << ",\"p999\":" << results[i].p999Us << "}";
+    }
+    json << "\n]}\n";
+    return json.str();
+}
+
+int main(int argc, char *argv[]) {
+    auto iterations = std::max<size_t>(getParamValue(argc, argv, "-i", "--iterations", 10000u), 1u);
+    cl_int err = CL_SUCCESS;
+
+    cl_platform_id platform = nullptr;
+    CHECK(clGetPlatformIDs(1, &platform, nullptr));
+    cl_device_id device = nullptr;
+    CHECK(clGetDeviceIDs(platform, CL_DEVICE_TYPE_GPU, 1, &device, nullptr));
+    cl_ulong maxAllocSize = 0;
+    CHECK(clGetDeviceInfo(device, CL_DEVICE_MAX_MEM_ALLOC_SIZE, sizeof(maxAllocSize), &maxAllocSize, nullptr));
+
+    auto context = clCreateContext(nullptr, 1, &device, nullptr, nullptr, &err);
+    CHECK(err);
+    auto queue = clCreateCommandQueue(context, device, 0, &err);
+    CHECK(err);
+
+    const size_t sizes[] = {64u, 4096u, 64u * 1024u, 1024u * 1024u, 16u * 1024u * 1024u};
+    std::vector<Result> results;
+    for (auto size : sizes) {
+        if (size > maxAllocSize) {
+            continue;
+        }
+        // warm up, so the first touch of every heap stays out of the samples
+        std::vector<Result> warmUp;
+        measureChurn(context, nullptr, size, 10u, warmUp);
+
+        measureChurn(context, nullptr, size, iterations, results);
+        measureChurn(context, queue, size, iterations, results);
+    }
+
+    CHECK(clReleaseCommandQueue(queue));
+    CHECK(clReleaseContext(context));
+
+    writeBenchmarkOutput(argc, argv, toJson(results, iterations));
+    return 0;
+}
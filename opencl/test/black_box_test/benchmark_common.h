@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "CL/cl.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+inline void check(cl_int err, const char *call) {
+    if (err != CL_SUCCESS) {
+        std::cerr << "Error " << err << " : " << call << std::endl;
+        abort();
+    }
+}
+
+#define CHECK(CALL) check(CALL, #CALL)
+
+inline const char *getParamString(int argc, char *argv[], const char *shortName, const char *longName) {
+    for (int i = 1; i < argc - 1; i++) {
+        if ((0 == strcmp(argv[i], shortName)) || (0 == strcmp(argv[i], longName))) {
+            return argv[i + 1];
+        }
+    }
+    return nullptr;
+}
+
+inline size_t getParamValue(int argc, char *argv[], const char *shortName, const char *longName, size_t defaultValue) {
+    auto value = getParamString(argc, argv, shortName, longName);
+    if (value == nullptr) {
+        return defaultValue;
+    }
+    return static_cast<size_t>(std::strtoull(value, nullptr, 10));
+}
+
+inline double toMicroseconds(std::chrono::steady_clock::duration duration) {
+    return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+inline double median(std::vector<double> &samples) {
+    std::sort(samples.begin(), samples.end());
+    return samples[samples.size() / 2];
+}
+
+inline double percentile(const std::vector<double> &sortedSamples, double fraction) {
+    auto index = static_cast<size_t>(fraction * static_cast<double>(sortedSamples.size() - 1));
+    return sortedSamples[index];
+}
+
+// prints the benchmark results and also writes them to the file given with -o / --output
+inline void writeBenchmarkOutput(int argc, char *argv[], const std::string &json) {
+    std::cout << json;
+    auto outputFile = getParamString(argc, argv, "-o", "--output");
+    if (outputFile) {
+        std::ofstream(outputFile) << json;
+    }
+}
@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "benchmark_common.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Sweeps transfer sizes over the OpenCL copy entry points and reports the achieved bandwidth as JSON.
+// The runtime picks the engine and the copy path (kernel, blitter or CPU copy) for every transfer;
+// run with PrintDeviceAndEngineIdOnSubmission=1 to see which engine received each submission.
+
+using Clock = std::chrono::steady_clock;
+
+using clHostMemAllocINTEL_fn = void *(CL_API_CALL *)(cl_context, const cl_ulong *, size_t, cl_uint, cl_int *);
+using clDeviceMemAllocINTEL_fn = void *(CL_API_CALL *)(cl_context, cl_device_id, const cl_ulong *, size_t, cl_uint, cl_int *);
+using clMemFreeINTEL_fn = cl_int(CL_API_CALL *)(cl_context, void *);
+using clEnqueueMemcpyINTEL_fn = cl_int(CL_API_CALL *)(cl_command_queue, cl_bool, void *, const void *, size_t, cl_uint, const cl_event *, cl_event *);
+
+struct Result {
+    std::string transfer;
+    size_t size;
+    double bandwidthGBps;
+};
+
+uint32_t getIterations(size_t size) {
+    constexpr size_t bytesPerMeasurement = 256u * 1024u * 1024u;
+    return static_cast<uint32_t>(std::min<size_t>(std::max<size_t>(bytesPerMeasurement / size, 4u), 1000u));
+}
+
+// every iteration is a blocking transfer, the first one is a warm up outside of the measurement
+template <typename CopyFunction>
+double measureBandwidth(size_t size, CopyFunction copy) {
+    auto iterations = getIterations(size);
+    copy(size);
+    auto start = Clock::now();
+    for (uint32_t i = 0; i < iterations; i++) {
+        copy(size);
+    }
+    auto seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    return static_cast<double>(size) * iterations / seconds / 1e9;
+}
+
+std::string toJson(const std::vector<Result> &results) {
+    std::ostringstream json;
+    json << "{\"benchmark\":\"copy_bandwidth_opencl\",\"api\":\"opencl\",\"engine\":\"runtime\",\"unit\":\"GB/s\",\"results\":[";
+    for (size_t i = 0; i < results.size(); i++) {
+        json << (i ? "," : "") << "\n{\"transfer\":\"" << results[i].transfer << "\",\"size\":" << results[i].size
+             << ",\"bandwidth\":" << results[i].bandwidthGBps << "}";
+    }
+    json << "\n]}\n";
+    return json.str();
+}
+
+int main(int argc, char *argv[]) {
+    size_t minSize = getParamValue(argc, argv, "-b", "--min-size", 64u);
+    size_t maxSize = getParamValue(argc, argv, "-e", "--max-size", 256u * 1024u * 1024u);
+    cl_int err = CL_SUCCESS;
+
+    cl_platform_id platform = nullptr;
+    CHECK(clGetPlatformIDs(1, &platform, nullptr));
+    cl_device_id device = nullptr;
+    CHECK(clGetDeviceIDs(platform, CL_DEVICE_TYPE_GPU, 1, &device, nullptr));
+    cl_ulong maxAllocSize = 0;
+    CHECK(clGetDeviceInfo(device, CL_DEVICE_MAX_MEM_ALLOC_SIZE, sizeof(maxAllocSize), &maxAllocSize, nullptr));
+    maxSize = std::min<size_t>(maxSize, static_cast<size_t>(maxAllocSize));
+    minSize = std::max<size_t>(std::min(minSize, maxSize), 1u);
+
+    auto context = clCreateContext(nullptr, 1, &device, nullptr, nullptr, &err);
+    CHECK(err);
+    auto queue = clCreateCommandQueue(context, device, 0, &err);
+    CHECK(err);
+
+    std::vector<char> hostMemory(maxSize);
+    auto srcBuffer = clCreateBuffer(context, CL_MEM_READ_WRITE, maxSize, nullptr, &err);
+    CHECK(err);
+    auto dstBuffer = clCreateBuffer(context, CL_MEM_READ_WRITE, maxSize, nullptr, &err);
+    CHECK(err);
+    auto userPtrBuffer = clCreateBuffer(context, CL_MEM_USE_HOST_PTR, maxSize, hostMemory.data(), &err);
+    CHECK(err);
+
+    std::vector<Result> results;
+    auto sweep = [&](const char *transfer, auto copy) {
+        for (size_t size = minSize; size <= maxSize; size *= 2) {
+            results.push_back({transfer, size, measureBandwidth(size, copy)});
+        }
+    };
+
+    sweep("host_to_buffer", [&](size_t size) { CHECK(clEnqueueWriteBuffer(queue, dstBuffer, CL_TRUE, 0, size, hostMemory.data(), 0, nullptr, nullptr)); });
+    sweep("buffer_to_host", [&](size_t size) { CHECK(clEnqueueReadBuffer(queue, srcBuffer, CL_TRUE, 0, size, hostMemory.data(), 0, nullptr, nullptr)); });
+    sweep("buffer_to_buffer", [&](size_t size) {
+        CHECK(clEnqueueCopyBuffer(queue, srcBuffer, dstBuffer, 0, 0, size, 0, nullptr, nullptr));
+        CHECK(clFinish(queue));
+    });
+    sweep("userptr_to_buffer", [&](size_t size) {
+        CHECK(clEnqueueCopyBuffer(queue, userPtrBuffer, dstBuffer, 0, 0, size, 0, nullptr, nullptr));
+        CHECK(clFinish(queue));
+    });
+    sweep("buffer_to_userptr", [&](size_t size) {
+        CHECK(clEnqueueCopyBuffer(queue, srcBuffer, userPtrBuffer, 0, 0, size, 0, nullptr, nullptr));
+        CHECK(clFinish(queue));
+    });
+
+    auto hostMemAlloc = reinterpret_cast<clHostMemAllocINTEL_fn>(clGetExtensionFunctionAddressForPlatform(platform, "clHostMemAllocINTEL"));
+    auto deviceMemAlloc = reinterpret_cast<clDeviceMemAllocINTEL_fn>(clGetExtensionFunctionAddressForPlatform(platform, "clDeviceMemAllocINTEL"));
+    auto sharedMemAlloc = reinterpret_cast<clDeviceMemAllocINTEL_fn>(clGetExtensionFunctionAddressForPlatform(platform, "clSharedMemAllocINTEL"));
+    auto memFree = reinterpret_cast<clMemFreeINTEL_fn>(clGetExtensionFunctionAddressForPlatform(platform, "clMemFreeINTEL"));
+    auto enqueueMemcpy = reinterpret_cast<clEnqueueMemcpyINTEL_fn>(clGetExtensionFunctionAddressForPlatform(platform, "clEnqueueMemcpyINTEL"));
+
+    if (hostMemAlloc && deviceMemAlloc && sharedMemAlloc && memFree && enqueueMemcpy) {
+        void *hostUsm = hostMemAlloc(context, nullptr, maxSize, 0, &err);
+        CHECK(err);
+        void *sharedUsm = sharedMemAlloc(context, device, nullptr, maxSize, 0, &err);
+        CHECK(err);
+        void *deviceUsm[2] = {deviceMemAlloc(context, device, nullptr, maxSize, 0, &err), nullptr};
+        CHECK(err);
+        deviceUsm[1] = deviceMemAlloc(context, device, nullptr, maxSize, 0, &err);
+        CHECK(err);
+
+        auto memcpySweep = [&](const char *transfer, void *dst, const void *src) {
+            sweep(transfer, [&](size_t size) { CHECK(enqueueMemcpy(queue, CL_TRUE, dst, src, size, 0, nullptr, nullptr)); });
+        };
+        memcpySweep("host_usm_to_device_usm", deviceUsm[0], hostUsm);
+        memcpySweep("device_usm_to_host_usm", hostUsm, deviceUsm[0]);
+        memcpySweep("device_usm_to_device_usm", deviceUsm[1], deviceUsm[0]);
+        memcpySweep("shared_usm_to_device_usm", deviceUsm[0], sharedUsm);
+        memcpySweep("device_usm_to_shared_usm", sharedUsm, deviceUsm[0]);
+        memcpySweep("malloc_to_device_usm", deviceUsm[0], hostMemory.data());
+        memcpySweep("device_usm_to_malloc", hostMemory.data(), deviceUsm[0]);
+
+        CHECK(memFree(context, deviceUsm[1]));
+        CHECK(memFree(context, deviceUsm[0]));
+        CHECK(memFree(context, sharedUsm));
+        CHECK(memFree(context, hostUsm));
+    } else {
+        std::cerr << "USM extension not available, USM transfers skipped" << std::endl;
+    }
+
+    CHECK(clReleaseMemObject(userPtrBuffer));
+    CHECK(clReleaseMemObject(dstBuffer));
+    CHECK(clReleaseMemObject(srcBuffer));
+    CHECK(clReleaseCommandQueue(queue));
+    CHECK(clReleaseContext(context));
+
+    writeBenchmarkOutput(argc, argv, toJson(results));
+    return 0;
+}
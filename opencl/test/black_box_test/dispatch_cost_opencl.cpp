@@ -0,0 +1,233 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "benchmark_common.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Measures the host cost of setting kernel arguments and of clEnqueueNDRangeKernel over argument counts, argument
+// types, work dimensions and local work size choices, and reports medians as JSON.
+// GPU execution is taken out of the picture with EnableNullHardware: on Linux the DRM null device completes every
+// submission immediately, so the numbers are pure walker encoding and submission cost.
+// A real GPU is still required: the DRM null device forwards GETPARAM and QUERY ioctls to the i915 device node.
+// On Linux both debug keys are set here unless already present in the environment; on Windows they have to be set
+// before the application starts.
+
+using Clock = std::chrono::steady_clock;
+
+enum class ArgType {
+    buffer,
+    svm,
+    image,
+    sampler,
+    scalar
+};
+
+const ArgType argTypes[] = {ArgType::buffer, ArgType::svm, ArgType::image, ArgType::sampler, ArgType::scalar};
+const cl_uint argCounts[] = {1u, 2u, 4u, 8u, 16u, 32u, 64u};
+
+struct Result {
+    std::string argType;
+    cl_uint argCount;
+    cl_uint workDim;
+    bool explicitLws;
+    double setArgsUs;
+    double enqueueUs;
+};
+
+const char *getArgTypeName(ArgType type) {
+    switch (type) {
+    case ArgType::buffer:
+        return "buffer";
+    case ArgType::svm:
+        return "svm";
+    case ArgType::image:
+        return "image";
+    case ArgType::sampler:
+        return "sampler";
+    default:
+        return "scalar";
+    }
+}
+
+const char *getArgDeclaration(ArgType type) {
+    switch (type) {
+    case ArgType::buffer:
+    case ArgType::svm:
+        return "__global int *";
+    case ArgType::image:
+        return "read_only image2d_t ";
+    case ArgType::sampler:
+        return "sampler_t ";
+    default:
+        return "int ";
+    }
+}
+
+std::string getKernelName(ArgType type, cl_uint argCount) {
+    return std::string("kernel_") + getArgTypeName(type) + "_" + std::to_string(argCount);
+}
+
+// the kernels do not touch their arguments, only the argument layout matters for the host side
+std::string generateSource(const std::vector<std::pair<ArgType, cl_uint>> &kernels) {
+    std::ostringstream source;
+    for (auto &kernel : kernels) {
+        source << "__kernel void " << getKernelName(kernel.first, kernel.second) << "(";
+        for (cl_uint i = 0; i < kernel.second; i++) {
+            source << (i ? ", " : "") << getArgDeclaration(kernel.first) << "arg" << i;
+        }
+        source << ") {}\n";
+    }
+    return source.str();
+}
+
+std::string toJson(const std::vector<Result> &results, size_t iterations) {
+    std::ostringstream json;
+    json << "{\"benchmark\":\"dispatch_cost_opencl\",\"unit\":\"us\",\"iterations\":" << iterations << ",\"results\":[";
+    for (size_t i = 0; i < results.size(); i++) {
+        auto &result = results[i];
+        json << (i ? "," : "") << "\n{\"arg_type\":\"" << result.argType << "\",\"arg_count\":" << result.argCount
+             << ",\"work_dim\":" << result.workDim << ",\"lws\":\"" << (result.explicitLws ? "explicit" : "runtime")
+             << "\",\"set_args\":" << result.setArgsUs << ",\"enqueue\":" << result.enqueueUs << "}";
+    }
+    json << "\n]}\n";
+    return json.str();
+}
+
+int main(int argc, char *argv[]) {
+#ifndef _WIN32
+    // debug keys are read when the ICD loads the runtime, which happens on the first API call
+    setenv("NEOReadDebugKeys", "1", 0);
+    setenv("EnableNullHardware", "1", 0);
+#endif
+    auto iterations = std::max<size_t>(getParamValue(argc, argv, "-i", "--iterations", 1000u), 1u);
+    cl_int err = CL_SUCCESS;
+
+    cl_platform_id platform = nullptr;
+    CHECK(clGetPlatformIDs(1, &platform, nullptr));
+    cl_device_id device = nullptr;
+    CHECK(clGetDeviceIDs(platform, CL_DEVICE_TYPE_GPU, 1, &device, nullptr));
+
+    cl_uint maxSamplers = 0;
+    cl_uint maxReadImageArgs = 0;
+    cl_device_svm_capabilities svmCapabilities = 0;
+    CHECK(clGetDeviceInfo(device, CL_DEVICE_MAX_SAMPLERS, sizeof(maxSamplers), &maxSamplers, nullptr));
+    CHECK(clGetDeviceInfo(device, CL_DEVICE_MAX_READ_IMAGE_ARGS, sizeof(maxReadImageArgs), &maxReadImageArgs, nullptr));
+    if (CL_SUCCESS != clGetDeviceInfo(device, CL_DEVICE_SVM_CAPABILITIES, sizeof(svmCapabilities), &svmCapabilities, nullptr)) {
+        svmCapabilities = 0;
+    }
+
+    std::vector<std::pair<ArgType, cl_uint>> kernels;
+    for (auto type : argTypes) {
+        for (auto count : argCounts) {
+            if ((type == ArgType::sampler && count > maxSamplers) || (type == ArgType::image && count > maxReadImageArgs) ||
+                (type == ArgType::svm && svmCapabilities == 0)) {
+                continue;
+            }
+            kernels.push_back({type, count});
+        }
+    }
+
+    auto context = clCreateContext(nullptr, 1, &device, nullptr, nullptr, &err);
+    CHECK(err);
+    auto queue = clCreateCommandQueue(context, device, 0, &err);
+    CHECK(err);
+
+    auto source = generateSource(kernels);
+    const char *sourcePtr = source.c_str();
+    auto program = clCreateProgramWithSource(context, 1, &sourcePtr, nullptr, &err);
+    CHECK(err);
+    CHECK(clBuildProgram(program, 1, &device, "", nullptr, nullptr));
+
+    auto buffer = clCreateBuffer(context, CL_MEM_READ_WRITE, 4096u, nullptr, &err);
+    CHECK(err);
+    void *svmPtr = svmCapabilities ? clSVMAlloc(context, CL_MEM_READ_WRITE, 4096u, 0u) : nullptr;
+    cl_image_format imageFormat = {CL_RGBA, CL_UNORM_INT8};
+    cl_image_desc imageDesc = {};
+    imageDesc.image_type = CL_MEM_OBJECT_IMAGE2D;
+    imageDesc.image_width = 16u;
+    imageDesc.image_height = 16u;
+    auto image = clCreateImage(context, CL_MEM_READ_ONLY, &imageFormat, &imageDesc, nullptr, &err);
+    CHECK(err);
+    auto sampler = clCreateSampler(context, CL_FALSE, CL_ADDRESS_CLAMP_TO_EDGE, CL_FILTER_NEAREST, &err);
+    CHECK(err);
+    cl_int scalar = 1;
+
+    auto setArg = [&](cl_kernel kernel, ArgType type, cl_uint index) {
+        switch (type) {
+        case ArgType::buffer:
+            CHECK(clSetKernelArg(kernel, index, sizeof(buffer), &buffer));
+            break;
+        case ArgType::svm:
+            CHECK(clSetKernelArgSVMPointer(kernel, index, svmPtr));
+            break;
+        case ArgType::image:
+            CHECK(clSetKernelArg(kernel, index, sizeof(image), &image));
+            break;
+        case ArgType::sampler:
+            CHECK(clSetKernelArg(kernel, index, sizeof(sampler), &sampler));
+            break;
+        default:
+            CHECK(clSetKernelArg(kernel, index, sizeof(scalar), &scalar));
+            break;
+        }
+    };
+
+    const size_t globalSizes[3][3] = {{256u, 1u, 1u}, {16u, 16u, 1u}, {8u, 8u, 4u}};
+    const size_t localSizes[3][3] = {{64u, 1u, 1u}, {8u, 8u, 1u}, {4u, 4u, 4u}};
+
+    std::vector<Result> results;
+    for (auto &kernelDesc : kernels) {
+        auto kernelName = getKernelName(kernelDesc.first, kernelDesc.second);
+        auto kernel = clCreateKernel(program, kernelName.c_str(), &err);
+        CHECK(err);
+
+        for (cl_uint workDim = 1; workDim <= 3; workDim++) {
+            for (bool explicitLws : {false, true}) {
+                std::vector<double> setArgsSamples;
+                std::vector<double> enqueueSamples;
+                for (size_t i = 0; i < iterations; i++) {
+                    auto start = Clock::now();
+                    for (cl_uint argIndex = 0; argIndex < kernelDesc.second; argIndex++) {
+                        setArg(kernel, kernelDesc.first, argIndex);
+                    }
+                    auto argsSet = Clock::now();
+                    CHECK(clEnqueueNDRangeKernel(queue, kernel, workDim, nullptr, globalSizes[workDim - 1],
+                                                 explicitLws ? localSizes[workDim - 1] : nullptr, 0, nullptr, nullptr));
+                    auto enqueued = Clock::now();
+                    setArgsSamples.push_back(std::chrono::duration<double, std::micro>(argsSet - start).count());
+                    enqueueSamples.push_back(std::chrono::duration<double, std::micro>(enqueued - argsSet).count());
+                }
+                CHECK(clFinish(queue));
+                results.push_back({getArgTypeName(kernelDesc.first), kernelDesc.second, workDim, explicitLws,
+                                   median(setArgsSamples), median(enqueueSamples)});
+            }
+        }
+        CHECK(clReleaseKernel(kernel));
+    }
+
+    CHECK(clReleaseSampler(sampler));
+    CHECK(clReleaseMemObject(image));
+    if (svmPtr) {
+        clSVMFree(context, svmPtr);
+    }
+    CHECK(clReleaseMemObject(buffer));
+    CHECK(clReleaseProgram(program));
+    CHECK(clReleaseCommandQueue(queue));
+    CHECK(clReleaseContext(context));
+
+    writeBenchmarkOutput(argc, argv, toJson(results, iterations));
+    return 0;
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,10 +25,12 @@
 #include "opencl/test/unit_test/api/cl_enqueue_write_image_tests.inl"
 #include "opencl/test/unit_test/api/cl_finish_tests.inl"
 #include "opencl/test/unit_test/api/cl_flush_tests.inl"
+#include "opencl/test/unit_test/api/cl_get_command_queue_submission_statistics_intel_tests.inl"
 #include "opencl/test/unit_test/api/cl_get_context_info_tests.inl"
 #include "opencl/test/unit_test/api/cl_get_device_and_host_timer.inl"
 #include "opencl/test/unit_test/api/cl_get_device_ids_tests.inl"
 #include "opencl/test/unit_test/api/cl_get_device_info_tests.inl"
+#include "opencl/test/unit_test/api/cl_get_device_memory_usage_intel_tests.inl"
 #include "opencl/test/unit_test/api/cl_get_event_profiling_info_tests.inl"
 #include "opencl/test/unit_test/api/cl_get_extension_function_address_for_platform_tests.inl"
 #include "opencl/test/unit_test/api/cl_get_extension_function_address_tests.inl"
@@ -15,6 +15,7 @@
 #include "opencl/source/program/program.h"
 #include "opencl/test/unit_test/helpers/kernel_binary_helper.h"
 #include "opencl/test/unit_test/mocks/mock_compilers.h"
+#include "opencl/test/unit_test/mocks/mock_program.h"
 
 #include "cl_api_tests.h"
 
@@ -309,6 +310,104 @@ TEST_F(clBuildProgramTests, GivenValidCallbackInputWhenBuildProgramThenCallbackI
     EXPECT_EQ(CL_SUCCESS, retVal);
 }
 
+TEST_F(clBuildProgramTests, GivenAsyncProgramBuildEnabledAndValidCallbackWhenBuildProgramThenProgramIsBuiltInBackgroundAndCallbackIsInvoked) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableAsyncProgramBuild.set(1);
+
+    cl_program pProgram = nullptr;
+    cl_int binaryStatus = CL_SUCCESS;
+    size_t binarySize = 0;
+    std::string testFile;
+    retrieveBinaryKernelFilename(testFile, "CopyBuffer_simd16_", ".bin");
+
+    auto pBinary = loadDataFromFile(
+        testFile.c_str(),
+        binarySize);
+
+    ASSERT_NE(0u, binarySize);
+    ASSERT_NE(nullptr, pBinary);
+    const unsigned char *binaries[1] = {reinterpret_cast<const unsigned char *>(pBinary.get())};
+    pProgram = clCreateProgramWithBinary(
+        pContext,
+        1,
+        &testedClDevice,
+        &binarySize,
+        binaries,
+        &binaryStatus,
+        &retVal);
+
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    EXPECT_NE(nullptr, pProgram);
+
+    auto compilerInterface = castToObject<ClDevice>(testedClDevice)->getDevice().getCompilerInterface();
+    ASSERT_NE(nullptr, compilerInterface);
+
+    char userData = 0;
+
+    retVal = clRetainProgram(pProgram);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    retVal = clBuildProgram(
+        pProgram,
+        1,
+        &testedClDevice,
+        nullptr,
+        notifyFuncProgram,
+        &userData);
+
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    compilerInterface->drainBuildJobs();
+    EXPECT_EQ('a', userData);
+
+    cl_build_status buildStatus = CL_BUILD_NONE;
+    retVal = clGetProgramBuildInfo(pProgram, testedClDevice, CL_PROGRAM_BUILD_STATUS, sizeof(buildStatus), &buildStatus, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(CL_BUILD_SUCCESS, buildStatus);
+
+    retVal = clReleaseProgram(pProgram);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    retVal = clReleaseProgram(pProgram);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+}
+
+TEST_F(clBuildProgramTests, GivenAsyncProgramBuildEnabledAndBuildInProgressWhenBuildProgramThenInvalidOperationIsReturned) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableAsyncProgramBuild.set(1);
+
+    auto pMockProgram = std::make_unique<MockProgram>(pContext, false, toClDeviceVector(*pDevice));
+    pMockProgram->setBuildStatus(CL_BUILD_IN_PROGRESS);
+
+    char userData = 0;
+    retVal = clBuildProgram(
+        pMockProgram.get(),
+        1,
+        &testedClDevice,
+        nullptr,
+        notifyFuncProgram,
+        &userData);
+
+    EXPECT_EQ(CL_INVALID_OPERATION, retVal);
+    EXPECT_EQ(0, userData);
+}
+
+TEST_F(clBuildProgramTests, GivenAsyncProgramBuildEnabledAndBuildStartedByAnotherThreadWhenBuildProgramThenInvalidOperationIsReturnedAndStatusIsKept) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableAsyncProgramBuild.set(1);
+
+    auto pMockProgram = std::make_unique<MockProgram>(pContext, false, toClDeviceVector(*pDevice));
+    pMockProgram->buildInProgress = true;
+
+    char userData = 0;
+    retVal = clBuildProgram(pMockProgram.get(), 1, &testedClDevice, nullptr, notifyFuncProgram, &userData);
+    EXPECT_EQ(CL_INVALID_OPERATION, retVal);
+    retVal = clBuildProgram(pMockProgram.get(), 1, &testedClDevice, nullptr, nullptr, nullptr);
+    EXPECT_EQ(CL_INVALID_OPERATION, retVal);
+
+    EXPECT_EQ(0, userData);
+    EXPECT_EQ(CL_BUILD_NONE, pMockProgram->deviceBuildInfos[pDevice].buildStatus);
+}
+
 TEST_F(clBuildProgramTests, givenProgramWhenBuildingForInvalidDevicesInputThenInvalidDeviceErrorIsReturned) {
     cl_program pProgram = nullptr;
     size_t sourceSize = 0;
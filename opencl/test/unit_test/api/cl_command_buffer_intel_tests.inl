@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+
+#include "opencl/source/command_queue/cl_command_buffer.h"
+#include "opencl/source/kernel/multi_device_kernel.h"
+#include "opencl/test/unit_test/libult/ult_command_stream_receiver.h"
+#include "opencl/test/unit_test/mocks/mock_kernel.h"
+#include "test.h"
+
+#include "cl_api_tests.h"
+
+using namespace NEO;
+
+using clCommandBufferINTELTests = api_tests;
+
+namespace ULT {
+
+TEST_F(clCommandBufferINTELTests, GivenInvalidCommandQueueWhenCreatingCommandBufferThenErrorIsReturned) {
+    auto commandBuffer = clCreateCommandBufferINTEL(nullptr, &retVal);
+    EXPECT_EQ(CL_INVALID_COMMAND_QUEUE, retVal);
+    EXPECT_EQ(nullptr, commandBuffer);
+}
+
+TEST_F(clCommandBufferINTELTests, GivenOutOfOrderQueueWhenCreatingCommandBufferThenErrorIsReturned) {
+    pCommandQueue->setOoqEnabled();
+    auto commandBuffer = clCreateCommandBufferINTEL(pCommandQueue, &retVal);
+    EXPECT_EQ(CL_INVALID_COMMAND_QUEUE, retVal);
+    EXPECT_EQ(nullptr, commandBuffer);
+}
+
+TEST_F(clCommandBufferINTELTests, GivenInvalidCommandBufferWhenCallingCommandBufferFunctionsThenInvalidValueIsReturned) {
+    size_t gws = 1;
+    EXPECT_EQ(CL_INVALID_VALUE, clCommandNDRangeKernelINTEL(nullptr, pMultiDeviceKernel, 1, nullptr, &gws, nullptr, nullptr));
+    EXPECT_EQ(CL_INVALID_VALUE, clCommandBufferSetKernelArgINTEL(nullptr, 0, 0, 0, nullptr));
+    EXPECT_EQ(CL_INVALID_VALUE, clFinalizeCommandBufferINTEL(nullptr));
+    EXPECT_EQ(CL_INVALID_VALUE, clEnqueueCommandBufferINTEL(nullptr, 0, nullptr, nullptr));
+    EXPECT_EQ(CL_INVALID_VALUE, clReleaseCommandBufferINTEL(nullptr));
+}
+
+TEST_F(clCommandBufferINTELTests, GivenCommandBufferWhenRecordingInvalidCommandThenErrorIsReturned) {
+    auto commandBuffer = clCreateCommandBufferINTEL(pCommandQueue, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    size_t gws = 1;
+    EXPECT_EQ(CL_INVALID_KERNEL, clCommandNDRangeKernelINTEL(commandBuffer, nullptr, 1, nullptr, &gws, nullptr, nullptr));
+    EXPECT_EQ(CL_INVALID_WORK_DIMENSION, clCommandNDRangeKernelINTEL(commandBuffer, pMultiDeviceKernel, 4, nullptr, &gws, nullptr, nullptr));
+    EXPECT_EQ(CL_INVALID_GLOBAL_WORK_SIZE, clCommandNDRangeKernelINTEL(commandBuffer, pMultiDeviceKernel, 1, nullptr, nullptr, nullptr, nullptr));
+    EXPECT_EQ(CL_INVALID_VALUE, clCommandBufferSetKernelArgINTEL(commandBuffer, 0, 0, 0, nullptr));
+    EXPECT_EQ(0u, castToObject<ClCommandBuffer>(commandBuffer)->getCommandsCount());
+
+    EXPECT_EQ(CL_SUCCESS, clReleaseCommandBufferINTEL(commandBuffer));
+}
+
+TEST_F(clCommandBufferINTELTests, GivenNotFinalizedCommandBufferWhenEnqueuingThenInvalidOperationIsReturned) {
+    auto commandBuffer = clCreateCommandBufferINTEL(pCommandQueue, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    EXPECT_EQ(CL_INVALID_OPERATION, clEnqueueCommandBufferINTEL(commandBuffer, 0, nullptr, nullptr));
+
+    EXPECT_EQ(CL_SUCCESS, clReleaseCommandBufferINTEL(commandBuffer));
+}
+
+TEST_F(clCommandBufferINTELTests, GivenFinalizedCommandBufferWhenRecordingOrFinalizingAgainThenInvalidOperationIsReturned) {
+    auto commandBuffer = clCreateCommandBufferINTEL(pCommandQueue, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    EXPECT_EQ(CL_SUCCESS, clFinalizeCommandBufferINTEL(commandBuffer));
+    EXPECT_TRUE(castToObject<ClCommandBuffer>(commandBuffer)->isFinalized());
+    EXPECT_EQ(CL_INVALID_OPERATION, clFinalizeCommandBufferINTEL(commandBuffer));
+
+    size_t gws = 1;
+    EXPECT_EQ(CL_INVALID_OPERATION, clCommandNDRangeKernelINTEL(commandBuffer, pMultiDeviceKernel, 1, nullptr, &gws, nullptr, nullptr));
+
+    EXPECT_EQ(CL_SUCCESS, clReleaseCommandBufferINTEL(commandBuffer));
+}
+
+TEST_F(clCommandBufferINTELTests, GivenFinalizedCommandBufferWhenEnqueuedManyTimesThenSuccessIsReturnedAndDispatchModeIsNotChanged) {
+    auto commandBuffer = clCreateCommandBufferINTEL(pCommandQueue, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(pCommandQueue, castToObject<ClCommandBuffer>(commandBuffer)->getCommandQueue());
+    EXPECT_EQ(CL_SUCCESS, clFinalizeCommandBufferINTEL(commandBuffer));
+
+    auto dispatchMode = pCommandQueue->getGpgpuCommandStreamReceiver().getDispatchMode();
+    for (int replay = 0; replay < 3; replay++) {
+        EXPECT_EQ(CL_SUCCESS, clEnqueueCommandBufferINTEL(commandBuffer, 0, nullptr, nullptr));
+    }
+    EXPECT_EQ(dispatchMode, pCommandQueue->getGpgpuCommandStreamReceiver().getDispatchMode());
+
+    EXPECT_EQ(CL_SUCCESS, clReleaseCommandBufferINTEL(commandBuffer));
+}
+
+HWTEST_F(clCommandBufferINTELTests, GivenRecordedNDRangesWhenCommandBufferIsEnqueuedThenAllLaunchesAreSentInSingleSubmission) {
+    auto &csr = pCommandQueue->getGpgpuCommandStreamReceiver();
+    auto &ultCsr = static_cast<UltCommandStreamReceiver<FamilyType> &>(csr);
+    csr.overrideDispatchPolicy(DispatchMode::ImmediateDispatch);
+
+    auto commandBuffer = clCreateCommandBufferINTEL(pCommandQueue, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    size_t gws = 1;
+    cl_uint commandIndex = 0;
+    EXPECT_EQ(CL_SUCCESS, clCommandNDRangeKernelINTEL(commandBuffer, pMultiDeviceKernel, 1, nullptr, &gws, nullptr, &commandIndex));
+    EXPECT_EQ(0u, commandIndex);
+    EXPECT_EQ(CL_SUCCESS, clCommandNDRangeKernelINTEL(commandBuffer, pMultiDeviceKernel, 1, nullptr, &gws, nullptr, &commandIndex));
+    EXPECT_EQ(1u, commandIndex);
+    EXPECT_EQ(CL_SUCCESS, clFinalizeCommandBufferINTEL(commandBuffer));
+
+    auto taskCountBeforeReplay = csr.peekTaskCount();
+    auto flushCountBeforeReplay = ultCsr.flushCalledCount;
+    cl_event event = nullptr;
+    EXPECT_EQ(CL_SUCCESS, clEnqueueCommandBufferINTEL(commandBuffer, 0, nullptr, &event));
+
+    EXPECT_EQ(taskCountBeforeReplay + 2, csr.peekTaskCount());
+    EXPECT_EQ(flushCountBeforeReplay + 1, ultCsr.flushCalledCount);
+    EXPECT_EQ(DispatchMode::ImmediateDispatch, csr.getDispatchMode());
+    ASSERT_NE(nullptr, event);
+    EXPECT_EQ(csr.peekTaskCount(), castToObject<Event>(event)->peekTaskCount());
+
+    EXPECT_EQ(CL_SUCCESS, clReleaseEvent(event));
+    EXPECT_EQ(CL_SUCCESS, clReleaseCommandBufferINTEL(commandBuffer));
+}
+
+TEST_F(clCommandBufferINTELTests, GivenRecordedNDRangeWhenSettingKernelArgOnCommandThenOnlyRecordedKernelIsPatched) {
+    MockKernelWithInternals mockKernel(*pDevice, pContext, true);
+    memset(mockKernel.crossThreadData, 0, sizeof(mockKernel.crossThreadData));
+    // the recorded clone allocates its cross thread data from the kernel descriptor
+    mockKernel.kernelInfo.kernelDescriptor.kernelAttributes.crossThreadDataSize = sizeof(mockKernel.crossThreadData);
+    auto commandBuffer = clCreateCommandBufferINTEL(pCommandQueue, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    size_t gws = 1;
+    EXPECT_EQ(CL_SUCCESS, clCommandNDRangeKernelINTEL(commandBuffer, mockKernel.mockMultiDeviceKernel, 1, nullptr, &gws, nullptr, nullptr));
+
+    auto recordedKernel = castToObject<ClCommandBuffer>(commandBuffer)->getRecordedKernel(0u);
+    ASSERT_NE(nullptr, recordedKernel);
+    EXPECT_NE(mockKernel.mockMultiDeviceKernel, recordedKernel);
+
+    uint32_t argValue = 0x1234;
+    EXPECT_EQ(CL_INVALID_ARG_INDEX, clCommandBufferSetKernelArgINTEL(commandBuffer, 0, 2, sizeof(argValue), &argValue));
+    EXPECT_EQ(CL_SUCCESS, clCommandBufferSetKernelArgINTEL(commandBuffer, 0, 0, sizeof(argValue), &argValue));
+
+    auto rootDeviceIndex = pDevice->getRootDeviceIndex();
+    auto recordedCrossThreadData = recordedKernel->getKernel(rootDeviceIndex)->getCrossThreadData(rootDeviceIndex);
+    auto sourceCrossThreadData = mockKernel.mockKernel->getCrossThreadData(rootDeviceIndex);
+    EXPECT_EQ(0, memcmp(recordedCrossThreadData, &argValue, sizeof(argValue)));
+    EXPECT_NE(0, memcmp(sourceCrossThreadData, &argValue, sizeof(argValue)));
+
+    EXPECT_EQ(CL_SUCCESS, clReleaseCommandBufferINTEL(commandBuffer));
+}
+} // namespace ULT
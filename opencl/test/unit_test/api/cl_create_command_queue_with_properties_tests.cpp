@@ -415,6 +415,24 @@ HWTEST_F(clCreateCommandQueueWithPropertiesApi, GivenLowPriorityWhenCreatingComm
     clReleaseCommandQueue(cmdQ);
 }
 
+HWTEST_F(clCreateCommandQueueWithPropertiesApi, GivenHighPriorityEngineEnabledWhenCreatingHighPriorityCommandQueueThenHighPriorityEngineIsSelected) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableHighPriorityEngine.set(1);
+
+    auto pClDevice = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    MockContext context{pClDevice.get()};
+
+    cl_queue_properties properties[] = {CL_QUEUE_PRIORITY_KHR, CL_QUEUE_PRIORITY_HIGH_KHR, 0};
+    auto cmdQ = clCreateCommandQueueWithProperties(&context, pClDevice.get(), properties, nullptr);
+
+    auto commandQueueObj = castToObject<CommandQueue>(cmdQ);
+    auto &osContext = commandQueueObj->getGpgpuCommandStreamReceiver().getOsContext();
+    EXPECT_EQ(getChosenEngineType(pClDevice->getHardwareInfo()), osContext.getEngineType());
+    EXPECT_TRUE(osContext.isHighPriority());
+
+    clReleaseCommandQueue(cmdQ);
+}
+
 TEST_F(clCreateCommandQueueWithPropertiesApi, GivenCommandQueueCreatedWithNullPropertiesWhenQueryingPropertiesArrayThenNothingIsReturned) {
     cl_int retVal = CL_SUCCESS;
     auto commandQueue = clCreateCommandQueueWithProperties(pContext, testedClDevice, nullptr, &retVal);
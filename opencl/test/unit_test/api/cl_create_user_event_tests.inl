@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -126,4 +126,54 @@ TEST_F(clCreateUserEventTests, GivenUserEventWithErrorStatusWhenWaitingForUserEv
     retVal = clReleaseEvent(userEvent);
     EXPECT_EQ(CL_SUCCESS, retVal);
 }
+
+TEST_F(clCreateUserEventTests, GivenOneCompleteUserEventWhenWaitingForAnyEventThenItsIndexIsReturned) {
+    cl_event userEvents[2] = {clCreateUserEvent(pContext, &retVal), clCreateUserEvent(pContext, &retVal)};
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    retVal = clSetUserEventStatus(userEvents[1], CL_COMPLETE);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    cl_uint signaledIndex = 0u;
+    retVal = clWaitForAnyEventINTEL(2, userEvents, &signaledIndex);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(1u, signaledIndex);
+
+    clSetUserEventStatus(userEvents[0], CL_COMPLETE);
+    clReleaseEvent(userEvents[0]);
+    clReleaseEvent(userEvents[1]);
+}
+
+TEST_F(clCreateUserEventTests, GivenUserEventWithErrorStatusWhenWaitingForAnyEventThenClExecStatusErrorForEventsInWaitListErrorIsReturned) {
+    auto userEvent = clCreateUserEvent(pContext, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    retVal = clSetUserEventStatus(userEvent, -1);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    retVal = clWaitForAnyEventINTEL(1, &userEvent, nullptr);
+    EXPECT_EQ(CL_EXEC_STATUS_ERROR_FOR_EVENTS_IN_WAIT_LIST, retVal);
+
+    clReleaseEvent(userEvent);
+}
+
+TEST_F(clCreateUserEventTests, GivenInvalidInputsWhenWaitingForAnyEventThenErrorIsReturned) {
+    cl_event event = nullptr;
+    EXPECT_EQ(CL_INVALID_VALUE, clWaitForAnyEventINTEL(0, &event, nullptr));
+    EXPECT_EQ(CL_INVALID_VALUE, clWaitForAnyEventINTEL(1, nullptr, nullptr));
+    EXPECT_EQ(CL_INVALID_EVENT, clWaitForAnyEventINTEL(1, &event, nullptr));
+}
+
+TEST_F(clCreateUserEventTests, GivenEventsFromDifferentContextsWhenWaitingForAnyEventThenInvalidContextErrorIsReturned) {
+    auto otherContext = clCreateContext(nullptr, 1u, &testedClDevice, nullptr, nullptr, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    cl_event userEvents[2] = {clCreateUserEvent(pContext, &retVal), clCreateUserEvent(otherContext, &retVal)};
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    EXPECT_EQ(CL_INVALID_CONTEXT, clWaitForAnyEventINTEL(2, userEvents, nullptr));
+
+    clReleaseEvent(userEvents[0]);
+    clReleaseEvent(userEvents[1]);
+    clReleaseContext(otherContext);
+}
 } // namespace ULT
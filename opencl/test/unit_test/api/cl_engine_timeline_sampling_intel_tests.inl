@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/command_stream/gpu_timeline_sampler.h"
+
+#include "cl_api_tests.h"
+
+using namespace NEO;
+
+using clEngineTimelineSamplingTests = api_tests;
+
+namespace ULT {
+
+TEST_F(clEngineTimelineSamplingTests, GivenInvalidInputWhenUsingTimelineSamplingThenErrorIsReturned) {
+    cl_engine_timeline_sample_intel sample = {};
+    cl_uint numSamples = 0u;
+    EXPECT_EQ(CL_INVALID_COMMAND_QUEUE, clSetEngineTimelineSamplingINTEL(nullptr, 1u));
+    EXPECT_EQ(CL_INVALID_COMMAND_QUEUE, clGetEngineTimelineSamplesINTEL(nullptr, 1u, &sample, &numSamples));
+    EXPECT_EQ(CL_INVALID_VALUE, clGetEngineTimelineSamplesINTEL(pCommandQueue, 1u, nullptr, &numSamples));
+    EXPECT_EQ(CL_INVALID_VALUE, clGetEngineTimelineSamplesINTEL(pCommandQueue, 0u, nullptr, nullptr));
+}
+
+TEST_F(clEngineTimelineSamplingTests, GivenCompletedSamplesWhenGettingTimelineSamplesThenNewestSamplesAreReturned) {
+    cl_uint numSamples = 1u;
+    EXPECT_EQ(CL_SUCCESS, clGetEngineTimelineSamplesINTEL(pCommandQueue, 0u, nullptr, &numSamples));
+    EXPECT_EQ(0u, numSamples);
+
+    EXPECT_EQ(CL_SUCCESS, clSetEngineTimelineSamplingINTEL(pCommandQueue, 1u));
+    auto &csr = pCommandQueue->getGpgpuCommandStreamReceiver();
+    auto sampler = csr.getGpuTimelineSampler();
+    ASSERT_NE(nullptr, sampler);
+    auto firstTaskCount = csr.peekTaskCount() + 1;
+    EXPECT_TRUE(sampler->startSample(firstTaskCount));
+    EXPECT_TRUE(sampler->startSample(firstTaskCount + 1));
+    *csr.getTagAddress() = firstTaskCount + 1;
+
+    EXPECT_EQ(CL_SUCCESS, clGetEngineTimelineSamplesINTEL(pCommandQueue, 0u, nullptr, &numSamples));
+    EXPECT_EQ(2u, numSamples);
+
+    cl_engine_timeline_sample_intel sample = {};
+    EXPECT_EQ(CL_SUCCESS, clGetEngineTimelineSamplesINTEL(pCommandQueue, 1u, &sample, &numSamples));
+    EXPECT_EQ(1u, numSamples);
+    EXPECT_EQ(firstTaskCount + 1, sample.taskCount);
+}
+
+TEST_F(clEngineTimelineSamplingTests, GivenSamplingEnabledThroughOneQueueWhenGettingSamplesThroughAnotherQueueOnSameEngineThenSamplesAreShared) {
+    auto otherQueue = std::make_unique<MockCommandQueue>(pContext, pDevice, nullptr);
+    auto &csr = pCommandQueue->getGpgpuCommandStreamReceiver();
+    ASSERT_EQ(&csr, &otherQueue->getGpgpuCommandStreamReceiver());
+
+    EXPECT_EQ(CL_SUCCESS, clSetEngineTimelineSamplingINTEL(pCommandQueue, 1u));
+    auto sampler = csr.getGpuTimelineSampler();
+    ASSERT_NE(nullptr, sampler);
+    auto taskCount = csr.peekTaskCount() + 1;
+    EXPECT_TRUE(sampler->startSample(taskCount));
+    *csr.getTagAddress() = taskCount;
+
+    cl_engine_timeline_sample_intel sample = {};
+    cl_uint numSamples = 0u;
+    EXPECT_EQ(CL_SUCCESS, clGetEngineTimelineSamplesINTEL(otherQueue.get(), 1u, &sample, &numSamples));
+    EXPECT_EQ(1u, numSamples);
+    EXPECT_EQ(taskCount, sample.taskCount);
+}
+} // namespace ULT
@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+
+#include "cl_api_tests.h"
+
+using namespace NEO;
+
+using clGetCommandQueueSubmissionStatisticsTests = api_tests;
+
+namespace ULT {
+
+TEST_F(clGetCommandQueueSubmissionStatisticsTests, GivenInvalidInputWhenGettingSubmissionStatisticsThenErrorIsReturned) {
+    cl_queue_submission_statistics_intel statistics = {};
+    retVal = clGetCommandQueueSubmissionStatisticsINTEL(nullptr, CL_FALSE, &statistics);
+    EXPECT_EQ(CL_INVALID_COMMAND_QUEUE, retVal);
+
+    retVal = clGetCommandQueueSubmissionStatisticsINTEL(pCommandQueue, CL_FALSE, nullptr);
+    EXPECT_EQ(CL_INVALID_VALUE, retVal);
+}
+
+TEST_F(clGetCommandQueueSubmissionStatisticsTests, GivenCountersUpdatedOnGpgpuEngineWhenGettingSubmissionStatisticsThenUpdatedValuesAreReturned) {
+    cl_queue_submission_statistics_intel statisticsBefore = {};
+    retVal = clGetCommandQueueSubmissionStatisticsINTEL(pCommandQueue, CL_FALSE, &statisticsBefore);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    auto &counters = pCommandQueue->getGpgpuCommandStreamReceiver().getSubmissionCounters();
+    SubmissionCounters::increment(counters.kmdNotifySleeps);
+    counters.recordWaitTime(2u);
+
+    cl_queue_submission_statistics_intel statistics = {};
+    retVal = clGetCommandQueueSubmissionStatisticsINTEL(pCommandQueue, CL_FALSE, &statistics);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(statisticsBefore.flushes, statistics.flushes);
+    EXPECT_EQ(statisticsBefore.kmdNotifySleeps + 1, statistics.kmdNotifySleeps);
+    EXPECT_EQ(statisticsBefore.waitTimeHistogram[2] + 1, statistics.waitTimeHistogram[2]);
+}
+} // namespace ULT
@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/memory_manager.h"
+
+#include "cl_api_tests.h"
+
+using namespace NEO;
+
+using clGetDeviceMemoryUsageTests = api_tests;
+
+namespace ULT {
+
+TEST_F(clGetDeviceMemoryUsageTests, GivenInvalidInputWhenGettingDeviceMemoryUsageThenErrorIsReturned) {
+    cl_device_memory_usage_intel memoryUsage = {};
+    retVal = clGetDeviceMemoryUsageINTEL(nullptr, CL_FALSE, &memoryUsage);
+    EXPECT_EQ(CL_INVALID_DEVICE, retVal);
+
+    retVal = clGetDeviceMemoryUsageINTEL(testedClDevice, CL_FALSE, nullptr);
+    EXPECT_EQ(CL_INVALID_VALUE, retVal);
+}
+
+TEST_F(clGetDeviceMemoryUsageTests, GivenAllocationWhenGettingDeviceMemoryUsageThenAllocationIsAccountedUntilFreed) {
+    auto memoryManager = pDevice->getMemoryManager();
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties({pDevice->getRootDeviceIndex(), MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER_HOST_MEMORY, pDevice->getDeviceBitfield()});
+    ASSERT_NE(nullptr, allocation);
+    auto localMemory = allocation->isAllocatedInLocalMemoryPool() ? CL_TRUE : CL_FALSE;
+    auto allocationSize = allocation->getUnderlyingBufferSize();
+
+    cl_device_memory_usage_intel usageWithAllocation = {};
+    retVal = clGetDeviceMemoryUsageINTEL(testedClDevice, localMemory, &usageWithAllocation);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_LE(allocationSize, usageWithAllocation.liveBytes);
+    EXPECT_LE(1u, usageWithAllocation.allocationCount);
+    EXPECT_LE(1u, usageWithAllocation.osHandleCount);
+
+    memoryManager->freeGraphicsMemory(allocation);
+
+    cl_device_memory_usage_intel usageAfterFree = {};
+    retVal = clGetDeviceMemoryUsageINTEL(testedClDevice, localMemory, &usageAfterFree);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(usageWithAllocation.liveBytes - allocationSize, usageAfterFree.liveBytes);
+    EXPECT_EQ(usageWithAllocation.allocationCount - 1u, usageAfterFree.allocationCount);
+    EXPECT_EQ(usageWithAllocation.peakBytes, usageAfterFree.peakBytes);
+}
+} // namespace ULT
@@ -1,10 +1,13 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/utilities/tag_allocator.h"
+
 #include "opencl/extensions/public/cl_ext_private.h"
 #include "opencl/source/command_queue/command_queue.h"
 #include "opencl/source/event/event.h"
@@ -268,6 +271,52 @@ TEST(clGetEventProfilingInfo, GivenPerfCountersEnabledWhenCheckingPerfCountersTh
     delete pEvent;
 }
 
+TEST_F(clEventProfilingTests, GivenInvalidArgumentsWhenGettingEventProfilingDurationsThenErrorIsReturned) {
+    cl_ulong duration = 0;
+    cl_event event = nullptr;
+    EXPECT_EQ(CL_INVALID_VALUE, clGetEventProfilingDurationsINTEL(0, &event, &duration));
+    EXPECT_EQ(CL_INVALID_VALUE, clGetEventProfilingDurationsINTEL(1, nullptr, &duration));
+    EXPECT_EQ(CL_INVALID_VALUE, clGetEventProfilingDurationsINTEL(1, &event, nullptr));
+    EXPECT_EQ(CL_INVALID_EVENT, clGetEventProfilingDurationsINTEL(1, &event, &duration));
+
+    MockEvent<Event> profilingDisabledEvent(pCommandQueue, CL_COMMAND_NDRANGE_KERNEL, 0, 0);
+    profilingDisabledEvent.setStatus(CL_COMPLETE);
+    event = &profilingDisabledEvent;
+    EXPECT_EQ(CL_PROFILING_INFO_NOT_AVAILABLE, clGetEventProfilingDurationsINTEL(1, &event, &duration));
+}
+
+TEST_F(clEventProfilingTests, GivenCompletedProfiledEventsWhenGettingEventProfilingDurationsThenDurationsInNanosecondsAreReturned) {
+    MockEvent<Event> gpuEvent(pCommandQueue, CL_COMMAND_NDRANGE_KERNEL, 0, 0);
+    gpuEvent.setProfilingEnabled(true);
+    gpuEvent.timeStampNode = pCommandQueue->getGpgpuCommandStreamReceiver().getEventTsAllocator()->getTag();
+    auto timestamps = gpuEvent.timeStampNode->tagForCpuAccess;
+    timestamps->GlobalStartTS = 100;
+    timestamps->GlobalEndTS = 1100;
+    timestamps->ContextStartTS = 100;
+    timestamps->ContextEndTS = 1100;
+    gpuEvent.setStatus(CL_COMPLETE);
+
+    MockEvent<Event> cpuEvent(pCommandQueue, CL_COMMAND_READ_BUFFER, 0, 0);
+    cpuEvent.setProfilingEnabled(true);
+    cpuEvent.setCPUProfilingPath(true);
+    cpuEvent.setStartTimeStamp();
+    cpuEvent.setEndTimeStamp();
+    cpuEvent.setStatus(CL_COMPLETE);
+
+    cl_event events[] = {&gpuEvent, &cpuEvent};
+    cl_ulong durations[2] = {};
+    EXPECT_EQ(CL_SUCCESS, clGetEventProfilingDurationsINTEL(2, events, durations));
+
+    auto resolution = pCommandQueue->getDevice().getDeviceInfo().profilingTimerResolution;
+    EXPECT_EQ(static_cast<cl_ulong>(1000 * resolution), durations[0]);
+
+    cl_ulong start = 0;
+    cl_ulong end = 0;
+    EXPECT_EQ(CL_SUCCESS, clGetEventProfilingInfo(events[1], CL_PROFILING_COMMAND_START, sizeof(start), &start, nullptr));
+    EXPECT_EQ(CL_SUCCESS, clGetEventProfilingInfo(events[1], CL_PROFILING_COMMAND_END, sizeof(end), &end, nullptr));
+    EXPECT_EQ(end - start, durations[1]);
+}
+
 class clEventProfilingWithPerfCountersTests : public DeviceInstrumentationFixture,
                                               public PerformanceCountersDeviceFixture,
                                               public ::testing::Test {
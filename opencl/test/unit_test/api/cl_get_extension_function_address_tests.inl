@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -183,6 +183,35 @@ TEST_F(clGetExtensionFunctionAddressTests, GivenClEnqueueNDCountKernelINTELWhenG
     EXPECT_EQ(retVal, reinterpret_cast<void *>(clEnqueueNDCountKernelINTEL));
 }
 
+TEST_F(clGetExtensionFunctionAddressTests, GivenClGetDeviceMemoryUsageINTELWhenGettingExtensionFunctionThenCorrectAddressIsReturned) {
+    auto retVal = clGetExtensionFunctionAddress("clGetDeviceMemoryUsageINTEL");
+    EXPECT_EQ(retVal, reinterpret_cast<void *>(clGetDeviceMemoryUsageINTEL));
+}
+
+TEST_F(clGetExtensionFunctionAddressTests, GivenClGetCommandQueueSubmissionStatisticsINTELWhenGettingExtensionFunctionThenCorrectAddressIsReturned) {
+    auto retVal = clGetExtensionFunctionAddress("clGetCommandQueueSubmissionStatisticsINTEL");
+    EXPECT_EQ(retVal, reinterpret_cast<void *>(clGetCommandQueueSubmissionStatisticsINTEL));
+}
+
+TEST_F(clGetExtensionFunctionAddressTests, GivenCommandBufferINTELFunctionsWhenGettingExtensionFunctionThenCorrectAddressesAreReturned) {
+    EXPECT_EQ(clGetExtensionFunctionAddress("clCreateCommandBufferINTEL"), reinterpret_cast<void *>(clCreateCommandBufferINTEL));
+    EXPECT_EQ(clGetExtensionFunctionAddress("clCommandNDRangeKernelINTEL"), reinterpret_cast<void *>(clCommandNDRangeKernelINTEL));
+    EXPECT_EQ(clGetExtensionFunctionAddress("clCommandBufferSetKernelArgINTEL"), reinterpret_cast<void *>(clCommandBufferSetKernelArgINTEL));
+    EXPECT_EQ(clGetExtensionFunctionAddress("clFinalizeCommandBufferINTEL"), reinterpret_cast<void *>(clFinalizeCommandBufferINTEL));
+    EXPECT_EQ(clGetExtensionFunctionAddress("clEnqueueCommandBufferINTEL"), reinterpret_cast<void *>(clEnqueueCommandBufferINTEL));
+    EXPECT_EQ(clGetExtensionFunctionAddress("clReleaseCommandBufferINTEL"), reinterpret_cast<void *>(clReleaseCommandBufferINTEL));
+}
+
+TEST_F(clGetExtensionFunctionAddressTests, GivenClWaitForAnyEventINTELWhenGettingExtensionFunctionThenCorrectAddressIsReturned) {
+    auto retVal = clGetExtensionFunctionAddress("clWaitForAnyEventINTEL");
+    EXPECT_EQ(retVal, reinterpret_cast<void *>(clWaitForAnyEventINTEL));
+}
+
+TEST_F(clGetExtensionFunctionAddressTests, GivenTimelineSamplingFunctionsWhenGettingExtensionFunctionThenCorrectAddressesAreReturned) {
+    EXPECT_EQ(clGetExtensionFunctionAddress("clSetEngineTimelineSamplingINTEL"), reinterpret_cast<void *>(clSetEngineTimelineSamplingINTEL));
+    EXPECT_EQ(clGetExtensionFunctionAddress("clGetEngineTimelineSamplesINTEL"), reinterpret_cast<void *>(clGetEngineTimelineSamplesINTEL));
+}
+
 TEST_F(clGetExtensionFunctionAddressTests, GivenCSlSetProgramSpecializationConstantWhenGettingExtensionFunctionThenCorrectAddressIsReturned) {
     auto retVal = clGetExtensionFunctionAddress("clSetProgramSpecializationConstant");
     EXPECT_EQ(retVal, reinterpret_cast<void *>(clSetProgramSpecializationConstant));
@@ -43,6 +43,7 @@
 #include "os_inc.h"
 #include "test_traits_common.h"
 
+#include <map>
 #include <string>
 
 using namespace NEO;
@@ -728,13 +729,76 @@ TEST_F(BuiltInTests, GivenCopyBufferToBufferWhenDispatchInfoIsCreatedThenSizeIsA
     size_t rightSize = (reinterpret_cast<uintptr_t>(dst.getCpuAddress()) + dst.getSize()) % MemoryConstants::cacheLineSize;
     EXPECT_EQ(0u, rightSize);
 
-    size_t middleElSize = sizeof(uint32_t) * 4;
+    size_t middleElSize = sizeof(uint32_t) * 16;
     size_t middleSize = dst.getSize() / middleElSize;
     EXPECT_EQ(Vec3<size_t>(middleSize, 1, 1), dispatchInfo->getGWS());
 
     EXPECT_TRUE(compareBuiltinOpParams(multiDispatchInfo.peekBuiltinOpParams(), builtinOpsParams));
 }
 
+TEST_F(BuiltInTests, givenSrcAlignedDifferentlyThanDstWhenCopyBufferToBufferDispatchInfoIsCreatedThenWideMiddleKernelIsUsedOnlyForCacheLineAlignedSrc) {
+    BuiltinDispatchInfoBuilder &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::CopyBufferToBuffer, *pClDevice);
+
+    auto size = 4 * MemoryConstants::cacheLineSize;
+    auto srcPtr = alignedMalloc(size + MemoryConstants::cacheLineSize, MemoryConstants::cacheLineSize);
+    auto dstPtr = alignedMalloc(size, MemoryConstants::cacheLineSize);
+
+    for (auto srcOffset : {size_t(0), size_t(16)}) {
+        BuiltinOpParams builtinOpsParams;
+        builtinOpsParams.srcPtr = ptrOffset(srcPtr, srcOffset);
+        builtinOpsParams.dstPtr = dstPtr;
+        builtinOpsParams.size = {size, 0, 0};
+
+        MultiDispatchInfo multiDispatchInfo(builtinOpsParams);
+        ASSERT_TRUE(builder.buildDispatchInfos(multiDispatchInfo));
+        ASSERT_EQ(1u, multiDispatchInfo.size());
+
+        auto dispatchInfo = multiDispatchInfo.begin();
+        auto &kernelName = dispatchInfo->getKernel()->getKernelInfo(rootDeviceIndex).kernelDescriptor.kernelMetadata.kernelName;
+        if (srcOffset == 0) {
+            EXPECT_EQ("CopyBufferToBufferMiddleWide", kernelName);
+            EXPECT_EQ(Vec3<size_t>(size / (sizeof(uint32_t) * 16), 1, 1), dispatchInfo->getGWS());
+        } else {
+            EXPECT_EQ("CopyBufferToBufferMiddle", kernelName);
+            EXPECT_EQ(Vec3<size_t>(size / (sizeof(uint32_t) * 4), 1, 1), dispatchInfo->getGWS());
+        }
+    }
+
+    alignedFree(srcPtr);
+    alignedFree(dstPtr);
+}
+
+TEST_F(BuiltInTests, givenBlockSizeBelowCacheLineWhenFillBufferDispatchInfoIsCreatedThenDwordMiddleKernelIsUsed) {
+    DebugManagerStateRestore restore;
+    BuiltinDispatchInfoBuilder &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::FillBuffer, *pClDevice);
+
+    AlignedBuffer pattern;
+    AlignedBuffer dst;
+
+    BuiltinOpParams builtinOpsParams;
+    builtinOpsParams.srcMemObj = &pattern;
+    builtinOpsParams.dstMemObj = &dst;
+    builtinOpsParams.size = {dst.getSize(), 0, 0};
+
+    for (auto blockSize : {-1, 16}) {
+        DebugManager.flags.OverrideBuiltinCopyFillBlockSize.set(blockSize);
+
+        MultiDispatchInfo multiDispatchInfo(builtinOpsParams);
+        ASSERT_TRUE(builder.buildDispatchInfos(multiDispatchInfo));
+        ASSERT_EQ(1u, multiDispatchInfo.size());
+
+        auto dispatchInfo = multiDispatchInfo.begin();
+        auto &kernelName = dispatchInfo->getKernel()->getKernelInfo(rootDeviceIndex).kernelDescriptor.kernelMetadata.kernelName;
+        if (blockSize == -1) {
+            EXPECT_EQ("FillBufferMiddleWide", kernelName);
+            EXPECT_EQ(Vec3<size_t>(dst.getSize() / (sizeof(uint32_t) * 16), 1, 1), dispatchInfo->getGWS());
+        } else {
+            EXPECT_EQ("FillBufferMiddle", kernelName);
+            EXPECT_EQ(Vec3<size_t>(dst.getSize() / sizeof(uint32_t), 1, 1), dispatchInfo->getGWS());
+        }
+    }
+}
+
 TEST_F(BuiltInTests, givenBigOffsetAndSizeWhenBuilderCopyBufferToBufferStatelessIsUsedThenParamsAreCorrect) {
 
     if (is32bit) {
@@ -954,7 +1018,7 @@ TEST_F(BuiltInTests, GivenReadBufferAlignedWhenDispatchInfoIsCreatedThenParamsAr
     size_t rightSize = (reinterpret_cast<uintptr_t>(dstPtr) + size) % MemoryConstants::cacheLineSize;
     EXPECT_EQ(0u, rightSize);
 
-    size_t middleElSize = sizeof(uint32_t) * 4;
+    size_t middleElSize = sizeof(uint32_t) * 16;
     size_t middleSize = size / middleElSize;
     EXPECT_EQ(Vec3<size_t>(middleSize, 1, 1), dispatchInfo->getGWS());
     EXPECT_TRUE(compareBuiltinOpParams(multiDispatchInfo.peekBuiltinOpParams(), builtinOpsParams));
@@ -989,7 +1053,7 @@ TEST_F(BuiltInTests, GivenWriteBufferAlignedWhenDispatchInfoIsCreatedThenParamsA
     size_t rightSize = (reinterpret_cast<uintptr_t>(srcPtr) + size) % MemoryConstants::cacheLineSize;
     EXPECT_EQ(0u, rightSize);
 
-    size_t middleElSize = sizeof(uint32_t) * 4;
+    size_t middleElSize = sizeof(uint32_t) * 16;
     size_t middleSize = size / middleElSize;
     EXPECT_EQ(Vec3<size_t>(middleSize, 1, 1), dispatchInfo->getGWS());
     EXPECT_TRUE(compareBuiltinOpParams(multiDispatchInfo.peekBuiltinOpParams(), builtinOpsParams));
@@ -1402,6 +1466,49 @@ TEST_F(BuiltInTests, GivenTypeInvalidWhenGettingBuiltinCodeThenKernelIsEmpty) {
     EXPECT_EQ(pDevice, code.targetDevice);
 }
 
+TEST_F(BuiltInTests, givenBuiltinsCompilerCacheEnabledWhenBuiltinBinaryIsCachedThenItIsLoadedPerBuiltinAndApi) {
+    struct CachingCompilerInterface : MockCompilerInterface {
+        bool cacheBinary(const std::string &fileHash, ArrayRef<const char> binary) override {
+            cachedBinaries[fileHash].assign(binary.begin(), binary.end());
+            return true;
+        }
+        std::unique_ptr<char[]> loadCachedBinary(const std::string &fileHash, size_t &binarySize) override {
+            binarySize = 0u;
+            auto cachedBinary = cachedBinaries.find(fileHash);
+            if (cachedBinary == cachedBinaries.end()) {
+                return nullptr;
+            }
+            binarySize = cachedBinary->second.size();
+            return makeCopy<char>(cachedBinary->second.data(), binarySize);
+        }
+        std::map<std::string, std::vector<char>> cachedBinaries;
+    };
+    DebugManagerStateRestore restore;
+    auto compilerInterface = new CachingCompilerInterface();
+    pDevice->getExecutionEnvironment()->rootDeviceEnvironments[rootDeviceIndex]->compilerInterface.reset(compilerInterface);
+
+    BuiltinsLib builtinsLib;
+    const char binary[] = "builtin binary";
+    EXPECT_FALSE(builtinsLib.cacheBuiltinBinary(EBuiltInOps::FillBuffer, "", "ocl", *pDevice, ArrayRef<const char>(binary, sizeof(binary))));
+    EXPECT_TRUE(compilerInterface->cachedBinaries.empty());
+
+    DebugManager.flags.EnableBuiltinsCompilerCache.set(1);
+    EXPECT_EQ(BuiltinCode::ECodeType::INVALID, builtinsLib.getCachedBuiltinCode(EBuiltInOps::FillBuffer, "", "ocl", *pDevice).type);
+    EXPECT_TRUE(builtinsLib.cacheBuiltinBinary(EBuiltInOps::FillBuffer, "", "ocl", *pDevice, ArrayRef<const char>(binary, sizeof(binary))));
+
+    auto code = builtinsLib.getCachedBuiltinCode(EBuiltInOps::FillBuffer, "", "ocl", *pDevice);
+    EXPECT_EQ(BuiltinCode::ECodeType::Binary, code.type);
+    EXPECT_EQ(pDevice, code.targetDevice);
+    ASSERT_EQ(sizeof(binary), code.resource.size());
+    EXPECT_EQ(0, memcmp(binary, code.resource.data(), sizeof(binary)));
+
+    EXPECT_TRUE(builtinsLib.getCachedBuiltinCode(EBuiltInOps::FillBuffer, "", "ze", *pDevice).resource.empty());
+    EXPECT_TRUE(builtinsLib.getCachedBuiltinCode(EBuiltInOps::CopyBufferToBuffer, "", "ocl", *pDevice).resource.empty());
+
+    DebugManager.flags.RebuildPrecompiledKernels.set(true);
+    EXPECT_TRUE(builtinsLib.getCachedBuiltinCode(EBuiltInOps::FillBuffer, "", "ocl", *pDevice).resource.empty());
+}
+
 TEST_F(BuiltInTests, GivenBuiltinTypeSourceWhenGettingBuiltinResourceThenResourceSizeIsNonZero) {
     class MockBuiltinsLib : BuiltinsLib {
       public:
@@ -7,6 +7,7 @@
 
 #include "shared/source/built_ins/built_ins.h"
 #include "shared/source/built_ins/sip.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/test_files.h"
 #include "shared/test/common/mocks/mock_device.h"
 
@@ -43,6 +44,17 @@ TEST(Sip, givenDebuggingInactiveWhenSipTypeIsQueriedThenCsrSipTypeIsReturned) {
     EXPECT_EQ(SipKernelType::Csr, sipType);
 }
 
+TEST(Sip, givenDefaultSettingsWhenCheckingIfInitializationIsDeferredThenItIsDeferredOnlyWithoutDebugging) {
+    EXPECT_TRUE(SipKernel::isInitializationDeferred(false));
+    EXPECT_FALSE(SipKernel::isInitializationDeferred(true));
+
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.DeferSipKernelInitialization.set(0);
+    EXPECT_FALSE(SipKernel::isInitializationDeferred(false));
+    DebugManager.flags.DeferSipKernelInitialization.set(1);
+    EXPECT_TRUE(SipKernel::isInitializationDeferred(true));
+}
+
 TEST(DebugSip, givenDebuggingActiveWhenSipTypeIsQueriedThenDbgCsrSipTypeIsReturned) {
     auto sipType = SipKernel::getSipKernelType(renderCoreFamily, true);
     EXPECT_LE(SipKernelType::DbgCsr, sipType);
@@ -896,6 +896,79 @@ HWTEST_TEMPLATED_F(BlitAuxTranslationTests, givenBlitTranslationOnGfxAllocationW
     EXPECT_TRUE(ultCsr->recordedDispatchFlags.implicitFlush);
 }
 
+HWTEST_TEMPLATED_F(BlitAuxTranslationTests, givenReadOnlyBufferWhenEnqueueingThenLeaveItResolvedAndSkipTranslationsInNextEnqueue) {
+    using XY_COPY_BLT = typename FamilyType::XY_COPY_BLT;
+
+    auto buffer0 = createBuffer(1, true);
+    auto buffer1 = createBuffer(1, true);
+    setMockKernelArgs(std::array<Buffer *, 2>{{buffer0.get(), buffer1.get()}});
+    mockKernel->kernelInfo.kernelArgInfo.at(0).isReadOnly = true;
+
+    auto allocation0 = buffer0->getGraphicsAllocation(device->getRootDeviceIndex());
+    auto allocation1 = buffer1->getGraphicsAllocation(device->getRootDeviceIndex());
+
+    commandQueue->enqueueKernel(mockKernel->mockKernel, 1, nullptr, gws, lws, 0, nullptr, nullptr);
+
+    // AuxToNonAux for both buffers, NonAuxToAux only for the written one
+    auto cmdList = getCmdList<FamilyType>(bcsCsr->getCS(0), 0);
+    EXPECT_EQ(3u, findAll<XY_COPY_BLT *>(cmdList.begin(), cmdList.end()).size());
+    EXPECT_TRUE(allocation0->isAuxResolved());
+    EXPECT_FALSE(allocation1->isAuxResolved());
+
+    *bcsCsr->getTagAddress() = bcsCsr->peekTaskCount();
+    auto bcsOffset = bcsCsr->getCS(0).getUsed();
+
+    commandQueue->enqueueKernel(mockKernel->mockKernel, 1, nullptr, gws, lws, 0, nullptr, nullptr);
+
+    cmdList = getCmdList<FamilyType>(bcsCsr->getCS(0), bcsOffset);
+    auto bltCmds = findAll<XY_COPY_BLT *>(cmdList.begin(), cmdList.end());
+    ASSERT_EQ(2u, bltCmds.size());
+    for (auto &bltCmd : bltCmds) {
+        EXPECT_EQ(allocation1->getGpuAddress(), genCmdCast<XY_COPY_BLT *>(*bltCmd)->getDestinationBaseAddress());
+    }
+    EXPECT_TRUE(allocation0->isAuxResolved());
+}
+
+HWTEST_TEMPLATED_F(BlitAuxTranslationTests, givenResolvedBufferWhenUsedWithoutTranslationThenItIsNotResolvedAnymore) {
+    auto buffer = createBuffer(1, true);
+    setMockKernelArgs(std::array<Buffer *, 1>{{buffer.get()}});
+    mockKernel->kernelInfo.kernelArgInfo.at(0).isReadOnly = true;
+
+    auto allocation = buffer->getGraphicsAllocation(device->getRootDeviceIndex());
+
+    commandQueue->enqueueKernel(mockKernel->mockKernel, 1, nullptr, gws, lws, 0, nullptr, nullptr);
+    EXPECT_TRUE(allocation->isAuxResolved());
+
+    mockKernel->mockKernel->setAuxTranslationRequired(false);
+    mockKernel->mockKernel->resetAuxResolvedStateOfArgs(device->getRootDeviceIndex());
+    EXPECT_FALSE(allocation->isAuxResolved());
+
+    allocation->setAuxResolved(true);
+    auto otherBuffer = createBuffer(1, true);
+    BlitPropertiesContainer container;
+    container.push_back(BlitProperties::constructPropertiesForCopyBuffer(allocation, otherBuffer->getGraphicsAllocation(device->getRootDeviceIndex()),
+                                                                         0, 0, {1, 1, 1}, 0, 0, 0, 0, bcsCsr->getClearColorAllocation()));
+    bcsCsr->blitBuffer(container, true, false);
+    EXPECT_FALSE(allocation->isAuxResolved());
+}
+
+HWTEST_TEMPLATED_F(BlitAuxTranslationTests, givenSkippingResolvedTranslationsDisabledWhenEnqueueingReadOnlyBufferThenTranslateBothWays) {
+    using XY_COPY_BLT = typename FamilyType::XY_COPY_BLT;
+    DebugManager.flags.SkipResolvedAuxTranslation.set(0);
+
+    auto buffer = createBuffer(1, true);
+    setMockKernelArgs(std::array<Buffer *, 1>{{buffer.get()}});
+    mockKernel->kernelInfo.kernelArgInfo.at(0).isReadOnly = true;
+
+    commandQueue->enqueueKernel(mockKernel->mockKernel, 1, nullptr, gws, lws, 0, nullptr, nullptr);
+    *bcsCsr->getTagAddress() = bcsCsr->peekTaskCount();
+    commandQueue->enqueueKernel(mockKernel->mockKernel, 1, nullptr, gws, lws, 0, nullptr, nullptr);
+
+    auto cmdList = getCmdList<FamilyType>(bcsCsr->getCS(0), 0);
+    EXPECT_EQ(4u, findAll<XY_COPY_BLT *>(cmdList.begin(), cmdList.end()).size());
+    EXPECT_FALSE(buffer->getGraphicsAllocation(device->getRootDeviceIndex())->isAuxResolved());
+}
+
 using BlitEnqueueWithNoTimestampPacketTests = BlitEnqueueTests<0>;
 
 HWTEST_TEMPLATED_F(BlitEnqueueWithNoTimestampPacketTests, givenNoTimestampPacketsWritewhenEnqueueingBlitOperationThenEnginesAreSynchronized) {
@@ -1295,6 +1368,108 @@ HWTEST_TEMPLATED_F(BlitEnqueueTaskCountTests, givenEventWhenWaitingForCompletion
     clReleaseEvent(outEvent2);
 }
 
+HWTEST_TEMPLATED_F(BlitEnqueueTaskCountTests, givenSplitCopyEnabledWhenEnqueueingLargeCopyBufferThenPartsRunConcurrentlyAndEventWaitsForBoth) {
+    using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
+    DebugManager.flags.SplitCopyBufferBlitterPercentage.set(50);
+    DebugManager.flags.SplitCopyBufferMinSize.set(1);
+
+    auto srcBuffer = createBuffer(256, false);
+    auto dstBuffer = createBuffer(256, false);
+    auto ultBcsCsr = static_cast<UltCommandStreamReceiver<FamilyType> *>(bcsCsr);
+
+    cl_event outEvent;
+    commandQueue->enqueueCopyBuffer(srcBuffer.get(), dstBuffer.get(), 0, 0, 256, 0, nullptr, &outEvent);
+
+    auto &nodes = commandQueue->getTimestampPacketContainer()->peekNodes();
+    ASSERT_EQ(2u, nodes.size());
+    EXPECT_EQ(gpgpuCsr->getTimestampPacketAllocator(), nodes[0]->getAllocator());
+    EXPECT_EQ(bcsCsr->getTimestampPacketAllocator(), nodes[1]->getAllocator());
+
+    auto blitOutputAddress = TimestampPacketHelper::getContextEndGpuAddress(*nodes[1]);
+    auto cmdList = getCmdList<FamilyType>(commandQueue->getCS(0), 0);
+    for (auto &semaphore : findAll<MI_SEMAPHORE_WAIT *>(cmdList.begin(), cmdList.end())) {
+        EXPECT_NE(blitOutputAddress, genCmdCast<MI_SEMAPHORE_WAIT *>(*semaphore)->getSemaphoreGraphicsAddress());
+    }
+
+    clWaitForEvents(1, &outEvent);
+    EXPECT_EQ(bcsCsr->peekTaskCount(), ultBcsCsr->latestWaitForCompletionWithTimeoutTaskCount.load());
+
+    clReleaseEvent(outEvent);
+}
+
+HWTEST_TEMPLATED_F(BlitEnqueueTaskCountTests, givenOutOfOrderQueueWhenEnqueueingKernelAfterBlitThenWaitForBlitOnlyInBarrier) {
+    using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
+
+    cl_queue_properties properties[] = {CL_QUEUE_PROPERTIES, CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE, 0};
+    auto ooqCmdQ = std::make_unique<MockCommandQueueHw<FamilyType>>(bcsMockContext.get(), device.get(), properties);
+    auto buffer = createBuffer(1, false);
+    buffer->forceDisallowCPUCopy = true;
+    int hostPtr = 0;
+    size_t gws[] = {1, 0, 0};
+
+    ooqCmdQ->enqueueWriteBuffer(buffer.get(), false, 0, 1, &hostPtr, nullptr, 0, nullptr, nullptr);
+    auto &blitNodes = ooqCmdQ->timestampPacketContainer->peekNodes();
+    ASSERT_EQ(1u, blitNodes.size());
+    EXPECT_EQ(bcsCsr->getTimestampPacketAllocator(), blitNodes[0]->getAllocator());
+    auto blitOutputAddress = TimestampPacketHelper::getContextEndGpuAddress(*blitNodes[0]);
+
+    auto kernelStart = ooqCmdQ->getCS(0).getUsed();
+    ooqCmdQ->enqueueKernel(mockKernel->mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+    auto kernelCmdList = getCmdList<FamilyType>(ooqCmdQ->getCS(0), kernelStart);
+    for (auto &semaphore : findAll<MI_SEMAPHORE_WAIT *>(kernelCmdList.begin(), kernelCmdList.end())) {
+        EXPECT_NE(blitOutputAddress, genCmdCast<MI_SEMAPHORE_WAIT *>(*semaphore)->getSemaphoreGraphicsAddress());
+    }
+
+    auto barrierStart = ooqCmdQ->getCS(0).getUsed();
+    ooqCmdQ->enqueueBarrierWithWaitList(0, nullptr, nullptr);
+    auto barrierCmdList = getCmdList<FamilyType>(ooqCmdQ->getCS(0), barrierStart);
+    bool blitSemaphoreFound = false;
+    for (auto &semaphore : findAll<MI_SEMAPHORE_WAIT *>(barrierCmdList.begin(), barrierCmdList.end())) {
+        blitSemaphoreFound |= (blitOutputAddress == genCmdCast<MI_SEMAPHORE_WAIT *>(*semaphore)->getSemaphoreGraphicsAddress());
+    }
+    EXPECT_TRUE(blitSemaphoreFound);
+}
+
+HWTEST_TEMPLATED_F(BlitEnqueueTaskCountTests, givenOutOfOrderQueueBlockedByUserEventWhenEnqueueingBarrierAfterBlitThenWaitForBlitInBlockedBarrier) {
+    using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
+
+    cl_queue_properties properties[] = {CL_QUEUE_PROPERTIES, CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE, 0};
+    auto ooqCmdQ = std::make_unique<MockCommandQueueHw<FamilyType>>(bcsMockContext.get(), device.get(), properties);
+    auto buffer = createBuffer(1, false);
+    buffer->forceDisallowCPUCopy = true;
+    int hostPtr = 0;
+
+    auto ultGpgpuCsr = static_cast<UltCommandStreamReceiver<FamilyType> *>(gpgpuCsr);
+    ultGpgpuCsr->storeMakeResidentAllocations = true;
+
+    ooqCmdQ->enqueueWriteBuffer(buffer.get(), false, 0, 1, &hostPtr, nullptr, 0, nullptr, nullptr);
+    auto blitNode = ooqCmdQ->timestampPacketContainer->peekNodes()[0];
+    EXPECT_EQ(bcsCsr->getTimestampPacketAllocator(), blitNode->getAllocator());
+    auto blitOutputAddress = TimestampPacketHelper::getContextEndGpuAddress(*blitNode);
+
+    UserEvent userEvent;
+    cl_event waitlist[] = {&userEvent};
+    ooqCmdQ->enqueueMarkerWithWaitList(1, waitlist, nullptr);
+    ooqCmdQ->enqueueBarrierWithWaitList(0, nullptr, nullptr);
+    EXPECT_TRUE(ooqCmdQ->isQueueBlocked());
+
+    auto blockedCommandStream = ooqCmdQ->virtualEvent->peekCommand()->getCommandStream();
+    ASSERT_NE(nullptr, blockedCommandStream);
+    auto barrierCmdList = getCmdList<FamilyType>(*blockedCommandStream, 0);
+    bool blitSemaphoreFound = false;
+    for (auto &semaphore : findAll<MI_SEMAPHORE_WAIT *>(barrierCmdList.begin(), barrierCmdList.end())) {
+        blitSemaphoreFound |= (blitOutputAddress == genCmdCast<MI_SEMAPHORE_WAIT *>(*semaphore)->getSemaphoreGraphicsAddress());
+    }
+    EXPECT_TRUE(blitSemaphoreFound);
+
+    auto taskCountBeforeUnblocking = ultGpgpuCsr->peekTaskCount();
+    userEvent.setStatus(CL_COMPLETE);
+
+    EXPECT_FALSE(ooqCmdQ->isQueueBlocked());
+    EXPECT_EQ(taskCountBeforeUnblocking + 1, ultGpgpuCsr->peekTaskCount());
+    EXPECT_TRUE(ultGpgpuCsr->isMadeResident(blitNode->getBaseGraphicsAllocation(), ultGpgpuCsr->peekTaskCount()));
+}
+
 HWTEST_TEMPLATED_F(BlitEnqueueTaskCountTests, givenBufferDumpingEnabledWhenEnqueueingThenSetCorrectDumpOption) {
     auto buffer = createBuffer(1, false);
     buffer->forceDisallowCPUCopy = true;
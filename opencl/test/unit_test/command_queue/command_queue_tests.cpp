@@ -216,6 +216,23 @@ TEST(CommandQueue, GivenOOQwhenUpdateFromCompletionStampWithTrueIsCalledThenTask
     EXPECT_EQ(cs.flushStamp, cmdQ.flushStamp->peekStamp());
 }
 
+TEST(CommandQueue, givenDynamicSliceCountWhenThreadGroupCountChangesThenSliceCountIsKeptForMinimalNumberOfSubmissions) {
+    HardwareInfo hwInfo = *defaultHwInfo;
+    hwInfo.gtSystemInfo.SliceCount = 2;
+    hwInfo.gtSystemInfo.SubSliceCount = 8;
+    auto mockDevice = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(&hwInfo));
+    MockCommandQueue cmdQ(nullptr, mockDevice.get(), 0);
+
+    EXPECT_EQ(1u, cmdQ.selectDynamicSliceCount(1u));
+    EXPECT_EQ(1u, cmdQ.selectDynamicSliceCount(100u));
+    for (uint32_t submission = 2u; submission < 8u; submission++) {
+        EXPECT_EQ(1u, cmdQ.selectDynamicSliceCount(submission % 2 ? 1u : 100u));
+    }
+
+    EXPECT_EQ(2u, cmdQ.selectDynamicSliceCount(100u));
+    EXPECT_EQ(2u, cmdQ.selectDynamicSliceCount(1u));
+}
+
 TEST(CommandQueue, givenDeviceWhenCreatingCommandQueueThenPickCsrFromDefaultEngine) {
     auto mockDevice = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
     MockCommandQueue cmdQ(nullptr, mockDevice.get(), 0);
@@ -1179,7 +1196,11 @@ TEST(CommandQueue, givenClCommandWhenCallingBlitEnqueueAllowedThenReturnCorrectV
         EXPECT_TRUE(queue.blitEnqueueAllowed(CL_COMMAND_SVM_MEMCPY));
         EXPECT_TRUE(queue.blitEnqueueAllowed(CL_COMMAND_READ_IMAGE));
         EXPECT_TRUE(queue.blitEnqueueAllowed(CL_COMMAND_WRITE_IMAGE));
-        EXPECT_FALSE(queue.blitEnqueueAllowed(CL_COMMAND_COPY_IMAGE));
+        EXPECT_TRUE(queue.blitEnqueueAllowed(CL_COMMAND_COPY_IMAGE));
+        EXPECT_TRUE(queue.blitEnqueueAllowed(CL_COMMAND_COPY_IMAGE_TO_BUFFER));
+        EXPECT_TRUE(queue.blitEnqueueAllowed(CL_COMMAND_COPY_BUFFER_TO_IMAGE));
+        EXPECT_TRUE(queue.blitEnqueueAllowed(CL_COMMAND_FILL_BUFFER));
+        EXPECT_FALSE(queue.blitEnqueueAllowed(CL_COMMAND_FILL_IMAGE));
     } else {
         EXPECT_FALSE(queue.blitEnqueueAllowed(CL_COMMAND_READ_BUFFER));
         EXPECT_FALSE(queue.blitEnqueueAllowed(CL_COMMAND_WRITE_BUFFER));
@@ -1191,6 +1212,10 @@ TEST(CommandQueue, givenClCommandWhenCallingBlitEnqueueAllowedThenReturnCorrectV
         EXPECT_FALSE(queue.blitEnqueueAllowed(CL_COMMAND_READ_IMAGE));
         EXPECT_FALSE(queue.blitEnqueueAllowed(CL_COMMAND_WRITE_IMAGE));
         EXPECT_FALSE(queue.blitEnqueueAllowed(CL_COMMAND_COPY_IMAGE));
+        EXPECT_FALSE(queue.blitEnqueueAllowed(CL_COMMAND_COPY_IMAGE_TO_BUFFER));
+        EXPECT_FALSE(queue.blitEnqueueAllowed(CL_COMMAND_COPY_BUFFER_TO_IMAGE));
+        EXPECT_FALSE(queue.blitEnqueueAllowed(CL_COMMAND_FILL_BUFFER));
+        EXPECT_FALSE(queue.blitEnqueueAllowed(CL_COMMAND_FILL_IMAGE));
     }
 }
 
@@ -1313,11 +1338,30 @@ TEST(CommandQueue, givenNotLocalToLocalSvmCopyCommandWhenCallingBlitEnqueuePrefe
     EXPECT_TRUE(queue.blitEnqueuePreferred(CL_COMMAND_SVM_MEMCPY, builtinOpParams));
 }
 
+TEST(CommandQueue, givenFillBufferCommandWhenCallingBlitEnqueuePreferredThenReturnValueBasedOnDebugFlagAndFillSize) {
+    DebugManagerStateRestore restore{};
+    MockContext context{};
+    MockCommandQueue queue{context};
+    BuiltinOpParams builtinOpParams{};
+
+    builtinOpParams.size = {64 * MemoryConstants::megaByte - 1, 0, 0};
+    EXPECT_FALSE(queue.blitEnqueuePreferred(CL_COMMAND_FILL_BUFFER, builtinOpParams));
+    builtinOpParams.size = {64 * MemoryConstants::megaByte, 0, 0};
+    EXPECT_TRUE(queue.blitEnqueuePreferred(CL_COMMAND_FILL_BUFFER, builtinOpParams));
+
+    DebugManager.flags.PreferCopyEngineForFillBuffer.set(0);
+    EXPECT_FALSE(queue.blitEnqueuePreferred(CL_COMMAND_FILL_BUFFER, builtinOpParams));
+    builtinOpParams.size = {MemoryConstants::pageSize, 0, 0};
+    DebugManager.flags.PreferCopyEngineForFillBuffer.set(1);
+    EXPECT_TRUE(queue.blitEnqueuePreferred(CL_COMMAND_FILL_BUFFER, builtinOpParams));
+}
+
 TEST(CommandQueue, givenCopySizeAndOffsetWhenCallingBlitEnqueueImageAllowedThenReturnCorrectValue) {
     DebugManagerStateRestore restorer;
     DebugManager.flags.EnableBlitterForReadWriteImage.set(1);
     MockContext context{};
     MockCommandQueue queue(&context, context.getDevice(0), 0);
+    std::unique_ptr<Image> image(Image2dHelper<>::create(&context));
 
     auto maxBlitWidth = static_cast<size_t>(BlitterConstants::maxBlitWidth);
     auto maxBlitHeight = static_cast<size_t>(BlitterConstants::maxBlitHeight);
@@ -1334,10 +1378,27 @@ TEST(CommandQueue, givenCopySizeAndOffsetWhenCallingBlitEnqueueImageAllowedThenR
     for (auto &[regionX, regionY, originX, originY, expectedResult] : testParams) {
         size_t region[3] = {regionX, regionY, 0};
         size_t origin[3] = {originX, originY, 0};
-        EXPECT_EQ(expectedResult, queue.blitEnqueueImageAllowed(origin, region));
+        EXPECT_EQ(expectedResult, queue.blitEnqueueImageAllowed(origin, region, *image));
     }
 }
 
+TEST(CommandQueue, givenMipMappedImageWhenCallingBlitEnqueueImageAllowedThenReturnFalse) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableBlitterForReadWriteImage.set(1);
+    MockContext context{};
+    MockCommandQueue queue(&context, context.getDevice(0), 0);
+
+    cl_image_desc imageDesc = Image2dDefaults::imageDesc;
+    imageDesc.num_mip_levels = 2;
+    std::unique_ptr<Image> mipMappedImage(Image2dHelper<>::create(&context, &imageDesc));
+    std::unique_ptr<Image> image(Image2dHelper<>::create(&context));
+
+    size_t region[3] = {1, 1, 1};
+    size_t origin[3] = {0, 0, 0};
+    EXPECT_FALSE(queue.blitEnqueueImageAllowed(origin, region, *mipMappedImage));
+    EXPECT_TRUE(queue.blitEnqueueImageAllowed(origin, region, *image));
+}
+
 TEST(CommandQueue, givenSupportForOperationWhenValidatingSupportThenReturnSuccess) {
     MockCommandQueue queue{};
 
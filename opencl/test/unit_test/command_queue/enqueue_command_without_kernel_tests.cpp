@@ -383,7 +383,7 @@ HWTEST_F(EnqueueHandlerTest, givenTimestampPacketWriteEnabledAndCommandWithCache
 
     MultiDispatchInfo multiDispatch;
     mockCmdQ->template enqueueHandler<CL_COMMAND_MARKER>(nullptr, 0, false, multiDispatch, 0, nullptr, &event);
-    auto node1 = mockCmdQ->timestampPacketContainer->peekNodes().at(0);
+    auto node1 = mockCmdQ->timestampPacketContainer->peekNodes()[0];
     EXPECT_NE(nullptr, node1);
     clReleaseEvent(event);
 }
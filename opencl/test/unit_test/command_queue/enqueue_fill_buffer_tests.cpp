@@ -23,6 +23,7 @@
 #include "opencl/test/unit_test/libult/ult_command_stream_receiver.h"
 #include "opencl/test/unit_test/mocks/mock_allocation_properties.h"
 #include "opencl/test/unit_test/mocks/mock_buffer.h"
+#include "opencl/test/unit_test/mocks/mock_command_queue.h"
 #include "test.h"
 
 #include "reg_configs_common.h"
@@ -174,7 +175,7 @@ HWTEST_F(EnqueueFillBufferCmdTests, FillBufferMiddle) {
     EXPECT_EQ(1u, mdi.size());
 
     auto kernel = mdi.begin()->getKernel();
-    EXPECT_STREQ("FillBufferMiddle", kernel->getKernelInfo(rootDeviceIndex).kernelDescriptor.kernelMetadata.kernelName.c_str());
+    EXPECT_STREQ("FillBufferMiddleWide", kernel->getKernelInfo(rootDeviceIndex).kernelDescriptor.kernelMetadata.kernelName.c_str());
 
     context.getMemoryManager()->freeGraphicsMemory(patternAllocation);
 }
@@ -522,6 +523,20 @@ HWTEST_F(EnqueueFillBufferCmdTests, givenEnqueueFillBufferWhenPatternAllocationI
     EXPECT_EQ(GraphicsAllocation::AllocationType::FILL_PATTERN, patternAllocation->getAllocationType());
 }
 
+HWTEST_F(EnqueueFillBufferCmdTests, givenCopyOnlyQueueAndPatternNotSupportedByBlitterWhenFillingBufferThenInvalidOperationIsReturned) {
+    MockCommandQueueHw<FamilyType> cmdQ(&context, pClDevice, nullptr);
+    cmdQ.isCopyOnly = true;
+
+    uint8_t pattern[128] = {};
+    for (size_t i = 0; i < sizeof(pattern); i++) {
+        pattern[i] = static_cast<uint8_t>(i);
+    }
+
+    auto retVal = cmdQ.enqueueFillBuffer(buffer, pattern, sizeof(pattern), 0, sizeof(pattern), 0, nullptr, nullptr);
+    EXPECT_EQ(CL_INVALID_OPERATION, retVal);
+    EXPECT_EQ(0u, cmdQ.taskCount);
+}
+
 struct EnqueueFillBufferHw : public ::testing::Test {
 
     void SetUp() override {
@@ -541,6 +541,52 @@ HWCMDTEST_F(IGFX_GEN8_CORE, EnqueueKernelTest, givenSecondEnqueueWithTheSameScra
     EXPECT_EQ(csr.getScratchAllocation(), scratchAlloc);
 }
 
+HWCMDTEST_F(IGFX_GEN8_CORE, EnqueueKernelTest, givenRepeatedEnqueueWithTheSameWorkSizesWhenDispatchingThenWalkerTemplateIsReusedUntilWorkSizesChange) {
+    using GPGPU_WALKER = typename FamilyType::GPGPU_WALKER;
+    size_t gws[3] = {64, 1, 1};
+    size_t lws[3] = {16, 1, 1};
+
+    MockKernelWithInternals mockKernel(*pClDevice);
+    auto &dispatchTemplate = mockKernel.mockKernel->getDispatchTemplate(rootDeviceIndex);
+
+    pCmdQ->enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, lws, 0, nullptr, nullptr);
+    EXPECT_EQ(sizeof(GPGPU_WALKER), dispatchTemplate.walker.size());
+    auto cachedWalker = dispatchTemplate.walker;
+
+    pCmdQ->enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, lws, 0, nullptr, nullptr);
+    EXPECT_EQ(cachedWalker, dispatchTemplate.walker);
+
+    gws[0] = 128;
+    pCmdQ->enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, lws, 0, nullptr, nullptr);
+    EXPECT_NE(cachedWalker, dispatchTemplate.walker);
+
+    HardwareParse hwParser;
+    hwParser.parseCommands<FamilyType>(*pCmdQ);
+    auto walkers = findAll<GPGPU_WALKER *>(hwParser.cmdList.begin(), hwParser.cmdList.end());
+    ASSERT_EQ(3u, walkers.size());
+    auto firstWalker = genCmdCast<GPGPU_WALKER *>(*walkers[0]);
+    auto secondWalker = genCmdCast<GPGPU_WALKER *>(*walkers[1]);
+    auto thirdWalker = genCmdCast<GPGPU_WALKER *>(*walkers[2]);
+    EXPECT_EQ(4u, firstWalker->getThreadGroupIdXDimension());
+    EXPECT_EQ(4u, secondWalker->getThreadGroupIdXDimension());
+    EXPECT_EQ(firstWalker->getThreadWidthCounterMaximum(), secondWalker->getThreadWidthCounterMaximum());
+    EXPECT_EQ(firstWalker->getRightExecutionMask(), secondWalker->getRightExecutionMask());
+    EXPECT_NE(firstWalker->getIndirectDataStartAddress(), secondWalker->getIndirectDataStartAddress());
+    EXPECT_EQ(8u, thirdWalker->getThreadGroupIdXDimension());
+}
+
+HWCMDTEST_F(IGFX_GEN8_CORE, EnqueueKernelTest, givenDispatchTemplateCacheDisabledWhenDispatchingThenWalkerIsNotCached) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableDispatchTemplateCache.set(0);
+    size_t gws[3] = {64, 1, 1};
+
+    MockKernelWithInternals mockKernel(*pClDevice);
+    pCmdQ->enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
+
+    auto &dispatchTemplate = mockKernel.mockKernel->getDispatchTemplate(rootDeviceIndex);
+    EXPECT_TRUE(dispatchTemplate.walker.empty());
+}
+
 HWTEST_F(EnqueueKernelTest, whenEnqueueingKernelThatRequirePrivateScratchThenPrivateScratchIsSetInCommandStreamReceviver) {
     pDevice->setPreemptionMode(PreemptionMode::ThreadGroup);
     auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
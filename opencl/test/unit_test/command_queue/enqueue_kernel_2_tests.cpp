@@ -603,6 +603,71 @@ HWTEST_P(EnqueueKernelPrintfTest, GivenKernelWithPrintfWhenBeingDispatchedThenL3
     EXPECT_EQ(mockCmdQueue.latestTaskCountWaited, newLatestSentTaskCount);
 }
 
+HWTEST_P(EnqueueKernelPrintfTest, GivenAsyncPrintfOutputEnabledWhenKernelWithPrintfIsEnqueuedThenQueueIsNotBlockedAndOutputIsPrintedOnFinish) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableAsyncPrintfOutput.set(true);
+
+    MockCommandQueueHw<FamilyType> mockCmdQueue(context, pClDevice, nullptr);
+    MockKernelWithInternals mockKernel(*pClDevice);
+    mockKernel.kernelInfo.kernelDescriptor.kernelAttributes.bufferAddressingMode = KernelDescriptor::Stateless;
+
+    SPatchAllocateStatelessPrintfSurface patchData;
+    patchData.Size = 256;
+    patchData.DataParamOffset = 64;
+    populateKernelDescriptor(mockKernel.kernelInfo.kernelDescriptor, patchData);
+
+    auto &csr = mockCmdQueue.getGpgpuCommandStreamReceiver();
+    *csr.getTagAddress() = 0u;
+    auto initialRefCount = mockKernel.mockKernel->getRefInternalCount();
+    size_t globalWorkOffset[3] = {0, 0, 0};
+    FillValues();
+
+    auto retVal = mockCmdQueue.enqueueKernel(mockKernel, 1, globalWorkOffset, globalWorkSize, localWorkSize, 0, nullptr, nullptr);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(std::numeric_limits<uint32_t>::max(), mockCmdQueue.latestTaskCountWaited);
+    ASSERT_EQ(1u, mockCmdQueue.deferredPrintfOutputs.size());
+    EXPECT_EQ(mockCmdQueue.taskCount, mockCmdQueue.deferredPrintfOutputs[0].first);
+    EXPECT_EQ(initialRefCount + 1, mockKernel.mockKernel->getRefInternalCount());
+
+    *csr.getTagAddress() = csr.peekTaskCount();
+    EXPECT_EQ(CL_SUCCESS, mockCmdQueue.finish());
+    EXPECT_EQ(csr.peekTaskCount(), mockCmdQueue.latestTaskCountWaited);
+    EXPECT_EQ(0u, mockCmdQueue.deferredPrintfOutputs.size());
+    EXPECT_EQ(initialRefCount, mockKernel.mockKernel->getRefInternalCount());
+}
+
+HWTEST_P(EnqueueKernelPrintfTest, GivenDeferredPrintfOutputsWhenOnlyFirstEnqueueCompletedThenOnlyItsOutputIsPrinted) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableAsyncPrintfOutput.set(true);
+
+    MockCommandQueueHw<FamilyType> mockCmdQueue(context, pClDevice, nullptr);
+    MockKernelWithInternals mockKernel(*pClDevice);
+    mockKernel.kernelInfo.kernelDescriptor.kernelAttributes.bufferAddressingMode = KernelDescriptor::Stateless;
+
+    SPatchAllocateStatelessPrintfSurface patchData;
+    patchData.Size = 256;
+    patchData.DataParamOffset = 64;
+    populateKernelDescriptor(mockKernel.kernelInfo.kernelDescriptor, patchData);
+
+    auto &csr = mockCmdQueue.getGpgpuCommandStreamReceiver();
+    *csr.getTagAddress() = 0u;
+    size_t globalWorkOffset[3] = {0, 0, 0};
+    FillValues();
+
+    EXPECT_EQ(CL_SUCCESS, mockCmdQueue.enqueueKernel(mockKernel, 1, globalWorkOffset, globalWorkSize, localWorkSize, 0, nullptr, nullptr));
+    auto firstTaskCount = mockCmdQueue.taskCount;
+    EXPECT_EQ(CL_SUCCESS, mockCmdQueue.enqueueKernel(mockKernel, 1, globalWorkOffset, globalWorkSize, localWorkSize, 0, nullptr, nullptr));
+    ASSERT_EQ(2u, mockCmdQueue.deferredPrintfOutputs.size());
+
+    mockCmdQueue.printDeferredPrintfOutput(firstTaskCount);
+    ASSERT_EQ(1u, mockCmdQueue.deferredPrintfOutputs.size());
+    EXPECT_EQ(mockCmdQueue.taskCount, mockCmdQueue.deferredPrintfOutputs[0].first);
+
+    *csr.getTagAddress() = csr.peekTaskCount();
+    EXPECT_EQ(CL_SUCCESS, mockCmdQueue.finish());
+    EXPECT_EQ(0u, mockCmdQueue.deferredPrintfOutputs.size());
+}
+
 HWCMDTEST_P(IGFX_GEN8_CORE, EnqueueKernelPrintfTest, GivenKernelWithPrintfBlockedByEventWhenEventUnblockedThenL3CacheIsFlushed) {
     typedef typename FamilyType::PARSE PARSE;
 
@@ -7,8 +7,11 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/engine_node_helper.h"
+#include "shared/source/memory_manager/os_agnostic_memory_manager.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 
+#include "opencl/source/event/user_event.h"
 #include "opencl/test/unit_test/command_queue/command_queue_fixture.h"
 #include "opencl/test/unit_test/command_queue/enqueue_map_buffer_fixture.h"
 #include "opencl/test/unit_test/fixtures/buffer_fixture.h"
@@ -24,6 +27,8 @@
 
 using namespace NEO;
 
+extern std::atomic<uint32_t> sfenceCounter;
+
 struct EnqueueMapBufferTest : public ClDeviceFixture,
                               public CommandQueueHwFixture,
                               public ::testing::Test {
@@ -747,3 +752,167 @@ TEST_F(EnqueueMapBufferTest, givenBufferWithUseHostPtrFlagWhenMappedOnCpuThenSet
 
     EXPECT_EQ(mappedPtr, expectedPtr);
 }
+
+HWTEST_F(EnqueueMapBufferTest, givenSmallLocalMemoryBufferWhenMappedAndUnmappedThenLockedAllocationIsReturnedWithoutStagingCopies) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ForceLocalMemoryAccessMode.set(static_cast<int32_t>(LocalMemoryAccessMode::Default));
+    MockContext context(pClDevice);
+    MockCommandQueueHw<FamilyType> cmdQ(&context, pClDevice, nullptr);
+    std::unique_ptr<Buffer> buffer(Buffer::create(&context, CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, retVal));
+    ASSERT_NE(nullptr, buffer);
+    auto allocation = buffer->getGraphicsAllocation(pClDevice->getRootDeviceIndex());
+    static_cast<MemoryAllocation *>(allocation)->overrideMemoryPool(MemoryPool::LocalMemory);
+    EXPECT_FALSE(buffer->mappingOnCpuAllowed());
+    EXPECT_TRUE(buffer->directMappingAllowed());
+
+    size_t mapOffset = 16;
+    auto mappedPtr = cmdQ.enqueueMapBuffer(buffer.get(), CL_TRUE, CL_MAP_WRITE, mapOffset, 8, 0, nullptr, nullptr, retVal);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    ASSERT_NE(nullptr, allocation->getLockedPtr());
+    EXPECT_EQ(ptrOffset(allocation->getLockedPtr(), mapOffset), mappedPtr);
+    EXPECT_TRUE(cmdQ.cpuDataTransferHandlerCalled);
+
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    EXPECT_EQ(1u, csr.flushTagUpdateCalled);
+    EXPECT_FALSE(csr.requiresFullCacheFlush);
+
+    auto sfenceCountBefore = sfenceCounter.load();
+    retVal = cmdQ.enqueueUnmapMemObject(buffer.get(), mappedPtr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(0u, cmdQ.EnqueueWriteBufferCounter);
+    EXPECT_EQ(sfenceCountBefore + 1, sfenceCounter.load());
+    EXPECT_TRUE(csr.requiresFullCacheFlush);
+}
+
+HWTEST_F(EnqueueMapBufferTest, givenDirectlyMappedBufferWhenMappedWithWriteInvalidateRegionAndUnmappedAfterReadThenCachesAreNotFlushed) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ForceLocalMemoryAccessMode.set(static_cast<int32_t>(LocalMemoryAccessMode::Default));
+    MockContext context(pClDevice);
+    MockCommandQueueHw<FamilyType> cmdQ(&context, pClDevice, nullptr);
+    std::unique_ptr<Buffer> buffer(Buffer::create(&context, CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, retVal));
+    ASSERT_NE(nullptr, buffer);
+    static_cast<MemoryAllocation *>(buffer->getGraphicsAllocation(pClDevice->getRootDeviceIndex()))->overrideMemoryPool(MemoryPool::LocalMemory);
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+
+    auto mappedPtr = cmdQ.enqueueMapBuffer(buffer.get(), CL_TRUE, CL_MAP_WRITE_INVALIDATE_REGION, 0, 8, 0, nullptr, nullptr, retVal);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(0u, csr.flushTagUpdateCalled);
+    retVal = cmdQ.enqueueUnmapMemObject(buffer.get(), mappedPtr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_TRUE(csr.requiresFullCacheFlush);
+    csr.requiresFullCacheFlush = false;
+
+    mappedPtr = cmdQ.enqueueMapBuffer(buffer.get(), CL_TRUE, CL_MAP_READ, 0, 8, 0, nullptr, nullptr, retVal);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(1u, csr.flushTagUpdateCalled);
+    retVal = cmdQ.enqueueUnmapMemObject(buffer.get(), mappedPtr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_FALSE(csr.requiresFullCacheFlush);
+}
+
+HWTEST_F(EnqueueMapBufferTest, givenDirectlyMappedBufferWhenUnmappedAfterWriteThenFullCacheFlushIsRegisteredOnAllEnginesExceptCopyEngines) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ForceLocalMemoryAccessMode.set(static_cast<int32_t>(LocalMemoryAccessMode::Default));
+    MockContext context(pClDevice);
+    MockCommandQueueHw<FamilyType> cmdQ(&context, pClDevice, nullptr);
+    std::unique_ptr<Buffer> buffer(Buffer::create(&context, CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, retVal));
+    ASSERT_NE(nullptr, buffer);
+    static_cast<MemoryAllocation *>(buffer->getGraphicsAllocation(pClDevice->getRootDeviceIndex()))->overrideMemoryPool(MemoryPool::LocalMemory);
+
+    auto mappedPtr = cmdQ.enqueueMapBuffer(buffer.get(), CL_TRUE, CL_MAP_WRITE_INVALIDATE_REGION, 0, 8, 0, nullptr, nullptr, retVal);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    retVal = cmdQ.enqueueUnmapMemObject(buffer.get(), mappedPtr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    for (auto &engine : pDevice->getEngines()) {
+        auto csr = static_cast<UltCommandStreamReceiver<FamilyType> *>(engine.commandStreamReceiver);
+        EXPECT_EQ(!EngineHelpers::isBcs(engine.getEngineType()), csr->requiresFullCacheFlush);
+    }
+}
+
+HWTEST_F(EnqueueMapBufferTest, givenDirectlyMappedBufferWhenBlockedUnmapAfterWriteIsUnblockedThenWritesAreFencedAndFullCacheFlushIsRegistered) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ForceLocalMemoryAccessMode.set(static_cast<int32_t>(LocalMemoryAccessMode::Default));
+    MockContext context(pClDevice);
+    MockCommandQueueHw<FamilyType> cmdQ(&context, pClDevice, nullptr);
+    std::unique_ptr<Buffer> buffer(Buffer::create(&context, CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, retVal));
+    ASSERT_NE(nullptr, buffer);
+    static_cast<MemoryAllocation *>(buffer->getGraphicsAllocation(pClDevice->getRootDeviceIndex()))->overrideMemoryPool(MemoryPool::LocalMemory);
+
+    auto mappedPtr = cmdQ.enqueueMapBuffer(buffer.get(), CL_TRUE, CL_MAP_WRITE_INVALIDATE_REGION, 0, 8, 0, nullptr, nullptr, retVal);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    UserEvent userEvent(&context);
+    cl_event waitList[] = {&userEvent};
+    retVal = cmdQ.enqueueUnmapMemObject(buffer.get(), mappedPtr, 1, waitList, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    auto &internalCsr = static_cast<UltCommandStreamReceiver<FamilyType> &>(*pDevice->getInternalEngine().commandStreamReceiver);
+    internalCsr.requiresFullCacheFlush = false;
+    auto sfenceCountBefore = sfenceCounter.load();
+
+    userEvent.setStatus(CL_COMPLETE);
+    EXPECT_EQ(sfenceCountBefore + 1, sfenceCounter.load());
+    EXPECT_TRUE(internalCsr.requiresFullCacheFlush);
+    cmdQ.finish();
+}
+
+TEST_F(EnqueueMapBufferTest, givenLocalMemoryBufferWhenDirectMappingIsDisabledOrBufferIsLargeThenDirectMappingIsNotAllowed) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ForceLocalMemoryAccessMode.set(static_cast<int32_t>(LocalMemoryAccessMode::Default));
+    MockContext context(pClDevice);
+    std::unique_ptr<Buffer> smallBuffer(Buffer::create(&context, CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, retVal));
+    std::unique_ptr<Buffer> largeBuffer(Buffer::create(&context, CL_MEM_READ_WRITE, MemObj::maxSizeForDirectMapping + 1, nullptr, retVal));
+    ASSERT_NE(nullptr, smallBuffer);
+    ASSERT_NE(nullptr, largeBuffer);
+    static_cast<MemoryAllocation *>(smallBuffer->getGraphicsAllocation(pClDevice->getRootDeviceIndex()))->overrideMemoryPool(MemoryPool::LocalMemory);
+    static_cast<MemoryAllocation *>(largeBuffer->getGraphicsAllocation(pClDevice->getRootDeviceIndex()))->overrideMemoryPool(MemoryPool::LocalMemory);
+
+    EXPECT_FALSE(largeBuffer->directMappingAllowed());
+    DebugManager.flags.EnableDirectMappingForLocalMemoryBuffers.set(1);
+    EXPECT_TRUE(largeBuffer->directMappingAllowed());
+    DebugManager.flags.EnableDirectMappingForLocalMemoryBuffers.set(0);
+    EXPECT_FALSE(smallBuffer->directMappingAllowed());
+    EXPECT_EQ(nullptr, smallBuffer->lockForDirectMapping(pClDevice->getRootDeviceIndex()));
+}
+
+HWTEST_F(EnqueueMapBufferTest, givenNonZeroCopyBufferWhenMappedWithWriteInvalidateRegionThenContentsAreNotReadBack) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.DisableZeroCopyForBuffers.set(true);
+    MockContext context(pClDevice);
+    MockCommandQueueHw<FamilyType> cmdQ(&context, pClDevice, nullptr);
+    std::unique_ptr<Buffer> buffer(Buffer::create(&context, CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, retVal));
+    ASSERT_NE(nullptr, buffer);
+    EXPECT_FALSE(buffer->mappingOnCpuAllowed());
+
+    auto mappedPtr = cmdQ.enqueueMapBuffer(buffer.get(), CL_TRUE, CL_MAP_WRITE_INVALIDATE_REGION, 0, 8, 0, nullptr, nullptr, retVal);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_NE(nullptr, mappedPtr);
+    EXPECT_EQ(static_cast<cl_uint>(CL_COMMAND_MARKER), cmdQ.lastCommandType);
+
+    retVal = cmdQ.enqueueUnmapMemObject(buffer.get(), mappedPtr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(1u, cmdQ.EnqueueWriteBufferCounter);
+
+    mappedPtr = cmdQ.enqueueMapBuffer(buffer.get(), CL_TRUE, CL_MAP_WRITE, 0, 8, 0, nullptr, nullptr, retVal);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(static_cast<cl_uint>(CL_COMMAND_READ_BUFFER), cmdQ.lastCommandType);
+}
+
+TEST_F(EnqueueMapBufferTest, givenAdjacentWriteMapsOfBufferWhenMappedThenBothMapsSucceed) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.DisableZeroCopyForBuffers.set(true);
+    MockContext context(pClDevice);
+    MockCommandQueue cmdQ(&context, pClDevice, nullptr);
+    std::unique_ptr<Buffer> buffer(Buffer::create(&context, CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, retVal));
+    ASSERT_NE(nullptr, buffer);
+
+    auto firstPtr = cmdQ.enqueueMapBuffer(buffer.get(), CL_TRUE, CL_MAP_WRITE, 0, 8, 0, nullptr, nullptr, retVal);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    auto secondPtr = cmdQ.enqueueMapBuffer(buffer.get(), CL_TRUE, CL_MAP_WRITE, 8, 8, 0, nullptr, nullptr, retVal);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(ptrOffset(firstPtr, 8), secondPtr);
+
+    cmdQ.enqueueMapBuffer(buffer.get(), CL_TRUE, CL_MAP_WRITE, 4, 8, 0, nullptr, nullptr, retVal);
+    EXPECT_EQ(CL_INVALID_OPERATION, retVal);
+}
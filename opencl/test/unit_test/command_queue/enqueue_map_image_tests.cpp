@@ -7,6 +7,7 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/os_interface/os_context.h"
+#include "shared/source/utilities/tiled_memcpy.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/test_macros/test_checks_shared.h"
 
@@ -19,6 +20,7 @@
 #include "opencl/test/unit_test/helpers/unit_test_helper.h"
 #include "opencl/test/unit_test/libult/ult_command_stream_receiver.h"
 #include "opencl/test/unit_test/mocks/mock_allocation_properties.h"
+#include "opencl/test/unit_test/mocks/mock_command_queue.h"
 #include "opencl/test/unit_test/mocks/mock_context.h"
 #include "opencl/test/unit_test/mocks/mock_kernel.h"
 #include "test.h"
@@ -251,6 +253,72 @@ HWTEST_F(EnqueueMapImageTest, givenTiledImageWhenMapImageIsCalledThenStorageIsSe
     mockImage.releaseAllocatedMapPtr();
 }
 
+HWTEST_F(EnqueueMapImageTest, givenCpuDetilingEnabledWhenTiledImageIsMappedAndUnmappedThenDataIsCopiedOnCpuWithoutGpuCopies) {
+    if (!UnitTestHelper<FamilyType>::tiledImagesSupported) {
+        GTEST_SKIP();
+    }
+    DebugManagerStateRestore dbgRestore;
+    DebugManager.flags.EnableCpuDetilingForImageMap.set(1);
+    auto rootDeviceIndex = pClDevice->getRootDeviceIndex();
+    pClDevice->getExecutionEnvironment()->rootDeviceEnvironments[rootDeviceIndex]->getMutableHardwareInfo()->capabilityTable.isIntegratedDevice = true;
+
+    cl_image_desc imageDesc = Image2dDefaults::imageDesc;
+    imageDesc.image_width = 64;
+    imageDesc.image_height = 32;
+    std::unique_ptr<Image> tiledImage(ImageHelper<Image2dDefaults>::create(context, &imageDesc));
+    ASSERT_TRUE(tiledImage->isTiledAllocation());
+
+    auto allocation = tiledImage->getGraphicsAllocation(rootDeviceIndex);
+    auto pitch = allocation->getDefaultGmm()->gmmResourceInfo->getRenderPitch();
+    auto elementSize = tiledImage->getSurfaceFormatInfo().surfaceFormat.ImageElementSizeInBytes;
+    const size_t origin[3] = {3, 5, 0};
+    const size_t region[3] = {1, 1, 1};
+    auto tiledElement = ptrOffset(allocation->getUnderlyingBuffer(), TiledMemcpy::getTiledOffset(TileLayout::TileY, origin[0] * elementSize, origin[1], pitch));
+    *static_cast<uint32_t *>(tiledElement) = 0xdeadbeef;
+
+    auto taskCount = pCmdQ->taskCount;
+    auto ptr = pCmdQ->enqueueMapImage(tiledImage.get(), true, CL_MAP_READ | CL_MAP_WRITE, origin, region,
+                                      nullptr, nullptr, 0, nullptr, nullptr, retVal);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    ASSERT_NE(nullptr, ptr);
+    EXPECT_EQ(0xdeadbeef, *static_cast<uint32_t *>(ptr));
+
+    *static_cast<uint32_t *>(ptr) = 0x12345678;
+    retVal = pCmdQ->enqueueUnmapMemObject(tiledImage.get(), ptr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(0x12345678u, *static_cast<uint32_t *>(tiledElement));
+    EXPECT_EQ(taskCount, pCmdQ->taskCount);
+}
+
+HWTEST_F(EnqueueMapImageTest, givenCpuDetilingEnabledWhenMapWaitsForEventsOrDetilingIsDisabledThenCpuDetilingIsNotAllowed) {
+    if (!UnitTestHelper<FamilyType>::tiledImagesSupported) {
+        GTEST_SKIP();
+    }
+    DebugManagerStateRestore dbgRestore;
+    DebugManager.flags.EnableCpuDetilingForImageMap.set(1);
+    auto rootDeviceIndex = pClDevice->getRootDeviceIndex();
+    pClDevice->getExecutionEnvironment()->rootDeviceEnvironments[rootDeviceIndex]->getMutableHardwareInfo()->capabilityTable.isIntegratedDevice = true;
+
+    cl_image_desc imageDesc = Image2dDefaults::imageDesc;
+    imageDesc.image_width = 64;
+    imageDesc.image_height = 32;
+    std::unique_ptr<Image> tiledImage(ImageHelper<Image2dDefaults>::create(context, &imageDesc));
+    const size_t region[3] = {1, 1, 1};
+    EXPECT_TRUE(tiledImage->isCpuDetilingAllowed(region, rootDeviceIndex));
+
+    MockCommandQueueHw<FamilyType> mockCmdQ(context, pClDevice, nullptr);
+    EventsRequest noEventsRequest(0, nullptr, nullptr);
+    EXPECT_TRUE(mockCmdQ.isCpuDetilingForMapAllowed(*tiledImage, region, noEventsRequest));
+
+    UserEvent userEvent(context);
+    cl_event waitEvent = &userEvent;
+    EventsRequest eventsRequest(1, &waitEvent, nullptr);
+    EXPECT_FALSE(mockCmdQ.isCpuDetilingForMapAllowed(*tiledImage, region, eventsRequest));
+
+    DebugManager.flags.EnableCpuDetilingForImageMap.set(0);
+    EXPECT_FALSE(tiledImage->isCpuDetilingAllowed(region, rootDeviceIndex));
+}
+
 TEST_F(EnqueueMapImageTest, WhenMappingImageThenCpuAndGpuAddressAreEqualWhenZeroCopyIsUsed) {
     auto mapFlags = CL_MAP_READ;
     const size_t origin[3] = {0, 0, 0};
@@ -451,7 +451,50 @@ HWTEST_F(EnqueueSvmTest, givenDstHostPtrAndSrcHostPtrWhenEnqueueNonBlockingSVMMe
     EXPECT_EQ(ptrDiff(pDstSVM, alignDown(pDstSVM, 4)), dstOffset);
 }
 
+HWTEST_F(EnqueueSvmTest, givenDstHostPtrAndSrcHostPtrWhenEnqueueBlockingSVMMemcpyThenCopyIsDoneOnCpu) {
+    char dstHostPtr[] = {0, 0, 0};
+    char srcHostPtr[] = {1, 2, 3};
+    MockCommandQueueHw<FamilyType> myCmdQ(context, pClDevice, 0);
+    auto taskCountBeforeCopy = myCmdQ.getGpgpuCommandStreamReceiver().peekTaskCount();
+    cl_event event = nullptr;
+    retVal = myCmdQ.enqueueSVMMemcpy(true, dstHostPtr, srcHostPtr, 3, 0, nullptr, &event);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(0, memcmp(dstHostPtr, srcHostPtr, sizeof(srcHostPtr)));
+    EXPECT_EQ(taskCountBeforeCopy, myCmdQ.getGpgpuCommandStreamReceiver().peekTaskCount());
+
+    auto pEvent = castToObjectOrAbort<Event>(event);
+    EXPECT_EQ(static_cast<cl_command_type>(CL_COMMAND_SVM_MEMCPY), pEvent->getCommandType());
+    EXPECT_TRUE(pEvent->isCompleted());
+    clReleaseEvent(event);
+}
+
+HWTEST_F(EnqueueSvmTest, givenSvmPtrOrNonBlockingCopyWhenCheckingSvmMemcpyCpuCopyThenItIsNotAllowed) {
+    MockCommandQueueHw<FamilyType> myCmdQ(context, pClDevice, 0);
+    auto svmData = context->getSVMAllocsManager()->getSVMAlloc(ptrSVM);
+    ASSERT_NE(nullptr, svmData);
+
+    EXPECT_TRUE(myCmdQ.svmMemcpyCpuCopyAllowed(nullptr, nullptr, true, 3, 0, nullptr));
+    EXPECT_FALSE(myCmdQ.svmMemcpyCpuCopyAllowed(nullptr, nullptr, false, 3, 0, nullptr));
+    EXPECT_FALSE(myCmdQ.svmMemcpyCpuCopyAllowed(svmData, nullptr, true, 3, 0, nullptr));
+    EXPECT_FALSE(myCmdQ.svmMemcpyCpuCopyAllowed(nullptr, svmData, true, 3, 0, nullptr));
+}
+
+HWTEST_F(EnqueueSvmTest, givenLargeSvmMemcpyBetweenHostPtrsWhenCheckingSvmMemcpyCpuCopyThenItIsAllowedOnlyOnDiscreteDevice) {
+    MockCommandQueueHw<FamilyType> myCmdQ(context, pClDevice, 0);
+    auto hwInfo = pClDevice->getExecutionEnvironment()->rootDeviceEnvironments[pClDevice->getRootDeviceIndex()]->getMutableHardwareInfo();
+    auto largeSize = Buffer::maxBufferSizeForReadWriteOnCpu + 1;
+
+    hwInfo->capabilityTable.isIntegratedDevice = true;
+    EXPECT_TRUE(myCmdQ.svmMemcpyCpuCopyAllowed(nullptr, nullptr, true, 3, 0, nullptr));
+    EXPECT_FALSE(myCmdQ.svmMemcpyCpuCopyAllowed(nullptr, nullptr, true, largeSize, 0, nullptr));
+
+    hwInfo->capabilityTable.isIntegratedDevice = false;
+    EXPECT_TRUE(myCmdQ.svmMemcpyCpuCopyAllowed(nullptr, nullptr, true, largeSize, 0, nullptr));
+}
+
 HWTEST_F(EnqueueSvmTest, givenDstHostPtrAndSrcHostPtrWhenEnqueueBlockingSVMMemcpyThenEnqueuWriteBufferIsCalled) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.DoCpuCopyOnSvmMemcpy.set(0);
     char dstHostPtr[] = {0, 0, 0};
     char srcHostPtr[] = {1, 2, 3};
     void *pDstSVM = dstHostPtr;
@@ -488,6 +488,63 @@ HWTEST_F(EnqueueWriteBufferTypeTest, givenEnqueueWriteBufferCalledWhenLockedPtrI
     EXPECT_EQ(0u, memoryManager.unlockResourceCalled);
 }
 
+HWTEST_F(EnqueueWriteBufferTypeTest, givenStagingWriteBufferEnabledWhenWritingLargeBufferThenChunksAreCopiedThroughRingOfStagingBuffers) {
+    DebugManagerStateRestore dbgRestore;
+    DebugManager.flags.DoCpuCopyOnWriteBuffer.set(0);
+    DebugManager.flags.EnableStagingWriteBuffer.set(1);
+    DebugManager.flags.StagingWriteBufferChunkSize.set(4);
+
+    auto mockCmdQ = std::make_unique<MockCommandQueueHw<FamilyType>>(context, pClDevice, nullptr);
+    char srcData[16];
+    for (auto i = 0u; i < sizeof(srcData); i++) {
+        srcData[i] = static_cast<char>(i);
+    }
+    auto taskCountBefore = mockCmdQ->taskCount + mockCmdQ->bcsTaskCount;
+
+    auto retVal = mockCmdQ->enqueueWriteBuffer(srcBuffer.get(),
+                                               CL_TRUE,
+                                               0,
+                                               sizeof(srcData),
+                                               srcData,
+                                               nullptr,
+                                               0,
+                                               nullptr,
+                                               nullptr);
+
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(taskCountBefore + 4u, mockCmdQ->taskCount + mockCmdQ->bcsTaskCount);
+    ASSERT_EQ(3u, mockCmdQ->stagingBuffers.size());
+    for (auto &stagingBuffer : mockCmdQ->stagingBuffers) {
+        ASSERT_NE(nullptr, stagingBuffer.allocation);
+    }
+    // the fourth chunk reuses the first staging buffer
+    EXPECT_EQ(0, memcmp(mockCmdQ->stagingBuffers[0].allocation->getUnderlyingBuffer(), &srcData[12], 4));
+    EXPECT_EQ(0, memcmp(mockCmdQ->stagingBuffers[1].allocation->getUnderlyingBuffer(), &srcData[4], 4));
+}
+
+HWTEST_F(EnqueueWriteBufferTypeTest, givenStagingWriteBufferEnabledWhenWritingBufferNotLargerThanChunkThenStagingBuffersAreNotUsed) {
+    DebugManagerStateRestore dbgRestore;
+    DebugManager.flags.DoCpuCopyOnWriteBuffer.set(0);
+    DebugManager.flags.EnableStagingWriteBuffer.set(1);
+    DebugManager.flags.StagingWriteBufferChunkSize.set(16);
+
+    auto mockCmdQ = std::make_unique<MockCommandQueueHw<FamilyType>>(context, pClDevice, nullptr);
+    char srcData[16] = {};
+
+    auto retVal = mockCmdQ->enqueueWriteBuffer(srcBuffer.get(),
+                                               CL_TRUE,
+                                               0,
+                                               sizeof(srcData),
+                                               srcData,
+                                               nullptr,
+                                               0,
+                                               nullptr,
+                                               nullptr);
+
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_TRUE(mockCmdQ->stagingBuffers.empty());
+}
+
 using NegativeFailAllocationTest = Test<NegativeFailAllocationCommandEnqueueBaseFixture>;
 
 HWTEST_F(NegativeFailAllocationTest, givenEnqueueWriteBufferWhenHostPtrAllocationCreationFailsThenReturnOutOfResource) {
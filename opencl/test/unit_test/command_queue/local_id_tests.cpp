@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -18,6 +18,10 @@
 
 using namespace NEO;
 
+namespace NEO {
+struct uint16x8_t;
+} // namespace NEO
+
 using LocalIdTests = ::testing::Test;
 
 HWTEST_F(LocalIdTests, GivenSimd8WhenGettingGrfsPerThreadThenOneIsReturned) {
@@ -100,6 +104,22 @@ TEST(LocalID, givenVariadicGrfSizeWhenLocalSizesAreEmittedThenUseFullRowSize) {
     EXPECT_EQ(localIdsView[67], 0u);
 }
 
+TEST(LocalID, givenSimd32WhenLocalIdsAreGeneratedWithCpuSpecificVariantThenTheyMatchSse4Variant) {
+    std::array<uint16_t, 3u> localSizes = {{7u, 5u, 3u}};
+    std::array<uint8_t, 3u> dimensionsOrder = {{0u, 1u, 2u}};
+    auto threadsPerWorkGroup = static_cast<uint16_t>(getThreadsPerWG(32u, localSizes[0] * localSizes[1] * localSizes[2]));
+    auto size = threadsPerWorkGroup * getPerThreadSizeLocalIDs(32u, 32u);
+
+    auto expectedLocalIds = allocateAlignedMemory(size, MemoryConstants::cacheLineSize);
+    auto localIds = allocateAlignedMemory(size, MemoryConstants::cacheLineSize);
+    memset(expectedLocalIds.get(), 0, size);
+    memset(localIds.get(), 0, size);
+
+    generateLocalIDsSimd<uint16x8_t, 32>(expectedLocalIds.get(), localSizes, threadsPerWorkGroup, dimensionsOrder, true);
+    LocalIDHelper::generateSimd32(localIds.get(), localSizes, threadsPerWorkGroup, dimensionsOrder, true);
+    EXPECT_EQ(0, memcmp(expectedLocalIds.get(), localIds.get(), size));
+}
+
 struct LocalIDFixture : ::testing::TestWithParam<std::tuple<int, int, int, int, int>> {
     void SetUp() override {
         simd = std::get<0>(GetParam());
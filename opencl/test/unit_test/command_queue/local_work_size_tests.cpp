@@ -5,6 +5,7 @@
  *
  */
 
+#include "shared/source/kernel/grf_config.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_device.h"
 
@@ -712,3 +713,60 @@ TEST(localWorkSizeTest, givenMaxWorkgroupSizeEqualToSimdSizeWhenLwsIsCalculatedT
     EXPECT_EQ(workGroupSize[1], 1u);
     EXPECT_EQ(workGroupSize[2], 1u);
 }
+
+TEST(localWorkSizeTest, givenKernelRequiringLargeGrfWhenWorkSizeInfoIsCreatedThenNumberOfThreadsIsHalved) {
+    MockClDevice device{new MockDevice};
+    MockKernelWithInternals kernel(device);
+    DispatchInfo dispatchInfo;
+    dispatchInfo.setClDevice(&device);
+    dispatchInfo.setKernel(kernel.mockKernel);
+
+    auto &deviceInfo = device.sharedDeviceInfo;
+    deviceInfo.maxNumEUsPerSubSlice = 8u;
+    deviceInfo.numThreadsPerEU = 8u;
+
+    kernel.kernelInfo.kernelDescriptor.kernelAttributes.numGrfRequired = GrfConfig::DefaultGrfNumber;
+    EXPECT_EQ(64u, WorkSizeInfo{dispatchInfo}.numThreadsPerSubSlice);
+
+    kernel.kernelInfo.kernelDescriptor.kernelAttributes.numGrfRequired = GrfConfig::LargeGrfNumber;
+    EXPECT_EQ(32u, WorkSizeInfo{dispatchInfo}.numThreadsPerSubSlice);
+}
+
+TEST(localWorkSizeTest, givenKernelEnqueuedWithTheSameGwsWhenLwsIsComputedAgainThenCachedLwsIsReturned) {
+    MockClDevice device{new MockDevice};
+    MockKernelWithInternals kernel(device);
+    DispatchInfo dispatchInfo;
+    dispatchInfo.setClDevice(&device);
+    dispatchInfo.setKernel(kernel.mockKernel);
+    dispatchInfo.setGWS({1024, 1, 1});
+    dispatchInfo.setDim(1);
+
+    auto rootDeviceIndex = device.getRootDeviceIndex();
+    auto &localWorkSizeCache = kernel.mockKernel->getLocalWorkSizeCache(rootDeviceIndex);
+    auto expectedLws = computeWorkgroupSize(dispatchInfo);
+    ASSERT_EQ(1u, localWorkSizeCache.size());
+    EXPECT_EQ(expectedLws, localWorkSizeCache.begin()->second);
+
+    localWorkSizeCache.begin()->second = {8, 1, 1};
+    EXPECT_EQ(Vec3<size_t>(8, 1, 1), computeWorkgroupSize(dispatchInfo));
+
+    dispatchInfo.setGWS({2048, 1, 1});
+    computeWorkgroupSize(dispatchInfo);
+    EXPECT_EQ(2u, localWorkSizeCache.size());
+}
+
+TEST(localWorkSizeTest, givenLocalWorkSizeCacheDisabledWhenLwsIsComputedThenNothingIsCached) {
+    DebugManagerStateRestore dbgRestore;
+    DebugManager.flags.EnableLocalWorkSizeCache.set(0);
+
+    MockClDevice device{new MockDevice};
+    MockKernelWithInternals kernel(device);
+    DispatchInfo dispatchInfo;
+    dispatchInfo.setClDevice(&device);
+    dispatchInfo.setKernel(kernel.mockKernel);
+    dispatchInfo.setGWS({1024, 1, 1});
+    dispatchInfo.setDim(1);
+
+    computeWorkgroupSize(dispatchInfo);
+    EXPECT_TRUE(kernel.mockKernel->getLocalWorkSizeCache(device.getRootDeviceIndex()).empty());
+}
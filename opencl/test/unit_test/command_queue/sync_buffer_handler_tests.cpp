@@ -22,6 +22,7 @@ class MockSyncBufferHandler : public SyncBufferHandler {
   public:
     using SyncBufferHandler::bufferSize;
     using SyncBufferHandler::graphicsAllocation;
+    using SyncBufferHandler::recycledBuffers;
     using SyncBufferHandler::usedBufferSize;
 };
 
@@ -173,6 +174,67 @@ HWTEST_TEMPLATED_F(SyncBufferHandlerTest, GivenSyncBufferFullWhenEnqueuingKernel
     EXPECT_EQ(workItemsCount, syncBufferHandler->usedBufferSize);
 }
 
+HWTEST_TEMPLATED_F(SyncBufferHandlerTest, GivenSyncBufferFullAndIdleRecycledBufferWhenObtainingRegionThenRecycledBufferIsZeroedAndReused) {
+    pClDevice->allocateSyncBufferHandler();
+    auto syncBufferHandler = getSyncBufferHandler();
+    auto firstBuffer = syncBufferHandler->graphicsAllocation;
+
+    syncBufferHandler->usedBufferSize = syncBufferHandler->bufferSize;
+    auto allocationAndOffset = syncBufferHandler->obtainAllocationAndOffset(workItemsCount);
+    auto secondBuffer = allocationAndOffset.first;
+    EXPECT_NE(firstBuffer, secondBuffer);
+    EXPECT_EQ(0u, allocationAndOffset.second);
+    ASSERT_EQ(1u, syncBufferHandler->recycledBuffers.size());
+    EXPECT_EQ(firstBuffer, syncBufferHandler->recycledBuffers[0]);
+
+    memset(firstBuffer->getUnderlyingBuffer(), 1, syncBufferHandler->bufferSize);
+    syncBufferHandler->usedBufferSize = syncBufferHandler->bufferSize;
+    allocationAndOffset = syncBufferHandler->obtainAllocationAndOffset(workItemsCount);
+    EXPECT_EQ(firstBuffer, allocationAndOffset.first);
+    EXPECT_EQ(0, *reinterpret_cast<uint8_t *>(firstBuffer->getUnderlyingBuffer()));
+    ASSERT_EQ(1u, syncBufferHandler->recycledBuffers.size());
+    EXPECT_EQ(secondBuffer, syncBufferHandler->recycledBuffers[0]);
+}
+
+HWTEST_TEMPLATED_F(SyncBufferHandlerTest, GivenSyncBufferFullAndRecycledBufferUsedByGpuWhenObtainingRegionThenNewBufferIsAllocated) {
+    pClDevice->allocateSyncBufferHandler();
+    auto syncBufferHandler = getSyncBufferHandler();
+    auto firstBuffer = syncBufferHandler->graphicsAllocation;
+
+    syncBufferHandler->usedBufferSize = syncBufferHandler->bufferSize;
+    auto secondBuffer = syncBufferHandler->obtainAllocationAndOffset(workItemsCount).first;
+
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    firstBuffer->updateTaskCount(*csr.getTagAddress() + 1, csr.getOsContext().getContextId());
+
+    syncBufferHandler->usedBufferSize = syncBufferHandler->bufferSize;
+    auto thirdBuffer = syncBufferHandler->obtainAllocationAndOffset(workItemsCount).first;
+    EXPECT_NE(firstBuffer, thirdBuffer);
+    EXPECT_NE(secondBuffer, thirdBuffer);
+    EXPECT_EQ(2u, syncBufferHandler->recycledBuffers.size());
+
+    firstBuffer->updateTaskCount(*csr.getTagAddress(), csr.getOsContext().getContextId());
+}
+
+HWTEST_TEMPLATED_F(SyncBufferHandlerTest, GivenSyncBufferFullAndRecycledBufferStillResidentWhenObtainingRegionThenNewBufferIsAllocated) {
+    pClDevice->allocateSyncBufferHandler();
+    auto syncBufferHandler = getSyncBufferHandler();
+    auto firstBuffer = syncBufferHandler->graphicsAllocation;
+
+    syncBufferHandler->usedBufferSize = syncBufferHandler->bufferSize;
+    auto secondBuffer = syncBufferHandler->obtainAllocationAndOffset(workItemsCount).first;
+
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    firstBuffer->updateResidencyTaskCount(*csr.getTagAddress() + 1, csr.getOsContext().getContextId());
+
+    syncBufferHandler->usedBufferSize = syncBufferHandler->bufferSize;
+    auto thirdBuffer = syncBufferHandler->obtainAllocationAndOffset(workItemsCount).first;
+    EXPECT_NE(firstBuffer, thirdBuffer);
+    EXPECT_NE(secondBuffer, thirdBuffer);
+
+    firstBuffer->releaseResidencyInOsContext(csr.getOsContext().getContextId());
+}
+
 HWTEST_TEMPLATED_F(SyncBufferHandlerTest, GivenSshRequiredWhenPatchingSyncBufferThenSshIsProperlyPatched) {
     using RENDER_SURFACE_STATE = typename FamilyType::RENDER_SURFACE_STATE;
     kernelInternals->kernelInfo.usesSsh = true;
@@ -737,6 +737,58 @@ HWTEST_F(AubCommandStreamReceiverTests, givenAubCommandStreamReceiverWhenWriteMe
     memoryManager->freeGraphicsMemory(gfxAllocation);
 }
 
+HWTEST_F(AubCommandStreamReceiverTests, givenAUBDumpSkipUnchangedPagesSetWhenUnchangedMemoryIsWrittenAgainThenPagesAreNotWrittenToStream) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.AUBDumpSkipUnchangedPages.set(1);
+
+    auto aubCsr = std::make_unique<MockAubCsr<FamilyType>>("", true, *pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    auto stream = std::make_unique<MockAubFileStream>();
+    aubCsr->stream = stream.get();
+
+    uint8_t memory[MemoryConstants::pageSize] = {};
+    uint64_t gpuAddress = 0x100000;
+    aubCsr->writeMemory(gpuAddress, memory, sizeof(memory), MemoryBanks::MainBank, 0u);
+    auto writesOfFirstCall = stream->writeMemoryCalledCnt;
+    EXPECT_NE(0u, writesOfFirstCall);
+    EXPECT_NE(0u, aubCsr->writtenPages.size());
+
+    aubCsr->writeMemory(gpuAddress, memory, sizeof(memory), MemoryBanks::MainBank, 0u);
+    EXPECT_EQ(writesOfFirstCall, stream->writeMemoryCalledCnt);
+
+    memory[0] = 1u;
+    aubCsr->writeMemory(gpuAddress, memory, sizeof(memory), MemoryBanks::MainBank, 0u);
+    EXPECT_EQ(2 * writesOfFirstCall, stream->writeMemoryCalledCnt);
+}
+
+HWTEST_F(AubCommandStreamReceiverTests, givenAUBDumpSkipUnchangedPagesNotSetWhenUnchangedMemoryIsWrittenAgainThenPagesAreWrittenToStream) {
+    auto aubCsr = std::make_unique<MockAubCsr<FamilyType>>("", true, *pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    auto stream = std::make_unique<MockAubFileStream>();
+    aubCsr->stream = stream.get();
+
+    uint8_t memory[MemoryConstants::pageSize] = {};
+    aubCsr->writeMemory(0x100000, memory, sizeof(memory), MemoryBanks::MainBank, 0u);
+    auto writesOfFirstCall = stream->writeMemoryCalledCnt;
+    aubCsr->writeMemory(0x100000, memory, sizeof(memory), MemoryBanks::MainBank, 0u);
+    EXPECT_EQ(2 * writesOfFirstCall, stream->writeMemoryCalledCnt);
+    EXPECT_EQ(0u, aubCsr->writtenPages.size());
+}
+
+HWTEST_F(AubCommandStreamReceiverTests, givenWrittenPageWhenItsMappingOrContentsChangeThenPageIsNotReportedAsUnchanged) {
+    auto aubCsr = std::make_unique<MockAubCsr<FamilyType>>("", true, *pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+
+    uint8_t memory[MemoryConstants::pageSize] = {};
+    EXPECT_FALSE(aubCsr->isPageUnchanged(0x1000, 0x100000, 0u, memory, sizeof(memory)));
+    EXPECT_TRUE(aubCsr->isPageUnchanged(0x1000, 0x100000, 0u, memory, sizeof(memory)));
+
+    EXPECT_FALSE(aubCsr->isPageUnchanged(0x1000, 0x200000, 0u, memory, sizeof(memory)));
+    EXPECT_FALSE(aubCsr->isPageUnchanged(0x1000, 0x200000, 1u, memory, sizeof(memory)));
+    EXPECT_FALSE(aubCsr->isPageUnchanged(0x1000, 0x200000, 1u, memory, sizeof(memory) / 2));
+
+    memory[0] = 1u;
+    EXPECT_FALSE(aubCsr->isPageUnchanged(0x1000, 0x200000, 1u, memory, sizeof(memory) / 2));
+    EXPECT_TRUE(aubCsr->isPageUnchanged(0x1000, 0x200000, 1u, memory, sizeof(memory) / 2));
+}
+
 HWTEST_F(AubCommandStreamReceiverTests, whenAubCommandStreamReceiverIsCreatedThenPPGTTAndGGTTCreatedHavePhysicalAddressAllocatorSet) {
     auto aubCsr = std::make_unique<AUBCommandStreamReceiverHw<FamilyType>>("", false, *pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
     ASSERT_NE(nullptr, aubCsr->ppgtt.get());
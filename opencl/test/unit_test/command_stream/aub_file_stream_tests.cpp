@@ -83,6 +83,44 @@ HWTEST_F(AubFileStreamTests, givenAubCommandStreamReceiverWhenReopenFileIsCalled
     EXPECT_STREQ(newFileName.c_str(), aubCsr->getFileName().c_str());
 }
 
+TEST(AubFileStreamWriteBufferTests, givenAubFileStreamWhenFileIsOpenedThenWriteBufferOfConfiguredSizeIsUsed) {
+    DebugManagerStateRestore restorer;
+    AubMemDump::AubFileStream aubFileStream;
+
+    aubFileStream.open("file_name.aub");
+    EXPECT_EQ(AubMemDump::AubFileStream::defaultWriteBufferSize, aubFileStream.writeBufferSize);
+    EXPECT_NE(nullptr, aubFileStream.writeBuffer.get());
+    aubFileStream.close();
+
+    DebugManager.flags.AubDumpWriteBufferSize.set(4096);
+    aubFileStream.open("file_name.aub");
+    EXPECT_EQ(4096u, aubFileStream.writeBufferSize);
+    EXPECT_TRUE(aubFileStream.isOpen());
+    aubFileStream.close();
+}
+
+TEST(AubFileStreamWriteBufferTests, givenAubDumpWriteBufferSizeZeroWhenFileIsOpenedThenNoWriteBufferIsAllocated) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.AubDumpWriteBufferSize.set(0);
+    AubMemDump::AubFileStream aubFileStream;
+
+    aubFileStream.open("file_name.aub");
+    EXPECT_TRUE(aubFileStream.isOpen());
+    EXPECT_EQ(nullptr, aubFileStream.writeBuffer.get());
+    aubFileStream.close();
+}
+
+TEST(AubFileStreamWriteBufferTests, givenNegativeAubDumpWriteBufferSizeWhenFileIsOpenedThenDefaultWriteBufferSizeIsUsed) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.AubDumpWriteBufferSize.set(-2);
+    AubMemDump::AubFileStream aubFileStream;
+
+    aubFileStream.open("file_name.aub");
+    EXPECT_TRUE(aubFileStream.isOpen());
+    EXPECT_EQ(AubMemDump::AubFileStream::defaultWriteBufferSize, aubFileStream.writeBufferSize);
+    aubFileStream.close();
+}
+
 HWTEST_F(AubFileStreamTests, givenAubCommandStreamReceiverWithoutAubManagerWhenInitFileIsCalledThenFileShouldBeInitializedWithHeaderOnce) {
     auto mockAubFileStream = std::make_unique<MockAubFileStream>();
     auto aubCsr = std::make_unique<AUBCommandStreamReceiverHw<FamilyType>>("", true, *pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
@@ -21,6 +21,8 @@
 #include "opencl/test/unit_test/mocks/mock_submissions_aggregator.h"
 #include "test.h"
 
+#include <limits>
+
 using namespace NEO;
 
 typedef UltCommandStreamReceiverTest CommandStreamReceiverFlushTaskTests;
@@ -311,6 +313,27 @@ HWCMDTEST_F(IGFX_GEN8_CORE, CommandStreamReceiverFlushTaskTests, givenCommandStr
     EXPECT_FALSE(commandStreamReceiver.requiresInstructionCacheFlush);
 }
 
+HWCMDTEST_F(IGFX_GEN8_CORE, CommandStreamReceiverFlushTaskTests, givenCommandStreamReceiverWithFullCacheFlushRequestWhenFlushTaskIsCalledThenPipeControlWithDcFlushAndInvalidationsIsEmitted) {
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+
+    configureCSRtoNonDirtyState<FamilyType>(false);
+
+    commandStreamReceiver.registerFullCacheFlush();
+    EXPECT_EQ(1u, commandStreamReceiver.recursiveLockCounter);
+
+    flushTask(commandStreamReceiver);
+
+    parseCommands<FamilyType>(commandStreamReceiver.commandStream, 0);
+
+    auto itorPC = find<typename FamilyType::PIPE_CONTROL *>(cmdList.begin(), cmdList.end());
+    ASSERT_NE(cmdList.end(), itorPC);
+    auto pipeControlCmd = reinterpret_cast<typename FamilyType::PIPE_CONTROL *>(*itorPC);
+    EXPECT_TRUE(pipeControlCmd->getDcFlushEnable());
+    EXPECT_TRUE(pipeControlCmd->getTextureCacheInvalidationEnable());
+    EXPECT_TRUE(pipeControlCmd->getConstantCacheInvalidationEnable());
+    EXPECT_FALSE(commandStreamReceiver.requiresFullCacheFlush);
+}
+
 HWCMDTEST_F(IGFX_GEN8_CORE, CommandStreamReceiverFlushTaskTests, givenHigherTaskLevelWhenTimestampPacketWriteIsEnabledThenDontAddPipeControl) {
     auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
     commandStreamReceiver.timestampPacketWriteEnabled = true;
@@ -736,6 +759,70 @@ HWTEST_F(CommandStreamReceiverFlushTaskTests, givenSshHeapChangeWhenFlushTaskIsC
     EXPECT_NE(cmdList.end(), stateBaseAddressItor);
 }
 
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenSshHeapChangeWhenFlushTaskIsCalledThenSbaReprogrammingIsCountedWithSshCause) {
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    configureCSRtoNonDirtyState<FamilyType>(false);
+    auto countersBefore = commandStreamReceiver.getStateReprogrammingCounters();
+
+    ssh.replaceBuffer(nullptr, 0);
+    flushTask(commandStreamReceiver);
+
+    const auto &counters = commandStreamReceiver.getStateReprogrammingCounters();
+    EXPECT_EQ(countersBefore.flushes + 1, counters.flushes);
+    EXPECT_EQ(countersBefore.stateBaseAddress + 1, counters.stateBaseAddress);
+    EXPECT_EQ(countersBefore.surfaceStateHeap + 1, counters.surfaceStateHeap);
+    EXPECT_EQ(countersBefore.dynamicStateHeap, counters.dynamicStateHeap);
+    EXPECT_EQ(countersBefore.indirectObjectHeap, counters.indirectObjectHeap);
+    EXPECT_EQ(countersBefore.statelessMocs, counters.statelessMocs);
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenNonDirtyCsrWhenFlushTaskIsCalledThenOnlyFlushIsCountedInStateReprogrammingCounters) {
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    configureCSRtoNonDirtyState<FamilyType>(false);
+    auto countersBefore = commandStreamReceiver.getStateReprogrammingCounters();
+
+    flushTask(commandStreamReceiver);
+
+    const auto &counters = commandStreamReceiver.getStateReprogrammingCounters();
+    EXPECT_EQ(countersBefore.flushes + 1, counters.flushes);
+    EXPECT_EQ(countersBefore.stateBaseAddress, counters.stateBaseAddress);
+    EXPECT_EQ(countersBefore.l3Config, counters.l3Config);
+    EXPECT_EQ(countersBefore.numGrf, counters.numGrf);
+    EXPECT_EQ(countersBefore.mediaVfeState, counters.mediaVfeState);
+    EXPECT_EQ(countersBefore.preemption, counters.preemption);
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenSshHeapChangeWhenFlushTaskIsCalledThenSubmissionStatisticsCountFlushAndSbaReprogramming) {
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    configureCSRtoNonDirtyState<FamilyType>(false);
+    auto statisticsBefore = commandStreamReceiver.getSubmissionStatistics();
+
+    ssh.replaceBuffer(nullptr, 0);
+    flushTask(commandStreamReceiver);
+
+    auto statistics = commandStreamReceiver.getSubmissionStatistics();
+    EXPECT_EQ(statisticsBefore.flushes + 1, statistics.flushes);
+    EXPECT_EQ(statisticsBefore.stateBaseAddressReprogrammings + 1, statistics.stateBaseAddressReprogrammings);
+    EXPECT_LT(statisticsBefore.stallingPipeControls, statistics.stallingPipeControls);
+    EXPECT_LT(statisticsBefore.cacheFlushes, statistics.cacheFlushes);
+}
+
+TEST(SubmissionCountersTest, WhenWaitTimesAreRecordedThenEachGoesToItsPowerOfTwoBucket) {
+    SubmissionCounters counters;
+    counters.recordWaitTime(0u);
+    counters.recordWaitTime(1u);
+    counters.recordWaitTime(3u);
+    counters.recordWaitTime(4u);
+    counters.recordWaitTime(std::numeric_limits<uint64_t>::max());
+
+    auto statistics = counters.read();
+    EXPECT_EQ(1u, statistics.waitTimeHistogram[0]);
+    EXPECT_EQ(1u, statistics.waitTimeHistogram[1]);
+    EXPECT_EQ(1u, statistics.waitTimeHistogram[2]);
+    EXPECT_EQ(1u, statistics.waitTimeHistogram[3]);
+    EXPECT_EQ(1u, statistics.waitTimeHistogram[waitTimeHistogramBuckets - 1]);
+}
+
 HWTEST_F(CommandStreamReceiverFlushTaskTests, givenIohHeapChangeWhenFlushTaskIsCalledThenSbaIsReloaded) {
     auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
     configureCSRtoNonDirtyState<FamilyType>(false);
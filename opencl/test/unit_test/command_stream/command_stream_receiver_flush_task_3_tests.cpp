@@ -5,6 +5,7 @@
  *
  */
 
+#include "shared/source/gmm_helper/gmm.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
@@ -608,6 +609,78 @@ HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCsrInBatchingModeWhenFlushTas
     EXPECT_EQ(2u, csr.peekLatestFlushedTaskCount());
 }
 
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCsrInBatchedDispatchWithCounterModeWhenMaxSubmissionsAreBatchedThenImplicitFlushIsCalled) {
+    CommandQueueHw<FamilyType> commandQueue(nullptr, pClDevice, 0, false);
+    auto &commandStream = commandQueue.getCS(4096u);
+
+    DispatchFlags dispatchFlags = DispatchFlagsHelper::createDefaultDispatchFlags();
+    dispatchFlags.preemptionMode = PreemptionHelper::getDefaultPreemptionMode(pDevice->getHardwareInfo());
+    dispatchFlags.guardCommandBufferWithPipeControl = true;
+
+    auto &csr = reinterpret_cast<UltCommandStreamReceiver<FamilyType> &>(commandQueue.getGpgpuCommandStreamReceiver());
+    csr.overrideDispatchPolicy(DispatchMode::BatchedDispatchWithCounter);
+    csr.useNewResourceImplicitFlush = false;
+    csr.useGpuIdleImplicitFlush = false;
+    csr.batchedDispatchMaxSubmissions = 3u;
+
+    for (uint32_t submission = 1u; submission <= 4u; submission++) {
+        dispatchFlags.implicitFlush = false;
+        csr.flushTask(commandStream,
+                      0,
+                      dsh,
+                      ioh,
+                      ssh,
+                      taskLevel,
+                      dispatchFlags,
+                      *pDevice);
+
+        EXPECT_EQ(submission, csr.peekLatestSentTaskCount());
+        EXPECT_EQ(submission < 3u ? 0u : 3u, csr.peekLatestFlushedTaskCount());
+    }
+    EXPECT_EQ(1u, csr.batchedSubmissionsCount);
+    EXPECT_FALSE(csr.submissionAggregator->peekCmdBufferList().peekIsEmpty());
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCsrInBatchedDispatchWithCounterModeWhenBatchSizeBudgetIsExceededThenImplicitFlushIsCalled) {
+    CommandQueueHw<FamilyType> commandQueue(nullptr, pClDevice, 0, false);
+    auto &commandStream = commandQueue.getCS(4096u);
+
+    DispatchFlags dispatchFlags = DispatchFlagsHelper::createDefaultDispatchFlags();
+    dispatchFlags.preemptionMode = PreemptionHelper::getDefaultPreemptionMode(pDevice->getHardwareInfo());
+    dispatchFlags.guardCommandBufferWithPipeControl = true;
+    dispatchFlags.implicitFlush = false;
+
+    auto &csr = reinterpret_cast<UltCommandStreamReceiver<FamilyType> &>(commandQueue.getGpgpuCommandStreamReceiver());
+    csr.overrideDispatchPolicy(DispatchMode::BatchedDispatchWithCounter);
+    csr.useNewResourceImplicitFlush = false;
+    csr.useGpuIdleImplicitFlush = false;
+    csr.batchedDispatchMaxBatchSize = 1u;
+
+    csr.flushTask(commandStream,
+                  0,
+                  dsh,
+                  ioh,
+                  ssh,
+                  taskLevel,
+                  dispatchFlags,
+                  *pDevice);
+
+    EXPECT_EQ(1u, csr.peekLatestFlushedTaskCount());
+    EXPECT_EQ(0u, csr.batchedSubmissionsCount);
+    EXPECT_EQ(0u, csr.batchedSubmissionsSize);
+    EXPECT_TRUE(csr.submissionAggregator->peekCmdBufferList().peekIsEmpty());
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenBatchedDispatchDebugFlagsWhenCsrIsCreatedThenBatchingLimitsAreOverridden) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.BatchedDispatchMaxSubmissions.set(5);
+    DebugManager.flags.BatchedDispatchMaxBatchSize.set(4096);
+
+    UltCommandStreamReceiver<FamilyType> csr(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    EXPECT_EQ(5u, csr.batchedDispatchMaxSubmissions);
+    EXPECT_EQ(4096u, csr.batchedDispatchMaxBatchSize);
+}
+
 HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCsrInBatchingModeWhenWaitForTaskCountIsCalledWithTaskCountThatWasNotYetFlushedThenBatchedCommandBuffersAreSubmitted) {
     CommandQueueHw<FamilyType> commandQueue(nullptr, pClDevice, 0, false);
     auto &commandStream = commandQueue.getCS(4096u);
@@ -1898,6 +1971,42 @@ HWTEST_F(CommandStreamReceiverFlushTaskTests, givenCommandStreamReceiverWhenInit
     memoryManager->freeGraphicsMemory(graphicsAllocation);
 }
 
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenPendingAuxTableMapWhenFlushTaskIsCalledThenAuxTableIsUpdatedBeforeSubmission) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.BatchAuxTableUpdates.set(1);
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+
+    auto pageTableManager = new ::testing::NiceMock<MockGmmPageTableMngr>();
+    pDevice->getExecutionEnvironment()->rootDeviceEnvironments[pDevice->getRootDeviceIndex()]->pageTableManager.reset(pageTableManager);
+    std::unique_ptr<Gmm> gmm(new Gmm(pDevice->getGmmClientContext(), nullptr, 1, false));
+    pageTableManager->deferAuxTableMap(0x1000, gmm.get());
+
+    EXPECT_CALL(*pageTableManager, updateAuxTable(::testing::_)).Times(1).WillOnce(::testing::Return(GMM_SUCCESS));
+    auto completionStamp = flushTask(commandStreamReceiver);
+
+    EXPECT_EQ(1u, completionStamp.taskCount);
+    EXPECT_EQ(1u, commandStreamReceiver.peekTaskCount());
+    EXPECT_FALSE(pageTableManager->removePendingAuxTableMap(0x1000));
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenPendingAuxTableMapWhenAuxTableUpdateFailsThenSubmissionIsRejected) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.BatchAuxTableUpdates.set(1);
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+
+    auto pageTableManager = new ::testing::NiceMock<MockGmmPageTableMngr>();
+    pDevice->getExecutionEnvironment()->rootDeviceEnvironments[pDevice->getRootDeviceIndex()]->pageTableManager.reset(pageTableManager);
+    std::unique_ptr<Gmm> gmm(new Gmm(pDevice->getGmmClientContext(), nullptr, 1, false));
+    pageTableManager->deferAuxTableMap(0x1000, gmm.get());
+
+    EXPECT_CALL(*pageTableManager, updateAuxTable(::testing::_)).Times(1).WillOnce(::testing::Return(GMM_ERROR));
+    auto completionStamp = flushTask(commandStreamReceiver);
+
+    EXPECT_EQ(CompletionStamp::failed, completionStamp.taskCount);
+    EXPECT_EQ(0u, commandStreamReceiver.peekTaskCount());
+    EXPECT_EQ(0u, commandStreamReceiver.commandStream.getUsed());
+}
+
 HWTEST_F(CommandStreamReceiverFlushTaskTests, WhenCsrIsMarkedWithNewResourceThenCallBatchedSubmission) {
     auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
     commandStreamReceiver.dispatchMode = DispatchMode::BatchedDispatch;
@@ -2026,6 +2135,38 @@ TEST(MultiRootDeviceCommandStreamReceiverTests, givenMultipleEventInMultiRootDev
     }
 }
 
+TEST(MultiRootDeviceCommandStreamReceiverTests, givenEventsFromPreviousDeviceAlreadyCompletedWhenTheyArePassedToMarkerThenCsrDoesNotWaitForThem) {
+    auto deviceFactory = std::make_unique<UltClDeviceFactory>(3, 0);
+    auto device1 = deviceFactory->rootDevices[1];
+    auto device2 = deviceFactory->rootDevices[2];
+
+    auto mockCsr1 = new MockCommandStreamReceiver(*device1->executionEnvironment, device1->getRootDeviceIndex(), device1->getDeviceBitfield());
+    auto mockCsr2 = new MockCommandStreamReceiver(*device2->executionEnvironment, device2->getRootDeviceIndex(), device2->getDeviceBitfield());
+
+    device1->resetCommandStreamReceiver(mockCsr1);
+    device2->resetCommandStreamReceiver(mockCsr2);
+
+    cl_device_id devices[] = {device1, device2};
+
+    auto context = std::make_unique<MockContext>(ClDeviceVector(devices, 2), false);
+
+    auto pCmdQ1 = context.get()->getSpecialQueue(1u);
+    auto pCmdQ2 = context.get()->getSpecialQueue(2u);
+
+    Event event1(pCmdQ2, CL_COMMAND_NDRANGE_KERNEL, 3, 4);
+    Event event2(pCmdQ2, CL_COMMAND_NDRANGE_KERNEL, 2, 7);
+    cl_event eventWaitList[] = {&event1, &event2};
+
+    mockCsr2->callParentGetTagAddress = false;
+    mockCsr2->mockTagAddress = 7u;
+    pCmdQ1->enqueueMarkerWithWaitList(2u, eventWaitList, nullptr);
+    EXPECT_EQ(0u, mockCsr2->waitForCompletionWithTimeoutCalled);
+
+    mockCsr2->mockTagAddress = 5u;
+    pCmdQ1->enqueueMarkerWithWaitList(2u, eventWaitList, nullptr);
+    EXPECT_EQ(1u, mockCsr2->waitForCompletionWithTimeoutCalled);
+}
+
 HWTEST_F(CommandStreamReceiverFlushTaskTests, givenStaticPartitioningEnabledWhenFlushingTaskThenWorkPartitionAllocationIsMadeResident) {
     DebugManagerStateRestore restore{};
     DebugManager.flags.EnableStaticPartitioning.set(1);
@@ -947,7 +947,7 @@ HWTEST_F(BcsTests, givenBltSizeWithLeftoverWhenDispatchedThenProgramAllRequiredC
 }
 HWTEST_F(BcsTests, givenCommandTypeWhenObtainBlitDirectionIsCalledThenReturnCorrectBlitDirection) {
 
-    std::array<std::pair<uint32_t, BlitterConstants::BlitDirection>, 9> testParams{
+    std::array<std::pair<uint32_t, BlitterConstants::BlitDirection>, 13> testParams{
         std::make_pair(CL_COMMAND_WRITE_BUFFER, BlitterConstants::BlitDirection::HostPtrToBuffer),
         std::make_pair(CL_COMMAND_WRITE_BUFFER_RECT, BlitterConstants::BlitDirection::HostPtrToBuffer),
         std::make_pair(CL_COMMAND_READ_BUFFER, BlitterConstants::BlitDirection::BufferToHostPtr),
@@ -956,6 +956,10 @@ HWTEST_F(BcsTests, givenCommandTypeWhenObtainBlitDirectionIsCalledThenReturnCorr
         std::make_pair(CL_COMMAND_SVM_MEMCPY, BlitterConstants::BlitDirection::BufferToBuffer),
         std::make_pair(CL_COMMAND_WRITE_IMAGE, BlitterConstants::BlitDirection::HostPtrToImage),
         std::make_pair(CL_COMMAND_READ_IMAGE, BlitterConstants::BlitDirection::ImageToHostPtr),
+        std::make_pair(CL_COMMAND_COPY_IMAGE, BlitterConstants::BlitDirection::ImageToImage),
+        std::make_pair(CL_COMMAND_COPY_BUFFER_TO_IMAGE, BlitterConstants::BlitDirection::BufferToImage),
+        std::make_pair(CL_COMMAND_COPY_IMAGE_TO_BUFFER, BlitterConstants::BlitDirection::ImageToBuffer),
+        std::make_pair(CL_COMMAND_FILL_BUFFER, BlitterConstants::BlitDirection::PatternToBuffer),
         std::make_pair(CL_COMMAND_COPY_BUFFER, BlitterConstants::BlitDirection::BufferToBuffer)};
 
     for (const auto &params : testParams) {
@@ -969,7 +973,7 @@ HWTEST_F(BcsTests, givenCommandTypeWhenObtainBlitDirectionIsCalledThenReturnCorr
 }
 
 HWTEST_F(BcsTests, givenWrongCommandTypeWhenObtainBlitDirectionIsCalledThenExpectThrow) {
-    uint32_t wrongCommandType = CL_COMMAND_COPY_IMAGE;
+    uint32_t wrongCommandType = CL_COMMAND_FILL_IMAGE;
     EXPECT_THROW(ClBlitProperties::obtainBlitDirection(wrongCommandType), std::exception);
 }
 
@@ -1008,10 +1012,10 @@ struct BcsTestParam {
     {{(2 * BlitterConstants::maxBlitWidth * BlitterConstants::maxBlitHeight) + 17, 4, 2},
      {0, 0, 0},
      {0, 0, 0},
-     (2 * BlitterConstants::maxBlitWidth * BlitterConstants::maxBlitHeight) + 17,
-     ((2 * BlitterConstants::maxBlitWidth * BlitterConstants::maxBlitHeight) + 17) * 4,
-     (2 * BlitterConstants::maxBlitWidth * BlitterConstants::maxBlitHeight) + 17,
-     ((2 * BlitterConstants::maxBlitWidth * BlitterConstants::maxBlitHeight) + 17) * 4},
+     ((2 * BlitterConstants::maxBlitWidth * BlitterConstants::maxBlitHeight) + 17) + 1,
+     (((2 * BlitterConstants::maxBlitWidth * BlitterConstants::maxBlitHeight) + 17) + 1) * 4,
+     ((2 * BlitterConstants::maxBlitWidth * BlitterConstants::maxBlitHeight) + 17) + 1,
+     (((2 * BlitterConstants::maxBlitWidth * BlitterConstants::maxBlitHeight) + 17) + 1) * 4},
     {{(2 * BlitterConstants::maxBlitWidth * BlitterConstants::maxBlitHeight) + 17, 3, 2},
      {BlitterConstants::maxBlitWidth, 2, 2},
      {BlitterConstants::maxBlitWidth, 1, 1},
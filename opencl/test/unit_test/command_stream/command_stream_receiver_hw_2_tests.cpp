@@ -203,6 +203,62 @@ HWTEST_F(BcsTests, WhenGetNumberOfBlitsIsCalledThenCorrectValuesAreReturned) {
     }
 }
 
+HWTEST_F(BcsTests, givenContiguousRowsAndSlicesWhenGettingCopySizesThenTheyAreMerged) {
+    auto &rootDeviceEnvironment = pClDevice->getRootDeviceEnvironment();
+    BlitProperties blitProperties;
+    blitProperties.blitDirection = BlitterConstants::BlitDirection::BufferToBuffer;
+    blitProperties.copySize = {100, 4, 2};
+
+    blitProperties.srcRowPitch = 100;
+    blitProperties.dstRowPitch = 100;
+    blitProperties.srcSlicePitch = 400;
+    blitProperties.dstSlicePitch = 400;
+    EXPECT_EQ((Vec3<size_t>{800, 1, 1}), BlitCommandsHelper<FamilyType>::getCopySizeForBufferPerRow(blitProperties));
+    EXPECT_EQ(1u, BlitCommandsHelper<FamilyType>::getNumberOfBlits(blitProperties, rootDeviceEnvironment));
+
+    blitProperties.dstSlicePitch = 512;
+    EXPECT_EQ((Vec3<size_t>{400, 1, 2}), BlitCommandsHelper<FamilyType>::getCopySizeForBufferPerRow(blitProperties));
+    EXPECT_EQ(blitProperties.copySize, BlitCommandsHelper<FamilyType>::getCopySizeForBufferRegion(blitProperties));
+
+    blitProperties.srcRowPitch = 128;
+    blitProperties.dstRowPitch = 128;
+    blitProperties.srcSlicePitch = 512;
+    EXPECT_EQ(blitProperties.copySize, BlitCommandsHelper<FamilyType>::getCopySizeForBufferPerRow(blitProperties));
+    EXPECT_EQ((Vec3<size_t>{100, 8, 1}), BlitCommandsHelper<FamilyType>::getCopySizeForBufferRegion(blitProperties));
+    EXPECT_EQ(1u, BlitCommandsHelper<FamilyType>::getNumberOfBlits(blitProperties, rootDeviceEnvironment));
+    EXPECT_TRUE(BlitCommandsHelper<FamilyType>::isCopyRegionPreferred(blitProperties, rootDeviceEnvironment));
+
+    blitProperties.blitDirection = BlitterConstants::BlitDirection::ImageToHostPtr;
+    EXPECT_EQ(2u, BlitCommandsHelper<FamilyType>::getNumberOfBlits(blitProperties, rootDeviceEnvironment));
+}
+
+HWTEST_F(BcsTests, givenContiguousBufferRectWhenBlitBufferIsCalledThenSingleLinearBlitIsProgrammed) {
+    using XY_COPY_BLT = typename FamilyType::XY_COPY_BLT;
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+
+    cl_int retVal = CL_SUCCESS;
+    auto buffer1 = clUniquePtr<Buffer>(Buffer::create(context.get(), CL_MEM_READ_WRITE, 800, nullptr, retVal));
+    auto buffer2 = clUniquePtr<Buffer>(Buffer::create(context.get(), CL_MEM_READ_WRITE, 800, nullptr, retVal));
+    auto graphicsAllocation1 = buffer1->getGraphicsAllocation(pDevice->getRootDeviceIndex());
+    auto graphicsAllocation2 = buffer2->getGraphicsAllocation(pDevice->getRootDeviceIndex());
+
+    auto blitProperties = BlitProperties::constructPropertiesForCopyBuffer(graphicsAllocation1, graphicsAllocation2,
+                                                                           {0, 0, 0}, {0, 0, 0}, {100, 4, 2},
+                                                                           100, 400, 100, 400, csr.getClearColorAllocation());
+
+    blitBuffer(&csr, blitProperties, true);
+
+    HardwareParse hwParser;
+    hwParser.parseCommands<FamilyType>(csr.commandStream, 0);
+    auto bltCmds = findAll<XY_COPY_BLT *>(hwParser.cmdList.begin(), hwParser.cmdList.end());
+    ASSERT_EQ(1u, bltCmds.size());
+    auto bltCmd = genCmdCast<XY_COPY_BLT *>(*bltCmds[0]);
+    EXPECT_EQ(800u, bltCmd->getTransferWidth());
+    EXPECT_EQ(1u, bltCmd->getTransferHeight());
+    EXPECT_EQ(graphicsAllocation1->getGpuAddress(), bltCmd->getDestinationBaseAddress());
+    EXPECT_EQ(graphicsAllocation2->getGpuAddress(), bltCmd->getSourceBaseAddress());
+}
+
 HWTEST_F(BcsTests, givenCsrDependenciesWhenProgrammingCommandStreamThenAddSemaphoreAndAtomic) {
     auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
 
@@ -1441,6 +1497,109 @@ HWTEST_F(BcsTests, given3dImageWhenBlitBufferIsCalledThenBlitCmdIsFoundZtimes) {
     EXPECT_EQ(static_cast<uint32_t>(builtinOpParams.size.z), xyCopyBltCmdFound);
 }
 
+HWTEST_F(BcsTests, given3dImagesWhenCopyImageBlitBufferIsCalledThenBlitCmdIsFoundZtimes) {
+    if (!pDevice->getHardwareInfo().capabilityTable.supportsImages) {
+        GTEST_SKIP();
+    }
+    std::unique_ptr<Image> srcImage(Image3dHelper<>::create(context.get()));
+    std::unique_ptr<Image> dstImage(Image3dHelper<>::create(context.get()));
+    BuiltinOpParams builtinOpParams{};
+    builtinOpParams.srcMemObj = srcImage.get();
+    builtinOpParams.dstMemObj = dstImage.get();
+    builtinOpParams.size = {1, 1, 10};
+
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    auto blitProperties = ClBlitProperties::constructProperties(BlitterConstants::BlitDirection::ImageToImage,
+                                                                csr,
+                                                                builtinOpParams);
+    blitBuffer(&csr, blitProperties, true);
+    HardwareParse hwParser;
+    hwParser.parseCommands<FamilyType>(csr.commandStream, 0);
+    uint32_t xyCopyBltCmdFound = 0;
+
+    for (auto &cmd : hwParser.cmdList) {
+        if (auto bltCmd = genCmdCast<typename FamilyType::XY_COPY_BLT *>(cmd)) {
+            ++xyCopyBltCmdFound;
+        }
+    }
+    EXPECT_EQ(static_cast<uint32_t>(builtinOpParams.size.z), xyCopyBltCmdFound);
+}
+
+HWTEST_F(BcsTests, givenImageToBufferWhenConstructPropertiesIsCalledThenBufferRegionIsTightlyPacked) {
+    cl_image_desc imgDesc = Image2dDefaults::imageDesc;
+    imgDesc.image_width = 10u;
+    imgDesc.image_height = 12u;
+    std::unique_ptr<Image> image(Image2dHelper<>::create(context.get(), &imgDesc));
+    cl_int retVal = CL_SUCCESS;
+    auto buffer = clUniquePtr<Buffer>(Buffer::create(context.get(), CL_MEM_READ_WRITE, 1024, nullptr, retVal));
+    BuiltinOpParams builtinOpParams{};
+    builtinOpParams.srcMemObj = image.get();
+    builtinOpParams.dstMemObj = buffer.get();
+    builtinOpParams.srcOffset = {1, 2, 0};
+    builtinOpParams.dstOffset = {0x40, 0, 0};
+    builtinOpParams.size = {2, 3, 1};
+
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    auto srcAllocation = image->getGraphicsAllocation(csr.getRootDeviceIndex());
+    auto dstAllocation = buffer->getGraphicsAllocation(csr.getRootDeviceIndex());
+    auto expectedBytesPerPixel = image->getSurfaceFormatInfo().surfaceFormat.ImageElementSizeInBytes;
+    Vec3<size_t> expectedDstOffset = 0;
+
+    auto blitProperties = ClBlitProperties::constructProperties(BlitterConstants::BlitDirection::ImageToBuffer,
+                                                                csr,
+                                                                builtinOpParams);
+
+    EXPECT_EQ(BlitterConstants::BlitDirection::ImageToBuffer, blitProperties.blitDirection);
+    EXPECT_EQ(srcAllocation, blitProperties.srcAllocation);
+    EXPECT_EQ(dstAllocation, blitProperties.dstAllocation);
+    EXPECT_EQ(srcAllocation->getGpuAddress(), blitProperties.srcGpuAddress);
+    EXPECT_EQ(dstAllocation->getGpuAddress() + builtinOpParams.dstOffset.x, blitProperties.dstGpuAddress);
+    EXPECT_EQ(builtinOpParams.size, blitProperties.copySize);
+    EXPECT_EQ(builtinOpParams.srcOffset, blitProperties.srcOffset);
+    EXPECT_EQ(expectedDstOffset, blitProperties.dstOffset);
+    EXPECT_EQ(expectedBytesPerPixel, blitProperties.bytesPerPixel);
+    EXPECT_EQ(image->getImageDesc().image_row_pitch, blitProperties.srcRowPitch);
+    EXPECT_EQ(image->getImageDesc().image_slice_pitch, blitProperties.srcSlicePitch);
+    EXPECT_EQ(expectedBytesPerPixel * builtinOpParams.size.x, blitProperties.dstRowPitch);
+    EXPECT_EQ(expectedBytesPerPixel * builtinOpParams.size.x * builtinOpParams.size.y, blitProperties.dstSlicePitch);
+}
+
+HWTEST_F(BcsTests, givenPatternToBufferWhenBlitBufferIsCalledThenColorBltWithWidenedPatternIsProgrammedAtBufferOffset) {
+    using XY_COLOR_BLT = typename FamilyType::XY_COLOR_BLT;
+    cl_int retVal = CL_SUCCESS;
+    auto buffer = clUniquePtr<Buffer>(Buffer::create(context.get(), CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, retVal));
+    uint32_t pattern[4] = {0xAB};
+    BuiltinOpParams builtinOpParams{};
+    builtinOpParams.srcPtr = pattern;
+    builtinOpParams.patternSize = 1;
+    builtinOpParams.dstMemObj = buffer.get();
+    builtinOpParams.dstOffset = {0x40, 0, 0};
+    builtinOpParams.size = {0x100, 0, 0};
+
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    auto dstAllocation = buffer->getGraphicsAllocation(csr.getRootDeviceIndex());
+    auto blitProperties = ClBlitProperties::constructProperties(BlitterConstants::BlitDirection::PatternToBuffer,
+                                                                csr,
+                                                                builtinOpParams);
+
+    auto maxPatternSize = HwHelper::get(pDevice->getHardwareInfo().platform.eRenderCoreFamily).getMaxFillPaternSizeForCopyEngine();
+    EXPECT_EQ(BlitterConstants::BlitDirection::PatternToBuffer, blitProperties.blitDirection);
+    EXPECT_EQ(dstAllocation, blitProperties.dstAllocation);
+    EXPECT_EQ(dstAllocation->getGpuAddress() + builtinOpParams.dstOffset.x, blitProperties.dstGpuAddress);
+    EXPECT_EQ(maxPatternSize, blitProperties.fillPatternSize);
+    EXPECT_EQ(builtinOpParams.size.x / maxPatternSize, blitProperties.copySize.x);
+    EXPECT_EQ(0xABABABABu, blitProperties.fillPattern[0]);
+
+    blitBuffer(&csr, blitProperties, true);
+
+    HardwareParse hwParser;
+    hwParser.parseCommands<FamilyType>(csr.commandStream, 0);
+    auto cmdIterator = find<XY_COLOR_BLT *>(hwParser.cmdList.begin(), hwParser.cmdList.end());
+    ASSERT_NE(hwParser.cmdList.end(), cmdIterator);
+    auto colorBltCmd = genCmdCast<XY_COLOR_BLT *>(*cmdIterator);
+    EXPECT_EQ(blitProperties.dstGpuAddress, colorBltCmd->getDestinationBaseAddress());
+}
+
 HWTEST_F(BcsTests, givenImageToHostPtrWhenBlitBufferIsCalledThenBlitCmdIsFound) {
     if (!pDevice->getHardwareInfo().capabilityTable.supportsImages) {
         GTEST_SKIP();
@@ -1559,6 +1718,30 @@ TEST_F(ScratchSpaceControllerTest, whenScratchSpaceControllerIsDestroyedThenItRe
     //no memory leak is expected
 }
 
+TEST_F(ScratchSpaceControllerTest, givenScratchLargerThanRequiredWhenShrinkingScratchSpaceThenAllocationIsReleasedAndSmallerOneIsCreatedOnNextRequest) {
+    auto &csr = pDevice->getGpgpuCommandStreamReceiver();
+    MockScratchSpaceController scratchSpaceController(pDevice->getRootDeviceIndex(), *pDevice->getExecutionEnvironment(), *csr.getInternalAllocationStorage());
+    bool stateBaseAddressDirty = false;
+    bool vfeStateDirty = false;
+
+    scratchSpaceController.setRequiredScratchSpace(nullptr, 0u, 0x2000u, 0u, 0u, csr.getOsContext(), stateBaseAddressDirty, vfeStateDirty);
+    ASSERT_NE(nullptr, scratchSpaceController.getScratchSpaceAllocation());
+
+    EXPECT_FALSE(scratchSpaceController.shrinkScratchSpace(0x2000u, 0u, csr.getOsContext()));
+    EXPECT_FALSE(scratchSpaceController.shrinkScratchSpace(0u, 0u, csr.getOsContext()));
+    EXPECT_EQ(0x2000u, scratchSpaceController.getPerThreadScratchSpaceSize());
+
+    EXPECT_TRUE(scratchSpaceController.shrinkScratchSpace(0x400u, 0u, csr.getOsContext()));
+    EXPECT_EQ(nullptr, scratchSpaceController.getScratchSpaceAllocation());
+    EXPECT_FALSE(csr.getInternalAllocationStorage()->getTemporaryAllocations().peekIsEmpty());
+
+    vfeStateDirty = false;
+    scratchSpaceController.setRequiredScratchSpace(nullptr, 0u, 0x400u, 0u, 0u, csr.getOsContext(), stateBaseAddressDirty, vfeStateDirty);
+    EXPECT_NE(nullptr, scratchSpaceController.getScratchSpaceAllocation());
+    EXPECT_EQ(0x400u, scratchSpaceController.getPerThreadScratchSpaceSize());
+    EXPECT_TRUE(vfeStateDirty);
+}
+
 TEST(BcsConstantsTests, givenBlitConstantsThenTheyHaveDesiredValues) {
     EXPECT_EQ(BlitterConstants::maxBlitWidth, 0x4000u);
     EXPECT_EQ(BlitterConstants::maxBlitHeight, 0x4000u);
@@ -19,6 +19,7 @@
 #include "shared/source/memory_manager/surface.h"
 #include "shared/source/os_interface/device_factory.h"
 #include "shared/source/utilities/tag_allocator.h"
+#include "shared/test/common/cmd_parse/gen_cmd_parse.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
 #include "shared/test/common/mocks/ult_device_factory.h"
@@ -46,6 +47,9 @@
 #include "command_stream_receiver_simulated_hw.h"
 #include "gmock/gmock.h"
 
+#include <atomic>
+#include <thread>
+
 using namespace NEO;
 
 struct CommandStreamReceiverTest : public ClDeviceFixture,
@@ -345,6 +349,75 @@ HWTEST_F(CommandStreamReceiverTest, whenClearColorAllocationIsCreatedThenItIsDes
     EXPECT_EQ(nullptr, csr.clearColorAllocation);
 }
 
+HWTEST_F(CommandStreamReceiverTest, givenBatchBuffersRecordedForCoalescingWhenWaitingForCoalescedSubmissionThenBatchBuffersAreChainedIntoSingleFlush) {
+    using MI_BATCH_BUFFER_START = typename FamilyType::MI_BATCH_BUFFER_START;
+    using MI_BATCH_BUFFER_END = typename FamilyType::MI_BATCH_BUFFER_END;
+
+    auto mockCsr = new MockCsrHw2<FamilyType>(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    pDevice->resetCommandStreamReceiver(mockCsr);
+
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties({pDevice->getRootDeviceIndex(), MemoryConstants::pageSize, GraphicsAllocation::AllocationType::COMMAND_BUFFER, pDevice->getDeviceBitfield()});
+    ASSERT_NE(nullptr, allocation);
+    LinearStream commandStream(allocation);
+
+    ResidencyContainer residency;
+    void *endingCmds[2] = {};
+    for (auto &endingCmd : endingCmds) {
+        size_t startOffset = commandStream.getUsed();
+        endingCmd = commandStream.getSpace(sizeof(MI_BATCH_BUFFER_START));
+        memset(endingCmd, 0, sizeof(MI_BATCH_BUFFER_START));
+        *reinterpret_cast<MI_BATCH_BUFFER_END *>(endingCmd) = FamilyType::cmdInitBatchBufferEnd;
+
+        BatchBuffer batchBuffer(allocation, startOffset, 0u, nullptr, false, false, QueueThrottle::HIGH, QueueSliceCount::defaultSliceCount,
+                                commandStream.getUsed(), &commandStream, endingCmd, false);
+        auto lock = mockCsr->obtainUniqueOwnership();
+        auto flushRequired = mockCsr->recordBatchBufferForCoalescing(batchBuffer, residency, *pDevice);
+        EXPECT_EQ(endingCmd == endingCmds[0], flushRequired);
+    }
+    EXPECT_EQ(2u, mockCsr->peekTaskCount());
+    EXPECT_EQ(0, mockCsr->flushCalledCount);
+
+    EXPECT_TRUE(mockCsr->waitForCoalescedSubmission(1u, true, std::chrono::microseconds(0)));
+    EXPECT_TRUE(mockCsr->waitForCoalescedSubmission(2u, false, std::chrono::microseconds(0)));
+
+    EXPECT_EQ(1, mockCsr->flushCalledCount);
+    EXPECT_TRUE(mockCsr->peekSubmissionAggregator()->peekCmdBufferList().peekIsEmpty());
+    EXPECT_EQ(2u, mockCsr->peekLatestFlushedTaskCount());
+
+    auto bbStart = genCmdCast<MI_BATCH_BUFFER_START *>(endingCmds[0]);
+    ASSERT_NE(nullptr, bbStart);
+    EXPECT_EQ(allocation->getGpuAddress() + ptrDiff(endingCmds[0], commandStream.getCpuBase()) + sizeof(MI_BATCH_BUFFER_START), bbStart->getBatchBufferStartAddressGraphicsaddress472());
+    EXPECT_NE(nullptr, genCmdCast<MI_BATCH_BUFFER_END *>(endingCmds[1]));
+
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+HWTEST_F(CommandStreamReceiverTest, givenCoalescedFlushPendingWhenRecordingNextBatchBufferAfterFlushThenFlushIsRequiredAgain) {
+    using MI_BATCH_BUFFER_START = typename FamilyType::MI_BATCH_BUFFER_START;
+
+    auto mockCsr = new MockCsrHw2<FamilyType>(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    pDevice->resetCommandStreamReceiver(mockCsr);
+
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties({pDevice->getRootDeviceIndex(), MemoryConstants::pageSize, GraphicsAllocation::AllocationType::COMMAND_BUFFER, pDevice->getDeviceBitfield()});
+    ASSERT_NE(nullptr, allocation);
+    LinearStream commandStream(allocation);
+
+    ResidencyContainer residency;
+    for (uint32_t submission = 1u; submission <= 2u; submission++) {
+        size_t startOffset = commandStream.getUsed();
+        auto endingCmd = commandStream.getSpace(sizeof(MI_BATCH_BUFFER_START));
+        memset(endingCmd, 0, sizeof(MI_BATCH_BUFFER_START));
+
+        BatchBuffer batchBuffer(allocation, startOffset, 0u, nullptr, false, false, QueueThrottle::HIGH, QueueSliceCount::defaultSliceCount,
+                                commandStream.getUsed(), &commandStream, endingCmd, false);
+        EXPECT_TRUE(mockCsr->recordBatchBufferForCoalescing(batchBuffer, residency, *pDevice));
+        EXPECT_TRUE(mockCsr->waitForCoalescedSubmission(submission, true, std::chrono::microseconds(0)));
+        EXPECT_EQ(static_cast<int>(submission), mockCsr->flushCalledCount);
+    }
+
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
 struct InitDirectSubmissionFixture {
     void SetUp() {
         DebugManager.flags.EnableDirectSubmission.set(1);
@@ -940,6 +1013,55 @@ TEST(CommandStreamReceiverSimpleTest, givenGpuNotIdleImplicitFlushCheckEnabledWh
     csr.mockTagAddress = 2u;
 }
 
+TEST(CommandStreamReceiverSimpleTest, givenCsrOwnershipSpinCountFlagWhenCsrIsCreatedThenSpinCountIsOverridden) {
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+    DeviceBitfield deviceBitfield(1);
+    {
+        MockCommandStreamReceiver csr(executionEnvironment, 0, deviceBitfield);
+        EXPECT_EQ(CommandStreamReceiver::defaultOwnershipSpinCount, csr.ownershipSpinCount);
+    }
+
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.CsrOwnershipSpinCount.set(0);
+    MockCommandStreamReceiver csr(executionEnvironment, 0, deviceBitfield);
+    EXPECT_EQ(0u, csr.ownershipSpinCount);
+}
+
+TEST(CommandStreamReceiverSimpleTest, givenOwnershipHeldByCurrentThreadWhenObtainingOwnershipThenItIsAcquiredRecursively) {
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+    DeviceBitfield deviceBitfield(1);
+    MockCommandStreamReceiver csr(executionEnvironment, 0, deviceBitfield);
+
+    auto lock = csr.obtainUniqueOwnership();
+    EXPECT_TRUE(lock.owns_lock());
+    auto recursiveLock = csr.obtainUniqueOwnership();
+    EXPECT_TRUE(recursiveLock.owns_lock());
+}
+
+TEST(CommandStreamReceiverSimpleTest, givenOwnershipHeldByOtherThreadWhenObtainingOwnershipThenItIsAcquiredAfterRelease) {
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+    DeviceBitfield deviceBitfield(1);
+    MockCommandStreamReceiver csr(executionEnvironment, 0, deviceBitfield);
+    csr.ownershipSpinCount = 1u;
+
+    auto lock = csr.obtainUniqueOwnership();
+    std::atomic<bool> acquired{false};
+    std::thread contender([&] {
+        auto contenderLock = csr.obtainUniqueOwnership();
+        acquired = contenderLock.owns_lock();
+    });
+
+    lock.unlock();
+    contender.join();
+    EXPECT_TRUE(acquired);
+}
+
 TEST(CommandStreamReceiverMultiContextTests, givenMultipleCsrsWhenSameResourcesAreUsedThenResidencyIsProperlyHandled) {
     auto executionEnvironment = platform()->peekExecutionEnvironment();
 
@@ -1171,6 +1293,114 @@ TEST_F(CommandStreamReceiverTest, givenMinimumSizeExceedsCurrentAndNoSuitableReu
     memoryManager->freeGraphicsMemory(commandStream.getGraphicsAllocation());
 }
 
+TEST_F(CommandStreamReceiverTest, givenMinimumSizeExceedsCurrentWhenCallingEnsureCommandBufferAllocationThenSizeIsRoundedUpToPowerOfTwoSizeClass) {
+    LinearStream commandStream;
+
+    commandStreamReceiver->ensureCommandBufferAllocation(commandStream, 2 * MemoryConstants::pageSize64k + 1u, 0u);
+    EXPECT_EQ(4 * MemoryConstants::pageSize64k, commandStream.getGraphicsAllocation()->getUnderlyingBufferSize());
+    EXPECT_EQ(4 * MemoryConstants::pageSize64k, commandStream.getMaxAvailableSpace());
+
+    memoryManager->freeGraphicsMemory(commandStream.getGraphicsAllocation());
+}
+
+TEST_F(CommandStreamReceiverTest, givenMinimumSizeAboveMaxSizeClassWhenCallingEnsureCommandBufferAllocationThenSizeIsAlignedTo64kb) {
+    LinearStream commandStream;
+
+    commandStreamReceiver->ensureCommandBufferAllocation(commandStream, CommandStreamReceiver::maxCommandBufferSizeClass + 1u, 0u);
+    EXPECT_EQ(CommandStreamReceiver::maxCommandBufferSizeClass + MemoryConstants::pageSize64k, commandStream.getGraphicsAllocation()->getUnderlyingBufferSize());
+
+    memoryManager->freeGraphicsMemory(commandStream.getGraphicsAllocation());
+}
+
+TEST_F(CommandStreamReceiverTest, givenCommandBufferPoolPrewarmCountWhenPreallocatingCommandBuffersThenTheyAreAvailableForReuse) {
+    DebugManagerStateRestore restorer;
+    EXPECT_TRUE(commandStreamReceiver->preallocateCommandBuffers());
+    EXPECT_TRUE(internalAllocationStorage->getAllocationsForReuse().peekIsEmpty());
+
+    DebugManager.flags.CommandBufferPoolPrewarmCount.set(2);
+    EXPECT_TRUE(commandStreamReceiver->preallocateCommandBuffers());
+    auto &reusableAllocations = internalAllocationStorage->getAllocationsForReuse();
+    ASSERT_FALSE(reusableAllocations.peekIsEmpty());
+    auto preallocatedCommandBuffer = reusableAllocations.peekHead();
+    EXPECT_EQ(GraphicsAllocation::AllocationType::COMMAND_BUFFER, preallocatedCommandBuffer->getAllocationType());
+    EXPECT_NE(nullptr, preallocatedCommandBuffer->next);
+
+    LinearStream commandStream;
+    commandStreamReceiver->ensureCommandBufferAllocation(commandStream, 1u, 0u);
+    EXPECT_EQ(preallocatedCommandBuffer, commandStream.getGraphicsAllocation());
+
+    memoryManager->freeGraphicsMemory(commandStream.getGraphicsAllocation());
+}
+
+TEST_F(CommandStreamReceiverTest, givenCommandBufferPoolHighWaterMarkWhenCommandBufferIsReplacedThenCompletedCommandBuffersAboveLimitAreReleased) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.CommandBufferPoolHighWaterMark.set(0);
+    *commandStreamReceiver->getTagAddress() = 0u;
+
+    LinearStream commandStream;
+    commandStreamReceiver->ensureCommandBufferAllocation(commandStream, 1u, 0u);
+    commandStreamReceiver->ensureCommandBufferAllocation(commandStream, MemoryConstants::pageSize64k + 1u, 0u);
+    EXPECT_TRUE(internalAllocationStorage->getAllocationsForReuse().peekIsEmpty());
+
+    memoryManager->freeGraphicsMemory(commandStream.getGraphicsAllocation());
+}
+
+TEST_F(CommandStreamReceiverTest, givenFullCommandStreamCompletedByGpuWhenCallingEnsureCommandBufferAllocationThenCommandBufferIsRewound) {
+    auto contextId = commandStreamReceiver->getOsContext().getContextId();
+    LinearStream commandStream;
+    commandStreamReceiver->ensureCommandBufferAllocation(commandStream, 1u, 0u);
+    auto allocation = commandStream.getGraphicsAllocation();
+    allocation->updateTaskCount(5u, contextId);
+
+    commandStream.getSpace(commandStream.getAvailableSpace());
+    *commandStreamReceiver->getTagAddress() = 5u;
+    commandStreamReceiver->ensureCommandBufferAllocation(commandStream, 1u, 0u);
+    EXPECT_EQ(allocation, commandStream.getGraphicsAllocation());
+    EXPECT_EQ(allocation->getUnderlyingBufferSize(), commandStream.getAvailableSpace());
+    EXPECT_TRUE(internalAllocationStorage->getAllocationsForReuse().peekIsEmpty());
+
+    commandStream.getSpace(commandStream.getAvailableSpace());
+    *commandStreamReceiver->getTagAddress() = 4u;
+    commandStreamReceiver->ensureCommandBufferAllocation(commandStream, 1u, 0u);
+    EXPECT_NE(allocation, commandStream.getGraphicsAllocation());
+    EXPECT_TRUE(internalAllocationStorage->getAllocationsForReuse().peekContains(*allocation));
+
+    memoryManager->freeGraphicsMemory(commandStream.getGraphicsAllocation());
+}
+
+TEST_F(CommandStreamReceiverTest, givenRecycleCompletedCommandBufferInPlaceDisabledWhenCallingEnsureCommandBufferAllocationThenCommandBufferIsReplaced) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.RecycleCompletedCommandBufferInPlace.set(0);
+    LinearStream commandStream;
+    commandStreamReceiver->ensureCommandBufferAllocation(commandStream, 1u, 0u);
+    auto allocation = commandStream.getGraphicsAllocation();
+    allocation->updateTaskCount(5u, commandStreamReceiver->getOsContext().getContextId());
+
+    commandStream.getSpace(commandStream.getAvailableSpace());
+    *commandStreamReceiver->getTagAddress() = 5u;
+    commandStreamReceiver->ensureCommandBufferAllocation(commandStream, 1u, 0u);
+    EXPECT_NE(allocation, commandStream.getGraphicsAllocation());
+
+    memoryManager->freeGraphicsMemory(commandStream.getGraphicsAllocation());
+}
+
+HWTEST_F(CommandStreamReceiverTest, givenTagPolledByAnotherWaiterWhenWaitingForCompletionThenWaiterTakesOverPollingOnlyAfterItIsReleased) {
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    *csr.getTagAddress() = 5u;
+    EXPECT_TRUE(csr.acquireTagPolling());
+    EXPECT_FALSE(csr.acquireTagPolling());
+
+    EXPECT_TRUE(csr.waitForCompletionWithTimeout(false, 0, 5u));
+    EXPECT_TRUE(csr.tagPollingActive);
+
+    EXPECT_FALSE(csr.waitForCompletionWithTimeout(true, 0, 6u));
+    EXPECT_TRUE(csr.tagPollingActive);
+
+    csr.releaseTagPolling();
+    EXPECT_FALSE(csr.waitForCompletionWithTimeout(true, 0, 6u));
+    EXPECT_FALSE(csr.tagPollingActive);
+}
+
 HWTEST_F(CommandStreamReceiverTest, whenCreatingCommandStreamReceiverThenLastAddtionalKernelExecInfoValueIsCorrect) {
     int32_t executionStamp = 0;
     std::unique_ptr<MockCsr<FamilyType>> mockCSR(new MockCsr<FamilyType>(executionStamp, *pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield()));
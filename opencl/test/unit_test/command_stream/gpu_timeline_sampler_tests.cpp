@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/gpu_timeline_sampler.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+
+#include "opencl/test/unit_test/fixtures/ult_command_stream_receiver_fixture.h"
+#include "test.h"
+
+#include "gtest/gtest.h"
+
+using namespace NEO;
+
+using GpuTimelineSamplerTest = UltCommandStreamReceiverTest;
+
+template <typename FamilyType>
+size_t countTimestampPipeControls(LinearStream &stream, uint64_t timestampAddress) {
+    using PIPE_CONTROL = typename FamilyType::PIPE_CONTROL;
+    HardwareParse hwParser;
+    hwParser.parseCommands<FamilyType>(stream, 0);
+    size_t count = 0u;
+    for (auto &cmd : hwParser.getCommandsList<PIPE_CONTROL>()) {
+        auto pipeControl = genCmdCast<PIPE_CONTROL *>(cmd);
+        if (pipeControl->getPostSyncOperation() == PIPE_CONTROL::POST_SYNC_OPERATION_WRITE_TIMESTAMP &&
+            pipeControl->getAddress() == static_cast<uint32_t>(timestampAddress & 0x0000FFFFFFFFULL) &&
+            pipeControl->getAddressHigh() == static_cast<uint32_t>(timestampAddress >> 32)) {
+            count++;
+        }
+    }
+    return count;
+}
+
+HWTEST_F(GpuTimelineSamplerTest, givenTimelineSamplingEnabledWhenTaskIsFlushedThenStartAndEndTimestampsAreProgrammedAroundTheTask) {
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    commandStreamReceiver.storeMakeResidentAllocations = true;
+    commandStreamReceiver.setGpuTimelineSamplingPeriod(*pDevice, 1u);
+    auto sampler = commandStreamReceiver.getGpuTimelineSampler();
+    ASSERT_NE(nullptr, sampler);
+
+    commandStream.getSpace(sizeof(uint32_t));
+    flushTask(commandStreamReceiver);
+
+    EXPECT_EQ(1u, countTimestampPipeControls<FamilyType>(commandStreamReceiver.commandStream, sampler->getStartTimestampGpuAddress()));
+    EXPECT_EQ(1u, countTimestampPipeControls<FamilyType>(commandStream, sampler->getEndTimestampGpuAddress()));
+    EXPECT_TRUE(commandStreamReceiver.isMadeResident(sampler->getTimestampsAllocation()));
+}
+
+HWTEST_F(GpuTimelineSamplerTest, givenTimelineSamplingEnabledWhenTaskStreamIsEmptyThenSubmissionIsNotSampled) {
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    commandStreamReceiver.setGpuTimelineSamplingPeriod(*pDevice, 1u);
+
+    flushTask(commandStreamReceiver);
+
+    GpuTimelineSampler::Sample sample;
+    *commandStreamReceiver.getTagAddress() = commandStreamReceiver.peekTaskCount();
+    EXPECT_EQ(0u, commandStreamReceiver.getGpuTimelineSampler()->readSamples(&sample, 1u));
+}
+
+HWTEST_F(GpuTimelineSamplerTest, givenSamplingPeriodWhenSubmissionsAreStartedThenOneInPeriodIsSampled) {
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    commandStreamReceiver.setGpuTimelineSamplingPeriod(*pDevice, 2u);
+    auto sampler = commandStreamReceiver.getGpuTimelineSampler();
+
+    EXPECT_TRUE(sampler->startSample(1u));
+    EXPECT_FALSE(sampler->startSample(2u));
+    EXPECT_TRUE(sampler->startSample(3u));
+    EXPECT_FALSE(sampler->startSample(4u));
+
+    commandStreamReceiver.setGpuTimelineSamplingPeriod(*pDevice, 0u);
+    EXPECT_FALSE(sampler->startSample(5u));
+}
+
+HWTEST_F(GpuTimelineSamplerTest, givenSampledSubmissionsWhenReadingSamplesThenOnlyCompletedOnesAreReturnedWithConvertedTimestamps) {
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    commandStreamReceiver.setGpuTimelineSamplingPeriod(*pDevice, 1u);
+    auto sampler = commandStreamReceiver.getGpuTimelineSampler();
+
+    auto gpuTimestamps = static_cast<uint64_t *>(sampler->getTimestampsAllocation()->getUnderlyingBuffer());
+    EXPECT_TRUE(sampler->startSample(1u));
+    gpuTimestamps[0] = 100u;
+    gpuTimestamps[1] = 300u;
+    EXPECT_TRUE(sampler->startSample(2u));
+
+    *commandStreamReceiver.getTagAddress() = 1u;
+    GpuTimelineSampler::Sample samples[2];
+    ASSERT_EQ(1u, sampler->readSamples(samples, 2u));
+    EXPECT_EQ(1u, samples[0].taskCount);
+    auto expectedDurationNs = static_cast<uint64_t>(200u * pDevice->getDeviceInfo().profilingTimerResolution);
+    EXPECT_NEAR(static_cast<double>(expectedDurationNs), static_cast<double>(samples[0].gpuEndTimeNs - samples[0].gpuStartTimeNs), 2.0);
+
+    *commandStreamReceiver.getTagAddress() = 2u;
+    EXPECT_EQ(2u, sampler->readSamples(samples, 2u));
+    EXPECT_EQ(2u, samples[1].taskCount);
+}
+
+HWTEST_F(GpuTimelineSamplerTest, givenRingFullOfPendingSamplesWhenSubmissionIsStartedThenItIsNotSampledUntilOldestCompletes) {
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    commandStreamReceiver.setGpuTimelineSamplingPeriod(*pDevice, 1u);
+    auto sampler = commandStreamReceiver.getGpuTimelineSampler();
+
+    *commandStreamReceiver.getTagAddress() = 0u;
+    for (uint32_t taskCount = 1u; taskCount <= GpuTimelineSampler::ringSize; taskCount++) {
+        EXPECT_TRUE(sampler->startSample(taskCount));
+    }
+    EXPECT_FALSE(sampler->startSample(GpuTimelineSampler::ringSize + 1));
+
+    *commandStreamReceiver.getTagAddress() = 1u;
+    EXPECT_TRUE(sampler->startSample(GpuTimelineSampler::ringSize + 2));
+}
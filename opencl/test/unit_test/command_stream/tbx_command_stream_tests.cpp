@@ -39,6 +39,8 @@
 #include "opencl/test/unit_test/mocks/mock_os_context.h"
 #include "opencl/test/unit_test/mocks/mock_platform.h"
 #include "opencl/test/unit_test/mocks/mock_tbx_csr.h"
+#include "opencl/test/unit_test/mocks/mock_tbx_sockets.h"
+#include "opencl/test/unit_test/mocks/mock_tbx_stream.h"
 #include "test.h"
 
 #include "tbx_command_stream_fixture.h"
@@ -216,6 +218,42 @@ HWTEST_F(TbxCommandStreamTests, givenTbxCommandStreamReceiverWhenWriteMemoryIsCa
     EXPECT_FALSE(tbxCsr->writeMemory(graphicsAllocation));
 }
 
+HWTEST_F(TbxCommandStreamTests, givenTbxSkipUnchangedPagesSetWhenUnchangedMemoryIsWrittenAgainThenPagesAreNotSentToServer) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.TbxSkipUnchangedPages.set(1);
+
+    MockTbxCsr<FamilyType> tbxCsr(*pDevice->executionEnvironment, pDevice->getDeviceBitfield());
+    auto mockTbxSockets = new MockTbxSockets();
+    static_cast<MockTbxStream &>(tbxCsr.tbxStream).socket = mockTbxSockets;
+
+    uint8_t memory[MemoryConstants::pageSize] = {};
+    uint64_t gpuAddress = 0x100000;
+    tbxCsr.writeMemory(gpuAddress, memory, sizeof(memory), MemoryBanks::MainBank, 0u);
+    auto writesOfFirstCall = mockTbxSockets->writeMemoryCalledCnt;
+    EXPECT_NE(0u, writesOfFirstCall);
+    EXPECT_NE(0u, tbxCsr.writtenPages.size());
+
+    tbxCsr.writeMemory(gpuAddress, memory, sizeof(memory), MemoryBanks::MainBank, 0u);
+    EXPECT_EQ(writesOfFirstCall, mockTbxSockets->writeMemoryCalledCnt);
+
+    memory[0] = 1u;
+    tbxCsr.writeMemory(gpuAddress, memory, sizeof(memory), MemoryBanks::MainBank, 0u);
+    EXPECT_EQ(2 * writesOfFirstCall, mockTbxSockets->writeMemoryCalledCnt);
+}
+
+HWTEST_F(TbxCommandStreamTests, givenTbxSkipUnchangedPagesNotSetWhenUnchangedMemoryIsWrittenAgainThenPagesAreSentToServer) {
+    MockTbxCsr<FamilyType> tbxCsr(*pDevice->executionEnvironment, pDevice->getDeviceBitfield());
+    auto mockTbxSockets = new MockTbxSockets();
+    static_cast<MockTbxStream &>(tbxCsr.tbxStream).socket = mockTbxSockets;
+
+    uint8_t memory[MemoryConstants::pageSize] = {};
+    tbxCsr.writeMemory(0x100000, memory, sizeof(memory), MemoryBanks::MainBank, 0u);
+    auto writesOfFirstCall = mockTbxSockets->writeMemoryCalledCnt;
+    tbxCsr.writeMemory(0x100000, memory, sizeof(memory), MemoryBanks::MainBank, 0u);
+    EXPECT_EQ(2 * writesOfFirstCall, mockTbxSockets->writeMemoryCalledCnt);
+    EXPECT_EQ(0u, tbxCsr.writtenPages.size());
+}
+
 HWTEST_F(TbxCommandStreamTests, givenTbxCommandStreamReceiverWhenProcessResidencyIsCalledWithoutAllocationsForResidencyThenItShouldProcessAllocationsFromMemoryManager) {
     TbxCommandStreamReceiverHw<FamilyType> *tbxCsr = (TbxCommandStreamReceiverHw<FamilyType> *)pCommandStreamReceiver;
     MemoryManager *memoryManager = tbxCsr->getMemoryManager();
@@ -13,6 +13,7 @@
 #include "opencl/source/command_queue/command_queue.h"
 #include "opencl/source/context/context.inl"
 #include "opencl/source/device_queue/device_queue.h"
+#include "opencl/source/mem_obj/buffer.h"
 #include "opencl/source/sharings/sharing.h"
 #include "opencl/test/unit_test/fixtures/platform_fixture.h"
 #include "opencl/test/unit_test/mocks/mock_cl_device.h"
@@ -500,3 +501,35 @@ TEST(Context, WhenSettingContextDestructorCallbackThenCallOrderIsPreserved) {
     EXPECT_EQ(2u, callbacksReturnValues[1]);
     EXPECT_EQ(1u, callbacksReturnValues[2]);
 }
+
+TEST(Context, givenBufferAllocationRecyclingEnabledWhenBufferIsReleasedThenItsAllocationIsReusedByBufferWithSameSizeAndFlags) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableBufferAllocationRecycling.set(1);
+    MockContext context;
+    cl_int retVal = CL_SUCCESS;
+
+    auto buffer = Buffer::create(&context, CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, retVal);
+    ASSERT_NE(nullptr, buffer);
+    auto rootDeviceIndex = context.getDevice(0)->getRootDeviceIndex();
+    auto allocation = buffer->getGraphicsAllocation(rootDeviceIndex);
+    buffer->release();
+
+    std::unique_ptr<Buffer> otherSizeBuffer(Buffer::create(&context, CL_MEM_READ_WRITE, 2 * MemoryConstants::pageSize, nullptr, retVal));
+    ASSERT_NE(nullptr, otherSizeBuffer);
+    EXPECT_NE(allocation, otherSizeBuffer->getGraphicsAllocation(rootDeviceIndex));
+
+    std::unique_ptr<Buffer> sameSizeBuffer(Buffer::create(&context, CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, retVal));
+    ASSERT_NE(nullptr, sameSizeBuffer);
+    EXPECT_EQ(allocation, sameSizeBuffer->getGraphicsAllocation(rootDeviceIndex));
+}
+
+TEST(Context, givenBufferAllocationRecyclingDisabledWhenBufferIsReleasedThenAllocationIsNotRecycled) {
+    MockContext context;
+    cl_int retVal = CL_SUCCESS;
+    auto buffer = Buffer::create(&context, CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, retVal);
+    ASSERT_NE(nullptr, buffer);
+    auto allocation = buffer->getGraphicsAllocation(context.getDevice(0)->getRootDeviceIndex());
+
+    EXPECT_FALSE(context.recycleBufferAllocation(allocation, MemoryConstants::pageSize, {}));
+    buffer->release();
+}
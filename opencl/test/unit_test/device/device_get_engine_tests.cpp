@@ -5,8 +5,11 @@
  *
  */
 
+#include "shared/source/helpers/engine_node_helper.h"
 #include "shared/source/helpers/options.h"
+#include "shared/source/os_interface/os_context.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/helpers/default_hw_info.h"
 #include "shared/test/common/helpers/ult_hw_config.h"
 #include "shared/test/common/helpers/variable_backup.h"
 #include "shared/test/common/mocks/mock_device.h"
@@ -28,3 +31,76 @@ TEST(DeviceGenEngineTest, givenNonHwCsrModeWhenGetEngineThenDefaultEngineIsRetur
     auto &defaultEngine = device->getDefaultEngine();
     EXPECT_EQ(defaultEngine.commandStreamReceiver, internalEngine.commandStreamReceiver);
 }
+
+TEST(DeviceGenEngineTest, whenDeviceIsCreatedThenOnlyDefaultEngineContextIsInitializedUntilEngineIsRequested) {
+    auto device = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
+
+    EXPECT_TRUE(device->getDefaultEngine().osContext->isContextInitialized());
+    for (auto &engine : device->getEngines()) {
+        EXPECT_EQ(engine.osContext == device->getDefaultEngine().osContext, engine.osContext->isContextInitialized());
+    }
+
+    auto defaultEngineType = getChosenEngineType(device->getHardwareInfo());
+    auto &internalEngine = device->getEngine(defaultEngineType, EngineUsage::Internal);
+    EXPECT_TRUE(internalEngine.osContext->isContextInitialized());
+}
+
+TEST(DeviceGenEngineTest, givenDeferOsContextInitializationDisabledWhenDeviceIsCreatedThenAllEngineContextsAreInitialized) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.DeferOsContextInitialization.set(0);
+
+    auto device = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
+
+    for (auto &engine : device->getEngines()) {
+        EXPECT_TRUE(engine.osContext->isContextInitialized());
+    }
+}
+
+TEST(DeviceGenEngineTest, givenMidThreadPreemptionWhenDeferredEngineIsRequestedThenPreemptionAllocationIsCreated) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.ForcePreemptionMode.set(static_cast<int32_t>(PreemptionMode::MidThread));
+
+    auto device = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
+    for (auto &engine : device->getEngines()) {
+        EXPECT_EQ(engine.osContext->isContextInitialized(), engine.commandStreamReceiver->getPreemptionAllocation() != nullptr);
+    }
+
+    auto defaultEngineType = getChosenEngineType(device->getHardwareInfo());
+    auto &internalEngine = device->getEngine(defaultEngineType, EngineUsage::Internal);
+    EXPECT_NE(nullptr, internalEngine.commandStreamReceiver->getPreemptionAllocation());
+}
+
+TEST(DeviceGenEngineTest, givenContextCreatedByFallbackPathWhenEngineIsRequestedThenEngineInitializationIsCompleted) {
+    auto device = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
+
+    auto defaultEngineType = getChosenEngineType(device->getHardwareInfo());
+    EngineControl *internalEngine = nullptr;
+    for (auto &engine : device->getEngines()) {
+        if (engine.osContext->getEngineType() == defaultEngineType && engine.osContext->isInternalEngine()) {
+            internalEngine = &engine;
+        }
+    }
+    ASSERT_NE(nullptr, internalEngine);
+    EXPECT_TRUE(internalEngine->osContext->isEngineInitializationPending());
+
+    internalEngine->osContext->ensureContextInitialized();
+    EXPECT_TRUE(internalEngine->osContext->isEngineInitializationPending());
+
+    EXPECT_EQ(internalEngine, device->tryGetEngine(defaultEngineType, EngineUsage::Internal));
+    EXPECT_FALSE(internalEngine->osContext->isEngineInitializationPending());
+}
+
+TEST(DeviceGenEngineTest, givenDirectSubmissionInitializationFailingWhenEngineIsRequestedThenNoEngineIsReturned) {
+    auto device = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
+
+    VariableBackup<UltHwConfig> backup(&ultHwConfig);
+    ultHwConfig.csrFailInitDirectSubmission = true;
+
+    auto defaultEngineType = getChosenEngineType(device->getHardwareInfo());
+    EXPECT_EQ(nullptr, device->tryGetEngine(defaultEngineType, EngineUsage::Internal));
+
+    ultHwConfig.csrFailInitDirectSubmission = false;
+    auto engine = device->tryGetEngine(defaultEngineType, EngineUsage::Internal);
+    ASSERT_NE(nullptr, engine);
+    EXPECT_FALSE(engine->osContext->isEngineInitializationPending());
+}
@@ -419,6 +419,17 @@ TEST(DeviceCreation, givenRootDeviceWithSubDevicesWhenCheckingEngineGroupsThenIt
 
 using DeviceHwTest = ::testing::Test;
 
+HWTEST_F(DeviceHwTest, givenInitializedEngineWhenPreparingForFastTeardownThenBatchedSubmissionsAreFlushedOnlyForInitializedEngines) {
+    auto device = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
+    device->prepareForFastTeardown();
+
+    for (auto &engine : device->getEngines()) {
+        auto csr = static_cast<UltCommandStreamReceiver<FamilyType> *>(engine.commandStreamReceiver);
+        EXPECT_EQ(engine.osContext->isContextInitialized(), csr->flushBatchedSubmissionsCalled);
+        EXPECT_FALSE(csr->isDirectSubmissionEnabled());
+    }
+}
+
 HWTEST_F(DeviceHwTest, givenHwHelperInputWhenInitializingCsrThenCreatePageTableManagerIfNeeded) {
     HardwareInfo localHwInfo = *defaultHwInfo;
     localHwInfo.capabilityTable.ftrRenderCompressedBuffers = false;
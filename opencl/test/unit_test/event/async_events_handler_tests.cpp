@@ -19,6 +19,9 @@
 
 #include "gmock/gmock.h"
 
+#include <chrono>
+#include <thread>
+
 using namespace NEO;
 using namespace ::testing;
 
@@ -368,3 +371,40 @@ TEST_F(AsyncEventsHandlerTests, WhenReturningThenAsyncProcessWillCallProcessList
 
     event->release();
 }
+
+TEST_F(AsyncEventsHandlerTests, givenNotSubmittedEventWithCallbackWhenProcessedThenItIsNotSleepCandidate) {
+    event1->addCallback(&this->callbackFcn, CL_COMPLETE, &counter);
+    handler->registerEvent(event1.get());
+
+    EXPECT_EQ(nullptr, handler->process());
+    EXPECT_FALSE(handler->peekIsListEmpty());
+
+    event1->setStatus(CL_COMPLETE);
+}
+
+TEST_F(AsyncEventsHandlerTests, givenAsyncMtxHeldWhenWakeUpIsCalledThenWakeUpIsRequestedWithoutLockingAsyncMtx) {
+    std::unique_lock<std::mutex> lock(handler->asyncMtx);
+    handler->wakeUp();
+    EXPECT_TRUE(handler->wakeUpRequested);
+}
+
+TEST_F(AsyncEventsHandlerTests, givenNotSubmittedEventWithCallbackWhenThreadProcessesItThenThreadSleepsUntilWakeUp) {
+    handler->allowThreadCreating = true;
+    event1->addCallback(&this->callbackFcn, CL_COMPLETE, &counter);
+    handler->registerEvent(event1.get());
+
+    while (handler->transferCounter == 0) {
+        std::this_thread::yield();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    int transfersWhileIdle = handler->transferCounter;
+    EXPECT_GT(5, transfersWhileIdle);
+
+    handler->wakeUp();
+    while (handler->transferCounter == transfersWhileIdle) {
+        std::this_thread::yield();
+    }
+
+    event1->setStatus(CL_COMPLETE);
+    handler->closeThread();
+}
@@ -163,6 +163,39 @@ TEST(Event, givenCommandQueueWhenEventIsCreatedWithoutCommandQueueThenCommandQue
     EXPECT_EQ(intitialRefCount, finalRefCount);
 }
 
+TEST(Event, givenRecyclableEventWhenItIsReleasedThenItsMemoryIsReusedByNextEventOfTheContext) {
+    auto mockDevice = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    MockContext ctx;
+    MockCommandQueue cmdQ(&ctx, mockDevice.get(), 0);
+    auto initialContextRefCount = ctx.getRefInternalCount();
+
+    auto event = Event::createRecyclable(&cmdQ, CL_COMMAND_NDRANGE_KERNEL, 4, 10);
+    EXPECT_EQ(initialContextRefCount + 1, ctx.getRefInternalCount());
+    void *eventMemory = event;
+    event->release();
+    EXPECT_EQ(initialContextRefCount, ctx.getRefInternalCount());
+
+    event = Event::createRecyclable(&cmdQ, CL_COMMAND_MARKER, 5, 11);
+    EXPECT_EQ(eventMemory, event);
+    EXPECT_EQ(static_cast<cl_command_type>(CL_COMMAND_MARKER), event->getCommandType());
+    EXPECT_EQ(5u, event->taskLevel.load());
+    EXPECT_EQ(11u, event->peekTaskCount());
+    event->release();
+}
+
+TEST(Event, givenEventRecyclingDisabledWhenRecyclableEventIsReleasedThenItIsDeleted) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableEventRecycling.set(0);
+
+    auto mockDevice = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    MockContext ctx;
+    MockCommandQueue cmdQ(&ctx, mockDevice.get(), 0);
+
+    auto event = Event::createRecyclable(&cmdQ, CL_COMMAND_NDRANGE_KERNEL, 4, 10);
+    EXPECT_EQ(nullptr, event->getCustomDeleter());
+    event->release();
+}
+
 TEST(Event, WhenWaitingForEventsThenAllQueuesAreFlushed) {
     class MockCommandQueueWithFlushCheck : public MockCommandQueue {
       public:
@@ -220,6 +253,40 @@ TEST(Event, GivenNotReadyEventWhenWaitingForEventsThenQueueIsNotFlushed) {
     EXPECT_EQ(0u, cmdQ1->flushCounter);
 }
 
+TEST(Event, givenKmdNotifyDelayElapsedWhenWaitingForAnyEventThenWaitBlocksOnEventWithKnownTaskCount) {
+    class MockCommandQueueWithWaitCheck : public MockCommandQueue {
+      public:
+        MockCommandQueueWithWaitCheck(Context &context, ClDevice *device) : MockCommandQueue(&context, device, nullptr) {
+        }
+        void waitUntilComplete(uint32_t gpgpuTaskCountToWait, uint32_t bcsTaskCountToWait, FlushStamp flushStampToWait, bool useQuickKmdSleep) override {
+            waitedTaskCounts.push_back(gpgpuTaskCountToWait);
+            *getGpgpuCommandStreamReceiver().getTagAddress() = gpgpuTaskCountToWait;
+        }
+        std::vector<uint32_t> waitedTaskCounts;
+    };
+
+    auto hwInfo = *defaultHwInfo;
+    hwInfo.capabilityTable.kmdNotifyProperties.enableKmdNotify = true;
+    hwInfo.capabilityTable.kmdNotifyProperties.delayKmdNotifyMicroseconds = 0;
+    auto device = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(&hwInfo));
+    MockContext context(device.get());
+
+    MockCommandQueueWithWaitCheck cmdQ(context, device.get());
+    *cmdQ.getGpgpuCommandStreamReceiver().getTagAddress() = 0u;
+    auto userEvent = new UserEvent(&context);
+    Event event(&cmdQ, CL_COMMAND_NDRANGE_KERNEL, 0, 5);
+    cl_event eventWaitlist[] = {userEvent, &event};
+
+    cl_uint signaledIndex = 0u;
+    EXPECT_EQ(CL_SUCCESS, Event::waitForAnyEvent(2, eventWaitlist, &signaledIndex));
+    EXPECT_EQ(1u, signaledIndex);
+    ASSERT_EQ(1u, cmdQ.waitedTaskCounts.size());
+    EXPECT_EQ(5u, cmdQ.waitedTaskCounts[0]);
+
+    userEvent->setStatus(CL_COMPLETE);
+    userEvent->release();
+}
+
 TEST(Event, givenNotReadyEventOnWaitlistWhenCheckingUserEventDependeciesThenTrueIsReturned) {
     auto event1 = std::make_unique<Event>(nullptr, CL_COMMAND_NDRANGE_KERNEL, CompletionStamp::notReady, 0);
     cl_event eventWaitlist[] = {event1.get()};
@@ -1557,6 +1624,28 @@ TEST(EventsDebug, givenEventWhenTrackingOfParentsIsOnThenTrackParents) {
     EXPECT_EQ(1u, parentEvents2.size());
     EXPECT_EQ(&event, parentEvents2.at(0));
     event.setStatus(CL_COMPLETE);
+    EXPECT_EQ(0u, parentEvents2.size());
+}
+
+TEST_F(EventTest, givenTrackedChainOfBlockedEventsWhenLastEventIsQueriedThenUnblockedAncestorIsUpdatedAndChainIsUnblocked) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.TrackParentEvents.set(true);
+    Event headEvent(pCmdQ, CL_COMMAND_NDRANGE_KERNEL, 0, 0);
+    Event middleEvent(pCmdQ, CL_COMMAND_NDRANGE_KERNEL, CompletionStamp::notReady, CompletionStamp::notReady);
+    Event lastEvent(pCmdQ, CL_COMMAND_NDRANGE_KERNEL, CompletionStamp::notReady, CompletionStamp::notReady);
+
+    headEvent.addChild(middleEvent);
+    middleEvent.addChild(lastEvent);
+    EXPECT_TRUE(middleEvent.peekIsBlocked());
+    EXPECT_TRUE(lastEvent.peekIsBlocked());
+
+    lastEvent.updateExecutionStatus();
+
+    EXPECT_FALSE(middleEvent.peekIsBlocked());
+    EXPECT_FALSE(lastEvent.peekIsBlocked());
+    EXPECT_EQ(0u, middleEvent.getParentEvents().size());
+    EXPECT_EQ(0u, lastEvent.getParentEvents().size());
+    EXPECT_GE(CL_SUBMITTED, lastEvent.peekExecutionStatus());
 }
 
 TEST(EventsDebug, givenEventWhenTrackingOfParentsIsOffThenDoNotTrackParents) {
@@ -13,6 +13,7 @@
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
 #include "shared/source/helpers/hw_helper.h"
+#include "shared/source/memory_manager/deferred_deleter.h"
 #include "shared/source/memory_manager/os_agnostic_memory_manager.h"
 #include "shared/source/os_interface/device_factory.h"
 #include "shared/source/os_interface/os_interface.h"
@@ -269,7 +270,47 @@ TEST(ClExecutionEnvironment, WhenExecutionEnvironmentIsDeletedThenAsyncEventHand
     EXPECT_TRUE(MockAsyncEventHandlerGlobals::destructorCalled);
 }
 
+TEST(ClExecutionEnvironment, givenWorkerThreadsWhenPreparingForFastTeardownThenTheirOwnersAreDestroyed) {
+    auto executionEnvironment = std::make_unique<MockClExecutionEnvironment>();
+    executionEnvironment->prepareRootDeviceEnvironments(1);
+    executionEnvironment->rootDeviceEnvironments[0]->setHwInfo(defaultHwInfo.get());
+    auto memoryManager = new MockMemoryManager(*executionEnvironment);
+    executionEnvironment->memoryManager.reset(memoryManager);
+    memoryManager->setDeferredDeleter(new DeferredDeleter());
+    MockHandler *mockAsyncHandler = new MockHandler();
+    executionEnvironment->asyncEventsHandler.reset(mockAsyncHandler);
+    mockAsyncHandler->openThread();
+
+    executionEnvironment->prepareForFastTeardown();
+    EXPECT_TRUE(MockAsyncEventHandlerGlobals::destructorCalled);
+    EXPECT_EQ(nullptr, executionEnvironment->getAsyncEventsHandler());
+    EXPECT_EQ(nullptr, memoryManager->getDeferredDeleter());
+    EXPECT_EQ(nullptr, executionEnvironment->rootDeviceEnvironments[0]->compilerInterface.get());
+}
+
 TEST(ClExecutionEnvironment, WhenExecutionEnvironmentIsCreatedThenAsyncEventHandlerIsCreated) {
     auto executionEnvironment = std::make_unique<ClExecutionEnvironment>();
     EXPECT_NE(nullptr, executionEnvironment->getAsyncEventsHandler());
 }
+
+TEST(ExecutionEnvironment, givenFastProcessTeardownFlagWhenCheckingIfFastTeardownIsEnabledThenItIsEnabledOnlyForHwCsr) {
+    DebugManagerStateRestore restorer;
+    EXPECT_FALSE(ExecutionEnvironment::isFastProcessTeardownEnabled());
+
+    DebugManager.flags.FastProcessTeardown.set(true);
+    EXPECT_TRUE(ExecutionEnvironment::isFastProcessTeardownEnabled());
+
+    DebugManager.flags.SetCommandStreamReceiver.set(CommandStreamReceiverType::CSR_AUB);
+    EXPECT_FALSE(ExecutionEnvironment::isFastProcessTeardownEnabled());
+}
+
+TEST(ExecutionEnvironment, givenZeAffinityMaskWhenCheckingRootDeviceSelectionThenOnlyRootDevicesListedInMaskAreSelected) {
+    DebugManagerStateRestore restorer;
+    EXPECT_TRUE(ExecutionEnvironment::isRootDeviceSelectedByAffinityMask(3u));
+
+    DebugManager.flags.ZE_AFFINITY_MASK.set("0.1,2,0.3");
+    EXPECT_TRUE(ExecutionEnvironment::isRootDeviceSelectedByAffinityMask(0u));
+    EXPECT_FALSE(ExecutionEnvironment::isRootDeviceSelectedByAffinityMask(1u));
+    EXPECT_TRUE(ExecutionEnvironment::isRootDeviceSelectedByAffinityMask(2u));
+    EXPECT_FALSE(ExecutionEnvironment::isRootDeviceSelectedByAffinityMask(3u));
+}
@@ -135,6 +135,25 @@ GEN12LPTEST_F(HwHelperTestGen12Lp, givenFtrCcsNodeNotSetAndBcsInfoSetWhenGetGpgp
     EXPECT_EQ(aub_stream::ENGINE_BCS, engines[3].first);
 }
 
+GEN12LPTEST_F(HwHelperTestGen12Lp, givenBcsInfoSetAndCopyEngineForPageFaultTransfersEnabledWhenCreatingDeviceThenInternalCopyEngineIsCreated) {
+    DebugManagerStateRestore restorer;
+    HardwareInfo hwInfo = *defaultHwInfo;
+    hwInfo.featureTable.ftrCCSNode = false;
+    hwInfo.featureTable.ftrBcsInfo = 1;
+    hwInfo.capabilityTable.defaultEngineType = aub_stream::ENGINE_RCS;
+
+    auto device = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(&hwInfo, 0));
+    EXPECT_EQ(nullptr, device->getInternalCopyEngine());
+
+    DebugManager.flags.EnableCopyEngineForPageFaultTransfers.set(1);
+    device.reset(MockDevice::createWithNewExecutionEnvironment<MockDevice>(&hwInfo, 0));
+    auto internalCopyEngine = device->getInternalCopyEngine();
+    ASSERT_NE(nullptr, internalCopyEngine);
+    EXPECT_EQ(aub_stream::ENGINE_BCS, internalCopyEngine->getEngineType());
+    EXPECT_TRUE(internalCopyEngine->osContext->isInternalEngine());
+    EXPECT_NE(internalCopyEngine->commandStreamReceiver, device->getEngine(aub_stream::ENGINE_BCS, EngineUsage::Regular).commandStreamReceiver);
+}
+
 GEN12LPTEST_F(HwHelperTestGen12Lp, givenFtrCcsNodeNotSetWhenGetGpgpuEnginesThenReturnThreeRcsEngines) {
     HardwareInfo hwInfo = *defaultHwInfo;
     hwInfo.featureTable.ftrCCSNode = false;
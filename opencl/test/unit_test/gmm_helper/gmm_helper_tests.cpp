@@ -21,6 +21,7 @@
 #include "opencl/test/unit_test/fixtures/mock_execution_environment_gmm_fixture.h"
 #include "opencl/test/unit_test/mocks/mock_context.h"
 #include "opencl/test/unit_test/mocks/mock_gmm.h"
+#include "opencl/test/unit_test/mocks/mock_gmm_client_context.h"
 #include "opencl/test/unit_test/mocks/mock_memory_manager.h"
 #include "test.h"
 
@@ -144,6 +145,88 @@ TEST_F(GmmTests, givenGmmCreatedFromExistingGmmThenHelperDoesNotReleaseParentGmm
     delete gmmRes2;
 }
 
+TEST(GmmResourceInfoCacheTests, givenIdenticalCreateParamsWhenResInfoObjectIsCreatedAgainThenCachedLayoutIsCopied) {
+    HardwareInfo hwInfo = *defaultHwInfo;
+    MockGmmClientContext clientContext(nullptr, &hwInfo);
+
+    GMM_RESCREATE_PARAMS createParams = {};
+    createParams.Type = RESOURCE_2D;
+    createParams.Format = GMM_FORMAT_R8G8B8A8_UNORM;
+    createParams.BaseWidth64 = 64;
+    createParams.BaseHeight = 64;
+    createParams.Depth = 1;
+
+    auto firstResInfo = clientContext.createResInfoObjectWithCache(&createParams);
+    auto secondResInfo = clientContext.createResInfoObjectWithCache(&createParams);
+    EXPECT_NE(firstResInfo, secondResInfo);
+    EXPECT_EQ(1u, clientContext.createResInfoObjectCalled);
+    EXPECT_EQ(2u, clientContext.copyResInfoObjectCalled);
+
+    createParams.BaseHeight = 32;
+    auto otherResInfo = clientContext.createResInfoObjectWithCache(&createParams);
+    EXPECT_EQ(2u, clientContext.createResInfoObjectCalled);
+
+    clientContext.destroyResInfoObject(firstResInfo);
+    clientContext.destroyResInfoObject(secondResInfo);
+    clientContext.destroyResInfoObject(otherResInfo);
+    clientContext.clearResInfoCache();
+}
+
+TEST(GmmResourceInfoCacheTests, givenCreateParamsDifferingOnlyInUnkeyedBytesWhenResInfoObjectIsCreatedThenCachedLayoutIsCopied) {
+    HardwareInfo hwInfo = *defaultHwInfo;
+    MockGmmClientContext clientContext(nullptr, &hwInfo);
+
+    GMM_RESCREATE_PARAMS createParams[2];
+    memset(&createParams[0], 0x00, sizeof(GMM_RESCREATE_PARAMS));
+    memset(&createParams[1], 0xff, sizeof(GMM_RESCREATE_PARAMS));
+    for (auto &params : createParams) {
+        params.Type = RESOURCE_2D;
+        params.Format = GMM_FORMAT_R8G8B8A8_UNORM;
+        params.Flags = {};
+        params.MSAA = {};
+        params.BaseWidth64 = 64;
+        params.BaseHeight = 64;
+        params.Depth = 1;
+        params.MaxLod = 0;
+        params.ArraySize = 0;
+        params.BaseAlignment = 0;
+        params.OverridePitch = 0;
+        params.Usage = GMM_RESOURCE_USAGE_OCL_IMAGE;
+        params.CpTag = 0;
+        params.NoGfxMemory = 0;
+    }
+
+    auto firstResInfo = clientContext.createResInfoObjectWithCache(&createParams[0]);
+    auto secondResInfo = clientContext.createResInfoObjectWithCache(&createParams[1]);
+    EXPECT_EQ(1u, clientContext.createResInfoObjectCalled);
+    EXPECT_EQ(2u, clientContext.copyResInfoObjectCalled);
+
+    clientContext.destroyResInfoObject(firstResInfo);
+    clientContext.destroyResInfoObject(secondResInfo);
+    clientContext.clearResInfoCache();
+}
+
+TEST(GmmResourceInfoCacheTests, givenExistingSysMemOrDisabledCacheWhenResInfoObjectIsCreatedAgainThenLayoutIsComputedAgain) {
+    DebugManagerStateRestore restorer;
+    HardwareInfo hwInfo = *defaultHwInfo;
+    MockGmmClientContext clientContext(nullptr, &hwInfo);
+
+    GMM_RESCREATE_PARAMS createParams = {};
+    createParams.Type = RESOURCE_BUFFER;
+    createParams.BaseWidth64 = MemoryConstants::pageSize;
+    createParams.Flags.Info.ExistingSysMem = 1;
+
+    for (auto enableCache : {-1, 0}) {
+        DebugManager.flags.EnableGmmResourceInfoCache.set(enableCache);
+        createParams.Flags.Info.ExistingSysMem = (enableCache == -1);
+        auto startCount = clientContext.createResInfoObjectCalled;
+        clientContext.destroyResInfoObject(clientContext.createResInfoObjectWithCache(&createParams));
+        clientContext.destroyResInfoObject(clientContext.createResInfoObjectWithCache(&createParams));
+        EXPECT_EQ(startCount + 2, clientContext.createResInfoObjectCalled);
+    }
+    EXPECT_EQ(0u, clientContext.copyResInfoObjectCalled);
+}
+
 TEST_F(GmmTests, GivenInvalidImageSizeWhenQueryingImgParamsThenImageInfoReturnsSizeZero) {
     cl_image_desc imgDesc = {CL_MEM_OBJECT_IMAGE2D};
 
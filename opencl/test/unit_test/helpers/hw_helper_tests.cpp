@@ -68,6 +68,16 @@ TEST(HwHelperSimpleTest, givenDebugVariableWhenAskingForRenderCompressionThenRet
     EXPECT_FALSE(HwHelper::renderCompressedImagesSupported(localHwInfo));
 }
 
+TEST(HwHelperSimpleTest, givenThreadGroupCountWhenAskingForSliceCountThenSingleSliceIsReturnedOnlyWhenGroupsFitOnOneSlice) {
+    HardwareInfo localHwInfo = *defaultHwInfo;
+    localHwInfo.gtSystemInfo.SliceCount = 2;
+    localHwInfo.gtSystemInfo.SubSliceCount = 8;
+
+    EXPECT_EQ(1u, HwHelper::getSliceCountForThreadGroups(localHwInfo, 1u));
+    EXPECT_EQ(1u, HwHelper::getSliceCountForThreadGroups(localHwInfo, 4u));
+    EXPECT_EQ(2u, HwHelper::getSliceCountForThreadGroups(localHwInfo, 5u));
+}
+
 TEST_F(HwHelperTest, WhenGettingHelperThenValidHelperReturned) {
     auto &helper = HwHelper::get(renderCoreFamily);
     EXPECT_NE(nullptr, &helper);
@@ -1202,6 +1212,14 @@ TEST_F(HwHelperTest, WhenGettingIsCpuImageTransferPreferredThenFalseIsReturned)
     EXPECT_FALSE(hwHelper.isCpuImageTransferPreferred(*defaultHwInfo));
 }
 
+HWTEST_F(HwHelperTest, WhenGettingTileLayoutForCpuAccessThenOnlyYMajorTilingIsHandled) {
+    using RENDER_SURFACE_STATE = typename FamilyType::RENDER_SURFACE_STATE;
+    auto &hwHelper = HwHelper::get(renderCoreFamily);
+    EXPECT_EQ(TileLayout::TileY, hwHelper.getTileLayoutForCpuAccess(RENDER_SURFACE_STATE::TILE_MODE_YMAJOR));
+    EXPECT_EQ(TileLayout::Linear, hwHelper.getTileLayoutForCpuAccess(RENDER_SURFACE_STATE::TILE_MODE_XMAJOR));
+    EXPECT_EQ(TileLayout::Linear, hwHelper.getTileLayoutForCpuAccess(RENDER_SURFACE_STATE::TILE_MODE_LINEAR));
+}
+
 TEST_F(HwHelperTest, whenFtrGpGpuMidThreadLevelPreemptFeatureDisabledThenFalseIsReturned) {
     HwHelper &hwHelper = HwHelper::get(renderCoreFamily);
     FeatureTable featureTable = {};
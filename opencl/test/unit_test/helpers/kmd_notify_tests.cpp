@@ -419,3 +419,52 @@ TEST_F(KmdNotifyTests, givenEnabledKmdNotifyMechanismWhenPowerSavingModeIsSetAnd
     EXPECT_FALSE(timeoutEnabled);
     EXPECT_EQ(0, timeout);
 }
+
+TEST_F(KmdNotifyTests, givenObservedWaitDurationsWhenUpdatingAverageThenMovingAverageIsTracked) {
+    MockKmdNotifyHelper helper(&(hwInfo->capabilityTable.kmdNotifyProperties));
+    EXPECT_GT(0, helper.getAverageWaitDurationMicroseconds());
+
+    helper.updateAverageWaitDuration(100);
+    EXPECT_EQ(100, helper.getAverageWaitDurationMicroseconds());
+
+    helper.updateAverageWaitDuration(20);
+    EXPECT_EQ(100 + (20 - 100) / KmdNotifyConstants::averageWaitDurationWeight, helper.getAverageWaitDurationMicroseconds());
+}
+
+TEST_F(KmdNotifyTests, givenAdaptiveKmdNotifyDelayEnabledWhenObtainingTimeoutParamsThenDelayFollowsAverageWaitDuration) {
+    DebugManagerStateRestore stateRestore;
+    overrideKmdNotifyParams(true, 1000, true, 10, false, 0);
+    MockKmdNotifyHelper helper(&(hwInfo->capabilityTable.kmdNotifyProperties));
+
+    int64_t timeout = 0;
+    helper.updateAverageWaitDuration(100);
+    helper.obtainTimeoutParams(timeout, false, 1, 2, 1, false, false);
+    EXPECT_EQ(1000, timeout);
+
+    DebugManager.flags.AdaptiveKmdNotifyDelay.set(1);
+    helper.obtainTimeoutParams(timeout, false, 1, 2, 1, false, false);
+    EXPECT_EQ(200, timeout);
+
+    for (auto i = 0; i < 32; i++) {
+        helper.updateAverageWaitDuration(2);
+    }
+    auto averageWaitDuration = helper.getAverageWaitDurationMicroseconds();
+    EXPECT_GT(100, averageWaitDuration);
+    helper.obtainTimeoutParams(timeout, false, 1, 2, 1, false, false);
+    EXPECT_EQ(std::max(2 * averageWaitDuration, int64_t{10}), timeout);
+}
+
+TEST_F(KmdNotifyTests, givenAdaptiveKmdNotifyDelayEnabledAndLongWaitsWhenObtainingTimeoutParamsThenQuickSleepDelayIsUsed) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.AdaptiveKmdNotifyDelay.set(1);
+    overrideKmdNotifyParams(true, 1000, true, 10, false, 0);
+    MockKmdNotifyHelper helper(&(hwInfo->capabilityTable.kmdNotifyProperties));
+
+    int64_t timeout = 0;
+    helper.obtainTimeoutParams(timeout, false, 1, 2, 1, false, false);
+    EXPECT_EQ(1000, timeout);
+
+    helper.updateAverageWaitDuration(5000);
+    helper.obtainTimeoutParams(timeout, false, 1, 2, 1, false, false);
+    EXPECT_EQ(10, timeout);
+}
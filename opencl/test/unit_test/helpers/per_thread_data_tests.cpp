@@ -300,3 +300,47 @@ TEST(PerThreadDataTest, givenSimdEqualOneWhenSettingLocalIdsInPerThreadDataThenI
     alignedFree(buffer);
     alignedFree(reference);
 }
+
+TEST(PerThreadDataTest, givenLocalIdsCacheWhenSendingPerThreadDataForCachedShapeThenCachedLocalIdsAreCopied) {
+    uint32_t simd = 16;
+    uint32_t grfSize = 32;
+    uint32_t numChannels = 3;
+    const std::array<uint16_t, 3> localWorkSizes = {{4, 4, 2}};
+    const std::array<uint8_t, 3> workgroupWalkOrder = {{0, 1, 2}};
+
+    auto sizePerThreadDataTotal = PerThreadDataHelper::getPerThreadDataSizeTotal(simd, grfSize, numChannels, 32u);
+    std::vector<uint8_t> buffer(sizePerThreadDataTotal * 2);
+    LinearStream stream(buffer.data(), buffer.size());
+
+    LocalIdsCache localIdsCache;
+    PerThreadDataHelper::sendPerThreadData(stream, simd, grfSize, numChannels, localWorkSizes, workgroupWalkOrder, false, &localIdsCache);
+    auto offset = PerThreadDataHelper::sendPerThreadData(stream, simd, grfSize, numChannels, localWorkSizes, workgroupWalkOrder, false, &localIdsCache);
+    EXPECT_EQ(sizePerThreadDataTotal, offset);
+    EXPECT_EQ(0, memcmp(buffer.data(), buffer.data() + offset, sizePerThreadDataTotal));
+
+    LocalIdsCache::Key key = {{4, 4, 2, simd, grfSize, numChannels, 0, 1, 2, false}};
+    std::vector<uint8_t> cachedLocalIds(sizePerThreadDataTotal, 0xcd);
+    localIdsCache.storeLocalIds(key, cachedLocalIds.data(), cachedLocalIds.size());
+
+    LinearStream otherStream(buffer.data(), sizePerThreadDataTotal);
+    PerThreadDataHelper::sendPerThreadData(otherStream, simd, grfSize, numChannels, localWorkSizes, workgroupWalkOrder, false, &localIdsCache);
+    EXPECT_EQ(0, memcmp(buffer.data(), cachedLocalIds.data(), sizePerThreadDataTotal));
+}
+
+TEST(PerThreadDataTest, givenFullLocalIdsCacheWhenStoringLocalIdsThenLeastRecentlyUsedEntryIsEvicted) {
+    LocalIdsCache localIdsCache;
+    uint32_t localIds = 0;
+    for (uint32_t i = 0; i < LocalIdsCache::maxEntries; i++) {
+        localIdsCache.storeLocalIds({{i}}, &i, sizeof(i));
+    }
+    EXPECT_TRUE(localIdsCache.copyLocalIds({{0}}, &localIds, sizeof(localIds)));
+
+    uint32_t newEntry = LocalIdsCache::maxEntries;
+    localIdsCache.storeLocalIds({{newEntry}}, &newEntry, sizeof(newEntry));
+
+    EXPECT_FALSE(localIdsCache.copyLocalIds({{1}}, &localIds, sizeof(localIds)));
+    EXPECT_TRUE(localIdsCache.copyLocalIds({{0}}, &localIds, sizeof(localIds)));
+    EXPECT_EQ(0u, localIds);
+    EXPECT_TRUE(localIdsCache.copyLocalIds({{newEntry}}, &localIds, sizeof(localIds)));
+    EXPECT_EQ(newEntry, localIds);
+}
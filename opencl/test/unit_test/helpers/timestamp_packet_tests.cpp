@@ -265,6 +265,40 @@ TEST_F(TimestampPacketSimpleTests, givenTimestampPacketContainerWhenMovedThenMov
     EXPECT_EQ(1u, node1.returnCalls);
 }
 
+TEST_F(TimestampPacketSimpleTests, givenFewNodesWhenContainersAreFilledAndSwappedThenNodesAreNotStoredInDynamicMemory) {
+    struct MockTagNode : public TagNode<TimestampPacketStorage> {
+        void returnTag() override {
+            returnCalls++;
+        }
+        uint32_t returnCalls = 0;
+    };
+
+    MockTagNode node0;
+    MockTagNode node1;
+
+    {
+        TimestampPacketContainer timestampPacketContainer0;
+        TimestampPacketContainer timestampPacketContainer1;
+
+        timestampPacketContainer0.add(&node0);
+        timestampPacketContainer1.add(&node1);
+        timestampPacketContainer0.swapNodes(timestampPacketContainer1);
+
+        ASSERT_EQ(1u, timestampPacketContainer0.peekNodes().size());
+        ASSERT_EQ(1u, timestampPacketContainer1.peekNodes().size());
+        EXPECT_EQ(&node1, timestampPacketContainer0.peekNodes()[0]);
+        EXPECT_EQ(&node0, timestampPacketContainer1.peekNodes()[0]);
+        EXPECT_FALSE(timestampPacketContainer0.peekNodes().usesDynamicMem());
+        EXPECT_FALSE(timestampPacketContainer1.peekNodes().usesDynamicMem());
+
+        timestampPacketContainer0.resolveDependencies(true);
+        EXPECT_EQ(1u, node1.returnCalls);
+        EXPECT_TRUE(timestampPacketContainer0.peekNodes().empty());
+    }
+    EXPECT_EQ(1u, node0.returnCalls);
+    EXPECT_EQ(1u, node1.returnCalls);
+}
+
 TEST_F(TimestampPacketSimpleTests, whenIsCompletedIsCalledThenItReturnsProperTimestampPacketStatus) {
     TimestampPacketStorage timestampPacketStorage;
     auto &packet = timestampPacketStorage.packets[0];
@@ -667,15 +701,15 @@ HWTEST_F(TimestampPacketTests, givenTimestampPacketWriteEnabledWhenEnqueueingThe
 
     // obtain first node for cmdQ and event1
     cmdQ->enqueueKernel(kernel->mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, &event1);
-    auto node1 = cmdQ->timestampPacketContainer->peekNodes().at(0);
+    auto node1 = cmdQ->timestampPacketContainer->peekNodes()[0];
     EXPECT_NE(nullptr, node1);
-    EXPECT_EQ(node1, cmdQ->timestampPacketContainer->peekNodes().at(0));
+    EXPECT_EQ(node1, cmdQ->timestampPacketContainer->peekNodes()[0]);
 
     // obtain new node for cmdQ and event2
     cmdQ->enqueueKernel(kernel->mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, &event2);
-    auto node2 = cmdQ->timestampPacketContainer->peekNodes().at(0);
+    auto node2 = cmdQ->timestampPacketContainer->peekNodes()[0];
     EXPECT_NE(nullptr, node2);
-    EXPECT_EQ(node2, cmdQ->timestampPacketContainer->peekNodes().at(0));
+    EXPECT_EQ(node2, cmdQ->timestampPacketContainer->peekNodes()[0]);
     EXPECT_EQ(0u, mockTagAllocator->returnedToFreePoolNodes.size()); // nothing returned. event1 owns previous node
     EXPECT_EQ(1u, mockTagAllocator->releaseReferenceNodes.size());   // cmdQ released first node
     EXPECT_EQ(node1, mockTagAllocator->releaseReferenceNodes.at(0));
@@ -1289,13 +1323,13 @@ HWTEST_F(TimestampPacketTests, givenAlreadyAssignedNodeWhenEnqueueingNonBlockedT
     auto cmdQ = std::make_unique<MockCommandQueueHw<FamilyType>>(context, device.get(), nullptr);
     TimestampPacketContainer previousNodes;
     cmdQ->obtainNewTimestampPacketNodes(1, previousNodes, false, false);
-    auto firstNode = cmdQ->timestampPacketContainer->peekNodes().at(0);
+    auto firstNode = cmdQ->timestampPacketContainer->peekNodes()[0];
 
     csr.storeMakeResidentAllocations = true;
     csr.timestampPacketWriteEnabled = true;
 
     cmdQ->enqueueKernel(kernel->mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
-    auto secondNode = cmdQ->timestampPacketContainer->peekNodes().at(0);
+    auto secondNode = cmdQ->timestampPacketContainer->peekNodes()[0];
 
     EXPECT_NE(firstNode->getBaseGraphicsAllocation(), secondNode->getBaseGraphicsAllocation());
     EXPECT_TRUE(csr.isMadeResident(firstNode->getBaseGraphicsAllocation(), csr.taskCount));
@@ -1311,7 +1345,7 @@ HWTEST_F(TimestampPacketTests, givenAlreadyAssignedNodeWhenEnqueueingBlockedThen
     auto cmdQ = clUniquePtr(new MockCommandQueueHw<FamilyType>(context, device.get(), nullptr));
     TimestampPacketContainer previousNodes;
     cmdQ->obtainNewTimestampPacketNodes(1, previousNodes, false, false);
-    auto firstNode = cmdQ->timestampPacketContainer->peekNodes().at(0);
+    auto firstNode = cmdQ->timestampPacketContainer->peekNodes()[0];
 
     csr.storeMakeResidentAllocations = true;
     csr.timestampPacketWriteEnabled = true;
@@ -1319,7 +1353,7 @@ HWTEST_F(TimestampPacketTests, givenAlreadyAssignedNodeWhenEnqueueingBlockedThen
     UserEvent userEvent;
     cl_event clEvent = &userEvent;
     cmdQ->enqueueKernel(kernel->mockKernel, 1, nullptr, gws, nullptr, 1, &clEvent, nullptr);
-    auto secondNode = cmdQ->timestampPacketContainer->peekNodes().at(0);
+    auto secondNode = cmdQ->timestampPacketContainer->peekNodes()[0];
 
     EXPECT_NE(firstNode->getBaseGraphicsAllocation(), secondNode->getBaseGraphicsAllocation());
     EXPECT_FALSE(csr.isMadeResident(firstNode->getBaseGraphicsAllocation(), csr.taskCount));
@@ -1334,7 +1368,7 @@ HWTEST_F(TimestampPacketTests, givenAlreadyAssignedNodeWhenEnqueueingThenDontKee
     MockCommandQueueHw<FamilyType> cmdQ(context, device.get(), nullptr);
     TimestampPacketContainer previousNodes;
     cmdQ.obtainNewTimestampPacketNodes(1, previousNodes, false, false);
-    auto firstNode = cmdQ.timestampPacketContainer->peekNodes().at(0);
+    auto firstNode = cmdQ.timestampPacketContainer->peekNodes()[0];
     setTagToReadyState(firstNode);
 
     cmdQ.enqueueKernel(kernel->mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
@@ -1366,8 +1400,8 @@ HWTEST_F(TimestampPacketTests, givenAlreadyAssignedNodeWhenEnqueueingThenKeepDep
     MockCommandQueueHw<FamilyType> cmdQ(context, device.get(), nullptr);
     TimestampPacketContainer previousNodes;
     cmdQ.obtainNewTimestampPacketNodes(2, previousNodes, false, false);
-    firstNode.add(cmdQ.timestampPacketContainer->peekNodes().at(0));
-    firstNode.add(cmdQ.timestampPacketContainer->peekNodes().at(1));
+    firstNode.add(cmdQ.timestampPacketContainer->peekNodes()[0]);
+    firstNode.add(cmdQ.timestampPacketContainer->peekNodes()[1]);
     auto firstTag0 = firstNode.getNode(0);
     auto firstTag1 = firstNode.getNode(1);
 
@@ -1536,7 +1570,7 @@ HWTEST_F(TimestampPacketTests, givenTimestampPacketWhenEnqueueingNonBlockedThenM
     MockCommandQueueHw<FamilyType> cmdQ(context, device.get(), nullptr);
 
     cmdQ.enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
-    auto timestampPacketNode = cmdQ.timestampPacketContainer->peekNodes().at(0);
+    auto timestampPacketNode = cmdQ.timestampPacketContainer->peekNodes()[0];
 
     EXPECT_TRUE(csr.isMadeResident(timestampPacketNode->getBaseGraphicsAllocation(), csr.taskCount));
 }
@@ -1555,7 +1589,7 @@ HWTEST_F(TimestampPacketTests, givenTimestampPacketWhenEnqueueingBlockedThenMake
     cl_event clEvent = &userEvent;
 
     cmdQ->enqueueKernel(mockKernel.mockKernel, 1, nullptr, gws, nullptr, 1, &clEvent, nullptr);
-    auto timestampPacketNode = cmdQ->timestampPacketContainer->peekNodes().at(0);
+    auto timestampPacketNode = cmdQ->timestampPacketContainer->peekNodes()[0];
 
     EXPECT_FALSE(csr.isMadeResident(timestampPacketNode->getBaseGraphicsAllocation(), csr.taskCount));
     userEvent.setStatus(CL_COMPLETE);
@@ -1623,14 +1657,14 @@ HWTEST_F(TimestampPacketTests, givenWaitlistAndOutputEventWhenEnqueueingWithoutK
 
     auto outEvent = castToObject<Event>(clOutEvent);
 
-    EXPECT_EQ(cmdQ->timestampPacketContainer->peekNodes().at(0), cmdQNodes.peekNodes().at(0)); // no new nodes obtained
+    EXPECT_EQ(cmdQ->timestampPacketContainer->peekNodes()[0], cmdQNodes.peekNodes()[0]); // no new nodes obtained
     EXPECT_EQ(1u, cmdQ->timestampPacketContainer->peekNodes().size());
 
     auto &eventsNodes = outEvent->getTimestampPacketNodes()->peekNodes();
     EXPECT_EQ(numEventsWithContainer + 1, eventsNodes.size()); // numEventsWithContainer + command queue
-    EXPECT_EQ(cmdQNodes.peekNodes().at(0), eventsNodes.at(0));
-    EXPECT_EQ(event0.getTimestampPacketNodes()->peekNodes().at(0), eventsNodes.at(1));
-    EXPECT_EQ(event1.getTimestampPacketNodes()->peekNodes().at(0), eventsNodes.at(2));
+    EXPECT_EQ(cmdQNodes.peekNodes()[0], eventsNodes[0]);
+    EXPECT_EQ(event0.getTimestampPacketNodes()->peekNodes()[0], eventsNodes[1]);
+    EXPECT_EQ(event1.getTimestampPacketNodes()->peekNodes()[0], eventsNodes[2]);
 
     clReleaseEvent(clOutEvent);
     userEvent.setStatus(CL_COMPLETE);
@@ -1820,7 +1854,7 @@ HWTEST_F(TimestampPacketTests, whenEnqueueingBarrierThenRequestPipeControlOnCsrF
 
     cmdQ.enqueueBarrierWithWaitList(0, nullptr, nullptr);
 
-    EXPECT_EQ(cmdQ.timestampPacketContainer->peekNodes().at(0), cmdQNodes.peekNodes().at(0)); // dont obtain new node
+    EXPECT_EQ(cmdQ.timestampPacketContainer->peekNodes()[0], cmdQNodes.peekNodes()[0]); // dont obtain new node
     EXPECT_EQ(1u, cmdQ.timestampPacketContainer->peekNodes().size());
 
     EXPECT_TRUE(csr.stallingPipeControlOnNextFlushRequired);
@@ -1903,6 +1937,19 @@ HWTEST_F(TimestampPacketTests, givenInstructionCacheRequesWhenSizeIsEstimatedThe
     EXPECT_EQ(sizeWithPcRequest, extendedSize);
 }
 
+HWTEST_F(TimestampPacketTests, givenFullCacheFlushRequestWhenSizeIsEstimatedThenPipeControlIsAdded) {
+    auto &csr = device->getUltCommandStreamReceiver<FamilyType>();
+    DispatchFlags flags = DispatchFlagsHelper::createDefaultDispatchFlags();
+
+    csr.requiresFullCacheFlush = false;
+    auto sizeWithoutPcRequest = csr.getRequiredCmdStreamSize(flags, device->getDevice());
+
+    csr.requiresFullCacheFlush = true;
+    auto sizeWithPcRequest = csr.getRequiredCmdStreamSize(flags, device->getDevice());
+
+    EXPECT_EQ(sizeWithoutPcRequest + MemorySynchronizationCommands<FamilyType>::getSizeForFullCacheFlush(), sizeWithPcRequest);
+}
+
 HWTEST_F(TimestampPacketTests, givenPipeControlRequestWhenFlushingThenProgramPipeControlAndResetRequestFlag) {
     using PIPE_CONTROL = typename FamilyType::PIPE_CONTROL;
     auto &csr = device->getUltCommandStreamReceiver<FamilyType>();
@@ -1957,8 +2004,8 @@ HWTEST_F(TimestampPacketTests, givenKernelWhichRequiresFlushWhenEnqueueingKernel
     kernel->mockKernel->svmAllocationsRequireCacheFlush = true;
     // obtain first node for cmdQ and event1
     cmdQ->enqueueKernel(kernel->mockKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr);
-    auto node1 = cmdQ->timestampPacketContainer->peekNodes().at(0);
-    auto node2 = cmdQ->timestampPacketContainer->peekNodes().at(1);
+    auto node1 = cmdQ->timestampPacketContainer->peekNodes()[0];
+    auto node2 = cmdQ->timestampPacketContainer->peekNodes()[1];
     auto size = cmdQ->timestampPacketContainer->peekNodes().size();
     EXPECT_EQ(size, 2u);
     EXPECT_NE(nullptr, node1);
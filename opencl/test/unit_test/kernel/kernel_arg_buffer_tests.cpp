@@ -204,6 +204,64 @@ HWTEST_F(KernelArgBufferTest, GivenSvmPtrStatefulWhenSettingKernelArgThenArgumen
     delete buffer;
 }
 
+HWTEST_F(KernelArgBufferTest, givenSameBufferSetAgainWhenSettingKernelArgThenSurfaceStateIsNotReprogrammed) {
+    using RENDER_SURFACE_STATE = typename FamilyType::RENDER_SURFACE_STATE;
+    MockBuffer buffer;
+    cl_mem val = &buffer;
+
+    auto surfaceState = reinterpret_cast<RENDER_SURFACE_STATE *>(
+        ptrOffset(pKernel->getSurfaceStateHeap(rootDeviceIndex), pKernelInfo->kernelArgInfo[0].offsetHeap));
+
+    EXPECT_EQ(CL_SUCCESS, pKernel->setArg(0, sizeof(cl_mem *), &val));
+    EXPECT_EQ(buffer.getGraphicsAllocation(mockRootDeviceIndex)->getGpuAddress(), surfaceState->getSurfaceBaseAddress());
+
+    memset(surfaceState, 0, sizeof(RENDER_SURFACE_STATE));
+    EXPECT_EQ(CL_SUCCESS, pKernel->setArg(0, sizeof(cl_mem *), &val));
+    EXPECT_EQ(0u, surfaceState->getSurfaceBaseAddress());
+
+    pKernel->setAuxTranslationDirection(AuxTranslationDirection::AuxToNonAux);
+    EXPECT_EQ(CL_SUCCESS, pKernel->setArg(0, sizeof(cl_mem *), &val));
+    EXPECT_EQ(buffer.getGraphicsAllocation(mockRootDeviceIndex)->getGpuAddress(), surfaceState->getSurfaceBaseAddress());
+}
+
+HWTEST_F(KernelArgBufferTest, givenBufferRecreatedAtSameAddressWithDifferentSizeOrFlagsWhenSettingKernelArgThenSurfaceStateIsReprogrammed) {
+    using RENDER_SURFACE_STATE = typename FamilyType::RENDER_SURFACE_STATE;
+    MockBuffer buffer;
+    cl_mem val = &buffer;
+
+    auto surfaceState = reinterpret_cast<RENDER_SURFACE_STATE *>(
+        ptrOffset(pKernel->getSurfaceStateHeap(rootDeviceIndex), pKernelInfo->kernelArgInfo[0].offsetHeap));
+
+    EXPECT_EQ(CL_SUCCESS, pKernel->setArg(0, sizeof(cl_mem *), &val));
+
+    // a released sub-buffer and a new one of the same parent and origin share the cl_mem address and GPU address
+    memset(surfaceState, 0, sizeof(RENDER_SURFACE_STATE));
+    buffer.size /= 2;
+    EXPECT_EQ(CL_SUCCESS, pKernel->setArg(0, sizeof(cl_mem *), &val));
+    EXPECT_EQ(buffer.getGraphicsAllocation(mockRootDeviceIndex)->getGpuAddress(), surfaceState->getSurfaceBaseAddress());
+
+    memset(surfaceState, 0, sizeof(RENDER_SURFACE_STATE));
+    buffer.flags = CL_MEM_READ_ONLY;
+    EXPECT_EQ(CL_SUCCESS, pKernel->setArg(0, sizeof(cl_mem *), &val));
+    EXPECT_EQ(buffer.getGraphicsAllocation(mockRootDeviceIndex)->getGpuAddress(), surfaceState->getSurfaceBaseAddress());
+}
+
+HWTEST_F(KernelArgBufferTest, givenSurfaceStateCacheDisabledWhenSettingSameBufferAgainThenSurfaceStateIsReprogrammed) {
+    using RENDER_SURFACE_STATE = typename FamilyType::RENDER_SURFACE_STATE;
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableKernelArgSurfaceStateCache.set(0);
+    MockBuffer buffer;
+    cl_mem val = &buffer;
+
+    auto surfaceState = reinterpret_cast<RENDER_SURFACE_STATE *>(
+        ptrOffset(pKernel->getSurfaceStateHeap(rootDeviceIndex), pKernelInfo->kernelArgInfo[0].offsetHeap));
+
+    EXPECT_EQ(CL_SUCCESS, pKernel->setArg(0, sizeof(cl_mem *), &val));
+    memset(surfaceState, 0, sizeof(RENDER_SURFACE_STATE));
+    EXPECT_EQ(CL_SUCCESS, pKernel->setArg(0, sizeof(cl_mem *), &val));
+    EXPECT_EQ(buffer.getGraphicsAllocation(mockRootDeviceIndex)->getGpuAddress(), surfaceState->getSurfaceBaseAddress());
+}
+
 HWTEST_F(MultiDeviceKernelArgBufferTest, GivenSvmPtrStatefulWhenSettingKernelArgThenArgumentsAreSetCorrectly) {
     cl_mem val = pBuffer.get();
     auto pVal = &val;
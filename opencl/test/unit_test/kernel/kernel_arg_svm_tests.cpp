@@ -225,6 +225,32 @@ HWTEST_F(KernelArgSvmTest, givenDeviceSupportingSharedSystemAllocationsWhenSetAr
     EXPECT_EQ(16384u, surfaceState->getHeight());
 }
 
+TEST_F(KernelArgSvmTest, givenDeviceSupportingSharedSystemAllocationsWhenSystemPointerArgIsSetThenRangeAroundItIsBoundForResidency) {
+    auto svmAllocsManager = pContext->getSVMAllocsManager();
+    if (svmAllocsManager == nullptr || !pDevice->isFullRangeSvm()) {
+        GTEST_SKIP();
+    }
+    pClDevice->sharedDeviceInfo.sharedSystemAllocationsSupport = true;
+
+    std::vector<Surface *> residencySurfaces;
+    pKernel->setArgSvmAlloc(0, nullptr, nullptr);
+    pKernel->getResidency(residencySurfaces, rootDeviceIndex);
+    auto surfacesWithoutSystemPointer = residencySurfaces.size();
+    for (auto surface : residencySurfaces) {
+        delete surface;
+    }
+    residencySurfaces.clear();
+
+    auto systemPointer = reinterpret_cast<void *>(0x100010);
+    pKernel->setArgSvmAlloc(0, systemPointer, nullptr);
+    pKernel->getResidency(residencySurfaces, rootDeviceIndex);
+    EXPECT_EQ(surfacesWithoutSystemPointer + 1, residencySurfaces.size());
+    EXPECT_EQ(1u, svmAllocsManager->getNumSystemAllocations());
+    for (auto surface : residencySurfaces) {
+        delete surface;
+    }
+}
+
 TEST_F(KernelArgSvmTest, WhenSettingKernelArgImmediateThenInvalidArgValueErrorIsReturned) {
     auto retVal = pKernel->setArgImmediate(0, 256, nullptr);
     EXPECT_EQ(CL_INVALID_ARG_VALUE, retVal);
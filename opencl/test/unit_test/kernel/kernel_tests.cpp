@@ -2297,6 +2297,30 @@ TEST(KernelImageDetectionTests, givenKernelWithNoImagesWhenItIsAskedIfItHasImage
     EXPECT_FALSE(kernel->usesOnlyImages());
 }
 
+TEST(KernelArgsTemplateTests, givenKernelInfoWithArgsTemplateWhenKernelIsInitializedThenArgumentsAreTakenFromTemplate) {
+    auto pKernelInfo = std::make_unique<KernelInfo>();
+    pKernelInfo->kernelDescriptor.kernelAttributes.simdSize = 1;
+    pKernelInfo->kernelArgInfo.resize(2);
+    pKernelInfo->kernelArgInfo[0].isImage = true;
+    pKernelInfo->kernelArgInfo[1].isSampler = true;
+    pKernelInfo->argsTemplate = Kernel::createArgsTemplate(*pKernelInfo);
+
+    // the template is built once, later changes of the arg info are not seen by new kernels
+    pKernelInfo->kernelArgInfo[1].isSampler = false;
+
+    const auto rootDeviceIndex = 0u;
+    auto device = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get(), rootDeviceIndex));
+    auto context = clUniquePtr(new MockContext(device.get()));
+    auto program = clUniquePtr(new MockProgram(context.get(), false, toClDeviceVector(*device)));
+    auto kernel = std::make_unique<MockKernel>(program.get(), MockKernel::toKernelInfoContainer(*pKernelInfo, rootDeviceIndex), *device);
+    ASSERT_EQ(CL_SUCCESS, kernel->initialize());
+
+    EXPECT_EQ(Kernel::IMAGE_OBJ, kernel->getKernelArgInfo(0).type);
+    EXPECT_EQ(Kernel::SAMPLER_OBJ, kernel->getKernelArgInfo(1).type);
+    EXPECT_EQ(pKernelInfo->argsTemplate->kernelArgHandlers, kernel->kernelArgHandlers);
+    EXPECT_TRUE(kernel->usesOnlyImages());
+}
+
 HWTEST_F(KernelResidencyTest, WhenMakingArgsResidentThenImageFromImageCheckIsCorrect) {
     ASSERT_NE(nullptr, pDevice);
 
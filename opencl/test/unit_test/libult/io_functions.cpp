@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -13,13 +13,16 @@ fopenFuncPtr fopenPtr = &mockFopen;
 vfprintfFuncPtr vfprintfPtr = &mockVfptrinf;
 fcloseFuncPtr fclosePtr = &mockFclose;
 getenvFuncPtr getenvPtr = &mockGetenv;
+getEnvironmentFuncPtr getEnvironmentPtr = &mockGetEnvironment;
 
 uint32_t mockFopenCalled = 0;
 uint32_t mockVfptrinfCalled = 0;
 uint32_t mockFcloseCalled = 0;
 uint32_t mockGetenvCalled = 0;
+uint32_t mockGetEnvironmentCalled = 0;
 
 std::unordered_map<std::string, std::string> *mockableEnvValues = nullptr;
+char **mockableEnvironment = nullptr;
 
 } // namespace IoFunctions
 } // namespace NEO
@@ -169,6 +169,7 @@ HWTEST_TEMPLATED_F(BcsBufferTests, givenBcsSupportedWhenEnqueueBufferOperationIs
     size_t hostOrigin[] = {0, 0, 0};
     size_t region[] = {1, 2, 1};
 
+    DebugManager.flags.DoCpuCopyOnSvmMemcpy.set(0);
     DebugManager.flags.EnableBlitterForEnqueueOperations.set(0);
     hwInfo->capabilityTable.blitterOperationsSupported = false;
     commandQueue->enqueueWriteBuffer(bufferForBlt0.get(), CL_TRUE, 0, 1, &hostPtr, nullptr, 0, nullptr, nullptr);
@@ -505,7 +506,7 @@ HWTEST_TEMPLATED_F(BcsBufferTests, givenWriteBufferEnqueueWhenProgrammingCommand
     void *hostPtr = reinterpret_cast<void *>(0x12340000);
 
     cmdQ->enqueueWriteBuffer(buffer.get(), true, 0, 1, hostPtr, nullptr, 0, nullptr, nullptr);
-    auto timestampPacketNode = cmdQ->timestampPacketContainer->peekNodes().at(0);
+    auto timestampPacketNode = cmdQ->timestampPacketContainer->peekNodes()[0];
 
     HardwareParse hwParser;
     hwParser.parseCommands<FamilyType>(*cmdQ->peekCommandStream());
@@ -550,7 +551,7 @@ HWTEST_TEMPLATED_F(BcsBufferTests, givenReadBufferEnqueueWhenProgrammingCommandS
     void *hostPtr = reinterpret_cast<void *>(0x12340000);
 
     cmdQ->enqueueWriteBuffer(buffer.get(), true, 0, 1, hostPtr, nullptr, 0, nullptr, nullptr);
-    auto timestampPacketNode = cmdQ->timestampPacketContainer->peekNodes().at(0);
+    auto timestampPacketNode = cmdQ->timestampPacketContainer->peekNodes()[0];
 
     HardwareParse hwParser;
     hwParser.parseCommands<FamilyType>(*cmdQ->peekCommandStream());
@@ -866,10 +867,10 @@ HWTEST_TEMPLATED_F(BcsBufferTests, givenInputAndOutputTimestampPacketWhenBlitCal
 
     // first enqueue to create IOQ dependency
     cmdQ->enqueueWriteBuffer(buffer.get(), true, 0, 1, hostPtr, nullptr, 0, nullptr, nullptr);
-    auto inputTimestampPacketAllocation = cmdQ->timestampPacketContainer->peekNodes().at(0)->getBaseGraphicsAllocation();
+    auto inputTimestampPacketAllocation = cmdQ->timestampPacketContainer->peekNodes()[0]->getBaseGraphicsAllocation();
 
     cmdQ->enqueueWriteBuffer(buffer.get(), true, 0, 1, hostPtr, nullptr, 0, nullptr, nullptr);
-    auto outputTimestampPacketAllocation = cmdQ->timestampPacketContainer->peekNodes().at(0)->getBaseGraphicsAllocation();
+    auto outputTimestampPacketAllocation = cmdQ->timestampPacketContainer->peekNodes()[0]->getBaseGraphicsAllocation();
 
     EXPECT_NE(outputTimestampPacketAllocation, inputTimestampPacketAllocation);
 
@@ -683,6 +683,44 @@ TEST_F(RenderCompressedBuffersTests, givenDebugVariableSetWhenHwFlagIsNotSetThen
     EXPECT_NE(graphicsAllocation->getAllocationType(), GraphicsAllocation::AllocationType::BUFFER_COMPRESSED);
 }
 
+TEST_F(RenderCompressedBuffersTests, givenReleasedBuffersAccessedMostlyStatelessWhenCreatingBufferThenCompressionIsSelectedOnlyWhenAdaptiveCompressionIsDisabled) {
+    DebugManagerStateRestore restore;
+    hwInfo->capabilityTable.ftrRenderCompressedBuffers = true;
+    if (!HwHelper::get(hwInfo->platform.eRenderCoreFamily).isBufferSizeSuitableForRenderCompression(bufferSize)) {
+        GTEST_SKIP();
+    }
+
+    buffer.reset(Buffer::create(context.get(), CL_MEM_READ_WRITE, bufferSize, nullptr, retVal));
+    EXPECT_EQ(GraphicsAllocation::AllocationType::BUFFER_COMPRESSED, buffer->getMultiGraphicsAllocation().getAllocationType());
+    buffer->getCompressionUsage().statefulAccesses = 3;
+    buffer->getCompressionUsage().statelessAccesses = 2;
+    buffer.reset();
+
+    auto &contextUsage = context->getBufferCompressionUsage();
+    EXPECT_EQ(3u, contextUsage.statefulAccesses.load());
+    EXPECT_EQ(2u, contextUsage.statelessAccesses.load());
+    EXPECT_FALSE(contextUsage.isCompressionBeneficial());
+
+    buffer.reset(Buffer::create(context.get(), CL_MEM_READ_WRITE, bufferSize, nullptr, retVal));
+    EXPECT_NE(GraphicsAllocation::AllocationType::BUFFER_COMPRESSED, buffer->getMultiGraphicsAllocation().getAllocationType());
+
+    DebugManager.flags.AdaptiveBufferCompression.set(0);
+    buffer.reset(Buffer::create(context.get(), CL_MEM_READ_WRITE, bufferSize, nullptr, retVal));
+    EXPECT_EQ(GraphicsAllocation::AllocationType::BUFFER_COMPRESSED, buffer->getMultiGraphicsAllocation().getAllocationType());
+}
+
+TEST_F(RenderCompressedBuffersTests, givenSubBufferWhenUpdatingCompressionUsageThenParentBufferUsageIsUpdated) {
+    buffer.reset(Buffer::create(context.get(), CL_MEM_READ_WRITE, bufferSize, nullptr, retVal));
+    cl_buffer_region region = {0, bufferSize / 2};
+    auto subBuffer = buffer->createSubBuffer(CL_MEM_READ_WRITE, 0, &region, retVal);
+    ASSERT_NE(nullptr, subBuffer);
+
+    subBuffer->getCompressionUsage().cpuAccesses++;
+    EXPECT_EQ(1u, buffer->getCompressionUsage().cpuAccesses.load());
+    subBuffer->release();
+    EXPECT_EQ(0u, context->getBufferCompressionUsage().cpuAccesses.load());
+}
+
 struct RenderCompressedBuffersSvmTests : public RenderCompressedBuffersTests {
     void SetUp() override {
         ExecutionEnvironment *executionEnvironment = platform()->peekExecutionEnvironment();
@@ -1706,6 +1744,74 @@ HWTEST_F(BufferSetSurfaceTests, givenBufferThatIsMisalignedWhenSurfaceStateIsBei
     EXPECT_EQ(0u, surfaceState.getMemoryObjectControlState());
 }
 
+template <typename GfxFamily>
+struct BufferHwWithSurfaceStateCache : public BufferHw<GfxFamily> {
+    using BufferHw<GfxFamily>::cachedSurfaceStates;
+};
+
+HWTEST_F(BufferSetSurfaceTests, givenSurfaceStateCacheEnabledWhenSetArgStatefulIsCalledTwiceWithSameParamsThenCachedSurfaceStateIsReused) {
+    using RENDER_SURFACE_STATE = typename FamilyType::RENDER_SURFACE_STATE;
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableBufferSurfaceStateCache.set(1);
+    MockContext context;
+    auto retVal = CL_SUCCESS;
+    std::unique_ptr<Buffer> buffer(Buffer::create(&context, CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, retVal));
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    auto bufferHw = static_cast<BufferHwWithSurfaceStateCache<FamilyType> *>(buffer.get());
+    auto &neoDevice = context.getDevice(0)->getDevice();
+
+    RENDER_SURFACE_STATE surfaceState = {};
+    RENDER_SURFACE_STATE cachedSurfaceState = {};
+    buffer->setArgStateful(&surfaceState, false, false, false, false, neoDevice, false, 1u);
+    EXPECT_EQ(1u, bufferHw->cachedSurfaceStates.size());
+    buffer->setArgStateful(&cachedSurfaceState, false, false, false, false, neoDevice, false, 1u);
+    EXPECT_EQ(1u, bufferHw->cachedSurfaceStates.size());
+    EXPECT_EQ(0, memcmp(&surfaceState, &cachedSurfaceState, sizeof(RENDER_SURFACE_STATE)));
+
+    RENDER_SURFACE_STATE readOnlySurfaceState = {};
+    buffer->setArgStateful(&readOnlySurfaceState, false, false, false, true, neoDevice, false, 1u);
+    EXPECT_EQ(2u, bufferHw->cachedSurfaceStates.size());
+}
+
+HWTEST_F(BufferSetSurfaceTests, givenCachedSurfaceStatesWhenGraphicsAllocationIsResetThenCacheIsCleared) {
+    using RENDER_SURFACE_STATE = typename FamilyType::RENDER_SURFACE_STATE;
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableBufferSurfaceStateCache.set(1);
+    MockContext context;
+    auto retVal = CL_SUCCESS;
+    std::unique_ptr<Buffer> buffer(Buffer::create(&context, CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, retVal));
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    auto bufferHw = static_cast<BufferHwWithSurfaceStateCache<FamilyType> *>(buffer.get());
+    auto &neoDevice = context.getDevice(0)->getDevice();
+
+    RENDER_SURFACE_STATE surfaceState = {};
+    buffer->setArgStateful(&surfaceState, false, false, false, false, neoDevice, false, 1u);
+    EXPECT_EQ(1u, bufferHw->cachedSurfaceStates.size());
+
+    auto newAllocation = context.getMemoryManager()->allocateGraphicsMemoryWithProperties(MockAllocationProperties{neoDevice.getRootDeviceIndex(), MemoryConstants::pageSize});
+    buffer->resetGraphicsAllocation(newAllocation);
+    EXPECT_EQ(0u, bufferHw->cachedSurfaceStates.size());
+
+    buffer->setArgStateful(&surfaceState, false, false, false, false, neoDevice, false, 1u);
+    EXPECT_EQ(newAllocation->getGpuAddress(), surfaceState.getSurfaceBaseAddress());
+}
+
+HWTEST_F(BufferSetSurfaceTests, givenSurfaceStateCacheDisabledWhenSetArgStatefulIsCalledThenNothingIsCached) {
+    using RENDER_SURFACE_STATE = typename FamilyType::RENDER_SURFACE_STATE;
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableBufferSurfaceStateCache.set(0);
+    MockContext context;
+    auto retVal = CL_SUCCESS;
+    std::unique_ptr<Buffer> buffer(Buffer::create(&context, CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, retVal));
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    auto bufferHw = static_cast<BufferHwWithSurfaceStateCache<FamilyType> *>(buffer.get());
+
+    RENDER_SURFACE_STATE surfaceState = {};
+    buffer->setArgStateful(&surfaceState, false, false, false, false, context.getDevice(0)->getDevice(), false, 1u);
+    EXPECT_EQ(0u, bufferHw->cachedSurfaceStates.size());
+    EXPECT_NE(0u, surfaceState.getSurfaceBaseAddress());
+}
+
 using BufferHwFromDeviceTests = BufferTests;
 
 HWTEST_F(BufferHwFromDeviceTests, givenMultiGraphicsAllocationWhenCreateBufferHwFromDeviceThenMultiGraphicsAllocationInBufferIsProperlySet) {
@@ -1933,6 +2039,97 @@ TEST_F(MultiRootDeviceBufferTest, WhenBufferIsCreatedThenBufferGraphicsAllocatio
     EXPECT_EQ(expectedRootDeviceIndex, graphicsAllocation->getRootDeviceIndex());
 }
 
+TEST_F(MultiRootDeviceBufferTest, givenLazyMultiRootDeviceBackingEnabledWhenBufferIsCreatedThenOnlyDefaultRootDeviceHasAllocation) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableLazyMultiRootDeviceBacking.set(true);
+    cl_int retVal = 0;
+
+    std::unique_ptr<Buffer> buffer(Buffer::create(context.get(), CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, retVal));
+    ASSERT_NE(nullptr, buffer);
+
+    EXPECT_NE(nullptr, buffer->getMultiGraphicsAllocation().getGraphicsAllocation(1u));
+    EXPECT_EQ(nullptr, buffer->getMultiGraphicsAllocation().getGraphicsAllocation(2u));
+
+    EXPECT_EQ(nullptr, buffer->getGraphicsAllocation(2u));
+
+    EXPECT_EQ(CL_SUCCESS, buffer->createLazyBacking(2u));
+    auto graphicsAllocation = buffer->getGraphicsAllocation(2u);
+    ASSERT_NE(nullptr, graphicsAllocation);
+    EXPECT_EQ(2u, graphicsAllocation->getRootDeviceIndex());
+    EXPECT_EQ(graphicsAllocation, buffer->getMultiGraphicsAllocation().getGraphicsAllocation(2u));
+
+    EXPECT_EQ(CL_SUCCESS, buffer->createLazyBacking(2u));
+    EXPECT_EQ(graphicsAllocation, buffer->getGraphicsAllocation(2u));
+}
+
+TEST_F(MultiRootDeviceBufferTest, givenLazyMultiRootDeviceBackingEnabledWhenBackingCannotBeAllocatedThenAllocationFailureIsReturned) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableLazyMultiRootDeviceBacking.set(true);
+    cl_int retVal = 0;
+
+    std::unique_ptr<Buffer> buffer(Buffer::create(context.get(), CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, retVal));
+    ASSERT_NE(nullptr, buffer);
+    uint8_t hostMemory[MemoryConstants::pageSize] = {};
+
+    mockMemoryManager->isMockHostMemoryManager = true;
+    mockMemoryManager->forceFailureInAllocationWithHostPointer = true;
+
+    retVal = context->getSpecialQueue(2u)->enqueueReadBuffer(buffer.get(), CL_TRUE, 0, MemoryConstants::pageSize, hostMemory, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_MEM_OBJECT_ALLOCATION_FAILURE, retVal);
+    EXPECT_EQ(nullptr, buffer->getGraphicsAllocation(2u));
+
+    cl_buffer_region region = {0, MemoryConstants::cacheLineSize};
+    std::unique_ptr<Buffer> subBuffer(buffer->createSubBuffer(CL_MEM_READ_WRITE, 0, &region, retVal));
+    EXPECT_EQ(nullptr, subBuffer);
+    EXPECT_EQ(CL_MEM_OBJECT_ALLOCATION_FAILURE, retVal);
+
+    mockMemoryManager->isMockHostMemoryManager = false;
+    mockMemoryManager->forceFailureInAllocationWithHostPointer = false;
+}
+
+TEST_F(MultiRootDeviceBufferTest, givenLazyMultiRootDeviceBackingEnabledWhenBufferIsUsedOnSecondRootDeviceThenBackingIsCreatedAndOwnerIsUpdated) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableLazyMultiRootDeviceBacking.set(true);
+    cl_int retVal = 0;
+
+    std::unique_ptr<Buffer> buffer(Buffer::create(context.get(), CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, retVal));
+    uint8_t hostMemory[MemoryConstants::pageSize] = {};
+
+    context->getSpecialQueue(1u)->enqueueWriteBuffer(buffer.get(), CL_TRUE, 0, MemoryConstants::pageSize, hostMemory, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(nullptr, buffer->getMultiGraphicsAllocation().getGraphicsAllocation(2u));
+    EXPECT_EQ(1u, buffer->getMultiGraphicsAllocation().getLastUsedRootDeviceIndex());
+
+    context->getSpecialQueue(2u)->enqueueReadBuffer(buffer.get(), CL_TRUE, 0, MemoryConstants::pageSize, hostMemory, nullptr, 0, nullptr, nullptr);
+    EXPECT_NE(nullptr, buffer->getMultiGraphicsAllocation().getGraphicsAllocation(2u));
+    EXPECT_EQ(2u, buffer->getMultiGraphicsAllocation().getLastUsedRootDeviceIndex());
+}
+
+TEST_F(MultiRootDeviceBufferTest, givenLazyMultiRootDeviceBackingEnabledWhenBufferIsCreatedWithHostPtrThenAllRootDevicesHaveAllocations) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableLazyMultiRootDeviceBacking.set(true);
+    cl_int retVal = 0;
+    uint8_t hostMemory[MemoryConstants::pageSize] = {};
+
+    std::unique_ptr<Buffer> buffer(Buffer::create(context.get(), CL_MEM_COPY_HOST_PTR, MemoryConstants::pageSize, hostMemory, retVal));
+    ASSERT_NE(nullptr, buffer);
+
+    EXPECT_NE(nullptr, buffer->getMultiGraphicsAllocation().getGraphicsAllocation(1u));
+    EXPECT_NE(nullptr, buffer->getMultiGraphicsAllocation().getGraphicsAllocation(2u));
+}
+
+TEST_F(MultiRootDeviceBufferTest, givenLazyMultiRootDeviceBackingEnabledWhenSubBufferIsCreatedThenParentHasAllocationsOnAllRootDevices) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableLazyMultiRootDeviceBacking.set(true);
+    cl_int retVal = 0;
+
+    std::unique_ptr<Buffer> buffer(Buffer::create(context.get(), CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, retVal));
+    cl_buffer_region region = {0, MemoryConstants::cacheLineSize};
+    std::unique_ptr<Buffer> subBuffer(buffer->createSubBuffer(CL_MEM_READ_WRITE, 0, &region, retVal));
+
+    EXPECT_NE(nullptr, buffer->getMultiGraphicsAllocation().getGraphicsAllocation(2u));
+    EXPECT_EQ(buffer->getMultiGraphicsAllocation().getGraphicsAllocation(2u), subBuffer->getMultiGraphicsAllocation().getGraphicsAllocation(2u));
+}
+
 TEST_F(MultiRootDeviceBufferTest, WhenBufferIsCreatedAndEnqueueWriteBufferCalledThenBufferMultiGraphicsAllocationLastUsedRootDeviceIndexHasCorrectRootDeviceIndex) {
     cl_int retVal = 0;
     cl_mem_flags flags = CL_MEM_READ_WRITE;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -133,6 +133,8 @@ const std::tuple<void *, size_t, void *, size_t, bool> overlappingCombinations[]
     std::make_tuple((void *)5000, 50, (void *)6000, 1, false),  //requested after, non-overlapping
     std::make_tuple((void *)5000, 50, (void *)5000, 1, true),   //requested on start, overlapping inside
     std::make_tuple((void *)5000, 50, (void *)5000, 100, true), //requested on start, overlapping outside
+    std::make_tuple((void *)5000, 50, (void *)4990, 10, false), //requested before, ending on start
+    std::make_tuple((void *)5000, 50, (void *)5050, 10, false), //requested on end, non-overlapping
 };
 
 struct MapOperationsHandlerOverlapTests : public ::testing::WithParamInterface<std::tuple<void *, size_t, void *, size_t, bool>>,
@@ -38,10 +38,15 @@ struct CommandQueueMock : public MockCommandQueue {
         finishCalled++;
         return CL_SUCCESS;
     }
+    cl_int flush() override {
+        flushCalled++;
+        return CL_SUCCESS;
+    }
 
     int transferToCpuCalled = 0;
     int transferToGpuCalled = 0;
     int finishCalled = 0;
+    int flushCalled = 0;
     uint64_t passedMapFlags = 0;
 };
 
@@ -66,7 +71,7 @@ TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocWhenSynchronizeMemoryThenEnq
     EXPECT_EQ(cmdQ->transferToGpuCalled, 0);
     EXPECT_EQ(cmdQ->finishCalled, 0);
 
-    pageFaultManager->baseGpuTransfer(alloc, cmdQ.get());
+    pageFaultManager->baseGpuTransfer(alloc, 256, cmdQ.get());
     EXPECT_EQ(cmdQ->transferToCpuCalled, 1);
     EXPECT_EQ(cmdQ->transferToGpuCalled, 1);
     EXPECT_EQ(cmdQ->finishCalled, 1);
@@ -99,9 +104,38 @@ TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocWhenGpuTransferIsInvokedThen
     pageFaultManager->insertAllocation(alloc, 256, svmAllocsManager.get(), cmdQ.get(), {});
 
     EXPECT_EQ(svmAllocsManager->insertSvmMapOperationCalled, 0);
-    pageFaultManager->baseGpuTransfer(alloc, cmdQ.get());
+    pageFaultManager->baseGpuTransfer(alloc, 256, cmdQ.get());
     EXPECT_EQ(svmAllocsManager->insertSvmMapOperationCalled, 1);
 
     svmAllocsManager->freeSVMAlloc(alloc);
     cmdQ->device = nullptr;
 }
+
+TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocWhenStartingGpuTransferThenUnmapIsFlushedWithoutWaiting) {
+    MockExecutionEnvironment executionEnvironment;
+    REQUIRE_SVM_OR_SKIP(executionEnvironment.rootDeviceEnvironments[0]->getHardwareInfo());
+
+    auto memoryManager = std::make_unique<MockMemoryManager>(executionEnvironment);
+    auto svmAllocsManager = std::make_unique<SVMAllocsManager>(memoryManager.get(), false);
+    auto device = std::unique_ptr<MockClDevice>(new MockClDevice{MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr)});
+    auto rootDeviceIndex = device->getRootDeviceIndex();
+    std::set<uint32_t> rootDeviceIndices{rootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{rootDeviceIndex, device->getDeviceBitfield()}};
+    void *alloc = svmAllocsManager->createSVMAlloc(256, {}, rootDeviceIndices, deviceBitfields);
+    auto cmdQ = std::make_unique<CommandQueueMock>();
+    cmdQ->device = device.get();
+    pageFaultManager->insertAllocation(alloc, 256, svmAllocsManager.get(), cmdQ.get(), {});
+
+    pageFaultManager->baseStartGpuTransfer(alloc, 256, cmdQ.get());
+    EXPECT_EQ(cmdQ->transferToGpuCalled, 1);
+    EXPECT_EQ(cmdQ->flushCalled, 1);
+    EXPECT_EQ(cmdQ->finishCalled, 0);
+    EXPECT_NE(nullptr, svmAllocsManager->getSvmMapOperation(alloc));
+
+    pageFaultManager->baseWaitForGpuTransfers(cmdQ.get());
+    EXPECT_EQ(cmdQ->finishCalled, 1);
+
+    svmAllocsManager->removeSvmMapOperation(alloc);
+    svmAllocsManager->freeSVMAlloc(alloc);
+    cmdQ->device = nullptr;
+}
@@ -10,6 +10,7 @@
 #include "shared/source/memory_manager/deferrable_allocation_deletion.h"
 #include "shared/source/memory_manager/deferred_deleter.h"
 #include "shared/source/os_interface/os_context.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_device.h"
 
 #include "opencl/source/platform/platform.h"
@@ -23,6 +24,7 @@ using namespace NEO;
 
 struct DeferredDeleterPublic : DeferredDeleter {
   public:
+    using DeferredDeleter::additionalWorkers;
     using DeferredDeleter::doWorkInBackground;
     using DeferredDeleter::queue;
     using DeferredDeleter::queueMutex;
@@ -170,3 +172,53 @@ TEST_F(DeferrableAllocationDeletionTest, givenAllocationUsedByUnregisteredEngine
     EXPECT_TRUE(deletion.apply());
     EXPECT_EQ(1u, memoryManager->freeGraphicsMemoryCalled);
 }
+
+TEST_F(DeferrableAllocationDeletionTest, givenAllocationSizeWhenCheckingDeletionPriorityThenOnlyLargeAllocationsAreHighPriority) {
+    DebugManagerStateRestore restorer;
+    auto smallAllocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    auto largeAllocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize2Mb});
+    DeferrableAllocationDeletion smallDeletion{*memoryManager, *smallAllocation};
+    DeferrableAllocationDeletion largeDeletion{*memoryManager, *largeAllocation};
+
+    EXPECT_FALSE(smallDeletion.isHighPriority());
+    EXPECT_TRUE(largeDeletion.isHighPriority());
+
+    DebugManager.flags.DeferredDeleterHighPriorityAllocationSize.set(static_cast<int32_t>(MemoryConstants::pageSize));
+    EXPECT_TRUE(smallDeletion.isHighPriority());
+
+    memoryManager->freeGraphicsMemory(smallAllocation);
+    memoryManager->freeGraphicsMemory(largeAllocation);
+}
+
+TEST_F(DeferrableAllocationDeletionTest, givenLargeAllocationDeferredAfterSmallOneWhenQueuedThenLargeAllocationIsAtQueueFront) {
+    DeferredDeleterPublic deleter;
+    auto smallAllocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    auto largeAllocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize2Mb});
+    auto smallDeletion = new DeferrableAllocationDeletion(*memoryManager, *smallAllocation);
+    auto largeDeletion = new DeferrableAllocationDeletion(*memoryManager, *largeAllocation);
+
+    deleter.deferDeletion(smallDeletion);
+    deleter.deferDeletion(largeDeletion);
+    EXPECT_EQ(largeDeletion, deleter.queue.peekHead());
+
+    deleter.drain(true);
+    EXPECT_EQ(2u, memoryManager->freeGraphicsMemoryCalled);
+}
+
+TEST_F(DeferrableAllocationDeletionTest, givenMultipleWorkersWhenAllocationIsDeferredThenItIsReleasedAndWorkersStop) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.DeferredDeleterWorkersCount.set(3);
+    auto deleter = std::make_unique<DeferredDeleterPublic>();
+    deleter->addClient();
+    EXPECT_EQ(2u, deleter->additionalWorkers.size());
+
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    deleter->deferDeletion(new DeferrableAllocationDeletion(*memoryManager, *allocation));
+    while (memoryManager->freeGraphicsMemoryCalled == 0u)
+        std::this_thread::yield();
+
+    deleter->allowExit = true;
+    deleter->removeClient();
+    EXPECT_TRUE(deleter->additionalWorkers.empty());
+    EXPECT_EQ(1u, memoryManager->freeGraphicsMemoryCalled);
+}
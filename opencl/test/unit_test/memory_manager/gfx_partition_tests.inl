@@ -10,6 +10,7 @@
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/os_interface/os_memory.h"
 #include "shared/source/utilities/cpu_info.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 
 #include "opencl/test/unit_test/mocks/mock_gfx_partition.h"
 
@@ -395,3 +396,57 @@ TEST(GfxPartitionTest, givenInternalHeapWhenAllocatingSmallOrBigChunkThenAddress
         gfxPartition.heapFree(heaps[i], address, sizeToAlloc);
     }
 }
+
+TEST(GfxPartitionTest, givenStandard2MbHeapAllocationWhenFreeingGpuAddressRangeThenRangeIsReturnedToHeap) {
+    MockGfxPartitionBasic gfxPartition;
+    gfxPartition.init(maxNBitValue(48), reservedCpuAddressRangeSize, 0, 1);
+
+    size_t sizeToAlloc = 2 * MemoryConstants::megaByte;
+    auto firstAddress = gfxPartition.heapAllocate(HeapIndex::HEAP_STANDARD2MB, sizeToAlloc);
+    auto secondAddress = gfxPartition.heapAllocate(HeapIndex::HEAP_STANDARD2MB, sizeToAlloc);
+    EXPECT_NE(firstAddress, secondAddress);
+
+    gfxPartition.freeGpuAddressRange(secondAddress, sizeToAlloc);
+
+    auto thirdAddress = gfxPartition.heapAllocate(HeapIndex::HEAP_STANDARD2MB, sizeToAlloc);
+    EXPECT_EQ(secondAddress, thirdAddress);
+
+    gfxPartition.heapFree(HeapIndex::HEAP_STANDARD2MB, firstAddress, sizeToAlloc);
+    gfxPartition.heapFree(HeapIndex::HEAP_STANDARD2MB, thirdAddress, sizeToAlloc);
+}
+
+TEST(GfxPartitionTest, givenInitializedGfxPartitionWhenHeapIsUsedForFirstTimeThenItsAllocatorIsCreated) {
+    MockGfxPartition gfxPartition;
+    gfxPartition.init(maxNBitValue(48), reservedCpuAddressRangeSize, 0, 1);
+
+    EXPECT_FALSE(gfxPartition.heapAllocatorCreated(HeapIndex::HEAP_STANDARD));
+    EXPECT_FALSE(gfxPartition.heapAllocatorCreated(HeapIndex::HEAP_STANDARD64KB));
+
+    size_t size = MemoryConstants::pageSize;
+    EXPECT_NE(0u, gfxPartition.heapAllocate(HeapIndex::HEAP_STANDARD, size));
+    EXPECT_TRUE(gfxPartition.heapAllocatorCreated(HeapIndex::HEAP_STANDARD));
+    EXPECT_FALSE(gfxPartition.heapAllocatorCreated(HeapIndex::HEAP_STANDARD64KB));
+}
+
+TEST(GfxPartitionTest, given47bitGpuAddressSpaceAndReservationSizeSetWhenInitializingGfxPartitionThenReservationIsShrunkButFitsAllHeaps) {
+    if (is32bit) {
+        GTEST_SKIP();
+    }
+    DebugManagerStateRestore restorer;
+
+    for (auto sizeInGb : {30, 1}) {
+        DebugManager.flags.CpuAddressRangeReservationSizeInGb.set(sizeInGb);
+        auto expectedSize = std::max<uint64_t>(sizeInGb, 28) * MemoryConstants::gigaByte;
+
+        MockGfxPartition gfxPartition;
+        auto mockOsMemory = new MockOsMemory;
+        mockOsMemory->returnAddress = reinterpret_cast<void *>(GfxPartition::heapGranularity);
+        gfxPartition.osMemory.reset(mockOsMemory);
+        EXPECT_TRUE(gfxPartition.init(maxNBitValue(47), reservedCpuAddressRangeSize, 0, 1));
+
+        EXPECT_EQ(expectedSize, gfxPartition.getReservedCpuAddressRangeSize() + GfxPartition::heapGranularity);
+        auto gfxBase = reinterpret_cast<uint64_t>(gfxPartition.getReservedCpuAddressRange());
+        EXPECT_LE(gfxPartition.getHeapLimit(HeapIndex::HEAP_STANDARD2MB), gfxBase + expectedSize);
+        EXPECT_LT(gfxPartition.getHeapBase(HeapIndex::HEAP_STANDARD), gfxPartition.getHeapLimit(HeapIndex::HEAP_STANDARD));
+    }
+}
@@ -156,6 +156,35 @@ TEST_F(InternalAllocationStorageTest, whenNotUsedAllocationIsStoredAsReusableAnd
     memoryManager->freeGraphicsMemory(allocation);
 }
 
+TEST_F(InternalAllocationStorageTest, givenReusableAllocationsAboveLimitWhenTrimmingThenOldestCompletedAllocationsOfGivenTypeAreReleased) {
+    auto commandBuffer1 = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, GraphicsAllocation::AllocationType::COMMAND_BUFFER, mockDeviceBitfield});
+    auto commandBuffer2 = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, GraphicsAllocation::AllocationType::COMMAND_BUFFER, mockDeviceBitfield});
+    auto commandBuffer3 = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, GraphicsAllocation::AllocationType::COMMAND_BUFFER, mockDeviceBitfield});
+    auto buffer = memoryManager->allocateGraphicsMemoryWithProperties(AllocationProperties{0, MemoryConstants::pageSize, GraphicsAllocation::AllocationType::BUFFER, mockDeviceBitfield});
+
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(buffer), REUSABLE_ALLOCATION, 1u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(commandBuffer1), REUSABLE_ALLOCATION, 5u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(commandBuffer2), REUSABLE_ALLOCATION, 1u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(commandBuffer3), REUSABLE_ALLOCATION, 2u);
+
+    *csr->getTagAddress() = 2u;
+    storage->trimReusableAllocations(GraphicsAllocation::AllocationType::COMMAND_BUFFER, 1u);
+
+    auto &reusableAllocations = csr->getAllocationsForReuse();
+    EXPECT_TRUE(reusableAllocations.peekContains(*buffer));
+    EXPECT_TRUE(reusableAllocations.peekContains(*commandBuffer1));
+    EXPECT_FALSE(reusableAllocations.peekContains(*commandBuffer2));
+    EXPECT_FALSE(reusableAllocations.peekContains(*commandBuffer3));
+
+    storage->trimReusableAllocations(GraphicsAllocation::AllocationType::COMMAND_BUFFER, 0u);
+    EXPECT_TRUE(reusableAllocations.peekContains(*commandBuffer1));
+
+    *csr->getTagAddress() = 5u;
+    storage->trimReusableAllocations(GraphicsAllocation::AllocationType::COMMAND_BUFFER, 0u);
+    EXPECT_FALSE(reusableAllocations.peekContains(*commandBuffer1));
+    EXPECT_TRUE(reusableAllocations.peekContains(*buffer));
+}
+
 TEST_F(InternalAllocationStorageTest, whenObtainAllocationFromMidlleOfReusableListThenItIsDetachedFromLinkedList) {
     auto &reusableAllocations = csr->getAllocationsForReuse();
     EXPECT_TRUE(reusableAllocations.peekIsEmpty());
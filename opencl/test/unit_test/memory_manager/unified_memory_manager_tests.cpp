@@ -118,6 +118,30 @@ TEST_F(SVMMemoryAllocatorTest, givenSvmManagerWhenOperatedOnThenCorrectAllocatio
     svmManager->memoryManager->freeGraphicsMemory(allocation);
 }
 
+TEST(SvmAllocationTrackerTest, givenAdjacentAllocationsWhenGettingInteriorPointersThenOwningAllocationIsReturned) {
+    constexpr size_t allocationSize = MemoryConstants::pageSize;
+    constexpr uint64_t baseAddress = 0x100000;
+    SVMAllocsManager::MapBasedAllocationTracker tracker;
+    std::vector<std::unique_ptr<MockGraphicsAllocation>> graphicsAllocations;
+    for (uint64_t i = 0; i < 4; i++) {
+        graphicsAllocations.push_back(std::make_unique<MockGraphicsAllocation>(nullptr, baseAddress + i * 2 * allocationSize, allocationSize));
+        SvmAllocationData svmData(0u);
+        svmData.gpuAllocations.addAllocation(graphicsAllocations.back().get());
+        svmData.size = allocationSize;
+        tracker.insert(svmData);
+    }
+
+    EXPECT_EQ(nullptr, tracker.get(reinterpret_cast<void *>(baseAddress - 1)));
+    for (uint64_t i = 0; i < 4; i++) {
+        auto allocationBase = baseAddress + i * 2 * allocationSize;
+        auto svmData = tracker.get(reinterpret_cast<void *>(allocationBase));
+        ASSERT_NE(nullptr, svmData);
+        EXPECT_EQ(graphicsAllocations[i].get(), svmData->gpuAllocations.getDefaultGraphicsAllocation());
+        EXPECT_EQ(svmData, tracker.get(reinterpret_cast<void *>(allocationBase + allocationSize - 1)));
+        EXPECT_EQ(nullptr, tracker.get(reinterpret_cast<void *>(allocationBase + allocationSize)));
+    }
+}
+
 TEST_F(SVMMemoryAllocatorTest, whenGetSVMAllocationFromReturnedPointerAreaThenReturnSameAllocation) {
     auto ptr = svmManager->createSVMAlloc(MemoryConstants::pageSize, {}, rootDeviceIndices, deviceBitfields);
     EXPECT_NE(ptr, nullptr);
@@ -165,6 +189,76 @@ TEST_F(SVMMemoryAllocatorTest, whenCouldNotAllocateInMemoryManagerThenReturnsNul
     svmManager->freeSVMAlloc(ptr);
 }
 
+TEST_F(SVMMemoryAllocatorTest, givenSystemPointerWhenGettingSystemAllocationForGpuAccessThenAlignedRangeIsBoundOnceAndReused) {
+    if (!executionEnvironment.rootDeviceEnvironments[mockRootDeviceIndex]->isFullRangeSvm()) {
+        GTEST_SKIP();
+    }
+    auto rangeStart = reinterpret_cast<void *>(0x100000);
+
+    auto allocation = svmManager->getSystemAllocationForGpuAccess(ptrOffset(rangeStart, 0x1234), mockRootDeviceIndex, mockDeviceBitfield);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(rangeStart, allocation->getUnderlyingBuffer());
+    EXPECT_EQ(MemoryConstants::pageSize64k, allocation->getUnderlyingBufferSize());
+    EXPECT_EQ(castToUint64(rangeStart), allocation->getGpuAddress());
+
+    EXPECT_EQ(allocation, svmManager->getSystemAllocationForGpuAccess(ptrOffset(rangeStart, MemoryConstants::pageSize64k - 1), mockRootDeviceIndex, mockDeviceBitfield));
+    EXPECT_EQ(1u, svmManager->getNumSystemAllocations());
+
+    auto nextAllocation = svmManager->getSystemAllocationForGpuAccess(ptrOffset(rangeStart, MemoryConstants::pageSize64k), mockRootDeviceIndex, mockDeviceBitfield);
+    EXPECT_NE(allocation, nextAllocation);
+    EXPECT_EQ(2u, svmManager->getNumSystemAllocations());
+
+    svmManager->releaseSystemAllocations();
+    EXPECT_EQ(0u, svmManager->getNumSystemAllocations());
+}
+
+TEST_F(SVMMemoryAllocatorTest, givenBoundSystemPointerWhenSvmAllocationIsFreedThenRangeIsBoundAgainOnNextAccess) {
+    if (!executionEnvironment.rootDeviceEnvironments[mockRootDeviceIndex]->isFullRangeSvm()) {
+        GTEST_SKIP();
+    }
+    auto systemPointer = reinterpret_cast<void *>(0x100000);
+    auto allocation = svmManager->getSystemAllocationForGpuAccess(systemPointer, mockRootDeviceIndex, mockDeviceBitfield);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(allocation, svmManager->getSystemAllocationForGpuAccess(systemPointer, mockRootDeviceIndex, mockDeviceBitfield));
+
+    auto ptr = svmManager->createSVMAlloc(MemoryConstants::pageSize, {}, rootDeviceIndices, deviceBitfields);
+    ASSERT_NE(nullptr, ptr);
+    EXPECT_EQ(allocation, svmManager->getSystemAllocationForGpuAccess(systemPointer, mockRootDeviceIndex, mockDeviceBitfield));
+    svmManager->freeSVMAlloc(ptr);
+
+    auto reboundAllocation = svmManager->getSystemAllocationForGpuAccess(systemPointer, mockRootDeviceIndex, mockDeviceBitfield);
+    ASSERT_NE(nullptr, reboundAllocation);
+    EXPECT_EQ(systemPointer, reboundAllocation->getUnderlyingBuffer());
+    EXPECT_EQ(1u, svmManager->getNumSystemAllocations());
+
+    svmManager->releaseSystemAllocations();
+}
+
+TEST_F(SVMMemoryAllocatorTest, givenMaxSystemAllocationsBoundWhenNextRangeIsBoundThenLeastRecentlyUsedOneIsEvicted) {
+    if (!executionEnvironment.rootDeviceEnvironments[mockRootDeviceIndex]->isFullRangeSvm()) {
+        GTEST_SKIP();
+    }
+    auto rangeStart = reinterpret_cast<void *>(0x1000000);
+    GraphicsAllocation *firstAllocation = nullptr;
+    for (size_t i = 0; i < SVMAllocsManager::maxSystemAllocations; i++) {
+        auto allocation = svmManager->getSystemAllocationForGpuAccess(ptrOffset(rangeStart, i * MemoryConstants::pageSize64k), mockRootDeviceIndex, mockDeviceBitfield);
+        ASSERT_NE(nullptr, allocation);
+        if (i == 0) {
+            firstAllocation = allocation;
+        }
+    }
+    EXPECT_EQ(SVMAllocsManager::maxSystemAllocations, svmManager->getNumSystemAllocations());
+
+    // touching the first range makes the second one the least recently used
+    EXPECT_EQ(firstAllocation, svmManager->getSystemAllocationForGpuAccess(rangeStart, mockRootDeviceIndex, mockDeviceBitfield));
+    svmManager->getSystemAllocationForGpuAccess(ptrOffset(rangeStart, SVMAllocsManager::maxSystemAllocations * MemoryConstants::pageSize64k), mockRootDeviceIndex, mockDeviceBitfield);
+    EXPECT_EQ(SVMAllocsManager::maxSystemAllocations, svmManager->getNumSystemAllocations());
+    EXPECT_EQ(firstAllocation, svmManager->getSystemAllocationForGpuAccess(rangeStart, mockRootDeviceIndex, mockDeviceBitfield));
+
+    svmManager->releaseSystemAllocations();
+    EXPECT_EQ(0u, svmManager->getNumSystemAllocations());
+}
+
 TEST_F(SVMMemoryAllocatorTest, whenCouldNotAllocateInMemoryManagerThenCreateUnifiedMemoryAllocationReturnsNullAndDoesNotChangeAllocsMap) {
     FailMemoryManager failMemoryManager(executionEnvironment);
     svmManager->memoryManager = &failMemoryManager;
@@ -1198,3 +1292,94 @@ HWTEST_F(UnfiedSharedMemoryHWTest, givenSharedUsmAllocationWhenReadBufferThenCpu
     delete buffer;
     clMemFreeINTEL(&mockContext, sharedMemory);
 }
+
+struct UnifiedMemoryPoolTest : public ::testing::Test {
+    void SetUp() override {
+        DebugManager.flags.EnableDeviceUsmAllocationPool.set(1);
+        device.reset(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
+        svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+        deviceBitfields = {{device->getRootDeviceIndex(), device->getDeviceBitfield()}};
+        rootDeviceIndices = {device->getRootDeviceIndex()};
+    }
+
+    void *allocateDeviceMemory(size_t size) {
+        SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::DEVICE_UNIFIED_MEMORY, rootDeviceIndices, deviceBitfields);
+        unifiedMemoryProperties.device = device.get();
+        return svmManager->createUnifiedMemoryAllocation(size, unifiedMemoryProperties);
+    }
+
+    DebugManagerStateRestore restore;
+    std::unique_ptr<MockDevice> device;
+    std::set<uint32_t> rootDeviceIndices;
+    std::map<uint32_t, DeviceBitfield> deviceBitfields;
+    std::unique_ptr<MockSVMAllocsManager> svmManager;
+};
+
+TEST(UnifiedMemoryPoolSizeClassTest, whenGettingSizeClassThenSizeIsRoundedUpToPowerOfTwoNotSmallerThanMinimum) {
+    EXPECT_EQ(UnifiedMemoryPool::minSizeClass, UnifiedMemoryPool::getSizeClass(1u));
+    EXPECT_EQ(UnifiedMemoryPool::minSizeClass, UnifiedMemoryPool::getSizeClass(UnifiedMemoryPool::minSizeClass));
+    EXPECT_EQ(2 * UnifiedMemoryPool::minSizeClass, UnifiedMemoryPool::getSizeClass(UnifiedMemoryPool::minSizeClass + 1));
+    EXPECT_EQ(UnifiedMemoryPool::maxSizeClass, UnifiedMemoryPool::getSizeClass(UnifiedMemoryPool::maxSizeClass));
+    EXPECT_FALSE(UnifiedMemoryPool::isPoolableSize(0u));
+    EXPECT_FALSE(UnifiedMemoryPool::isPoolableSize(UnifiedMemoryPool::maxSizeClass + 1));
+}
+
+TEST_F(UnifiedMemoryPoolTest, givenPoolEnabledWhenAllocatingSmallDeviceMemoryThenAllocationsShareChunkAndSvmDataDescribesSubAllocation) {
+    auto ptr1 = allocateDeviceMemory(4096u);
+    auto ptr2 = allocateDeviceMemory(100u);
+    ASSERT_NE(nullptr, ptr1);
+    ASSERT_NE(nullptr, ptr2);
+    EXPECT_NE(ptr1, ptr2);
+
+    auto svmData1 = svmManager->getSVMAlloc(ptr1);
+    auto svmData2 = svmManager->getSVMAlloc(ptrOffset(ptr2, 50u));
+    ASSERT_NE(nullptr, svmData1);
+    ASSERT_NE(nullptr, svmData2);
+    EXPECT_TRUE(svmData1->isPooled());
+    EXPECT_TRUE(svmData2->isPooled());
+    EXPECT_EQ(svmData1->gpuAllocations.getDefaultGraphicsAllocation(), svmData2->gpuAllocations.getDefaultGraphicsAllocation());
+    EXPECT_EQ(castToUint64(ptr1), svmData1->getGpuAddress());
+    EXPECT_EQ(castToUint64(ptr2), svmData2->getGpuAddress());
+    EXPECT_EQ(4096u, svmData1->size);
+    EXPECT_EQ(100u, svmData2->size);
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(ptrOffset(ptr2, 100u)));
+    EXPECT_EQ(2u, svmManager->getNumAllocs());
+
+    EXPECT_TRUE(svmManager->freeSVMAlloc(ptr1));
+    EXPECT_TRUE(svmManager->freeSVMAlloc(ptr2));
+    EXPECT_EQ(0u, svmManager->getNumAllocs());
+}
+
+TEST_F(UnifiedMemoryPoolTest, givenFreedSubAllocationStillUsedByGpuWhenAllocatingThenSlotIsReusedOnlyAfterTaskCountCompletes) {
+    auto ptr = allocateDeviceMemory(4096u);
+    ASSERT_NE(nullptr, ptr);
+    auto &engine = device->getDefaultEngine();
+    auto chunk = svmManager->getSVMAlloc(ptr)->gpuAllocations.getDefaultGraphicsAllocation();
+    auto tagValue = *engine.commandStreamReceiver->getTagAddress();
+    chunk->updateTaskCount(tagValue + 1, engine.osContext->getContextId());
+
+    EXPECT_TRUE(svmManager->freeSVMAlloc(ptr));
+    auto busySlotPtr = allocateDeviceMemory(4096u);
+    EXPECT_NE(ptr, busySlotPtr);
+
+    *engine.commandStreamReceiver->getTagAddress() = tagValue + 1;
+    auto reusedPtr = allocateDeviceMemory(4096u);
+    EXPECT_EQ(ptr, reusedPtr);
+
+    svmManager->freeSVMAlloc(busySlotPtr);
+    svmManager->freeSVMAlloc(reusedPtr);
+}
+
+TEST_F(UnifiedMemoryPoolTest, givenPoolDisabledOrLargeAllocationWhenAllocatingDeviceMemoryThenAllocationIsNotPooled) {
+    auto largePtr = allocateDeviceMemory(UnifiedMemoryPool::maxSizeClass + 1);
+    ASSERT_NE(nullptr, largePtr);
+    EXPECT_FALSE(svmManager->getSVMAlloc(largePtr)->isPooled());
+
+    DebugManager.flags.EnableDeviceUsmAllocationPool.set(-1);
+    auto smallPtr = allocateDeviceMemory(4096u);
+    ASSERT_NE(nullptr, smallPtr);
+    EXPECT_FALSE(svmManager->getSVMAlloc(smallPtr)->isPooled());
+
+    svmManager->freeSVMAlloc(largePtr);
+    svmManager->freeSVMAlloc(smallPtr);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,6 +27,7 @@ class MockHandler : public AsyncEventsHandler {
     using AsyncEventsHandler::asyncProcess;
     using AsyncEventsHandler::openThread;
     using AsyncEventsHandler::thread;
+    using AsyncEventsHandler::wakeUpRequested;
 
     ~MockHandler() override {
         if (!allowThreadCreating) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -57,6 +57,10 @@ struct MockAubFileStream : public AUBCommandStreamReceiver::AubFileStream {
         addCommentCalled = true;
         return true;
     }
+    void writeMemory(uint64_t physAddress, const void *memory, size_t size, uint32_t addressSpace, uint32_t hint) override {
+        writeMemoryCalledCnt++;
+        AUBCommandStreamReceiver::AubFileStream::writeMemory(physAddress, memory, size, addressSpace, hint);
+    }
     void registerPoll(uint32_t registerOffset, uint32_t mask, uint32_t value, bool pollNotEqual, uint32_t timeoutAction) override {
         registerPollCalled = true;
         AUBCommandStreamReceiver::AubFileStream::registerPoll(registerOffset, mask, value, pollNotEqual, timeoutAction);
@@ -68,6 +72,7 @@ struct MockAubFileStream : public AUBCommandStreamReceiver::AubFileStream {
     mutable bool isOpenCalled = false;
     mutable bool getFileNameCalled = false;
     bool registerPollCalled = false;
+    uint32_t writeMemoryCalledCnt = 0;
     bool addCommentCalled = false;
     std::string receivedComment = "";
     bool flushCalled = false;
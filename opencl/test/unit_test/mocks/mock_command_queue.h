@@ -202,12 +202,17 @@ class MockCommandQueueHw : public CommandQueueHw<GfxFamily> {
     using BaseClass::blitEnqueueAllowed;
     using BaseClass::commandQueueProperties;
     using BaseClass::commandStream;
+    using BaseClass::deferredPrintfOutputs;
     using BaseClass::gpgpuEngine;
     using BaseClass::isBlitAuxTranslationRequired;
+    using BaseClass::isCopyOnly;
+    using BaseClass::isCpuDetilingForMapAllowed;
     using BaseClass::latestSentEnqueueType;
     using BaseClass::obtainCommandStream;
     using BaseClass::obtainNewTimestampPacketNodes;
     using BaseClass::requiresCacheFlushAfterWalker;
+    using BaseClass::stagingBuffers;
+    using BaseClass::svmMemcpyCpuCopyAllowed;
     using BaseClass::throttle;
     using BaseClass::timestampPacketContainer;
 
@@ -310,8 +315,8 @@ class MockCommandQueueHw : public CommandQueueHw<GfxFamily> {
         return BaseClass::isCacheFlushForBcsRequired();
     }
 
-    bool blitEnqueueImageAllowed(const size_t *origin, const size_t *region) override {
-        isBlitEnqueueImageAllowed = BaseClass::blitEnqueueImageAllowed(origin, region);
+    bool blitEnqueueImageAllowed(const size_t *origin, const size_t *region, const Image &image) override {
+        isBlitEnqueueImageAllowed = BaseClass::blitEnqueueImageAllowed(origin, region, image);
         return isBlitEnqueueImageAllowed;
     }
 
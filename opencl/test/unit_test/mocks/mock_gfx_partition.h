@@ -26,6 +26,10 @@ class MockGfxPartition : public GfxPartition {
         return getHeapSize(heapIndex) > 0;
     }
 
+    bool heapAllocatorCreated(HeapIndex heapIndex) {
+        return getHeap(heapIndex).isAllocatorCreated();
+    }
+
     void *getReservedCpuAddressRange() {
         return reservedCpuAddressRange.alignedPtr;
     }
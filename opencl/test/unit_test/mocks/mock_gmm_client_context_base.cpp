@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,10 +10,12 @@
 namespace NEO {
 
 GMM_RESOURCE_INFO *MockGmmClientContextBase::createResInfoObject(GMM_RESCREATE_PARAMS *pCreateParams) {
+    createResInfoObjectCalled++;
     return reinterpret_cast<GMM_RESOURCE_INFO *>(new char[1]);
 }
 
 GMM_RESOURCE_INFO *MockGmmClientContextBase::copyResInfoObject(GMM_RESOURCE_INFO *pSrcRes) {
+    copyResInfoObjectCalled++;
     return reinterpret_cast<GMM_RESOURCE_INFO *>(new char[1]);
 }
 
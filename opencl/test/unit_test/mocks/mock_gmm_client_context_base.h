@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -22,6 +22,8 @@ class MockGmmClientContextBase : public GmmClientContext {
     uint8_t compressionFormatToReturn = 1;
     uint32_t getSurfaceStateCompressionFormatCalled = 0u;
     uint32_t getMediaSurfaceStateCompressionFormatCalled = 0u;
+    uint32_t createResInfoObjectCalled = 0u;
+    uint32_t copyResInfoObjectCalled = 0u;
 
   protected:
     using GmmClientContext::GmmClientContext;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -18,8 +18,10 @@ extern uint32_t mockFopenCalled;
 extern uint32_t mockVfptrinfCalled;
 extern uint32_t mockFcloseCalled;
 extern uint32_t mockGetenvCalled;
+extern uint32_t mockGetEnvironmentCalled;
 
 extern std::unordered_map<std::string, std::string> *mockableEnvValues;
+extern char **mockableEnvironment;
 
 inline FILE *mockFopen(const char *filename, const char *mode) {
     mockFopenCalled++;
@@ -44,5 +46,10 @@ inline char *mockGetenv(const char *name) noexcept {
     return nullptr;
 }
 
+inline char **mockGetEnvironment() {
+    mockGetEnvironmentCalled++;
+    return mockableEnvironment;
+}
+
 } // namespace IoFunctions
 } // namespace NEO
@@ -15,6 +15,8 @@
 
 #include "gmock/gmock.h"
 
+#include <atomic>
+
 namespace NEO {
 
 template <class T>
@@ -133,7 +135,7 @@ class MockMemoryManager : public MemoryManagerCreate<OsAgnosticMemoryManager> {
 
     void forceLimitedRangeAllocator(uint32_t rootDeviceIndex, uint64_t range) { getGfxPartition(rootDeviceIndex)->init(range, 0, 0, gfxPartitions.size()); }
 
-    uint32_t freeGraphicsMemoryCalled = 0u;
+    std::atomic<uint32_t> freeGraphicsMemoryCalled{0u};
     uint32_t unlockResourceCalled = 0u;
     uint32_t lockResourceCalled = 0u;
     AllocationData alignAllocationData;
@@ -41,6 +41,7 @@ class MockProgram : public Program {
     using Program::areSpecializationConstantsInitialized;
     using Program::blockKernelManager;
     using Program::buildInfos;
+    using Program::buildInProgress;
     using Program::context;
     using Program::createdFrom;
     using Program::debugData;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,6 +23,7 @@ class MockTbxSockets : public TbxSockets {
     bool readMemory(uint64_t offset, void *data, size_t size) override { return true; };
     bool writeMemory(uint64_t offset, const void *data, size_t size, uint32_t type) override {
         typeCapturedFromWriteMemory = type;
+        writeMemoryCalledCnt++;
         return true;
     };
 
@@ -30,5 +31,6 @@ class MockTbxSockets : public TbxSockets {
     bool writeMMIO(uint32_t offset, uint32_t data) override { return true; };
 
     uint32_t typeCapturedFromWriteMemory = 0;
+    uint32_t writeMemoryCalledCnt = 0;
 };
 } // namespace NEO
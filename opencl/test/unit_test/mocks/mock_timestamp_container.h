@@ -47,7 +47,7 @@ class MockTimestampPacketContainer : public TimestampPacketContainer {
     }
 
     TagNode<TimestampPacketStorage> *getNode(size_t position) {
-        return timestampPacketNodes.at(position);
+        return timestampPacketNodes[position];
     }
 };
 } // namespace NEO
@@ -174,6 +174,9 @@ bool WddmMock::submit(uint64_t commandBuffer, size_t size, void *commandHeader,
     submitResult.size = size;
     submitResult.commandHeaderSubmitted = commandHeader;
     submitResult.submitArgs = submitArguments;
+    if (forceSubmitFailure) {
+        return submitResult.success = false;
+    }
     return submitResult.success = Wddm::submit(commandBuffer, size, commandHeader, submitArguments);
 }
 
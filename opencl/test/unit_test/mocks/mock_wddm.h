@@ -163,6 +163,7 @@ class WddmMock : public Wddm {
     bool callBaseMakeResident = true;
     bool callBaseCreatePagingLogger = true;
     bool shutdownStatus = false;
+    bool forceSubmitFailure = false;
 };
 
 struct GmockWddm : WddmMock {
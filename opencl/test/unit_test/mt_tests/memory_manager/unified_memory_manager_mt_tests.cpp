@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/unified_memory_manager.h"
+#include "shared/test/common/mocks/mock_graphics_allocation.h"
+
+#include "opencl/test/unit_test/mocks/mock_execution_environment.h"
+#include "opencl/test/unit_test/mocks/mock_memory_manager.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+TEST(SvmAllocsManagerMtTest, givenConcurrentLookupsAndUpdatesWhenGettingSvmAllocThenLookedUpAllocationsAreAlwaysFound) {
+    constexpr size_t allocationSize = MemoryConstants::pageSize;
+    constexpr uint64_t stableBase = 0x100000;
+    constexpr uint64_t volatileBase = 0x10000000;
+    constexpr uint32_t numStableAllocations = 16;
+    constexpr uint32_t numReaders = 4;
+    constexpr uint32_t numUpdates = 1000;
+
+    MockExecutionEnvironment executionEnvironment;
+    MockMemoryManager memoryManager(executionEnvironment);
+    SVMAllocsManager svmManager(&memoryManager, false);
+
+    std::vector<std::unique_ptr<MockGraphicsAllocation>> graphicsAllocations;
+    for (uint32_t i = 0; i < numStableAllocations; i++) {
+        graphicsAllocations.push_back(std::make_unique<MockGraphicsAllocation>(nullptr, stableBase + i * allocationSize, allocationSize));
+        SvmAllocationData svmData(0u);
+        svmData.gpuAllocations.addAllocation(graphicsAllocations.back().get());
+        svmData.size = allocationSize;
+        svmManager.insertSVMAlloc(svmData);
+    }
+    MockGraphicsAllocation volatileAllocation(nullptr, volatileBase, allocationSize);
+    SvmAllocationData volatileSvmData(0u);
+    volatileSvmData.gpuAllocations.addAllocation(&volatileAllocation);
+    volatileSvmData.size = allocationSize;
+
+    std::atomic<bool> stop{false};
+    std::atomic<uint32_t> missedLookups{0u};
+    std::vector<std::thread> readers;
+    for (uint32_t reader = 0; reader < numReaders; reader++) {
+        readers.emplace_back([&] {
+            while (!stop) {
+                for (uint32_t i = 0; i < numStableAllocations; i++) {
+                    auto ptr = reinterpret_cast<void *>(stableBase + i * allocationSize + allocationSize / 2);
+                    auto svmData = svmManager.getSVMAlloc(ptr);
+                    if (svmData == nullptr || svmData->gpuAllocations.getDefaultGraphicsAllocation() != graphicsAllocations[i].get()) {
+                        missedLookups++;
+                    }
+                }
+            }
+        });
+    }
+
+    for (uint32_t i = 0; i < numUpdates; i++) {
+        svmManager.insertSVMAlloc(volatileSvmData);
+        svmManager.removeSVMAlloc(volatileSvmData);
+    }
+    stop = true;
+    for (auto &reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(0u, missedLookups.load());
+    EXPECT_EQ(numStableAllocations, svmManager.getNumAllocs());
+}
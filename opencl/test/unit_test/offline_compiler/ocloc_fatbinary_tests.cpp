@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -360,4 +360,23 @@ TEST_F(OclocFatBinaryGetTargetPlatformsForFatbinary, GivenGenClosedRangeWhenAnyO
     got = NEO::getTargetPlatformsForFatbinary(genName + "-gen2", oclocArgHelperWithoutInput.get());
     EXPECT_TRUE(got.empty());
 }
+
+TEST(OclocFatBinaryParseJobsCount, GivenPositiveNumberThenJobsCountIsParsed) {
+    uint32_t jobsCount = 0u;
+    EXPECT_TRUE(NEO::parseFatbinaryJobsCount("1", jobsCount));
+    EXPECT_EQ(1u, jobsCount);
+    EXPECT_TRUE(NEO::parseFatbinaryJobsCount("16", jobsCount));
+    EXPECT_EQ(16u, jobsCount);
+}
+
+TEST(OclocFatBinaryParseJobsCount, GivenInvalidNumberThenFalseIsReturnedAndJobsCountIsNotChanged) {
+    uint32_t jobsCount = 3u;
+    EXPECT_FALSE(NEO::parseFatbinaryJobsCount("", jobsCount));
+    EXPECT_FALSE(NEO::parseFatbinaryJobsCount("0", jobsCount));
+    EXPECT_FALSE(NEO::parseFatbinaryJobsCount("-2", jobsCount));
+    EXPECT_FALSE(NEO::parseFatbinaryJobsCount("4a", jobsCount));
+    EXPECT_FALSE(NEO::parseFatbinaryJobsCount("100000", jobsCount));
+    EXPECT_EQ(3u, jobsCount);
+}
+
 } // namespace NEO
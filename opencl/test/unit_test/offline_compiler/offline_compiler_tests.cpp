@@ -104,6 +104,102 @@ TEST_F(MultiCommandTests, GivenOutputFileWhenBuildingMultiCommandThenSuccessIsRe
 
     deleteFileWithArgs();
 }
+TEST_F(MultiCommandTests, GivenJobsCountWhenBuildingMultiCommandThenAllBuildsSucceedAndOutputFileListKeepsLineOrder) {
+    nameOfFileWithArgs = "test_files/ImAMulitiComandMinimalGoodFile.txt";
+    std::vector<std::string> argv = {
+        "ocloc",
+        "multi",
+        nameOfFileWithArgs.c_str(),
+        "-q",
+        "-j",
+        "3",
+        "-output_file_list",
+        "outFileList.txt",
+    };
+
+    std::vector<std::string> singleArgs = {
+        "-file",
+        "test_files/copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str()};
+
+    int numOfBuild = 4;
+    createFileWithArgs(singleArgs, numOfBuild);
+
+    pMultiCommand = MultiCommand::create(argv, retVal, oclocArgHelperWithoutInput.get());
+
+    EXPECT_NE(nullptr, pMultiCommand);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    outFileList = pMultiCommand->outputFileList;
+
+    std::vector<std::string> outputs;
+    oclocArgHelperWithoutInput->readFileToVectorOfStrings(outFileList, outputs);
+    ASSERT_EQ(static_cast<size_t>(numOfBuild), outputs.size());
+    for (int i = 0; i < numOfBuild; i++) {
+        std::string outFileName = pMultiCommand->outDirForBuilds + "/build_no_" + std::to_string(i + 1);
+        EXPECT_TRUE(compilerOutputExists(outFileName, "bin"));
+        EXPECT_NE(std::string::npos, outputs[i].find("build_no_" + std::to_string(i + 1) + ".bin"));
+    }
+
+    deleteFileWithArgs();
+    deleteOutFileList();
+    delete pMultiCommand;
+}
+TEST_F(MultiCommandTests, GivenJobsCountWhenBuildingMultiCommandThenMessagesOfEachLineArePrintedInLineOrder) {
+    nameOfFileWithArgs = "test_files/ImAMulitiComandMinimalGoodFile.txt";
+    std::vector<std::string> argv = {
+        "ocloc",
+        "multi",
+        nameOfFileWithArgs.c_str(),
+        "-j",
+        "2"};
+
+    std::vector<std::string> singleArgs = {
+        "-file",
+        "test_files/copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str()};
+
+    int numOfBuild = 2;
+    createFileWithArgs(singleArgs, numOfBuild);
+
+    testing::internal::CaptureStdout();
+    pMultiCommand = MultiCommand::create(argv, retVal, oclocArgHelperWithoutInput.get());
+    std::string output = testing::internal::GetCapturedStdout();
+
+    EXPECT_NE(nullptr, pMultiCommand);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    auto firstCommand = output.find("Command numer 1:");
+    auto firstResult = output.find("Build succeeded.", firstCommand);
+    auto secondCommand = output.find("Command numer 2:");
+    auto secondResult = output.find("Build succeeded.", secondCommand);
+    ASSERT_NE(std::string::npos, firstCommand);
+    ASSERT_NE(std::string::npos, secondCommand);
+    EXPECT_LT(firstResult, secondCommand);
+    EXPECT_NE(std::string::npos, secondResult);
+
+    deleteFileWithArgs();
+    delete pMultiCommand;
+}
+TEST_F(MultiCommandTests, GivenInvalidJobsCountWhenBuildingMultiCommandThenInvalidCommandLineErrorIsReturned) {
+    nameOfFileWithArgs = "test_files/ImAMulitiComandMinimalGoodFile.txt";
+    std::vector<std::string> argv = {
+        "ocloc",
+        "multi",
+        nameOfFileWithArgs.c_str(),
+        "-q",
+        "-j",
+        "0"};
+
+    testing::internal::CaptureStdout();
+    auto pMultiCommand = std::unique_ptr<MultiCommand>(MultiCommand::create(argv, retVal, oclocArgHelperWithoutInput.get()));
+    std::string output = testing::internal::GetCapturedStdout();
+
+    EXPECT_EQ(nullptr, pMultiCommand);
+    EXPECT_EQ(OfflineCompiler::ErrorCode::INVALID_COMMAND_LINE, retVal);
+    EXPECT_NE(std::string::npos, output.find("Invalid number of jobs"));
+}
 TEST_F(MultiCommandTests, GivenSpecifiedOutputDirWhenBuildingMultiCommandThenSuccessIsReturned) {
     nameOfFileWithArgs = "test_files/ImAMulitiComandMinimalGoodFile.txt";
     std::vector<std::string> argv = {
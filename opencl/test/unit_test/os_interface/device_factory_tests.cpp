@@ -24,7 +24,9 @@
 
 #include "hw_device_id.h"
 
+#include <algorithm>
 #include <set>
+#include <thread>
 
 using namespace NEO;
 
@@ -336,6 +338,19 @@ TEST(DiscoverDevices, whenDiscoverDevicesAndForceDeviceIdIsDifferentFromTheExist
     EXPECT_FALSE(result);
 }
 
+TEST(DeviceFactoryRootDeviceInitializationTest, givenMultipleRootDevicesWhenGettingInitializationWorkersCountThenOneWorkerPerRootDeviceIsUsed) {
+    auto maxWorkers = std::max(std::thread::hardware_concurrency(), 1u);
+    EXPECT_EQ(1u, DeviceFactory::getRootDeviceInitializationWorkersCount(1u));
+    EXPECT_EQ(std::min(8u, maxWorkers), DeviceFactory::getRootDeviceInitializationWorkersCount(8u));
+}
+
+TEST(DeviceFactoryRootDeviceInitializationTest, givenParallelRootDeviceInitializationDisabledWhenGettingInitializationWorkersCountThenSingleWorkerIsUsed) {
+    DebugManagerStateRestore stateRestore;
+    DebugManager.flags.ParallelRootDeviceInitialization.set(0);
+
+    EXPECT_EQ(1u, DeviceFactory::getRootDeviceInitializationWorkersCount(8u));
+}
+
 using UltDeviceFactoryTest = DeviceFactoryTest;
 
 TEST_F(UltDeviceFactoryTest, givenExecutionEnvironmentWhenCreatingUltDeviceFactoryThenMockMemoryManagerIsAllocated) {
@@ -119,4 +119,46 @@ TEST_F(DebugEnvReaderTests, givenEnvironmentVariableReaderWhenCreateOsReaderWith
     std::unique_ptr<SettingsReader> evr(SettingsReader::createOsReader(false, ""));
     EXPECT_NE(nullptr, evr);
 }
+
+TEST(DebugEnvReaderSnapshotTests, givenOsReaderWhenReadingSettingThenEnvironmentIsNotSnapshotted) {
+    char *environment[] = {nullptr};
+    VariableBackup<char **> mockableEnvironmentBackup(&IoFunctions::mockableEnvironment, environment);
+    VariableBackup<uint32_t> mockGetEnvironmentCalledBackup(&IoFunctions::mockGetEnvironmentCalled, 0);
+    VariableBackup<uint32_t> mockGetenvCalledBackup(&IoFunctions::mockGetenvCalled, 0);
+
+    std::unique_ptr<SettingsReader> reader(SettingsReader::createOsReader(false, ""));
+    EXPECT_EQ(5, reader->getSetting("UnsetVariable", 5));
+    EXPECT_EQ(0u, IoFunctions::mockGetEnvironmentCalled);
+    EXPECT_EQ(1u, IoFunctions::mockGetenvCalled);
+
+    reader.reset(SettingsReader::createOsReaderForDebugVariables(""));
+    EXPECT_EQ(5, reader->getSetting("UnsetVariable", 5));
+    EXPECT_EQ(1u, IoFunctions::mockGetEnvironmentCalled);
+    EXPECT_EQ(1u, IoFunctions::mockGetenvCalled);
+}
+
+TEST(DebugEnvReaderSnapshotTests, givenEnvironmentSnapshotWhenReadingSettingsThenValuesAreReadWithoutGetenvCalls) {
+    char variable[] = "TestingVariable=1234";
+    char stringVariable[] = "TestingStringVariable=a=b";
+    char *environment[] = {variable, stringVariable, nullptr};
+    VariableBackup<char **> mockableEnvironmentBackup(&IoFunctions::mockableEnvironment, environment);
+    VariableBackup<uint32_t> mockGetenvCalledBackup(&IoFunctions::mockGetenvCalled, 0);
+
+    EnvironmentVariableReader reader(true);
+    environment[0] = nullptr;
+
+    EXPECT_EQ(1234, reader.getSetting("TestingVariable", 1));
+    EXPECT_EQ("a=b", reader.getSetting("TestingStringVariable", std::string("default")));
+    EXPECT_EQ(5, reader.getSetting("UnsetVariable", 5));
+    EXPECT_EQ(0u, IoFunctions::mockGetenvCalled);
+}
+
+TEST(DebugEnvReaderSnapshotTests, givenEnvironmentNotAvailableWhenReadingSettingsThenGetenvIsUsed) {
+    VariableBackup<char **> mockableEnvironmentBackup(&IoFunctions::mockableEnvironment, nullptr);
+    VariableBackup<uint32_t> mockGetenvCalledBackup(&IoFunctions::mockGetenvCalled, 0);
+
+    EnvironmentVariableReader reader(true);
+    EXPECT_EQ(5, reader.getSetting("UnsetVariable", 5));
+    EXPECT_EQ(1u, IoFunctions::mockGetenvCalled);
+}
 } // namespace NEO
@@ -55,6 +55,7 @@ class DrmBufferObjectFixture {
         this->mock = std::make_unique<DrmMockCustom>();
         ASSERT_NE(nullptr, this->mock);
         osContext.reset(new OsContextLinux(*this->mock, 0u, 1, EngineTypeUsage{aub_stream::ENGINE_RCS, EngineUsage::Regular}, PreemptionMode::Disabled, false));
+        osContext->ensureContextInitialized();
         this->mock->reset();
         bo = new TestedBufferObject(this->mock.get());
         ASSERT_NE(nullptr, bo);
@@ -91,6 +92,70 @@ TEST_F(DrmBufferObjectTest, GivenInvalidParamsWhenCallingExecThenEfaultIsReturne
     EXPECT_EQ(EFAULT, bo->exec(0, 0, 0, false, osContext.get(), 0, 1, nullptr, 0u, &execObjectsStorage));
 }
 
+TEST_F(DrmBufferObjectTest, givenExecObjectFilledInPreviousExecWhenExecIsCalledWithReuseOfFilledExecObjectsThenExecObjectIsNotFilledAgain) {
+    mock->ioctl_expected.total = 2;
+    mock->ioctl_res = 0;
+
+    TestedBufferObject residentBo(this->mock.get());
+    residentBo.setAddress(0x1000);
+    BufferObject *residency[] = {&residentBo};
+    drm_i915_gem_exec_object2 execObjects[2] = {};
+
+    EXPECT_EQ(0, bo->exec(0, 0, 0, false, osContext.get(), 0, 1, residency, 1u, execObjects, true));
+    EXPECT_EQ(&execObjects[0], residentBo.execObjectPointerFilled);
+    EXPECT_TRUE(residentBo.isExecObjectFilled(execObjects[0], 1u));
+
+    residentBo.execObjectPointerFilled = nullptr;
+    EXPECT_EQ(0, bo->exec(0, 0, 0, false, osContext.get(), 0, 1, residency, 1u, execObjects, true));
+    EXPECT_EQ(nullptr, residentBo.execObjectPointerFilled);
+    EXPECT_EQ(&execObjects[1], bo->execObjectPointerFilled);
+}
+
+TEST_F(DrmBufferObjectTest, givenExecObjectFilledForDifferentBufferObjectOrContextWhenCheckingIfExecObjectIsFilledThenFalseIsReturned) {
+    TestedBufferObject residentBo(this->mock.get());
+    residentBo.setAddress(0x1000);
+    drm_i915_gem_exec_object2 execObject = {};
+
+    residentBo.fillExecObject(execObject, osContext.get(), 0, 1);
+    EXPECT_TRUE(residentBo.isExecObjectFilled(execObject, 1u));
+    EXPECT_FALSE(residentBo.isExecObjectFilled(execObject, 2u));
+
+    residentBo.setAddress(0x2000);
+    EXPECT_FALSE(residentBo.isExecObjectFilled(execObject, 1u));
+}
+
+TEST_F(DrmBufferObjectTest, givenExecObjectFilledBeforeFlagsChangedWhenCheckingIfExecObjectIsFilledThenFalseIsReturned) {
+    DebugManagerStateRestore restorer;
+    TestedBufferObject residentBo(this->mock.get());
+    residentBo.setAddress(0x1000);
+    drm_i915_gem_exec_object2 execObject = {};
+
+    residentBo.fillExecObject(execObject, osContext.get(), 0, 1);
+    EXPECT_TRUE(residentBo.isExecObjectFilled(execObject, 1u));
+
+    residentBo.markForCapture();
+    EXPECT_FALSE(residentBo.isExecObjectFilled(execObject, 1u));
+    residentBo.fillExecObject(execObject, osContext.get(), 0, 1);
+    EXPECT_TRUE(residentBo.isExecObjectFilled(execObject, 1u));
+
+    DebugManager.flags.UseAsyncDrmExec.set(1);
+    EXPECT_FALSE(residentBo.isExecObjectFilled(execObject, 1u));
+}
+
+TEST_F(DrmBufferObjectTest, givenExecObjectFilledInPreviousExecWhenExecIsCalledWithoutReuseOfFilledExecObjectsThenExecObjectIsFilledAgain) {
+    mock->ioctl_expected.total = 2;
+    mock->ioctl_res = 0;
+
+    TestedBufferObject residentBo(this->mock.get());
+    BufferObject *residency[] = {&residentBo};
+    drm_i915_gem_exec_object2 execObjects[2] = {};
+
+    EXPECT_EQ(0, bo->exec(0, 0, 0, false, osContext.get(), 0, 1, residency, 1u, execObjects));
+    residentBo.execObjectPointerFilled = nullptr;
+    EXPECT_EQ(0, bo->exec(0, 0, 0, false, osContext.get(), 0, 1, residency, 1u, execObjects));
+    EXPECT_EQ(&execObjects[0], residentBo.execObjectPointerFilled);
+}
+
 TEST_F(DrmBufferObjectTest, WhenSettingTilingThenCallSucceeds) {
     mock->ioctl_expected.total = 1; //set_tiling
     auto ret = bo->setTiling(I915_TILING_X, 0);
@@ -234,6 +299,7 @@ TEST(DrmBufferObjectSimpleTest, givenInvalidBoWhenValidateHostptrIsCalledThenErr
     std::unique_ptr<uint32_t[]> buff(new uint32_t[256]);
     std::unique_ptr<DrmMockCustom> mock(new DrmMockCustom);
     OsContextLinux osContext(*mock, 0u, 1, EngineTypeUsage{aub_stream::ENGINE_RCS, EngineUsage::Regular}, PreemptionMode::Disabled, false);
+    osContext.ensureContextInitialized();
     ASSERT_NE(nullptr, mock.get());
     std::unique_ptr<TestedBufferObject> bo(new TestedBufferObject(mock.get()));
     ASSERT_NE(nullptr, bo.get());
@@ -257,6 +323,7 @@ TEST(DrmBufferObjectSimpleTest, givenInvalidBoWhenPinIsCalledThenErrorIsReturned
     std::unique_ptr<uint32_t[]> buff(new uint32_t[256]);
     std::unique_ptr<DrmMockCustom> mock(new DrmMockCustom);
     OsContextLinux osContext(*mock, 0u, 1, EngineTypeUsage{aub_stream::ENGINE_RCS, EngineUsage::Regular}, PreemptionMode::Disabled, false);
+    osContext.ensureContextInitialized();
     ASSERT_NE(nullptr, mock.get());
     std::unique_ptr<TestedBufferObject> bo(new TestedBufferObject(mock.get()));
     ASSERT_NE(nullptr, bo.get());
@@ -288,6 +355,7 @@ TEST(DrmBufferObjectSimpleTest, givenArrayOfBosWhenPinnedThenAllBosArePinned) {
     std::unique_ptr<DrmMockCustom> mock(new DrmMockCustom);
     ASSERT_NE(nullptr, mock.get());
     OsContextLinux osContext(*mock, 0u, 1, EngineTypeUsage{aub_stream::ENGINE_RCS, EngineUsage::Regular}, PreemptionMode::Disabled, false);
+    osContext.ensureContextInitialized();
 
     std::unique_ptr<TestedBufferObject> bo(new TestedBufferObject(mock.get()));
     ASSERT_NE(nullptr, bo.get());
@@ -321,6 +389,7 @@ TEST(DrmBufferObjectSimpleTest, givenArrayOfBosWhenValidatedThenAllBosArePinned)
     std::unique_ptr<DrmMockCustom> mock(new DrmMockCustom);
     ASSERT_NE(nullptr, mock.get());
     OsContextLinux osContext(*mock, 0u, 1, EngineTypeUsage{aub_stream::ENGINE_RCS, EngineUsage::Regular}, PreemptionMode::Disabled, false);
+    osContext.ensureContextInitialized();
 
     std::unique_ptr<TestedBufferObject> bo(new TestedBufferObject(mock.get()));
     ASSERT_NE(nullptr, bo.get());
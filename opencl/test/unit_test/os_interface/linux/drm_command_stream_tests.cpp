@@ -235,6 +235,7 @@ HWTEST_TEMPLATED_F(DrmCommandStreamTest, givenDrmContextIdWhenFlushingThenSetIdT
                                                  HwHelper::get(defaultHwInfo->platform.eRenderCoreFamily).getGpgpuEngineInstances(*defaultHwInfo)[0],
                                                  PreemptionHelper::getDefaultPreemptionMode(*defaultHwInfo),
                                                  false);
+    osContext->ensureContextInitialized();
     csr->setupContext(*osContext);
 
     auto &cs = csr->getCS();
@@ -578,6 +579,72 @@ HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenTaskThatRequiresLargeResou
     EXPECT_EQ(11u, execStorage.size());
 }
 
+HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenResidencySkippedForExecWhenFlushIsCalledThenOnlyCommandBufferIsPassedToExec) {
+    auto testedCsr = static_cast<TestedDrmCommandStreamReceiver<FamilyType> *>(csr);
+    testedCsr->skipResidencyForExec = true;
+
+    auto allocation = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize});
+    csr->makeResident(*allocation);
+    auto commandBuffer = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize});
+
+    LinearStream cs(commandBuffer);
+
+    CommandStreamReceiverHw<FamilyType>::addBatchBufferEnd(cs, nullptr);
+    CommandStreamReceiverHw<FamilyType>::alignToCacheLine(cs);
+    BatchBuffer batchBuffer{cs.getGraphicsAllocation(), 0, 0, nullptr, false, false, QueueThrottle::MEDIUM, QueueSliceCount::defaultSliceCount, cs.getUsed(), &cs, nullptr, false};
+    csr->flush(batchBuffer, csr->getResidencyAllocations());
+
+    EXPECT_EQ(1u, this->mock->execBuffer.buffer_count);
+    EXPECT_EQ(0u, testedCsr->residency.size());
+
+    csr->makeSurfacePackNonResident(csr->getResidencyAllocations());
+    mm->freeGraphicsMemory(commandBuffer);
+    mm->freeGraphicsMemory(allocation);
+}
+
+HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenVmBindAvailableWhenCsrIsCreatedThenResidencyIsSkippedForExecUnlessBoundBOsArePassedToExec) {
+    mock->bindAvailable = true;
+    {
+        TestedDrmCommandStreamReceiver<FamilyType> testedCsr(*executionEnvironment, rootDeviceIndex, 1);
+        EXPECT_TRUE(testedCsr.skipResidencyForExec);
+    }
+
+    DebugManager.flags.PassBoundBOToExec.set(1);
+    {
+        TestedDrmCommandStreamReceiver<FamilyType> testedCsr(*executionEnvironment, rootDeviceIndex, 1);
+        EXPECT_FALSE(testedCsr.skipResidencyForExec);
+    }
+
+    mock->bindAvailable = false;
+    DebugManager.flags.PassBoundBOToExec.set(-1);
+    {
+        TestedDrmCommandStreamReceiver<FamilyType> testedCsr(*executionEnvironment, rootDeviceIndex, 1);
+        EXPECT_FALSE(testedCsr.skipResidencyForExec);
+    }
+}
+
+HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenSameResidencyWhenFlushingTwiceThenExecObjectsFilledInFirstFlushAreReused) {
+    auto allocation = static_cast<DrmAllocation *>(mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize}));
+    auto commandBuffer = mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize});
+    auto &execStorage = static_cast<TestedDrmCommandStreamReceiver<FamilyType> *>(csr)->getExecStorage();
+
+    LinearStream cs(commandBuffer);
+    CommandStreamReceiverHw<FamilyType>::addBatchBufferEnd(cs, nullptr);
+    CommandStreamReceiverHw<FamilyType>::alignToCacheLine(cs);
+    BatchBuffer batchBuffer{cs.getGraphicsAllocation(), 0, 0, nullptr, false, false, QueueThrottle::MEDIUM, QueueSliceCount::defaultSliceCount, cs.getUsed(), &cs, nullptr, false};
+
+    for (uint32_t flush = 0; flush < 2; flush++) {
+        csr->makeResident(*allocation);
+        csr->flush(batchBuffer, csr->getResidencyAllocations());
+        EXPECT_EQ(2u, this->mock->execBuffer.buffer_count);
+        EXPECT_TRUE(allocation->getBO()->isExecObjectFilled(execStorage[0], static_cast<const OsContextLinux &>(csr->getOsContext()).getDrmContextIds()[0]));
+        csr->makeSurfacePackNonResident(csr->getResidencyAllocations());
+    }
+
+    mm->freeGraphicsMemory(commandBuffer);
+    mm->freeGraphicsMemory(allocation);
+}
+
 HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenGemCloseWorkerInactiveModeWhenMakeResidentIsCalledThenRefCountsAreNotUpdated) {
     auto dummyAllocation = static_cast<DrmAllocation *>(mm->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize}));
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -165,6 +165,20 @@ TEST_F(DrmGemCloseWorkerTests, givenAllocationWhenAskedForUnreferenceWithForceFl
     delete worker;
 }
 
+TEST_F(DrmGemCloseWorkerTests, givenAllocationPushedToWorkerWhenWorkerIsDestroyedThenAllocationIsReleasedFromWorkerThread) {
+    this->drmMock->gem_close_expected = 1;
+
+    auto worker = new DrmGemCloseWorker(*mm);
+    auto bo = new BufferObject(this->drmMock, 1, 0, 1);
+    auto allocation = new DrmAllocationWrapper(bo);
+
+    worker->pushAllocation(allocation);
+    EXPECT_TRUE(worker->isActive());
+
+    delete worker;
+    EXPECT_NE(drmMock->ioctl_caller_thread_id, std::this_thread::get_id());
+}
+
 TEST_F(DrmGemCloseWorkerTests, givenDrmGemCloseWorkerWhenCloseIsCalledWithBlockingFlagThenThreadIsClosed) {
     struct mockDrmGemCloseWorker : DrmGemCloseWorker {
         using DrmGemCloseWorker::DrmGemCloseWorker;
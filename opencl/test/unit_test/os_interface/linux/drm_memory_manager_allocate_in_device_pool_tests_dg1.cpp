@@ -553,6 +553,108 @@ TEST_F(DrmMemoryManagerLocalMemoryMemoryBankTest, givenDeviceMemoryWhenGraphicsA
     EXPECT_TRUE(memoryManager->memoryBankIsOne);
 }
 
+TEST_F(DrmMemoryManagerLocalMemoryTest, givenLocalMemoryOversubscriptionEnabledWhenCreateBufferObjectInLocalMemoryThenSystemMemoryIsAddedAsSecondPlacement) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableLocalMemoryOversubscription.set(1);
+
+    auto bo = std::unique_ptr<BufferObject>(memoryManager->createBufferObjectInMemoryRegion(&memoryManager->getDrm(0),
+                                                                                            0x1234u,
+                                                                                            MemoryConstants::pageSize64k,
+                                                                                            (1 << (MemoryBanks::Bank0 - 1)),
+                                                                                            1));
+    ASSERT_NE(nullptr, bo);
+
+    EXPECT_EQ(2u, mock->setparamRegion.param.size);
+    ASSERT_EQ(2u, mock->allMemRegions.size());
+    EXPECT_EQ(I915_MEMORY_CLASS_DEVICE, mock->allMemRegions[0].memory_class);
+    EXPECT_EQ(I915_MEMORY_CLASS_SYSTEM, mock->allMemRegions[1].memory_class);
+}
+
+TEST_F(DrmMemoryManagerLocalMemoryTest, givenLocalMemoryOversubscriptionDisabledWhenCreateBufferObjectInLocalMemoryThenOnlyLocalMemoryPlacementIsUsed) {
+    auto bo = std::unique_ptr<BufferObject>(memoryManager->createBufferObjectInMemoryRegion(&memoryManager->getDrm(0),
+                                                                                            0x1234u,
+                                                                                            MemoryConstants::pageSize64k,
+                                                                                            (1 << (MemoryBanks::Bank0 - 1)),
+                                                                                            1));
+    ASSERT_NE(nullptr, bo);
+
+    ASSERT_EQ(1u, mock->allMemRegions.size());
+    EXPECT_EQ(I915_MEMORY_CLASS_DEVICE, mock->allMemRegions[0].memory_class);
+}
+
+class DrmMemoryManagerWithColdAllocationEviction : public TestedDrmMemoryManager {
+  public:
+    using TestedDrmMemoryManager::TestedDrmMemoryManager;
+
+    bool evictColdLocalMemoryAllocation(uint32_t rootDeviceIndex) override {
+        evictCalled++;
+        if (coldAllocationsToEvict == 0) {
+            return false;
+        }
+        coldAllocationsToEvict--;
+        return true;
+    }
+
+    uint32_t evictCalled = 0;
+    uint32_t coldAllocationsToEvict = 0;
+};
+
+TEST_F(DrmMemoryManagerLocalMemoryTest, givenLocalMemoryExhaustedWhenColdAllocationIsEvictedThenBufferObjectCreationIsRetried) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableLocalMemoryOversubscription.set(1);
+    auto evictingMemoryManager = std::make_unique<DrmMemoryManagerWithColdAllocationEviction>(true, false, false, *executionEnvironment);
+    evictingMemoryManager->coldAllocationsToEvict = 1;
+    mock->gemCreateExtFailuresToInject = 1;
+
+    MemoryManager::AllocationStatus status = MemoryManager::AllocationStatus::Error;
+    AllocationData allocData;
+    allocData.allFlags = 0;
+    allocData.size = MemoryConstants::pageSize;
+    allocData.type = GraphicsAllocation::AllocationType::BUFFER;
+    allocData.rootDeviceIndex = rootDeviceIndex;
+
+    auto allocation = evictingMemoryManager->allocateGraphicsMemoryInDevicePool(allocData, status);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(MemoryManager::AllocationStatus::Success, status);
+    EXPECT_EQ(1u, evictingMemoryManager->evictCalled);
+
+    evictingMemoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(DrmMemoryManagerLocalMemoryTest, givenLocalMemoryOversubscriptionEnabledWhenNothingCanBeEvictedThenAllocationFallsBackToSystemMemory) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableLocalMemoryOversubscription.set(1);
+    auto evictingMemoryManager = std::make_unique<DrmMemoryManagerWithColdAllocationEviction>(true, false, false, *executionEnvironment);
+    mock->gemCreateExtFailuresToInject = 1;
+
+    MemoryManager::AllocationStatus status = MemoryManager::AllocationStatus::Success;
+    AllocationData allocData;
+    allocData.allFlags = 0;
+    allocData.size = MemoryConstants::pageSize;
+    allocData.type = GraphicsAllocation::AllocationType::BUFFER;
+    allocData.rootDeviceIndex = rootDeviceIndex;
+
+    auto allocation = evictingMemoryManager->allocateGraphicsMemoryInDevicePool(allocData, status);
+    EXPECT_EQ(nullptr, allocation);
+    EXPECT_EQ(MemoryManager::AllocationStatus::RetryInNonDevicePool, status);
+    EXPECT_EQ(1u, evictingMemoryManager->evictCalled);
+}
+
+TEST_F(DrmMemoryManagerLocalMemoryTest, givenLocalMemoryOversubscriptionDisabledWhenLocalMemoryIsExhaustedThenErrorIsReturned) {
+    mock->gemCreateExtFailuresToInject = 1;
+
+    MemoryManager::AllocationStatus status = MemoryManager::AllocationStatus::Success;
+    AllocationData allocData;
+    allocData.allFlags = 0;
+    allocData.size = MemoryConstants::pageSize;
+    allocData.type = GraphicsAllocation::AllocationType::BUFFER;
+    allocData.rootDeviceIndex = rootDeviceIndex;
+
+    auto allocation = memoryManager->allocateGraphicsMemoryInDevicePool(allocData, status);
+    EXPECT_EQ(nullptr, allocation);
+    EXPECT_EQ(MemoryManager::AllocationStatus::Error, status);
+}
+
 TEST_F(DrmMemoryManagerLocalMemoryTest, givenNotSetUseSystemMemoryWhenGraphicsAllocationInDevicePoolIsAllocatedForBufferThenLocalMemoryAllocationIsReturnedFromStandard64KbHeap) {
     MemoryManager::AllocationStatus status = MemoryManager::AllocationStatus::Success;
     AllocationData allocData;
@@ -924,6 +1026,82 @@ TEST_F(DrmMemoryManagerLocalMemoryTest, givenUnsupportedTypeWhenAllocatingInDevi
     }
 }
 
+TEST_F(DrmMemoryManagerLocalMemoryTest, givenUnifiedSharedMemoryWhenAllocatingInDevicePoolThenBufferObjectPlaceableInLocalAndSystemMemoryIsMappedAtItsGpuAddress) {
+    drm_i915_memory_region_info regionInfo[2] = {};
+    regionInfo[0].region = {I915_MEMORY_CLASS_SYSTEM, 0};
+    regionInfo[1].region = {I915_MEMORY_CLASS_DEVICE, 0};
+    mock->memoryInfo.reset(new MemoryInfoImpl(regionInfo, 2));
+
+    MemoryManager::AllocationStatus status = MemoryManager::AllocationStatus::Error;
+    AllocationData allocData;
+    allocData.allFlags = 0;
+    allocData.size = MemoryConstants::pageSize64k;
+    allocData.alignment = MemoryConstants::pageSize64k;
+    allocData.flags.allocateMemory = true;
+    allocData.type = GraphicsAllocation::AllocationType::UNIFIED_SHARED_MEMORY;
+    allocData.rootDeviceIndex = rootDeviceIndex;
+
+    auto allocation = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemoryInDevicePool(allocData, status));
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(MemoryManager::AllocationStatus::Success, status);
+    EXPECT_NE(nullptr, allocation->getUnderlyingBuffer());
+    EXPECT_EQ(reinterpret_cast<uint64_t>(allocation->getUnderlyingBuffer()), allocation->getGpuAddress());
+    EXPECT_EQ(allocation->getGpuAddress(), allocation->getBO()->peekAddress());
+    EXPECT_EQ(allocation->getUnderlyingBuffer(), allocation->getMmapPtr());
+
+    ASSERT_EQ(2u, mock->allMemRegions.size());
+    EXPECT_EQ(I915_MEMORY_CLASS_DEVICE, mock->allMemRegions[0].memory_class);
+    EXPECT_EQ(I915_MEMORY_CLASS_SYSTEM, mock->allMemRegions[1].memory_class);
+
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(DrmMemoryManagerLocalMemoryTest, givenUnifiedSharedMemoryPreferringSystemPlacementWhenAllocatingInDevicePoolThenSystemMemoryIsFirstPlacement) {
+    drm_i915_memory_region_info regionInfo[2] = {};
+    regionInfo[0].region = {I915_MEMORY_CLASS_SYSTEM, 0};
+    regionInfo[1].region = {I915_MEMORY_CLASS_DEVICE, 0};
+    mock->memoryInfo.reset(new MemoryInfoImpl(regionInfo, 2));
+
+    MemoryManager::AllocationStatus status = MemoryManager::AllocationStatus::Error;
+    AllocationData allocData;
+    allocData.allFlags = 0;
+    allocData.size = MemoryConstants::pageSize64k;
+    allocData.alignment = MemoryConstants::pageSize64k;
+    allocData.flags.allocateMemory = true;
+    allocData.flags.preferSystemPlacement = true;
+    allocData.type = GraphicsAllocation::AllocationType::UNIFIED_SHARED_MEMORY;
+    allocData.rootDeviceIndex = rootDeviceIndex;
+
+    auto allocation = memoryManager->allocateGraphicsMemoryInDevicePool(allocData, status);
+    ASSERT_NE(nullptr, allocation);
+
+    ASSERT_EQ(2u, mock->allMemRegions.size());
+    EXPECT_EQ(I915_MEMORY_CLASS_SYSTEM, mock->allMemRegions[0].memory_class);
+    EXPECT_EQ(I915_MEMORY_CLASS_DEVICE, mock->allMemRegions[1].memory_class);
+
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(DrmMemoryManagerLocalMemoryTest, givenUnifiedSharedMemoryAndFailedMmapOffsetWhenAllocatingInDevicePoolThenErrorIsReturned) {
+    drm_i915_memory_region_info regionInfo[2] = {};
+    regionInfo[0].region = {I915_MEMORY_CLASS_SYSTEM, 0};
+    regionInfo[1].region = {I915_MEMORY_CLASS_DEVICE, 0};
+    mock->memoryInfo.reset(new MemoryInfoImpl(regionInfo, 2));
+    mock->mmapOffsetRetVal = -1;
+
+    MemoryManager::AllocationStatus status = MemoryManager::AllocationStatus::Success;
+    AllocationData allocData;
+    allocData.allFlags = 0;
+    allocData.size = MemoryConstants::pageSize64k;
+    allocData.flags.allocateMemory = true;
+    allocData.type = GraphicsAllocation::AllocationType::UNIFIED_SHARED_MEMORY;
+    allocData.rootDeviceIndex = rootDeviceIndex;
+
+    auto allocation = memoryManager->allocateGraphicsMemoryInDevicePool(allocData, status);
+    EXPECT_EQ(nullptr, allocation);
+    EXPECT_EQ(MemoryManager::AllocationStatus::Error, status);
+}
+
 TEST_F(DrmMemoryManagerLocalMemoryTest, givenOversizedAllocationWhenGraphicsAllocationInDevicePoolIsAllocatedThenAllocationAndBufferObjectHaveRequestedSize) {
     auto heap = HeapIndex::HEAP_STANDARD64KB;
     if (memoryManager->getGfxPartition(0)->getHeapLimit(HeapIndex::HEAP_EXTENDED)) {
@@ -48,6 +48,7 @@
 #include "gtest/gtest.h"
 
 #include <iostream>
+#include <linux/mempolicy.h>
 #include <memory>
 
 namespace NEO {
@@ -2414,6 +2415,52 @@ TEST_F(DrmMemoryManagerTest, givenTwoGraphicsAllocationsThatDoesnShareTheSameBuf
     memoryManager->freeGraphicsMemory(graphicsAllocation2);
 }
 
+TEST_F(DrmMemoryManagerTest, givenSameGemHandleOnTwoRootDevicesWhenAllocationsAreCreatedFromSharedHandleThenBufferObjectsAreNotShared) {
+    auto peerMock = static_cast<DrmMockCustom *>(executionEnvironment->rootDeviceEnvironments[0]->osInterface->get()->getDrm());
+    mock->ioctl_expected.primeFdToHandle = 1;
+    mock->ioctl_expected.gemClose = 1;
+    mock->ioctl_expected.gemWait = 1;
+    mock->outputHandle = 2u;
+    peerMock->outputHandle = 2u;
+
+    osHandle sharedHandle = 1u;
+    AllocationProperties properties(rootDeviceIndex, false, MemoryConstants::pageSize, GraphicsAllocation::AllocationType::SHARED_BUFFER, false, {});
+    AllocationProperties peerProperties(0u, false, MemoryConstants::pageSize, GraphicsAllocation::AllocationType::SHARED_BUFFER, false, {});
+    auto graphicsAllocation = static_cast<DrmAllocation *>(memoryManager->createGraphicsAllocationFromSharedHandle(sharedHandle, properties, false));
+    auto peerGraphicsAllocation = static_cast<DrmAllocation *>(memoryManager->createGraphicsAllocationFromSharedHandle(sharedHandle, peerProperties, false));
+    ASSERT_NE(nullptr, graphicsAllocation);
+    ASSERT_NE(nullptr, peerGraphicsAllocation);
+
+    EXPECT_NE(graphicsAllocation->getBO(), peerGraphicsAllocation->getBO());
+    EXPECT_EQ(1u, graphicsAllocation->getBO()->getRefCount());
+    EXPECT_EQ(1u, peerGraphicsAllocation->getBO()->getRefCount());
+
+    memoryManager->freeGraphicsMemory(peerGraphicsAllocation);
+    memoryManager->freeGraphicsMemory(graphicsAllocation);
+}
+
+TEST_F(DrmMemoryManagerTest, givenAllocationOnOtherRootDeviceWhenCreatingPeerAllocationThenExportedHandleIsImportedOnRequestedRootDevice) {
+    auto peerMock = static_cast<DrmMockCustom *>(executionEnvironment->rootDeviceEnvironments[0]->osInterface->get()->getDrm());
+    mock->ioctl_expected.gemUserptr = 1;
+    mock->ioctl_expected.handleToPrimeFd = 1;
+    mock->ioctl_expected.gemWait = 1;
+    mock->ioctl_expected.gemClose = 1;
+    mock->outputFd = 1337;
+    peerMock->ioctl_cnt.reset();
+
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(createAllocationProperties(rootDeviceIndex, MemoryConstants::pageSize, false));
+    ASSERT_NE(nullptr, allocation);
+
+    auto peerAllocation = memoryManager->createPeerAllocation(*allocation, 0u);
+    ASSERT_NE(nullptr, peerAllocation);
+    EXPECT_EQ(0u, peerAllocation->getRootDeviceIndex());
+    EXPECT_EQ(1337, peerMock->inputFd);
+    EXPECT_EQ(1, peerMock->ioctl_cnt.primeFdToHandle);
+
+    memoryManager->freeGraphicsMemory(peerAllocation);
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
 TEST_F(DrmMemoryManagerWithExplicitExpectationsTest, givenDrmMemoryManagerWhenCreateAllocationFromNtHandleIsCalledThenReturnNullptr) {
     auto graphicsAllocation = memoryManager->createGraphicsAllocationFromNTHandle(reinterpret_cast<void *>(1), 0);
     EXPECT_EQ(nullptr, graphicsAllocation);
@@ -3889,6 +3936,176 @@ TEST_F(DrmMemoryManagerTest, givenSvmCpuAllocationWhenSizeAndAlignmentProvidedBu
     EXPECT_EQ(nullptr, allocation);
 }
 
+TEST_F(DrmMemoryManagerTest, givenHugePageAllocationThresholdSetWhenAllocatingLargeHostBufferThenMemoryIs2MbAlignedAndHugePagesAreAdvised) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.HugePageAllocationThreshold.set(4 * MemoryConstants::megaByte);
+
+    mock->ioctl_expected.gemUserptr = 1;
+    mock->ioctl_expected.gemWait = 1;
+    mock->ioctl_expected.gemClose = 1;
+
+    AllocationData allocationData;
+    allocationData.size = 4 * MemoryConstants::megaByte + MemoryConstants::pageSize;
+    allocationData.type = GraphicsAllocation::AllocationType::BUFFER_HOST_MEMORY;
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+
+    EXPECT_TRUE(memoryManager->isHugePageAllocationPreferred(allocationData));
+
+    DrmAllocation *allocation = memoryManager->allocateGraphicsMemoryWithAlignment(allocationData);
+    ASSERT_NE(nullptr, allocation);
+
+    EXPECT_TRUE(isAligned<MemoryConstants::pageSize2Mb>(allocation->getUnderlyingBuffer()));
+    EXPECT_TRUE(isAligned<MemoryConstants::pageSize2Mb>(allocation->getGpuAddress()));
+    EXPECT_EQ(6 * MemoryConstants::megaByte, allocation->getUnderlyingBufferSize());
+    EXPECT_EQ(1, madviseCalledCount);
+    EXPECT_EQ(MADV_HUGEPAGE, madviseAdvice);
+
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(DrmMemoryManagerTest, givenHugePageAllocationThresholdSetWhenAllocatingBufferBelowThresholdThenHugePagesAreNotAdvised) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.HugePageAllocationThreshold.set(4 * MemoryConstants::megaByte);
+
+    mock->ioctl_expected.gemUserptr = 1;
+    mock->ioctl_expected.gemWait = 1;
+    mock->ioctl_expected.gemClose = 1;
+
+    AllocationData allocationData;
+    allocationData.size = MemoryConstants::megaByte;
+    allocationData.type = GraphicsAllocation::AllocationType::BUFFER_HOST_MEMORY;
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+
+    EXPECT_FALSE(memoryManager->isHugePageAllocationPreferred(allocationData));
+
+    DrmAllocation *allocation = memoryManager->allocateGraphicsMemoryWithAlignment(allocationData);
+    ASSERT_NE(nullptr, allocation);
+
+    EXPECT_EQ(MemoryConstants::megaByte, allocation->getUnderlyingBufferSize());
+    EXPECT_EQ(0, madviseCalledCount);
+
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(DrmMemoryManagerTest, givenHugePageAllocationThresholdSetWhenCheckingAllocationsThenOnlyLargeSystemMemoryBuffersPreferHugePages) {
+    AllocationData allocationData;
+    allocationData.size = 8 * MemoryConstants::megaByte;
+    allocationData.type = GraphicsAllocation::AllocationType::BUFFER_HOST_MEMORY;
+    EXPECT_FALSE(memoryManager->isHugePageAllocationPreferred(allocationData));
+
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.HugePageAllocationThreshold.set(0);
+    EXPECT_TRUE(memoryManager->isHugePageAllocationPreferred(allocationData));
+
+    allocationData.type = GraphicsAllocation::AllocationType::KERNEL_ISA;
+    EXPECT_FALSE(memoryManager->isHugePageAllocationPreferred(allocationData));
+
+    allocationData.type = GraphicsAllocation::AllocationType::BUFFER;
+    allocationData.alignment = 4 * MemoryConstants::megaByte;
+    EXPECT_FALSE(memoryManager->isHugePageAllocationPreferred(allocationData));
+}
+
+TEST_F(DrmMemoryManagerTest, givenLimitedRangeAndHugePageAllocationThresholdSetWhenAllocatingLargeBufferThenGpuVaIsTakenFromStandard2MbHeap) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.HugePageAllocationThreshold.set(0);
+
+    mock->ioctl_expected.gemUserptr = 1;
+    mock->ioctl_expected.gemWait = 1;
+    mock->ioctl_expected.gemClose = 1;
+
+    memoryManager->forceLimitedRangeAllocator(0xFFFFFFFFF);
+
+    AllocationData allocationData;
+    allocationData.size = 2 * MemoryConstants::megaByte;
+    allocationData.type = GraphicsAllocation::AllocationType::BUFFER;
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+
+    DrmAllocation *allocation = memoryManager->allocateGraphicsMemoryWithAlignment(allocationData);
+    ASSERT_NE(nullptr, allocation);
+
+    auto gfxPartition = memoryManager->getGfxPartition(rootDeviceIndex);
+    auto gpuAddress = GmmHelper::decanonize(allocation->getGpuAddress());
+    EXPECT_TRUE(isAligned<MemoryConstants::pageSize2Mb>(gpuAddress));
+    EXPECT_LE(gfxPartition->getHeapBase(HeapIndex::HEAP_STANDARD2MB), gpuAddress);
+    EXPECT_GT(gfxPartition->getHeapLimit(HeapIndex::HEAP_STANDARD2MB), gpuAddress);
+
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(DrmMemoryManagerTest, givenNumaBindingEnabledWhenAllocatingCommandBufferThenMemoryIsBoundToPreferredNode) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableHostMemoryNumaBinding.set(1);
+    DebugManager.flags.ForceNumaNode.set(3);
+
+    mock->ioctl_expected.gemUserptr = 1;
+    mock->ioctl_expected.gemWait = 1;
+    mock->ioctl_expected.gemClose = 1;
+
+    AllocationData allocationData;
+    allocationData.size = MemoryConstants::pageSize;
+    allocationData.type = GraphicsAllocation::AllocationType::COMMAND_BUFFER;
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+
+    DrmAllocation *allocation = memoryManager->allocateGraphicsMemoryWithAlignment(allocationData);
+    ASSERT_NE(nullptr, allocation);
+
+    EXPECT_EQ(1, mbindCalledCount);
+    EXPECT_EQ(MPOL_PREFERRED, mbindMode);
+    EXPECT_EQ(1ul << 3, mbindNodeMask);
+
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(DrmMemoryManagerTest, givenNumaBindingDisabledWhenAllocatingCommandBufferThenMemoryIsNotBound) {
+    mock->ioctl_expected.gemUserptr = 1;
+    mock->ioctl_expected.gemWait = 1;
+    mock->ioctl_expected.gemClose = 1;
+
+    AllocationData allocationData;
+    allocationData.size = MemoryConstants::pageSize;
+    allocationData.type = GraphicsAllocation::AllocationType::COMMAND_BUFFER;
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+
+    EXPECT_EQ(-1, memoryManager->getPreferredNumaNode(allocationData));
+
+    DrmAllocation *allocation = memoryManager->allocateGraphicsMemoryWithAlignment(allocationData);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(0, mbindCalledCount);
+
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(DrmMemoryManagerTest, givenNumaBindingEnabledWhenGettingPreferredNodeThenAllocationTypeMaskIsRespected) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableHostMemoryNumaBinding.set(1);
+    DebugManager.flags.ForceNumaNode.set(0);
+
+    AllocationData allocationData;
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+    allocationData.type = GraphicsAllocation::AllocationType::TAG_BUFFER;
+    EXPECT_EQ(0, memoryManager->getPreferredNumaNode(allocationData));
+
+    allocationData.type = GraphicsAllocation::AllocationType::KERNEL_ISA;
+    EXPECT_EQ(-1, memoryManager->getPreferredNumaNode(allocationData));
+
+    DebugManager.flags.NumaBindingAllocationTypeMask.set(1llu << (static_cast<int64_t>(GraphicsAllocation::AllocationType::KERNEL_ISA) - 1));
+    EXPECT_EQ(0, memoryManager->getPreferredNumaNode(allocationData));
+
+    allocationData.type = GraphicsAllocation::AllocationType::TAG_BUFFER;
+    EXPECT_EQ(-1, memoryManager->getPreferredNumaNode(allocationData));
+}
+
+TEST_F(DrmMemoryManagerTest, givenNumaBindingEnabledAndNodeNotForcedWhenGettingPreferredNodeThenDeviceNodeIsReturned) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableHostMemoryNumaBinding.set(1);
+
+    AllocationData allocationData;
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+    allocationData.type = GraphicsAllocation::AllocationType::BUFFER_HOST_MEMORY;
+
+    EXPECT_EQ(memoryManager->getDrm(rootDeviceIndex).getNumaNode(), memoryManager->getPreferredNumaNode(allocationData));
+}
+
 TEST_F(DrmMemoryManagerTest, givenDrmMemoryManagerAndReleaseGpuRangeIsCalledThenGpuAddressIsDecanonized) {
     constexpr size_t reservedCpuAddressRangeSize = is64bit ? (6 * 4 * GB) : 0;
     auto hwInfo = defaultHwInfo.get();
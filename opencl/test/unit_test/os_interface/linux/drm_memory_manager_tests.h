@@ -8,6 +8,7 @@
 #pragma once
 #include "shared/source/os_interface/linux/drm_memory_operations_handler.h"
 #include "shared/source/os_interface/linux/os_interface.h"
+#include "shared/source/os_interface/os_context.h"
 #include "shared/test/common/mocks/linux/mock_drm_memory_manager.h"
 #include "shared/test/common/mocks/mock_device.h"
 
@@ -18,6 +19,7 @@
 #include "opencl/test/unit_test/mocks/mock_execution_environment.h"
 #include "opencl/test/unit_test/os_interface/linux/device_command_stream_fixture.h"
 
+#include <algorithm>
 #include <memory>
 
 namespace NEO {
@@ -84,7 +86,9 @@ class DrmMemoryManagerFixture : public MemoryManagementFixture {
     void TearDown() override {
         mock->testIoctls();
         mock->reset();
-        mock->ioctl_expected.contextDestroy = static_cast<int>(device->engines.size());
+        mock->ioctl_expected.contextDestroy = static_cast<int>(std::count_if(device->engines.begin(), device->engines.end(), [](const EngineControl &engine) {
+            return engine.osContext->isContextInitialized();
+        }));
         mock->ioctl_expected.gemClose = static_cast<int>(device->engines.size());
         mock->ioctl_expected.gemWait = static_cast<int>(device->engines.size());
 
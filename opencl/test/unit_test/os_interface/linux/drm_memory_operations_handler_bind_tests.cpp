@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/linux/drm_allocation.h"
+#include "shared/source/os_interface/linux/drm_memory_operations_handler_bind.h"
+
+#include "opencl/test/unit_test/mocks/mock_execution_environment.h"
+#include "opencl/test/unit_test/mocks/mock_memory_manager.h"
+#include "opencl/test/unit_test/mocks/mock_os_context.h"
+#include "opencl/test/unit_test/os_interface/linux/drm_mock.h"
+#include "test.h"
+
+#include <memory>
+
+using namespace NEO;
+
+struct MockDrmMemoryOperationsHandlerBind : public DrmMemoryOperationsHandlerBind {
+    using DrmMemoryOperationsHandlerBind::DrmMemoryOperationsHandlerBind;
+    using DrmMemoryOperationsHandlerBind::evictLeastRecentlyUsedAllocation;
+    using DrmMemoryOperationsHandlerBind::lruAllocations;
+};
+
+struct DrmMemoryOperationsHandlerBindTest : public ::testing::Test {
+    void SetUp() override {
+        executionEnvironment.memoryManager = std::make_unique<MockMemoryManager>(executionEnvironment);
+        handler = std::make_unique<MockDrmMemoryOperationsHandlerBind>(*executionEnvironment.rootDeviceEnvironments[0], 0u);
+        osContext = std::make_unique<MockOsContext>(0u, 1u, EngineTypeUsage{aub_stream::ENGINE_RCS, EngineUsage::Regular}, PreemptionMode::Disabled, false);
+        for (auto &allocation : allocations) {
+            allocation = std::make_unique<DrmAllocation>(0u, GraphicsAllocation::AllocationType::UNKNOWN, nullptr, nullptr, MemoryConstants::pageSize, static_cast<osHandle>(0u), MemoryPool::MemoryNull);
+        }
+    }
+
+    GraphicsAllocation *allocation(uint32_t index) {
+        return allocations[index].get();
+    }
+
+    MockExecutionEnvironment executionEnvironment;
+    std::unique_ptr<MockDrmMemoryOperationsHandlerBind> handler;
+    std::unique_ptr<MockOsContext> osContext;
+    std::unique_ptr<DrmAllocation> allocations[3];
+};
+
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenEvictableAllocationsWhenMakingResidentThenTheyAreTrackedInUsageOrder) {
+    GraphicsAllocation *allocationsToBind[] = {allocation(0), allocation(1), allocation(2)};
+    EXPECT_EQ(MemoryOperationsStatus::SUCCESS, handler->makeResidentWithinOsContext(osContext.get(), ArrayRef<GraphicsAllocation *>(allocationsToBind), true));
+    EXPECT_EQ(3u, handler->getLruSize());
+
+    GraphicsAllocation *allocationToTouch = allocation(0);
+    EXPECT_EQ(MemoryOperationsStatus::SUCCESS, handler->makeResidentWithinOsContext(osContext.get(), ArrayRef<GraphicsAllocation *>(&allocationToTouch, 1), true));
+    EXPECT_EQ(3u, handler->getLruSize());
+
+    std::vector<GraphicsAllocation *> expectedOrder = {allocation(1), allocation(2), allocation(0)};
+    std::vector<GraphicsAllocation *> lruOrder(handler->lruAllocations.begin(), handler->lruAllocations.end());
+    EXPECT_EQ(expectedOrder, lruOrder);
+}
+
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenNonEvictableAllocationWhenMakingResidentThenItIsNotTrackedInLru) {
+    GraphicsAllocation *allocationToBind = allocation(0);
+    EXPECT_EQ(MemoryOperationsStatus::SUCCESS, handler->makeResidentWithinOsContext(osContext.get(), ArrayRef<GraphicsAllocation *>(&allocationToBind, 1), true));
+    EXPECT_EQ(1u, handler->getLruSize());
+
+    EXPECT_EQ(MemoryOperationsStatus::SUCCESS, handler->makeResidentWithinOsContext(osContext.get(), ArrayRef<GraphicsAllocation *>(&allocationToBind, 1), false));
+    EXPECT_EQ(0u, handler->getLruSize());
+    EXPECT_TRUE(allocationToBind->isAlwaysResident(osContext->getContextId()));
+}
+
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenTrackedAllocationWhenEvictingWithinOsContextThenItIsRemovedFromLru) {
+    GraphicsAllocation *allocationsToBind[] = {allocation(0), allocation(1)};
+    EXPECT_EQ(MemoryOperationsStatus::SUCCESS, handler->makeResidentWithinOsContext(osContext.get(), ArrayRef<GraphicsAllocation *>(allocationsToBind), true));
+
+    EXPECT_EQ(MemoryOperationsStatus::SUCCESS, handler->evictWithinOsContext(osContext.get(), *allocation(0)));
+    EXPECT_EQ(1u, handler->getLruSize());
+    EXPECT_EQ(allocation(1), handler->lruAllocations.front());
+
+    EXPECT_EQ(MemoryOperationsStatus::SUCCESS, handler->evictWithinOsContext(osContext.get(), *allocation(0)));
+    EXPECT_EQ(1u, handler->getLruSize());
+}
+
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenIdleTrackedAllocationsWhenEvictingLeastRecentlyUsedThenOldestAllocationIsEvictedFirst) {
+    GraphicsAllocation *allocationsToBind[] = {allocation(0), allocation(1)};
+    EXPECT_EQ(MemoryOperationsStatus::SUCCESS, handler->makeResidentWithinOsContext(osContext.get(), ArrayRef<GraphicsAllocation *>(allocationsToBind), true));
+
+    EXPECT_TRUE(handler->evictLeastRecentlyUsedAllocation());
+    EXPECT_EQ(1u, handler->getLruSize());
+    EXPECT_EQ(allocation(1), handler->lruAllocations.front());
+
+    EXPECT_TRUE(handler->evictLeastRecentlyUsedAllocation());
+    EXPECT_EQ(0u, handler->getLruSize());
+
+    EXPECT_FALSE(handler->evictLeastRecentlyUsedAllocation());
+}
+
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenTrackedAllocationsWhenEvictingColdLocalMemoryAllocationThenSystemMemoryAllocationsAreSkipped) {
+    auto localMemoryAllocation = std::make_unique<DrmAllocation>(0u, GraphicsAllocation::AllocationType::BUFFER, nullptr, nullptr, MemoryConstants::pageSize, static_cast<osHandle>(0u), MemoryPool::LocalMemory);
+
+    GraphicsAllocation *allocationsToBind[] = {allocation(0), localMemoryAllocation.get()};
+    EXPECT_EQ(MemoryOperationsStatus::SUCCESS, handler->makeResidentWithinOsContext(osContext.get(), ArrayRef<GraphicsAllocation *>(allocationsToBind), true));
+
+    EXPECT_TRUE(handler->evictColdAllocation(true));
+    EXPECT_EQ(1u, handler->getLruSize());
+    EXPECT_EQ(allocation(0), handler->lruAllocations.front());
+
+    EXPECT_FALSE(handler->evictColdAllocation(true));
+    EXPECT_TRUE(handler->evictColdAllocation(false));
+    EXPECT_EQ(0u, handler->getLruSize());
+}
+
+TEST(DrmBindFenceTest, givenSignaledPagingFenceWhenWaitingForBindThenReturnImmediately) {
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    DrmMock drm(*executionEnvironment->rootDeviceEnvironments[0]);
+
+    drm.waitForBind(0u);
+
+    auto fenceValue = drm.getNextFenceVal(0u);
+    *drm.getFenceAddr(0u) = fenceValue;
+    drm.waitForBind(0u);
+    EXPECT_EQ(fenceValue, *drm.getFenceAddr(0u));
+}
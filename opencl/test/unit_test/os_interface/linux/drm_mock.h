@@ -38,6 +38,7 @@ class DrmMock : public Drm {
     using Drm::generateElfUUID;
     using Drm::generateUUID;
     using Drm::getQueueSliceCount;
+    using Drm::getTopologyCacheKey;
     using Drm::memoryInfo;
     using Drm::nonPersistentContextsSupported;
     using Drm::preemptionSupported;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,7 +24,9 @@ class DrmMockDg1 : public DrmMock {
     drm_i915_gem_create_ext createExt{};
     drm_i915_gem_create_ext_setparam setparamRegion{};
     drm_i915_gem_memory_class_instance memRegions{};
+    std::vector<drm_i915_gem_memory_class_instance> allMemRegions;
     int gemCreateExtRetVal = 0;
+    uint32_t gemCreateExtFailuresToInject = 0;
 
     //DRM_IOCTL_I915_GEM_MMAP_OFFSET
     __u64 offset = 0;
@@ -68,9 +70,14 @@ class DrmMockDg1 : public DrmMock {
                 return EINVAL;
             }
             this->memRegions = *data;
+            this->allMemRegions.assign(data, data + this->setparamRegion.param.size);
             if ((this->memRegions.memory_class != I915_MEMORY_CLASS_SYSTEM) && (this->memRegions.memory_class != I915_MEMORY_CLASS_DEVICE)) {
                 return EINVAL;
             }
+            if (gemCreateExtFailuresToInject > 0) {
+                gemCreateExtFailuresToInject--;
+                return ENOSPC;
+            }
             return gemCreateExtRetVal;
 
         } else if (request == DRM_IOCTL_I915_GEM_MMAP_OFFSET) {
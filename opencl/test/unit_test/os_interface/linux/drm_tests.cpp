@@ -5,11 +5,13 @@
  *
  */
 
+#include "shared/source/command_stream/csr_definitions.h"
 #include "shared/source/helpers/file_io.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/os_interface/device_factory.h"
 #include "shared/source/os_interface/linux/os_context_linux.h"
 #include "shared/source/os_interface/linux/os_interface.h"
+#include "shared/source/os_interface/linux/topology_cache.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/default_hw_info.h"
 
@@ -19,8 +21,11 @@
 
 #include "gtest/gtest.h"
 
+#include <cstdio>
+#include <cstdlib>
 #include <fstream>
 #include <memory>
+#include <unistd.h>
 
 using namespace NEO;
 
@@ -53,6 +58,24 @@ TEST(DrmTest, GivenInvalidPciPathWhenFrequencyIsQueriedThenReturnError) {
     EXPECT_EQ(0, maxFrequency);
 }
 
+TEST(DrmTest, GivenPciPathWithNumaNodeWhenNumaNodeIsQueriedThenNodeReadFromSysFsIsReturned) {
+    auto executionEnvironment = std::make_unique<ExecutionEnvironment>();
+    executionEnvironment->prepareRootDeviceEnvironments(1);
+    DrmMock drm{*executionEnvironment->rootDeviceEnvironments[0]};
+
+    drm.setPciPath("device");
+    EXPECT_EQ(1, drm.getNumaNode());
+}
+
+TEST(DrmTest, GivenInvalidPciPathWhenNumaNodeIsQueriedThenMinusOneIsReturned) {
+    auto executionEnvironment = std::make_unique<ExecutionEnvironment>();
+    executionEnvironment->prepareRootDeviceEnvironments(1);
+    DrmMock drm{*executionEnvironment->rootDeviceEnvironments[0]};
+
+    drm.setPciPath("invalidPci");
+    EXPECT_EQ(-1, drm.getNumaNode());
+}
+
 TEST(DrmTest, WhenGettingRevisionIdThenCorrectIdIsReturned) {
     auto executionEnvironment = std::make_unique<ExecutionEnvironment>();
     executionEnvironment->prepareRootDeviceEnvironments(1);
@@ -139,6 +162,7 @@ TEST(DrmTest, givenDrmWhenOsContextIsCreatedThenCreateAndDestroyNewDrmOsContext)
 
     {
         OsContextLinux osContext1(drmMock, 0u, 1, EngineTypeUsage{aub_stream::ENGINE_RCS, EngineUsage::Regular}, PreemptionMode::Disabled, false);
+        osContext1.ensureContextInitialized();
 
         EXPECT_EQ(1u, osContext1.getDrmContextIds().size());
         EXPECT_EQ(drmMock.receivedCreateContextId, osContext1.getDrmContextIds()[0]);
@@ -146,6 +170,7 @@ TEST(DrmTest, givenDrmWhenOsContextIsCreatedThenCreateAndDestroyNewDrmOsContext)
 
         {
             OsContextLinux osContext2(drmMock, 0u, 1, EngineTypeUsage{aub_stream::ENGINE_RCS, EngineUsage::Regular}, PreemptionMode::Disabled, false);
+            osContext2.ensureContextInitialized();
             EXPECT_EQ(1u, osContext2.getDrmContextIds().size());
             EXPECT_EQ(drmMock.receivedCreateContextId, osContext2.getDrmContextIds()[0]);
             EXPECT_EQ(0u, drmMock.receivedDestroyContextId);
@@ -163,6 +188,7 @@ TEST(DrmTest, whenCreatingDrmContextWithVirtualMemoryAddressSpaceThenProperVmIdI
     ASSERT_EQ(1u, drmMock.virtualMemoryIds.size());
 
     OsContextLinux osContext(drmMock, 0u, 1, EngineTypeUsage{aub_stream::ENGINE_RCS, EngineUsage::Regular}, PreemptionMode::Disabled, false);
+    osContext.ensureContextInitialized();
 
     EXPECT_EQ(drmMock.receivedContextParamRequest.value, drmMock.getVirtualMemoryAddressSpace(0u));
 }
@@ -176,6 +202,7 @@ TEST(DrmTest, whenCreatingDrmContextWithNoVirtualMemoryAddressSpaceThenProperCon
     ASSERT_EQ(0u, drmMock.virtualMemoryIds.size());
 
     OsContextLinux osContext(drmMock, 0u, 1, EngineTypeUsage{aub_stream::ENGINE_RCS, EngineUsage::Regular}, PreemptionMode::Disabled, false);
+    osContext.ensureContextInitialized();
 
     EXPECT_EQ(0u, drmMock.receivedCreateContextId);
     EXPECT_EQ(0u, drmMock.receivedContextParamRequestCount);
@@ -192,6 +219,7 @@ TEST(DrmTest, givenDrmAndNegativeCheckNonPersistentContextsSupportWhenOsContextI
         drmMock.checkNonPersistentContextsSupport();
         expectedCount += 2;
         OsContextLinux osContext(drmMock, 0u, 1, EngineTypeUsage{aub_stream::ENGINE_RCS, EngineUsage::Regular}, PreemptionMode::Disabled, false);
+        osContext.ensureContextInitialized();
         EXPECT_EQ(expectedCount, drmMock.receivedContextParamRequestCount);
     }
     {
@@ -199,6 +227,7 @@ TEST(DrmTest, givenDrmAndNegativeCheckNonPersistentContextsSupportWhenOsContextI
         drmMock.checkNonPersistentContextsSupport();
         ++expectedCount;
         OsContextLinux osContext(drmMock, 0u, 1, EngineTypeUsage{aub_stream::ENGINE_RCS, EngineUsage::Regular}, PreemptionMode::Disabled, false);
+        osContext.ensureContextInitialized();
         expectedCount += 2;
         EXPECT_EQ(expectedCount, drmMock.receivedContextParamRequestCount);
     }
@@ -211,16 +240,20 @@ TEST(DrmTest, givenDrmPreemptionEnabledAndLowPriorityEngineWhenCreatingOsContext
     drmMock.preemptionSupported = false;
 
     OsContextLinux osContext1(drmMock, 0u, 1, EngineTypeUsage{aub_stream::ENGINE_RCS, EngineUsage::Regular}, PreemptionMode::Disabled, false);
+    osContext1.ensureContextInitialized();
     OsContextLinux osContext2(drmMock, 0u, 1, EngineTypeUsage{aub_stream::ENGINE_RCS, EngineUsage::LowPriority}, PreemptionMode::Disabled, false);
+    osContext2.ensureContextInitialized();
 
     EXPECT_EQ(2u, drmMock.receivedContextParamRequestCount);
 
     drmMock.preemptionSupported = true;
 
     OsContextLinux osContext3(drmMock, 0u, 1, EngineTypeUsage{aub_stream::ENGINE_RCS, EngineUsage::Regular}, PreemptionMode::Disabled, false);
+    osContext3.ensureContextInitialized();
     EXPECT_EQ(3u, drmMock.receivedContextParamRequestCount);
 
     OsContextLinux osContext4(drmMock, 0u, 1, EngineTypeUsage{aub_stream::ENGINE_RCS, EngineUsage::LowPriority}, PreemptionMode::Disabled, false);
+    osContext4.ensureContextInitialized();
     EXPECT_EQ(5u, drmMock.receivedContextParamRequestCount);
     EXPECT_EQ(drmMock.receivedCreateContextId, drmMock.receivedContextParamRequest.ctx_id);
     EXPECT_EQ(static_cast<uint64_t>(I915_CONTEXT_PARAM_PRIORITY), drmMock.receivedContextParamRequest.param);
@@ -228,12 +261,28 @@ TEST(DrmTest, givenDrmPreemptionEnabledAndLowPriorityEngineWhenCreatingOsContext
     EXPECT_EQ(0u, drmMock.receivedContextParamRequest.size);
 }
 
+TEST(DrmTest, givenDrmPreemptionEnabledAndHighPriorityEngineWhenCreatingOsContextThenHighContextPriorityIsRequested) {
+    auto executionEnvironment = std::make_unique<ExecutionEnvironment>();
+    executionEnvironment->prepareRootDeviceEnvironments(1);
+    DrmMock drmMock(*executionEnvironment->rootDeviceEnvironments[0]);
+    drmMock.preemptionSupported = true;
+
+    OsContextLinux osContext(drmMock, 0u, 1, EngineTypeUsage{aub_stream::ENGINE_RCS, EngineUsage::HighPriority}, PreemptionMode::Disabled, false);
+    EXPECT_FALSE(osContext.isDefaultContext());
+    osContext.ensureContextInitialized();
+    EXPECT_EQ(3u, drmMock.receivedContextParamRequestCount);
+    EXPECT_EQ(drmMock.receivedCreateContextId, drmMock.receivedContextParamRequest.ctx_id);
+    EXPECT_EQ(static_cast<uint64_t>(I915_CONTEXT_PARAM_PRIORITY), drmMock.receivedContextParamRequest.param);
+    EXPECT_EQ(static_cast<uint64_t>(1023), drmMock.receivedContextParamRequest.value);
+}
+
 TEST(DrmTest, givenDirectSubmissionEnabledOnBlitterWhenCreateBcsEngineThenLowPriorityIsSet) {
     auto executionEnvironment = std::make_unique<ExecutionEnvironment>();
     executionEnvironment->prepareRootDeviceEnvironments(1);
     DrmMock drmMock(*executionEnvironment->rootDeviceEnvironments[0]);
 
     OsContextLinux osContext(drmMock, 0u, 1, EngineTypeUsage{aub_stream::ENGINE_BCS, EngineUsage::Regular}, PreemptionMode::Disabled, false);
+    osContext.ensureContextInitialized();
     EXPECT_EQ(1u, drmMock.receivedContextParamRequestCount);
 
     DebugManagerStateRestore restorer;
@@ -241,6 +290,7 @@ TEST(DrmTest, givenDirectSubmissionEnabledOnBlitterWhenCreateBcsEngineThenLowPri
     DebugManager.flags.DirectSubmissionOverrideBlitterSupport.set(1);
 
     OsContextLinux osContext2(drmMock, 0u, 1, EngineTypeUsage{aub_stream::ENGINE_BCS, EngineUsage::Regular}, PreemptionMode::Disabled, false);
+    osContext2.ensureContextInitialized();
     EXPECT_EQ(3u, drmMock.receivedContextParamRequestCount);
     EXPECT_EQ(drmMock.receivedCreateContextId, drmMock.receivedContextParamRequest.ctx_id);
     EXPECT_EQ(static_cast<uint64_t>(I915_CONTEXT_PARAM_PRIORITY), drmMock.receivedContextParamRequest.param);
@@ -248,6 +298,7 @@ TEST(DrmTest, givenDirectSubmissionEnabledOnBlitterWhenCreateBcsEngineThenLowPri
     EXPECT_EQ(0u, drmMock.receivedContextParamRequest.size);
 
     OsContextLinux osContext3(drmMock, 0u, 1, EngineTypeUsage{aub_stream::ENGINE_RCS, EngineUsage::Regular}, PreemptionMode::Disabled, false);
+    osContext3.ensureContextInitialized();
     EXPECT_EQ(4u, drmMock.receivedContextParamRequestCount);
 }
 
@@ -414,6 +465,18 @@ TEST(DrmTest, givenPlatformWithSupportToChangeSliceCountWhenCallSetQueueSliceCou
     EXPECT_EQ(drm->getSliceMask(newSliceCount), sseu.slice_mask);
 }
 
+TEST(DrmTest, givenDefaultSliceCountWhenCallSetQueueSliceCountThenAllSlicesAreRequested) {
+    auto executionEnvironment = std::make_unique<ExecutionEnvironment>();
+    executionEnvironment->prepareRootDeviceEnvironments(1);
+    auto drm = std::make_unique<DrmMock>(*executionEnvironment->rootDeviceEnvironments[0]);
+    drm->StoredRetValForSetSSEU = 0;
+    drm->checkQueueSliceSupport();
+
+    EXPECT_TRUE(drm->setQueueSliceCount(QueueSliceCount::defaultSliceCount));
+    auto deviceSliceCount = executionEnvironment->rootDeviceEnvironments[0]->getHardwareInfo()->gtSystemInfo.SliceCount;
+    EXPECT_EQ(drm->getSliceMask(deviceSliceCount), drm->storedParamSseu);
+}
+
 namespace NEO {
 namespace SysCalls {
 extern uint32_t closeFuncCalled;
@@ -437,6 +500,7 @@ TEST(DrmTest, givenDrmWhenCreatingOsContextThenCreateDrmContextWithVmId) {
     executionEnvironment->prepareRootDeviceEnvironments(1);
     DrmMock drmMock(*executionEnvironment->rootDeviceEnvironments[0]);
     OsContextLinux osContext(drmMock, 0u, 1, EngineTypeUsage{aub_stream::ENGINE_RCS, EngineUsage::Regular}, PreemptionMode::Disabled, false);
+    osContext.ensureContextInitialized();
 
     EXPECT_EQ(SysCalls::vmId, drmMock.getVirtualMemoryAddressSpace(0));
 
@@ -452,9 +516,11 @@ TEST(DrmTest, givenDrmWithPerContextVMRequiredWhenCreatingOsContextsThenImplicit
     EXPECT_TRUE(drmMock.requirePerContextVM);
 
     OsContextLinux osContext1(drmMock, 0u, 1, EngineTypeUsage{aub_stream::ENGINE_RCS, EngineUsage::Regular}, PreemptionMode::Disabled, false);
+    osContext1.ensureContextInitialized();
     EXPECT_EQ(0u, drmMock.receivedCreateContextId);
 
     OsContextLinux osContext2(drmMock, 5u, 1, EngineTypeUsage{aub_stream::ENGINE_RCS, EngineUsage::Regular}, PreemptionMode::Disabled, false);
+    osContext2.ensureContextInitialized();
     EXPECT_EQ(0u, drmMock.receivedCreateContextId);
 }
 
@@ -468,6 +534,7 @@ TEST(DrmTest, givenDrmWithPerContextVMRequiredWhenCreatingOsContextsThenImplicit
     drmMock.StoredRetValForVmId = 20;
 
     OsContextLinux osContext(drmMock, 0u, 1, EngineTypeUsage{aub_stream::ENGINE_RCS, EngineUsage::Regular}, PreemptionMode::Disabled, false);
+    osContext.ensureContextInitialized();
     EXPECT_EQ(0u, drmMock.receivedCreateContextId);
     EXPECT_EQ(1u, drmMock.receivedContextParamRequestCount);
 
@@ -486,6 +553,7 @@ TEST(DrmTest, givenNoPerContextVmsDrmWhenCreatingOsContextsThenVmIdIsNotQueriedA
     drmMock.StoredRetValForVmId = 1;
 
     OsContextLinux osContext(drmMock, 0u, 1, EngineTypeUsage{aub_stream::ENGINE_RCS, EngineUsage::Regular}, PreemptionMode::Disabled, false);
+    osContext.ensureContextInitialized();
     EXPECT_EQ(0u, drmMock.receivedCreateContextId);
     EXPECT_EQ(1u, drmMock.receivedContextParamRequestCount);
 
@@ -505,6 +573,7 @@ TEST(DrmTest, givenProgramDebuggingAndContextDebugAvailableWhenCreatingContextTh
     drmMock.contextDebugSupported = true;
 
     OsContextLinux osContext(drmMock, 5u, 1, EngineTypeUsage{aub_stream::ENGINE_RCS, EngineUsage::Regular}, PreemptionMode::Disabled, false);
+    osContext.ensureContextInitialized();
 
     // drmMock returns ctxId == 0
     EXPECT_EQ(0u, drmMock.passedContextDebugId);
@@ -522,6 +591,56 @@ TEST(DrmTest, givenProgramDebuggingAndContextDebugAvailableWhenCreatingContextFo
     drmMock.contextDebugSupported = true;
 
     OsContextLinux osContext(drmMock, 5u, 1, EngineTypeUsage{aub_stream::ENGINE_RCS, EngineUsage::Internal}, PreemptionMode::Disabled, false);
+    osContext.ensureContextInitialized();
 
     EXPECT_EQ(static_cast<uint32_t>(-1), drmMock.passedContextDebugId);
 }
+
+TEST(DrmTest, givenTopologyQueriedOnceWhenQueryingTopologyAgainThenFirstResultIsReturnedWithoutQuery) {
+    auto executionEnvironment = std::make_unique<ExecutionEnvironment>();
+    executionEnvironment->prepareRootDeviceEnvironments(1);
+    DrmMock drmMock(*executionEnvironment->rootDeviceEnvironments[0]);
+
+    int sliceCount, subSliceCount, euCount;
+    EXPECT_TRUE(drmMock.queryTopology(*defaultHwInfo, sliceCount, subSliceCount, euCount));
+    auto expectedEuCount = euCount;
+
+    drmMock.StoredEUVal = 0;
+    EXPECT_TRUE(drmMock.queryTopology(*defaultHwInfo, sliceCount, subSliceCount, euCount));
+    EXPECT_EQ(expectedEuCount, euCount);
+}
+
+TEST(DrmTest, givenDevicesOnDifferentPciBusesWhenGettingTopologyCacheKeyThenKeysDiffer) {
+    auto executionEnvironment = std::make_unique<ExecutionEnvironment>();
+    executionEnvironment->prepareRootDeviceEnvironments(1);
+    DrmMock firstDrm(*executionEnvironment->rootDeviceEnvironments[0]);
+    DrmMock secondDrm(*executionEnvironment->rootDeviceEnvironments[0]);
+    firstDrm.setPciPath("0000:03:00.0");
+    secondDrm.setPciPath("0000:04:00.0");
+
+    EXPECT_NE(firstDrm.getTopologyCacheKey(), secondDrm.getTopologyCacheKey());
+}
+
+TEST(TopologyCacheTest, givenStoredEntryWhenLoadingWithSameKeyThenEntryIsReturnedAndDifferentKeyIsRejected) {
+    char cacheDirTemplate[] = "/tmp/topology_cache_XXXXXX";
+    ASSERT_NE(nullptr, mkdtemp(cacheDirTemplate));
+    TopologyCache topologyCache(cacheDirTemplate, "topologyCacheTest;1");
+    TopologyCache otherKernelCache(cacheDirTemplate, "topologyCacheTest;2");
+
+    TopologyCacheEntry entry;
+    entry.sliceCount = 1;
+    entry.subSliceCount = 6;
+    entry.euCount = 96;
+    ASSERT_TRUE(topologyCache.store(entry));
+
+    TopologyCacheEntry loadedEntry;
+    EXPECT_TRUE(topologyCache.load(loadedEntry));
+    EXPECT_EQ(1, loadedEntry.sliceCount);
+    EXPECT_EQ(6, loadedEntry.subSliceCount);
+    EXPECT_EQ(96, loadedEntry.euCount);
+
+    EXPECT_FALSE(otherKernelCache.load(loadedEntry));
+
+    std::remove(topologyCache.getFilePath().c_str());
+    rmdir(cacheDirTemplate);
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/linux/drm_userptr_cache.h"
+
+#include "test.h"
+
+using namespace NEO;
+
+namespace {
+BufferObject *fakeBo(uintptr_t value) {
+    return reinterpret_cast<BufferObject *>(value);
+}
+} // namespace
+
+TEST(DrmUserptrCacheTest, givenEmptyCacheWhenTakingRangeThenNullptrIsReturned) {
+    DrmUserptrCache cache(2u);
+    EXPECT_EQ(nullptr, cache.take(0u, 0x1000, 0x1000));
+    EXPECT_EQ(0u, cache.getSize());
+}
+
+TEST(DrmUserptrCacheTest, givenStoredBufferObjectWhenTakingSameRangeThenItIsReturnedOnlyOnce) {
+    DrmUserptrCache cache(2u);
+    EXPECT_EQ(nullptr, cache.store(0u, 0x1000, 0x2000, fakeBo(0x10)));
+    EXPECT_EQ(1u, cache.getSize());
+
+    EXPECT_EQ(nullptr, cache.take(0u, 0x1000, 0x1000));
+    EXPECT_EQ(nullptr, cache.take(1u, 0x1000, 0x2000));
+    EXPECT_EQ(fakeBo(0x10), cache.take(0u, 0x1000, 0x2000));
+    EXPECT_EQ(nullptr, cache.take(0u, 0x1000, 0x2000));
+    EXPECT_EQ(0u, cache.getSize());
+}
+
+TEST(DrmUserptrCacheTest, givenFullCacheWhenStoringThenLeastRecentlyStoredBufferObjectIsEvicted) {
+    DrmUserptrCache cache(2u);
+    EXPECT_EQ(nullptr, cache.store(0u, 0x1000, 0x1000, fakeBo(0x10)));
+    EXPECT_EQ(nullptr, cache.store(0u, 0x2000, 0x1000, fakeBo(0x20)));
+    EXPECT_EQ(fakeBo(0x10), cache.store(0u, 0x3000, 0x1000, fakeBo(0x30)));
+    EXPECT_EQ(2u, cache.getSize());
+
+    EXPECT_EQ(nullptr, cache.take(0u, 0x1000, 0x1000));
+    EXPECT_EQ(fakeBo(0x20), cache.take(0u, 0x2000, 0x1000));
+}
+
+TEST(DrmUserptrCacheTest, givenCachedBufferObjectsWhenTakingAllThenCacheIsEmptied) {
+    DrmUserptrCache cache(4u);
+    cache.store(0u, 0x1000, 0x1000, fakeBo(0x10));
+    cache.store(0u, 0x1000, 0x1000, fakeBo(0x20));
+
+    auto bos = cache.takeAll();
+    ASSERT_EQ(2u, bos.size());
+    EXPECT_EQ(fakeBo(0x10), bos[0]);
+    EXPECT_EQ(fakeBo(0x20), bos[1]);
+    EXPECT_EQ(0u, cache.getSize());
+}
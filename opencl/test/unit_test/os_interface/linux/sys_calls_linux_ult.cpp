@@ -24,6 +24,8 @@ namespace NEO {
 namespace SysCalls {
 uint32_t closeFuncCalled = 0u;
 int closeFuncArgPassed = 0;
+uint32_t dupFuncCalled = 0u;
+int dupFuncRetVal = 0;
 int dlOpenFlags = 0;
 bool dlOpenCalled = 0;
 constexpr int fakeFileDescriptor = 123;
@@ -40,6 +42,14 @@ int close(int fileDescriptor) {
     return 0;
 }
 
+int dup(int fileDescriptor) {
+    dupFuncCalled++;
+    if (dupFuncRetVal != 0) {
+        return dupFuncRetVal;
+    }
+    return fileDescriptor;
+}
+
 int open(const char *file, int flags) {
     if (strcmp(file, "/dev/dri/by-path/pci-0000:invalid-render") == 0) {
         return 0;
@@ -20,6 +20,7 @@
 #include "shared/source/os_interface/windows/wddm_memory_manager.h"
 #include "shared/source/os_interface/windows/wddm_memory_operations_handler.h"
 #include "shared/source/os_interface/windows/wddm_residency_controller.h"
+#include "shared/source/os_interface/windows/wddm_submission_worker.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/dispatch_flags_helper.h"
 #include "shared/test/common/mocks/mock_device.h"
@@ -99,6 +100,7 @@ struct MockWddmCsr : public WddmCommandStreamReceiver<GfxFamily> {
     using CommandStreamReceiverHw<GfxFamily>::directSubmission;
     using WddmCommandStreamReceiver<GfxFamily>::commandBufferHeader;
     using WddmCommandStreamReceiver<GfxFamily>::initDirectSubmission;
+    using WddmCommandStreamReceiver<GfxFamily>::submissionWorker;
     using WddmCommandStreamReceiver<GfxFamily>::WddmCommandStreamReceiver;
 
     void overrideDispatchPolicy(DispatchMode overrideValue) {
@@ -231,6 +233,57 @@ TEST_F(WddmCommandStreamTest, WhenFlushingThenFlushIsSubmitted) {
     memoryManager->freeGraphicsMemory(commandBuffer);
 }
 
+TEST_F(WddmCommandStreamTest, givenSubmissionWorkerEnabledWhenFlushingThenFenceIsReservedAndSubmitIsIssuedByWorker) {
+    DebugManager.flags.EnableWddmSubmissionWorker.set(1);
+    auto workerCsr = std::make_unique<MockWddmCsr<DEFAULT_TEST_FAMILY_NAME>>(*device->getExecutionEnvironment(), 0, device->getDeviceBitfield());
+    ASSERT_NE(nullptr, workerCsr->submissionWorker);
+    workerCsr->setupContext(*osContext);
+
+    GraphicsAllocation *commandBuffer = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize});
+    ASSERT_NE(nullptr, commandBuffer);
+    LinearStream cs(commandBuffer);
+    BatchBuffer batchBuffer{cs.getGraphicsAllocation(), 0, 0, nullptr, false, false, QueueThrottle::MEDIUM, QueueSliceCount::defaultSliceCount, cs.getUsed(), &cs, nullptr, false};
+
+    auto &monitoredFence = static_cast<OsContextWin *>(osContext.get())->getResidencyController().getMonitoredFence();
+    auto fenceValue = monitoredFence.currentFenceValue;
+    EXPECT_TRUE(workerCsr->flush(batchBuffer, workerCsr->getResidencyAllocations()));
+    EXPECT_EQ(fenceValue, monitoredFence.lastSubmittedFence);
+    EXPECT_EQ(fenceValue + 1, monitoredFence.currentFenceValue);
+    EXPECT_EQ(fenceValue, workerCsr->obtainCurrentFlushStamp());
+
+    workerCsr->submissionWorker->drain();
+    EXPECT_EQ(1u, wddm->submitResult.called);
+    EXPECT_EQ(commandBuffer->getGpuAddress(), wddm->submitResult.commandBufferSubmitted);
+    EXPECT_EQ(0u, workerCsr->submissionWorker->getFailedSubmissionsCount());
+
+    memoryManager->freeGraphicsMemory(commandBuffer);
+}
+
+TEST_F(WddmCommandStreamTest, givenSubmissionWorkerWhenSubmissionFailsThenLaterFlushesAndWaitsReportTheFailure) {
+    DebugManager.flags.EnableWddmSubmissionWorker.set(1);
+    auto workerCsr = std::make_unique<MockWddmCsr<DEFAULT_TEST_FAMILY_NAME>>(*device->getExecutionEnvironment(), 0, device->getDeviceBitfield());
+    ASSERT_NE(nullptr, workerCsr->submissionWorker);
+    workerCsr->setupContext(*osContext);
+
+    GraphicsAllocation *commandBuffer = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize});
+    ASSERT_NE(nullptr, commandBuffer);
+    LinearStream cs(commandBuffer);
+    BatchBuffer batchBuffer{cs.getGraphicsAllocation(), 0, 0, nullptr, false, false, QueueThrottle::MEDIUM, QueueSliceCount::defaultSliceCount, cs.getUsed(), &cs, nullptr, false};
+
+    wddm->forceSubmitFailure = true;
+    EXPECT_TRUE(workerCsr->flush(batchBuffer, workerCsr->getResidencyAllocations()));
+    workerCsr->submissionWorker->drain();
+    EXPECT_EQ(1u, workerCsr->submissionWorker->getFailedSubmissionsCount());
+
+    wddm->forceSubmitFailure = false;
+    FlushStamp flushStamp = workerCsr->obtainCurrentFlushStamp();
+    EXPECT_FALSE(workerCsr->waitForFlushStamp(flushStamp));
+    EXPECT_FALSE(workerCsr->flush(batchBuffer, workerCsr->getResidencyAllocations()));
+    EXPECT_EQ(1u, wddm->submitResult.called);
+
+    memoryManager->freeGraphicsMemory(commandBuffer);
+}
+
 TEST_F(WddmCommandStreamTest, givenPrintIndicesEnabledWhenFlushThenPrintIndices) {
     DebugManagerStateRestore restorer;
     DebugManager.flags.PrintDeviceAndEngineIdOnSubmission.set(true);
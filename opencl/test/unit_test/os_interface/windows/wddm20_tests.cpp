@@ -770,6 +770,29 @@ TEST_F(Wddm20Tests, WhenLastFenceGreaterThanMonitoredThenWaitFromCpuIsCalled) {
     EXPECT_NE(nullptr, gdi->getWaitFromCpuArg().ObjectHandleArray);
 }
 
+TEST_F(Wddm20Tests, givenFenceNotSignaledWhileSpinningWhenWaitingFromCpuThenKmdWaitIsCalledAndSpinWindowShrinks) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.WddmWaitFromCpuSpinTime.set(8);
+    *osContext->getResidencyController().getMonitoredFence().cpuAddress = 10;
+    gdi->getWaitFromCpuArg().ObjectCount = 0;
+
+    EXPECT_TRUE(wddm->waitFromCpu(20, osContext->getResidencyController().getMonitoredFence()));
+    EXPECT_EQ(1u, gdi->getWaitFromCpuArg().ObjectCount);
+    EXPECT_EQ(4, wddm->getWaitFromCpuSpinTime());
+}
+
+TEST_F(Wddm20Tests, givenSpinningDisabledWhenWaitingFromCpuThenSpinWindowIsNotUpdated) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.WddmWaitFromCpuSpinTime.set(0);
+    *osContext->getResidencyController().getMonitoredFence().cpuAddress = 10;
+    gdi->getWaitFromCpuArg().ObjectCount = 0;
+    auto spinTime = wddm->getWaitFromCpuSpinTime();
+
+    EXPECT_TRUE(wddm->waitFromCpu(20, osContext->getResidencyController().getMonitoredFence()));
+    EXPECT_EQ(1u, gdi->getWaitFromCpuArg().ObjectCount);
+    EXPECT_EQ(spinTime, wddm->getWaitFromCpuSpinTime());
+}
+
 TEST_F(Wddm20Tests, WhenCreatingMonitoredFenceThenItIsInitializedWithFenceValueZeroAndCurrentFenceValueIsSetToOne) {
     gdi->createSynchronizationObject2 = gdi->createSynchronizationObject2Mock;
 
@@ -144,6 +144,10 @@ TEST(WddmMemoryManagerWithDeferredDeleterTest, givenWmmWhenAsyncDeleterIsEnabled
     DebugManager.flags.EnableDeferredDeleter.set(actualDeleterFlag);
 }
 
+TEST_F(WddmMemoryManagerSimpleTest, givenWddmMemoryManagerThenSmallAllocationPoolingIsPreferred) {
+    EXPECT_TRUE(memoryManager->isSmallAllocationPoolingPreferred());
+}
+
 TEST_F(WddmMemoryManagerSimpleTest, givenMemoryManagerWhenAllocateGraphicsMemoryIsCalledThenMemoryPoolIsSystem4KBPages) {
     memoryManager.reset(new MockWddmMemoryManager(false, false, *executionEnvironment));
 
@@ -1750,6 +1754,52 @@ TEST_F(MockWddmMemoryManagerTest, givenRenderCompressedAllocationWhenMappedGpuVa
     EXPECT_TRUE(memcmp(&expectedDdiUpdateAuxTable, &givenDdiUpdateAuxTable, sizeof(GMM_DDI_UPDATEAUXTABLE)) == 0);
 }
 
+TEST_F(MockWddmMemoryManagerTest, givenBatchAuxTableUpdatesWhenRenderCompressedAllocationIsMappedThenAuxVaIsMappedOnFlush) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.BatchAuxTableUpdates.set(1);
+    auto rootDeviceEnvironment = executionEnvironment->rootDeviceEnvironments[1].get();
+    std::unique_ptr<Gmm> gmm(new Gmm(rootDeviceEnvironment->getGmmClientContext(), reinterpret_cast<void *>(123), 4096u, false));
+    gmm->isRenderCompressed = true;
+    D3DGPU_VIRTUAL_ADDRESS gpuVa = 0;
+    WddmMock wddm(*executionEnvironment->rootDeviceEnvironments[1].get());
+    wddm.init();
+
+    auto mockMngr = new NiceMock<MockGmmPageTableMngr>();
+    rootDeviceEnvironment->pageTableManager.reset(mockMngr);
+
+    EXPECT_CALL(*mockMngr, updateAuxTable(_)).Times(0);
+    auto result = wddm.mapGpuVirtualAddress(gmm.get(), ALLOCATION_HANDLE, wddm.getGfxPartition().Standard.Base, wddm.getGfxPartition().Standard.Limit, 0u, gpuVa);
+    ASSERT_TRUE(result);
+    ::testing::Mock::VerifyAndClearExpectations(mockMngr);
+
+    GMM_DDI_UPDATEAUXTABLE givenDdiUpdateAuxTable = {};
+    EXPECT_CALL(*mockMngr, updateAuxTable(_)).Times(1).WillOnce(Invoke([&](const GMM_DDI_UPDATEAUXTABLE *arg) {givenDdiUpdateAuxTable = *arg; return GMM_SUCCESS; }));
+    EXPECT_TRUE(mockMngr->flushPendingAuxTableUpdates());
+    EXPECT_EQ(gpuVa, givenDdiUpdateAuxTable.BaseGpuVA);
+    EXPECT_EQ(1u, givenDdiUpdateAuxTable.Map);
+
+    EXPECT_TRUE(mockMngr->flushPendingAuxTableUpdates());
+    EXPECT_FALSE(mockMngr->removePendingAuxTableMap(gpuVa));
+}
+
+TEST_F(MockWddmMemoryManagerTest, givenPendingAuxTableMapWhenRenderCompressedAllocationIsReleasedThenAuxTableIsNotUpdated) {
+    wddm->init();
+    WddmMemoryManager memoryManager(*executionEnvironment);
+    D3DGPU_VIRTUAL_ADDRESS gpuVa = 123;
+
+    auto mockMngr = new NiceMock<MockGmmPageTableMngr>();
+    executionEnvironment->rootDeviceEnvironments[1]->pageTableManager.reset(mockMngr);
+
+    auto wddmAlloc = static_cast<WddmAllocation *>(memoryManager.allocateGraphicsMemoryWithProperties(AllocationProperties(1, MemoryConstants::pageSize, GraphicsAllocation::AllocationType::INTERNAL_HOST_MEMORY, mockDeviceBitfield)));
+    wddmAlloc->setGpuAddress(gpuVa);
+    wddmAlloc->getDefaultGmm()->isRenderCompressed = true;
+    mockMngr->deferAuxTableMap(gpuVa, wddmAlloc->getDefaultGmm());
+
+    EXPECT_CALL(*mockMngr, updateAuxTable(_)).Times(0);
+    memoryManager.freeGraphicsMemory(wddmAlloc);
+    EXPECT_TRUE(mockMngr->flushPendingAuxTableUpdates());
+}
+
 TEST_F(MockWddmMemoryManagerTest, givenRenderCompressedAllocationWhenReleaseingThenUnmapAuxVa) {
     wddm->init();
     WddmMemoryManager memoryManager(*executionEnvironment);
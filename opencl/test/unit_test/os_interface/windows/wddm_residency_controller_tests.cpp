@@ -447,6 +447,26 @@ TEST_F(WddmResidencyControllerTest, WhenCompactingTrimCandidateListThenInitialNu
     EXPECT_EQ(1u, allocation4.getTrimCandidateListPosition(osContextId));
 }
 
+TEST_F(WddmResidencyControllerTest, GivenRemovedLeadingEntriesWhenGettingTrimCandidateHeadThenFirstRemainingAllocationIsReturned) {
+    MockWddmAllocation allocation1, allocation2, allocation3;
+
+    residencyController->addToTrimCandidateList(&allocation1);
+    residencyController->addToTrimCandidateList(&allocation2);
+    residencyController->addToTrimCandidateList(&allocation3);
+    EXPECT_EQ(&allocation1, residencyController->getTrimCandidateHead());
+
+    residencyController->removeFromTrimCandidateList(&allocation1, false);
+    EXPECT_EQ(&allocation2, residencyController->getTrimCandidateHead());
+    residencyController->removeFromTrimCandidateList(&allocation2, false);
+    EXPECT_EQ(&allocation3, residencyController->getTrimCandidateHead());
+
+    residencyController->removeFromTrimCandidateList(&allocation3, false);
+    EXPECT_EQ(nullptr, residencyController->getTrimCandidateHead());
+
+    residencyController->addToTrimCandidateList(&allocation2);
+    EXPECT_EQ(&allocation2, residencyController->getTrimCandidateHead());
+}
+
 TEST_F(WddmResidencyControllerTest, WhenCompactingTrimCandidateListThenNonNullEntriesAreNotRemoved) {
     MockWddmAllocation allocation1, allocation2, allocation3, allocation4;
 
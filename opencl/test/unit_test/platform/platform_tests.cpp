@@ -110,9 +110,10 @@ TEST_F(PlatformTest, givenSupportingCl21WhenGettingExtensionsStringThenSubgroups
     }
 }
 
-TEST_F(PlatformTest, givenMidThreadPreemptionWhenInitializingPlatformThenCallGetSipKernel) {
+TEST_F(PlatformTest, givenMidThreadPreemptionAndDeferredSipInitializationDisabledWhenInitializingPlatformThenCallGetSipKernel) {
     DebugManagerStateRestore dbgRestorer;
     DebugManager.flags.ForcePreemptionMode.set(static_cast<int32_t>(PreemptionMode::MidThread));
+    DebugManager.flags.DeferSipKernelInitialization.set(0);
 
     auto builtIns = new MockBuiltins();
     auto executionEnvironment = pPlatform->peekExecutionEnvironment();
@@ -126,6 +127,20 @@ TEST_F(PlatformTest, givenMidThreadPreemptionWhenInitializingPlatformThenCallGet
     EXPECT_TRUE(MockSipData::called);
 }
 
+TEST_F(PlatformTest, givenMidThreadPreemptionAndDefaultSettingsWhenInitializingPlatformThenSipKernelIsNotLoadedUntilFirstSubmission) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.ForcePreemptionMode.set(static_cast<int32_t>(PreemptionMode::MidThread));
+
+    auto builtIns = new MockBuiltins();
+    auto executionEnvironment = pPlatform->peekExecutionEnvironment();
+    executionEnvironment->prepareRootDeviceEnvironments(1);
+    executionEnvironment->rootDeviceEnvironments[0]->builtins.reset(builtIns);
+
+    pPlatform->initializeWithNewDevices();
+    EXPECT_EQ(SipKernelType::COUNT, MockSipData::calledType);
+    EXPECT_FALSE(MockSipData::called);
+}
+
 TEST_F(PlatformTest, givenDisabledPreemptionAndNoSourceLevelDebuggerWhenInitializingPlatformThenDoNotCallGetSipKernel) {
     DebugManagerStateRestore dbgRestorer;
     DebugManager.flags.ForcePreemptionMode.set(static_cast<int32_t>(PreemptionMode::Disabled));
@@ -421,6 +421,7 @@ INSTANTIATE_TEST_CASE_P(PrintfDoubleTest,
 
 std::pair<std::string, std::string> specialValues[] = {
     {"%%", "%"},
+    {"%%d", "%d"},
     {"nothing%", "nothing"},
 };
 
@@ -886,6 +887,25 @@ TEST_F(PrintFormatterTest, Given2ByteVectorsWhenPrintingThenDataBufferParsedProp
     EXPECT_STREQ("1,2,3,4 1,2,3,4", actualOutput);
 }
 
+TEST_F(PrintFormatterTest, GivenFormatStringUsedByManyPrintfCallsWhenPrintingThenEachCallIsFormattedWithItsOwnValues) {
+    auto stringIndex = injectFormatString("%d %u %X %lx %lld\\n");
+    for (int i = 0; i < 2; i++) {
+        storeData(stringIndex);
+        injectValue(-i);
+        injectValue(static_cast<uint32_t>(UINT32_MAX - i));
+        injectValue(0xABCD + i);
+        injectValue(static_cast<int64_t>(0xABCDEF012 + i));
+        injectValue(static_cast<int64_t>(INT64_MIN + i));
+    }
+
+    std::vector<std::string> actualOutputs;
+    printFormatter->printKernelOutput([&actualOutputs](char *str) { actualOutputs.push_back(str); });
+
+    ASSERT_EQ(2u, actualOutputs.size());
+    EXPECT_STREQ("0 4294967295 ABCD abcdef012 -9223372036854775808\n", actualOutputs[0].c_str());
+    EXPECT_STREQ("-1 4294967294 ABCE abcdef013 -9223372036854775807\n", actualOutputs[1].c_str());
+}
+
 TEST_F(PrintFormatterTest, GivenEmptyBufferWhenPrintingThenFailSafely) {
     char actualOutput[maxPrintfOutputLength];
     actualOutput[0] = 0;
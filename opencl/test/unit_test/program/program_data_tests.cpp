@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,6 +10,7 @@
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/program/program_info_from_patchtokens.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/unit_test/compiler_interface/linker_mock.h"
 #include "shared/test/unit_test/device_binary_format/patchtokens_tests.h"
 
@@ -675,3 +676,32 @@ TEST_F(ProgramDataTest, whenRelocationsAreNotNeededThenIsaIsPreserved) {
     delete buildInfo.constantSurface;
     buildInfo.constantSurface = nullptr;
 }
+
+TEST(ProgramProcessKernelsTest, givenMultipleWorkersWhenProcessingProgramInfoThenKernelAllocationIsCreatedForEachKernelInOrder) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ParallelKernelProcessingWorkers.set(4);
+
+    auto device = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
+    auto rootDeviceIndex = device->getRootDeviceIndex();
+    MockProgram program{nullptr, false, toClDeviceVector(*device)};
+
+    constexpr size_t kernelsCount = 16u;
+    std::vector<char> kernelHeap(32, 7);
+    ProgramInfo programInfo;
+    for (size_t i = 0; i < kernelsCount; i++) {
+        auto kernelInfo = new KernelInfo();
+        kernelInfo->kernelDescriptor.kernelMetadata.kernelName = "kernel" + std::to_string(i);
+        kernelInfo->heapInfo.pKernelHeap = kernelHeap.data();
+        kernelInfo->heapInfo.KernelHeapSize = static_cast<uint32_t>(kernelHeap.size());
+        programInfo.kernelInfos.push_back(kernelInfo);
+    }
+
+    EXPECT_EQ(CL_SUCCESS, program.processProgramInfo(programInfo, *device));
+
+    auto &kernelInfoArray = program.getKernelInfoArray(rootDeviceIndex);
+    ASSERT_EQ(kernelsCount, kernelInfoArray.size());
+    for (size_t i = 0; i < kernelsCount; i++) {
+        EXPECT_EQ("kernel" + std::to_string(i), kernelInfoArray[i]->kernelDescriptor.kernelMetadata.kernelName);
+        EXPECT_NE(nullptr, kernelInfoArray[i]->getGraphicsAllocation());
+    }
+}
@@ -610,6 +610,24 @@ HWTEST_F(glSharingTests, givenCommandQueueWhenReleaseGlObjectIsCalledThenFinishI
     clReleaseMemObject(glBuffer);
 }
 
+HWTEST_F(glSharingTests, givenGlReleaseFenceSyncAndReturnedEventWhenReleaseGlObjectIsCalledThenQueueIsFlushedInsteadOfFinished) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableGlReleaseFenceSync.set(true);
+    MockCommandQueueHw<FamilyType> mockCmdQueue(&context, context.getDevice(0), nullptr);
+    auto glBuffer = clCreateFromGLBuffer(&context, 0, bufferId, nullptr);
+
+    EXPECT_EQ(CL_SUCCESS, clEnqueueAcquireGLObjects(&mockCmdQueue, 1, &glBuffer, 0, nullptr, nullptr));
+    mockCmdQueue.taskCount = 5u;
+    mockCmdQueue.flushCalled = false;
+    cl_event retEvent = nullptr;
+    EXPECT_EQ(CL_SUCCESS, clEnqueueReleaseGLObjects(&mockCmdQueue, 1, &glBuffer, 0, nullptr, &retEvent));
+    EXPECT_TRUE(mockCmdQueue.flushCalled);
+    EXPECT_NE(5u, mockCmdQueue.latestTaskCountWaited);
+
+    clReleaseEvent(retEvent);
+    clReleaseMemObject(glBuffer);
+}
+
 TEST_F(glSharingTests, givenMockGLWhenFunctionsAreCalledThenCallsAreReceived) {
     auto ptrToStruct = &mockGlSharing->m_clGlResourceInfo;
     auto glDisplay = (GLDisplay)1;
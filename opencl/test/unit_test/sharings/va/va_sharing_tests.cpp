@@ -38,6 +38,13 @@
 
 using namespace NEO;
 
+namespace NEO {
+namespace SysCalls {
+extern uint32_t dupFuncCalled;
+extern int dupFuncRetVal;
+} // namespace SysCalls
+} // namespace NEO
+
 class VaSharingTests : public ::testing::Test, public PlatformFixture {
   public:
     void SetUp() override {
@@ -201,6 +208,36 @@ TEST(VaSharingTest, givenVASharingFunctionsObjectWhenFunctionsAreCalledThenCalls
     VASharingFunctionsGlobalFunctionPointersMock::getInstance(true);
 }
 
+TEST_F(VaSharingTests, givenSurfaceExportCacheEnabledWhenSameVaSurfaceIsSharedTwiceThenSurfaceIsExportedOnce) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableVaSurfaceExportCache.set(true);
+    VariableBackup<uint32_t> dupFuncCalledBackup(&SysCalls::dupFuncCalled, 0u);
+    auto &sharingFunctions = vaSharing->sharingFunctions;
+    sharingFunctions.haveExportSurfaceHandle = true;
+
+    for (int i = 0; i < 2; i++) {
+        sharingFunctions.exportSurfaceHandleCalled = false;
+        auto vaSurface = std::unique_ptr<Image>(VASurface::createSharedVaSurface(
+            &context, &sharingFunctions, CL_MEM_READ_WRITE, 0, &vaSurfaceId, 0, &errCode));
+        ASSERT_NE(nullptr, vaSurface);
+        EXPECT_EQ(i == 0, sharingFunctions.exportSurfaceHandleCalled);
+        EXPECT_EQ(256u, vaSurface->getImageDesc().image_width);
+        EXPECT_EQ(static_cast<uint32_t>(i + 1), SysCalls::dupFuncCalled);
+    }
+}
+
+TEST_F(VaSharingTests, givenSurfaceExportCacheEnabledWhenDuplicatingExportedFdFailsThenSurfaceIsNotCreated) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableVaSurfaceExportCache.set(true);
+    VariableBackup<int> dupFuncRetValBackup(&SysCalls::dupFuncRetVal, -1);
+    auto &sharingFunctions = vaSharing->sharingFunctions;
+    sharingFunctions.haveExportSurfaceHandle = true;
+
+    auto vaSurface = VASurface::createSharedVaSurface(&context, &sharingFunctions, CL_MEM_READ_WRITE, 0, &vaSurfaceId, 0, &errCode);
+    EXPECT_EQ(nullptr, vaSurface);
+    EXPECT_EQ(CL_OUT_OF_RESOURCES, errCode);
+}
+
 TEST_F(VaSharingTests, givenMockVaWithExportSurfaceHandlerWhenVaSurfaceIsCreatedThenCallHandlerWithDrmPrime2ToGetSurfaceFormatsInDescriptor) {
     vaSharing->sharingFunctions.haveExportSurfaceHandle = true;
 
@@ -402,6 +402,25 @@ TEST_F(TagAllocatorTest, givenEmptyFreeListWhenAskingForNewTagThenTryToReleaseDe
     EXPECT_TRUE(tagAllocator.freeTags.peekIsEmpty()); // empty again - new pool wasnt allocated
 }
 
+TEST_F(TagAllocatorTest, givenFreeTagsAvailableWhenAskingForNewTagThenDeferredListIsNotScanned) {
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 2, 1, deviceBitfield);
+    auto node = tagAllocator.getTag();
+
+    node->tagForCpuAccess->release = false;
+    tagAllocator.returnTag(node);
+    node->tagForCpuAccess->release = true;
+    EXPECT_FALSE(tagAllocator.deferredTags.peekIsEmpty());
+
+    auto newNode = tagAllocator.getTag();
+    EXPECT_NE(node, newNode);
+    EXPECT_FALSE(tagAllocator.deferredTags.peekIsEmpty());
+    EXPECT_EQ(1u, tagAllocator.getGraphicsAllocationsCount());
+
+    EXPECT_EQ(node, tagAllocator.getTag());
+    EXPECT_TRUE(tagAllocator.deferredTags.peekIsEmpty());
+    EXPECT_EQ(1u, tagAllocator.getGraphicsAllocationsCount());
+}
+
 TEST_F(TagAllocatorTest, givenTagsOnDeferredListWhenReleasingItThenMoveReadyTagsToFreePool) {
     MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 2, 1, deviceBitfield); // pool with 2 tags
     auto node1 = tagAllocator.getTag();
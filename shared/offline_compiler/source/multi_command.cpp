@@ -9,26 +9,34 @@
 
 #include "shared/offline_compiler/source/ocloc_fatbinary.h"
 #include "shared/source/utilities/const_stringref.h"
+#include "shared/source/utilities/parallel_for.h"
 
+#include <algorithm>
 #include <memory>
 
 namespace NEO {
-int MultiCommand::singleBuild(const std::vector<std::string> &args) {
-    int retVal = OfflineCompiler::ErrorCode::SUCCESS;
+void MultiCommand::prepareSingleBuild(SingleBuild &build) {
+    build.outDirForBuilds = outDirForBuilds;
+    build.fatBinary = requestedFatBinary(build.args);
+    if (build.fatBinary) {
+        build.outFileName = outFileName;
+        return;
+    }
+    build.compiler.reset(OfflineCompiler::create(build.args.size(), build.args, true, build.retVal, argHelper));
+    outFileName += ".bin";
+    build.outFileName = outFileName;
+}
 
-    if (requestedFatBinary(args)) {
-        retVal = buildFatBinary(args, argHelper);
-    } else {
-        std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(args.size(), args, true, retVal, argHelper)};
-        if (retVal == OfflineCompiler::ErrorCode::SUCCESS) {
-            retVal = buildWithSafetyGuard(pCompiler.get());
+int MultiCommand::finishSingleBuild(SingleBuild &build) {
+    int retVal = build.retVal;
 
-            std::string &buildLog = pCompiler->getBuildLog();
-            if (buildLog.empty() == false) {
-                argHelper->printf("%s\n", buildLog.c_str());
-            }
+    if (build.fatBinary) {
+        retVal = buildFatBinary(build.args, argHelper);
+    } else if (retVal == OfflineCompiler::ErrorCode::SUCCESS) {
+        std::string &buildLog = build.compiler->getBuildLog();
+        if (buildLog.empty() == false) {
+            argHelper->printf("%s\n", buildLog.c_str());
         }
-        outFileName += ".bin";
     }
     if (retVal == OfflineCompiler::ErrorCode::SUCCESS) {
         if (!quiet)
@@ -38,7 +46,7 @@ int MultiCommand::singleBuild(const std::vector<std::string> &args) {
     }
 
     if (retVal == OfflineCompiler::ErrorCode::SUCCESS) {
-        outputFile << getCurrentDirectoryOwn(outDirForBuilds) + outFileName;
+        outputFile << getCurrentDirectoryOwn(build.outDirForBuilds) + build.outFileName;
     } else {
         outputFile << "Unsuccesful build";
     }
@@ -102,6 +110,12 @@ int MultiCommand::initialize(const std::vector<std::string> &args) {
             pathToCommandFile = args[++argIndex];
         } else if (hasMoreArgs && ConstStringRef("-output_file_list") == currArg) {
             outputFileList = args[++argIndex];
+        } else if (hasMoreArgs && ConstStringRef("-j") == currArg) {
+            if (false == parseFatbinaryJobsCount(ConstStringRef(args[argIndex + 1]), jobsCount)) {
+                argHelper->printf("Invalid number of jobs : %s\n", args[argIndex + 1].c_str());
+                return OfflineCompiler::ErrorCode::INVALID_COMMAND_LINE;
+            }
+            ++argIndex;
         } else if (ConstStringRef("-q") == currArg) {
             quiet = true;
         } else {
@@ -132,22 +146,47 @@ int MultiCommand::initialize(const std::vector<std::string> &args) {
 }
 
 void MultiCommand::runBuilds(const std::string &argZero) {
-    for (size_t i = 0; i < lines.size(); ++i) {
-        std::vector<std::string> args = {argZero};
+    // Lines of a batch are prepared sequentially and built concurrently in separate compiler contexts.
+    // Messages of each line are buffered and printed in line order, so the output does not depend on the number of jobs.
+    for (size_t batchBegin = 0u; batchBegin < lines.size(); batchBegin += jobsCount) {
+        const size_t batchEnd = std::min(batchBegin + static_cast<size_t>(jobsCount), lines.size());
+        std::vector<SingleBuild> builds(batchEnd - batchBegin);
 
-        int retVal = splitLineInSeparateArgs(args, lines[i], i);
-        if (retVal != OfflineCompiler::ErrorCode::SUCCESS) {
-            retValues.push_back(retVal);
-            continue;
-        }
+        for (size_t i = batchBegin; i < batchEnd; ++i) {
+            auto &build = builds[i - batchBegin];
+            build.args = {argZero};
+            argHelper->setThreadPrinter(&build.output);
 
-        if (!quiet) {
-            argHelper->printf("Command numer %zu: \n", i + 1);
+            build.retVal = splitLineInSeparateArgs(build.args, lines[i], i);
+            if (build.retVal == OfflineCompiler::ErrorCode::SUCCESS) {
+                build.validLine = true;
+
+                if (!quiet) {
+                    argHelper->printf("Command numer %zu: \n", i + 1);
+                }
+
+                addAdditionalOptionsToSingleCommandLine(build.args, i);
+                prepareSingleBuild(build);
+            }
+            argHelper->setThreadPrinter(nullptr);
         }
 
-        addAdditionalOptionsToSingleCommandLine(args, i);
-        retVal = singleBuild(args);
-        retValues.push_back(retVal);
+        ParallelFor::run(builds.size(), jobsCount, [&](size_t buildId) {
+            auto &build = builds[buildId];
+            if (build.compiler && build.retVal == OfflineCompiler::ErrorCode::SUCCESS) {
+                argHelper->setThreadPrinter(&build.output);
+                build.retVal = buildWithSafetyGuard(build.compiler.get());
+                argHelper->setThreadPrinter(nullptr);
+            }
+        });
+
+        for (auto &build : builds) {
+            auto bufferedOutput = build.output.getLog().str();
+            if (!bufferedOutput.empty()) {
+                argHelper->printf("%s", bufferedOutput.c_str());
+            }
+            retValues.push_back(build.validLine ? finishSingleBuild(build) : build.retVal);
+        }
     }
 }
 
@@ -166,6 +205,12 @@ Usage: ocloc multi <file_name>
   -output_file_list             Name of optional file containing 
                                 paths to outputs .bin files
 
+  -j <jobs>                     Number of builds run concurrently,
+                                each in its own compiler context.
+                                Logs and results are still reported
+                                in the order of the file's lines.
+                                Default: 1.
+
 )===");
 }
 
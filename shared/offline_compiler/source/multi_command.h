@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -15,6 +15,7 @@
 #include <CL/cl.h>
 
 #include <iostream>
+#include <memory>
 #include <sstream>
 
 namespace NEO {
@@ -31,12 +32,24 @@ class MultiCommand {
     std::string outputFileList;
 
   protected:
+    struct SingleBuild {
+        std::vector<std::string> args;
+        std::string outDirForBuilds;
+        std::string outFileName;
+        std::unique_ptr<OfflineCompiler> compiler;
+        MessagePrinter output{true};
+        bool fatBinary = false;
+        bool validLine = false;
+        int retVal = OfflineCompiler::ErrorCode::SUCCESS;
+    };
+
     MultiCommand() = default;
 
     int initialize(const std::vector<std::string> &args);
     int splitLineInSeparateArgs(std::vector<std::string> &qargs, const std::string &command, size_t numberOfBuild);
     int showResults();
-    int singleBuild(const std::vector<std::string> &args);
+    void prepareSingleBuild(SingleBuild &build);
+    int finishSingleBuild(SingleBuild &build);
     void addAdditionalOptionsToSingleCommandLine(std::vector<std::string> &, size_t buildId);
     void printHelp();
     void runBuilds(const std::string &argZero);
@@ -48,5 +61,6 @@ class MultiCommand {
     std::string pathToCommandFile;
     std::stringstream outputFile;
     bool quiet = false;
+    uint32_t jobsCount = 1u;
 };
 } // namespace NEO
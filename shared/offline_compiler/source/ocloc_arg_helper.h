@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,7 +10,10 @@
 #include <cctype>
 #include <fstream>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 #pragma once
@@ -47,10 +50,14 @@ class OclocArgHelper {
     bool hasOutput = false;
     void moveOutputs();
     MessagePrinter messagePrinter;
+    std::mutex messagePrinterMutex;
+    std::unordered_map<std::thread::id, MessagePrinter *> threadPrinters;
+    std::mutex outputsMutex;
     Source *findSourceFile(const std::string &filename);
     bool sourceFileExists(const std::string &filename) const;
 
     inline void addOutput(const std::string &filename, const void *data, const size_t &size) {
+        std::lock_guard<std::mutex> lock(outputsMutex);
         outputs.push_back(new Output(filename, data, size));
     }
 
@@ -86,11 +93,28 @@ class OclocArgHelper {
     void saveOutput(const std::string &filename, const std::ostream &stream);
 
     MessagePrinter &getPrinterRef() { return messagePrinter; }
+    // messages printed by the calling thread go to threadPrinter until it is reset with nullptr
+    void setThreadPrinter(MessagePrinter *threadPrinter) {
+        std::lock_guard<std::mutex> lock(messagePrinterMutex);
+        if (threadPrinter) {
+            threadPrinters[std::this_thread::get_id()] = threadPrinter;
+        } else {
+            threadPrinters.erase(std::this_thread::get_id());
+        }
+    }
     void printf(const char *message) {
-        messagePrinter.printf(message);
+        std::lock_guard<std::mutex> lock(messagePrinterMutex);
+        getCurrentPrinter().printf(message);
     }
     template <typename... Args>
     void printf(const char *format, Args... args) {
-        messagePrinter.printf(format, std::forward<Args>(args)...);
+        std::lock_guard<std::mutex> lock(messagePrinterMutex);
+        getCurrentPrinter().printf(format, std::forward<Args>(args)...);
+    }
+
+  protected:
+    MessagePrinter &getCurrentPrinter() {
+        auto threadPrinter = threadPrinters.find(std::this_thread::get_id());
+        return (threadPrinter != threadPrinters.end()) ? *threadPrinter->second : messagePrinter;
     }
 };
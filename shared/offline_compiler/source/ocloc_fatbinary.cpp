@@ -13,10 +13,12 @@
 #include "shared/source/device_binary_format/ar/ar_encoder.h"
 #include "shared/source/helpers/file_io.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/utilities/parallel_for.h"
 
 #include "compiler_options.h"
 #include "igfxfmid.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
@@ -221,20 +223,46 @@ std::vector<ConstStringRef> getTargetPlatformsForFatbinary(ConstStringRef device
     return toProductNames(requestedPlatforms);
 }
 
+bool parseFatbinaryJobsCount(ConstStringRef jobsArg, uint32_t &outJobsCount) {
+    if (jobsArg.empty() || (jobsArg.size() > 4)) {
+        return false;
+    }
+    uint32_t jobsCount = 0u;
+    for (auto character : jobsArg) {
+        if ((character < '0') || (character > '9')) {
+            return false;
+        }
+        jobsCount = jobsCount * 10 + static_cast<uint32_t>(character - '0');
+    }
+    if (jobsCount == 0u) {
+        return false;
+    }
+    outJobsCount = jobsCount;
+    return true;
+}
+
 int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelper) {
     std::string pointerSizeInBits = (sizeof(void *) == 4) ? "32" : "64";
     size_t deviceArgIndex = -1;
+    size_t jobsArgIndex = -1;
+    uint32_t jobsCount = 1u;
     std::string inputFileName = "";
     std::string outputFileName = "";
     std::string outputDirectory = "";
 
-    std::vector<std::string> argsCopy(args);
     for (size_t argIndex = 1; argIndex < args.size(); argIndex++) {
         const auto &currArg = args[argIndex];
         const bool hasMoreArgs = (argIndex + 1 < args.size());
         if ((ConstStringRef("-device") == currArg) && hasMoreArgs) {
             deviceArgIndex = argIndex + 1;
             ++argIndex;
+        } else if ((ConstStringRef("-j") == currArg) && hasMoreArgs) {
+            if (false == parseFatbinaryJobsCount(ConstStringRef(args[argIndex + 1]), jobsCount)) {
+                argHelper->printf("Invalid number of jobs : %s\n", args[argIndex + 1].c_str());
+                return 1;
+            }
+            jobsArgIndex = argIndex;
+            ++argIndex;
         } else if ((CompilerOptions::arch32bit == currArg) || (ConstStringRef("-32") == currArg)) {
             pointerSizeInBits = "32";
         } else if ((CompilerOptions::arch64bit == currArg) || (ConstStringRef("-64") == currArg)) {
@@ -258,21 +286,50 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
         return 1;
     }
 
-    NEO::Ar::ArEncoder fatbinary(true);
+    std::vector<std::string> argsCopy(args);
+    size_t deviceArgIndexInCopy = deviceArgIndex;
+    if (jobsArgIndex < args.size()) {
+        argsCopy.erase(argsCopy.begin() + jobsArgIndex, argsCopy.begin() + jobsArgIndex + 2);
+        if (deviceArgIndexInCopy > jobsArgIndex) {
+            deviceArgIndexInCopy -= 2;
+        }
+    }
 
-    for (auto targetPlatform : targetPlatforms) {
-        int retVal = 0;
-        argsCopy[deviceArgIndex] = targetPlatform.str();
+    NEO::Ar::ArEncoder fatbinary(true);
 
-        std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(argsCopy.size(), argsCopy, false, retVal, argHelper)};
-        if (OfflineCompiler::ErrorCode::SUCCESS != retVal) {
-            argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
-            return retVal;
+    // Compilers of a batch are created sequentially, built concurrently in separate compiler contexts
+    // and reported in target order, so the archive content does not depend on the number of jobs.
+    const size_t batchSize = (jobsCount > 1u) ? targetPlatforms.size() : 1u;
+    for (size_t batchBegin = 0u; batchBegin < targetPlatforms.size(); batchBegin += batchSize) {
+        const size_t batchEnd = std::min(batchBegin + batchSize, targetPlatforms.size());
+        std::vector<std::vector<std::string>> targetArgs;
+        std::vector<std::unique_ptr<OfflineCompiler>> compilers;
+        targetArgs.reserve(batchEnd - batchBegin);
+        compilers.reserve(batchEnd - batchBegin);
+
+        for (size_t targetId = batchBegin; targetId < batchEnd; targetId++) {
+            int retVal = 0;
+            targetArgs.push_back(argsCopy);
+            targetArgs.back()[deviceArgIndexInCopy] = targetPlatforms[targetId].str();
+
+            std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(targetArgs.back().size(), targetArgs.back(), false, retVal, argHelper)};
+            if (OfflineCompiler::ErrorCode::SUCCESS != retVal) {
+                argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
+                return retVal;
+            }
+            compilers.push_back(std::move(pCompiler));
         }
 
-        auto stepping = pCompiler->getHardwareInfo().platform.usRevId;
-        if (retVal == 0) {
-            retVal = buildWithSafetyGuard(pCompiler.get());
+        std::vector<int> buildRetVals(compilers.size(), 0);
+        ParallelFor::run(compilers.size(), jobsCount, [&](size_t compilerId) {
+            buildRetVals[compilerId] = buildWithSafetyGuard(compilers[compilerId].get());
+        });
+
+        for (size_t compilerId = 0u; compilerId < compilers.size(); compilerId++) {
+            auto &pCompiler = compilers[compilerId];
+            auto targetPlatform = targetPlatforms[batchBegin + compilerId];
+            auto stepping = pCompiler->getHardwareInfo().platform.usRevId;
+            int retVal = buildRetVals[compilerId];
 
             std::string buildLog = pCompiler->getBuildLog();
             if (buildLog.empty() == false) {
@@ -285,17 +342,14 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
             } else {
                 argHelper->printf("Build failed for : %s with error code: %d\n", (targetPlatform.str() + "." + std::to_string(stepping)).c_str(), retVal);
                 argHelper->printf("Command was:");
-                for (const auto &arg : argsCopy)
+                for (const auto &arg : targetArgs[compilerId])
                     argHelper->printf(" %s", arg.c_str());
                 argHelper->printf("\n");
+                return retVal;
             }
-        }
 
-        if (0 != retVal) {
-            return retVal;
+            fatbinary.appendFileEntry(pointerSizeInBits + "." + targetPlatform.str() + "." + std::to_string(stepping), pCompiler->getPackedDeviceBinaryOutput());
         }
-
-        fatbinary.appendFileEntry(pointerSizeInBits + "." + targetPlatform.str() + "." + std::to_string(stepping), pCompiler->getPackedDeviceBinaryOutput());
     }
 
     auto fatbinaryData = fatbinary.encode();
@@ -769,7 +769,7 @@ void OfflineCompiler::printUsage() {
 Additionally, outputs intermediate representation (e.g. spirV).
 Different input and intermediate file formats are available.
 
-Usage: ocloc [compile] -file <filename> -device <device_type> [-output <filename>] [-out_dir <output_dir>] [-options <options>] [-32|-64] [-internal_options <options>] [-llvm_text|-llvm_input|-spirv_input] [-options_name] [-q] [-cpp_file] [-output_no_suffix] [--help]
+Usage: ocloc [compile] -file <filename> -device <device_type> [-output <filename>] [-out_dir <output_dir>] [-options <options>] [-32|-64] [-internal_options <options>] [-llvm_text|-llvm_input|-spirv_input] [-options_name] [-q] [-cpp_file] [-output_no_suffix] [-j <jobs>] [--help]
 
   -file <filename>              The input file to be compiled
                                 (by default input source format is
@@ -801,6 +801,10 @@ Usage: ocloc [compile] -file <filename> -device <device_type> [-output <filename
                                 -device *          ; will compile all targets
                                                      known to ocloc
 
+  -j <jobs>                     Number of targets compiled concurrently
+                                when multiple target devices are provided.
+                                Default is 1.
+
   -output <filename>            Optional output file base name.
                                 Default is input file's base name.
                                 This base name will be used for all output
@@ -9,6 +9,7 @@
 #include <cstdint>
 #include <cstdio>
 #include <fstream>
+#include <memory>
 #include <mutex>
 #include <string>
 
@@ -142,6 +143,10 @@ struct AubFileStream : public AubStream {
     MOCKABLE_VIRTUAL bool addComment(const char *message);
     MOCKABLE_VIRTUAL std::unique_lock<std::mutex> lockStream();
 
+    static constexpr size_t defaultWriteBufferSize = 4 * 1024 * 1024;
+
+    std::unique_ptr<char[]> writeBuffer;
+    size_t writeBufferSize = 0u;
     std::ofstream fileHandle;
     std::string fileName;
     std::mutex mutex;
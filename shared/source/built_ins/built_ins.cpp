@@ -14,6 +14,7 @@
 #include "shared/source/helpers/built_ins_helper.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/utilities/trace_events.h"
 
 #include "opencl/source/helpers/convert_color.h"
 #include "opencl/source/helpers/dispatch_info_builder.h"
@@ -37,6 +38,7 @@ const SipKernel &BuiltIns::getSipKernel(SipKernelType type, Device &device) {
     auto &sipBuiltIn = this->sipKernels[kernelId];
 
     auto initializer = [&] {
+        ScopedTraceEvent traceEvent("sipKernelLoad", TraceEvents::Category::initialization);
         std::vector<char> sipBinary;
         auto compilerInteface = device.getCompilerInterface();
         UNRECOVERABLE_IF(compilerInteface == nullptr);
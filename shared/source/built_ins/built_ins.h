@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,6 +10,7 @@
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/helpers/vec.h"
+#include "shared/source/utilities/arrayref.h"
 
 #include "built_in_ops.h"
 #include "compiler_options.h"
@@ -139,7 +140,14 @@ class BuiltinsLib {
     BuiltinsLib();
     BuiltinCode getBuiltinCode(EBuiltInOps::Type builtin, BuiltinCode::ECodeType requestedCodeType, Device &device);
 
+    // Built-ins compiled at first use can be kept in the compiler cache directory, keyed on the built-in, its build options
+    // and the platform (device id and revision). apiName separates binaries built with each API's internal options.
+    static bool isCompilerCacheEnabled();
+    MOCKABLE_VIRTUAL BuiltinCode getCachedBuiltinCode(EBuiltInOps::Type builtin, ConstStringRef options, ConstStringRef apiName, Device &device);
+    MOCKABLE_VIRTUAL bool cacheBuiltinBinary(EBuiltInOps::Type builtin, ConstStringRef options, ConstStringRef apiName, Device &device, ArrayRef<const char> binary);
+
   protected:
+    static std::string getBuiltinCacheKey(EBuiltInOps::Type builtin, ConstStringRef options, ConstStringRef apiName, const Device &device);
     BuiltinResourceT getBuiltinResource(EBuiltInOps::Type builtin, BuiltinCode::ECodeType requestedCodeType, Device &device);
 
     using StoragesContainerT = std::vector<std::unique_ptr<Storage>>;
@@ -6,6 +6,8 @@
  */
 
 #include "shared/source/built_ins/built_ins.h"
+#include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/helpers/api_specific_config.h"
@@ -14,6 +16,7 @@
 #include "os_inc.h"
 
 #include <cstdint>
+#include <cstring>
 
 namespace NEO {
 
@@ -208,4 +211,43 @@ BuiltinResourceT BuiltinsLib::getBuiltinResource(EBuiltInOps::Type builtin, Buil
     return bc;
 }
 
+bool BuiltinsLib::isCompilerCacheEnabled() {
+    return DebugManager.flags.EnableBuiltinsCompilerCache.get() == 1 && false == DebugManager.flags.RebuildPrecompiledKernels.get();
+}
+
+std::string BuiltinsLib::getBuiltinCacheKey(EBuiltInOps::Type builtin, ConstStringRef options, ConstStringRef apiName, const Device &device) {
+    auto builtinName = getBuiltinAsString(builtin);
+    return CompilerCache::getCachedFileName(device.getHardwareInfo(),
+                                            ArrayRef<const char>(builtinName, strlen(builtinName)),
+                                            ArrayRef<const char>(options.data(), options.size()),
+                                            ArrayRef<const char>(apiName.data(), apiName.size()));
+}
+
+BuiltinCode BuiltinsLib::getCachedBuiltinCode(EBuiltInOps::Type builtin, ConstStringRef options, ConstStringRef apiName, Device &device) {
+    BuiltinCode ret;
+    ret.type = BuiltinCode::ECodeType::INVALID;
+    ret.targetDevice = &device;
+
+    auto compilerInterface = device.getCompilerInterface();
+    if (false == isCompilerCacheEnabled() || nullptr == compilerInterface) {
+        return ret;
+    }
+
+    size_t binarySize = 0u;
+    auto binary = compilerInterface->loadCachedBinary(getBuiltinCacheKey(builtin, options, apiName, device), binarySize);
+    if (binary != nullptr && binarySize > 0u) {
+        ret.resource = createBuiltinResource(binary.get(), binarySize);
+        ret.type = BuiltinCode::ECodeType::Binary;
+    }
+    return ret;
+}
+
+bool BuiltinsLib::cacheBuiltinBinary(EBuiltInOps::Type builtin, ConstStringRef options, ConstStringRef apiName, Device &device, ArrayRef<const char> binary) {
+    auto compilerInterface = device.getCompilerInterface();
+    if (false == isCompilerCacheEnabled() || nullptr == compilerInterface || binary.empty()) {
+        return false;
+    }
+    return compilerInterface->cacheBinary(getBuiltinCacheKey(builtin, options, apiName, device), binary);
+}
+
 } // namespace NEO
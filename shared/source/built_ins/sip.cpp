@@ -8,6 +8,7 @@
 #include "shared/source/built_ins/sip.h"
 
 #include "shared/source/built_ins/built_ins.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/helpers/debug_helpers.h"
@@ -41,4 +42,12 @@ GraphicsAllocation *SipKernel::getSipKernelAllocation(Device &device) {
     auto sipType = SipKernel::getSipKernelType(device.getHardwareInfo().platform.eRenderCoreFamily, debuggingEnabled);
     return device.getBuiltIns()->getSipKernel(sipType, device).getSipAllocation();
 }
+
+bool SipKernel::isInitializationDeferred(bool debuggingActive) {
+    if (DebugManager.flags.DeferSipKernelInitialization.get() != -1) {
+        return !!DebugManager.flags.DeferSipKernelInitialization.get();
+    }
+    // debugger expects SIP to be resident before the first submission
+    return !debuggingActive;
+}
 } // namespace NEO
@@ -35,6 +35,8 @@ class SipKernel {
     MOCKABLE_VIRTUAL GraphicsAllocation *getSipAllocation() const;
     static SipKernelType getSipKernelType(GFXCORE_FAMILY family, bool debuggingActive);
     static GraphicsAllocation *getSipKernelAllocation(Device &device);
+    // when deferred, SIP is loaded by the first submission that programs STATE_SIP
+    static bool isInitializationDeferred(bool debuggingActive);
 
   protected:
     SipKernelType type = SipKernelType::COUNT;
@@ -10,6 +10,7 @@
 #include "shared/source/command_container/command_encoder.h"
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/command_stream/linear_stream.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/helpers/api_specific_config.h"
 #include "shared/source/helpers/debug_helpers.h"
@@ -18,6 +19,8 @@
 #include "shared/source/indirect_heap/indirect_heap.h"
 #include "shared/source/memory_manager/memory_manager.h"
 
+#include <algorithm>
+
 namespace NEO {
 
 CommandContainer::~CommandContainer() {
@@ -148,6 +151,87 @@ void CommandContainer::reset() {
     nextIddInBlock = this->getNumIddPerBlock();
     lastSentNumGrfRequired = 0;
     lastPipelineSelectModeRequired = false;
+    lastBindingTableHeap = nullptr;
+    lastIndirectDataHeap = nullptr;
+    reusableSamplerStatesHeap = nullptr;
+    reusableSamplerStatesCount = 0u;
+    nextReusableSamplerStatesIndex = 0u;
+}
+
+bool CommandContainer::getReusableBindingTable(const void *sshData, size_t sshSize, uint32_t &bindingTablePointer) const {
+    if (DebugManager.flags.ReuseBindingTablesOfRepeatedDispatches.get() == 0 ||
+        lastBindingTableHeap == nullptr ||
+        lastBindingTableHeap != allocationIndirectHeaps[HeapType::SURFACE_STATE] ||
+        lastBindingTableSshData.size() != sshSize ||
+        memcmp(lastBindingTableSshData.data(), sshData, sshSize) != 0) {
+        return false;
+    }
+    bindingTablePointer = lastBindingTablePointer;
+    return true;
+}
+
+void CommandContainer::storeReusableBindingTable(const void *sshData, size_t sshSize, uint32_t bindingTablePointer) {
+    lastBindingTableHeap = allocationIndirectHeaps[HeapType::SURFACE_STATE];
+    lastBindingTablePointer = bindingTablePointer;
+    auto data = reinterpret_cast<const uint8_t *>(sshData);
+    lastBindingTableSshData.assign(data, data + sshSize);
+}
+
+bool CommandContainer::getReusableSamplerStates(const void *samplerData, size_t samplerDataSize, uint32_t borderColorSize, uint32_t &samplerStateOffset) const {
+    if (DebugManager.flags.ReuseSamplerStatesOfRepeatedDispatches.get() == 0 ||
+        reusableSamplerStatesHeap == nullptr ||
+        reusableSamplerStatesHeap != allocationIndirectHeaps[HeapType::DYNAMIC_STATE]) {
+        return false;
+    }
+    for (size_t i = 0; i < reusableSamplerStatesCount; i++) {
+        auto &entry = reusableSamplerStates[i];
+        if (entry.borderColorSize == borderColorSize &&
+            entry.samplerData.size() == samplerDataSize &&
+            memcmp(entry.samplerData.data(), samplerData, samplerDataSize) == 0) {
+            samplerStateOffset = entry.samplerStateOffset;
+            return true;
+        }
+    }
+    return false;
+}
+
+void CommandContainer::storeReusableSamplerStates(const void *samplerData, size_t samplerDataSize, uint32_t borderColorSize, uint32_t samplerStateOffset) {
+    if (reusableSamplerStatesHeap != allocationIndirectHeaps[HeapType::DYNAMIC_STATE]) {
+        reusableSamplerStatesHeap = allocationIndirectHeaps[HeapType::DYNAMIC_STATE];
+        reusableSamplerStatesCount = 0u;
+        nextReusableSamplerStatesIndex = 0u;
+    }
+    auto data = reinterpret_cast<const uint8_t *>(samplerData);
+    auto &entry = reusableSamplerStates[nextReusableSamplerStatesIndex];
+    entry.samplerData.assign(data, data + samplerDataSize);
+    entry.borderColorSize = borderColorSize;
+    entry.samplerStateOffset = samplerStateOffset;
+    nextReusableSamplerStatesIndex = (nextReusableSamplerStatesIndex + 1) % maxReusableSamplerStates;
+    reusableSamplerStatesCount = std::min(reusableSamplerStatesCount + 1, maxReusableSamplerStates);
+}
+
+bool CommandContainer::getReusableIndirectData(const void *crossThreadData, size_t crossThreadDataSize, const void *perThreadData, size_t perThreadDataSize, uint64_t &indirectDataOffset) const {
+    if (DebugManager.flags.ReuseIndirectDataOfRepeatedDispatches.get() == 0 ||
+        lastIndirectDataHeap == nullptr ||
+        lastIndirectDataHeap != allocationIndirectHeaps[HeapType::INDIRECT_OBJECT] ||
+        lastIndirectCrossThreadDataSize != crossThreadDataSize ||
+        lastIndirectData.size() != crossThreadDataSize + perThreadDataSize ||
+        memcmp(lastIndirectData.data(), crossThreadData, crossThreadDataSize) != 0 ||
+        memcmp(lastIndirectData.data() + crossThreadDataSize, perThreadData, perThreadDataSize) != 0) {
+        return false;
+    }
+    indirectDataOffset = lastIndirectDataOffset;
+    return true;
+}
+
+void CommandContainer::storeReusableIndirectData(const void *crossThreadData, size_t crossThreadDataSize, const void *perThreadData, size_t perThreadDataSize, uint64_t indirectDataOffset) {
+    lastIndirectDataHeap = allocationIndirectHeaps[HeapType::INDIRECT_OBJECT];
+    lastIndirectDataOffset = indirectDataOffset;
+    lastIndirectCrossThreadDataSize = crossThreadDataSize;
+    auto data = reinterpret_cast<const uint8_t *>(crossThreadData);
+    lastIndirectData.assign(data, data + crossThreadDataSize);
+    data = reinterpret_cast<const uint8_t *>(perThreadData);
+    lastIndirectData.insert(lastIndirectData.end(), data, data + perThreadDataSize);
 }
 
 void *CommandContainer::getHeapSpaceAllowGrow(HeapType heapType,
@@ -11,6 +11,7 @@
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/indirect_heap/indirect_heap.h"
 
+#include <array>
 #include <cstdint>
 #include <limits>
 #include <memory>
@@ -87,6 +88,7 @@ class CommandContainer : public NonCopyableOrMovableClass {
     uint32_t nextIddInBlock = 0;
     uint32_t lastSentNumGrfRequired = 0;
     bool lastPipelineSelectModeRequired = false;
+    bool keepSlmEnabledL3Config = false;
 
     Device *getDevice() const { return device; }
 
@@ -105,6 +107,16 @@ class CommandContainer : public NonCopyableOrMovableClass {
     void setReservedSshSize(size_t reserveSize) {
         reservedSshSize = reserveSize;
     }
+    // dispatches pushing the same surface states as the previous one share its binding table,
+    // which keeps the 64KB bindful SSH from filling up and forcing new state base addresses
+    bool getReusableBindingTable(const void *sshData, size_t sshSize, uint32_t &bindingTablePointer) const;
+    void storeReusableBindingTable(const void *sshData, size_t sshSize, uint32_t bindingTablePointer);
+    // the GPU only reads the indirect data, so repeated dispatches with the same payload can point to one copy
+    bool getReusableIndirectData(const void *crossThreadData, size_t crossThreadDataSize, const void *perThreadData, size_t perThreadDataSize, uint64_t &indirectDataOffset) const;
+    void storeReusableIndirectData(const void *crossThreadData, size_t crossThreadDataSize, const void *perThreadData, size_t perThreadDataSize, uint64_t indirectDataOffset);
+    // pipelines alternate between kernels, so sampler states of several recent dispatches are kept for reuse
+    bool getReusableSamplerStates(const void *samplerData, size_t samplerDataSize, uint32_t borderColorSize, uint32_t &samplerStateOffset) const;
+    void storeReusableSamplerStates(const void *samplerData, size_t samplerDataSize, uint32_t borderColorSize, uint32_t samplerStateOffset);
     HeapContainer sshAllocations;
 
   protected:
@@ -120,6 +132,27 @@ class CommandContainer : public NonCopyableOrMovableClass {
     uint32_t numIddsPerBlock = 64;
     size_t reservedSshSize = 0;
 
+    GraphicsAllocation *lastBindingTableHeap = nullptr;
+    uint32_t lastBindingTablePointer = 0u;
+    std::vector<uint8_t> lastBindingTableSshData;
+
+    GraphicsAllocation *lastIndirectDataHeap = nullptr;
+    uint64_t lastIndirectDataOffset = 0u;
+    size_t lastIndirectCrossThreadDataSize = 0u;
+    std::vector<uint8_t> lastIndirectData;
+
+    struct ReusableSamplerStates {
+        std::vector<uint8_t> samplerData;
+        uint32_t borderColorSize = 0u;
+        uint32_t samplerStateOffset = 0u;
+    };
+    static constexpr size_t maxReusableSamplerStates = 8u;
+    GraphicsAllocation *reusableSamplerStatesHeap = nullptr;
+    // ring of entries, the oldest one is overwritten so its sampler data storage is reused
+    std::array<ReusableSamplerStates, maxReusableSamplerStates> reusableSamplerStates;
+    size_t reusableSamplerStatesCount = 0u;
+    size_t nextReusableSamplerStatesIndex = 0u;
+
     std::unique_ptr<LinearStream> commandStream;
     std::unique_ptr<IndirectHeap> indirectHeaps[HeapType::NUM_TYPES];
     ResidencyContainer residencyContainer;
@@ -23,6 +23,12 @@ struct HardwareInfo;
 class IndirectHeap;
 class BindlessHeapsHelper;
 
+struct EncodedDispatchLocations {
+    void *walkerCmd = nullptr;
+    void *crossThreadData = nullptr;
+    void *surfaceStates = nullptr;
+};
+
 template <typename GfxFamily>
 struct EncodeDispatchKernel {
     using WALKER_TYPE = typename GfxFamily::WALKER_TYPE;
@@ -40,7 +46,8 @@ struct EncodeDispatchKernel {
                        PreemptionMode preemptionMode,
                        bool &requiresUncachedMocs,
                        uint32_t &partitionCount,
-                       bool isInternal);
+                       bool isInternal,
+                       EncodedDispatchLocations *outLocations = nullptr);
 
     static void encodeAdditionalWalkerFields(const HardwareInfo &hwInfo, WALKER_TYPE &walkerCmd);
 
@@ -117,6 +124,10 @@ struct EncodeMath {
                          AluRegisters firstOperandRegister,
                          AluRegisters secondOperandRegister,
                          AluRegisters finalResultRegister);
+    static void subtraction(CommandContainer &container,
+                            AluRegisters firstOperandRegister,
+                            AluRegisters secondOperandRegister,
+                            AluRegisters finalResultRegister);
     static void bitwiseAnd(CommandContainer &container,
                            AluRegisters firstOperandRegister,
                            AluRegisters secondOperandRegister,
@@ -149,12 +160,27 @@ struct EncodeMathMMIO {
                              AluRegisters secondOperandRegister,
                              AluRegisters finalResultRegister);
 
+    static void encodeAluSub(MI_MATH_ALU_INST_INLINE *pAluParam,
+                             AluRegisters firstOperandRegister,
+                             AluRegisters secondOperandRegister,
+                             AluRegisters finalResultRegister);
+
     static void encodeAluAnd(MI_MATH_ALU_INST_INLINE *pAluParam,
                              AluRegisters firstOperandRegister,
                              AluRegisters secondOperandRegister,
                              AluRegisters finalResultRegister);
 };
 
+template <typename GfxFamily>
+struct EncodeDurationHistogram {
+    // samples the global timestamp into CS_GPR_R8, has to precede encodeUpdate in the same batch
+    static void encodeStart(CommandContainer &container);
+
+    // buckets are 32-bit counters, bucket i < bucketCount - 1 counts durations shorter than
+    // thresholds[i] timestamp ticks, the last bucket counts all durations; uses CS_GPR_R8 - R13
+    static void encodeUpdate(CommandContainer &container, uint64_t bucketsAddress, const uint32_t *thresholds, uint32_t bucketCount);
+};
+
 template <typename GfxFamily>
 struct EncodeIndirectParams {
     using MI_LOAD_REGISTER_IMM = typename GfxFamily::MI_LOAD_REGISTER_IMM;
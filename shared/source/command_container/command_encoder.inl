@@ -23,8 +23,10 @@
 #include "shared/source/image/image_surface_state.h"
 #include "shared/source/kernel/dispatch_kernel_encoder_interface.h"
 #include "shared/source/kernel/kernel_descriptor.h"
+#include "shared/source/utilities/stackvec.h"
 
 #include <algorithm>
+#include <limits>
 
 namespace NEO {
 
@@ -67,17 +69,26 @@ uint32_t EncodeStates<Family>::copySamplerState(IndirectHeap *dsh,
             borderColorOffsetInDsh = bindlessHeapHelper->getAlphaBorderColorOffset();
         }
         dsh->align(INTERFACE_DESCRIPTOR_DATA::SAMPLERSTATEPOINTER_ALIGN_SIZE);
-        auto samplerStateInDsh = bindlessHeapHelper->allocateSSInHeap(sizeSamplerState, nullptr, BindlessHeapsHelper::BindlesHeapType::GLOBAL_DSH);
-        dstSamplerState = reinterpret_cast<SAMPLER_STATE *>(samplerStateInDsh.ssPtr);
-        samplerStateOffsetInDsh = static_cast<uint32_t>(samplerStateInDsh.surfaceStateOffset);
     }
 
+    // in bindless mode states are built locally, so dispatches with the same samplers share one copy in the global DSH
+    StackVec<SAMPLER_STATE, 16> bindlessSamplerStates;
+
     auto srcSamplerState = reinterpret_cast<const SAMPLER_STATE *>(ptrOffset(fnDynamicStateHeap, samplerStateOffset));
     SAMPLER_STATE state = {};
     for (uint32_t i = 0; i < samplerCount; i++) {
         state = srcSamplerState[i];
         state.setIndirectStatePointer(static_cast<uint32_t>(borderColorOffsetInDsh));
-        dstSamplerState[i] = state;
+        if (dstSamplerState != nullptr) {
+            dstSamplerState[i] = state;
+        } else {
+            bindlessSamplerStates.push_back(state);
+        }
+    }
+
+    if (!bindlessSamplerStates.empty()) {
+        auto samplerStateInDsh = bindlessHeapHelper->allocateSamplerStatesInHeap(bindlessSamplerStates.begin(), sizeSamplerState);
+        samplerStateOffsetInDsh = static_cast<uint32_t>(samplerStateInDsh.surfaceStateOffset);
     }
 
     return samplerStateOffsetInDsh;
@@ -218,6 +229,14 @@ void EncodeMathMMIO<Family>::encodeAluAdd(MI_MATH_ALU_INST_INLINE *pAluParam,
     encodeAlu(pAluParam, firstOperandRegister, secondOperandRegister, AluRegisters::OPCODE_ADD, finalResultRegister, AluRegisters::R_ACCU);
 }
 
+template <typename Family>
+void EncodeMathMMIO<Family>::encodeAluSub(MI_MATH_ALU_INST_INLINE *pAluParam,
+                                          AluRegisters firstOperandRegister,
+                                          AluRegisters secondOperandRegister,
+                                          AluRegisters finalResultRegister) {
+    encodeAlu(pAluParam, firstOperandRegister, secondOperandRegister, AluRegisters::OPCODE_SUB, finalResultRegister, AluRegisters::R_ACCU);
+}
+
 template <typename Family>
 void EncodeMathMMIO<Family>::encodeAluSubStoreCarry(MI_MATH_ALU_INST_INLINE *pAluParam, AluRegisters regA, AluRegisters regB, AluRegisters finalResultRegister) {
     /* regB is subtracted from regA */
@@ -263,6 +282,20 @@ void EncodeMath<Family>::addition(CommandContainer &container,
                                          finalResultRegister);
 }
 
+template <typename Family>
+void EncodeMath<Family>::subtraction(CommandContainer &container,
+                                     AluRegisters firstOperandRegister,
+                                     AluRegisters secondOperandRegister,
+                                     AluRegisters finalResultRegister) {
+    uint32_t *cmd = EncodeMath<Family>::commandReserve(container);
+
+    /* secondOperandRegister will be subtracted from firstOperandRegister */
+    EncodeMathMMIO<Family>::encodeAluSub(reinterpret_cast<MI_MATH_ALU_INST_INLINE *>(cmd),
+                                         firstOperandRegister,
+                                         secondOperandRegister,
+                                         finalResultRegister);
+}
+
 template <typename Family>
 void EncodeMath<Family>::bitwiseAnd(CommandContainer &container,
                                     AluRegisters firstOperandRegister,
@@ -276,6 +309,41 @@ void EncodeMath<Family>::bitwiseAnd(CommandContainer &container,
                                          finalResultRegister);
 }
 
+template <typename Family>
+void EncodeDurationHistogram<Family>::encodeStart(CommandContainer &container) {
+    EncodeSetMMIO<Family>::encodeREG(container, CS_GPR_R8, REG_GLOBAL_TIMESTAMP_LDW);
+    EncodeSetMMIO<Family>::encodeIMM(container, CS_GPR_R8 + 4, 0u, true);
+}
+
+template <typename Family>
+void EncodeDurationHistogram<Family>::encodeUpdate(CommandContainer &container, uint64_t bucketsAddress, const uint32_t *thresholds, uint32_t bucketCount) {
+    EncodeSetMMIO<Family>::encodeREG(container, CS_GPR_R9, REG_GLOBAL_TIMESTAMP_LDW);
+    EncodeSetMMIO<Family>::encodeIMM(container, CS_GPR_R9 + 4, 0u, true);
+    EncodeSetMMIO<Family>::encodeIMM(container, CS_GPR_R10, 1u, true);
+    EncodeSetMMIO<Family>::encodeIMM(container, CS_GPR_R10 + 4, 0u, true);
+    EncodeSetMMIO<Family>::encodeIMM(container, CS_GPR_R11, std::numeric_limits<uint32_t>::max(), true);
+    EncodeSetMMIO<Family>::encodeIMM(container, CS_GPR_R11 + 4, 0u, true);
+
+    /* duration is kept modulo 2^32, so a wrap of the low timestamp dword between samples is handled */
+    EncodeMath<Family>::subtraction(container, AluRegisters::R_9, AluRegisters::R_8, AluRegisters::R_9);
+    EncodeMath<Family>::bitwiseAnd(container, AluRegisters::R_9, AluRegisters::R_11, AluRegisters::R_9);
+
+    for (uint32_t i = 0; i < bucketCount; i++) {
+        auto bucketAddress = bucketsAddress + i * sizeof(uint32_t);
+        EncodeSetMMIO<Family>::encodeMEM(container, CS_GPR_R12, bucketAddress);
+        if (i + 1 < bucketCount) {
+            /* R13 is 1 when the threshold is greater than the duration */
+            EncodeSetMMIO<Family>::encodeIMM(container, CS_GPR_R11, thresholds[i], true);
+            EncodeMath<Family>::greaterThan(container, AluRegisters::R_11, AluRegisters::R_9, AluRegisters::R_13);
+            EncodeMath<Family>::bitwiseAnd(container, AluRegisters::R_13, AluRegisters::R_10, AluRegisters::R_13);
+            EncodeMath<Family>::addition(container, AluRegisters::R_12, AluRegisters::R_13, AluRegisters::R_12);
+        } else {
+            EncodeMath<Family>::addition(container, AluRegisters::R_12, AluRegisters::R_10, AluRegisters::R_12);
+        }
+        EncodeStoreMMIO<Family>::encode(*container.getCommandStream(), CS_GPR_R12, bucketAddress);
+    }
+}
+
 template <typename Family>
 inline void EncodeSetMMIO<Family>::encodeIMM(CommandContainer &container, uint32_t offset, uint32_t data, bool remap) {
     LriHelper<Family>::program(container.getCommandStream(),
@@ -16,6 +16,7 @@
 #include "shared/source/helpers/simd_helper.h"
 #include "shared/source/helpers/state_base_address.h"
 #include "shared/source/kernel/dispatch_kernel_encoder_interface.h"
+#include "shared/source/kernel/grf_config.h"
 
 #include "pipe_control_args.h"
 
@@ -26,7 +27,7 @@ template <typename Family>
 void EncodeDispatchKernel<Family>::encode(CommandContainer &container,
                                           const void *pThreadGroupDimensions, bool isIndirect, bool isPredicate, DispatchKernelEncoderI *dispatchInterface,
                                           uint64_t eventAddress, bool isTimestampEvent, Device *device, PreemptionMode preemptionMode, bool &requiresUncachedMocs,
-                                          uint32_t &partitionCount, bool isInternal) {
+                                          uint32_t &partitionCount, bool isInternal, EncodedDispatchLocations *outLocations) {
 
     using MEDIA_STATE_FLUSH = typename Family::MEDIA_STATE_FLUSH;
     using MEDIA_INTERFACE_DESCRIPTOR_LOAD = typename Family::MEDIA_INTERFACE_DESCRIPTOR_LOAD;
@@ -60,34 +61,57 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container,
     WALKER_TYPE cmd = Family::cmdInitGpgpuWalker;
     auto idd = Family::cmdInitInterfaceDescriptorData;
 
-    {
+    uint32_t bindingTableStateCount = kernelDescriptor.payloadMappings.bindingTable.numEntries;
+    bool isBindlessKernel = kernelDescriptor.kernelAttributes.bufferAddressingMode == KernelDescriptor::BindlessAndStateless;
+
+    static_assert(sizeof(idd) <= InterfaceDescriptorTemplate::maxSize, "interface descriptor does not fit the template");
+    auto iddTemplate = dispatchInterface->getInterfaceDescriptorTemplate();
+    if (iddTemplate && iddTemplate->valid) {
+        memcpy_s(&idd, sizeof(idd), iddTemplate->data, sizeof(idd));
+    } else {
         auto alloc = dispatchInterface->getIsaAllocation();
         UNRECOVERABLE_IF(nullptr == alloc);
-        auto offset = alloc->getGpuAddressToPatch();
+        auto offset = alloc->getGpuAddressToPatch() + dispatchInterface->getIsaOffsetInParentAllocation();
         idd.setKernelStartPointer(offset);
         idd.setKernelStartPointerHigh(0u);
+
+        EncodeDispatchKernel<Family>::programBarrierEnable(idd,
+                                                           kernelDescriptor.kernelAttributes.barrierCount,
+                                                           hwInfo);
+        if (!isBindlessKernel) {
+            EncodeDispatchKernel<Family>::adjustBindingTablePrefetch(idd, kernelDescriptor.payloadMappings.samplerTable.numSamplers, bindingTableStateCount);
+        }
+
+        if (iddTemplate) {
+            memcpy_s(iddTemplate->data, InterfaceDescriptorTemplate::maxSize, &idd, sizeof(idd));
+            iddTemplate->valid = true;
+        }
     }
 
-    EncodeWA<Family>::encodeAdditionalPipelineSelect(*container.getDevice(), *container.getCommandStream(), true);
-    EncodeStates<Family>::adjustStateComputeMode(*container.getCommandStream(), container.lastSentNumGrfRequired, nullptr, false, false);
-    EncodeWA<Family>::encodeAdditionalPipelineSelect(*container.getDevice(), *container.getCommandStream(), false);
+    uint32_t numGrfRequired = kernelDescriptor.kernelAttributes.numGrfRequired;
+    if (numGrfRequired == GrfConfig::NotApplicable) {
+        numGrfRequired = GrfConfig::DefaultGrfNumber;
+    }
+    if (container.lastSentNumGrfRequired != numGrfRequired) {
+        EncodeWA<Family>::encodeAdditionalPipelineSelect(*container.getDevice(), *container.getCommandStream(), true);
+        EncodeStates<Family>::adjustStateComputeMode(*container.getCommandStream(), numGrfRequired, nullptr, false, false);
+        EncodeWA<Family>::encodeAdditionalPipelineSelect(*container.getDevice(), *container.getCommandStream(), false);
+        container.lastSentNumGrfRequired = numGrfRequired;
+    }
 
     auto numThreadsPerThreadGroup = dispatchInterface->getNumThreadsPerThreadGroup();
     idd.setNumberOfThreadsInGpgpuThreadGroup(numThreadsPerThreadGroup);
 
-    EncodeDispatchKernel<Family>::programBarrierEnable(idd,
-                                                       kernelDescriptor.kernelAttributes.barrierCount,
-                                                       hwInfo);
     auto slmSize = static_cast<typename INTERFACE_DESCRIPTOR_DATA::SHARED_LOCAL_MEMORY_SIZE>(
         HwHelperHw<Family>::get().computeSlmValues(hwInfo, dispatchInterface->getSlmTotalSize()));
     idd.setSharedLocalMemorySize(slmSize);
 
-    uint32_t bindingTableStateCount = kernelDescriptor.payloadMappings.bindingTable.numEntries;
     uint32_t bindingTablePointer = 0u;
-    bool isBindlessKernel = kernelDescriptor.kernelAttributes.bufferAddressingMode == KernelDescriptor::BindlessAndStateless;
     if (!isBindlessKernel) {
         container.prepareBindfulSsh();
-        if (bindingTableStateCount > 0u) {
+        // surface states of mutable dispatches get patched later, so they are never shared
+        if (bindingTableStateCount > 0u &&
+            (outLocations || !container.getReusableBindingTable(dispatchInterface->getSurfaceStateHeapData(), dispatchInterface->getSurfaceStateHeapDataSize(), bindingTablePointer))) {
             auto ssh = container.getHeapWithRequiredSizeAndAlignment(HeapType::SURFACE_STATE, dispatchInterface->getSurfaceStateHeapDataSize(), BINDING_TABLE_STATE::SURFACESTATEPOINTER_ALIGN_SIZE);
             sshOffset = ssh->getUsed();
             bindingTablePointer = static_cast<uint32_t>(EncodeSurfaceState<Family>::pushBindingTableAndSurfaceStates(
@@ -95,6 +119,11 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container,
                 dispatchInterface->getSurfaceStateHeapData(),
                 dispatchInterface->getSurfaceStateHeapDataSize(), bindingTableStateCount,
                 kernelDescriptor.payloadMappings.bindingTable.tableOffset));
+            if (outLocations) {
+                outLocations->surfaceStates = ptrOffset(ssh->getCpuBase(), sshOffset);
+            } else {
+                container.storeReusableBindingTable(dispatchInterface->getSurfaceStateHeapData(), dispatchInterface->getSurfaceStateHeapDataSize(), bindingTablePointer);
+            }
         }
     }
     idd.setBindingTablePointer(bindingTablePointer);
@@ -105,24 +134,31 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container,
     UNRECOVERABLE_IF(!heap);
 
     uint32_t samplerStateOffset = 0;
-    uint32_t samplerCount = 0;
 
     if (kernelDescriptor.payloadMappings.samplerTable.numSamplers > 0) {
-        samplerCount = kernelDescriptor.payloadMappings.samplerTable.numSamplers;
-        samplerStateOffset = EncodeStates<Family>::copySamplerState(heap, kernelDescriptor.payloadMappings.samplerTable.tableOffset,
-                                                                    kernelDescriptor.payloadMappings.samplerTable.numSamplers,
-                                                                    kernelDescriptor.payloadMappings.samplerTable.borderColor,
-                                                                    dispatchInterface->getDynamicStateHeapData(),
-                                                                    device->getBindlessHeapsHelper());
+        auto &samplerTable = kernelDescriptor.payloadMappings.samplerTable;
+        // border colors precede the sampler states in the kernel's DSH data
+        auto borderColorSize = samplerTable.tableOffset - samplerTable.borderColor;
+        auto samplerData = ptrOffset(dispatchInterface->getDynamicStateHeapData(), samplerTable.borderColor);
+        auto samplerDataSize = borderColorSize + sizeof(typename Family::SAMPLER_STATE) * samplerTable.numSamplers;
+        // bindless sampler states are already shared through the global DSH
+        bool reuseSamplerStates = !ApiSpecificConfig::getBindlessConfiguration();
+        if (!reuseSamplerStates || !container.getReusableSamplerStates(samplerData, samplerDataSize, borderColorSize, samplerStateOffset)) {
+            samplerStateOffset = EncodeStates<Family>::copySamplerState(heap, samplerTable.tableOffset,
+                                                                        samplerTable.numSamplers,
+                                                                        samplerTable.borderColor,
+                                                                        dispatchInterface->getDynamicStateHeapData(),
+                                                                        device->getBindlessHeapsHelper());
+            if (reuseSamplerStates) {
+                container.storeReusableSamplerStates(samplerData, samplerDataSize, borderColorSize, samplerStateOffset);
+            }
+        }
         if (ApiSpecificConfig::getBindlessConfiguration()) {
             container.getResidencyContainer().push_back(device->getBindlessHeapsHelper()->getHeap(NEO::BindlessHeapsHelper::BindlesHeapType::GLOBAL_DSH)->getGraphicsAllocation());
         }
     }
 
     idd.setSamplerStatePointer(samplerStateOffset);
-    if (!isBindlessKernel) {
-        EncodeDispatchKernel<Family>::adjustBindingTablePrefetch(idd, samplerCount, bindingTableStateCount);
-    }
 
     auto numGrfCrossThreadData = static_cast<uint32_t>(sizeCrossThreadData / sizeof(float[8]));
     idd.setCrossThreadConstantDataReadLength(numGrfCrossThreadData);
@@ -133,7 +169,11 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container,
 
     uint32_t sizeThreadData = sizePerThreadDataForWholeGroup + sizeCrossThreadData;
     uint64_t offsetThreadData = 0u;
-    {
+    // indirect data patched by the GPU or by mutable dispatch updates is never shared
+    bool reuseIndirectData = !isIndirect && outLocations == nullptr &&
+                             container.getReusableIndirectData(dispatchInterface->getCrossThreadData(), sizeCrossThreadData,
+                                                               dispatchInterface->getPerThreadData(), sizePerThreadDataForWholeGroup, offsetThreadData);
+    if (!reuseIndirectData) {
         auto heapIndirect = container.getIndirectHeap(HeapType::INDIRECT_OBJECT);
         UNRECOVERABLE_IF(!(heapIndirect));
         heapIndirect->align(WALKER_TYPE::INDIRECTDATASTARTADDRESS_ALIGN_SIZE);
@@ -144,6 +184,9 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container,
 
         memcpy_s(ptr, sizeCrossThreadData,
                  dispatchInterface->getCrossThreadData(), sizeCrossThreadData);
+        if (outLocations) {
+            outLocations->crossThreadData = ptr;
+        }
 
         if (isIndirect) {
             void *gpuPtr = reinterpret_cast<void *>(heapIndirect->getHeapGpuBase() + heapIndirect->getUsed() - sizeThreadData);
@@ -154,11 +197,21 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container,
         ptr = ptrOffset(ptr, sizeCrossThreadData);
         memcpy_s(ptr, sizePerThreadDataForWholeGroup,
                  dispatchInterface->getPerThreadData(), sizePerThreadDataForWholeGroup);
+
+        if (!isIndirect && outLocations == nullptr) {
+            container.storeReusableIndirectData(dispatchInterface->getCrossThreadData(), sizeCrossThreadData,
+                                                dispatchInterface->getPerThreadData(), sizePerThreadDataForWholeGroup, offsetThreadData);
+        }
     }
 
     auto slmSizeNew = dispatchInterface->getSlmTotalSize();
+    bool slmConfigChanged = container.slmSize != slmSizeNew;
+    if (container.keepSlmEnabledL3Config && container.slmSize != std::numeric_limits<uint32_t>::max()) {
+        // L3 with SLM enabled serves kernels without SLM too, reprogram only when SLM is first needed
+        slmConfigChanged = container.slmSize == 0u && slmSizeNew != 0u;
+    }
     bool dirtyHeaps = container.isAnyHeapDirty();
-    bool flush = container.slmSize != slmSizeNew || dirtyHeaps || requiresUncachedMocs;
+    bool flush = slmConfigChanged || dirtyHeaps || requiresUncachedMocs;
 
     if (flush) {
         PipeControlArgs args(true);
@@ -177,7 +230,7 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container,
             requiresUncachedMocs = false;
         }
 
-        if (container.slmSize != slmSizeNew) {
+        if (slmConfigChanged) {
             EncodeL3State<Family>::encode(container, slmSizeNew != 0u);
             container.slmSize = slmSizeNew;
 
@@ -216,6 +269,9 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container,
 
     auto buffer = listCmdBufferStream->getSpace(sizeof(cmd));
     *(decltype(cmd) *)buffer = cmd;
+    if (outLocations) {
+        outLocations->walkerCmd = buffer;
+    }
 
     PreemptionHelper::applyPreemptionWaCmdsEnd<Family>(listCmdBufferStream, *device);
     {
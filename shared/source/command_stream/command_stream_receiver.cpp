@@ -9,11 +9,13 @@
 
 #include "shared/source/built_ins/built_ins.h"
 #include "shared/source/command_stream/experimental_command_buffer.h"
+#include "shared/source/command_stream/gpu_timeline_sampler.h"
 #include "shared/source/command_stream/preemption.h"
 #include "shared/source/command_stream/scratch_space_controller.h"
 #include "shared/source/device/device.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/array_count.h"
+#include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/cache_policy.h"
 #include "shared/source/helpers/flush_stamp.h"
 #include "shared/source/helpers/hw_helper.h"
@@ -27,6 +29,9 @@
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/utilities/cpuintrinsics.h"
 #include "shared/source/utilities/tag_allocator.h"
+#include "shared/source/utilities/trace_events.h"
+
+#include <thread>
 
 namespace NEO {
 
@@ -44,6 +49,15 @@ CommandStreamReceiver::CommandStreamReceiver(ExecutionEnvironment &executionEnvi
     if (DebugManager.flags.CsrDispatchMode.get()) {
         this->dispatchMode = (DispatchMode)DebugManager.flags.CsrDispatchMode.get();
     }
+    if (DebugManager.flags.BatchedDispatchMaxSubmissions.get() > 0) {
+        this->batchedDispatchMaxSubmissions = static_cast<uint32_t>(DebugManager.flags.BatchedDispatchMaxSubmissions.get());
+    }
+    if (DebugManager.flags.BatchedDispatchMaxBatchSize.get() > 0) {
+        this->batchedDispatchMaxBatchSize = static_cast<size_t>(DebugManager.flags.BatchedDispatchMaxBatchSize.get());
+    }
+    if (DebugManager.flags.CsrOwnershipSpinCount.get() != -1) {
+        this->ownershipSpinCount = static_cast<uint32_t>(DebugManager.flags.CsrOwnershipSpinCount.get());
+    }
     flushStamp.reset(new FlushStampTracker(true));
     for (int i = 0; i < IndirectHeap::NUM_TYPES; ++i) {
         indirectHeap[i] = nullptr;
@@ -56,6 +70,21 @@ CommandStreamReceiver::CommandStreamReceiver(ExecutionEnvironment &executionEnvi
 }
 
 CommandStreamReceiver::~CommandStreamReceiver() {
+    if (DebugManager.flags.PrintStateReprogrammingCounters.get()) {
+        const auto &counters = stateReprogrammingCounters;
+        printf("State reprogramming counters for engine %u: flushes %llu, L3 config %llu, coherency %llu, GRF %llu, media sampler %llu, special pipeline select %llu, thread arbitration %llu, preemption %llu, MEDIA_VFE_STATE %llu, STATE_BASE_ADDRESS %llu (DSH %llu, IOH %llu, SSH %llu, general state %llu, MOCS %llu, global atomics %llu, compression %llu, debugger %llu)\n",
+               osContext ? osContext->getContextId() : 0u,
+               static_cast<unsigned long long>(counters.flushes), static_cast<unsigned long long>(counters.l3Config),
+               static_cast<unsigned long long>(counters.coherency), static_cast<unsigned long long>(counters.numGrf),
+               static_cast<unsigned long long>(counters.mediaSampler), static_cast<unsigned long long>(counters.specialPipelineSelectMode),
+               static_cast<unsigned long long>(counters.threadArbitration), static_cast<unsigned long long>(counters.preemption),
+               static_cast<unsigned long long>(counters.mediaVfeState), static_cast<unsigned long long>(counters.stateBaseAddress),
+               static_cast<unsigned long long>(counters.dynamicStateHeap), static_cast<unsigned long long>(counters.indirectObjectHeap),
+               static_cast<unsigned long long>(counters.surfaceStateHeap), static_cast<unsigned long long>(counters.generalState),
+               static_cast<unsigned long long>(counters.statelessMocs), static_cast<unsigned long long>(counters.globalAtomics),
+               static_cast<unsigned long long>(counters.memoryCompression), static_cast<unsigned long long>(counters.sourceLevelDebugger));
+    }
+
     if (userPauseConfirmation) {
         {
             std::unique_lock<SpinLock> lock{debugPauseStateLock};
@@ -95,6 +124,63 @@ bool CommandStreamReceiver::submitBatchBuffer(BatchBuffer &batchBuffer, Residenc
     return ret;
 }
 
+bool CommandStreamReceiver::recordBatchBufferForCoalescing(BatchBuffer &batchBuffer, ResidencyContainer &allocationsForResidency, Device &device) {
+    // Called with CSR ownership acquired, batch buffer has to end at batchBuffer.endCmdPtr with space for chaining MI_BATCH_BUFFER_START
+    auto commandBuffer = new CommandBuffer(device);
+    commandBuffer->batchBuffer = batchBuffer;
+    commandBuffer->surfaces = allocationsForResidency;
+    commandBuffer->batchBufferEndLocation = batchBuffer.endCmdPtr;
+    commandBuffer->taskCount = taskCount + 1;
+    this->submissionAggregator->recordCommandBuffer(commandBuffer);
+
+    this->latestSentTaskCount = taskCount + 1;
+    taskCount++;
+
+    // first submission recorded after previous flush is responsible for flushing the chain
+    bool flushRequired = !coalescingFlushPending;
+    coalescingFlushPending = true;
+    return flushRequired;
+}
+
+bool CommandStreamReceiver::waitForCoalescedSubmission(uint32_t submissionTaskCount, bool flushRequired, std::chrono::microseconds coalescingWindow) {
+    // Called without CSR ownership, so other submissions can join the chain within the coalescing window
+    if (flushRequired) {
+        {
+            // stop waiting once every announced submission has been recorded
+            std::unique_lock<std::mutex> coalescingLock(coalescingMutex);
+            coalescingCondition.wait_for(coalescingLock, coalescingWindow, [&] { return pendingCoalescingSubmitters == 0; });
+        }
+        {
+            auto lock = obtainUniqueOwnership();
+            auto result = flushCoalescedSubmissions();
+            coalescingFlushPending = false;
+
+            std::lock_guard<std::mutex> coalescingLock(coalescingMutex);
+            coalescedTaskCount = taskCount;
+            coalescedSubmissionResult = result;
+        }
+        coalescingCondition.notify_all();
+    }
+
+    std::unique_lock<std::mutex> coalescingLock(coalescingMutex);
+    coalescingCondition.wait(coalescingLock, [&] { return coalescedTaskCount >= submissionTaskCount; });
+    return coalescedSubmissionResult;
+}
+
+void CommandStreamReceiver::registerCoalescingSubmitter() {
+    std::lock_guard<std::mutex> coalescingLock(coalescingMutex);
+    pendingCoalescingSubmitters++;
+}
+
+void CommandStreamReceiver::unregisterCoalescingSubmitter() {
+    {
+        std::lock_guard<std::mutex> coalescingLock(coalescingMutex);
+        DEBUG_BREAK_IF(pendingCoalescingSubmitters == 0);
+        pendingCoalescingSubmitters--;
+    }
+    coalescingCondition.notify_all();
+}
+
 void CommandStreamReceiver::makeResident(GraphicsAllocation &gfxAllocation) {
     auto submissionTaskCount = this->taskCount + 1;
     if (gfxAllocation.isResidencyTaskCountBelow(submissionTaskCount, osContext->getContextId())) {
@@ -154,7 +240,20 @@ void CommandStreamReceiver::ensureCommandBufferAllocation(LinearStream &commandS
         return;
     }
 
-    const auto allocationSize = alignUp(minimumRequiredSize + additionalAllocationSize, MemoryConstants::pageSize64k);
+    auto currentAllocation = commandStream.getGraphicsAllocation();
+    if (DebugManager.flags.RecycleCompletedCommandBufferInPlace.get() != 0 && currentAllocation != nullptr &&
+        currentAllocation->getUnderlyingBufferSize() >= minimumRequiredSize + additionalAllocationSize &&
+        *getTagAddress() >= currentAllocation->getTaskCount(osContext->getContextId())) {
+        // GPU is done with everything recorded so far, rewind instead of switching to another command buffer
+        commandStream.replaceBuffer(currentAllocation->getUnderlyingBuffer(), currentAllocation->getUnderlyingBufferSize() - additionalAllocationSize);
+        return;
+    }
+
+    auto allocationSize = alignUp(minimumRequiredSize + additionalAllocationSize, MemoryConstants::pageSize64k);
+    if (allocationSize <= maxCommandBufferSizeClass) {
+        // power-of-two size classes, so that recycled command buffers match later requests
+        allocationSize = static_cast<size_t>(Math::nextPowerOfTwo(static_cast<uint64_t>(allocationSize / MemoryConstants::pageSize64k))) * MemoryConstants::pageSize64k;
+    }
     constexpr static auto allocationType = GraphicsAllocation::AllocationType::COMMAND_BUFFER;
     auto allocation = this->getInternalAllocationStorage()->obtainReusableAllocation(allocationSize, allocationType).release();
     if (allocation == nullptr) {
@@ -166,12 +265,32 @@ void CommandStreamReceiver::ensureCommandBufferAllocation(LinearStream &commandS
 
     if (commandStream.getGraphicsAllocation() != nullptr) {
         getInternalAllocationStorage()->storeAllocation(std::unique_ptr<GraphicsAllocation>(commandStream.getGraphicsAllocation()), REUSABLE_ALLOCATION);
+        if (DebugManager.flags.CommandBufferPoolHighWaterMark.get() != -1) {
+            getInternalAllocationStorage()->trimReusableAllocations(allocationType, static_cast<size_t>(DebugManager.flags.CommandBufferPoolHighWaterMark.get()));
+        }
     }
 
-    commandStream.replaceBuffer(allocation->getUnderlyingBuffer(), allocationSize - additionalAllocationSize);
+    commandStream.replaceBuffer(allocation->getUnderlyingBuffer(), allocation->getUnderlyingBufferSize() - additionalAllocationSize);
     commandStream.replaceGraphicsAllocation(allocation);
 }
 
+bool CommandStreamReceiver::preallocateCommandBuffers() {
+    if (DebugManager.flags.CommandBufferPoolPrewarmCount.get() <= 0 || DebugManager.flags.DisableResourceRecycling.get()) {
+        return true;
+    }
+
+    const AllocationProperties commandStreamAllocationProperties{rootDeviceIndex, true, MemoryConstants::pageSize64k, GraphicsAllocation::AllocationType::COMMAND_BUFFER,
+                                                                 isMultiOsContextCapable(), false, osContext->getDeviceBitfield()};
+    for (auto i = 0; i < DebugManager.flags.CommandBufferPoolPrewarmCount.get(); i++) {
+        auto allocation = getMemoryManager()->allocateGraphicsMemoryWithProperties(commandStreamAllocationProperties);
+        if (allocation == nullptr) {
+            return false;
+        }
+        getInternalAllocationStorage()->storeAllocation(std::unique_ptr<GraphicsAllocation>(allocation), REUSABLE_ALLOCATION);
+    }
+    return true;
+}
+
 MemoryManager *CommandStreamReceiver::getMemoryManager() const {
     DEBUG_BREAK_IF(!executionEnvironment.memoryManager);
     return executionEnvironment.memoryManager.get();
@@ -250,6 +369,7 @@ void CommandStreamReceiver::cleanupResources() {
 }
 
 bool CommandStreamReceiver::waitForCompletionWithTimeout(bool enableTimeout, int64_t timeoutMicroseconds, uint32_t taskCountToWait) {
+    ScopedTraceEvent traceEvent("waitForCompletion", TraceEvents::Category::wait);
     std::chrono::high_resolution_clock::time_point time1, time2;
     int64_t timeDiff = 0;
 
@@ -260,22 +380,73 @@ bool CommandStreamReceiver::waitForCompletionWithTimeout(bool enableTimeout, int
         }
     }
 
+    // a single thread polls the tag, other waiters sleep until it observes an update
+    const bool shareTagPolling = DebugManager.flags.ShareTagPollingBetweenWaiters.get() != 0;
+    bool isTagPoller = !shareTagPolling || acquireTagPolling();
+    uint32_t lastObservedTag = *getTagAddress();
+
     time1 = std::chrono::high_resolution_clock::now();
     while (*getTagAddress() < taskCountToWait && timeDiff <= timeoutMicroseconds) {
-        std::this_thread::yield();
-        CpuIntrinsics::pause();
+        if (isTagPoller) {
+            std::this_thread::yield();
+            CpuIntrinsics::pause();
+
+            if (shareTagPolling && *getTagAddress() != lastObservedTag) {
+                lastObservedTag = *getTagAddress();
+                notifyTagWaiters();
+            }
+        } else {
+            isTagPoller = waitForTagPoller(taskCountToWait);
+        }
 
         if (enableTimeout) {
             time2 = std::chrono::high_resolution_clock::now();
             timeDiff = std::chrono::duration_cast<std::chrono::microseconds>(time2 - time1).count();
         }
     }
+    if (shareTagPolling && isTagPoller) {
+        releaseTagPolling();
+    }
     if (*getTagAddress() >= taskCountToWait) {
         return true;
     }
     return false;
 }
 
+bool CommandStreamReceiver::acquireTagPolling() {
+    std::lock_guard<std::mutex> lock(tagPollingMutex);
+    if (tagPollingActive) {
+        return false;
+    }
+    tagPollingActive = true;
+    return true;
+}
+
+void CommandStreamReceiver::releaseTagPolling() {
+    {
+        std::lock_guard<std::mutex> lock(tagPollingMutex);
+        tagPollingActive = false;
+    }
+    tagPollingCondition.notify_all();
+}
+
+void CommandStreamReceiver::notifyTagWaiters() {
+    // taking the lock orders the notification after waiters that already checked the tag went to sleep
+    { std::lock_guard<std::mutex> lock(tagPollingMutex); }
+    tagPollingCondition.notify_all();
+}
+
+bool CommandStreamReceiver::waitForTagPoller(uint32_t taskCountToWait) {
+    std::unique_lock<std::mutex> lock(tagPollingMutex);
+    // the period bounds how late a waiter notices its own timeout
+    tagPollingCondition.wait_for(lock, tagPollingWaitPeriod, [&] { return !tagPollingActive || *getTagAddress() >= taskCountToWait; });
+    if (tagPollingActive) {
+        return false;
+    }
+    tagPollingActive = true;
+    return true;
+}
+
 void CommandStreamReceiver::setTagAllocation(GraphicsAllocation *allocation) {
     this->tagAllocation = allocation;
     UNRECOVERABLE_IF(allocation == nullptr);
@@ -446,6 +617,16 @@ void CommandStreamReceiver::setExperimentalCmdBuffer(std::unique_ptr<Experimenta
     experimentalCmdBuffer = std::move(cmdBuffer);
 }
 
+void CommandStreamReceiver::setGpuTimelineSamplingPeriod(const Device &device, uint32_t samplingPeriod) {
+    auto lock = obtainUniqueOwnership();
+    if (!gpuTimelineSampler && samplingPeriod > 0) {
+        gpuTimelineSampler = std::make_unique<GpuTimelineSampler>(*this, device.getOSTime(), device.getDeviceInfo().profilingTimerResolution);
+    }
+    if (gpuTimelineSampler) {
+        gpuTimelineSampler->setSamplingPeriod(samplingPeriod);
+    }
+}
+
 void *CommandStreamReceiver::asyncDebugBreakConfirmation(void *arg) {
     auto self = reinterpret_cast<CommandStreamReceiver *>(arg);
 
@@ -571,7 +752,17 @@ bool CommandStreamReceiver::createPreemptionAllocation() {
 }
 
 std::unique_lock<CommandStreamReceiver::MutexType> CommandStreamReceiver::obtainUniqueOwnership() {
-    return std::unique_lock<CommandStreamReceiver::MutexType>(this->ownershipMutex);
+    // Ownership is usually held only for the duration of a single submission, spin briefly before sleeping on the mutex
+    std::unique_lock<CommandStreamReceiver::MutexType> lock(this->ownershipMutex, std::try_to_lock);
+    for (uint32_t spin = 0; !lock.owns_lock() && spin < this->ownershipSpinCount; spin++) {
+        CpuIntrinsics::pause();
+        lock.try_lock();
+    }
+    if (!lock.owns_lock()) {
+        ScopedTraceEvent traceEvent("csrOwnership", TraceEvents::Category::lock);
+        lock.lock();
+    }
+    return lock;
 }
 AllocationsList &CommandStreamReceiver::getTemporaryAllocations() { return internalAllocationStorage->getTemporaryAllocations(); }
 AllocationsList &CommandStreamReceiver::getAllocationsForReuse() { return internalAllocationStorage->getAllocationsForReuse(); }
@@ -24,14 +24,18 @@
 
 #include "csr_properties_flags.h"
 
+#include <chrono>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdint>
+#include <mutex>
 
 namespace NEO {
 class AllocationsList;
 class Device;
 class ExecutionEnvironment;
 class ExperimentalCommandBuffer;
+class GpuTimelineSampler;
 class GmmPageTableMngr;
 class GraphicsAllocation;
 class HostPtrSurface;
@@ -56,7 +60,7 @@ enum class DispatchMode {
     DeviceDefault = 0,          //default for given device
     ImmediateDispatch,          //everything is submitted to the HW immediately
     AdaptiveDispatch,           //dispatching is handled to async thread, which combines batch buffers basing on load (not implemented)
-    BatchedDispatchWithCounter, //dispatching is batched, after n commands there is implicit flush (not implemented)
+    BatchedDispatchWithCounter, //dispatching is batched, after n commands or n bytes there is implicit flush
     BatchedDispatch             // dispatching is batched, explicit clFlush is required
 };
 
@@ -69,6 +73,11 @@ class CommandStreamReceiver {
     };
 
     using MutexType = std::recursive_mutex;
+    static constexpr uint32_t defaultBatchedDispatchMaxSubmissions = 32u;
+    static constexpr size_t defaultBatchedDispatchMaxBatchSize = 256 * MemoryConstants::kiloByte;
+    static constexpr uint32_t defaultOwnershipSpinCount = 64u;
+    static constexpr size_t maxCommandBufferSizeClass = 2 * MemoryConstants::megaByte;
+
     CommandStreamReceiver(ExecutionEnvironment &executionEnvironment,
                           uint32_t rootDeviceIndex,
                           const DeviceBitfield deviceBitfield);
@@ -82,6 +91,11 @@ class CommandStreamReceiver {
 
     virtual bool flushBatchedSubmissions() = 0;
     bool submitBatchBuffer(BatchBuffer &batchBuffer, ResidencyContainer &allocationsForResidency);
+    bool recordBatchBufferForCoalescing(BatchBuffer &batchBuffer, ResidencyContainer &allocationsForResidency, Device &device);
+    bool waitForCoalescedSubmission(uint32_t submissionTaskCount, bool flushRequired, std::chrono::microseconds coalescingWindow);
+    void registerCoalescingSubmitter();
+    void unregisterCoalescingSubmitter();
+    virtual bool flushCoalescedSubmissions() { return flushBatchedSubmissions(); }
     virtual void programHardwareContext(LinearStream &cmdStream) = 0;
     virtual size_t getCmdsSizeForHardwareContext() const = 0;
 
@@ -134,6 +148,7 @@ class CommandStreamReceiver {
     void enableNTo1SubmissionModel() { this->nTo1SubmissionModelEnabled = true; }
     bool isNTo1SubmissionModelEnabled() const { return this->nTo1SubmissionModelEnabled; }
     void overrideDispatchPolicy(DispatchMode overrideValue) { this->dispatchMode = overrideValue; }
+    DispatchMode getDispatchMode() const { return dispatchMode; }
 
     void setMediaVFEStateDirty(bool dirty) { mediaVfeStateDirty = dirty; }
     bool getMediaVFEStateDirty() { return mediaVfeStateDirty; }
@@ -173,10 +188,15 @@ class CommandStreamReceiver {
     virtual enum CommandStreamReceiverType getType() = 0;
     void setExperimentalCmdBuffer(std::unique_ptr<ExperimentalCommandBuffer> &&cmdBuffer);
 
+    // samples 1 in samplingPeriod submissions, zero stops sampling
+    void setGpuTimelineSamplingPeriod(const Device &device, uint32_t samplingPeriod);
+    GpuTimelineSampler *getGpuTimelineSampler() const { return gpuTimelineSampler.get(); }
+
     bool initializeTagAllocation();
     MOCKABLE_VIRTUAL bool createWorkPartitionAllocation(const Device &device);
     MOCKABLE_VIRTUAL bool createGlobalFenceAllocation();
     MOCKABLE_VIRTUAL bool createPreemptionAllocation();
+    MOCKABLE_VIRTUAL bool preallocateCommandBuffers();
     MOCKABLE_VIRTUAL bool createPerDssBackedBuffer(Device &device);
     MOCKABLE_VIRTUAL std::unique_lock<MutexType> obtainUniqueOwnership();
 
@@ -220,8 +240,17 @@ class CommandStreamReceiver {
         requiresInstructionCacheFlush = true;
     }
 
+    void registerFullCacheFlush() {
+        auto mutex = obtainUniqueOwnership();
+        requiresFullCacheFlush = true;
+    }
+
     bool isLocalMemoryEnabled() const { return localMemoryEnabled; }
 
+    const StateReprogrammingCounters &getStateReprogrammingCounters() const { return stateReprogrammingCounters; }
+    virtual SubmissionStatistics getSubmissionStatistics() const { return submissionCounters.read(); }
+    SubmissionCounters &getSubmissionCounters() { return submissionCounters; }
+
     uint32_t getRootDeviceIndex() { return rootDeviceIndex; }
 
     virtual bool initDirectSubmission(Device &device, OsContext &osContext) {
@@ -236,6 +265,8 @@ class CommandStreamReceiver {
         return false;
     }
 
+    virtual void stopDirectSubmission() {}
+
     bool isStaticWorkPartitioningEnabled() const {
         return staticWorkPartitioningEnabled;
     }
@@ -253,11 +284,18 @@ class CommandStreamReceiver {
     void printDeviceIndex();
     void checkForNewResources(uint32_t submittedTaskCount, uint32_t allocationTaskCount, GraphicsAllocation &gfxAllocation);
     bool checkImplicitFlushForGpuIdle();
+    bool acquireTagPolling();
+    void releaseTagPolling();
+    void notifyTagWaiters();
+    bool waitForTagPoller(uint32_t taskCountToWait);
+
+    static constexpr std::chrono::microseconds tagPollingWaitPeriod{100};
 
     std::unique_ptr<FlushStampTracker> flushStamp;
     std::unique_ptr<SubmissionAggregator> submissionAggregator;
     std::unique_ptr<FlatBatchBufferHelper> flatBatchBufferHelper;
     std::unique_ptr<ExperimentalCommandBuffer> experimentalCmdBuffer;
+    std::unique_ptr<GpuTimelineSampler> gpuTimelineSampler;
     std::unique_ptr<InternalAllocationStorage> internalAllocationStorage;
     std::unique_ptr<KmdNotifyHelper> kmdNotifyHelper;
     std::unique_ptr<ScratchSpaceController> scratchSpaceController;
@@ -269,6 +307,10 @@ class CommandStreamReceiver {
     ResidencyContainer residencyAllocations;
     ResidencyContainer evictionAllocations;
     MutexType ownershipMutex;
+    std::mutex coalescingMutex;
+    std::condition_variable coalescingCondition;
+    std::mutex tagPollingMutex;
+    std::condition_variable tagPollingCondition;
     ExecutionEnvironment &executionEnvironment;
 
     LinearStream commandStream;
@@ -276,6 +318,8 @@ class CommandStreamReceiver {
     // offset for debug state must be 8 bytes, if only 4 bytes are used tag writes overwrite it
     const uint64_t debugPauseStateAddressOffset = 8;
     uint64_t totalMemoryUsed = 0u;
+    StateReprogrammingCounters stateReprogrammingCounters;
+    SubmissionCounters submissionCounters;
 
     volatile uint32_t *tagAddress = nullptr;
     volatile DebugPauseState *debugPauseStateAddress;
@@ -302,6 +346,13 @@ class CommandStreamReceiver {
     std::atomic<uint32_t> latestFlushedTaskCount{0};
     // taskCount - # of tasks submitted
     std::atomic<uint32_t> taskCount{0};
+    uint32_t coalescedTaskCount = 0;
+    uint32_t pendingCoalescingSubmitters = 0;
+    uint32_t ownershipSpinCount = defaultOwnershipSpinCount;
+    uint32_t batchedSubmissionsCount = 0;
+    uint32_t batchedDispatchMaxSubmissions = defaultBatchedDispatchMaxSubmissions;
+    size_t batchedSubmissionsSize = 0u;
+    size_t batchedDispatchMaxBatchSize = defaultBatchedDispatchMaxBatchSize;
 
     DispatchMode dispatchMode = DispatchMode::ImmediateDispatch;
     SamplerCacheFlushState samplerCacheFlushRequired = SamplerCacheFlushState::samplerCacheFlushNotRequired;
@@ -326,6 +377,9 @@ class CommandStreamReceiver {
     int8_t lastSentCoherencyRequest = -1;
     int8_t lastMediaSamplerConfig = -1;
 
+    bool coalescingFlushPending = false;
+    bool tagPollingActive = false;
+    bool coalescedSubmissionResult = true;
     bool isPreambleSent = false;
     bool isStateSipSent = false;
     bool isEnginePrologueSent = false;
@@ -341,6 +395,7 @@ class CommandStreamReceiver {
     bool nTo1SubmissionModelEnabled = false;
     bool lastSpecialPipelineSelectMode = false;
     bool requiresInstructionCacheFlush = false;
+    bool requiresFullCacheFlush = false;
 
     bool localMemoryEnabled = false;
     bool pageTableManagerInitialized = false;
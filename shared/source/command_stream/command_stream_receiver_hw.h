@@ -47,6 +47,7 @@ class CommandStreamReceiverHw : public CommandStreamReceiver {
     void forcePipeControl(NEO::LinearStream &commandStreamCSR);
 
     bool flushBatchedSubmissions() override;
+    bool flushCoalescedSubmissions() override;
     void programHardwareContext(LinearStream &cmdStream) override;
     size_t getCmdsSizeForHardwareContext() const override;
 
@@ -62,6 +63,7 @@ class CommandStreamReceiverHw : public CommandStreamReceiver {
     size_t getCmdSizeForPreemption(const DispatchFlags &dispatchFlags) const;
     size_t getCmdSizeForEpilogue(const DispatchFlags &dispatchFlags) const;
     size_t getCmdSizeForEpilogueCommands(const DispatchFlags &dispatchFlags) const;
+    size_t getCmdSizeForGpuTimelineTimestamp() const;
     size_t getCmdSizeForL3Config() const;
     size_t getCmdSizeForPipelineSelect() const;
     size_t getCmdSizeForComputeMode();
@@ -115,12 +117,20 @@ class CommandStreamReceiverHw : public CommandStreamReceiver {
         return blitterDirectSubmission.get() != nullptr;
     }
 
+    void stopDirectSubmission() override {
+        directSubmission.reset();
+        blitterDirectSubmission.reset();
+    }
+
+    SubmissionStatistics getSubmissionStatistics() const override;
+
     virtual bool isAnyDirectSubmissionActive() { return false; }
 
     bool initDirectSubmission(Device &device, OsContext &osContext) override;
     GraphicsAllocation *getClearColorAllocation() override;
 
   protected:
+    bool flushAggregatedSubmissions();
     void programPreemption(LinearStream &csr, DispatchFlags &dispatchFlags);
     void programL3(LinearStream &csr, DispatchFlags &dispatchFlags, uint32_t &newL3Config);
     void programPreamble(LinearStream &csr, Device &device, DispatchFlags &dispatchFlags, uint32_t &newL3Config);
@@ -133,6 +143,7 @@ class CommandStreamReceiverHw : public CommandStreamReceiver {
     void programStateSip(LinearStream &cmdStream, Device &device);
     void programVFEState(LinearStream &csr, DispatchFlags &dispatchFlags, uint32_t maxFrontEndThreads);
     void programStallingPipeControlForBarrier(LinearStream &cmdStream, DispatchFlags &dispatchFlags);
+    void programGpuTimelineTimestamp(LinearStream &cmdStream, uint64_t timestampAddress);
     void programEngineModeCommands(LinearStream &csr, const DispatchFlags &dispatchFlags);
     void programEngineModeEpliogue(LinearStream &csr, const DispatchFlags &dispatchFlags);
 
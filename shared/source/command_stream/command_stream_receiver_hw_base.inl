@@ -7,6 +7,7 @@
 
 #include "shared/source/command_stream/command_stream_receiver_hw.h"
 #include "shared/source/command_stream/experimental_command_buffer.h"
+#include "shared/source/command_stream/gpu_timeline_sampler.h"
 #include "shared/source/command_stream/linear_stream.h"
 #include "shared/source/command_stream/preemption.h"
 #include "shared/source/command_stream/scratch_space_controller_base.h"
@@ -29,7 +30,9 @@
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
+#include "shared/source/utilities/launch_overhead_profiler.h"
 #include "shared/source/utilities/tag_allocator.h"
+#include "shared/source/utilities/trace_events.h"
 
 #include "command_stream_receiver_hw_ext.inl"
 #include "pipe_control_args.h"
@@ -181,12 +184,20 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
     typedef typename GfxFamily::PIPE_CONTROL PIPE_CONTROL;
     typedef typename GfxFamily::STATE_BASE_ADDRESS STATE_BASE_ADDRESS;
 
+    ScopedTraceEvent traceEvent("flushTask", TraceEvents::Category::submission);
+    ScopedLaunchPhase launchPhase(LaunchOverheadProfiler::Phase::flush);
+
     DEBUG_BREAK_IF(&commandStreamTask == &commandStream);
     DEBUG_BREAK_IF(!(dispatchFlags.preemptionMode == PreemptionMode::Disabled ? device.getPreemptionMode() == PreemptionMode::Disabled : true));
     DEBUG_BREAK_IF(taskLevel >= CompletionStamp::notReady);
 
     DBG_LOG(LogTaskCounts, __FUNCTION__, "Line: ", __LINE__, "taskLevel", taskLevel);
 
+    // engines reached without Device::getEngine are initialized on their first submission
+    if (osContext->isEngineInitializationPending()) {
+        UNRECOVERABLE_IF(!device.ensureEngineInitialized(EngineControl{this, osContext}));
+    }
+
     auto levelClosed = false;
     bool implicitFlush = dispatchFlags.implicitFlush || dispatchFlags.blocking || DebugManager.flags.ForceImplicitFlush.get();
     void *currentPipeControlForNooping = nullptr;
@@ -229,6 +240,10 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
         updateTag |= dispatchFlags.blocking;
 
         if (updateTag) {
+            SubmissionCounters::increment(submissionCounters.stallingPipeControls);
+            if (dispatchFlags.dcFlush) {
+                SubmissionCounters::increment(submissionCounters.cacheFlushes);
+            }
             PipeControlArgs args(dispatchFlags.dcFlush);
             MemorySynchronizationCommands<GfxFamily>::addPipeControlAndProgramPostSyncOperation(
                 commandStreamTask,
@@ -279,6 +294,17 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
     csrSizeRequestFlags.numGrfRequiredChanged = this->lastSentNumGrfRequired != dispatchFlags.numGrfRequired;
     lastSentNumGrfRequired = dispatchFlags.numGrfRequired;
 
+    stateReprogrammingCounters.flushes++;
+    SubmissionCounters::increment(submissionCounters.flushes);
+    if (this->isPreambleSent) {
+        stateReprogrammingCounters.l3Config += csrSizeRequestFlags.l3ConfigChanged ? 1u : 0u;
+        stateReprogrammingCounters.coherency += csrSizeRequestFlags.coherencyRequestChanged ? 1u : 0u;
+        stateReprogrammingCounters.numGrf += csrSizeRequestFlags.numGrfRequiredChanged ? 1u : 0u;
+        stateReprogrammingCounters.mediaSampler += csrSizeRequestFlags.mediaSamplerConfigChanged ? 1u : 0u;
+        stateReprogrammingCounters.specialPipelineSelectMode += csrSizeRequestFlags.specialPipelineSelectModeChanged ? 1u : 0u;
+        stateReprogrammingCounters.preemption += csrSizeRequestFlags.preemptionRequestChanged ? 1u : 0u;
+    }
+
     if (dispatchFlags.threadArbitrationPolicy != ThreadArbitrationPolicy::NotPresent) {
         this->requiredThreadArbitrationPolicy = dispatchFlags.threadArbitrationPolicy;
     }
@@ -322,9 +348,24 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
         setMediaVFEStateDirty(true);
     }
 
+    auto pageTableManager = executionEnvironment.rootDeviceEnvironments[device.getRootDeviceIndex()]->pageTableManager.get();
+    if (pageTableManager && !pageTableManager->flushPendingAuxTableUpdates()) {
+        // compressed allocations without aux table entries must not be accessed by the GPU
+        this->makeSurfacePackNonResident(this->getResidencyAllocations());
+        return {CompletionStamp::failed, this->taskLevel, flushStamp->peekStamp()};
+    }
+
     auto &commandStreamCSR = this->getCS(getRequiredCmdStreamSizeAligned(dispatchFlags, device));
     auto commandStreamStartCSR = commandStreamCSR.getUsed();
 
+    // the end timestamp goes to the task stream, so only submissions with room left there are sampled
+    const bool sampleGpuTimeline = gpuTimelineSampler && commandStreamStartTask != commandStreamTask.getUsed() &&
+                                   commandStreamTask.getAvailableSpace() >= getCmdSizeForGpuTimelineTimestamp() + CSRequirements::minCommandQueueCommandStreamSize &&
+                                   gpuTimelineSampler->startSample(taskCount + 1);
+    if (sampleGpuTimeline) {
+        programGpuTimelineTimestamp(commandStreamCSR, gpuTimelineSampler->getStartTimestampGpuAddress());
+    }
+
     TimestampPacketHelper::programCsrDependencies<GfxFamily>(commandStreamCSR, dispatchFlags.csrDependencies, getOsContext().getNumSupportedDevices());
 
     if (stallingPipeControlOnNextFlushRequired) {
@@ -347,10 +388,14 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
     if (this->lastSentThreadArbitrationPolicy != this->requiredThreadArbitrationPolicy) {
         PreambleHelper<GfxFamily>::programThreadArbitration(&commandStreamCSR, this->requiredThreadArbitrationPolicy);
         this->lastSentThreadArbitrationPolicy = this->requiredThreadArbitrationPolicy;
+        stateReprogrammingCounters.threadArbitration++;
     }
 
     stateBaseAddressDirty |= ((GSBAFor32BitProgrammed ^ dispatchFlags.gsba32BitRequired) && force32BitAllocations);
 
+    if (mediaVfeStateDirty) {
+        stateReprogrammingCounters.mediaVfeState++;
+    }
     programVFEState(commandStreamCSR, dispatchFlags, device.getDeviceInfo().maxFrontEndThreads);
 
     programPreemption(commandStreamCSR, dispatchFlags);
@@ -370,12 +415,14 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
         mocsIndex = hwHelper.getMocsIndex(*device.getGmmHelper(), l3On, l1On);
     }
 
-    if (mocsIndex != latestSentStatelessMocsConfig) {
+    bool statelessMocsChanged = mocsIndex != latestSentStatelessMocsConfig;
+    if (statelessMocsChanged) {
         isStateBaseAddressDirty = true;
         latestSentStatelessMocsConfig = mocsIndex;
     }
 
-    if (dispatchFlags.useGlobalAtomics != lastSentUseGlobalAtomics) {
+    bool globalAtomicsChanged = dispatchFlags.useGlobalAtomics != lastSentUseGlobalAtomics;
+    if (globalAtomicsChanged) {
         isStateBaseAddressDirty = true;
         lastSentUseGlobalAtomics = dispatchFlags.useGlobalAtomics;
     }
@@ -386,13 +433,27 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
     if (dispatchFlags.memoryCompressionState != MemoryCompressionState::NotApplicable) {
         memoryCompressionState = dispatchFlags.memoryCompressionState;
     }
-    if (memoryCompressionState != lastMemoryCompressionState) {
+    bool memoryCompressionChanged = memoryCompressionState != lastMemoryCompressionState;
+    if (memoryCompressionChanged) {
         isStateBaseAddressDirty = true;
         lastMemoryCompressionState = memoryCompressionState;
     }
 
     //Reprogram state base address if required
     if (isStateBaseAddressDirty || sourceLevelDebuggerActive) {
+        stateReprogrammingCounters.stateBaseAddress++;
+        stateReprogrammingCounters.dynamicStateHeap += dshDirty ? 1u : 0u;
+        stateReprogrammingCounters.indirectObjectHeap += iohDirty ? 1u : 0u;
+        stateReprogrammingCounters.surfaceStateHeap += sshDirty ? 1u : 0u;
+        stateReprogrammingCounters.generalState += stateBaseAddressDirty ? 1u : 0u;
+        stateReprogrammingCounters.statelessMocs += statelessMocsChanged ? 1u : 0u;
+        stateReprogrammingCounters.globalAtomics += globalAtomicsChanged ? 1u : 0u;
+        stateReprogrammingCounters.memoryCompression += memoryCompressionChanged ? 1u : 0u;
+        stateReprogrammingCounters.sourceLevelDebugger += sourceLevelDebuggerActive ? 1u : 0u;
+        SubmissionCounters::increment(submissionCounters.stateBaseAddressReprogrammings);
+
+        SubmissionCounters::increment(submissionCounters.stallingPipeControls);
+        SubmissionCounters::increment(submissionCounters.cacheFlushes);
         addPipeControlBeforeStateBaseAddress(commandStreamCSR);
         programAdditionalPipelineSelect(commandStreamCSR, dispatchFlags.pipelineSelectArgs, true);
 
@@ -474,6 +535,11 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
         requiresInstructionCacheFlush = false;
     }
 
+    if (requiresFullCacheFlush) {
+        MemorySynchronizationCommands<GfxFamily>::addFullCacheFlush(commandStreamCSR);
+        requiresFullCacheFlush = false;
+    }
+
     // Add a Pipe Control if we have a dependency on a previous walker to avoid concurrency issues.
     if (taskLevel > this->taskLevel) {
         if (!timestampPacketWriteEnabled) {
@@ -519,6 +585,10 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
         experimentalCmdBuffer->makeResidentAllocations();
     }
 
+    if (sampleGpuTimeline) {
+        makeResident(*gpuTimelineSampler->getTimestampsAllocation());
+    }
+
     if (workPartitionAllocation) {
         makeResident(*workPartitionAllocation);
     }
@@ -533,6 +603,9 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
     GraphicsAllocation *chainedBatchBuffer = nullptr;
     bool directSubmissionEnabled = isDirectSubmissionEnabled();
     if (submitTask) {
+        if (sampleGpuTimeline) {
+            programGpuTimelineTimestamp(commandStreamTask, gpuTimelineSampler->getEndTimestampGpuAddress());
+        }
         programEndingCmd(commandStreamTask, device, &bbEndLocation, directSubmissionEnabled);
         this->emitNoop(commandStreamTask, bbEndPaddingSize);
         this->alignToCacheLine(commandStreamTask);
@@ -593,6 +666,9 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
             commandBuffer->pipeControlThatMayBeErasedLocation = currentPipeControlForNooping;
             commandBuffer->epiloguePipeControlLocation = epiloguePipeControlLocation;
             this->submissionAggregator->recordCommandBuffer(commandBuffer);
+
+            this->batchedSubmissionsCount++;
+            this->batchedSubmissionsSize += (commandStreamTask.getUsed() - commandStreamStartTask) + (commandStreamCSR.getUsed() - commandStreamStartCSR);
         }
     } else {
         this->makeSurfacePackNonResident(this->getResidencyAllocations());
@@ -619,7 +695,14 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
     }
     implicitFlush |= checkImplicitFlushForGpuIdle();
 
-    if (this->dispatchMode == DispatchMode::BatchedDispatch && implicitFlush) {
+    if (this->dispatchMode == DispatchMode::BatchedDispatchWithCounter) {
+        if (this->batchedSubmissionsCount >= this->batchedDispatchMaxSubmissions ||
+            this->batchedSubmissionsSize >= this->batchedDispatchMaxBatchSize) {
+            implicitFlush = true;
+        }
+    }
+
+    if ((this->dispatchMode == DispatchMode::BatchedDispatch || this->dispatchMode == DispatchMode::BatchedDispatchWithCounter) && implicitFlush) {
         this->flushBatchedSubmissions();
     }
 
@@ -644,15 +727,34 @@ void CommandStreamReceiverHw<GfxFamily>::forcePipeControl(NEO::LinearStream &com
     MemorySynchronizationCommands<GfxFamily>::addPipeControl(commandStreamCSR, args);
 }
 
+template <typename GfxFamily>
+void CommandStreamReceiverHw<GfxFamily>::programGpuTimelineTimestamp(LinearStream &cmdStream, uint64_t timestampAddress) {
+    PipeControlArgs args;
+    MemorySynchronizationCommands<GfxFamily>::addPipeControlAndProgramPostSyncOperation(
+        cmdStream,
+        PIPE_CONTROL::POST_SYNC_OPERATION_WRITE_TIMESTAMP,
+        timestampAddress,
+        0llu,
+        peekHwInfo(),
+        args);
+}
+
+template <typename GfxFamily>
+size_t CommandStreamReceiverHw<GfxFamily>::getCmdSizeForGpuTimelineTimestamp() const {
+    return MemorySynchronizationCommands<GfxFamily>::getSizeForPipeControlWithPostSyncOperation(peekHwInfo());
+}
+
 template <typename GfxFamily>
 inline void CommandStreamReceiverHw<GfxFamily>::programStallingPipeControlForBarrier(LinearStream &cmdStream, DispatchFlags &dispatchFlags) {
     stallingPipeControlOnNextFlushRequired = false;
+    SubmissionCounters::increment(submissionCounters.stallingPipeControls);
 
     auto barrierTimestampPacketNodes = dispatchFlags.barrierTimestampPacketNodes;
 
     if (barrierTimestampPacketNodes && barrierTimestampPacketNodes->peekNodes().size() != 0) {
         auto barrierTimestampPacketGpuAddress = TimestampPacketHelper::getContextEndGpuAddress(*dispatchFlags.barrierTimestampPacketNodes->peekNodes()[0]);
 
+        SubmissionCounters::increment(submissionCounters.cacheFlushes);
         PipeControlArgs args(true);
         MemorySynchronizationCommands<GfxFamily>::addPipeControlAndProgramPostSyncOperation(
             cmdStream,
@@ -674,6 +776,16 @@ inline bool CommandStreamReceiverHw<GfxFamily>::flushBatchedSubmissions() {
     if (this->dispatchMode == DispatchMode::ImmediateDispatch) {
         return true;
     }
+    return flushAggregatedSubmissions();
+}
+
+template <typename GfxFamily>
+inline bool CommandStreamReceiverHw<GfxFamily>::flushCoalescedSubmissions() {
+    return flushAggregatedSubmissions();
+}
+
+template <typename GfxFamily>
+inline bool CommandStreamReceiverHw<GfxFamily>::flushAggregatedSubmissions() {
     typedef typename GfxFamily::MI_BATCH_BUFFER_START MI_BATCH_BUFFER_START;
     typedef typename GfxFamily::PIPE_CONTROL PIPE_CONTROL;
     std::unique_lock<MutexType> lockGuard(ownershipMutex);
@@ -763,6 +875,8 @@ inline bool CommandStreamReceiverHw<GfxFamily>::flushBatchedSubmissions() {
             resourcePackage.clear();
         }
         this->totalMemoryUsed = 0;
+        this->batchedSubmissionsCount = 0;
+        this->batchedSubmissionsSize = 0;
     }
 
     return submitResult;
@@ -801,6 +915,9 @@ size_t CommandStreamReceiverHw<GfxFamily>::getRequiredCmdStreamSize(const Dispat
     if (experimentalCmdBuffer.get() != nullptr) {
         size += experimentalCmdBuffer->getRequiredInjectionSize<GfxFamily>();
     }
+    if (gpuTimelineSampler && gpuTimelineSampler->getSamplingPeriod() > 0) {
+        size += getCmdSizeForGpuTimelineTimestamp();
+    }
 
     size += TimestampPacketHelper::getRequiredCmdStreamSize<GfxFamily>(dispatchFlags.csrDependencies);
 
@@ -817,6 +934,10 @@ size_t CommandStreamReceiverHw<GfxFamily>::getRequiredCmdStreamSize(const Dispat
         size += sizeof(typename GfxFamily::PIPE_CONTROL);
     }
 
+    if (requiresFullCacheFlush) {
+        size += MemorySynchronizationCommands<GfxFamily>::getSizeForFullCacheFlush();
+    }
+
     if (DebugManager.flags.ForcePipeControlPriorToWalker.get()) {
         size += 2 * sizeof(PIPE_CONTROL);
     }
@@ -847,6 +968,7 @@ inline void CommandStreamReceiverHw<GfxFamily>::emitNoop(LinearStream &commandSt
 
 template <typename GfxFamily>
 inline void CommandStreamReceiverHw<GfxFamily>::waitForTaskCountWithKmdNotifyFallback(uint32_t taskCountToWait, FlushStamp flushStampToWait, bool useQuickKmdSleep, bool forcePowerSavingMode) {
+    auto waitStart = std::chrono::steady_clock::now();
     updateTagFromWait();
 
     int64_t waitTimeout = 0;
@@ -860,6 +982,7 @@ inline void CommandStreamReceiverHw<GfxFamily>::waitForTaskCountWithKmdNotifyFal
 
     auto status = waitForCompletionWithTimeout(enableTimeout, waitTimeout, taskCountToWait);
     if (!status) {
+        SubmissionCounters::increment(submissionCounters.kmdNotifySleeps);
         waitForFlushStamp(flushStampToWait);
         //now call blocking wait, this is to ensure that task count is reached
         waitForCompletionWithTimeout(false, 0, taskCountToWait);
@@ -869,11 +992,26 @@ inline void CommandStreamReceiverHw<GfxFamily>::waitForTaskCountWithKmdNotifyFal
     if (kmdNotifyHelper->quickKmdSleepForSporadicWaitsEnabled()) {
         kmdNotifyHelper->updateLastWaitForCompletionTimestamp();
     }
+    kmdNotifyHelper->updateAverageWaitDuration(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - waitStart).count());
+
+    submissionCounters.recordWaitTime(waitStart);
 
     PRINT_DEBUG_STRING(DebugManager.flags.LogWaitingForCompletion.get(), stdout,
                        "\nWaiting completed. Current value: %u\n", *getTagAddress());
 }
 
+template <typename GfxFamily>
+SubmissionStatistics CommandStreamReceiverHw<GfxFamily>::getSubmissionStatistics() const {
+    auto statistics = CommandStreamReceiver::getSubmissionStatistics();
+    if (directSubmission) {
+        statistics.ringBufferSwitches += directSubmission->getRingBufferSwitches();
+    }
+    if (blitterDirectSubmission) {
+        statistics.ringBufferSwitches += blitterDirectSubmission->getRingBufferSwitches();
+    }
+    return statistics;
+}
+
 template <typename GfxFamily>
 inline const HardwareInfo &CommandStreamReceiverHw<GfxFamily>::peekHwInfo() const {
     return *executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->getHardwareInfo();
@@ -1035,6 +1173,11 @@ uint32_t CommandStreamReceiverHw<GfxFamily>::blitBuffer(const BlitPropertiesCont
 
         makeResident(*blitProperties.srcAllocation);
         makeResident(*blitProperties.dstAllocation);
+        // any other write may leave compressed data behind
+        bool auxResolved = (blitProperties.auxTranslationDirection == AuxTranslationDirection::AuxToNonAux);
+        if (blitProperties.dstAllocation->isAuxResolved() != auxResolved) {
+            blitProperties.dstAllocation->setAuxResolved(auxResolved);
+        }
         if (blitProperties.clearColorAllocation) {
             makeResident(*blitProperties.clearColorAllocation);
         }
@@ -19,6 +19,8 @@
 
 #include "csr_properties_flags.h"
 
+#include <atomic>
+#include <chrono>
 #include <limits>
 
 namespace NEO {
@@ -124,4 +126,78 @@ struct CsrSizeRequestFlags {
     bool numGrfRequiredChanged = false;
     bool specialPipelineSelectModeChanged = false;
 };
+
+struct StateReprogrammingCounters {
+    uint64_t flushes = 0u;
+    uint64_t l3Config = 0u;
+    uint64_t coherency = 0u;
+    uint64_t numGrf = 0u;
+    uint64_t mediaSampler = 0u;
+    uint64_t specialPipelineSelectMode = 0u;
+    uint64_t threadArbitration = 0u;
+    uint64_t preemption = 0u;
+    uint64_t mediaVfeState = 0u;
+    uint64_t stateBaseAddress = 0u;
+    uint64_t dynamicStateHeap = 0u;
+    uint64_t indirectObjectHeap = 0u;
+    uint64_t surfaceStateHeap = 0u;
+    uint64_t generalState = 0u;
+    uint64_t statelessMocs = 0u;
+    uint64_t globalAtomics = 0u;
+    uint64_t memoryCompression = 0u;
+    uint64_t sourceLevelDebugger = 0u;
+};
+
+constexpr uint32_t waitTimeHistogramBuckets = 16u;
+
+struct SubmissionStatistics {
+    uint64_t flushes = 0u;
+    uint64_t ringBufferSwitches = 0u;
+    uint64_t stallingPipeControls = 0u;
+    uint64_t stateBaseAddressReprogrammings = 0u;
+    uint64_t cacheFlushes = 0u;
+    uint64_t kmdNotifySleeps = 0u;
+    // bucket i counts waits shorter than 2^i microseconds, the last bucket also counts all longer waits
+    uint64_t waitTimeHistogram[waitTimeHistogramBuckets] = {};
+};
+
+// Updated without holding CSR ownership, so API queries can read them at any time
+struct SubmissionCounters {
+    static void increment(std::atomic<uint64_t> &counter) {
+        counter.fetch_add(1u, std::memory_order_relaxed);
+    }
+
+    void recordWaitTime(std::chrono::steady_clock::time_point waitStart) {
+        auto waitTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - waitStart);
+        recordWaitTime(static_cast<uint64_t>(waitTime.count()));
+    }
+
+    void recordWaitTime(uint64_t microseconds) {
+        uint32_t bucket = 0u;
+        while (bucket < waitTimeHistogramBuckets - 1 && microseconds >= (1ull << bucket)) {
+            bucket++;
+        }
+        increment(waitTimeHistogram[bucket]);
+    }
+
+    SubmissionStatistics read() const {
+        SubmissionStatistics statistics;
+        statistics.flushes = flushes.load(std::memory_order_relaxed);
+        statistics.stallingPipeControls = stallingPipeControls.load(std::memory_order_relaxed);
+        statistics.stateBaseAddressReprogrammings = stateBaseAddressReprogrammings.load(std::memory_order_relaxed);
+        statistics.cacheFlushes = cacheFlushes.load(std::memory_order_relaxed);
+        statistics.kmdNotifySleeps = kmdNotifySleeps.load(std::memory_order_relaxed);
+        for (uint32_t i = 0; i < waitTimeHistogramBuckets; i++) {
+            statistics.waitTimeHistogram[i] = waitTimeHistogram[i].load(std::memory_order_relaxed);
+        }
+        return statistics;
+    }
+
+    std::atomic<uint64_t> flushes{0u};
+    std::atomic<uint64_t> stallingPipeControls{0u};
+    std::atomic<uint64_t> stateBaseAddressReprogrammings{0u};
+    std::atomic<uint64_t> cacheFlushes{0u};
+    std::atomic<uint64_t> kmdNotifySleeps{0u};
+    std::atomic<uint64_t> waitTimeHistogram[waitTimeHistogramBuckets] = {};
+};
 } // namespace NEO
@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/gpu_timeline_sampler.h"
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/os_interface/os_context.h"
+
+#include <cstring>
+
+namespace NEO {
+
+namespace {
+constexpr size_t timestampsPerSlot = 2u;
+} // namespace
+
+GpuTimelineSampler::GpuTimelineSampler(CommandStreamReceiver &csr, OSTime *osTime, double profilingTimerResolution)
+    : commandStreamReceiver(csr), osTime(osTime), timerResolution(profilingTimerResolution), slots(ringSize) {
+    static_assert(ringSize * timestampsPerSlot * sizeof(uint64_t) <= MemoryConstants::pageSize, "timeline ring does not fit in a page");
+    timestamps = csr.getMemoryManager()->allocateGraphicsMemoryWithProperties({csr.getRootDeviceIndex(), MemoryConstants::pageSize, GraphicsAllocation::AllocationType::INTERNAL_HOST_MEMORY, csr.getOsContext().getDeviceBitfield()});
+    UNRECOVERABLE_IF(timestamps == nullptr);
+    memset(timestamps->getUnderlyingBuffer(), 0, timestamps->getUnderlyingBufferSize());
+    if (osTime) {
+        osTime->getCpuGpuTime(&referenceTime);
+    }
+}
+
+GpuTimelineSampler::~GpuTimelineSampler() {
+    commandStreamReceiver.getMemoryManager()->freeGraphicsMemory(timestamps);
+}
+
+bool GpuTimelineSampler::startSample(uint32_t taskCount) {
+    if (samplingPeriod == 0 || (submissionCount++ % samplingPeriod) != 0) {
+        return false;
+    }
+    auto slotIndex = static_cast<uint32_t>(sampledCount % ringSize);
+    auto &slot = slots[slotIndex];
+    // a slot the GPU may still write to is never reused, the submission is skipped instead
+    if (slot.used && !resolveSlot(slot, slotIndex)) {
+        return false;
+    }
+
+    slot = {};
+    slot.used = true;
+    slot.sample.taskCount = taskCount;
+    if (osTime) {
+        osTime->getCpuTime(&slot.sample.submitTimeNs);
+    }
+    sampledCount++;
+    return true;
+}
+
+uint64_t GpuTimelineSampler::getStartTimestampGpuAddress() const {
+    auto slotIndex = (sampledCount - 1) % ringSize;
+    return timestamps->getGpuAddress() + slotIndex * timestampsPerSlot * sizeof(uint64_t);
+}
+
+uint64_t GpuTimelineSampler::getEndTimestampGpuAddress() const {
+    return getStartTimestampGpuAddress() + sizeof(uint64_t);
+}
+
+bool GpuTimelineSampler::resolveSlot(Slot &slot, uint32_t slotIndex) {
+    if (slot.resolved) {
+        return true;
+    }
+    if (*commandStreamReceiver.getTagAddress() < slot.sample.taskCount) {
+        return false;
+    }
+    auto gpuTimestamps = static_cast<uint64_t *>(ptrOffset(timestamps->getUnderlyingBuffer(), slotIndex * timestampsPerSlot * sizeof(uint64_t)));
+    slot.sample.gpuStartTimeNs = gpuTicksToHostNs(gpuTimestamps[0]);
+    slot.sample.gpuEndTimeNs = gpuTicksToHostNs(gpuTimestamps[1]);
+    slot.resolved = true;
+    return true;
+}
+
+uint64_t GpuTimelineSampler::gpuTicksToHostNs(uint64_t ticks) const {
+    auto deltaNs = (static_cast<double>(ticks) - static_cast<double>(referenceTime.GPUTimeStamp)) * timerResolution;
+    return static_cast<uint64_t>(static_cast<double>(referenceTime.CPUTimeinNS) + deltaNs);
+}
+
+uint32_t GpuTimelineSampler::readSamples(Sample *outSamples, uint32_t maxSamples) {
+    auto firstSampled = sampledCount > ringSize ? sampledCount - ringSize : 0u;
+    uint32_t count = 0u;
+    for (auto sampled = firstSampled; sampled < sampledCount && count < maxSamples; sampled++) {
+        auto slotIndex = static_cast<uint32_t>(sampled % ringSize);
+        if (resolveSlot(slots[slotIndex], slotIndex)) {
+            outSamples[count++] = slots[slotIndex].sample;
+        }
+    }
+    return count;
+}
+
+} // namespace NEO
@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/os_interface/os_time.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace NEO {
+
+class CommandStreamReceiver;
+class GraphicsAllocation;
+
+// Records GPU start and end timestamps of 1 in N flushTask submissions of an engine in a ring buffer.
+// Timestamps are written by PIPE_CONTROLs and converted to host nanoseconds when read back, so they can be
+// compared with the host time of the submission.
+class GpuTimelineSampler {
+  public:
+    static constexpr uint32_t ringSize = 256u;
+
+    struct Sample {
+        uint32_t taskCount = 0u;
+        uint64_t submitTimeNs = 0u;
+        uint64_t gpuStartTimeNs = 0u;
+        uint64_t gpuEndTimeNs = 0u;
+    };
+
+    GpuTimelineSampler(CommandStreamReceiver &csr, OSTime *osTime, double profilingTimerResolution);
+    ~GpuTimelineSampler();
+
+    void setSamplingPeriod(uint32_t period) { samplingPeriod = period; }
+    uint32_t getSamplingPeriod() const { return samplingPeriod; }
+
+    // called once per submission, returns true if the submission with the given task count is sampled
+    bool startSample(uint32_t taskCount);
+    uint64_t getStartTimestampGpuAddress() const;
+    uint64_t getEndTimestampGpuAddress() const;
+    GraphicsAllocation *getTimestampsAllocation() const { return timestamps; }
+
+    // copies completed samples, oldest first, and returns their count
+    uint32_t readSamples(Sample *outSamples, uint32_t maxSamples);
+
+  protected:
+    struct Slot {
+        Sample sample;
+        bool used = false;
+        bool resolved = false;
+    };
+
+    bool resolveSlot(Slot &slot, uint32_t slotIndex);
+    uint64_t gpuTicksToHostNs(uint64_t ticks) const;
+
+    CommandStreamReceiver &commandStreamReceiver;
+    OSTime *osTime;
+    double timerResolution;
+    TimeStampData referenceTime = {};
+
+    GraphicsAllocation *timestamps = nullptr;
+    std::vector<Slot> slots;
+    uint64_t sampledCount = 0u;
+    uint64_t submissionCount = 0u;
+    uint32_t samplingPeriod = 0u;
+};
+
+} // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -13,6 +13,7 @@
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/os_interface/os_context.h"
 
 namespace NEO {
 ScratchSpaceController::ScratchSpaceController(uint32_t rootDeviceIndex, ExecutionEnvironment &environment, InternalAllocationStorage &allocationStorage)
@@ -31,6 +32,18 @@ ScratchSpaceController::~ScratchSpaceController() {
     }
 }
 
+bool ScratchSpaceController::shrinkScratchSpace(uint32_t requiredPerThreadScratchSize, uint32_t currentTaskCount, OsContext &osContext) {
+    size_t requiredScratchSizeInBytes = requiredPerThreadScratchSize * computeUnitsUsedForScratch;
+    if (scratchAllocation == nullptr || requiredScratchSizeInBytes == 0 || requiredScratchSizeInBytes >= scratchSizeBytes) {
+        return false;
+    }
+    scratchAllocation->updateTaskCount(currentTaskCount, osContext.getContextId());
+    csrAllocationStorage.storeAllocation(std::unique_ptr<GraphicsAllocation>(scratchAllocation), TEMPORARY_ALLOCATION);
+    scratchAllocation = nullptr;
+    scratchSizeBytes = 0;
+    return true;
+}
+
 MemoryManager *ScratchSpaceController::getMemoryManager() const {
     UNRECOVERABLE_IF(executionEnvironment.memoryManager.get() == nullptr);
     return executionEnvironment.memoryManager.get();
@@ -52,6 +52,8 @@ class ScratchSpaceController {
     inline uint32_t getPerThreadScratchSpaceSize() {
         return static_cast<uint32_t>(scratchSizeBytes / computeUnitsUsedForScratch);
     }
+    // releases a scratch allocation larger than required, the next request allocates the smaller size
+    bool shrinkScratchSpace(uint32_t requiredPerThreadScratchSize, uint32_t currentTaskCount, OsContext &osContext);
 
     virtual void reserveHeap(IndirectHeap::Type heapType, IndirectHeap *&indirectHeap) = 0;
     virtual void programHeaps(HeapContainer &heapContainer,
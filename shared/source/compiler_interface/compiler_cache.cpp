@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,20 +12,27 @@
 #include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/utilities/debug_settings_reader.h"
+#include "shared/source/utilities/mapped_file.h"
 
 #include "config.h"
 #include "os_inc.h"
 
+#include <algorithm>
+#include <cstdio>
 #include <cstring>
 #include <iomanip>
-#include <mutex>
 #include <sstream>
 #include <string>
 
 namespace NEO {
-std::mutex CompilerCache::cacheAccessMtx;
 const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, const ArrayRef<const char> input,
                                                    const ArrayRef<const char> options, const ArrayRef<const char> internalOptions) {
+    return getCachedFileName(hwInfo, input, options, internalOptions, ArrayRef<const char>());
+}
+
+const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, const ArrayRef<const char> input,
+                                                   const ArrayRef<const char> options, const ArrayRef<const char> internalOptions,
+                                                   const ArrayRef<const char> specConstants) {
     Hash hash;
 
     hash.update("----", 4);
@@ -34,6 +41,10 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
     hash.update(&*options.begin(), options.size());
     hash.update("----", 4);
     hash.update(&*internalOptions.begin(), internalOptions.size());
+    if (false == specConstants.empty()) {
+        hash.update("----", 4);
+        hash.update(&*specConstants.begin(), specConstants.size());
+    }
 
     hash.update("----", 4);
     hash.update(reinterpret_cast<const char *>(&hwInfo.platform), sizeof(hwInfo.platform));
@@ -54,20 +65,175 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
 CompilerCache::CompilerCache(const CompilerCacheConfig &cacheConfig)
     : config(cacheConfig){};
 
+std::string CompilerCache::getShardDir(const std::string &kernelFileHash) const {
+    if (kernelFileHash.size() <= shardNameLength) {
+        return config.cacheDir;
+    }
+    return config.cacheDir + PATH_SEPARATOR + kernelFileHash.substr(0, shardNameLength);
+}
+
+std::string CompilerCache::getCachedFilePath(const std::string &kernelFileHash) const {
+    return getShardDir(kernelFileHash) + PATH_SEPARATOR + kernelFileHash + config.cacheFileExtension;
+}
+
+std::string CompilerCache::getIndexFilePath() const {
+    return config.cacheDir + PATH_SEPARATOR + "cache_index" + config.cacheFileExtension;
+}
+
 bool CompilerCache::cacheBinary(const std::string kernelFileHash, const char *pBinary, uint32_t binarySize) {
     if (pBinary == nullptr || binarySize == 0) {
         return false;
     }
-    std::string filePath = config.cacheDir + PATH_SEPARATOR + kernelFileHash + config.cacheFileExtension;
-    std::lock_guard<std::mutex> lock(cacheAccessMtx);
-    return 0 != writeDataToFile(filePath.c_str(), pBinary, binarySize);
+    if (config.cacheSize != 0u && binarySize > config.cacheSize) {
+        return false;
+    }
+
+    CompilerCacheOsHelper::createDirectory(getShardDir(kernelFileHash));
+
+    std::string filePath = getCachedFilePath(kernelFileHash);
+    {
+        CompilerCacheFileLock entryLock(filePath + ".lock");
+        if (!entryLock.isLocked()) {
+            return false;
+        }
+
+        std::string tmpFilePath = filePath + CompilerCacheOsHelper::getUniqueFileSuffix() + ".tmp";
+        if (binarySize != writeDataToFile(tmpFilePath.c_str(), pBinary, binarySize)) {
+            std::remove(tmpFilePath.c_str());
+            return false;
+        }
+        if (!CompilerCacheOsHelper::renameFile(tmpFilePath, filePath)) {
+            std::remove(tmpFilePath.c_str());
+            return false;
+        }
+        CompilerCacheOsHelper::touchFile(filePath);
+    }
+
+    // entry lock is released first, eviction takes entry locks under the index lock
+    if (config.cacheSize != 0u) {
+        updateIndex(kernelFileHash, binarySize);
+    }
+    return true;
 }
 
 std::unique_ptr<char[]> CompilerCache::loadCachedBinary(const std::string kernelFileHash, size_t &cachedBinarySize) {
-    std::string filePath = config.cacheDir + PATH_SEPARATOR + kernelFileHash + config.cacheFileExtension;
+    std::string filePath = getCachedFilePath(kernelFileHash);
+
+    auto cachedBinary = loadDataFromFile(filePath.c_str(), cachedBinarySize);
+    if (cachedBinary != nullptr && config.cacheSize != 0u) {
+        // hits only refresh the entry, eviction reads the modification time
+        CompilerCacheOsHelper::touchFile(filePath);
+    }
+    return cachedBinary;
+}
+
+std::unique_ptr<MappedFile> CompilerCache::loadCachedBinaryMapped(const std::string kernelFileHash) {
+    std::string filePath = getCachedFilePath(kernelFileHash);
+
+    auto mappedBinary = MappedFile::create(filePath);
+    if (mappedBinary != nullptr && config.cacheSize != 0u) {
+        CompilerCacheOsHelper::touchFile(filePath);
+    }
+    return mappedBinary;
+}
+
+void CompilerCache::updateIndex(const std::string &kernelFileHash, uint64_t fileSize) {
+    std::string indexFilePath = getIndexFilePath();
+    CompilerCacheFileLock indexLock(indexFilePath + ".lock");
+    if (!indexLock.isLocked()) {
+        return;
+    }
+
+    std::vector<CompilerCacheIndexEntry> entries;
+    uint64_t lastAccess = 0u;
+    loadIndex(indexFilePath, entries, lastAccess);
+    ++lastAccess;
+
+    auto entry = std::find_if(entries.begin(), entries.end(), [&kernelFileHash](const auto &indexEntry) {
+        return indexEntry.kernelFileHash == kernelFileHash;
+    });
+    if (entry != entries.end()) {
+        entry->fileSize = fileSize;
+        entry->lastAccess = lastAccess;
+    } else {
+        entries.push_back({kernelFileHash, fileSize, lastAccess});
+    }
+
+    evictEntries(entries);
+    saveIndex(indexFilePath, entries, lastAccess);
+}
+
+void CompilerCache::evictEntries(std::vector<CompilerCacheIndexEntry> &entries) {
+    uint64_t totalSize = 0u;
+    for (const auto &entry : entries) {
+        totalSize += entry.fileSize;
+    }
+    if (totalSize <= config.cacheSize) {
+        return;
+    }
+
+    for (auto &entry : entries) {
+        entry.lastModification = CompilerCacheOsHelper::getLastModificationTime(getCachedFilePath(entry.kernelFileHash));
+    }
+    std::sort(entries.begin(), entries.end(), [](const auto &lhs, const auto &rhs) {
+        if (lhs.lastModification != rhs.lastModification) {
+            return lhs.lastModification < rhs.lastModification;
+        }
+        return lhs.lastAccess < rhs.lastAccess;
+    });
+
+    auto entry = entries.begin();
+    while (totalSize > config.cacheSize && entry != entries.end()) {
+        std::string filePath = getCachedFilePath(entry->kernelFileHash);
+        std::string lockFilePath = filePath + ".lock";
+        // entries locked by another process are skipped, the index lock is not held while waiting on them
+        CompilerCacheFileLock entryLock(lockFilePath, false);
+        if (!entryLock.isLocked() || (std::remove(filePath.c_str()) != 0 && fileExists(filePath))) {
+            ++entry;
+            continue;
+        }
+        // removed while still held, the next store of this entry recreates it
+        std::remove(lockFilePath.c_str());
+        totalSize -= entry->fileSize;
+        entry = entries.erase(entry);
+    }
+}
 
-    std::lock_guard<std::mutex> lock(cacheAccessMtx);
-    return loadDataFromFile(filePath.c_str(), cachedBinarySize);
+bool CompilerCache::loadIndex(const std::string &indexFilePath, std::vector<CompilerCacheIndexEntry> &entries, uint64_t &lastAccess) {
+    size_t indexSize = 0u;
+    auto indexData = loadDataFromFile(indexFilePath.c_str(), indexSize);
+    if (indexData == nullptr || indexSize == 0u) {
+        return false;
+    }
+
+    std::istringstream indexStream(std::string(indexData.get(), indexSize));
+    if (!(indexStream >> lastAccess)) {
+        lastAccess = 0u;
+        return false;
+    }
+
+    CompilerCacheIndexEntry entry;
+    while (indexStream >> entry.kernelFileHash >> entry.fileSize >> entry.lastAccess) {
+        entries.push_back(entry);
+    }
+    return true;
+}
+
+bool CompilerCache::saveIndex(const std::string &indexFilePath, const std::vector<CompilerCacheIndexEntry> &entries, uint64_t lastAccess) {
+    std::ostringstream indexStream;
+    indexStream << lastAccess << "\n";
+    for (const auto &entry : entries) {
+        indexStream << entry.kernelFileHash << " " << entry.fileSize << " " << entry.lastAccess << "\n";
+    }
+    auto indexData = indexStream.str();
+
+    std::string tmpFilePath = indexFilePath + CompilerCacheOsHelper::getUniqueFileSuffix() + ".tmp";
+    if (indexData.size() != writeDataToFile(tmpFilePath.c_str(), indexData.c_str(), indexData.size()) ||
+        !CompilerCacheOsHelper::renameFile(tmpFilePath, indexFilePath)) {
+        std::remove(tmpFilePath.c_str());
+        return false;
+    }
+    return true;
 }
 
 } // namespace NEO
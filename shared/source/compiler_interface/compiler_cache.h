@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,22 +12,34 @@
 #include <cstdint>
 #include <cstring>
 #include <memory>
-#include <mutex>
 #include <string>
+#include <vector>
 
 namespace NEO {
 struct HardwareInfo;
+class MappedFile;
 
 struct CompilerCacheConfig {
     bool enabled = true;
     std::string cacheFileExtension;
     std::string cacheDir;
+    uint64_t cacheSize = 0u;
+};
+
+struct CompilerCacheIndexEntry {
+    std::string kernelFileHash;
+    uint64_t fileSize = 0u;
+    uint64_t lastAccess = 0u;
+    uint64_t lastModification = 0u; // not stored in the index
 };
 
 class CompilerCache {
   public:
     static const std::string getCachedFileName(const HardwareInfo &hwInfo, ArrayRef<const char> input,
                                                ArrayRef<const char> options, ArrayRef<const char> internalOptions);
+    static const std::string getCachedFileName(const HardwareInfo &hwInfo, ArrayRef<const char> input,
+                                               ArrayRef<const char> options, ArrayRef<const char> internalOptions,
+                                               ArrayRef<const char> specConstants);
 
     CompilerCache(const CompilerCacheConfig &config);
     virtual ~CompilerCache() = default;
@@ -39,9 +51,45 @@ class CompilerCache {
 
     MOCKABLE_VIRTUAL bool cacheBinary(const std::string kernelFileHash, const char *pBinary, uint32_t binarySize);
     MOCKABLE_VIRTUAL std::unique_ptr<char[]> loadCachedBinary(const std::string kernelFileHash, size_t &cachedBinarySize);
+    MOCKABLE_VIRTUAL std::unique_ptr<MappedFile> loadCachedBinaryMapped(const std::string kernelFileHash);
+
+    static constexpr size_t shardNameLength = 2u;
 
   protected:
-    static std::mutex cacheAccessMtx;
+    std::string getShardDir(const std::string &kernelFileHash) const;
+    std::string getCachedFilePath(const std::string &kernelFileHash) const;
+    std::string getIndexFilePath() const;
+    MOCKABLE_VIRTUAL void updateIndex(const std::string &kernelFileHash, uint64_t fileSize);
+    MOCKABLE_VIRTUAL void evictEntries(std::vector<CompilerCacheIndexEntry> &entries);
+
+    static bool loadIndex(const std::string &indexFilePath, std::vector<CompilerCacheIndexEntry> &entries, uint64_t &lastAccess);
+    static bool saveIndex(const std::string &indexFilePath, const std::vector<CompilerCacheIndexEntry> &entries, uint64_t lastAccess);
+
     CompilerCacheConfig config;
 };
+
+namespace CompilerCacheOsHelper {
+bool createDirectory(const std::string &path);
+bool renameFile(const std::string &oldPath, const std::string &newPath);
+std::string getUniqueFileSuffix();
+bool touchFile(const std::string &path);
+uint64_t getLastModificationTime(const std::string &path);
+} // namespace CompilerCacheOsHelper
+
+class CompilerCacheFileLock {
+  public:
+    CompilerCacheFileLock(const std::string &lockFilePath, bool blocking = true);
+    ~CompilerCacheFileLock();
+
+    CompilerCacheFileLock(const CompilerCacheFileLock &) = delete;
+    CompilerCacheFileLock(CompilerCacheFileLock &&) = delete;
+    CompilerCacheFileLock &operator=(const CompilerCacheFileLock &) = delete;
+    CompilerCacheFileLock &operator=(CompilerCacheFileLock &&) = delete;
+
+    bool isLocked() const { return osHandle != invalidHandle; }
+
+  protected:
+    static constexpr intptr_t invalidHandle = -1;
+    intptr_t osHandle = invalidHandle;
+};
 } // namespace NEO
@@ -12,6 +12,8 @@
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/program/program_info_serializer.h"
+#include "shared/source/utilities/trace_events.h"
 
 #include "opencl/source/os_interface/os_inc_base.h"
 
@@ -25,6 +27,7 @@
 #undef IGC_CLEANUP
 #include "ocl_igc_interface/platform_helper.h"
 
+#include <algorithm>
 #include <fstream>
 
 namespace NEO {
@@ -41,10 +44,104 @@ CompilerInterface::CompilerInterface()
 }
 CompilerInterface::~CompilerInterface() = default;
 
+void CompilerInterface::enqueueBuildJob(CompilerJobsQueue::Job job, CompilerJobsQueue::Job retire) {
+    std::unique_lock<std::mutex> lock(buildJobsQueueMutex);
+    if (nullptr == buildJobsQueue) {
+        buildJobsQueue = std::make_unique<CompilerJobsQueue>(CompilerJobsQueue::getDefaultNumWorkers());
+    }
+    auto queue = buildJobsQueue.get();
+    lock.unlock();
+    queue->retireCompletedJobs();
+    queue->enqueue(std::move(job), std::move(retire));
+}
+
+void CompilerInterface::retireBuildJobs() {
+    std::unique_lock<std::mutex> lock(buildJobsQueueMutex);
+    auto queue = buildJobsQueue.get();
+    lock.unlock();
+    if (nullptr != queue) {
+        queue->retireCompletedJobs();
+    }
+}
+
+void CompilerInterface::drainBuildJobs() {
+    std::unique_lock<std::mutex> lock(buildJobsQueueMutex);
+    auto queue = buildJobsQueue.get();
+    lock.unlock();
+    if (nullptr != queue) {
+        queue->drain();
+    }
+}
+
+std::vector<uint64_t> CompilerInterface::getSortedSpecConstants(const specConstValuesMap &specializedValues) {
+    std::vector<std::pair<uint32_t, uint64_t>> specConstants(specializedValues.begin(), specializedValues.end());
+    std::sort(specConstants.begin(), specConstants.end());
+
+    std::vector<uint64_t> ret;
+    ret.reserve(specConstants.size() * 2);
+    for (const auto &specConst : specConstants) {
+        ret.push_back(specConst.first);
+        ret.push_back(specConst.second);
+    }
+    return ret;
+}
+
+bool CompilerInterface::loadCachedDeviceBinary(const TranslationInput &input, const std::string &kernelFileHash, TranslationOutput &output) {
+    bool cacheHit = false;
+    if (input.allowMappedCachedBinary) {
+        output.mappedDeviceBinary = cache->loadCachedBinaryMapped(kernelFileHash);
+        cacheHit = (output.mappedDeviceBinary != nullptr);
+    } else {
+        output.deviceBinary.mem = cache->loadCachedBinary(kernelFileHash, output.deviceBinary.size);
+        cacheHit = (output.deviceBinary.mem != nullptr);
+    }
+
+    auto &counter = cacheHit ? cacheHits : cacheMisses;
+    counter++;
+    PRINT_DEBUG_STRING(DebugManager.flags.PrintCompilerCacheStatistics.get(), stdout,
+                       "Compiler cache %s: %s, hits: %u, misses: %u\n", cacheHit ? "hit" : "miss", kernelFileHash.c_str(),
+                       cacheHits.load(), cacheMisses.load());
+    if (cacheHit) {
+        output.cachedFileHash = kernelFileHash;
+    }
+    return cacheHit;
+}
+
+bool CompilerInterface::cacheProgramInfo(const std::string &kernelFileHash, const std::vector<uint8_t> &programInfoBlob) {
+    if (kernelFileHash.empty() || programInfoBlob.empty()) {
+        return false;
+    }
+    return cache->cacheBinary(kernelFileHash + ProgramInfoSerialization::cacheEntrySuffix, reinterpret_cast<const char *>(programInfoBlob.data()), static_cast<uint32_t>(programInfoBlob.size()));
+}
+
+std::unique_ptr<char[]> CompilerInterface::loadCachedProgramInfo(const std::string &kernelFileHash, size_t &programInfoBlobSize) {
+    programInfoBlobSize = 0U;
+    if (kernelFileHash.empty()) {
+        return nullptr;
+    }
+    return cache->loadCachedBinary(kernelFileHash + ProgramInfoSerialization::cacheEntrySuffix, programInfoBlobSize);
+}
+
+bool CompilerInterface::cacheBinary(const std::string &fileHash, ArrayRef<const char> binary) {
+    if (nullptr == cache) {
+        return false;
+    }
+    return cache->cacheBinary(fileHash, binary.begin(), static_cast<uint32_t>(binary.size()));
+}
+
+std::unique_ptr<char[]> CompilerInterface::loadCachedBinary(const std::string &fileHash, size_t &binarySize) {
+    binarySize = 0U;
+    if (nullptr == cache) {
+        return nullptr;
+    }
+    return cache->loadCachedBinary(fileHash, binarySize);
+}
+
 TranslationOutput::ErrorCode CompilerInterface::build(
     const NEO::Device &device,
     const TranslationInput &input,
     TranslationOutput &output) {
+    ScopedTraceEvent traceEvent("build", TraceEvents::Category::compile);
     if (false == isCompilerAvailable(input.srcType, input.outType)) {
         return TranslationOutput::ErrorCode::CompilerNotAvailable;
     }
@@ -67,13 +164,19 @@ TranslationOutput::ErrorCode CompilerInterface::build(
     }
 
     std::string kernelFileHash;
+    std::vector<uint64_t> sortedSpecConstants;
+    ArrayRef<const char> specConstantsKey;
+    if (cachingMode != CachingMode::None) {
+        sortedSpecConstants = getSortedSpecConstants(input.specializedValues);
+        specConstantsKey = ArrayRef<const char>(reinterpret_cast<const char *>(sortedSpecConstants.data()), sortedSpecConstants.size() * sizeof(uint64_t));
+    }
     if (cachingMode == CachingMode::Direct) {
         kernelFileHash = CompilerCache::getCachedFileName(device.getHardwareInfo(),
                                                           input.src,
                                                           input.apiOptions,
-                                                          input.internalOptions);
-        output.deviceBinary.mem = cache->loadCachedBinary(kernelFileHash, output.deviceBinary.size);
-        if (output.deviceBinary.mem) {
+                                                          input.internalOptions,
+                                                          specConstantsKey);
+        if (loadCachedDeviceBinary(input, kernelFileHash, output)) {
             return TranslationOutput::ErrorCode::Success;
         }
     }
@@ -124,9 +227,9 @@ TranslationOutput::ErrorCode CompilerInterface::build(
     if (cachingMode == CachingMode::PreProcess) {
         kernelFileHash = CompilerCache::getCachedFileName(device.getHardwareInfo(), ArrayRef<const char>(intermediateRepresentation->GetMemory<char>(), intermediateRepresentation->GetSize<char>()),
                                                           input.apiOptions,
-                                                          input.internalOptions);
-        output.deviceBinary.mem = cache->loadCachedBinary(kernelFileHash, output.deviceBinary.size);
-        if (output.deviceBinary.mem) {
+                                                          input.internalOptions,
+                                                          specConstantsKey);
+        if (loadCachedDeviceBinary(input, kernelFileHash, output)) {
             return TranslationOutput::ErrorCode::Success;
         }
     }
@@ -147,7 +250,9 @@ TranslationOutput::ErrorCode CompilerInterface::build(
     }
 
     if (input.allowCaching) {
-        cache->cacheBinary(kernelFileHash, igcOutput->GetOutput()->GetMemory<char>(), static_cast<uint32_t>(igcOutput->GetOutput()->GetSize<char>()));
+        if (cache->cacheBinary(kernelFileHash, igcOutput->GetOutput()->GetMemory<char>(), static_cast<uint32_t>(igcOutput->GetOutput()->GetSize<char>()))) {
+            output.cachedFileHash = kernelFileHash;
+        }
     }
 
     TranslationOutput::makeCopy(output.deviceBinary, igcOutput->GetOutput());
@@ -160,7 +265,7 @@ TranslationOutput::ErrorCode CompilerInterface::compile(
     const NEO::Device &device,
     const TranslationInput &input,
     TranslationOutput &output) {
-
+    ScopedTraceEvent traceEvent("compile", TraceEvents::Category::compile);
     if ((IGC::CodeType::oclC != input.srcType) && (IGC::CodeType::elf != input.srcType)) {
         return TranslationOutput::ErrorCode::AlreadyCompiled;
     }
@@ -204,6 +309,7 @@ TranslationOutput::ErrorCode CompilerInterface::link(
     const NEO::Device &device,
     const TranslationInput &input,
     TranslationOutput &output) {
+    ScopedTraceEvent traceEvent("link", TraceEvents::Category::compile);
     if (false == isCompilerAvailable(input.srcType, input.outType)) {
         return TranslationOutput::ErrorCode::CompilerNotAvailable;
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,9 +8,11 @@
 #pragma once
 #include "shared/source/built_ins/sip.h"
 #include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/compiler_interface/compiler_jobs_queue.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/os_interface/os_library.h"
 #include "shared/source/utilities/arrayref.h"
+#include "shared/source/utilities/mapped_file.h"
 #include "shared/source/utilities/spinlock.h"
 
 #include "cif/common/cif_main.h"
@@ -18,8 +20,10 @@
 #include "ocl_igc_interface/fcl_ocl_device_ctx.h"
 #include "ocl_igc_interface/igc_ocl_device_ctx.h"
 
+#include <atomic>
 #include <map>
 #include <unordered_map>
+#include <vector>
 
 namespace NEO {
 class Device;
@@ -32,6 +36,7 @@ struct TranslationInput {
     }
 
     bool allowCaching = false;
+    bool allowMappedCachedBinary = false;
 
     ArrayRef<const char> src;
     ArrayRef<const char> apiOptions;
@@ -66,6 +71,8 @@ struct TranslationOutput {
     MemAndSize intermediateRepresentation;
     MemAndSize deviceBinary;
     MemAndSize debugData;
+    std::unique_ptr<MappedFile> mappedDeviceBinary;
+    std::string cachedFileHash;
     std::string frontendCompilerLog;
     std::string backendCompilerLog;
 
@@ -135,7 +142,27 @@ class CompilerInterface {
 
     MOCKABLE_VIRTUAL TranslationOutput::ErrorCode getSipKernelBinary(NEO::Device &device, SipKernelType type, std::vector<char> &retBinary);
 
+    MOCKABLE_VIRTUAL bool cacheProgramInfo(const std::string &kernelFileHash, const std::vector<uint8_t> &programInfoBlob);
+    MOCKABLE_VIRTUAL std::unique_ptr<char[]> loadCachedProgramInfo(const std::string &kernelFileHash, size_t &programInfoBlobSize);
+    MOCKABLE_VIRTUAL bool cacheBinary(const std::string &fileHash, ArrayRef<const char> binary);
+    MOCKABLE_VIRTUAL std::unique_ptr<char[]> loadCachedBinary(const std::string &fileHash, size_t &binarySize);
+
+    // retire is run on a later caller of enqueueBuildJob, retireBuildJobs or drainBuildJobs, never on a compiler thread
+    MOCKABLE_VIRTUAL void enqueueBuildJob(CompilerJobsQueue::Job job, CompilerJobsQueue::Job retire);
+    void retireBuildJobs();
+    void drainBuildJobs();
+
+    uint32_t getCacheHitsCount() const {
+        return cacheHits.load();
+    }
+
+    uint32_t getCacheMissesCount() const {
+        return cacheMisses.load();
+    }
+
   protected:
+    static std::vector<uint64_t> getSortedSpecConstants(const specConstValuesMap &specializedValues);
+    bool loadCachedDeviceBinary(const TranslationInput &input, const std::string &kernelFileHash, TranslationOutput &output);
     MOCKABLE_VIRTUAL bool initialize(std::unique_ptr<CompilerCache> cache, bool requireFcl);
     MOCKABLE_VIRTUAL bool loadFcl();
     MOCKABLE_VIRTUAL bool loadIgc();
@@ -145,6 +172,8 @@ class CompilerInterface {
         return std::unique_lock<SpinLock>{spinlock};
     }
     std::unique_ptr<CompilerCache> cache = nullptr;
+    std::atomic<uint32_t> cacheHits{0u};
+    std::atomic<uint32_t> cacheMisses{0u};
 
     using igcDevCtxUptr = CIF::RAII::UPtr_t<IGC::IgcOclDeviceCtxTagOCL>;
     using fclDevCtxUptr = CIF::RAII::UPtr_t<IGC::FclOclDeviceCtxTagOCL>;
@@ -158,6 +187,10 @@ class CompilerInterface {
     std::map<const Device *, fclDevCtxUptr> fclDeviceContexts;
     CIF::RAII::UPtr_t<IGC::FclOclTranslationCtxTagOCL> fclBaseTranslationCtx = nullptr;
 
+    // declared last, so that in-flight build jobs complete before compiler libraries are released
+    std::mutex buildJobsQueueMutex;
+    std::unique_ptr<CompilerJobsQueue> buildJobsQueue;
+
     MOCKABLE_VIRTUAL IGC::FclOclDeviceCtxTagOCL *getFclDeviceCtx(const Device &device);
     MOCKABLE_VIRTUAL IGC::IgcOclDeviceCtxTagOCL *getIgcDeviceCtx(const Device &device);
     MOCKABLE_VIRTUAL IGC::CodeType::CodeType_t getPreferredIntermediateRepresentation(const Device &device);
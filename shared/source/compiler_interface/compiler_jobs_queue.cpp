@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_jobs_queue.h"
+
+#include "shared/source/os_interface/os_thread.h"
+#include "shared/source/utilities/parallel_for.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace NEO {
+
+namespace {
+thread_local bool isRunningCompilerJob = false;
+} // namespace
+
+CompilerJobsQueue::CompilerJobsQueue(uint32_t numWorkers) : numWorkers(std::max(numWorkers, 1U)) {
+}
+
+CompilerJobsQueue::~CompilerJobsQueue() {
+    drain();
+
+    std::unique_lock<std::mutex> lock(queueMutex);
+    stopping = true;
+    lock.unlock();
+    jobAvailable.notify_all();
+
+    if (dispatcher) {
+        dispatcher->join();
+    }
+}
+
+uint32_t CompilerJobsQueue::getDefaultNumWorkers() {
+    return std::min(std::max(std::thread::hardware_concurrency(), 1U), maxWorkers);
+}
+
+void CompilerJobsQueue::enqueue(Job job, Job retire) {
+    std::unique_lock<std::mutex> lock(queueMutex);
+    if (nullptr == dispatcher) {
+        dispatcher = Thread::create(dispatch, reinterpret_cast<void *>(this));
+    }
+    pendingJobs.push_back({std::move(job), std::move(retire)});
+    ++jobsInFlight;
+    lock.unlock();
+    jobAvailable.notify_one();
+}
+
+void CompilerJobsQueue::retireCompletedJobs() {
+    // a job could otherwise drop the last reference to an object owning this queue
+    if (isRunningCompilerJob) {
+        return;
+    }
+    std::vector<Job> completed;
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        completed.swap(retireFunctions);
+    }
+    for (auto &retire : completed) {
+        retire();
+    }
+}
+
+void CompilerJobsQueue::drain() {
+    {
+        std::unique_lock<std::mutex> lock(queueMutex);
+        jobsCompleted.wait(lock, [this] { return 0U == jobsInFlight; });
+    }
+    retireCompletedJobs();
+}
+
+void *CompilerJobsQueue::dispatch(void *arg) {
+    auto self = reinterpret_cast<CompilerJobsQueue *>(arg);
+    std::unique_lock<std::mutex> lock(self->queueMutex);
+    while (true) {
+        self->jobAvailable.wait(lock, [self] { return self->stopping || (false == self->pendingJobs.empty()); });
+        if (self->pendingJobs.empty()) {
+            break;
+        }
+
+        std::vector<PendingJob> batch;
+        batch.swap(self->pendingJobs);
+        lock.unlock();
+        ParallelFor::run(batch.size(), self->numWorkers, [&batch](size_t jobIndex) {
+            isRunningCompilerJob = true;
+            batch[jobIndex].job();
+            batch[jobIndex].job = nullptr;
+            isRunningCompilerJob = false;
+        });
+        lock.lock();
+
+        for (auto &pendingJob : batch) {
+            if (pendingJob.retire) {
+                self->retireFunctions.push_back(std::move(pendingJob.retire));
+            }
+        }
+        self->jobsInFlight -= static_cast<uint32_t>(batch.size());
+        if (0U == self->jobsInFlight) {
+            self->jobsCompleted.notify_all();
+        }
+    }
+    return nullptr;
+}
+
+} // namespace NEO
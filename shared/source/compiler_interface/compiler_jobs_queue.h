@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class Thread;
+
+// Runs compiler jobs in the background. A single dispatcher thread takes all pending jobs and runs them
+// with ParallelFor. Retire functions of completed jobs are run later on a caller thread, so a job never
+// releases objects whose destruction could tear down the queue itself.
+class CompilerJobsQueue : NonCopyableOrMovableClass {
+  public:
+    using Job = std::function<void()>;
+    static constexpr uint32_t maxWorkers = 4U;
+
+    CompilerJobsQueue(uint32_t numWorkers);
+    ~CompilerJobsQueue();
+
+    void enqueue(Job job, Job retire = nullptr);
+    void retireCompletedJobs();
+    void drain();
+
+    uint32_t getNumWorkers() const {
+        return numWorkers;
+    }
+
+    bool isDispatcherCreated() const {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        return nullptr != dispatcher;
+    }
+
+    static uint32_t getDefaultNumWorkers();
+
+  protected:
+    struct PendingJob {
+        Job job;
+        Job retire;
+    };
+
+    static void *dispatch(void *arg);
+
+    uint32_t numWorkers = 1U;
+    uint32_t jobsInFlight = 0U;
+    bool stopping = false;
+    std::vector<PendingJob> pendingJobs;
+    std::vector<Job> retireFunctions;
+    std::unique_ptr<Thread> dispatcher;
+    mutable std::mutex queueMutex;
+    std::condition_variable jobAvailable;
+    std::condition_variable jobsCompleted;
+};
+
+} // namespace NEO
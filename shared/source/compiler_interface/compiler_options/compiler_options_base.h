@@ -13,6 +13,7 @@
 namespace NEO {
 namespace CompilerOptions {
 static constexpr ConstStringRef greaterThan4gbBuffersRequired = "-cl-intel-greater-than-4GB-buffer-required";
+static constexpr ConstStringRef largeGrf = "-cl-intel-256-GRF-per-thread";
 static constexpr ConstStringRef hasBufferOffsetArg = "-cl-intel-has-buffer-offset-arg";
 static constexpr ConstStringRef kernelDebugEnable = "-cl-kernel-debug-enable";
 static constexpr ConstStringRef arch32bit = "-m32";
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache.h"
+
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace NEO {
+namespace CompilerCacheOsHelper {
+bool createDirectory(const std::string &path) {
+    if (path.empty()) {
+        return false;
+    }
+    return 0 == mkdir(path.c_str(), 0777) || errno == EEXIST;
+}
+
+bool renameFile(const std::string &oldPath, const std::string &newPath) {
+    return 0 == std::rename(oldPath.c_str(), newPath.c_str());
+}
+
+std::string getUniqueFileSuffix() {
+    static std::atomic<uint32_t> fileCounter{0u};
+    return "." + std::to_string(getpid()) + "." + std::to_string(fileCounter++);
+}
+
+bool touchFile(const std::string &path) {
+    struct timespec times[2] = {};
+    if (0 != clock_gettime(CLOCK_REALTIME, &times[0])) {
+        return false;
+    }
+    times[1] = times[0];
+    return 0 == utimensat(AT_FDCWD, path.c_str(), times, 0);
+}
+
+uint64_t getLastModificationTime(const std::string &path) {
+    struct stat fileStat = {};
+    if (0 != stat(path.c_str(), &fileStat)) {
+        return 0u;
+    }
+    return static_cast<uint64_t>(fileStat.st_mtim.tv_sec) * 1000000000u + static_cast<uint64_t>(fileStat.st_mtim.tv_nsec);
+}
+} // namespace CompilerCacheOsHelper
+
+CompilerCacheFileLock::CompilerCacheFileLock(const std::string &lockFilePath, bool blocking) {
+    int fileDescriptor = open(lockFilePath.c_str(), O_CREAT | O_RDWR | O_CLOEXEC, 0666);
+    if (fileDescriptor < 0) {
+        return;
+    }
+    if (0 != flock(fileDescriptor, blocking ? LOCK_EX : LOCK_EX | LOCK_NB)) {
+        close(fileDescriptor);
+        return;
+    }
+    osHandle = static_cast<intptr_t>(fileDescriptor);
+}
+
+CompilerCacheFileLock::~CompilerCacheFileLock() {
+    if (isLocked()) {
+        auto fileDescriptor = static_cast<int>(osHandle);
+        flock(fileDescriptor, LOCK_UN);
+        close(fileDescriptor);
+    }
+}
+} // namespace NEO
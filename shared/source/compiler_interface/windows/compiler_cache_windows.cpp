@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache.h"
+
+#include "shared/source/os_interface/windows/windows_wrapper.h"
+
+#include <atomic>
+
+namespace NEO {
+namespace CompilerCacheOsHelper {
+bool createDirectory(const std::string &path) {
+    if (path.empty()) {
+        return false;
+    }
+    return CreateDirectoryA(path.c_str(), nullptr) || GetLastError() == ERROR_ALREADY_EXISTS;
+}
+
+bool renameFile(const std::string &oldPath, const std::string &newPath) {
+    return MoveFileExA(oldPath.c_str(), newPath.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+}
+
+std::string getUniqueFileSuffix() {
+    static std::atomic<uint32_t> fileCounter{0u};
+    return "." + std::to_string(GetCurrentProcessId()) + "." + std::to_string(fileCounter++);
+}
+
+bool touchFile(const std::string &path) {
+    HANDLE fileHandle = CreateFileA(path.c_str(), FILE_WRITE_ATTRIBUTES, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                    nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    FILETIME currentTime = {};
+    GetSystemTimePreciseAsFileTime(&currentTime);
+    auto result = SetFileTime(fileHandle, nullptr, &currentTime, &currentTime) != 0;
+    CloseHandle(fileHandle);
+    return result;
+}
+
+uint64_t getLastModificationTime(const std::string &path) {
+    WIN32_FILE_ATTRIBUTE_DATA fileAttributes = {};
+    if (!GetFileAttributesExA(path.c_str(), GetFileExInfoStandard, &fileAttributes)) {
+        return 0u;
+    }
+    return (static_cast<uint64_t>(fileAttributes.ftLastWriteTime.dwHighDateTime) << 32) | fileAttributes.ftLastWriteTime.dwLowDateTime;
+}
+} // namespace CompilerCacheOsHelper
+
+CompilerCacheFileLock::CompilerCacheFileLock(const std::string &lockFilePath, bool blocking) {
+    HANDLE fileHandle = CreateFileA(lockFilePath.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                    nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE) {
+        return;
+    }
+    OVERLAPPED overlapped = {};
+    DWORD lockFlags = blocking ? LOCKFILE_EXCLUSIVE_LOCK : LOCKFILE_EXCLUSIVE_LOCK | LOCKFILE_FAIL_IMMEDIATELY;
+    if (!LockFileEx(fileHandle, lockFlags, 0, MAXDWORD, MAXDWORD, &overlapped)) {
+        CloseHandle(fileHandle);
+        return;
+    }
+    osHandle = reinterpret_cast<intptr_t>(fileHandle);
+}
+
+CompilerCacheFileLock::~CompilerCacheFileLock() {
+    if (isLocked()) {
+        auto fileHandle = reinterpret_cast<HANDLE>(osHandle);
+        OVERLAPPED overlapped = {};
+        UnlockFileEx(fileHandle, 0, MAXDWORD, MAXDWORD, &overlapped);
+        CloseHandle(fileHandle);
+    }
+}
+} // namespace NEO
@@ -25,6 +25,9 @@ DECLARE_DEBUG_VARIABLE(int32_t, AUBDumpFilterKernelEndIdx, -1, "End index of ker
 DECLARE_DEBUG_VARIABLE(int32_t, AUBDumpToggleCaptureOnOff, 0, "Toggle AUB capture on/off")
 DECLARE_DEBUG_VARIABLE(int32_t, AubDumpOverrideMmioRegister, 0, "Override mmio offset from list with new value from AubDumpOverrideMmioRegisterValue")
 DECLARE_DEBUG_VARIABLE(int32_t, AubDumpOverrideMmioRegisterValue, 0, "Value to override mmio offset from AubDumpOverrideMmioRegister")
+DECLARE_DEBUG_VARIABLE(int32_t, AubDumpWriteBufferSize, -1, "-1: default (4MB), 0: default buffering of the standard library, >0: size in bytes of the write buffer of AUB files not written through aub_stream")
+DECLARE_DEBUG_VARIABLE(int32_t, AUBDumpSkipUnchangedPages, -1, "-1: default (disabled), 0: disabled, 1: pages of an allocation are written to AUB files not written through aub_stream only when their mapping or contents changed since the last write")
+DECLARE_DEBUG_VARIABLE(int32_t, TbxSkipUnchangedPages, -1, "-1: default (disabled), 0: disabled, 1: pages of an allocation are sent to the TBX server not through aub_stream only when their mapping or contents changed since the last write")
 DECLARE_DEBUG_VARIABLE(int32_t, SetCommandStreamReceiver, -1, "Set command stream receiver to: 0 - HW, 1 - AUB, 2 - TBX, 3 - HW & AUB, 4 - TBX & AUB")
 DECLARE_DEBUG_VARIABLE(int32_t, TbxPort, 4321, "TCP-IP port of TBX server")
 DECLARE_DEBUG_VARIABLE(bool, TbxFrontdoorMode, false, "Set TBX frontdoor mode for read and write memory accesses (the default mode is via backdoor)")
@@ -38,6 +41,7 @@ DECLARE_DEBUG_VARIABLE(bool, AUBDumpForceAllToLocalMemory, false, "Force placing
 /*DEBUG FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, EnableSWTags, false, "Enable software tagging in batch buffer")
 DECLARE_DEBUG_VARIABLE(bool, DumpSWTagsBXML, false, "Dump software tags BXML into a file")
+DECLARE_DEBUG_VARIABLE(int32_t, SWTagsHeapSize, -1, "-1: default (64KB), >0: size in bytes of the ring buffered software tag heap, clamped to 1KB - 1MB")
 DECLARE_DEBUG_VARIABLE(bool, DisableTimestampPacketOptimizations, false, "Allocate new allocation per node + dont reuse old nodes")
 DECLARE_DEBUG_VARIABLE(bool, DisableCachingForStatefulBufferAccess, false, "Disable caching for stateful buffer access")
 DECLARE_DEBUG_VARIABLE(bool, EnableDebugBreak, true, "Enable DEBUG_BREAKs")
@@ -45,6 +49,9 @@ DECLARE_DEBUG_VARIABLE(bool, FlushAllCaches, false, "pipe controls between enque
 DECLARE_DEBUG_VARIABLE(bool, DoNotFlushCaches, false, "clear all possible cache flush flags from pipe controls between enqueue flush")
 DECLARE_DEBUG_VARIABLE(bool, MakeEachEnqueueBlocking, false, "equivalent of finish after each enqueue")
 DECLARE_DEBUG_VARIABLE(bool, DisableResourceRecycling, false, "when set to true disables resource recycling optimization")
+DECLARE_DEBUG_VARIABLE(int32_t, CommandBufferPoolPrewarmCount, -1, "-1: default (0), >0: number of command buffers preallocated for reuse when command stream receiver is created")
+DECLARE_DEBUG_VARIABLE(int32_t, CommandBufferPoolHighWaterMark, -1, "-1: default (no limit), >=0: maximum number of completed command buffers kept for reuse by command stream receiver, oldest are released first")
+DECLARE_DEBUG_VARIABLE(int32_t, RecycleCompletedCommandBufferInPlace, -1, "-1: default (enabled), 0: disabled, 1: enabled. A full command buffer whose commands were all completed by the GPU is rewound instead of being replaced by another one")
 DECLARE_DEBUG_VARIABLE(bool, ForceDispatchScheduler, false, "dispatches scheduler kernel instead of kernel enqueued")
 DECLARE_DEBUG_VARIABLE(bool, TrackParentEvents, false, "events track their parents")
 DECLARE_DEBUG_VARIABLE(bool, RebuildPrecompiledKernels, false, "forces driver to recompile precompiled kernels from sources")
@@ -63,13 +70,16 @@ DECLARE_DEBUG_VARIABLE(int32_t, ForceAuxTranslationEnabled, -1, "-1: default, 0:
 DECLARE_DEBUG_VARIABLE(int32_t, SchedulerSimulationReturnInstance, 0, "prints execution model related debug information")
 DECLARE_DEBUG_VARIABLE(int32_t, SchedulerGWS, 0, "Forces gws of scheduler kernel, only multiple of 24 allowed or 0 - default selected")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableExperimentalCommandBuffer, 0, "Enables injection of experimental command buffer")
+DECLARE_DEBUG_VARIABLE(int32_t, GpuTimelineSamplingPeriod, 0, "0: disabled, N > 0: records GPU start and end timestamps of 1 in N submissions on every engine")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideStatelessMocsIndex, -1, "-1: feature inactive, >=0 : following MOCS index will be programmed for stateless accesses in state base address")
 DECLARE_DEBUG_VARIABLE(int32_t, CFEFusedEUDispatch, -1, "Set Fused EU dispatch in FrontEnd State command. -1 - default, 0 - enabled, 1 - disabled")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceAuxTranslationMode, -1, "-1: Default, 0: None, 1: Builtin, 2: Blit")
+DECLARE_DEBUG_VARIABLE(int32_t, SkipResolvedAuxTranslation, -1, "-1: default (enabled), 0: disabled, 1: enabled. Skip blit aux translations of allocations already resolved and not written since")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideGpuAddressSpace, -1, "-1: Default, !=-1: GPU address space range in bits")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideMaxWorkgroupSize, -1, "-1: Default, !=-1: Overrides max worgkroup size to this value")
 DECLARE_DEBUG_VARIABLE(int32_t, DoCpuCopyOnReadBuffer, -1, "-1: default 0: do not use CPU copy, 1: triggers CPU copy path for Read Buffer calls, only supported for some basic use cases (no blocked user events in dependencies tree)")
 DECLARE_DEBUG_VARIABLE(int32_t, DoCpuCopyOnWriteBuffer, -1, "-1: default 0: do not use CPU copy, 1: triggers CPU copy path for Write Buffer calls, only supported for some basic use cases (no blocked user events in dependencies tree)")
+DECLARE_DEBUG_VARIABLE(int32_t, DoCpuCopyOnSvmMemcpy, -1, "-1: default 0: do not use CPU copy, 1: use CPU copy for blocking SVM memcpy between host USM or system pointers regardless of size")
 DECLARE_DEBUG_VARIABLE(int32_t, PauseOnEnqueue, -1, "-1: default, -2: always, x: pause on enqueue number x and ask for user confirmation before and after execution, counted from 0")
 DECLARE_DEBUG_VARIABLE(int32_t, PauseOnBlitCopy, -1, "-1: default, -2: always, x: pause on blit enqueue number x and ask for user confirmation before and after execution, counted from 0. Note that single blit enqueue may have multiple copy instructions")
 DECLARE_DEBUG_VARIABLE(int32_t, PauseOnGpuMode, -1, "-1: default (before and after), 0: before only, 1: after only")
@@ -84,6 +94,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, ForceCacheFlushForBcs, -1, "Force cache flush fr
 DECLARE_DEBUG_VARIABLE(int32_t, ForceGpgpuSubmissionForBcsEnqueue, -1, "-1: Default, 1: Submit gpgpu command buffer with cache flushing and completion synchronization, 0: Do nothing, if possible")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableUsmCompression, -1, "enable compression support for L0 USM Device and Shared Device side: -1 default, 0: disable, 1: enable")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableHostUsmSupport, -1, "-1: default, 0: disable, 1: enable, Enables USM host memory")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableDeviceUsmAllocationPool, -1, "-1: default - allocations up to 64KB pooled when the memory manager prefers it (WDDM), 0: disabled, 1: enabled, Sub-allocates small USM device allocations from pooled 2MB chunks")
 DECLARE_DEBUG_VARIABLE(int32_t, MediaVfeStateMaxSubSlices, -1, ">=0: Programs Media Vfe State Maximum Number of Dual-Subslices to given value ")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableMockSourceLevelDebugger, 0, "Switches driver to mode with active debugger. Active modes: 1: opt-disabled, 2: opt-enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceBtpPrefetchMode, -1, "-1: default, 0: disable, 1: enable, Enables Btp prefetching")
@@ -99,6 +110,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, PrintDriverDiagnostics, -1, "prints driver diagn
 DECLARE_DEBUG_VARIABLE(bool, PrintDeviceAndEngineIdOnSubmission, false, "print submissions device and engine IDs to standard output")
 DECLARE_DEBUG_VARIABLE(bool, PrintExecutionBuffer, false, "print execution buffer information to standard output")
 DECLARE_DEBUG_VARIABLE(bool, PrintBOsForSubmit, false, "print all BOs passed to submission")
+DECLARE_DEBUG_VARIABLE(bool, PrintStateReprogrammingCounters, false, "print number of flushTask calls that reprogrammed each hardware state, with state base address causes, when command stream receiver is destroyed")
 DECLARE_DEBUG_VARIABLE(bool, PrintDebugSettings, false, "Dump all debug variables settings to text file. Print to stdout if value is different than default.")
 DECLARE_DEBUG_VARIABLE(bool, PrintDebugMessages, false, "when enabled, some debug messages will be propagated to console")
 DECLARE_DEBUG_VARIABLE(bool, DumpKernels, false, "Enables dumping kernels' program source code to text files and program from binary to bin file")
@@ -125,6 +137,9 @@ DECLARE_DEBUG_VARIABLE(bool, PrintBOBindingResult, false, "tracks the result of
 DECLARE_DEBUG_VARIABLE(bool, PrintTagAllocationAddress, false, "Print tag allocation address for each engine")
 DECLARE_DEBUG_VARIABLE(bool, ProvideVerboseImplicitFlush, false, "provides verbose messages about implicit flush mechanism")
 DECLARE_DEBUG_VARIABLE(bool, PrintBlitDispatchDetails, false, "Print blit dispatch details")
+DECLARE_DEBUG_VARIABLE(bool, PrintCompilerCacheStatistics, false, "Print compiler cache hit and miss counters on every cache lookup")
+DECLARE_DEBUG_VARIABLE(std::string, TraceEventsFile, std::string("unk"), "When different value than \"unk\", writes API call, flushTask, exec, wait, allocation, compile, binary decode, ISA upload, link and contended lock wait durations to this file in Chrome trace JSON format")
+DECLARE_DEBUG_VARIABLE(std::string, TopologyCacheDir, std::string("unk"), "Linux only. When different value than \"unk\", device topology query results are cached in this directory, keyed on device id, revision, pci bus id, kernel release and i915 version")
 
 /*PERFORMANCE FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, DisableZeroCopyForBuffers, false, "When active all buffer allocations will not share memory with CPU.")
@@ -146,6 +161,12 @@ DECLARE_DEBUG_VARIABLE(int32_t, MinHwThreadsUnoccupied, 0, "If not zero then max
 DECLARE_DEBUG_VARIABLE(int32_t, PerformImplicitFlushEveryEnqueueCount, -1, "If greater than 0, driver performs implicit flush every N submissions.")
 DECLARE_DEBUG_VARIABLE(int32_t, PerformImplicitFlushForNewResource, -1, "-1: platform specific, 0: force disable, 1: force enable")
 DECLARE_DEBUG_VARIABLE(int32_t, PerformImplicitFlushForIdleGpu, -1, "-1: platform specific, 0: force disable, 1: force enable")
+DECLARE_DEBUG_VARIABLE(int32_t, BatchedDispatchMaxSubmissions, -1, "-1: default (32), >0: number of submissions batched in BatchedDispatchWithCounter dispatch mode before implicit flush")
+DECLARE_DEBUG_VARIABLE(int32_t, BatchedDispatchMaxBatchSize, -1, "-1: default (256KB), >0: size in bytes of command buffers batched in BatchedDispatchWithCounter dispatch mode before implicit flush")
+DECLARE_DEBUG_VARIABLE(int32_t, ParallelKernelProcessingWorkers, -1, "-1: default, driver decides based on kernels count, >0: number of threads used to create kernel allocations of a program or module")
+DECLARE_DEBUG_VARIABLE(int32_t, ParallelRootDeviceInitialization, -1, "-1: default (enabled), 0: disabled, 1: enabled. OS interfaces of discovered root devices are initialized concurrently, one thread per root device")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuCopyLargeTransferThreshold, -1, "-1: default (4MB), >=0: size in bytes from which CPU copies of buffer reads and writes are split between threads and use streaming stores")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuCopyWorkers, -1, "-1: default, driver decides based on copy size, >0: number of threads used for large CPU copies of buffer reads and writes")
 
 /*DIRECT SUBMISSION FLAGS*/
 DECLARE_DEBUG_VARIABLE(int32_t, EnableDirectSubmission, -1, "-1: default (disabled), 0: disable, 1:enable. Enables direct submission of command buffers bypassing KMD")
@@ -154,6 +175,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionSemaphorePlacement, -1, "-1: do
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionBufferAddressing, -1, "-1: do not override, 0: not use 48bit, 1: use 48bit")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionSemaphoreAddressing, -1, "-1: do not override, 0: not use 48bit, 1: use 48bit")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionDisableCpuCacheFlush, -1, "-1: do not override, 0: disable, 1: enable")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionCpuCachelineFlushMode, -1, "-1: default (best supported), 0: clflush, 1: clflushopt, 2: clwb. Instruction used to flush ring buffer and semaphore lines, falls back to the next supported one")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionEnableDebugBuffer, 0, "0: diagnostic feature disabled - dispatch regular workload, 1: dispatch diagnostic buffer - mode 1 - single SDI command, 2: dispatch diagnostic buffer - mode 2 - no command")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionDiagnosticExecutionCount, 30, "Number of executions of EnableDebugBuffer modes within diagnostic run")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionOverrideBlitterSupport, -1, "Overrides default blitter support: -1: do not override, 0: disable engine support, 1: enable engine support with init start, 2: enable engine support without init start")
@@ -161,19 +183,60 @@ DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionOverrideRenderSupport, -1, "Over
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionOverrideComputeSupport, -1, "Overrides default compute support: -1: do not override, 0: disable engine support, 1: enable engine support with init start, 2: enable engine support without init start")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionDisableCacheFlush, -1, "-1: driver default, 0: additional cache flush is present 1: disable dispatching cache flush commands")
 DECLARE_DEBUG_VARIABLE(bool, USMEvictAfterMigration, true, "Evict USM allocation after implicit migration to GPU")
+DECLARE_DEBUG_VARIABLE(int32_t, UsmMigrationBlockSize, -1, "Granularity in bytes of implicit shared USM migration, aligned to page size. -1: default (2MB), 0: whole allocation")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableUserFaultFdPageFaults, -1, "Linux only. -1: default (disabled), 0: disabled, 1: CPU writes to read only copies of shared USM are handled with userfaultfd on a dedicated thread instead of SIGSEGV, when supported by the kernel")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableCopyEngineForPageFaultTransfers, -1, "-1: default (disabled), 0: disabled, 1: shared USM CPU<->GPU domain transfers use a dedicated internal copy engine context, when the blitter is available")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableDynamicQueueSliceCount, -1, "-1: default (disabled), 0: disabled, 1: OCL enqueues on queues without explicit slice count request a single slice when their thread groups fit on one slice and all slices otherwise")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableHighPriorityEngine, -1, "-1: default (disabled), 0: disabled, 1: create a high priority context on the default engine, used by high priority queues in OCL and L0")
 DECLARE_DEBUG_VARIABLE(bool, DirectSubmissionDisableMonitorFence, false, "Disable dispatching monitor fence commands")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionMaxRingBuffers, -1, "-1: default (8), >=2: maximal number of ring buffers allocated on demand when all ring buffers are still in use by GPU")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionWaitSpinCount, -1, "-1: default (128), >=0: number of tight polling iterations before pausing when waiting for ring buffer completion")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionWaitPauseCount, -1, "-1: default (4096), >=0: number of polling iterations with pause before yielding CPU when waiting for ring buffer completion")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionWaitUseUmwait, -1, "-1: default (disabled), 0: disabled, 1: enabled when CPU supports it. Use umonitor/umwait instead of pause when waiting for ring buffer completion")
+DECLARE_DEBUG_VARIABLE(int32_t, SubmissionCoalescingWindowUs, -1, "-1: default (disabled), >0: time window in microseconds within which command queue submissions to the same engine are chained into a single submission")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableFlushTaskSubmission, -1, "Submit immediate command lists directly through the command stream receiver instead of the command queue, -1: default - enabled when direct submission is active, 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, CsrOwnershipSpinCount, -1, "-1: default (64), >=0: number of try-lock attempts with cpu pause before blocking on command stream receiver ownership")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableCommandQueueLoadBalancing, -1, "-1: default (disabled), 0: disabled, 1: command queues created on an engine group with several engines submit each executeCommandLists call to the least loaded engine of the group")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableQueryKernelTimestampsWithStores, -1, "-1: default (enabled), 0: disabled, 1: enabled. zeCommandListAppendQueryKernelTimestamps copies single packet events with MI_LOAD_REGISTER_MEM and MI_STORE_REGISTER_MEM instead of launching a builtin kernel")
+DECLARE_DEBUG_VARIABLE(int32_t, EventHostWaitSpinTimeUs, -1, "-1: default (spin until signaled), >=0: time in microseconds event host waits without timeout poll before sleeping in the kernel until the engine completes its last submission")
+DECLARE_DEBUG_VARIABLE(int32_t, DeferOsContextInitialization, -1, "-1: default (enabled), 0: disabled, 1: enabled. OS contexts and direct submission of non-default engines are created on first use of the engine instead of at device creation")
+DECLARE_DEBUG_VARIABLE(int32_t, DeferSipKernelInitialization, -1, "-1: default (enabled unless debugging), 0: disabled, 1: enabled. SIP kernel is loaded on first submission using mid thread preemption instead of at device creation")
+DECLARE_DEBUG_VARIABLE(bool, FastProcessTeardown, false, "At process exit, wait for engines to idle and stop direct submission, then leave freeing of allocations and contexts to the kernel")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuAddressRangeReservationSizeInGb, -1, "-1: default, >0: size in GB of the CPU address range reserved for GPU heaps on 47-bit platforms, for processes with small memory footprint. Raised to at least 28")
 
 /*FEATURE FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, EnableNV12, true, "Enables NV12 extension")
 DECLARE_DEBUG_VARIABLE(bool, EnablePackedYuv, true, "Enables cl_packed_yuv extension")
 DECLARE_DEBUG_VARIABLE(bool, EnableDeferredDeleter, true, "Enables async deleter")
+DECLARE_DEBUG_VARIABLE(int32_t, DeferredDeleterWorkersCount, -1, "-1: default (1), >1: number of threads of the async deleter releasing deferred allocations")
+DECLARE_DEBUG_VARIABLE(int32_t, DeferredDeleterHighPriorityAllocationSize, -1, "-1: default (2MB), >=0: deferred deletions of allocations of at least this size in bytes are processed before other deletions")
 DECLARE_DEBUG_VARIABLE(bool, EnableAsyncDestroyAllocations, true, "Enables async destroying graphics allocations in mem obj destructor")
 DECLARE_DEBUG_VARIABLE(bool, EnableAsyncEventsHandler, true, "Enables async events handler")
 DECLARE_DEBUG_VARIABLE(bool, EnableForcePin, true, "Enables early pinning for memory object")
 DECLARE_DEBUG_VARIABLE(bool, EnableComputeWorkSizeND, true, "Enables different algorithm to compute local work size")
 DECLARE_DEBUG_VARIABLE(bool, EnableMultiRootDeviceContexts, false, "Enables support for multi root device contexts")
+DECLARE_DEBUG_VARIABLE(bool, EnableLazyMultiRootDeviceBacking, false, "Allocates buffers of multi root device contexts only on the first device, other root devices get backing on first use")
+DECLARE_DEBUG_VARIABLE(bool, EnableP2PMemoryMigration, false, "Migrates multi root device allocations with a blitter copy from a dma-buf peer import instead of a copy through host memory")
+DECLARE_DEBUG_VARIABLE(bool, EnableAsyncPrintfOutput, false, "Enqueues of kernels using printf stay non-blocking, the output is printed in enqueue order by later enqueues on the queue that see the kernel completed, by clFinish or on queue release")
 DECLARE_DEBUG_VARIABLE(bool, EnableComputeWorkSizeSquared, false, "Enables algorithm to compute the most squared work group as possible")
 DECLARE_DEBUG_VARIABLE(bool, EnableExtendedVaFormats, false, "Enable more formats in cl-va sharing")
+DECLARE_DEBUG_VARIABLE(bool, EnableVaSurfaceExportCache, false, "Caches dma-buf exports of VA surfaces per context, so sharing the same VASurfaceID again skips vaExportSurfaceHandle. Surface IDs must not be recycled while the context exists")
+DECLARE_DEBUG_VARIABLE(bool, EnableGlReleaseFenceSync, false, "clEnqueueReleaseGLObjects on in-order queues with a returned event only flushes, GL synchronizes on the ARB sync object of the release event")
+DECLARE_DEBUG_VARIABLE(bool, EnableIpcImportCache, false, "Level Zero IPC opens of an already imported buffer return the cached pointer, zeMemCloseIpcHandle keeps the import until zeMemFree")
+DECLARE_DEBUG_VARIABLE(int32_t, ReuseBindingTablesOfRepeatedDispatches, -1, "-1: default (enabled), 0: disabled, 1: enabled. Command list dispatches with the same surface states as the previous dispatch reuse its binding table instead of consuming new SSH space")
+DECLARE_DEBUG_VARIABLE(int32_t, ReuseIndirectDataOfRepeatedDispatches, -1, "-1: default (enabled), 0: disabled, 1: enabled. Command list dispatches with the same cross thread and per thread data as the previous dispatch point to its indirect data instead of copying it to the IOH again")
+DECLARE_DEBUG_VARIABLE(int32_t, ReuseSamplerStatesOfRepeatedDispatches, -1, "-1: default (enabled), 0: disabled, 1: enabled. Bindful command list dispatches binding the same samplers as an earlier dispatch point to its sampler states instead of copying them to the DSH again")
+DECLARE_DEBUG_VARIABLE(int32_t, ElideRedundantPipeControls, -1, "-1: default (enabled), 0: disabled, 1: enabled. Barriers and wait flushes recorded right after a CS stalling PIPE_CONTROL of a regular command list are not programmed again, 0 allows comparing results with the full command stream")
+DECLARE_DEBUG_VARIABLE(int32_t, SizeScratchForBuiltKernels, -1, "-1: default (enabled), 0: disabled, 1: enabled. Once scratch is required on an engine, it is sized for the largest per thread scratch of all kernels in loaded modules of the device")
+DECLARE_DEBUG_VARIABLE(int32_t, ShareTagPollingBetweenWaiters, -1, "-1: default (enabled), 0: disabled, 1: enabled. Only one thread polls the completion tag of a command stream receiver, other waiting threads sleep until it observes a tag update")
+DECLARE_DEBUG_VARIABLE(int32_t, AdaptiveKmdNotifyDelay, -1, "-1: default (disabled), 0: disabled, 1: enabled. KMD notify polls for twice the moving average of recent waits of the command stream receiver, bounded by the quick sleep and the standard delay")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableWddmSubmissionWorker, -1, "-1: default (disabled), 0: disabled, 1: enabled. Command buffers are submitted to the kernel mode driver from a worker thread of the command stream receiver, flush returns once the fence value is reserved")
+DECLARE_DEBUG_VARIABLE(int32_t, BatchAuxTableUpdates, -1, "-1: default (disabled), 0: disabled, 1: enabled. Aux table maps of compressed allocations are accumulated and applied before the next submission instead of at allocation creation")
+DECLARE_DEBUG_VARIABLE(int32_t, WddmWaitFromCpuSpinTime, -1, "-1: default (50), 0: disabled, >0: maximal time in microseconds a monitored fence is polled before waiting in the kernel mode driver, the polling window adapts to recent waits")
+DECLARE_DEBUG_VARIABLE(int32_t, PrintKernelLaunchOverhead, -1, "-1: default, >0: aggregates host time of argument patching, encoding, residency, flush and exec ioctl per kernel name and prints this many kernels with the highest host overhead at exit")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableGmmResourceInfoCache, -1, "-1: default, 0: disabled, 1: enabled, reuses resource layouts computed by GmmLib when a resource with identical create params is created again")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableBufferAllocationRecycling, -1, "-1: default (disabled), 0: disabled, 1: enabled, allocations of released OpenCL buffers are kept in the context and reused by buffers created with the same size and flags")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableDirectMappingForLocalMemoryBuffers, -1, "-1: default (buffers up to 64KB), 0: disabled, 1: enabled for all sizes, maps local memory buffers through their locked CPU mapping instead of copying through a host staging allocation")
 DECLARE_DEBUG_VARIABLE(bool, AddClGlSharing, false, "Add cl-gl extension")
 DECLARE_DEBUG_VARIABLE(bool, EnableFormatQuery, false, "Enable sharing format querying")
 DECLARE_DEBUG_VARIABLE(bool, EnableFreeMemory, false, "Enable freeMemory in memory manager")
@@ -181,11 +244,20 @@ DECLARE_DEBUG_VARIABLE(bool, ForceSamplerLowFilteringPrecision, false, "Force Lo
 DECLARE_DEBUG_VARIABLE(int32_t, EnableKernelTunning, -1, "Perform a tunning of enqueue kernel, -1:default(disabled), 0:disable, 1:enable simple kernel tunning, 2:enable full kernel tunning")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableBOMmapCreate, -1, "Create BOs using mmap, -1:default, 0:disable(GEM_USERPTR), 1:enable")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableGemCloseWorker, -1, "Use asynchronous gem object closing, -1:default, 0:disable, 1:enable")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableGemCloseWorkerAllocationFree, -1, "Release freed allocations in batches on gem close worker thread, -1:default - disabled, 0:disable, 1:enable")
+DECLARE_DEBUG_VARIABLE(int32_t, UserptrCacheSize, -1, "Number of released host pointer userptr BOs kept for reuse, -1:default - disabled, >0: cache capacity")
+DECLARE_DEBUG_VARIABLE(int64_t, HugePageAllocationThreshold, -1, "Minimal size in bytes of system memory allocation backed by 2MB pages, -1:default - disabled, >=0: threshold")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableHostMemoryNumaBinding, -1, "Bind host side allocations to NUMA node closest to device, -1:default - disabled, 0:disable, 1:enable")
+DECLARE_DEBUG_VARIABLE(int32_t, ForceNumaNode, -1, "-1: default - NUMA node reported for device, >=0: NUMA node used for host memory binding")
+DECLARE_DEBUG_VARIABLE(int64_t, NumaBindingAllocationTypeMask, 0, "0: default - host USM, tag, command and timestamp buffers, >0: (bitmask) for given Graphics Allocation Type, bind to NUMA node")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableLocalMemoryOversubscription, -1, "Evict cold allocations and fall back to system memory when local memory is exhausted, -1:default - disabled, 0:disable, 1:enable")
+DECLARE_DEBUG_VARIABLE(int32_t, DumpMemoryUsageStatisticsOnSignal, -1, "Signal number which triggers dumping per allocation type memory usage to stdout on the next allocation, -1: disabled")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableIntelVme, -1, "-1: default, 0: disabled, 1: Enables cl_intel_motion_estimation extension")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableIntelAdvancedVme, -1, "-1: default, 0: disabled, 1: Enables cl_intel_advanced_motion_estimation extension")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableBlitterOperationsSupport, -1, "-1: default, 0: disable, 1: enable")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableBlitterForEnqueueOperations, -1, "Use Blitter engine for enqueue operations. -1: default, 0: disabled, 1: enabled")
-DECLARE_DEBUG_VARIABLE(int32_t, EnableBlitterForReadWriteImage, -1, "Use Blitter engine for read/write image operations. -1: default, 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableBlitterForReadWriteImage, -1, "Use Blitter engine for read/write/copy image and image<->buffer copy operations. -1: default, 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableCpuDetilingForImageMap, -1, "Map and unmap small tiled 2D images on integrated devices by (de)tiling on CPU instead of GPU copies. -1: default (disabled), 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableCacheFlushAfterWalker, -1, "-1: platform behavior, 0: disabled, 1: enabled. Adds dedicated cache flush command after WALKER command when surfaces used by kernel require to flush the cache")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableLocalMemory, -1, "-1: default behavior, 0: disabled, 1: enabled, Allows allocating graphics memory in Local Memory")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableStatelessToStatefulBufferOffsetOpt, -1, "-1: dont override, 0: disable, 1: enable, Enables buffer-offset improvement of the stateless to stateful optimization")
@@ -204,8 +276,16 @@ DECLARE_DEBUG_VARIABLE(int32_t, PowerSavingMode, 0, "0: default 1: enable. Whene
 DECLARE_DEBUG_VARIABLE(int32_t, CsrDispatchMode, 0, "Chooses DispatchMode for Csr")
 DECLARE_DEBUG_VARIABLE(int32_t, RenderCompressedImagesEnabled, -1, "-1: default, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, RenderCompressedBuffersEnabled, -1, "-1: default, 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, AdaptiveBufferCompression, -1, "-1: default (enabled), 0: disabled, 1: enabled. Compress new buffers only when buffers released earlier in the context were mostly accessed statefully")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableSharedSystemUsmSupport, -1, "-1: default, 0: shared system memory disabled, 1: shared system memory enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, SharedSystemUsmBindGranularity, -1, "Size in bytes of the host range bound for GPU access around a shared system pointer used as a kernel argument, aligned to page size. -1: default (64KB)")
 DECLARE_DEBUG_VARIABLE(int32_t, EnablePassInlineData, -1, "-1: default, 0: Do not allow to pass inline data 1: Enable passing of inline data")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableLazyKernelIsaUpload, -1, "-1: default (disabled), 0: disabled, 1: enabled, defers creation of kernel ISA allocation in a module until the first kernel create with given name")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableSharedModuleIsaAllocation, -1, "-1: default (disabled), 0: disabled, 1: enabled, places ISA of all kernels in a module in shared allocations instead of one allocation per kernel")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableAutoLargeGrfSelection, -1, "-1: default (disabled), 0: disabled, 1: enabled, rebuilds SPIR-V modules that spill with 256 GRF and keeps the build that spills less")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableBufferSurfaceStateCache, -1, "-1: default (disabled), 0: disabled, 1: enabled, reuses surface states encoded for a buffer kernel argument with the same parameters, overwriting the whole destination surface state")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableProgramInfoCache, -1, "-1: default (disabled), 0: disabled, 1: enabled, stores decoded kernel descriptors in compiler cache next to device binary and restores them instead of decoding the binary")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableAsyncProgramBuild, -1, "-1: default (disabled), 0: disabled, 1: enabled, clBuildProgram with notify callback returns immediately and builds program on background compiler thread")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceFineGrainedSVMSupport, -1, "-1: default, 0: Do not report Fine Grained SVM capabilties 1: Report SVM Fine Grained capabilities if device supports SVM")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceDeviceEnqueueSupport, -1, "-1: default, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, ForcePipeSupport, -1, "-1: default, 0: disabled, 1: enabled")
@@ -228,6 +308,18 @@ DECLARE_DEBUG_VARIABLE(int32_t, ForceSemaphoreDelayBetweenWaits, -1, "Specifies
 DECLARE_DEBUG_VARIABLE(int32_t, ForceLocalMemoryAccessMode, -1, "-1: don't override, 0: default rules apply, 1: CPU can access local memory, 3: CPU never accesses local memory")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceUserptrAlignment, -1, "-1: no force (4kb), >0: n kb alignment")
 DECLARE_DEBUG_VARIABLE(int32_t, PreferCopyEngineForCopyBufferToBuffer, -1, "-1: default, 0: prefer EUs, 1: prefer blitter")
+DECLARE_DEBUG_VARIABLE(int32_t, PreferCopyEngineForFillBuffer, -1, "-1: default, 0: prefer EUs, 1: prefer blitter")
+DECLARE_DEBUG_VARIABLE(int32_t, SplitCopyBufferBlitterPercentage, -1, "-1: default (disabled), 1-99: percentage of large clEnqueueCopyBuffer transfers done by the blitter, the rest is copied concurrently by EUs")
+DECLARE_DEBUG_VARIABLE(int64_t, SplitCopyBufferMinSize, -1, "-1: default (64MB), >0: minimal size in bytes of clEnqueueCopyBuffer transfers split between blitter and EUs")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableStagingWriteBuffer, -1, "-1: default (disabled), 0: disable, 1: enable copying large clEnqueueWriteBuffer sources from pageable memory through a ring of pinned staging buffers")
+DECLARE_DEBUG_VARIABLE(int64_t, StagingWriteBufferChunkSize, -1, "-1: default (2MB), >0: size in bytes of each staging buffer used by clEnqueueWriteBuffer")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableDispatchTemplateCache, -1, "-1: default (enabled), 0: disable, 1: enable reusing walker and local ids of the previous dispatch of a kernel with the same work sizes")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableKernelArgSurfaceStateCache, -1, "-1: default (enabled), 0: disable, 1: enable skipping surface state programming when the same buffer is set again as a kernel argument")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableLocalWorkSizeCache, -1, "-1: default (enabled), 0: disable, 1: enable reusing local work size deduced for previous enqueue of the same kernel with the same global work size")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableEventRecycling, -1, "-1: default (enabled), 0: disable, 1: enable reusing memory of released events for events created later on the same context")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableLocalIdsCache, -1, "-1: default (enabled), 0: disable, 1: enable reusing local ids generated for recently dispatched work group shapes")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableBuiltinsCompilerCache, -1, "-1: default (disabled), 0: disable, 1: enable loading built-in kernels compiled at first use from compiler cache directory and storing them there")
+DECLARE_DEBUG_VARIABLE(int32_t, OverrideBuiltinCopyFillBlockSize, -1, "-1: default, >=0: bytes moved by each work item of cache line aligned builtin buffer copies and fills, values below 64 use 16 byte (copy) and 4 byte (fill) kernels")
 DECLARE_DEBUG_VARIABLE(int64_t, ForceSystemMemoryPlacement, 0, "0: default,  >0: (bitmask) for given Graphics Allocation Type, force system memory placement")
 DECLARE_DEBUG_VARIABLE(int64_t, ForceNonSystemMemoryPlacement, 0, "0: default,  >0: (bitmask) for given Graphics Allocation Type, force non-system memory placement")
 DECLARE_DEBUG_VARIABLE(int64_t, DisableIndirectAccess, -1, "0: default,  0: Use indirect access settings provided by application, 1: Disable indirect access and ignore settings provided by application")
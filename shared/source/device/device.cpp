@@ -20,6 +20,7 @@
 #include "shared/source/os_interface/os_time.h"
 #include "shared/source/source_level_debugger/source_level_debugger.h"
 #include "shared/source/utilities/software_tags_manager.h"
+#include "shared/source/utilities/trace_events.h"
 
 namespace NEO {
 
@@ -71,6 +72,9 @@ bool Device::createDeviceImpl() {
     for (auto &engine : engines) {
         auto commandStreamReceiver = engine.commandStreamReceiver;
         auto osContext = engine.osContext;
+        if (osContext->isEngineInitializationPending()) {
+            continue;
+        }
         if (!commandStreamReceiver->initDirectSubmission(*this, *osContext)) {
             return false;
         }
@@ -101,6 +105,12 @@ bool Device::createDeviceImpl() {
         }
     }
 
+    if (DebugManager.flags.GpuTimelineSamplingPeriod.get() > 0) {
+        for (auto &engine : engines) {
+            engine.commandStreamReceiver->setGpuTimelineSamplingPeriod(*this, static_cast<uint32_t>(DebugManager.flags.GpuTimelineSamplingPeriod.get()));
+        }
+    }
+
     if (DebugManager.flags.EnableSWTags.get() && !getRootDeviceEnvironment().tagsManager->isInitialized()) {
         getRootDeviceEnvironment().tagsManager->initialize(*this);
     }
@@ -109,6 +119,7 @@ bool Device::createDeviceImpl() {
 }
 
 bool Device::createEngines() {
+    ScopedTraceEvent traceEvent("engineCreation", TraceEvents::Category::initialization);
     auto &hwInfo = getHardwareInfo();
     auto gpgpuEngines = HwHelper::get(hwInfo.platform.eRenderCoreFamily).getGpgpuEngineInstances(hwInfo);
 
@@ -152,6 +163,7 @@ bool Device::createEngine(uint32_t deviceCsrIndex, EngineTypeUsage engineTypeUsa
     }
 
     auto engineType = engineTypeUsage.first;
+    bool isDefaultEngine = (engineType == defaultEngineType && engineTypeUsage.second == EngineUsage::Regular);
 
     bool internalUsage = (engineTypeUsage.second == EngineUsage::Internal);
     if (internalUsage) {
@@ -163,6 +175,7 @@ bool Device::createEngine(uint32_t deviceCsrIndex, EngineTypeUsage engineTypeUsa
     }
 
     bool lowPriority = (engineTypeUsage.second == EngineUsage::LowPriority);
+    bool highPriority = (engineTypeUsage.second == EngineUsage::HighPriority);
     auto osContext = executionEnvironment->memoryManager->createAndRegisterOsContext(commandStreamReceiver.get(),
                                                                                      engineTypeUsage,
                                                                                      getDeviceBitfield(),
@@ -170,6 +183,12 @@ bool Device::createEngine(uint32_t deviceCsrIndex, EngineTypeUsage engineTypeUsa
                                                                                      false);
     commandStreamReceiver->setupContext(*osContext);
 
+    if (osContext->isImmediateContextInitializationEnabled(isDefaultEngine)) {
+        osContext->ensureContextInitialized();
+    } else {
+        osContext->setEngineInitializationPending(true);
+    }
+
     if (!commandStreamReceiver->initializeTagAllocation()) {
         return false;
     }
@@ -178,17 +197,21 @@ bool Device::createEngine(uint32_t deviceCsrIndex, EngineTypeUsage engineTypeUsa
         return false;
     }
 
-    if (engineType == defaultEngineType && !lowPriority && !internalUsage) {
+    if (!commandStreamReceiver->preallocateCommandBuffers()) {
+        return false;
+    }
+
+    if (isDefaultEngine) {
         defaultEngineIndex = deviceCsrIndex;
     }
 
-    if (preemptionMode == PreemptionMode::MidThread && !commandStreamReceiver->createPreemptionAllocation()) {
+    if (preemptionMode == PreemptionMode::MidThread && osContext->isContextInitialized() && !commandStreamReceiver->createPreemptionAllocation()) {
         return false;
     }
 
     EngineControl engine{commandStreamReceiver.get(), osContext};
     engines.push_back(engine);
-    if (!lowPriority && !internalUsage) {
+    if (!lowPriority && !highPriority && !internalUsage) {
         addEngineToEngineGroup(engine);
     }
 
@@ -269,15 +292,28 @@ size_t Device::getIndexOfNonEmptyEngineGroup(EngineGroupType engineGroupType) co
     return result;
 }
 
-EngineControl &Device::getEngine(aub_stream::EngineType engineType, EngineUsage engineUsage) {
+EngineControl *Device::tryGetEngine(aub_stream::EngineType engineType, EngineUsage engineUsage) {
     for (auto &engine : engines) {
         if (engine.osContext->getEngineType() == engineType &&
             engine.osContext->isLowPriority() == (engineUsage == EngineUsage::LowPriority) &&
+            engine.osContext->isHighPriority() == (engineUsage == EngineUsage::HighPriority) &&
             engine.osContext->isInternalEngine() == (engineUsage == EngineUsage::Internal)) {
-            return engine;
+            if (!ensureEngineInitialized(engine)) {
+                return nullptr;
+            }
+            return &engine;
         }
     }
+    return nullptr;
+}
+
+EngineControl &Device::getEngine(aub_stream::EngineType engineType, EngineUsage engineUsage) {
+    auto engine = tryGetEngine(engineType, engineUsage);
+    if (engine) {
+        return *engine;
+    }
     if (DebugManager.flags.OverrideInvalidEngineWithDefault.get()) {
+        UNRECOVERABLE_IF(!ensureEngineInitialized(engines[0]));
         return engines[0];
     }
     UNRECOVERABLE_IF(true);
@@ -285,9 +321,66 @@ EngineControl &Device::getEngine(aub_stream::EngineType engineType, EngineUsage
 
 EngineControl &Device::getEngine(uint32_t index) {
     UNRECOVERABLE_IF(index >= engines.size());
+    UNRECOVERABLE_IF(!ensureEngineInitialized(engines[index]));
     return engines[index];
 }
 
+bool Device::ensureEngineInitialized(const EngineControl &engine) {
+    std::lock_guard<std::mutex> lock(engineInitializationMutex);
+    // the OS context may already exist when a fallback path created it, direct submission still has to start
+    if (!engine.osContext->isEngineInitializationPending()) {
+        return true;
+    }
+    engine.osContext->ensureContextInitialized();
+    if (preemptionMode == PreemptionMode::MidThread && engine.commandStreamReceiver->getPreemptionAllocation() == nullptr &&
+        !engine.commandStreamReceiver->createPreemptionAllocation()) {
+        return false;
+    }
+    if (!engine.commandStreamReceiver->initDirectSubmission(*this, *engine.osContext)) {
+        return false;
+    }
+    engine.osContext->setEngineInitializationPending(false);
+    return true;
+}
+
+void Device::registerKernelPerThreadScratchSize(uint32_t perThreadScratchSize) {
+    if (perThreadScratchSize == 0) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(kernelPerThreadScratchSizesMutex);
+    kernelPerThreadScratchSizes.insert(perThreadScratchSize);
+}
+
+void Device::unregisterKernelPerThreadScratchSize(uint32_t perThreadScratchSize) {
+    std::lock_guard<std::mutex> lock(kernelPerThreadScratchSizesMutex);
+    auto registeredSize = kernelPerThreadScratchSizes.find(perThreadScratchSize);
+    if (registeredSize != kernelPerThreadScratchSizes.end()) {
+        kernelPerThreadScratchSizes.erase(registeredSize);
+    }
+}
+
+uint32_t Device::getMaxKernelPerThreadScratchSize() {
+    std::lock_guard<std::mutex> lock(kernelPerThreadScratchSizesMutex);
+    return kernelPerThreadScratchSizes.empty() ? 0u : *kernelPerThreadScratchSizes.rbegin();
+}
+
+void Device::prepareForFastTeardown() {
+    for (auto &engine : engines) {
+        if (!engine.osContext->isContextInitialized()) {
+            continue;
+        }
+        auto commandStreamReceiver = engine.commandStreamReceiver;
+        commandStreamReceiver->flushBatchedSubmissions();
+        commandStreamReceiver->waitForCompletionWithTimeout(false, 0, commandStreamReceiver->peekLatestFlushedTaskCount());
+        commandStreamReceiver->stopDirectSubmission();
+    }
+    if (getNumAvailableDevices() > 1) {
+        for (uint32_t i = 0; i < getNumAvailableDevices(); i++) {
+            getDeviceById(i)->prepareForFastTeardown();
+        }
+    }
+}
+
 bool Device::getDeviceAndHostTimer(uint64_t *deviceTimestamp, uint64_t *hostTimestamp) const {
     TimeStampData queueTimeStamp;
     bool retVal = getOSTime()->getCpuGpuTime(&queueTimeStamp);
@@ -20,6 +20,9 @@
 
 #include "engine_group_types.h"
 
+#include <mutex>
+#include <set>
+
 namespace NEO {
 class OSTime;
 class SourceLevelDebugger;
@@ -48,6 +51,7 @@ class Device : public ReferenceTrackedObject<Device> {
     const HardwareInfo &getHardwareInfo() const;
     const DeviceInfo &getDeviceInfo() const;
     EngineControl &getEngine(aub_stream::EngineType engineType, EngineUsage engineUsage);
+    EngineControl *tryGetEngine(aub_stream::EngineType engineType, EngineUsage engineUsage);
     std::vector<std::vector<EngineControl>> &getEngineGroups() {
         return this->engineGroups;
     }
@@ -56,7 +60,14 @@ class Device : public ReferenceTrackedObject<Device> {
     EngineControl &getEngine(uint32_t index);
     EngineControl &getDefaultEngine();
     EngineControl &getInternalEngine();
+    EngineControl *getInternalCopyEngine();
+    bool ensureEngineInitialized(const EngineControl &engine);
+    void prepareForFastTeardown();
     std::atomic<uint32_t> &getSelectorCopyEngine();
+    // slot 0 per thread scratch sizes of kernels in loaded modules, private scratch is not tracked
+    void registerKernelPerThreadScratchSize(uint32_t perThreadScratchSize);
+    void unregisterKernelPerThreadScratchSize(uint32_t perThreadScratchSize);
+    uint32_t getMaxKernelPerThreadScratchSize();
     MemoryManager *getMemoryManager() const;
     GmmHelper *getGmmHelper() const;
     GmmClientContext *getGmmClientContext() const;
@@ -136,6 +147,9 @@ class Device : public ReferenceTrackedObject<Device> {
     ExecutionEnvironment *executionEnvironment = nullptr;
     uint32_t defaultEngineIndex = 0;
     std::atomic<uint32_t> selectorCopyEngine{0};
+    std::multiset<uint32_t> kernelPerThreadScratchSizes;
+    std::mutex kernelPerThreadScratchSizesMutex;
+    std::mutex engineInitializationMutex;
 
     uintptr_t specializedDevice = reinterpret_cast<uintptr_t>(nullptr);
 };
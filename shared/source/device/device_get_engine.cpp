@@ -20,4 +20,16 @@ EngineControl &Device::getInternalEngine() {
 
     return this->getDeviceById(0)->getEngine(engineType, EngineUsage::Internal);
 }
+
+EngineControl *Device::getInternalCopyEngine() {
+    for (auto &engine : engines) {
+        if (engine.osContext->getEngineType() == aub_stream::ENGINE_BCS && engine.osContext->isInternalEngine()) {
+            if (!ensureEngineInitialized(engine)) {
+                return nullptr;
+            }
+            return &engine;
+        }
+    }
+    return nullptr;
+}
 } // namespace NEO
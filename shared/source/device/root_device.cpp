@@ -131,6 +131,7 @@ void RootDevice::initializeRootCommandStreamReceiver() {
                                                                     true);
 
     rootCommandStreamReceiver->setupContext(*osContext);
+    osContext->ensureContextInitialized();
     rootCommandStreamReceiver->initializeTagAllocation();
     rootCommandStreamReceiver->createGlobalFenceAllocation();
     rootCommandStreamReceiver->createWorkPartitionAllocation(*this);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,9 @@
 
 #include "shared/source/device_binary_format/yaml/yaml_parser.h"
 
+#include <algorithm>
+#include <cstring>
+
 namespace NEO {
 
 namespace Yaml {
@@ -112,14 +115,25 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
         return true;
     }
 
+    // std::count and memchr are vectorized by the toolchain, so sizing the caches up front
+    // and skipping comments this way is much cheaper than growing them token by token
+    auto linesCountEstimate = static_cast<size_t>(std::count(text.begin(), text.end(), '\n')) + 1;
+    outLines.reserve(outLines.size() + linesCountEstimate);
+    outTokens.reserve(outTokens.size() + linesCountEstimate * estimatedTokensPerLine);
+
     TokenizerContext context{text};
     context.isParsingIdent = true;
 
     while (context.pos < context.end) {
         switch (context.pos[0]) {
         case ' ':
-            context.lineIndent += context.isParsingIdent ? 1 : 0;
-            ++context.pos;
+            if (context.isParsingIdent) {
+                auto indentEnd = consumeSpaces(context.pos, context.end);
+                context.lineIndent += static_cast<uint32_t>(indentEnd - context.pos);
+                context.pos = indentEnd;
+            } else {
+                ++context.pos;
+            }
             break;
         case '\t':
             if (context.isParsingIdent) {
@@ -136,12 +150,8 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
             context.isParsingIdent = false;
             outTokens.push_back(Token(ConstStringRef(context.pos, 1), Token::SingleCharacter));
             auto commentIt = context.pos + 1;
-            while (commentIt < context.end) {
-                if ('\n' == commentIt[0]) {
-                    break;
-                }
-                ++commentIt;
-            }
+            auto commentEnd = reinterpret_cast<const char *>(memchr(commentIt, '\n', static_cast<size_t>(context.end - commentIt)));
+            commentIt = (nullptr != commentEnd) ? commentEnd : context.end;
             if (context.pos + 1 != commentIt) {
                 outTokens.push_back(Token(ConstStringRef(context.pos + 1, commentIt - (context.pos + 1)), Token::Comment));
             }
@@ -279,6 +289,7 @@ void finalizeNode(NodeId nodeId, const TokensCache &tokens, NodesCache &outNodes
 bool buildTree(const LinesCache &lines, const TokensCache &tokens, NodesCache &outNodes, std::string &outErrReason, std::string &outWarning) {
     StackVec<NodeId, 64> nesting;
     size_t lineId = 0U;
+    outNodes.reserve(lines.size() + 1);
     outNodes.resize(1);
     outNodes.rbegin()->id = 0U;
     outNodes.rbegin()->firstChildId = 1U;
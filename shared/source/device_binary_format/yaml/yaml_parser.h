@@ -111,6 +111,14 @@ constexpr const char *consumeNameIdentifier(ConstStringRef wholeText, const char
     return parsePos;
 }
 
+constexpr const char *consumeSpaces(const char *parsePos, const char *parseEnd) {
+    auto it = parsePos;
+    while ((it < parseEnd) && (' ' == *it)) {
+        ++it;
+    }
+    return it;
+}
+
 constexpr const char *consumeStringLiteral(ConstStringRef wholeText, const char *parsePos) {
     auto stringLiteralBeg = *parsePos;
     switch (stringLiteralBeg) {
@@ -238,6 +246,7 @@ static_assert(sizeof(Line) == 12, "");
 
 using TokensCache = StackVec<Token, 2048>;
 using LinesCache = StackVec<Line, 512>;
+constexpr size_t estimatedTokensPerLine = 4U;
 
 std::string constructYamlError(size_t lineNumber, const char *lineBeg, const char *parsePos, const char *reason = nullptr);
 
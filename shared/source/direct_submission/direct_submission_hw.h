@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,9 +9,12 @@
 #include "shared/source/command_stream/linear_stream.h"
 #include "shared/source/helpers/completion_stamp.h"
 #include "shared/source/helpers/constants.h"
+#include "shared/source/utilities/cpuintrinsics.h"
 #include "shared/source/utilities/stackvec.h"
 
+#include <atomic>
 #include <memory>
+#include <vector>
 
 namespace NEO {
 
@@ -67,9 +70,12 @@ class DirectSubmissionHw {
 
     static std::unique_ptr<DirectSubmissionHw<GfxFamily, Dispatcher>> create(Device &device, OsContext &osContext);
 
+    uint64_t getRingBufferSwitches() const { return ringBufferSwitches.load(std::memory_order_relaxed); }
+
   protected:
     static constexpr size_t prefetchSize = 8 * MemoryConstants::cacheLineSize;
     static constexpr size_t prefetchNoops = prefetchSize / sizeof(uint32_t);
+    static constexpr size_t ringBufferRequiredSize = 256 * MemoryConstants::kiloByte;
     bool allocateResources();
     void deallocateResources();
     MOCKABLE_VIRTUAL bool makeResourcesResident(DirectSubmissionAllocations &allocations);
@@ -79,10 +85,13 @@ class DirectSubmissionHw {
     virtual uint64_t switchRingBuffers();
     virtual void handleSwitchRingBuffers() = 0;
     GraphicsAllocation *switchRingBuffersAllocations();
+    GraphicsAllocation *allocateRingBuffer();
+    virtual bool isCompleted(uint32_t ringBufferIndex) = 0;
     virtual uint64_t updateTagValue() = 0;
     virtual void getTagAddressValue(TagData &tagData) = 0;
 
     void cpuCachelineFlush(void *ptr, size_t size);
+    void selectCpuCachelineFlush();
 
     void dispatchSemaphoreSection(uint32_t value);
     size_t getSizeSemaphoreSection();
@@ -114,14 +123,19 @@ class DirectSubmissionHw {
     void dispatchDiagnosticModeSection();
     size_t getDiagnosticModeSection();
 
-    enum RingBufferUse : uint32_t {
-        FirstBuffer,
-        SecondBuffer,
-        MaxBuffers
+    struct RingBufferUse {
+        RingBufferUse() = default;
+        RingBufferUse(FlushStamp completionFence, GraphicsAllocation *ringBuffer) : completionFence(completionFence), ringBuffer(ringBuffer){};
+
+        constexpr static uint32_t initialRingBufferCount = 2u;
+        constexpr static uint32_t defaultMaxRingBufferCount = 8u;
+
+        FlushStamp completionFence = 0ull;
+        GraphicsAllocation *ringBuffer = nullptr;
     };
+    std::vector<RingBufferUse> ringBuffers;
 
     LinearStream ringCommandStream;
-    FlushStamp completionRingBuffers[RingBufferUse::MaxBuffers] = {0ull, 0ull};
     std::unique_ptr<DirectSubmissionDiagnosticsCollector> diagnostic;
 
     uint64_t semaphoreGpuVa = 0u;
@@ -129,20 +143,24 @@ class DirectSubmissionHw {
     Device &device;
     OsContext &osContext;
     const HardwareInfo *hwInfo = nullptr;
-    GraphicsAllocation *ringBuffer = nullptr;
-    GraphicsAllocation *ringBuffer2 = nullptr;
     GraphicsAllocation *semaphores = nullptr;
     void *semaphorePtr = nullptr;
     volatile RingSemaphoreData *semaphoreData = nullptr;
     volatile void *workloadModeOneStoreAddress = nullptr;
 
     uint32_t currentQueueWorkCount = 1u;
-    RingBufferUse currentRingBuffer = RingBufferUse::FirstBuffer;
+    std::atomic<uint64_t> ringBufferSwitches{0u};
+    uint32_t currentRingBuffer = 0u;
+    uint32_t maxRingBufferCount = RingBufferUse::defaultMaxRingBufferCount;
+    uint32_t ringBuffersExhaustedCount = 0u;
     uint32_t workloadMode = 0;
     uint32_t workloadModeOneExpectedValue = 0u;
 
+    void (*cpuCachelineFlushFunc)(void const *ptr) = CpuIntrinsics::clFlush;
+
     bool ringStart = false;
     bool disableCpuCacheFlush = true;
+    bool cpuCachelineFlushFence = false;
     bool disableCacheFlush = false;
     bool disableMonitorFence = false;
 };
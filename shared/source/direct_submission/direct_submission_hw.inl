@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,6 +21,7 @@
 #include "shared/source/utilities/cpu_info.h"
 #include "shared/source/utilities/cpuintrinsics.h"
 
+#include <algorithm>
 #include <cstring>
 
 namespace NEO {
@@ -42,6 +43,11 @@ DirectSubmissionHw<GfxFamily, Dispatcher>::DirectSubmissionHw(Device &device,
     if (disableCacheFlushKey != -1) {
         disableCpuCacheFlush = disableCacheFlushKey == 1 ? true : false;
     }
+    selectCpuCachelineFlush();
+
+    if (DebugManager.flags.DirectSubmissionMaxRingBuffers.get() != -1) {
+        maxRingBufferCount = std::max(static_cast<uint32_t>(DebugManager.flags.DirectSubmissionMaxRingBuffers.get()), RingBufferUse::initialRingBufferCount);
+    }
     hwInfo = &device.getHardwareInfo();
     createDiagnostic();
 }
@@ -50,25 +56,32 @@ template <typename GfxFamily, typename Dispatcher>
 DirectSubmissionHw<GfxFamily, Dispatcher>::~DirectSubmissionHw() = default;
 
 template <typename GfxFamily, typename Dispatcher>
-bool DirectSubmissionHw<GfxFamily, Dispatcher>::allocateResources() {
-    DirectSubmissionAllocations allocations;
-
+GraphicsAllocation *DirectSubmissionHw<GfxFamily, Dispatcher>::allocateRingBuffer() {
     bool isMultiOsContextCapable = osContext.getNumSupportedDevices() > 1u;
     MemoryManager *memoryManager = device.getExecutionEnvironment()->memoryManager.get();
-    constexpr size_t minimumRequiredSize = 256 * MemoryConstants::kiloByte;
-    constexpr size_t additionalAllocationSize = MemoryConstants::pageSize;
-    const auto allocationSize = alignUp(minimumRequiredSize + additionalAllocationSize, MemoryConstants::pageSize64k);
+    const auto allocationSize = alignUp(ringBufferRequiredSize + MemoryConstants::pageSize, MemoryConstants::pageSize64k);
     const AllocationProperties commandStreamAllocationProperties{device.getRootDeviceIndex(),
                                                                  true, allocationSize,
                                                                  GraphicsAllocation::AllocationType::RING_BUFFER,
                                                                  isMultiOsContextCapable, osContext.getDeviceBitfield()};
-    ringBuffer = memoryManager->allocateGraphicsMemoryWithProperties(commandStreamAllocationProperties);
+    auto ringBuffer = memoryManager->allocateGraphicsMemoryWithProperties(commandStreamAllocationProperties);
     UNRECOVERABLE_IF(ringBuffer == nullptr);
-    allocations.push_back(ringBuffer);
+    return ringBuffer;
+}
 
-    ringBuffer2 = memoryManager->allocateGraphicsMemoryWithProperties(commandStreamAllocationProperties);
-    UNRECOVERABLE_IF(ringBuffer2 == nullptr);
-    allocations.push_back(ringBuffer2);
+template <typename GfxFamily, typename Dispatcher>
+bool DirectSubmissionHw<GfxFamily, Dispatcher>::allocateResources() {
+    DirectSubmissionAllocations allocations;
+
+    bool isMultiOsContextCapable = osContext.getNumSupportedDevices() > 1u;
+    MemoryManager *memoryManager = device.getExecutionEnvironment()->memoryManager.get();
+
+    ringBuffers.reserve(maxRingBufferCount);
+    for (uint32_t ringBufferIndex = 0; ringBufferIndex < RingBufferUse::initialRingBufferCount; ringBufferIndex++) {
+        auto ringBuffer = allocateRingBuffer();
+        ringBuffers.emplace_back(0ull, ringBuffer);
+        allocations.push_back(ringBuffer);
+    }
 
     const AllocationProperties semaphoreAllocationProperties{device.getRootDeviceIndex(),
                                                              true, MemoryConstants::pageSize,
@@ -79,11 +92,13 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::allocateResources() {
     allocations.push_back(semaphores);
 
     handleResidency();
-    ringCommandStream.replaceBuffer(ringBuffer->getUnderlyingBuffer(), minimumRequiredSize);
-    ringCommandStream.replaceGraphicsAllocation(ringBuffer);
+    currentRingBuffer = 0u;
+    ringCommandStream.replaceBuffer(ringBuffers[currentRingBuffer].ringBuffer->getUnderlyingBuffer(), ringBufferRequiredSize);
+    ringCommandStream.replaceGraphicsAllocation(ringBuffers[currentRingBuffer].ringBuffer);
 
-    memset(ringBuffer->getUnderlyingBuffer(), 0, allocationSize);
-    memset(ringBuffer2->getUnderlyingBuffer(), 0, allocationSize);
+    for (auto &ringBuffer : ringBuffers) {
+        memset(ringBuffer.ringBuffer->getUnderlyingBuffer(), 0, ringBuffer.ringBuffer->getUnderlyingBufferSize());
+    }
     semaphorePtr = semaphores->getUnderlyingBuffer();
     semaphoreGpuVa = semaphores->getGpuAddress();
     semaphoreData = static_cast<volatile RingSemaphoreData *>(semaphorePtr);
@@ -106,6 +121,23 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::makeResourcesResident(DirectSubm
     return ret;
 }
 
+template <typename GfxFamily, typename Dispatcher>
+void DirectSubmissionHw<GfxFamily, Dispatcher>::selectCpuCachelineFlush() {
+    auto &cpuInfo = CpuInfo::getInstance();
+    auto flushMode = DebugManager.flags.DirectSubmissionCpuCachelineFlushMode.get();
+    // the GPU reads ring and semaphore lines from memory, so writing them back is enough and clwb keeps them cached
+    if ((flushMode == -1 || flushMode == 2) && cpuInfo.isFeatureSupported(CpuInfo::featureClwb)) {
+        cpuCachelineFlushFunc = CpuIntrinsics::clWb;
+        cpuCachelineFlushFence = true;
+    } else if ((flushMode == -1 || flushMode >= 1) && cpuInfo.isFeatureSupported(CpuInfo::featureClflushopt)) {
+        cpuCachelineFlushFunc = CpuIntrinsics::clFlushOpt;
+        cpuCachelineFlushFence = true;
+    } else {
+        cpuCachelineFlushFunc = CpuIntrinsics::clFlush;
+        cpuCachelineFlushFence = false;
+    }
+}
+
 template <typename GfxFamily, typename Dispatcher>
 inline void DirectSubmissionHw<GfxFamily, Dispatcher>::cpuCachelineFlush(void *ptr, size_t size) {
     if (disableCpuCacheFlush) {
@@ -120,9 +152,13 @@ inline void DirectSubmissionHw<GfxFamily, Dispatcher>::cpuCachelineFlush(void *p
     flushEndPtr = alignUp(flushEndPtr, MemoryConstants::cacheLineSize);
     size_t cachelines = (flushEndPtr - flushPtr) >> cachlineBit;
     for (size_t i = 0; i < cachelines; i++) {
-        CpuIntrinsics::clFlush(flushPtr);
+        cpuCachelineFlushFunc(flushPtr);
         flushPtr += MemoryConstants::cacheLineSize;
     }
+    // weakly ordered flushes of the whole range complete before the following semaphore update
+    if (cpuCachelineFlushFence) {
+        CpuIntrinsics::sfence();
+    }
 }
 
 template <typename GfxFamily, typename Dispatcher>
@@ -389,6 +425,7 @@ inline uint64_t DirectSubmissionHw<GfxFamily, Dispatcher>::switchRingBuffers() {
 
     ringCommandStream.replaceBuffer(nextRingBuffer->getUnderlyingBuffer(), ringCommandStream.getMaxAvailableSpace());
     ringCommandStream.replaceGraphicsAllocation(nextRingBuffer);
+    ringBufferSwitches.fetch_add(1u, std::memory_order_relaxed);
 
     handleSwitchRingBuffers();
 
@@ -397,29 +434,45 @@ inline uint64_t DirectSubmissionHw<GfxFamily, Dispatcher>::switchRingBuffers() {
 
 template <typename GfxFamily, typename Dispatcher>
 inline GraphicsAllocation *DirectSubmissionHw<GfxFamily, Dispatcher>::switchRingBuffersAllocations() {
-    GraphicsAllocation *nextAllocation = nullptr;
-    if (currentRingBuffer == RingBufferUse::FirstBuffer) {
-        nextAllocation = ringBuffer2;
-        currentRingBuffer = RingBufferUse::SecondBuffer;
-    } else {
-        nextAllocation = ringBuffer;
-        currentRingBuffer = RingBufferUse::FirstBuffer;
+    const auto ringBuffersCount = static_cast<uint32_t>(ringBuffers.size());
+    for (uint32_t offset = 1; offset < ringBuffersCount; offset++) {
+        auto ringBufferIndex = (currentRingBuffer + offset) % ringBuffersCount;
+        if (isCompleted(ringBufferIndex)) {
+            currentRingBuffer = ringBufferIndex;
+            return ringBuffers[currentRingBuffer].ringBuffer;
+        }
     }
-    return nextAllocation;
+
+    if (ringBuffersCount < maxRingBufferCount) {
+        auto ringBuffer = allocateRingBuffer();
+        DirectSubmissionAllocations allocations;
+        allocations.push_back(ringBuffer);
+        UNRECOVERABLE_IF(!makeResourcesResident(allocations));
+        handleResidency();
+        memset(ringBuffer->getUnderlyingBuffer(), 0, ringBuffer->getUnderlyingBufferSize());
+
+        ringBuffers.emplace_back(0ull, ringBuffer);
+        currentRingBuffer = ringBuffersCount;
+        return ringBuffer;
+    }
+
+    // All ring buffers are in flight, the next one has to be waited for in handleSwitchRingBuffers()
+    ringBuffersExhaustedCount++;
+    currentRingBuffer = (currentRingBuffer + 1) % ringBuffersCount;
+    return ringBuffers[currentRingBuffer].ringBuffer;
 }
 
 template <typename GfxFamily, typename Dispatcher>
 void DirectSubmissionHw<GfxFamily, Dispatcher>::deallocateResources() {
     MemoryManager *memoryManager = device.getExecutionEnvironment()->memoryManager.get();
 
-    if (ringBuffer) {
-        memoryManager->freeGraphicsMemory(ringBuffer);
-        ringBuffer = nullptr;
-    }
-    if (ringBuffer2) {
-        memoryManager->freeGraphicsMemory(ringBuffer2);
-        ringBuffer2 = nullptr;
+    PRINT_DEBUG_STRING(DebugManager.flags.PrintDebugMessages.get() && !ringBuffers.empty(), stdout,
+                       "Direct submission used %zu ring buffers, all ring buffers were in use %u times\n",
+                       ringBuffers.size(), ringBuffersExhaustedCount);
+    for (auto &ringBuffer : ringBuffers) {
+        memoryManager->freeGraphicsMemory(ringBuffer.ringBuffer);
     }
+    ringBuffers.clear();
     if (semaphores) {
         memoryManager->freeGraphicsMemory(semaphores);
         semaphores = nullptr;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #pragma once
 #include "shared/source/direct_submission/direct_submission_hw.h"
+#include "shared/source/utilities/wait_util.h"
 
 namespace NEO {
 
@@ -27,12 +28,15 @@ class DrmDirectSubmission : public DirectSubmissionHw<GfxFamily, Dispatcher> {
 
     bool handleResidency() override;
     void handleSwitchRingBuffers() override;
+    bool isCompleted(uint32_t ringBufferIndex) override;
     uint64_t updateTagValue() override;
     void getTagAddressValue(TagData &tagData) override;
 
     void wait(uint32_t taskCountToWait);
 
     TagData currentTagData;
+    WaitUtils::WaitPolicy waitPolicy;
+    WaitUtils::WaitStatistics waitStatistics;
     volatile uint32_t *tagAddress;
 };
 } // namespace NEO
@@ -6,11 +6,13 @@
  */
 
 #include "shared/source/command_stream/linear_stream.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/direct_submission/linux/drm_direct_submission.h"
 #include "shared/source/os_interface/linux/drm_allocation.h"
 #include "shared/source/os_interface/linux/drm_buffer_object.h"
 #include "shared/source/os_interface/linux/drm_neo.h"
 #include "shared/source/os_interface/linux/os_context_linux.h"
+#include "shared/source/utilities/wait_util.h"
 
 #include <memory>
 
@@ -28,6 +30,16 @@ DrmDirectSubmission<GfxFamily, Dispatcher>::DrmDirectSubmission(Device &device,
 
     auto osContextLinux = static_cast<OsContextLinux *>(&this->osContext);
     osContextLinux->getDrm().setDirectSubmissionActive(true);
+
+    if (DebugManager.flags.DirectSubmissionWaitSpinCount.get() != -1) {
+        waitPolicy.spinCount = static_cast<uint32_t>(DebugManager.flags.DirectSubmissionWaitSpinCount.get());
+    }
+    if (DebugManager.flags.DirectSubmissionWaitPauseCount.get() != -1) {
+        waitPolicy.pauseCount = static_cast<uint32_t>(DebugManager.flags.DirectSubmissionWaitPauseCount.get());
+    }
+    if (DebugManager.flags.DirectSubmissionWaitUseUmwait.get() == 1) {
+        waitPolicy.useUmwait = WaitUtils::isUmwaitSupported();
+    }
 };
 
 template <typename GfxFamily, typename Dispatcher>
@@ -35,9 +47,13 @@ inline DrmDirectSubmission<GfxFamily, Dispatcher>::~DrmDirectSubmission() {
     if (this->ringStart) {
         this->wait(static_cast<uint32_t>(this->currentTagData.tagValue));
         this->stopRingBuffer();
-        auto bb = static_cast<DrmAllocation *>(this->ringBuffer)->getBO();
+        auto bb = static_cast<DrmAllocation *>(this->ringBuffers[0].ringBuffer)->getBO();
         bb->wait(-1);
     }
+    PRINT_DEBUG_STRING(DebugManager.flags.PrintDebugMessages.get() && waitStatistics.waitCount > 0, stdout,
+                       "Direct submission waits: %llu, total wait time: %llu ns, pause iterations: %llu, yields: %llu\n",
+                       static_cast<unsigned long long>(waitStatistics.waitCount), static_cast<unsigned long long>(waitStatistics.waitTimeNs),
+                       static_cast<unsigned long long>(waitStatistics.pauseCount), static_cast<unsigned long long>(waitStatistics.yieldCount));
     this->deallocateResources();
 }
 
@@ -92,16 +108,23 @@ bool DrmDirectSubmission<GfxFamily, Dispatcher>::handleResidency() {
 template <typename GfxFamily, typename Dispatcher>
 void DrmDirectSubmission<GfxFamily, Dispatcher>::handleSwitchRingBuffers() {
     if (this->ringStart) {
-        if (this->completionRingBuffers[this->currentRingBuffer] != 0) {
-            this->wait(static_cast<uint32_t>(this->completionRingBuffers[this->currentRingBuffer]));
+        auto completionFence = this->ringBuffers[this->currentRingBuffer].completionFence;
+        if (completionFence != 0) {
+            this->wait(static_cast<uint32_t>(completionFence));
         }
     }
 }
 
+template <typename GfxFamily, typename Dispatcher>
+bool DrmDirectSubmission<GfxFamily, Dispatcher>::isCompleted(uint32_t ringBufferIndex) {
+    auto completionFence = this->ringBuffers[ringBufferIndex].completionFence;
+    return completionFence == 0 || *this->tagAddress >= static_cast<uint32_t>(completionFence);
+}
+
 template <typename GfxFamily, typename Dispatcher>
 uint64_t DrmDirectSubmission<GfxFamily, Dispatcher>::updateTagValue() {
     this->currentTagData.tagValue++;
-    this->completionRingBuffers[this->currentRingBuffer] = this->currentTagData.tagValue;
+    this->ringBuffers[this->currentRingBuffer].completionFence = this->currentTagData.tagValue;
     return 0ull;
 }
 
@@ -113,8 +136,7 @@ void DrmDirectSubmission<GfxFamily, Dispatcher>::getTagAddressValue(TagData &tag
 
 template <typename GfxFamily, typename Dispatcher>
 void DrmDirectSubmission<GfxFamily, Dispatcher>::wait(uint32_t taskCountToWait) {
-    while (taskCountToWait > *this->tagAddress) {
-    }
+    WaitUtils::waitForCompletion(this->tagAddress, taskCountToWait, waitPolicy, waitStatistics);
 }
 
 } // namespace NEO
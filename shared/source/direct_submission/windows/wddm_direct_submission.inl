@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -94,20 +94,28 @@ bool WddmDirectSubmission<GfxFamily, Dispatcher>::handleResidency() {
 template <typename GfxFamily, typename Dispatcher>
 void WddmDirectSubmission<GfxFamily, Dispatcher>::handleSwitchRingBuffers() {
     if (ringStart) {
-        if (completionRingBuffers[currentRingBuffer] != 0) {
+        auto completionFence = ringBuffers[currentRingBuffer].completionFence;
+        if (completionFence != 0) {
             MonitoredFence &currentFence = osContextWin->getResidencyController().getMonitoredFence();
-            handleCompletionRingBuffer(completionRingBuffers[currentRingBuffer], currentFence);
+            handleCompletionRingBuffer(completionFence, currentFence);
         }
     }
 }
 
+template <typename GfxFamily, typename Dispatcher>
+bool WddmDirectSubmission<GfxFamily, Dispatcher>::isCompleted(uint32_t ringBufferIndex) {
+    auto completionFence = ringBuffers[ringBufferIndex].completionFence;
+    MonitoredFence &currentFence = osContextWin->getResidencyController().getMonitoredFence();
+    return completionFence == 0 || *currentFence.cpuAddress >= completionFence;
+}
+
 template <typename GfxFamily, typename Dispatcher>
 uint64_t WddmDirectSubmission<GfxFamily, Dispatcher>::updateTagValue() {
     MonitoredFence &currentFence = osContextWin->getResidencyController().getMonitoredFence();
 
     currentFence.lastSubmittedFence = currentFence.currentFenceValue;
     currentFence.currentFenceValue++;
-    completionRingBuffers[currentRingBuffer] = currentFence.lastSubmittedFence;
+    ringBuffers[currentRingBuffer].completionFence = currentFence.lastSubmittedFence;
 
     return currentFence.lastSubmittedFence;
 }
@@ -8,11 +8,13 @@
 #include "shared/source/execution_environment/execution_environment.h"
 
 #include "shared/source/built_ins/built_ins.h"
+#include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/os_agnostic_memory_manager.h"
 #include "shared/source/os_interface/os_environment.h"
+#include "shared/source/utilities/trace_events.h"
 
 namespace NEO {
 ExecutionEnvironment::ExecutionEnvironment() = default;
@@ -33,6 +35,7 @@ bool ExecutionEnvironment::initializeMemoryManager() {
     if (this->memoryManager) {
         return memoryManager->isInitialized();
     }
+    ScopedTraceEvent traceEvent("memoryManagerInit", TraceEvents::Category::initialization);
 
     int32_t setCommandStreamReceiverType = CommandStreamReceiverType::CSR_HW;
     if (DebugManager.flags.SetCommandStreamReceiver.get() >= 0) {
@@ -78,6 +81,46 @@ void ExecutionEnvironment::prepareRootDeviceEnvironments(uint32_t numRootDevices
         }
     }
 }
+bool ExecutionEnvironment::isRootDeviceSelectedByAffinityMask(uint32_t rootDeviceIndex) {
+    auto affinityMaskString = DebugManager.flags.ZE_AFFINITY_MASK.get();
+
+    if (affinityMaskString.compare("default") == 0 ||
+        affinityMaskString.empty()) {
+        return true;
+    }
+
+    size_t pos = 0;
+    while (pos < affinityMaskString.size()) {
+        size_t posNextComma = affinityMaskString.find_first_of(",", pos);
+        std::string entryString = affinityMaskString.substr(pos, posNextComma - pos);
+        std::string rootDeviceString = entryString.substr(0, entryString.find_first_of("."));
+        if (static_cast<uint32_t>(std::stoul(rootDeviceString, nullptr, 0)) == rootDeviceIndex) {
+            return true;
+        }
+        if (posNextComma == std::string::npos) {
+            break;
+        }
+        pos = posNextComma + 1;
+    }
+    return false;
+}
+
+bool ExecutionEnvironment::isFastProcessTeardownEnabled() {
+    // aub and tbx streams have to be closed properly
+    auto csrType = DebugManager.flags.SetCommandStreamReceiver.get();
+    return DebugManager.flags.FastProcessTeardown.get() && (csrType == -1 || csrType == CommandStreamReceiverType::CSR_HW);
+}
+
+void ExecutionEnvironment::prepareForFastTeardown() {
+    // owners of worker threads are destroyed to join them, everything else is left to the kernel
+    if (memoryManager) {
+        memoryManager->prepareForFastTeardown();
+    }
+    for (auto &rootDeviceEnvironment : rootDeviceEnvironments) {
+        rootDeviceEnvironment->compilerInterface.reset();
+    }
+}
+
 void ExecutionEnvironment::parseAffinityMask() {
     auto affinityMaskString = DebugManager.flags.ZE_AFFINITY_MASK.get();
 
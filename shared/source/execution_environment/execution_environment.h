@@ -25,6 +25,9 @@ class ExecutionEnvironment : public ReferenceTrackedObject<ExecutionEnvironment>
     void calculateMaxOsContextCount();
     void prepareRootDeviceEnvironments(uint32_t numRootDevices);
     void parseAffinityMask();
+    static bool isRootDeviceSelectedByAffinityMask(uint32_t rootDeviceIndex);
+    static bool isFastProcessTeardownEnabled();
+    virtual void prepareForFastTeardown();
     void setDebuggingEnabled() {
         debuggingEnabled = true;
     }
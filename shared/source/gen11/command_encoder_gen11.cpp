@@ -42,6 +42,7 @@ template struct EncodeDispatchKernel<Family>;
 template struct EncodeStates<Family>;
 template struct EncodeMath<Family>;
 template struct EncodeMathMMIO<Family>;
+template struct EncodeDurationHistogram<Family>;
 template struct EncodeIndirectParams<Family>;
 template struct EncodeSetMMIO<Family>;
 template struct EncodeL3State<Family>;
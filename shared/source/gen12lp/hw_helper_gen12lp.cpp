@@ -194,6 +194,13 @@ const HwHelper::EngineInstancesContainer HwHelperHw<Family>::getGpgpuEngineInsta
 
     if (hwInfo.featureTable.ftrBcsInfo.test(0)) {
         engines.push_back({aub_stream::ENGINE_BCS, EngineUsage::Regular});
+        if (DebugManager.flags.EnableCopyEngineForPageFaultTransfers.get() == 1) {
+            engines.push_back({aub_stream::ENGINE_BCS, EngineUsage::Internal}); // page fault transfers
+        }
+    }
+
+    if (DebugManager.flags.EnableHighPriorityEngine.get() == 1) {
+        engines.push_back({defaultEngine, EngineUsage::HighPriority});
     }
 
     auto hwInfoConfig = HwInfoConfig::get(hwInfo.platform.eProductFamily);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #include "shared/source/gmm_helper/client_context/gmm_client_context_base.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
 #include "shared/source/gmm_helper/gmm_interface.h"
 #include "shared/source/helpers/debug_helpers.h"
@@ -15,6 +16,36 @@
 #include "shared/source/sku_info/operations/sku_info_transfer.h"
 
 namespace NEO {
+namespace {
+template <typename T>
+void appendToResInfoCacheKey(std::string &key, const T &value) {
+    key.append(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+// only fields describing the resource are keyed, padding and pointers are skipped
+std::string createResInfoCacheKey(const GMM_RESCREATE_PARAMS &createParams) {
+    std::string key;
+    appendToResInfoCacheKey(key, createParams.Type);
+    appendToResInfoCacheKey(key, createParams.Format);
+    appendToResInfoCacheKey(key, createParams.Flags.Gpu);
+    appendToResInfoCacheKey(key, createParams.Flags.Info);
+    appendToResInfoCacheKey(key, createParams.Flags.Wa);
+    appendToResInfoCacheKey(key, createParams.MSAA.SamplePattern);
+    appendToResInfoCacheKey(key, createParams.MSAA.NumSamples);
+    appendToResInfoCacheKey(key, createParams.BaseWidth64);
+    appendToResInfoCacheKey(key, createParams.BaseHeight);
+    appendToResInfoCacheKey(key, createParams.Depth);
+    appendToResInfoCacheKey(key, createParams.MaxLod);
+    appendToResInfoCacheKey(key, createParams.ArraySize);
+    appendToResInfoCacheKey(key, createParams.BaseAlignment);
+    appendToResInfoCacheKey(key, createParams.OverridePitch);
+    appendToResInfoCacheKey(key, createParams.Usage);
+    appendToResInfoCacheKey(key, createParams.CpTag);
+    appendToResInfoCacheKey(key, createParams.NoGfxMemory);
+    return key;
+}
+} // namespace
+
 GmmClientContextBase::GmmClientContextBase(OSInterface *osInterface, HardwareInfo *hwInfo) : hardwareInfo(hwInfo) {
     _SKU_FEATURE_TABLE gmmFtrTable = {};
     _WA_TABLE gmmWaTable = {};
@@ -41,6 +72,8 @@ GmmClientContextBase::GmmClientContextBase(OSInterface *osInterface, HardwareInf
     clientContext = outArgs.pGmmClientContext;
 }
 GmmClientContextBase::~GmmClientContextBase() {
+    clearResInfoCache();
+
     GMM_INIT_OUT_ARGS outArgs;
     outArgs.pGmmClientContext = clientContext;
 
@@ -63,6 +96,41 @@ void GmmClientContextBase::destroyResInfoObject(GMM_RESOURCE_INFO *pResInfo) {
     clientContext->DestroyResInfoObject(pResInfo);
 }
 
+GMM_RESOURCE_INFO *GmmClientContextBase::createResInfoObjectWithCache(GMM_RESCREATE_PARAMS *pCreateParams) {
+    // resources placed in existing memory describe that memory and are never shared
+    if (pCreateParams->Flags.Info.ExistingSysMem || (DebugManager.flags.EnableGmmResourceInfoCache.get() == 0)) {
+        return createResInfoObject(pCreateParams);
+    }
+
+    auto key = createResInfoCacheKey(*pCreateParams);
+    {
+        std::lock_guard<std::mutex> lock(resInfoCacheMutex);
+        auto cachedResInfo = resInfoCache.find(key);
+        if (cachedResInfo != resInfoCache.end()) {
+            return copyResInfoObject(cachedResInfo->second);
+        }
+    }
+
+    auto resInfo = createResInfoObject(pCreateParams);
+    if (resInfo == nullptr) {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(resInfoCacheMutex);
+    if (resInfoCache.size() < maxCachedResInfoObjects && resInfoCache.find(key) == resInfoCache.end()) {
+        resInfoCache.emplace(std::move(key), copyResInfoObject(resInfo));
+    }
+    return resInfo;
+}
+
+void GmmClientContextBase::clearResInfoCache() {
+    std::lock_guard<std::mutex> lock(resInfoCacheMutex);
+    for (auto &cachedResInfo : resInfoCache) {
+        destroyResInfoObject(cachedResInfo.second);
+    }
+    resInfoCache.clear();
+}
+
 GMM_CLIENT_CONTEXT *GmmClientContextBase::getHandle() const {
     return clientContext;
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,6 +9,9 @@
 #include "shared/source/gmm_helper/gmm_lib.h"
 
 #include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 
 namespace NEO {
 class GmmClientContext;
@@ -23,6 +26,9 @@ class GmmClientContextBase {
     MOCKABLE_VIRTUAL GMM_RESOURCE_INFO *createResInfoObject(GMM_RESCREATE_PARAMS *pCreateParams);
     MOCKABLE_VIRTUAL GMM_RESOURCE_INFO *copyResInfoObject(GMM_RESOURCE_INFO *pSrcRes);
     MOCKABLE_VIRTUAL void destroyResInfoObject(GMM_RESOURCE_INFO *pResInfo);
+    // identical create params copy a layout already computed by GmmLib instead of computing it again
+    GMM_RESOURCE_INFO *createResInfoObjectWithCache(GMM_RESCREATE_PARAMS *pCreateParams);
+    void clearResInfoCache();
     GMM_CLIENT_CONTEXT *getHandle() const;
     template <typename T>
     static std::unique_ptr<GmmClientContext> create(OSInterface *osInterface, HardwareInfo *hwInfo) {
@@ -37,8 +43,12 @@ class GmmClientContextBase {
     MOCKABLE_VIRTUAL uint8_t getMediaSurfaceStateCompressionFormat(GMM_RESOURCE_FORMAT format);
 
   protected:
+    static constexpr size_t maxCachedResInfoObjects = 256u;
+
     HardwareInfo *hardwareInfo = nullptr;
     GMM_CLIENT_CONTEXT *clientContext;
+    std::mutex resInfoCacheMutex;
+    std::unordered_map<std::string, GMM_RESOURCE_INFO *> resInfoCache;
     GmmClientContextBase(OSInterface *osInterface, HardwareInfo *hwInfo);
 };
 } // namespace NEO
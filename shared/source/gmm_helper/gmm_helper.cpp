@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -45,7 +45,10 @@ GmmHelper::GmmHelper(OSInterface *osInterface, const HardwareInfo *pHwInfo) : hw
     UNRECOVERABLE_IF(!gmmClientContext);
 }
 
-GmmHelper::~GmmHelper() = default;
+GmmHelper::~GmmHelper() {
+    // cached layouts are released while the client context can still be called virtually
+    gmmClientContext->clearResInfoCache();
+}
 
 decltype(GmmHelper::createGmmContextWrapperFunc) GmmHelper::createGmmContextWrapperFunc = GmmClientContextBase::create<GmmClientContext>;
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,6 +12,8 @@
 
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 namespace NEO {
 class Gmm;
@@ -28,6 +30,12 @@ class GmmPageTableMngr {
     bool updateAuxTable(uint64_t gpuVa, Gmm *gmm, bool map);
     bool initPageTableManagerRegisters(void *csrHandle);
 
+    // maps are accumulated and applied in one batch before the next submission;
+    // an allocation released before that never touches the aux table
+    void deferAuxTableMap(uint64_t gpuVa, Gmm *gmm);
+    bool removePendingAuxTableMap(uint64_t gpuVa);
+    bool flushPendingAuxTableUpdates();
+
   protected:
     GmmPageTableMngr() = default;
 
@@ -42,5 +50,8 @@ class GmmPageTableMngr {
     GmmPageTableMngr(GmmClientContext *clientContext, unsigned int translationTableFlags, GMM_TRANSLATIONTABLE_CALLBACKS *translationTableCb);
     GMM_CLIENT_CONTEXT *clientContext = nullptr;
     GMM_PAGETABLE_MGR *pageTableManager = nullptr;
+
+    std::mutex pendingAuxTableMapsMutex;
+    std::vector<std::pair<uint64_t, Gmm *>> pendingAuxTableMaps;
 };
 } // namespace NEO
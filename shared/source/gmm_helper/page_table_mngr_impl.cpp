@@ -1,10 +1,11 @@
 /*
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/gmm_helper/gmm.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
 #include "shared/source/gmm_helper/page_table_mngr.h"
@@ -12,6 +13,8 @@
 
 #include "gmm_client_context.h"
 
+#include <algorithm>
+
 namespace NEO {
 GmmPageTableMngr::~GmmPageTableMngr() {
     if (clientContext) {
@@ -29,6 +32,34 @@ bool GmmPageTableMngr::updateAuxTable(uint64_t gpuVa, Gmm *gmm, bool map) {
     return updateAuxTable(&ddiUpdateAuxTable) == GMM_STATUS::GMM_SUCCESS;
 }
 
+void GmmPageTableMngr::deferAuxTableMap(uint64_t gpuVa, Gmm *gmm) {
+    std::lock_guard<std::mutex> lock(pendingAuxTableMapsMutex);
+    pendingAuxTableMaps.emplace_back(gpuVa, gmm);
+}
+
+bool GmmPageTableMngr::removePendingAuxTableMap(uint64_t gpuVa) {
+    std::lock_guard<std::mutex> lock(pendingAuxTableMapsMutex);
+    auto it = std::find_if(pendingAuxTableMaps.begin(), pendingAuxTableMaps.end(), [gpuVa](const auto &pendingMap) { return pendingMap.first == gpuVa; });
+    if (it == pendingAuxTableMaps.end()) {
+        return false;
+    }
+    pendingAuxTableMaps.erase(it);
+    return true;
+}
+
+bool GmmPageTableMngr::flushPendingAuxTableUpdates() {
+    if (DebugManager.flags.BatchAuxTableUpdates.get() != 1) {
+        return true;
+    }
+    std::lock_guard<std::mutex> lock(pendingAuxTableMapsMutex);
+    bool success = true;
+    for (auto &pendingMap : pendingAuxTableMaps) {
+        success &= updateAuxTable(pendingMap.first, pendingMap.second, true);
+    }
+    pendingAuxTableMaps.clear();
+    return success;
+}
+
 bool GmmPageTableMngr::initPageTableManagerRegisters(void *csrHandle) {
     auto status = initContextAuxTableRegister(csrHandle, GMM_ENGINE_TYPE::ENGINE_TYPE_RCS);
     return status == GMM_SUCCESS;
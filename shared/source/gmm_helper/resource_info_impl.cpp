@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -13,7 +13,7 @@
 namespace NEO {
 
 GmmResourceInfo::GmmResourceInfo(GmmClientContext *clientContext, GMM_RESCREATE_PARAMS *resourceCreateParams) : clientContext(clientContext) {
-    auto resourceInfoPtr = clientContext->createResInfoObject(resourceCreateParams);
+    auto resourceInfoPtr = clientContext->createResInfoObjectWithCache(resourceCreateParams);
     createResourceInfo(resourceInfoPtr);
 }
 
@@ -7,6 +7,7 @@
 
 #include "shared/source/helpers/bindless_heaps_helper.h"
 
+#include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/indirect_heap/indirect_heap.h"
 #include "shared/source/memory_manager/memory_manager.h"
@@ -52,34 +53,74 @@ GraphicsAllocation *BindlessHeapsHelper::getHeapAllocation(size_t heapSize, size
 }
 
 SurfaceStateInHeapInfo BindlessHeapsHelper::allocateSSInHeap(size_t ssSize, GraphicsAllocation *surfaceAllocation, BindlesHeapType heapType) {
-    auto heap = surfaceStateHeaps[heapType].get();
-    if (heapType == BindlesHeapType::GLOBAL_SSH) {
-        auto ssAllocatedInfo = surfaceStateInHeapAllocationMap.find(surfaceAllocation);
-        if (ssAllocatedInfo != surfaceStateInHeapAllocationMap.end()) {
-            return *ssAllocatedInfo->second.get();
-        } else {
-            std::lock_guard<std::mutex> autolock(this->mtx);
-            if (surfaceStateInHeapVectorReuse.size()) {
-                SurfaceStateInHeapInfo surfaceStateFromVector = *(surfaceStateInHeapVectorReuse.back());
-                surfaceStateInHeapVectorReuse.pop_back();
-                std::pair<GraphicsAllocation *, std::unique_ptr<SurfaceStateInHeapInfo>> pair(surfaceAllocation, std::make_unique<SurfaceStateInHeapInfo>(surfaceStateFromVector));
-                surfaceStateInHeapAllocationMap.insert(std::move(pair));
-                return surfaceStateFromVector;
-            }
+    return allocateSSInHeap(ssSize, surfaceAllocation, heapType, {});
+}
+
+SurfaceStateInHeapInfo BindlessHeapsHelper::allocateSSInHeap(size_t ssSize, GraphicsAllocation *surfaceAllocation, BindlesHeapType heapType, const SurfaceStateView &view) {
+    std::lock_guard<std::mutex> autolock(this->mtx);
+    if (heapType != BindlesHeapType::GLOBAL_SSH) {
+        return allocateSpaceInHeap(ssSize, heapType, view);
+    }
+
+    auto &surfaceStatesOfAllocation = surfaceStateInHeapAllocationMap[surfaceAllocation];
+    for (auto &surfaceStateInfo : surfaceStatesOfAllocation) {
+        if (surfaceStateInfo->view == view) {
+            return *surfaceStateInfo;
         }
     }
+    if (surfaceStatesOfAllocation.size() >= maxViewsPerAllocation) {
+        // the oldest view gives up its slot, as the single slot per allocation did before
+        auto oldestSurfaceState = std::move(surfaceStatesOfAllocation.front());
+        surfaceStatesOfAllocation.erase(surfaceStatesOfAllocation.begin());
+        oldestSurfaceState->view = view;
+        surfaceStatesOfAllocation.push_back(std::move(oldestSurfaceState));
+        return *surfaceStatesOfAllocation.back();
+    }
+    if (surfaceStateInHeapVectorReuse.size()) {
+        auto surfaceStateFromVector = std::move(surfaceStateInHeapVectorReuse.back());
+        surfaceStateInHeapVectorReuse.pop_back();
+        surfaceStateFromVector->view = view;
+        surfaceStatesOfAllocation.push_back(std::move(surfaceStateFromVector));
+        return *surfaceStatesOfAllocation.back();
+    }
+    auto bindlesInfo = allocateSpaceInHeap(ssSize, heapType, view);
+    surfaceStatesOfAllocation.push_back(std::make_unique<SurfaceStateInHeapInfo>(bindlesInfo));
+    return bindlesInfo;
+}
+
+SurfaceStateInHeapInfo BindlessHeapsHelper::allocateSamplerStatesInHeap(const void *samplerStates, size_t size) {
+    std::lock_guard<std::mutex> autolock(this->mtx);
+    // callers make only the current DSH allocation resident, copies left in older allocations are dropped
+    auto dshAllocation = surfaceStateHeaps[BindlesHeapType::GLOBAL_DSH]->getGraphicsAllocation();
+    if (samplerStatesHeapAllocation != dshAllocation) {
+        samplerStatesInHeap.clear();
+        samplerStatesHeapAllocation = dshAllocation;
+    }
+
+    auto samplerStatesHash = Hash::hash(reinterpret_cast<const char *>(samplerStates), size);
+    auto samplerStatesRange = samplerStatesInHeap.equal_range(samplerStatesHash);
+    for (auto samplerStatesInfo = samplerStatesRange.first; samplerStatesInfo != samplerStatesRange.second; samplerStatesInfo++) {
+        if (samplerStatesInfo->second.first == size && memcmp(samplerStatesInfo->second.second.ssPtr, samplerStates, size) == 0) {
+            return samplerStatesInfo->second.second;
+        }
+    }
+
+    auto bindlesInfo = allocateSpaceInHeap(size, BindlesHeapType::GLOBAL_DSH, {});
+    memcpy_s(bindlesInfo.ssPtr, size, samplerStates, size);
+    if (samplerStatesHeapAllocation != bindlesInfo.heapAllocation) {
+        samplerStatesInHeap.clear();
+        samplerStatesHeapAllocation = bindlesInfo.heapAllocation;
+    }
+    samplerStatesInHeap.insert({samplerStatesHash, {size, bindlesInfo}});
+    return bindlesInfo;
+}
+
+SurfaceStateInHeapInfo BindlessHeapsHelper::allocateSpaceInHeap(size_t ssSize, BindlesHeapType heapType, const SurfaceStateView &view) {
+    auto heap = surfaceStateHeaps[heapType].get();
     void *ptrInHeap = getSpaceInHeap(ssSize, heapType);
     memset(ptrInHeap, 0, ssSize);
     auto bindlessOffset = heap->getGraphicsAllocation()->getGpuAddress() - heap->getGraphicsAllocation()->getGpuBaseAddress() + heap->getUsed() - ssSize;
-    SurfaceStateInHeapInfo bindlesInfo;
-    if (heapType == BindlesHeapType::GLOBAL_SSH) {
-        std::pair<GraphicsAllocation *, std::unique_ptr<SurfaceStateInHeapInfo>> pair(surfaceAllocation, std::make_unique<SurfaceStateInHeapInfo>(SurfaceStateInHeapInfo{heap->getGraphicsAllocation(), bindlessOffset, ptrInHeap}));
-        bindlesInfo = *pair.second;
-        surfaceStateInHeapAllocationMap.insert(std::move(pair));
-    } else {
-        bindlesInfo = SurfaceStateInHeapInfo{heap->getGraphicsAllocation(), bindlessOffset, ptrInHeap};
-    }
-    return bindlesInfo;
+    return SurfaceStateInHeapInfo{heap->getGraphicsAllocation(), bindlessOffset, ptrInHeap, view};
 }
 
 void *BindlessHeapsHelper::getSpaceInHeap(size_t ssSize, BindlesHeapType heapType) {
@@ -117,13 +158,14 @@ void BindlessHeapsHelper::growHeap(BindlesHeapType heapType) {
 }
 
 void BindlessHeapsHelper::placeSSAllocationInReuseVectorOnFreeMemory(GraphicsAllocation *gfxAllocation) {
+    std::lock_guard<std::mutex> autolock(this->mtx);
     auto ssAllocatedInfo = surfaceStateInHeapAllocationMap.find(gfxAllocation);
     if (ssAllocatedInfo != surfaceStateInHeapAllocationMap.end()) {
-        std::lock_guard<std::mutex> autolock(this->mtx);
-        surfaceStateInHeapVectorReuse.push_back(std::move(ssAllocatedInfo->second));
+        for (auto &surfaceStateInfo : ssAllocatedInfo->second) {
+            surfaceStateInHeapVectorReuse.push_back(std::move(surfaceStateInfo));
+        }
         surfaceStateInHeapAllocationMap.erase(ssAllocatedInfo);
     }
-    return;
 }
 
 } // namespace NEO
\ No newline at end of file
@@ -13,6 +13,7 @@
 #include <memory>
 #include <mutex>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace NEO {
@@ -22,10 +23,22 @@ constexpr size_t ssAligment = MemoryConstants::cacheLineSize;
 class IndirectHeap;
 class GraphicsAllocation;
 
+// part of an allocation described by a surface state, states of different views never share a slot
+struct SurfaceStateView {
+    uint64_t gpuAddress = 0;
+    size_t size = 0;
+    uint32_t mocs = 0;
+
+    bool operator==(const SurfaceStateView &other) const {
+        return gpuAddress == other.gpuAddress && size == other.size && mocs == other.mocs;
+    }
+};
+
 struct SurfaceStateInHeapInfo {
     GraphicsAllocation *heapAllocation;
     uint64_t surfaceStateOffset;
     void *ssPtr;
+    SurfaceStateView view;
 };
 
 class BindlessHeapsHelper {
@@ -42,6 +55,9 @@ class BindlessHeapsHelper {
     GraphicsAllocation *getHeapAllocation(size_t heapSize, size_t alignment, bool allocInFrontWindow);
 
     SurfaceStateInHeapInfo allocateSSInHeap(size_t ssSize, GraphicsAllocation *surfaceAllocation, BindlesHeapType heapType);
+    SurfaceStateInHeapInfo allocateSSInHeap(size_t ssSize, GraphicsAllocation *surfaceAllocation, BindlesHeapType heapType, const SurfaceStateView &view);
+    // sampler states are immutable once written, identical tables share one copy in the global DSH
+    SurfaceStateInHeapInfo allocateSamplerStatesInHeap(const void *samplerStates, size_t size);
     uint64_t getGlobalHeapsBase();
     void *getSpaceInHeap(size_t ssSize, BindlesHeapType heapType);
     uint32_t getDefaultBorderColorOffset();
@@ -49,7 +65,10 @@ class BindlessHeapsHelper {
     IndirectHeap *getHeap(BindlesHeapType heapType);
     void placeSSAllocationInReuseVectorOnFreeMemory(GraphicsAllocation *gfxAllocation);
 
+    static constexpr size_t maxViewsPerAllocation = 16u;
+
   protected:
+    SurfaceStateInHeapInfo allocateSpaceInHeap(size_t ssSize, BindlesHeapType heapType, const SurfaceStateView &view);
     void growHeap(BindlesHeapType heapType);
     MemoryManager *memManager = nullptr;
     bool isMultiOsContextCapable = false;
@@ -58,7 +77,10 @@ class BindlessHeapsHelper {
     GraphicsAllocation *borderColorStates;
     std::vector<GraphicsAllocation *> ssHeapsAllocations;
     std::vector<std::unique_ptr<SurfaceStateInHeapInfo>> surfaceStateInHeapVectorReuse;
-    std::unordered_map<GraphicsAllocation *, std::unique_ptr<SurfaceStateInHeapInfo>> surfaceStateInHeapAllocationMap;
+    std::unordered_map<GraphicsAllocation *, std::vector<std::unique_ptr<SurfaceStateInHeapInfo>>> surfaceStateInHeapAllocationMap;
+    // keyed by content hash, holds the size and location of each stored sampler state table
+    std::unordered_multimap<uint64_t, std::pair<size_t, SurfaceStateInHeapInfo>> samplerStatesInHeap;
+    GraphicsAllocation *samplerStatesHeapAllocation = nullptr;
     std::mutex mtx;
 };
 } // namespace NEO
\ No newline at end of file
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,8 @@
 
 #include "shared/source/helpers/blit_commands_helper.h"
 
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/string.h"
 #include "shared/source/helpers/timestamp_packet.h"
 #include "shared/source/memory_manager/surface.h"
 
@@ -109,6 +111,22 @@ BlitProperties BlitProperties::constructPropertiesForCopyBuffer(GraphicsAllocati
         srcSlicePitch};                                  // srcSlicePitch
 }
 
+BlitProperties BlitProperties::constructPropertiesForColorFill(GraphicsAllocation *dstAllocation, uint64_t dstGpuAddress,
+                                                               const uint32_t (&fillPattern)[4], size_t fillPatternSize, size_t size,
+                                                               GraphicsAllocation *clearColorAllocation) {
+    BlitProperties blitProperties{};
+    blitProperties.blitDirection = BlitterConstants::BlitDirection::PatternToBuffer;
+    blitProperties.dstAllocation = dstAllocation;
+    blitProperties.srcAllocation = dstAllocation;
+    blitProperties.clearColorAllocation = clearColorAllocation;
+    blitProperties.dstGpuAddress = dstGpuAddress;
+    blitProperties.copySize = {size / fillPatternSize, 1, 1};
+    blitProperties.bytesPerPixel = fillPatternSize;
+    blitProperties.fillPatternSize = fillPatternSize;
+    memcpy_s(blitProperties.fillPattern, sizeof(blitProperties.fillPattern), fillPattern, sizeof(fillPattern));
+    return blitProperties;
+}
+
 BlitProperties BlitProperties::constructPropertiesForAuxTranslation(AuxTranslationDirection auxTranslationDirection,
                                                                     GraphicsAllocation *allocation, GraphicsAllocation *clearColorAllocation) {
 
@@ -132,11 +150,15 @@ BlitProperties BlitProperties::constructPropertiesForAuxTranslation(AuxTranslati
 void BlitProperties::setupDependenciesForAuxTranslation(BlitPropertiesContainer &blitPropertiesContainer, TimestampPacketDependencies &timestampPacketDependencies,
                                                         TimestampPacketContainer &kernelTimestamps, const CsrDependencies &depsFromEvents,
                                                         CommandStreamReceiver &gpguCsr, CommandStreamReceiver &bcsCsr) {
-    auto numObjects = blitPropertiesContainer.size() / 2;
+    auto numAuxToNonAux = timestampPacketDependencies.auxToNonAuxNodes.peekNodes().size();
+    auto numNonAuxToAux = timestampPacketDependencies.nonAuxToAuxNodes.peekNodes().size();
+    DEBUG_BREAK_IF(numAuxToNonAux + numNonAuxToAux != blitPropertiesContainer.size());
 
-    for (size_t i = 0; i < numObjects; i++) {
+    for (size_t i = 0; i < numAuxToNonAux; i++) {
         blitPropertiesContainer[i].outputTimestampPacket = timestampPacketDependencies.auxToNonAuxNodes.peekNodes()[i];
-        blitPropertiesContainer[i + numObjects].outputTimestampPacket = timestampPacketDependencies.nonAuxToAuxNodes.peekNodes()[i];
+    }
+    for (size_t i = 0; i < numNonAuxToAux; i++) {
+        blitPropertiesContainer[i + numAuxToNonAux].outputTimestampPacket = timestampPacketDependencies.nonAuxToAuxNodes.peekNodes()[i];
     }
 
     gpguCsr.requestStallingPipeControlOnNextFlush();
@@ -150,9 +172,40 @@ void BlitProperties::setupDependenciesForAuxTranslation(BlitPropertiesContainer
         blitPropertiesContainer[0].csrDependencies.push_back(dep);
     }
 
-    // wait for NDR before NonAuxToAux
-    blitPropertiesContainer[numObjects].csrDependencies.push_back(&timestampPacketDependencies.cacheFlushNodes);
-    blitPropertiesContainer[numObjects].csrDependencies.push_back(&kernelTimestamps);
+    // wait for NDR before NonAuxToAux, translations of already resolved allocations may be skipped in either direction
+    if (numNonAuxToAux > 0) {
+        blitPropertiesContainer[numAuxToNonAux].csrDependencies.push_back(&timestampPacketDependencies.cacheFlushNodes);
+        blitPropertiesContainer[numAuxToNonAux].csrDependencies.push_back(&kernelTimestamps);
+    }
+}
+
+size_t BlitHelper::narrowFillPattern(uint32_t (&colorFillPattern)[4], const void *pattern, size_t patternSize, size_t maxColorFillPatternSize) {
+    if (!Math::isPow2(patternSize)) {
+        return 0;
+    }
+
+    // a pattern wider than the widest color depth still fits when it is made of repeated halves
+    auto patternBytes = reinterpret_cast<const uint8_t *>(pattern);
+    while (patternSize > maxColorFillPatternSize) {
+        patternSize /= 2;
+        if (memcmp(patternBytes, patternBytes + patternSize, patternSize) != 0) {
+            return 0;
+        }
+    }
+
+    memset(colorFillPattern, 0, sizeof(colorFillPattern));
+    memcpy_s(colorFillPattern, sizeof(colorFillPattern), pattern, patternSize);
+    return patternSize;
+}
+
+size_t BlitHelper::widenFillPattern(uint32_t (&colorFillPattern)[4], size_t patternSize, uint64_t dstGpuAddress, size_t size, size_t maxColorFillPatternSize) {
+    // replicating a narrow pattern up to the widest color depth allowed by the destination alignment means fewer pixels to fill
+    auto colorBytes = reinterpret_cast<uint8_t *>(colorFillPattern);
+    while (patternSize * 2 <= maxColorFillPatternSize && size % (patternSize * 2) == 0 && dstGpuAddress % (patternSize * 2) == 0) {
+        memcpy_s(colorBytes + patternSize, sizeof(colorFillPattern) - patternSize, colorBytes, patternSize);
+        patternSize *= 2;
+    }
+    return patternSize;
 }
 
 } // namespace NEO
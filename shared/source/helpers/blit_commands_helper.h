@@ -53,6 +53,10 @@ struct BlitProperties {
                                                            size_t srcRowPitch, size_t srcSlicePitch,
                                                            size_t dstRowPitch, size_t dstSlicePitch, GraphicsAllocation *clearColorAllocation);
 
+    static BlitProperties constructPropertiesForColorFill(GraphicsAllocation *dstAllocation, uint64_t dstGpuAddress,
+                                                          const uint32_t (&fillPattern)[4], size_t fillPatternSize, size_t size,
+                                                          GraphicsAllocation *clearColorAllocation);
+
     static BlitProperties constructPropertiesForAuxTranslation(AuxTranslationDirection auxTranslationDirection,
                                                                GraphicsAllocation *allocation, GraphicsAllocation *clearColorAllocation);
 
@@ -82,6 +86,8 @@ struct BlitProperties {
     size_t bytesPerPixel = 0;
     Vec3<uint32_t> dstSize = 0;
     Vec3<uint32_t> srcSize = 0;
+    uint32_t fillPattern[4] = {};
+    size_t fillPatternSize = 0;
 };
 
 enum class BlitOperationResult {
@@ -107,6 +113,8 @@ struct BlitHelper {
                                                            Vec3<size_t> size, DeviceBitfield memoryBanks);
     static BlitOperationResult blitAllocationToMemory(const Device &device, GraphicsAllocation *memory, size_t offset, const void *hostPtr,
                                                       Vec3<size_t> size);
+    static size_t narrowFillPattern(uint32_t (&colorFillPattern)[4], const void *pattern, size_t patternSize, size_t maxColorFillPatternSize);
+    static size_t widenFillPattern(uint32_t (&colorFillPattern)[4], size_t patternSize, uint64_t dstGpuAddress, size_t size, size_t maxColorFillPatternSize);
 };
 
 template <typename GfxFamily>
@@ -122,10 +130,14 @@ struct BlitCommandsHelper {
     static size_t estimatePostBlitCommandSize();
     static size_t estimateBlitCommandsSize(const Vec3<size_t> &copySize, const CsrDependencies &csrDependencies, bool updateTimestampPacket,
                                            bool profilingEnabled, const RootDeviceEnvironment &rootDeviceEnvironment);
+    static size_t estimateBlitCommandsSizeForBlits(size_t numberOfBlits, const CsrDependencies &csrDependencies, bool updateTimestampPacket, bool profilingEnabled);
     static size_t estimateBlitCommandsSize(const BlitPropertiesContainer &blitPropertiesContainer, bool profilingEnabled,
                                            bool debugPauseEnabled, bool blitterDirectSubmission, const RootDeviceEnvironment &rootDeviceEnvironment);
     static size_t getNumberOfBlitsForCopyRegion(const Vec3<size_t> &copySize, const RootDeviceEnvironment &rootDeviceEnvironment);
     static size_t getNumberOfBlitsForCopyPerRow(const Vec3<size_t> &copySize, const RootDeviceEnvironment &rootDeviceEnvironment);
+    static size_t getNumberOfBlits(const BlitProperties &blitProperties, const RootDeviceEnvironment &rootDeviceEnvironment);
+    static Vec3<size_t> getCopySizeForBufferPerRow(const BlitProperties &blitProperties);
+    static Vec3<size_t> getCopySizeForBufferRegion(const BlitProperties &blitProperties);
     static uint64_t calculateBlitCommandDestinationBaseAddress(const BlitProperties &blitProperties, uint64_t offset, uint64_t row, uint64_t slice);
     static uint64_t calculateBlitCommandSourceBaseAddress(const BlitProperties &blitProperties, uint64_t offset, uint64_t row, uint64_t slice);
     static uint64_t calculateBlitCommandDestinationBaseAddressCopyRegion(const BlitProperties &blitProperties, size_t slice);
@@ -134,9 +146,9 @@ struct BlitCommandsHelper {
     static void dispatchBlitCommandsForBufferRegion(const BlitProperties &blitProperties, LinearStream &linearStream, const RootDeviceEnvironment &rootDeviceEnvironment);
     static void dispatchBlitCommandsForBufferPerRow(const BlitProperties &blitProperties, LinearStream &linearStream, const RootDeviceEnvironment &rootDeviceEnvironment);
     static void dispatchBlitCommandsRegion(const BlitProperties &blitProperties, LinearStream &linearStream, const RootDeviceEnvironment &rootDeviceEnvironment);
-    static void dispatchBlitMemoryColorFill(NEO::GraphicsAllocation *dstAlloc, uint32_t *pattern, size_t patternSize, LinearStream &linearStream, size_t size, const RootDeviceEnvironment &rootDeviceEnvironment);
+    static void dispatchBlitMemoryColorFill(NEO::GraphicsAllocation *dstAlloc, uint64_t dstGpuAddress, const uint32_t *pattern, size_t patternSize, LinearStream &linearStream, size_t size, const RootDeviceEnvironment &rootDeviceEnvironment);
     template <size_t patternSize>
-    static void dispatchBlitMemoryFill(NEO::GraphicsAllocation *dstAlloc, uint32_t *pattern, LinearStream &linearStream, size_t size, const RootDeviceEnvironment &rootDeviceEnvironment, COLOR_DEPTH depth);
+    static void dispatchBlitMemoryFill(NEO::GraphicsAllocation *dstAlloc, uint64_t dstGpuAddress, const uint32_t *pattern, LinearStream &linearStream, size_t size, const RootDeviceEnvironment &rootDeviceEnvironment, COLOR_DEPTH depth);
     static void appendBlitCommandsForBuffer(const BlitProperties &blitProperties, typename GfxFamily::XY_COPY_BLT &blitCmd, const RootDeviceEnvironment &rootDeviceEnvironment);
     static void appendBlitCommandsForImages(const BlitProperties &blitProperties, typename GfxFamily::XY_COPY_BLT &blitCmd, const RootDeviceEnvironment &rootDeviceEnvironment, uint32_t &srcSlicePitch, uint32_t &dstSlicePitch);
     static void appendExtraMemoryProperties(typename GfxFamily::XY_COPY_BLT &blitCmd, const RootDeviceEnvironment &rootDeviceEnvironment);
@@ -153,6 +165,7 @@ struct BlitCommandsHelper {
     static bool useOneBlitCopyCommand(Vec3<size_t> copySize, uint32_t bytesPerPixel);
     static uint32_t getAvailableBytesPerPixel(size_t copySize, uint32_t srcOrigin, uint32_t dstOrigin, uint32_t srcSize, uint32_t dstSize);
     static bool isCopyRegionPreferred(const Vec3<size_t> &copySize, const RootDeviceEnvironment &rootDeviceEnvironment);
+    static bool isCopyRegionPreferred(const BlitProperties &blitProperties, const RootDeviceEnvironment &rootDeviceEnvironment);
     static void programGlobalSequencerFlush(LinearStream &commandStream);
     static size_t getSizeForGlobalSequencerFlush();
     static bool miArbCheckWaRequired();
@@ -102,6 +102,16 @@ template <typename GfxFamily>
 size_t BlitCommandsHelper<GfxFamily>::estimateBlitCommandsSize(const Vec3<size_t> &copySize, const CsrDependencies &csrDependencies,
                                                                bool updateTimestampPacket, bool profilingEnabled,
                                                                const RootDeviceEnvironment &rootDeviceEnvironment) {
+    bool preferRegionCopy = isCopyRegionPreferred(copySize, rootDeviceEnvironment);
+    auto nBlits = preferRegionCopy ? getNumberOfBlitsForCopyRegion(copySize, rootDeviceEnvironment)
+                                   : getNumberOfBlitsForCopyPerRow(copySize, rootDeviceEnvironment);
+
+    return estimateBlitCommandsSizeForBlits(nBlits, csrDependencies, updateTimestampPacket, profilingEnabled);
+}
+
+template <typename GfxFamily>
+size_t BlitCommandsHelper<GfxFamily>::estimateBlitCommandsSizeForBlits(size_t numberOfBlits, const CsrDependencies &csrDependencies,
+                                                                       bool updateTimestampPacket, bool profilingEnabled) {
     size_t timestampCmdSize = 0;
     if (updateTimestampPacket) {
         timestampCmdSize += EncodeMiFlushDW<GfxFamily>::getMiFlushDwCmdSizeForDataWrite();
@@ -110,13 +120,9 @@ size_t BlitCommandsHelper<GfxFamily>::estimateBlitCommandsSize(const Vec3<size_t
         }
     }
 
-    bool preferRegionCopy = isCopyRegionPreferred(copySize, rootDeviceEnvironment);
-    auto nBlits = preferRegionCopy ? getNumberOfBlitsForCopyRegion(copySize, rootDeviceEnvironment)
-                                   : getNumberOfBlitsForCopyPerRow(copySize, rootDeviceEnvironment);
-
     auto sizePerBlit = (sizeof(typename GfxFamily::XY_COPY_BLT) + estimatePostBlitCommandSize());
 
-    return TimestampPacketHelper::getRequiredCmdStreamSize<GfxFamily>(csrDependencies) + (sizePerBlit * nBlits) + timestampCmdSize + estimatePreBlitCommandSize();
+    return TimestampPacketHelper::getRequiredCmdStreamSize<GfxFamily>(csrDependencies) + (sizePerBlit * numberOfBlits) + timestampCmdSize + estimatePreBlitCommandSize();
 }
 
 template <typename GfxFamily>
@@ -125,9 +131,16 @@ size_t BlitCommandsHelper<GfxFamily>::estimateBlitCommandsSize(const BlitPropert
                                                                bool blitterDirectSubmission, const RootDeviceEnvironment &rootDeviceEnvironment) {
     size_t size = 0;
     for (auto &blitProperties : blitPropertiesContainer) {
-        size += BlitCommandsHelper<GfxFamily>::estimateBlitCommandsSize(blitProperties.copySize, blitProperties.csrDependencies,
-                                                                        blitProperties.outputTimestampPacket != nullptr, profilingEnabled,
-                                                                        rootDeviceEnvironment);
+        bool updateTimestampPacket = blitProperties.outputTimestampPacket != nullptr;
+        if (blitProperties.blitDirection == BlitterConstants::BlitDirection::PatternToBuffer) {
+            // color fill rows are limited in bytes, the same way as per row copies
+            Vec3<size_t> fillSize = {blitProperties.copySize.x * blitProperties.fillPatternSize, 1, 1};
+            size += estimateBlitCommandsSizeForBlits(0u, blitProperties.csrDependencies, updateTimestampPacket, profilingEnabled);
+            size += getNumberOfBlitsForCopyPerRow(fillSize, rootDeviceEnvironment) * sizeof(typename GfxFamily::XY_COLOR_BLT);
+        } else {
+            size += estimateBlitCommandsSizeForBlits(getNumberOfBlits(blitProperties, rootDeviceEnvironment), blitProperties.csrDependencies,
+                                                     updateTimestampPacket, profilingEnabled);
+        }
     }
     size += MemorySynchronizationCommands<GfxFamily>::getSizeForAdditonalSynchronization(*rootDeviceEnvironment.getHardwareInfo());
     size += EncodeMiFlushDW<GfxFamily>::getMiFlushDwCmdSizeForDataWrite();
@@ -174,10 +187,11 @@ void BlitCommandsHelper<GfxFamily>::dispatchBlitCommandsForBufferPerRow(const Bl
 
     dispatchPreBlitCommand(linearStream);
 
-    for (uint64_t slice = 0; slice < blitProperties.copySize.z; slice++) {
-        for (uint64_t row = 0; row < blitProperties.copySize.y; row++) {
+    auto copySize = getCopySizeForBufferPerRow(blitProperties);
+    for (uint64_t slice = 0; slice < copySize.z; slice++) {
+        for (uint64_t row = 0; row < copySize.y; row++) {
             uint64_t offset = 0;
-            uint64_t sizeToBlit = blitProperties.copySize.x;
+            uint64_t sizeToBlit = copySize.x;
             while (sizeToBlit != 0) {
                 if (sizeToBlit > getMaxBlitWidth(rootDeviceEnvironment)) {
                     // dispatch 2D blit: maxBlitWidth x (1 .. maxBlitHeight)
@@ -224,25 +238,27 @@ void BlitCommandsHelper<GfxFamily>::dispatchBlitCommandsForBufferPerRow(const Bl
 
 template <typename GfxFamily>
 template <size_t patternSize>
-void BlitCommandsHelper<GfxFamily>::dispatchBlitMemoryFill(NEO::GraphicsAllocation *dstAlloc, uint32_t *pattern, LinearStream &linearStream, size_t size, const RootDeviceEnvironment &rootDeviceEnvironment, COLOR_DEPTH depth) {
+void BlitCommandsHelper<GfxFamily>::dispatchBlitMemoryFill(NEO::GraphicsAllocation *dstAlloc, uint64_t dstGpuAddress, const uint32_t *pattern, LinearStream &linearStream, size_t size, const RootDeviceEnvironment &rootDeviceEnvironment, COLOR_DEPTH depth) {
     using XY_COLOR_BLT = typename GfxFamily::XY_COLOR_BLT;
     auto blitCmd = GfxFamily::cmdInitXyColorBlt;
 
     blitCmd.setFillColor(pattern);
     blitCmd.setColorDepth(depth);
 
+    // the destination pitch is in bytes, so wide patterns get proportionally fewer pixels per row
+    uint64_t maxWidth = getMaxBlitWidth(rootDeviceEnvironment) / patternSize;
     uint64_t offset = 0;
     uint64_t sizeToFill = size / patternSize;
     while (sizeToFill != 0) {
         auto tmpCmd = blitCmd;
-        tmpCmd.setDestinationBaseAddress(ptrOffset(dstAlloc->getGpuAddress(), static_cast<size_t>(offset)));
+        tmpCmd.setDestinationBaseAddress(ptrOffset(dstGpuAddress, static_cast<size_t>(offset)));
         uint64_t height = 0;
         uint64_t width = 0;
-        if (sizeToFill <= getMaxBlitWidth(rootDeviceEnvironment)) {
+        if (sizeToFill <= maxWidth) {
             width = sizeToFill;
             height = 1;
         } else {
-            width = getMaxBlitWidth(rootDeviceEnvironment);
+            width = maxWidth;
             height = std::min((sizeToFill / width), getMaxBlitHeight(rootDeviceEnvironment));
             if (height > 1) {
                 appendTilingEnable(tmpCmd);
@@ -250,7 +266,7 @@ void BlitCommandsHelper<GfxFamily>::dispatchBlitMemoryFill(NEO::GraphicsAllocati
         }
         tmpCmd.setTransferWidth(static_cast<uint32_t>(width));
         tmpCmd.setTransferHeight(static_cast<uint32_t>(height));
-        tmpCmd.setDestinationPitch(static_cast<uint32_t>(width));
+        tmpCmd.setDestinationPitch(static_cast<uint32_t>(width * patternSize));
 
         appendBlitCommandsForFillBuffer(dstAlloc, tmpCmd, rootDeviceEnvironment);
 
@@ -331,12 +347,21 @@ template <typename GfxFamily>
 void BlitCommandsHelper<GfxFamily>::dispatchBlitCommands(const BlitProperties &blitProperties, LinearStream &linearStream, const RootDeviceEnvironment &rootDeviceEnvironment) {
 
     if (blitProperties.blitDirection == BlitterConstants::BlitDirection::HostPtrToImage ||
-        blitProperties.blitDirection == BlitterConstants::BlitDirection::ImageToHostPtr) {
+        blitProperties.blitDirection == BlitterConstants::BlitDirection::ImageToHostPtr ||
+        blitProperties.blitDirection == BlitterConstants::BlitDirection::ImageToImage ||
+        blitProperties.blitDirection == BlitterConstants::BlitDirection::BufferToImage ||
+        blitProperties.blitDirection == BlitterConstants::BlitDirection::ImageToBuffer) {
         dispatchBlitCommandsRegion(blitProperties, linearStream, rootDeviceEnvironment);
         return;
     }
 
-    bool preferCopyBufferRegion = isCopyRegionPreferred(blitProperties.copySize, rootDeviceEnvironment);
+    if (blitProperties.blitDirection == BlitterConstants::BlitDirection::PatternToBuffer) {
+        dispatchBlitMemoryColorFill(blitProperties.dstAllocation, blitProperties.dstGpuAddress, blitProperties.fillPattern, blitProperties.fillPatternSize,
+                                    linearStream, blitProperties.copySize.x * blitProperties.fillPatternSize, rootDeviceEnvironment);
+        return;
+    }
+
+    bool preferCopyBufferRegion = isCopyRegionPreferred(blitProperties, rootDeviceEnvironment);
     preferCopyBufferRegion ? dispatchBlitCommandsForBufferRegion(blitProperties, linearStream, rootDeviceEnvironment)
                            : dispatchBlitCommandsForBufferPerRow(blitProperties, linearStream, rootDeviceEnvironment);
 }
@@ -362,14 +387,15 @@ void BlitCommandsHelper<GfxFamily>::dispatchBlitCommandsForBufferRegion(const Bl
 
     dispatchPreBlitCommand(linearStream);
 
-    for (size_t slice = 0u; slice < blitProperties.copySize.z; ++slice) {
+    auto copySize = getCopySizeForBufferRegion(blitProperties);
+    for (size_t slice = 0u; slice < copySize.z; ++slice) {
         auto srcAddress = calculateBlitCommandSourceBaseAddressCopyRegion(blitProperties, slice);
         auto dstAddress = calculateBlitCommandDestinationBaseAddressCopyRegion(blitProperties, slice);
-        auto heightToCopy = blitProperties.copySize.y;
+        auto heightToCopy = copySize.y;
 
         while (heightToCopy > 0) {
             auto height = static_cast<uint32_t>(std::min(heightToCopy, static_cast<size_t>(maxHeightToCopy)));
-            auto widthToCopy = blitProperties.copySize.x;
+            auto widthToCopy = copySize.x;
 
             while (widthToCopy > 0) {
                 auto width = static_cast<uint32_t>(std::min(widthToCopy, static_cast<size_t>(maxWidthToCopy)));
@@ -394,9 +420,9 @@ void BlitCommandsHelper<GfxFamily>::dispatchBlitCommandsForBufferRegion(const Bl
             }
 
             heightToCopy -= height;
-            srcAddress += (blitProperties.srcRowPitch - blitProperties.copySize.x);
+            srcAddress += (blitProperties.srcRowPitch - copySize.x);
             srcAddress += (blitProperties.srcRowPitch * (height - 1));
-            dstAddress += (blitProperties.dstRowPitch - blitProperties.copySize.x);
+            dstAddress += (blitProperties.dstRowPitch - copySize.x);
             dstAddress += (blitProperties.dstRowPitch * (height - 1));
         }
     }
@@ -408,6 +434,54 @@ bool BlitCommandsHelper<GfxFamily>::isCopyRegionPreferred(const Vec3<size_t> &co
     return preferCopyRegion;
 }
 
+template <typename GfxFamily>
+bool BlitCommandsHelper<GfxFamily>::isCopyRegionPreferred(const BlitProperties &blitProperties, const RootDeviceEnvironment &rootDeviceEnvironment) {
+    return getNumberOfBlitsForCopyRegion(getCopySizeForBufferRegion(blitProperties), rootDeviceEnvironment) <
+           getNumberOfBlitsForCopyPerRow(getCopySizeForBufferPerRow(blitProperties), rootDeviceEnvironment);
+}
+
+template <typename GfxFamily>
+Vec3<size_t> BlitCommandsHelper<GfxFamily>::getCopySizeForBufferPerRow(const BlitProperties &blitProperties) {
+    // rows and slices packed back to back on both sides form one linear range,
+    // which is cut into maximal 2D blits instead of one or more blits per row
+    auto &copySize = blitProperties.copySize;
+    if (copySize.y > 1 && (blitProperties.srcRowPitch != copySize.x || blitProperties.dstRowPitch != copySize.x)) {
+        return copySize;
+    }
+
+    auto sliceSize = copySize.x * copySize.y;
+    if (copySize.z > 1 && (blitProperties.srcSlicePitch != sliceSize || blitProperties.dstSlicePitch != sliceSize)) {
+        return {sliceSize, 1, copySize.z};
+    }
+    return {sliceSize * copySize.z, 1, 1};
+}
+
+template <typename GfxFamily>
+Vec3<size_t> BlitCommandsHelper<GfxFamily>::getCopySizeForBufferRegion(const BlitProperties &blitProperties) {
+    // slices without padding between them continue the row pattern, so they are copied as one taller region
+    auto &copySize = blitProperties.copySize;
+    if (copySize.z > 1 &&
+        blitProperties.srcSlicePitch == blitProperties.srcRowPitch * copySize.y &&
+        blitProperties.dstSlicePitch == blitProperties.dstRowPitch * copySize.y) {
+        return {copySize.x, copySize.y * copySize.z, 1};
+    }
+    return copySize;
+}
+
+template <typename GfxFamily>
+size_t BlitCommandsHelper<GfxFamily>::getNumberOfBlits(const BlitProperties &blitProperties, const RootDeviceEnvironment &rootDeviceEnvironment) {
+    if (blitProperties.blitDirection == BlitterConstants::BlitDirection::HostPtrToImage ||
+        blitProperties.blitDirection == BlitterConstants::BlitDirection::ImageToHostPtr ||
+        blitProperties.blitDirection == BlitterConstants::BlitDirection::ImageToImage ||
+        blitProperties.blitDirection == BlitterConstants::BlitDirection::BufferToImage ||
+        blitProperties.blitDirection == BlitterConstants::BlitDirection::ImageToBuffer) {
+        return blitProperties.copySize.z;
+    }
+
+    return std::min(getNumberOfBlitsForCopyRegion(getCopySizeForBufferRegion(blitProperties), rootDeviceEnvironment),
+                    getNumberOfBlitsForCopyPerRow(getCopySizeForBufferPerRow(blitProperties), rootDeviceEnvironment));
+}
+
 template <typename GfxFamily>
 size_t BlitCommandsHelper<GfxFamily>::getNumberOfBlitsForCopyRegion(const Vec3<size_t> &copySize, const RootDeviceEnvironment &rootDeviceEnvironment) {
     auto maxWidthToCopy = getMaxBlitWidth(rootDeviceEnvironment);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,5 +10,6 @@
 namespace NEO {
 
 const uint32_t CompletionStamp::notReady = 0xFFFFFFF0;
+const uint32_t CompletionStamp::failed = 0xFFFFFFFE;
 
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -17,6 +17,7 @@ struct CompletionStamp {
     FlushStamp flushStamp;
 
     static const uint32_t notReady;
+    static const uint32_t failed;
 };
 
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -18,7 +18,8 @@ struct HardwareInfo;
 enum class EngineUsage : uint32_t {
     Regular,
     LowPriority,
-    Internal
+    Internal,
+    HighPriority
 };
 
 using EngineTypeUsage = std::pair<aub_stream::EngineType, EngineUsage>;
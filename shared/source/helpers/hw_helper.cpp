@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -55,6 +55,15 @@ uint32_t HwHelper::getMaxThreadsForVfe(const HardwareInfo &hwInfo) {
     return maxHwThreadsReturned;
 }
 
+uint64_t HwHelper::getSliceCountForThreadGroups(const HardwareInfo &hwInfo, uint64_t threadGroupCount) {
+    uint64_t sliceCount = std::max(hwInfo.gtSystemInfo.SliceCount, 1u);
+    // dispatches that fit on the subslices of a single slice leave the remaining slices idle
+    if (threadGroupCount <= hwInfo.gtSystemInfo.SubSliceCount / sliceCount) {
+        return 1u;
+    }
+    return sliceCount;
+}
+
 uint32_t HwHelper::getMaxThreadsForWorkgroup(const HardwareInfo &hwInfo, uint32_t maxNumEUsPerSubSlice) const {
     uint32_t numThreadsPerEU = hwInfo.gtSystemInfo.ThreadCount / hwInfo.gtSystemInfo.EUCount;
     return maxNumEUsPerSubSlice * numThreadsPerEU;
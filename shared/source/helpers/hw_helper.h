@@ -14,6 +14,7 @@
 #include "shared/source/helpers/aux_translation.h"
 #include "shared/source/helpers/engine_node_helper.h"
 #include "shared/source/utilities/stackvec.h"
+#include "shared/source/utilities/tiled_memcpy.h"
 
 #include "engine_group_types.h"
 #include "hw_cmds.h"
@@ -126,12 +127,14 @@ class HwHelper {
     virtual bool packedFormatsSupported() const = 0;
     virtual bool isCooperativeDispatchSupported(const aub_stream::EngineType engine, const PRODUCT_FAMILY productFamily) const = 0;
     virtual size_t getMaxFillPaternSizeForCopyEngine() const = 0;
+    virtual size_t getBuiltinCopyFillBlockSize(const HardwareInfo &hwInfo) const = 0;
     virtual bool isMediaBlockIOSupported(const HardwareInfo &hwInfo) const = 0;
     virtual bool isCopyOnlyEngineType(EngineGroupType type) const = 0;
     virtual void adjustAddressWidthForCanonize(uint32_t &addressWidth) const = 0;
     virtual bool isSipWANeeded(const HardwareInfo &hwInfo) const = 0;
     virtual bool additionalKernelExecInfoSupported(const HardwareInfo &hwInfo) const = 0;
     virtual bool isCpuImageTransferPreferred(const HardwareInfo &hwInfo) const = 0;
+    virtual TileLayout getTileLayoutForCpuAccess(uint32_t tileModeSurfaceState) const = 0;
     virtual bool isKmdMigrationSupported(const HardwareInfo &hwInfo) const = 0;
     virtual bool isNewResidencyModelSupported() const = 0;
     virtual aub_stream::MMIOList getExtraMmioList(const HardwareInfo &hwInfo, const GmmHelper &gmmHelper) const = 0;
@@ -142,6 +145,7 @@ class HwHelper {
     static uint32_t getSubDevicesCount(const HardwareInfo *pHwInfo);
     static uint32_t getEnginesCount(const HardwareInfo &hwInfo);
     static uint32_t getCopyEnginesCount(const HardwareInfo &hwInfo);
+    static uint64_t getSliceCountForThreadGroups(const HardwareInfo &hwInfo, uint64_t threadGroupCount);
 
   protected:
     virtual LocalMemoryAccessMode getDefaultLocalMemoryAccessMode(const HardwareInfo &hwInfo) const = 0;
@@ -329,6 +333,8 @@ class HwHelperHw : public HwHelper {
 
     size_t getMaxFillPaternSizeForCopyEngine() const override;
 
+    size_t getBuiltinCopyFillBlockSize(const HardwareInfo &hwInfo) const override;
+
     bool isMediaBlockIOSupported(const HardwareInfo &hwInfo) const override;
 
     bool isKmdMigrationSupported(const HardwareInfo &hwInfo) const override;
@@ -345,6 +351,8 @@ class HwHelperHw : public HwHelper {
 
     bool isCpuImageTransferPreferred(const HardwareInfo &hwInfo) const override;
 
+    TileLayout getTileLayoutForCpuAccess(uint32_t tileModeSurfaceState) const override;
+
     aub_stream::MMIOList getExtraMmioList(const HardwareInfo &hwInfo, const GmmHelper &gmmHelper) const override;
 
     uint32_t getDefaultRevisionId(const HardwareInfo &hwInfo) const override;
@@ -530,6 +530,15 @@ bool HwHelperHw<GfxFamily>::isCpuImageTransferPreferred(const HardwareInfo &hwIn
     return false;
 }
 
+template <typename GfxFamily>
+TileLayout HwHelperHw<GfxFamily>::getTileLayoutForCpuAccess(uint32_t tileModeSurfaceState) const {
+    using RENDER_SURFACE_STATE = typename GfxFamily::RENDER_SURFACE_STATE;
+    if (tileModeSurfaceState == RENDER_SURFACE_STATE::TILE_MODE_YMAJOR) {
+        return TileLayout::TileY;
+    }
+    return TileLayout::Linear;
+}
+
 template <typename GfxFamily>
 bool MemorySynchronizationCommands<GfxFamily>::isPipeControlPriorToPipelineSelectWArequired(const HardwareInfo &hwInfo) {
     return false;
@@ -540,6 +549,14 @@ bool HwHelperHw<GfxFamily>::isCooperativeDispatchSupported(const aub_stream::Eng
     return true;
 }
 
+template <typename GfxFamily>
+size_t HwHelperHw<GfxFamily>::getBuiltinCopyFillBlockSize(const HardwareInfo &hwInfo) const {
+    if (DebugManager.flags.OverrideBuiltinCopyFillBlockSize.get() != -1) {
+        return static_cast<size_t>(DebugManager.flags.OverrideBuiltinCopyFillBlockSize.get());
+    }
+    return MemoryConstants::cacheLineSize;
+}
+
 template <typename GfxFamily>
 bool HwHelperHw<GfxFamily>::isMediaBlockIOSupported(const HardwareInfo &hwInfo) const {
     return hwInfo.capabilityTable.supportsImages;
@@ -57,11 +57,17 @@ bool HwHelperHw<Family>::obtainBlitterPreference(const HardwareInfo &hwInfo) con
 
 template <typename GfxFamily>
 const HwHelper::EngineInstancesContainer HwHelperHw<GfxFamily>::getGpgpuEngineInstances(const HardwareInfo &hwInfo) const {
-    return {
+    EngineInstancesContainer engines = {
         {aub_stream::ENGINE_RCS, EngineUsage::Regular},
         {aub_stream::ENGINE_RCS, EngineUsage::LowPriority},
         {aub_stream::ENGINE_RCS, EngineUsage::Internal},
     };
+
+    if (DebugManager.flags.EnableHighPriorityEngine.get() == 1) {
+        engines.push_back({aub_stream::ENGINE_RCS, EngineUsage::HighPriority});
+    }
+
+    return engines;
 }
 
 template <typename GfxFamily>
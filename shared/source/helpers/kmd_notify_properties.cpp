@@ -9,6 +9,7 @@
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
 
+#include <algorithm>
 #include <cstdint>
 
 using namespace NEO;
@@ -46,6 +47,7 @@ bool KmdNotifyHelper::obtainTimeoutParams(int64_t &timeoutValueOutput,
         timeoutValueOutput = properties->delayQuickKmdSleepMicroseconds;
     } else {
         timeoutValueOutput = getBaseTimeout(multiplier);
+        applyAdaptiveTimeout(timeoutValueOutput);
     }
 
     return (properties->enableKmdNotify || !acLineConnected);
@@ -61,6 +63,27 @@ bool KmdNotifyHelper::applyQuickKmdSleepForSporadicWait() const {
     return false;
 }
 
+void KmdNotifyHelper::applyAdaptiveTimeout(int64_t &timeoutValueOutput) const {
+    auto averageWaitDuration = averageWaitDurationUs.load();
+    if (DebugManager.flags.AdaptiveKmdNotifyDelay.get() != 1 || averageWaitDuration < 0) {
+        return;
+    }
+    // waits ending within twice the average are caught by polling, longer ones go to sleep early instead of spinning
+    auto spinWindow = 2 * averageWaitDuration;
+    auto adaptiveTimeout = (spinWindow <= timeoutValueOutput) ? spinWindow : 0;
+    timeoutValueOutput = std::min(timeoutValueOutput, std::max(adaptiveTimeout, properties->delayQuickKmdSleepMicroseconds));
+}
+
+void KmdNotifyHelper::updateAverageWaitDuration(int64_t waitDurationMicroseconds) {
+    // concurrent waits may drop a sample, which is fine for a moving average
+    auto averageWaitDuration = averageWaitDurationUs.load();
+    if (averageWaitDuration < 0) {
+        averageWaitDurationUs = waitDurationMicroseconds;
+        return;
+    }
+    averageWaitDurationUs = averageWaitDuration + (waitDurationMicroseconds - averageWaitDuration) / KmdNotifyConstants::averageWaitDurationWeight;
+}
+
 void KmdNotifyHelper::updateLastWaitForCompletionTimestamp() {
     lastWaitForCompletionTimestampUs = getMicrosecondsSinceEpoch();
 }
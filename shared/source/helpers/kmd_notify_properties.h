@@ -28,6 +28,7 @@ struct KmdNotifyProperties {
 namespace KmdNotifyConstants {
 constexpr int64_t timeoutInMicrosecondsForDisconnectedAcLine = 10000;
 constexpr uint32_t minimumTaskCountDiffToCheckAcLine = 10;
+constexpr int64_t averageWaitDurationWeight = 8;
 } // namespace KmdNotifyConstants
 
 class KmdNotifyHelper {
@@ -47,6 +48,8 @@ class KmdNotifyHelper {
     bool quickKmdSleepForSporadicWaitsEnabled() const { return properties->enableQuickKmdSleepForSporadicWaits; }
     MOCKABLE_VIRTUAL void updateLastWaitForCompletionTimestamp();
     MOCKABLE_VIRTUAL void updateAcLineStatus();
+    void updateAverageWaitDuration(int64_t waitDurationMicroseconds);
+    int64_t getAverageWaitDurationMicroseconds() const { return averageWaitDurationUs.load(); }
 
     static void overrideFromDebugVariable(int32_t debugVariableValue, int64_t &destination);
     static void overrideFromDebugVariable(int32_t debugVariableValue, bool &destination);
@@ -54,10 +57,13 @@ class KmdNotifyHelper {
   protected:
     bool applyQuickKmdSleepForSporadicWait() const;
     int64_t getBaseTimeout(const int64_t &multiplier) const;
+    void applyAdaptiveTimeout(int64_t &timeoutValueOutput) const;
     int64_t getMicrosecondsSinceEpoch() const;
 
     const KmdNotifyProperties *properties = nullptr;
     std::atomic<int64_t> lastWaitForCompletionTimestampUs{0};
     std::atomic<bool> acLineConnected{true};
+    // moving average of observed waits, negative until the first wait completes
+    std::atomic<int64_t> averageWaitDurationUs{-1};
 };
 } // namespace NEO
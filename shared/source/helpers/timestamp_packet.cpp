@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,28 +24,26 @@ TimestampPacketContainer::~TimestampPacketContainer() {
 }
 
 void TimestampPacketContainer::swapNodes(TimestampPacketContainer &timestampPacketContainer) {
-    timestampPacketNodes.swap(timestampPacketContainer.timestampPacketNodes);
+    std::swap(timestampPacketNodes, timestampPacketContainer.timestampPacketNodes);
 }
 
 void TimestampPacketContainer::resolveDependencies(bool clearAllDependencies) {
-    std::vector<Node *> pendingNodes;
+    size_t pendingNodesCount = 0;
 
     for (auto node : timestampPacketNodes) {
         if (node->canBeReleased() || clearAllDependencies) {
             node->returnTag();
         } else {
-            pendingNodes.push_back(node);
+            timestampPacketNodes[pendingNodesCount++] = node;
         }
     }
 
-    std::swap(timestampPacketNodes, pendingNodes);
+    timestampPacketNodes.resize(pendingNodesCount);
 }
 
 void TimestampPacketContainer::assignAndIncrementNodesRefCounts(const TimestampPacketContainer &inputTimestampPacketContainer) {
-    auto &inputNodes = inputTimestampPacketContainer.peekNodes();
-    std::copy(inputNodes.begin(), inputNodes.end(), std::back_inserter(timestampPacketNodes));
-
-    for (auto node : inputNodes) {
+    for (auto node : inputTimestampPacketContainer.peekNodes()) {
+        timestampPacketNodes.push_back(node);
         node->incRefCount();
     }
 }
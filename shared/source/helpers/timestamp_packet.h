@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,6 +12,7 @@
 #include "shared/source/helpers/aux_translation.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/utilities/stackvec.h"
 #include "shared/source/utilities/tag_allocator.h"
 
 #include "pipe_control_args.h"
@@ -89,7 +90,7 @@ class TimestampPacketContainer : public NonCopyableClass {
     TimestampPacketContainer &operator=(TimestampPacketContainer &&) = default;
     MOCKABLE_VIRTUAL ~TimestampPacketContainer();
 
-    const std::vector<Node *> &peekNodes() const { return timestampPacketNodes; }
+    const StackVec<Node *, 8> &peekNodes() const { return timestampPacketNodes; }
     void add(Node *timestampPacketNode);
     void swapNodes(TimestampPacketContainer &timestampPacketContainer);
     void assignAndIncrementNodesRefCounts(const TimestampPacketContainer &inputTimestampPacketContainer);
@@ -97,7 +98,7 @@ class TimestampPacketContainer : public NonCopyableClass {
     void makeResident(CommandStreamReceiver &commandStreamReceiver);
 
   protected:
-    std::vector<Node *> timestampPacketNodes;
+    StackVec<Node *, 8> timestampPacketNodes;
 };
 
 struct TimestampPacketDependencies : public NonCopyableClass {
@@ -106,6 +107,7 @@ struct TimestampPacketDependencies : public NonCopyableClass {
     TimestampPacketContainer barrierNodes;
     TimestampPacketContainer auxToNonAuxNodes;
     TimestampPacketContainer nonAuxToAuxNodes;
+    TimestampPacketContainer crossEngineNodes;
 };
 
 struct TimestampPacketHelper {
@@ -1,11 +1,12 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #pragma once
+#include <cstddef>
 #include <cstdint>
 
 namespace NEO {
@@ -18,6 +19,13 @@ enum class SlmPolicy {
     SlmPolicyLargeData
 };
 
+// kernel invariant fields of the interface descriptor, built by the encoder on the first dispatch
+struct InterfaceDescriptorTemplate {
+    static constexpr size_t maxSize = 64u;
+    alignas(8) uint8_t data[maxSize] = {};
+    bool valid = false;
+};
+
 struct DispatchKernelEncoderI {
     virtual ~DispatchKernelEncoderI() = default;
 
@@ -39,9 +47,12 @@ struct DispatchKernelEncoderI {
     virtual uint32_t getSurfaceStateHeapDataSize() const = 0;
 
     virtual GraphicsAllocation *getIsaAllocation() const = 0;
+    virtual uint64_t getIsaOffsetInParentAllocation() const = 0;
     virtual const uint8_t *getDynamicStateHeapData() const = 0;
 
     virtual uint32_t getRequiredWorkgroupOrder() const = 0;
     virtual bool requiresGenerationOfLocalIdsByRuntime() const = 0;
+
+    virtual InterfaceDescriptorTemplate *getInterfaceDescriptorTemplate() { return nullptr; }
 };
 } // namespace NEO
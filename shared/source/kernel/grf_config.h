@@ -11,5 +11,6 @@
 
 namespace GrfConfig {
 constexpr uint32_t DefaultGrfNumber = 128u;
+constexpr uint32_t LargeGrfNumber = 256u;
 constexpr uint32_t NotApplicable = 0u;
 } // namespace GrfConfig
@@ -26,7 +26,8 @@ struct AllocationProperties {
             uint32_t isUSMHostAllocation : 1;
             uint32_t isUSMDeviceAllocation : 1;
             uint32_t use32BitFrontWindow : 1;
-            uint32_t reserved : 20;
+            uint32_t preferSystemPlacement : 1;
+            uint32_t reserved : 19;
         } flags;
         uint32_t allFlags = 0;
     };
@@ -100,7 +101,8 @@ struct AllocationData {
             uint32_t resource48Bit : 1;
             uint32_t isUSMHostAllocation : 1;
             uint32_t use32BitFrontWindow : 1;
-            uint32_t reserved : 18;
+            uint32_t preferSystemPlacement : 1;
+            uint32_t reserved : 17;
         } flags;
         uint32_t allFlags = 0;
     };
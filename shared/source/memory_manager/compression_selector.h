@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,7 +9,30 @@
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 
+#include <atomic>
+
 namespace NEO {
+// How a compressed resource has been used. Stateful accesses benefit from compression,
+// every stateless access needs a resolve and a compression around the kernel and
+// every CPU access needs a resolve.
+struct CompressionUsageStatistics {
+    static constexpr uint64_t statelessAccessCost = 2u;
+    static constexpr uint64_t cpuAccessCost = 1u;
+
+    void add(const CompressionUsageStatistics &other) {
+        statefulAccesses += other.statefulAccesses.load();
+        statelessAccesses += other.statelessAccesses.load();
+        cpuAccesses += other.cpuAccesses.load();
+    }
+    bool isCompressionBeneficial() const {
+        return statefulAccesses.load() >= statelessAccessCost * statelessAccesses.load() + cpuAccessCost * cpuAccesses.load();
+    }
+
+    std::atomic<uint64_t> statefulAccesses{0u};
+    std::atomic<uint64_t> statelessAccesses{0u};
+    std::atomic<uint64_t> cpuAccesses{0u};
+};
+
 class CompressionSelector {
   public:
     static bool preferRenderCompressedBuffer(const AllocationProperties &properties);
@@ -8,6 +8,8 @@
 #include "shared/source/memory_manager/deferrable_allocation_deletion.h"
 
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/engine_control.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
@@ -39,4 +41,12 @@ bool DeferrableAllocationDeletion::apply() {
     memoryManager.freeGraphicsMemory(&graphicsAllocation);
     return true;
 }
+
+bool DeferrableAllocationDeletion::isHighPriority() const {
+    size_t highPrioritySize = MemoryConstants::pageSize2Mb;
+    if (DebugManager.flags.DeferredDeleterHighPriorityAllocationSize.get() != -1) {
+        highPrioritySize = static_cast<size_t>(DebugManager.flags.DeferredDeleterHighPriorityAllocationSize.get());
+    }
+    return graphicsAllocation.getUnderlyingBufferSize() >= highPrioritySize;
+}
 } // namespace NEO
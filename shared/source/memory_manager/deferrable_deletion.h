@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -14,5 +14,6 @@ class DeferrableDeletion : public IDNode<DeferrableDeletion> {
     template <typename... Args>
     static DeferrableDeletion *create(Args... args);
     virtual bool apply() = 0;
+    virtual bool isHighPriority() const { return false; }
 };
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,9 +7,13 @@
 
 #include "shared/source/memory_manager/deferred_deleter.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/memory_manager/deferrable_deletion.h"
 #include "shared/source/os_interface/os_thread.h"
 
+#include <chrono>
+#include <thread>
+
 namespace NEO {
 DeferredDeleter::DeferredDeleter() {
     doWorkInBackground = false;
@@ -18,6 +22,16 @@ DeferredDeleter::DeferredDeleter() {
 
 void DeferredDeleter::stop() {
     // Called with threadMutex acquired
+    if (!additionalWorkers.empty()) {
+        std::unique_lock<std::mutex> lock(queueMutex);
+        stopAdditionalWorkers = true;
+        lock.unlock();
+        condition.notify_all();
+        for (auto &additionalWorker : additionalWorkers) {
+            additionalWorker->join();
+        }
+        additionalWorkers.clear();
+    }
     if (worker != nullptr) {
         // Working thread was created so we can safely stop it
         std::unique_lock<std::mutex> lock(queueMutex);
@@ -50,7 +64,12 @@ DeferredDeleter::~DeferredDeleter() {
 void DeferredDeleter::deferDeletion(DeferrableDeletion *deletion) {
     std::unique_lock<std::mutex> lock(queueMutex);
     elementsToRelease++;
-    queue.pushTailOne(*deletion);
+    // large allocations are released first to return most memory early
+    if (deletion->isHighPriority()) {
+        queue.pushFrontOne(*deletion);
+    } else {
+        queue.pushTailOne(*deletion);
+    }
     lock.unlock();
     condition.notify_one();
 }
@@ -74,6 +93,12 @@ void DeferredDeleter::ensureThread() {
         return;
     }
     worker = Thread::create(run, reinterpret_cast<void *>(this));
+
+    // additional workers keep freeing while one waits for a busy command stream receiver
+    stopAdditionalWorkers = false;
+    for (int32_t workerId = 1; workerId < DebugManager.flags.DeferredDeleterWorkersCount.get(); workerId++) {
+        additionalWorkers.push_back(Thread::create(runAdditionalWorker, reinterpret_cast<void *>(this)));
+    }
 }
 
 bool DeferredDeleter::areElementsReleased() {
@@ -104,6 +129,31 @@ void *DeferredDeleter::run(void *arg) {
     return nullptr;
 }
 
+void *DeferredDeleter::runAdditionalWorker(void *arg) {
+    auto self = reinterpret_cast<DeferredDeleter *>(arg);
+    std::unique_lock<std::mutex> lock(self->queueMutex);
+    while (!self->stopAdditionalWorkers) {
+        auto deletion = self->queue.removeFrontOne();
+        if (!deletion) {
+            self->condition.wait(lock);
+            continue;
+        }
+        lock.unlock();
+        bool released = deletion->apply();
+        if (released) {
+            self->elementsToRelease--;
+        } else {
+            self->queue.pushTailOne(*deletion.release());
+        }
+        lock.lock();
+        // allocation still in use, back off instead of retrying it right away
+        if (!released && !self->stopAdditionalWorkers) {
+            self->condition.wait_for(lock, std::chrono::milliseconds(1));
+        }
+    }
+    return nullptr;
+}
+
 void DeferredDeleter::drain(bool blocking) {
     clearQueue();
     if (blocking) {
@@ -120,6 +170,7 @@ void DeferredDeleter::clearQueue() {
                 elementsToRelease--;
             } else {
                 queue.pushTailOne(*deletion.release());
+                std::this_thread::yield();
             }
         }
     } while (!queue.peekIsEmpty());
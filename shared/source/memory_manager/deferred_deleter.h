@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,6 +12,7 @@
 #include <condition_variable>
 #include <mutex>
 #include <utility>
+#include <vector>
 
 namespace NEO {
 class DeferrableDeletion;
@@ -41,10 +42,13 @@ class DeferredDeleter {
     MOCKABLE_VIRTUAL bool shouldStop();
 
     static void *run(void *);
+    static void *runAdditionalWorker(void *);
 
     std::atomic<bool> doWorkInBackground;
     std::atomic<int> elementsToRelease;
     std::unique_ptr<Thread> worker;
+    std::vector<std::unique_ptr<Thread>> additionalWorkers;
+    bool stopAdditionalWorkers = false;
     int32_t numClients = 0;
     IDList<DeferrableDeletion, true> queue;
     std::mutex queueMutex;
@@ -7,6 +7,7 @@
 
 #include "shared/source/memory_manager/gfx_partition.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/heap_assigner.h"
 #include "shared/source/memory_manager/memory_manager.h"
@@ -19,12 +20,13 @@ const std::array<HeapIndex, 4> GfxPartition::heap32Names{{HeapIndex::HEAP_INTERN
                                                           HeapIndex::HEAP_EXTERNAL_DEVICE_MEMORY,
                                                           HeapIndex::HEAP_EXTERNAL}};
 
-const std::array<HeapIndex, 7> GfxPartition::heapNonSvmNames{{HeapIndex::HEAP_INTERNAL_DEVICE_MEMORY,
+const std::array<HeapIndex, 8> GfxPartition::heapNonSvmNames{{HeapIndex::HEAP_INTERNAL_DEVICE_MEMORY,
                                                               HeapIndex::HEAP_INTERNAL,
                                                               HeapIndex::HEAP_EXTERNAL_DEVICE_MEMORY,
                                                               HeapIndex::HEAP_EXTERNAL,
                                                               HeapIndex::HEAP_STANDARD,
                                                               HeapIndex::HEAP_STANDARD64KB,
+                                                              HeapIndex::HEAP_STANDARD2MB,
                                                               HeapIndex::HEAP_EXTENDED}};
 
 GfxPartition::GfxPartition(OSMemory::ReservedCpuAddressRange &sharedReservedCpuAddressRange) : reservedCpuAddressRange(sharedReservedCpuAddressRange), osMemory(OSMemory::create()) {}
@@ -43,7 +45,7 @@ void GfxPartition::Heap::init(uint64_t base, uint64_t size, size_t allocationAli
         size -= 2 * GfxPartition::heapGranularity;
     }
 
-    alloc = std::make_unique<HeapAllocator>(base + GfxPartition::heapGranularity, size, allocationAlignment);
+    setAllocatorRange(base + GfxPartition::heapGranularity, size, allocationAlignment, 4 * MemoryConstants::megaByte);
 }
 
 void GfxPartition::Heap::initExternalWithFrontWindow(uint64_t base, uint64_t size) {
@@ -52,7 +54,7 @@ void GfxPartition::Heap::initExternalWithFrontWindow(uint64_t base, uint64_t siz
 
     size -= GfxPartition::heapGranularity;
 
-    alloc = std::make_unique<HeapAllocator>(base, size, MemoryConstants::pageSize, 0u);
+    setAllocatorRange(base, size, MemoryConstants::pageSize, 0u);
 }
 
 void GfxPartition::Heap::initWithFrontWindow(uint64_t base, uint64_t size, uint64_t frontWindowSize) {
@@ -63,14 +65,35 @@ void GfxPartition::Heap::initWithFrontWindow(uint64_t base, uint64_t size, uint6
     size -= GfxPartition::heapGranularity;
     size -= frontWindowSize;
 
-    alloc = std::make_unique<HeapAllocator>(base + frontWindowSize, size, MemoryConstants::pageSize);
+    setAllocatorRange(base + frontWindowSize, size, MemoryConstants::pageSize, 4 * MemoryConstants::megaByte);
 }
 
 void GfxPartition::Heap::initFrontWindow(uint64_t base, uint64_t size) {
     this->base = base;
     this->size = size;
 
-    alloc = std::make_unique<HeapAllocator>(base, size, MemoryConstants::pageSize, 0u);
+    setAllocatorRange(base, size, MemoryConstants::pageSize, 0u);
+}
+
+void GfxPartition::Heap::setAllocatorRange(uint64_t allocatorBase, uint64_t allocatorSize, size_t allocationAlignment, size_t sizeThreshold) {
+    std::lock_guard<std::mutex> lock(allocatorMutex);
+    this->allocatorBase = allocatorBase;
+    this->allocatorSize = allocatorSize;
+    this->allocationAlignment = allocationAlignment;
+    this->sizeThreshold = sizeThreshold;
+    alloc.reset();
+    allocatorCreated.store(false, std::memory_order_release);
+}
+
+HeapAllocator &GfxPartition::Heap::getAllocator() {
+    if (!allocatorCreated.load(std::memory_order_acquire)) {
+        std::lock_guard<std::mutex> lock(allocatorMutex);
+        if (!alloc) {
+            alloc = std::make_unique<HeapAllocator>(allocatorBase, allocatorSize, allocationAlignment, sizeThreshold);
+            allocatorCreated.store(true, std::memory_order_release);
+        }
+    }
+    return *alloc;
 }
 
 void GfxPartition::freeGpuAddressRange(uint64_t ptr, size_t size) {
@@ -144,6 +167,12 @@ bool GfxPartition::init(uint64_t gpuAddressSpace, size_t cpuAddressRangeSizeToRe
             gfxBase = maxNBitValue(48 - 1) + 1;
             heapInit(HeapIndex::HEAP_SVM, 0ull, gfxBase);
         } else if (gpuAddressSpace == maxNBitValue(47)) {
+            if (DebugManager.flags.CpuAddressRangeReservationSizeInGb.get() != -1) {
+                // has to fit four 32-bit heaps and the three standard heaps
+                constexpr uint64_t minimalSizeToReserve = (4 * 4 + 3 * 4) * MemoryConstants::gigaByte;
+                auto sizeToReserve = static_cast<uint64_t>(DebugManager.flags.CpuAddressRangeReservationSizeInGb.get()) * MemoryConstants::gigaByte;
+                cpuAddressRangeSizeToReserve = static_cast<size_t>(std::max(sizeToReserve, minimalSizeToReserve));
+            }
             if (reservedCpuAddressRange.alignedPtr == nullptr) {
                 if (cpuAddressRangeSizeToReserve == 0) {
                     return false;
@@ -12,7 +12,9 @@
 #include "shared/source/utilities/heap_allocator.h"
 
 #include <array>
+#include <atomic>
 #include <map>
+#include <mutex>
 
 namespace NEO {
 
@@ -110,7 +112,7 @@ class GfxPartition {
     static constexpr size_t internalFrontWindowPoolSize = 1 * MemoryConstants::megaByte;
 
     static const std::array<HeapIndex, 4> heap32Names;
-    static const std::array<HeapIndex, 7> heapNonSvmNames;
+    static const std::array<HeapIndex, 8> heapNonSvmNames;
 
   protected:
     bool initAdditionalRange(uint32_t cpuAddressWidth, uint64_t gpuAddressSpace, uint64_t &gfxBase, uint64_t &gfxTop, uint32_t rootDeviceIndex, size_t numRootDevices);
@@ -125,11 +127,22 @@ class GfxPartition {
         uint64_t getBase() const { return base; }
         uint64_t getSize() const { return size; }
         uint64_t getLimit() const { return size ? base + size - 1 : 0; }
-        uint64_t allocate(size_t &size) { return alloc->allocate(size); }
-        void free(uint64_t ptr, size_t size) { alloc->free(ptr, size); }
+        bool isAllocatorCreated() const { return allocatorCreated.load(std::memory_order_acquire); }
+        uint64_t allocate(size_t &size) { return getAllocator().allocate(size); }
+        void free(uint64_t ptr, size_t size) { getAllocator().free(ptr, size); }
 
       protected:
+        void setAllocatorRange(uint64_t allocatorBase, uint64_t allocatorSize, size_t allocationAlignment, size_t sizeThreshold);
+        HeapAllocator &getAllocator();
+
         uint64_t base = 0, size = 0;
+
+        // allocator is created on first use, most heaps of a partition are never allocated from
+        uint64_t allocatorBase = 0, allocatorSize = 0;
+        size_t allocationAlignment = MemoryConstants::pageSize;
+        size_t sizeThreshold = 0u;
+        std::atomic<bool> allocatorCreated{false};
+        std::mutex allocatorMutex;
         std::unique_ptr<HeapAllocator> alloc;
     };
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -71,6 +71,105 @@ uint32_t GraphicsAllocation::getUsedPageSize() const {
     }
 }
 
+const char *GraphicsAllocation::getAllocationTypeString(AllocationType allocationType) {
+    switch (allocationType) {
+    case AllocationType::UNKNOWN:
+        return "UNKNOWN";
+    case AllocationType::BUFFER:
+        return "BUFFER";
+    case AllocationType::BUFFER_COMPRESSED:
+        return "BUFFER_COMPRESSED";
+    case AllocationType::BUFFER_HOST_MEMORY:
+        return "BUFFER_HOST_MEMORY";
+    case AllocationType::COMMAND_BUFFER:
+        return "COMMAND_BUFFER";
+    case AllocationType::CONSTANT_SURFACE:
+        return "CONSTANT_SURFACE";
+    case AllocationType::DEVICE_QUEUE_BUFFER:
+        return "DEVICE_QUEUE_BUFFER";
+    case AllocationType::EXTERNAL_HOST_PTR:
+        return "EXTERNAL_HOST_PTR";
+    case AllocationType::FILL_PATTERN:
+        return "FILL_PATTERN";
+    case AllocationType::GLOBAL_SURFACE:
+        return "GLOBAL_SURFACE";
+    case AllocationType::IMAGE:
+        return "IMAGE";
+    case AllocationType::INDIRECT_OBJECT_HEAP:
+        return "INDIRECT_OBJECT_HEAP";
+    case AllocationType::INSTRUCTION_HEAP:
+        return "INSTRUCTION_HEAP";
+    case AllocationType::INTERNAL_HEAP:
+        return "INTERNAL_HEAP";
+    case AllocationType::INTERNAL_HOST_MEMORY:
+        return "INTERNAL_HOST_MEMORY";
+    case AllocationType::KERNEL_ISA:
+        return "KERNEL_ISA";
+    case AllocationType::KERNEL_ISA_INTERNAL:
+        return "KERNEL_ISA_INTERNAL";
+    case AllocationType::LINEAR_STREAM:
+        return "LINEAR_STREAM";
+    case AllocationType::MAP_ALLOCATION:
+        return "MAP_ALLOCATION";
+    case AllocationType::MCS:
+        return "MCS";
+    case AllocationType::PIPE:
+        return "PIPE";
+    case AllocationType::PREEMPTION:
+        return "PREEMPTION";
+    case AllocationType::PRINTF_SURFACE:
+        return "PRINTF_SURFACE";
+    case AllocationType::PRIVATE_SURFACE:
+        return "PRIVATE_SURFACE";
+    case AllocationType::PROFILING_TAG_BUFFER:
+        return "PROFILING_TAG_BUFFER";
+    case AllocationType::SCRATCH_SURFACE:
+        return "SCRATCH_SURFACE";
+    case AllocationType::SHARED_BUFFER:
+        return "SHARED_BUFFER";
+    case AllocationType::SHARED_CONTEXT_IMAGE:
+        return "SHARED_CONTEXT_IMAGE";
+    case AllocationType::SHARED_IMAGE:
+        return "SHARED_IMAGE";
+    case AllocationType::SHARED_RESOURCE_COPY:
+        return "SHARED_RESOURCE_COPY";
+    case AllocationType::SURFACE_STATE_HEAP:
+        return "SURFACE_STATE_HEAP";
+    case AllocationType::SVM_CPU:
+        return "SVM_CPU";
+    case AllocationType::SVM_GPU:
+        return "SVM_GPU";
+    case AllocationType::SVM_ZERO_COPY:
+        return "SVM_ZERO_COPY";
+    case AllocationType::TAG_BUFFER:
+        return "TAG_BUFFER";
+    case AllocationType::GLOBAL_FENCE:
+        return "GLOBAL_FENCE";
+    case AllocationType::TIMESTAMP_PACKET_TAG_BUFFER:
+        return "TIMESTAMP_PACKET_TAG_BUFFER";
+    case AllocationType::WRITE_COMBINED:
+        return "WRITE_COMBINED";
+    case AllocationType::RING_BUFFER:
+        return "RING_BUFFER";
+    case AllocationType::SEMAPHORE_BUFFER:
+        return "SEMAPHORE_BUFFER";
+    case AllocationType::DEBUG_CONTEXT_SAVE_AREA:
+        return "DEBUG_CONTEXT_SAVE_AREA";
+    case AllocationType::DEBUG_SBA_TRACKING_BUFFER:
+        return "DEBUG_SBA_TRACKING_BUFFER";
+    case AllocationType::DEBUG_MODULE_AREA:
+        return "DEBUG_MODULE_AREA";
+    case AllocationType::UNIFIED_SHARED_MEMORY:
+        return "UNIFIED_SHARED_MEMORY";
+    case AllocationType::WORK_PARTITION_SURFACE:
+        return "WORK_PARTITION_SURFACE";
+    case AllocationType::GPU_TIMESTAMP_DEVICE_BUFFER:
+        return "GPU_TIMESTAMP_DEVICE_BUFFER";
+    default:
+        return "ILLEGAL_VALUE";
+    }
+}
+
 constexpr uint32_t GraphicsAllocation::objectNotUsed;
 constexpr uint32_t GraphicsAllocation::objectNotResident;
 constexpr uint32_t GraphicsAllocation::objectAlwaysResident;
@@ -166,6 +166,8 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
     void setFlushL3Required(bool flushL3Required) { allocationInfo.flags.flushL3Required = flushL3Required; }
     bool is32BitAllocation() const { return allocationInfo.flags.is32BitAllocation; }
     void set32BitAllocation(bool is32BitAllocation) { allocationInfo.flags.is32BitAllocation = is32BitAllocation; }
+    bool isAuxResolved() const { return allocationInfo.flags.auxResolved; }
+    void setAuxResolved(bool auxResolved) { allocationInfo.flags.auxResolved = auxResolved; }
 
     void setAubWritable(bool writable, uint32_t banks);
     bool isAubWritable(uint32_t banks) const;
@@ -226,6 +228,8 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
                allocationType == AllocationType::SEMAPHORE_BUFFER;
     }
 
+    static const char *getAllocationTypeString(AllocationType allocationType);
+
     static bool isIsaAllocationType(GraphicsAllocation::AllocationType type) {
         return type == GraphicsAllocation::AllocationType::KERNEL_ISA ||
                type == GraphicsAllocation::AllocationType::KERNEL_ISA_INTERNAL;
@@ -265,8 +269,16 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
 
     const AubInfo &getAubInfo() const { return aubInfo; }
 
+    struct AccountedUsage {
+        AllocationType allocationType = AllocationType::UNKNOWN;
+        MemoryPool::Type memoryPool = MemoryPool::MemoryNull;
+        size_t size = 0u;
+        uint32_t osHandleCount = 0u;
+    };
+
     OsHandleStorage fragmentsStorage;
     StorageInfo storageInfo = {};
+    AccountedUsage accountedUsage = {};
 
     static constexpr uint32_t defaultBank = 0b1u;
     static constexpr uint32_t allBanks = 0xffffffff;
@@ -292,7 +304,8 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
                 uint32_t evictable : 1;
                 uint32_t flushL3Required : 1;
                 uint32_t is32BitAllocation : 1;
-                uint32_t reserved : 28;
+                uint32_t auxResolved : 1;
+                uint32_t reserved : 27;
             } flags;
             uint32_t allFlags = 0u;
         };
@@ -302,6 +315,7 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
             flags.evictable = true;
             flags.flushL3Required = true;
             flags.is32BitAllocation = false;
+            flags.auxResolved = false;
         }
     };
 
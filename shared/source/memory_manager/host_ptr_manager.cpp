@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,7 @@
 #include "shared/source/memory_manager/host_ptr_manager.h"
 
 #include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/utilities/trace_events.h"
 
 using namespace NEO;
 
@@ -141,7 +142,9 @@ void HostPtrManager::storeFragment(uint32_t rootDeviceIndex, AllocationStorageDa
 }
 
 std::unique_lock<std::recursive_mutex> HostPtrManager::obtainOwnership() {
-    return std::unique_lock<std::recursive_mutex>(allocationsMutex);
+    std::unique_lock<std::recursive_mutex> lock(allocationsMutex, std::defer_lock);
+    lockWithContentionTrace(lock, "hostPtrManager");
+    return lock;
 }
 
 void HostPtrManager::releaseHandleStorage(uint32_t rootDeviceIndex, OsHandleStorage &fragments) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -75,6 +75,41 @@ std::unique_ptr<GraphicsAllocation> InternalAllocationStorage::obtainTemporaryAl
     return allocation;
 }
 
+void InternalAllocationStorage::trimReusableAllocations(GraphicsAllocation::AllocationType allocationType, size_t maxAllocationsCount) {
+    auto memoryManager = commandStreamReceiver.getMemoryManager();
+    auto lock = memoryManager->getHostPtrManager()->obtainOwnership();
+    auto contextId = commandStreamReceiver.getOsContext().getContextId();
+    auto completedTaskCount = *commandStreamReceiver.getTagAddress();
+
+    GraphicsAllocation *curr = allocationsForReuse.detachNodes();
+
+    size_t allocationsCount = 0u;
+    for (auto allocation = curr; allocation != nullptr; allocation = allocation->next) {
+        if (allocation->getAllocationType() == allocationType) {
+            allocationsCount++;
+        }
+    }
+
+    // list is ordered from the oldest stored allocation, release completed ones until high-water mark is met
+    IDList<GraphicsAllocation, false, true> allocationsLeft;
+    while (curr != nullptr) {
+        auto *next = curr->next;
+        if (allocationsCount > maxAllocationsCount &&
+            curr->getAllocationType() == allocationType &&
+            curr->getTaskCount(contextId) <= completedTaskCount) {
+            memoryManager->freeGraphicsMemory(curr);
+            allocationsCount--;
+        } else {
+            allocationsLeft.pushTailOne(*curr);
+        }
+        curr = next;
+    }
+
+    if (allocationsLeft.peekIsEmpty() == false) {
+        allocationsForReuse.splice(*allocationsLeft.detachNodes());
+    }
+}
+
 struct ReusableAllocationRequirements {
     size_t requiredMinimalSize;
     volatile uint32_t *csrTagAddress;
@@ -0,0 +1,22 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace NEO {
+
+struct MemAdviseFlags {
+    uint8_t readMostly : 1;
+    uint8_t devicePreferredLocation : 1;
+    uint8_t reserved : 6;
+
+    MemAdviseFlags() : readMostly(0), devicePreferredLocation(0), reserved(0) {}
+};
+
+} // namespace NEO
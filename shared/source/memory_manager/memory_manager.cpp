@@ -17,6 +17,8 @@
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/api_specific_config.h"
 #include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/blit_commands_helper.h"
+#include "shared/source/helpers/engine_node_helper.h"
 #include "shared/source/helpers/heap_assigner.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/hw_info.h"
@@ -31,8 +33,10 @@
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/utilities/compiler_support.h"
 #include "shared/source/utilities/stackvec.h"
+#include "shared/source/utilities/trace_events.h"
 
 #include <algorithm>
+#include <sstream>
 
 namespace NEO {
 uint32_t MemoryManager::maxOsContextCount = 0u;
@@ -45,6 +49,7 @@ MemoryManager::MemoryManager(ExecutionEnvironment &executionEnvironment) : execu
     for (uint32_t rootDeviceIndex = 0; rootDeviceIndex < executionEnvironment.rootDeviceEnvironments.size(); ++rootDeviceIndex) {
         auto hwInfo = executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->getHardwareInfo();
         localMemoryUsageBankSelector.emplace_back(new LocalMemoryUsageBankSelector(HwHelper::getSubDevicesCount(hwInfo)));
+        memoryUsageStatistics.push_back(std::make_unique<MemoryUsageStatistics>());
         this->localMemorySupported.push_back(HwHelper::get(hwInfo->platform.eRenderCoreFamily).getEnableLocalMemory(*hwInfo));
         this->enable64kbpages.push_back(OSInterface::osEnabled64kbPages && hwInfo->capabilityTable.ftr64KBpages && !!DebugManager.flags.Enable64kbpages.get());
 
@@ -57,6 +62,10 @@ MemoryManager::MemoryManager(ExecutionEnvironment &executionEnvironment) : execu
         pageFaultManager = PageFaultManager::create();
     }
 
+    if (DebugManager.flags.DumpMemoryUsageStatisticsOnSignal.get() != -1) {
+        MemoryUsageStatistics::enableDumpOnSignal(DebugManager.flags.DumpMemoryUsageStatisticsOnSignal.get());
+    }
+
     if (DebugManager.flags.EnableMultiStorageResources.get() != -1) {
         supportsMultiStorageResources = !!DebugManager.flags.EnableMultiStorageResources.get();
     }
@@ -188,9 +197,6 @@ void MemoryManager::freeGraphicsMemory(GraphicsAllocation *gfxAllocation) {
     if (!gfxAllocation) {
         return;
     }
-    if (ApiSpecificConfig::getBindlessConfiguration() && executionEnvironment.rootDeviceEnvironments[gfxAllocation->getRootDeviceIndex()]->getBindlessHeapsHelper() != nullptr) {
-        executionEnvironment.rootDeviceEnvironments[gfxAllocation->getRootDeviceIndex()]->getBindlessHeapsHelper()->placeSSAllocationInReuseVectorOnFreeMemory(gfxAllocation);
-    }
     const bool hasFragments = gfxAllocation->fragmentsStorage.fragmentCount != 0;
     const bool isLocked = gfxAllocation->isLocked();
     DEBUG_BREAK_IF(hasFragments && isLocked);
@@ -198,13 +204,24 @@ void MemoryManager::freeGraphicsMemory(GraphicsAllocation *gfxAllocation) {
     if (!hasFragments) {
         handleFenceCompletion(gfxAllocation);
     }
+    // surface states become reusable only once no pending submission can read them
+    if (ApiSpecificConfig::getBindlessConfiguration() && executionEnvironment.rootDeviceEnvironments[gfxAllocation->getRootDeviceIndex()]->getBindlessHeapsHelper() != nullptr) {
+        executionEnvironment.rootDeviceEnvironments[gfxAllocation->getRootDeviceIndex()]->getBindlessHeapsHelper()->placeSSAllocationInReuseVectorOnFreeMemory(gfxAllocation);
+    }
     if (isLocked) {
         freeAssociatedResourceImpl(*gfxAllocation);
     }
 
     localMemoryUsageBankSelector[gfxAllocation->getRootDeviceIndex()]->freeOnBanks(gfxAllocation->storageInfo.getMemoryBanks(), gfxAllocation->getUnderlyingBufferSize());
+    memoryUsageStatistics[gfxAllocation->getRootDeviceIndex()]->recordFree(*gfxAllocation);
     freeGraphicsMemoryImpl(gfxAllocation);
 }
+
+void MemoryManager::dumpMemoryUsageStatistics(std::ostream &out) const {
+    for (uint32_t rootDeviceIndex = 0; rootDeviceIndex < memoryUsageStatistics.size(); rootDeviceIndex++) {
+        memoryUsageStatistics[rootDeviceIndex]->dump(out, rootDeviceIndex);
+    }
+}
 //if not in use destroy in place
 //if in use pass to temporary allocation list that is cleaned on blocking calls
 void MemoryManager::checkGpuUsageAndDestroyGraphicsAllocations(GraphicsAllocation *gfxAllocation) {
@@ -234,6 +251,11 @@ void MemoryManager::waitForDeletions() {
     }
     deferredDeleter.reset(nullptr);
 }
+
+void MemoryManager::prepareForFastTeardown() {
+    waitForDeletions();
+}
+
 bool MemoryManager::isAsyncDeleterEnabled() const {
     return asyncDeleterEnabled;
 }
@@ -401,6 +423,7 @@ bool MemoryManager::getAllocationData(AllocationData &allocationData, const Allo
         (mayRequireL3Flush ? properties.flags.flushL3RequiredForRead | properties.flags.flushL3RequiredForWrite : 0u);
     allocationData.flags.preferRenderCompressed = CompressionSelector::preferRenderCompressedBuffer(properties);
     allocationData.flags.multiOsContextCapable = properties.flags.multiOsContextCapable;
+    allocationData.flags.preferSystemPlacement = properties.flags.preferSystemPlacement;
 
     if (properties.allocationType == GraphicsAllocation::AllocationType::DEBUG_MODULE_AREA) {
         allocationData.flags.use32BitFrontWindow = true;
@@ -430,6 +453,7 @@ bool MemoryManager::getAllocationData(AllocationData &allocationData, const Allo
 }
 
 GraphicsAllocation *MemoryManager::allocateGraphicsMemoryInPreferredPool(const AllocationProperties &properties, const void *hostPtr) {
+    ScopedTraceEvent traceEvent("allocateGraphicsMemory", TraceEvents::Category::allocation);
     AllocationData allocationData;
     getAllocationData(allocationData, properties, hostPtr, createStorageInfoFromProperties(properties));
     overrideAllocationData(allocationData, properties);
@@ -445,6 +469,14 @@ GraphicsAllocation *MemoryManager::allocateGraphicsMemoryInPreferredPool(const A
         allocation = allocateGraphicsMemory(allocationData);
         this->registerSysMemAlloc(allocation);
     }
+    if (allocation) {
+        memoryUsageStatistics[properties.rootDeviceIndex]->recordAllocation(*allocation);
+    }
+    if (MemoryUsageStatistics::isDumpRequested()) {
+        std::stringstream out;
+        dumpMemoryUsageStatistics(out);
+        printDebugString(true, stdout, "%s", out.str().c_str());
+    }
     FileLoggerInstance().logAllocation(allocation);
     registerAllocationInOs(allocation);
     return allocation;
@@ -608,6 +640,37 @@ bool MemoryManager::copyMemoryToAllocation(GraphicsAllocation *graphicsAllocatio
     return true;
 }
 
+bool MemoryManager::copyFromPeerAllocation(GraphicsAllocation &dstAllocation, GraphicsAllocation &srcAllocation) {
+    auto rootDeviceIndex = dstAllocation.getRootDeviceIndex();
+    EngineControl *bcsEngine = nullptr;
+    for (auto &engine : getRegisteredEngines()) {
+        if (engine.commandStreamReceiver->getRootDeviceIndex() == rootDeviceIndex && EngineHelpers::isBcs(engine.getEngineType()) &&
+            engine.osContext->isContextInitialized()) {
+            bcsEngine = &engine;
+            break;
+        }
+    }
+    if (bcsEngine == nullptr) {
+        return false;
+    }
+
+    auto peerAllocation = createPeerAllocation(srcAllocation, rootDeviceIndex);
+    if (peerAllocation == nullptr) {
+        return false;
+    }
+
+    waitForEnginesCompletion(srcAllocation);
+
+    auto size = std::min(dstAllocation.getUnderlyingBufferSize(), srcAllocation.getUnderlyingBufferSize());
+    BlitPropertiesContainer blitPropertiesContainer;
+    blitPropertiesContainer.push_back(BlitProperties::constructPropertiesForCopyBuffer(&dstAllocation, peerAllocation, 0, 0, {size, 1, 1}, 0, 0, 0, 0,
+                                                                                       bcsEngine->commandStreamReceiver->getClearColorAllocation()));
+    bcsEngine->commandStreamReceiver->blitBuffer(blitPropertiesContainer, true, false);
+
+    freeGraphicsMemory(peerAllocation);
+    return true;
+}
+
 void MemoryManager::waitForEnginesCompletion(GraphicsAllocation &graphicsAllocation) {
     for (auto &engine : getRegisteredEngines()) {
         auto osContextId = engine.osContext->getContextId();
@@ -619,6 +682,20 @@ void MemoryManager::waitForEnginesCompletion(GraphicsAllocation &graphicsAllocat
     }
 }
 
+bool MemoryManager::isAllocationInUse(GraphicsAllocation &graphicsAllocation) {
+    if (!graphicsAllocation.isUsed()) {
+        return false;
+    }
+    for (auto &engine : getRegisteredEngines()) {
+        auto osContextId = engine.osContext->getContextId();
+        if (graphicsAllocation.isUsedByOsContext(osContextId) &&
+            graphicsAllocation.getTaskCount(osContextId) > *engine.commandStreamReceiver->getTagAddress()) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void MemoryManager::cleanTemporaryAllocationListOnAllEngines(bool waitForCompletion) {
     for (auto &engine : getRegisteredEngines()) {
         auto csr = engine.commandStreamReceiver;
@@ -629,6 +706,15 @@ void MemoryManager::cleanTemporaryAllocationListOnAllEngines(bool waitForComplet
     }
 }
 
+void MemoryManager::registerFullCacheFlushOnAllEngines(uint32_t rootDeviceIndex) {
+    for (auto &engine : getRegisteredEngines()) {
+        auto csr = engine.commandStreamReceiver;
+        if (csr->getRootDeviceIndex() == rootDeviceIndex && !EngineHelpers::isBcs(engine.getEngineType())) {
+            csr->registerFullCacheFlush();
+        }
+    }
+}
+
 void *MemoryManager::getReservedMemory(size_t size, size_t alignment) {
     static std::mutex mutex;
     std::lock_guard<std::mutex> lock(mutex);
@@ -18,6 +18,7 @@
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/host_ptr_defines.h"
 #include "shared/source/memory_manager/local_memory_usage.h"
+#include "shared/source/memory_manager/memory_usage_statistics.h"
 #include "shared/source/memory_manager/multi_graphics_allocation.h"
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
@@ -88,6 +89,9 @@ class MemoryManager {
     virtual bool verifyHandle(osHandle handle, uint32_t rootDeviceIndex, bool) { return true; }
     virtual GraphicsAllocation *createGraphicsAllocationFromSharedHandle(osHandle handle, const AllocationProperties &properties, bool requireSpecificBitness) = 0;
     virtual void closeSharedHandle(GraphicsAllocation *graphicsAllocation){};
+    // imports allocation from another root device, so that rootDeviceIndex can access it over PCIe
+    virtual GraphicsAllocation *createPeerAllocation(GraphicsAllocation &allocation, uint32_t rootDeviceIndex) { return nullptr; }
+    MOCKABLE_VIRTUAL bool copyFromPeerAllocation(GraphicsAllocation &dstAllocation, GraphicsAllocation &srcAllocation);
     virtual GraphicsAllocation *createGraphicsAllocationFromNTHandle(void *handle, uint32_t rootDeviceIndex) = 0;
 
     virtual bool mapAuxGpuVA(GraphicsAllocation *graphicsAllocation);
@@ -133,19 +137,30 @@ class MemoryManager {
         return deferredDeleter.get();
     }
 
+    const MemoryUsageStatistics &getMemoryUsageStatistics(uint32_t rootDeviceIndex) const {
+        return *memoryUsageStatistics[rootDeviceIndex];
+    }
+    void dumpMemoryUsageStatistics(std::ostream &out) const;
+
     PageFaultManager *getPageFaultManager() const {
         return pageFaultManager.get();
     }
 
     void waitForDeletions();
+    virtual void prepareForFastTeardown();
     MOCKABLE_VIRTUAL void waitForEnginesCompletion(GraphicsAllocation &graphicsAllocation);
+    bool isAllocationInUse(GraphicsAllocation &graphicsAllocation);
     void cleanTemporaryAllocationListOnAllEngines(bool waitForCompletion);
+    // copy engines do not cache, the flush is emitted by the next flushTask of each other engine
+    void registerFullCacheFlushOnAllEngines(uint32_t rootDeviceIndex);
 
     bool isAsyncDeleterEnabled() const;
     bool isLocalMemorySupported(uint32_t rootDeviceIndex) const;
     virtual bool isMemoryBudgetExhausted() const;
 
     virtual bool isKmdMigrationAvailable(uint32_t rootDeviceIndex) { return false; }
+    // true when every allocation carries a per handle cost that small allocations should share
+    virtual bool isSmallAllocationPoolingPreferred() const { return false; }
 
     virtual AlignedMallocRestrictions *getAlignedMallocRestrictions() {
         return nullptr;
@@ -244,6 +259,7 @@ class MemoryManager {
     std::unique_ptr<DeferredDeleter> multiContextResourceDestructor;
     std::vector<std::unique_ptr<GfxPartition>> gfxPartitions;
     std::vector<std::unique_ptr<LocalMemoryUsageBankSelector>> localMemoryUsageBankSelector;
+    std::vector<std::unique_ptr<MemoryUsageStatistics>> memoryUsageStatistics;
     void *reservedMemory = nullptr;
     std::unique_ptr<PageFaultManager> pageFaultManager;
     OSMemory::ReservedCpuAddressRange reservedCpuAddressRange;
@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/memory_usage_statistics.h"
+
+#include "shared/source/helpers/debug_helpers.h"
+
+#include <csignal>
+
+namespace NEO {
+std::atomic<bool> MemoryUsageStatistics::dumpRequested{false};
+
+void MemoryUsageStatistics::recordAllocation(GraphicsAllocation &allocation) {
+    auto allocationType = static_cast<size_t>(allocation.getAllocationType());
+    auto memoryPool = static_cast<size_t>(static_cast<uint32_t>(allocation.getMemoryPool()));
+    if (allocationType >= numAllocationTypes || memoryPool >= numMemoryPools) {
+        DEBUG_BREAK_IF(true);
+        return;
+    }
+    if (allocation.getUnderlyingBufferSize() == 0u) {
+        return;
+    }
+
+    auto &usage = allocation.accountedUsage;
+    usage.allocationType = allocation.getAllocationType();
+    usage.memoryPool = allocation.getMemoryPool();
+    usage.size = allocation.getUnderlyingBufferSize();
+    usage.osHandleCount = getOsHandleCount(allocation);
+
+    add(counters[allocationType][memoryPool], usage.size, usage.osHandleCount);
+    add(totals[usage.memoryPool == MemoryPool::LocalMemory], usage.size, usage.osHandleCount);
+}
+
+void MemoryUsageStatistics::recordFree(GraphicsAllocation &allocation) {
+    auto &usage = allocation.accountedUsage;
+    if (usage.size == 0u) {
+        return;
+    }
+
+    auto allocationType = static_cast<size_t>(usage.allocationType);
+    auto memoryPool = static_cast<size_t>(static_cast<uint32_t>(usage.memoryPool));
+    subtract(counters[allocationType][memoryPool], usage.size, usage.osHandleCount);
+    subtract(totals[usage.memoryPool == MemoryPool::LocalMemory], usage.size, usage.osHandleCount);
+    usage = {};
+}
+
+MemoryUsage MemoryUsageStatistics::getUsage(AllocationType allocationType, MemoryPool::Type memoryPool) const {
+    auto typeIndex = static_cast<size_t>(allocationType);
+    auto poolIndex = static_cast<size_t>(static_cast<uint32_t>(memoryPool));
+    if (typeIndex >= numAllocationTypes || poolIndex >= numMemoryPools) {
+        return {};
+    }
+    return read(counters[typeIndex][poolIndex]);
+}
+
+MemoryUsage MemoryUsageStatistics::getTotalUsage(bool localMemory) const {
+    return read(totals[localMemory]);
+}
+
+void MemoryUsageStatistics::dump(std::ostream &out, uint32_t rootDeviceIndex) const {
+    for (auto localMemory : {false, true}) {
+        auto total = getTotalUsage(localMemory);
+        out << "Root device " << rootDeviceIndex << (localMemory ? " local" : " system") << " memory:"
+            << " live " << total.liveBytes << " B, peak " << total.peakBytes << " B, allocations " << total.allocationCount
+            << ", handles " << total.osHandleCount << "\n";
+    }
+    for (size_t typeIndex = 0; typeIndex < numAllocationTypes; typeIndex++) {
+        for (size_t poolIndex = 0; poolIndex < numMemoryPools; poolIndex++) {
+            auto usage = read(counters[typeIndex][poolIndex]);
+            if (usage.peakBytes == 0u) {
+                continue;
+            }
+            out << "  " << GraphicsAllocation::getAllocationTypeString(static_cast<AllocationType>(typeIndex)) << " pool " << poolIndex << ":"
+                << " live " << usage.liveBytes << " B, peak " << usage.peakBytes << " B, allocations " << usage.allocationCount
+                << ", handles " << usage.osHandleCount << "\n";
+        }
+    }
+}
+
+void MemoryUsageStatistics::enableDumpOnSignal(int signalNumber) {
+    std::signal(signalNumber, signalHandler);
+}
+
+void MemoryUsageStatistics::signalHandler(int signalNumber) {
+    dumpRequested.store(true);
+}
+
+void MemoryUsageStatistics::add(Counters &counters, uint64_t size, uint32_t osHandleCount) {
+    auto liveBytes = counters.liveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+    auto peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+    while (liveBytes > peakBytes && !counters.peakBytes.compare_exchange_weak(peakBytes, liveBytes, std::memory_order_relaxed)) {
+    }
+    counters.allocationCount.fetch_add(1u, std::memory_order_relaxed);
+    counters.osHandleCount.fetch_add(osHandleCount, std::memory_order_relaxed);
+}
+
+void MemoryUsageStatistics::subtract(Counters &counters, uint64_t size, uint32_t osHandleCount) {
+    counters.liveBytes.fetch_sub(size, std::memory_order_relaxed);
+    counters.allocationCount.fetch_sub(1u, std::memory_order_relaxed);
+    counters.osHandleCount.fetch_sub(osHandleCount, std::memory_order_relaxed);
+}
+
+MemoryUsage MemoryUsageStatistics::read(const Counters &counters) {
+    MemoryUsage usage;
+    usage.liveBytes = counters.liveBytes.load(std::memory_order_relaxed);
+    usage.peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+    usage.allocationCount = counters.allocationCount.load(std::memory_order_relaxed);
+    usage.osHandleCount = counters.osHandleCount.load(std::memory_order_relaxed);
+    return usage;
+}
+
+uint32_t MemoryUsageStatistics::getOsHandleCount(const GraphicsAllocation &allocation) {
+    if (allocation.fragmentsStorage.fragmentCount != 0u) {
+        return allocation.fragmentsStorage.fragmentCount;
+    }
+    return allocation.getNumGmms();
+}
+
+} // namespace NEO
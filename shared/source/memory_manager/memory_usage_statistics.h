@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/memory_manager/graphics_allocation.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+
+namespace NEO {
+
+struct MemoryUsage {
+    uint64_t liveBytes = 0u;
+    uint64_t peakBytes = 0u;
+    uint64_t allocationCount = 0u;
+    uint64_t osHandleCount = 0u;
+};
+
+class MemoryUsageStatistics {
+  public:
+    using AllocationType = GraphicsAllocation::AllocationType;
+
+    static constexpr size_t numAllocationTypes = static_cast<size_t>(AllocationType::GPU_TIMESTAMP_DEVICE_BUFFER) + 1;
+    static constexpr size_t numMemoryPools = static_cast<size_t>(MemoryPool::LocalMemory) + 1;
+
+    MemoryUsageStatistics() = default;
+    MemoryUsageStatistics(const MemoryUsageStatistics &) = delete;
+    MemoryUsageStatistics &operator=(const MemoryUsageStatistics &) = delete;
+
+    void recordAllocation(GraphicsAllocation &allocation);
+    void recordFree(GraphicsAllocation &allocation);
+
+    MemoryUsage getUsage(AllocationType allocationType, MemoryPool::Type memoryPool) const;
+    MemoryUsage getTotalUsage(bool localMemory) const;
+
+    void dump(std::ostream &out, uint32_t rootDeviceIndex) const;
+
+    static void enableDumpOnSignal(int signalNumber);
+    static bool isDumpRequested() {
+        return dumpRequested.load(std::memory_order_relaxed) && dumpRequested.exchange(false);
+    }
+
+  protected:
+    struct Counters {
+        std::atomic<uint64_t> liveBytes{0u};
+        std::atomic<uint64_t> peakBytes{0u};
+        std::atomic<uint64_t> allocationCount{0u};
+        std::atomic<uint64_t> osHandleCount{0u};
+    };
+
+    static void add(Counters &counters, uint64_t size, uint32_t osHandleCount);
+    static void subtract(Counters &counters, uint64_t size, uint32_t osHandleCount);
+    static MemoryUsage read(const Counters &counters);
+    static uint32_t getOsHandleCount(const GraphicsAllocation &allocation);
+    static void signalHandler(int signalNumber);
+
+    static std::atomic<bool> dumpRequested;
+
+    std::array<std::array<Counters, numMemoryPools>, numAllocationTypes> counters;
+    std::array<Counters, 2> totals;
+};
+
+} // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #include "shared/source/memory_manager/multi_graphics_allocation.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/memory_manager/memory_manager.h"
 
@@ -75,6 +76,12 @@ void MultiGraphicsAllocation::ensureMemoryOnDevice(MemoryManager &memoryManager,
         return;
     }
 
+    if (DebugManager.flags.EnableP2PMemoryMigration.get() &&
+        memoryManager.copyFromPeerAllocation(*getGraphicsAllocation(requiredRootDeviceIndex), *getGraphicsAllocation(lastUsedRootDeviceIndex))) {
+        lastUsedRootDeviceIndex = requiredRootDeviceIndex;
+        return;
+    }
+
     auto srcPtr = memoryManager.lockResource(getGraphicsAllocation(lastUsedRootDeviceIndex));
     auto dstPtr = memoryManager.lockResource(getGraphicsAllocation(requiredRootDeviceIndex));
 
@@ -9,6 +9,8 @@
 #include "shared/source/helpers/basic_math.h"
 #include "shared/source/memory_manager/memory_manager.h"
 
+#include <atomic>
+
 namespace NEO {
 constexpr size_t bigAllocation = 1 * MB;
 constexpr uintptr_t dummyAddress = 0xFFFFF000u;
@@ -101,7 +103,7 @@ class OsAgnosticMemoryManager : public MemoryManager {
                                              uint64_t count, MemoryPool::Type pool, uint32_t rootDeviceIndex, bool uncacheable, bool flushL3Required, bool requireSpecificBitness);
 
   private:
-    unsigned long long counter = 0;
+    std::atomic<unsigned long long> counter{0};
     bool fakeBigAllocations = false;
 };
 
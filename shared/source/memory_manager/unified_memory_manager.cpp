@@ -8,45 +8,39 @@
 #include "shared/source/memory_manager/unified_memory_manager.h"
 
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/execution_environment/execution_environment.h"
+#include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/utilities/trace_events.h"
 
 #include "opencl/source/mem_obj/mem_obj_helper.h"
 
 namespace NEO {
 
 void SVMAllocsManager::MapBasedAllocationTracker::insert(SvmAllocationData allocationsPair) {
-    allocations.insert(std::make_pair(reinterpret_cast<void *>(allocationsPair.gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress()), allocationsPair));
+    allocations.insert(std::make_pair(reinterpret_cast<void *>(allocationsPair.getGpuAddress()), allocationsPair));
 }
 
 void SVMAllocsManager::MapBasedAllocationTracker::remove(SvmAllocationData allocationsPair) {
     SvmAllocationContainer::iterator iter;
-    iter = allocations.find(reinterpret_cast<void *>(allocationsPair.gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress()));
+    iter = allocations.find(reinterpret_cast<void *>(allocationsPair.getGpuAddress()));
     allocations.erase(iter);
 }
 
 SvmAllocationData *SVMAllocsManager::MapBasedAllocationTracker::get(const void *ptr) {
-    SvmAllocationContainer::iterator Iter, End;
-    SvmAllocationData *svmAllocData;
     if ((ptr == nullptr) || (allocations.size() == 0)) {
         return nullptr;
     }
-    End = allocations.end();
-    Iter = allocations.lower_bound(ptr);
-    if (((Iter != End) && (Iter->first != ptr)) ||
-        (Iter == End)) {
-        if (Iter == allocations.begin()) {
-            Iter = End;
-        } else {
-            Iter--;
-        }
+    auto iter = allocations.upper_bound(ptr);
+    if (iter == allocations.begin()) {
+        return nullptr;
     }
-    if (Iter != End) {
-        svmAllocData = &Iter->second;
-        char *charPtr = reinterpret_cast<char *>(svmAllocData->gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress());
-        if (ptr < (charPtr + svmAllocData->size)) {
-            return svmAllocData;
-        }
+    --iter;
+    auto svmAllocData = &iter->second;
+    auto charPtr = reinterpret_cast<const char *>(iter->first);
+    if (ptr < (charPtr + svmAllocData->size)) {
+        return svmAllocData;
     }
     return nullptr;
 }
@@ -73,7 +67,8 @@ SvmMapOperation *SVMAllocsManager::MapOperationsTracker::get(const void *regionP
 void SVMAllocsManager::addInternalAllocationsToResidencyContainer(uint32_t rootDeviceIndex,
                                                                   ResidencyContainer &residencyContainer,
                                                                   uint32_t requestedTypesMask) {
-    std::unique_lock<SpinLock> lock(mtx);
+    std::shared_lock<std::shared_mutex> lock(mtx, std::defer_lock);
+    lockWithContentionTrace(lock, "svmAllocsManager");
     for (auto &allocation : this->SVMAllocs.allocations) {
         if (rootDeviceIndex >= allocation.second.gpuAllocations.getGraphicsAllocations().size()) {
             continue;
@@ -92,7 +87,8 @@ void SVMAllocsManager::addInternalAllocationsToResidencyContainer(uint32_t rootD
 }
 
 void SVMAllocsManager::makeInternalAllocationsResident(CommandStreamReceiver &commandStreamReceiver, uint32_t requestedTypesMask) {
-    std::unique_lock<SpinLock> lock(mtx);
+    std::shared_lock<std::shared_mutex> lock(mtx, std::defer_lock);
+    lockWithContentionTrace(lock, "svmAllocsManager");
     for (auto &allocation : this->SVMAllocs.allocations) {
         if (allocation.second.memoryType & requestedTypesMask) {
             auto gpuAllocation = allocation.second.gpuAllocations.getGraphicsAllocation(commandStreamReceiver.getRootDeviceIndex());
@@ -157,7 +153,8 @@ void *SVMAllocsManager::createHostUnifiedMemoryAllocation(size_t size,
     allocData.allocationFlagsProperty = memoryProperties.allocationFlags;
     allocData.device = nullptr;
 
-    std::unique_lock<SpinLock> lock(mtx);
+    std::unique_lock<std::shared_mutex> lock(mtx, std::defer_lock);
+    lockWithContentionTrace(lock, "svmAllocsManager");
     this->SVMAllocs.insert(allocData);
 
     return usmPtr;
@@ -190,6 +187,10 @@ void *SVMAllocsManager::createUnifiedMemoryAllocation(size_t size,
         unifiedMemoryProperties.flags.isUSMDeviceAllocation = false;
     }
 
+    if (isDeviceUsmPoolingAllowed(size, memoryProperties)) {
+        return createPooledUnifiedMemoryAllocation(size, memoryProperties, unifiedMemoryProperties);
+    }
+
     GraphicsAllocation *unifiedMemoryAllocation = memoryManager->allocateGraphicsMemoryWithProperties(unifiedMemoryProperties);
     if (!unifiedMemoryAllocation) {
         return nullptr;
@@ -204,7 +205,8 @@ void *SVMAllocsManager::createUnifiedMemoryAllocation(size_t size,
     allocData.allocationFlagsProperty = memoryProperties.allocationFlags;
     allocData.device = memoryProperties.device;
 
-    std::unique_lock<SpinLock> lock(mtx);
+    std::unique_lock<std::shared_mutex> lock(mtx, std::defer_lock);
+    lockWithContentionTrace(lock, "svmAllocsManager");
     this->SVMAllocs.insert(allocData);
     return reinterpret_cast<void *>(unifiedMemoryAllocation->getGpuAddress());
 }
@@ -267,6 +269,7 @@ void *SVMAllocsManager::createUnifiedKmdMigratedAllocation(size_t size, const Sv
                                        deviceBitfield};
 
     gpuProperties.alignment = 2 * MemoryConstants::megaByte;
+    gpuProperties.flags.preferSystemPlacement = !unifiedMemoryProperties.allocationFlags.allocFlags.usmInitialPlacementGpu;
     auto cacheRegion = MemoryPropertiesHelper::getCacheRegion(unifiedMemoryProperties.allocationFlags);
     MemoryPropertiesHelper::fillCachePolicyInProperties(gpuProperties, false, svmProperties.readOnly, false, cacheRegion);
     GraphicsAllocation *allocationGpu = memoryManager->allocateGraphicsMemoryWithProperties(gpuProperties);
@@ -281,7 +284,8 @@ void *SVMAllocsManager::createUnifiedKmdMigratedAllocation(size_t size, const Sv
     allocData.device = unifiedMemoryProperties.device;
     allocData.size = size;
 
-    std::unique_lock<SpinLock> lock(mtx);
+    std::unique_lock<std::shared_mutex> lock(mtx, std::defer_lock);
+    lockWithContentionTrace(lock, "svmAllocsManager");
     this->SVMAllocs.insert(allocData);
     return allocationGpu->getUnderlyingBuffer();
 }
@@ -292,17 +296,20 @@ void SVMAllocsManager::setUnifiedAllocationProperties(GraphicsAllocation *alloca
 }
 
 SvmAllocationData *SVMAllocsManager::getSVMAlloc(const void *ptr) {
-    std::unique_lock<SpinLock> lock(mtx);
+    std::shared_lock<std::shared_mutex> lock(mtx, std::defer_lock);
+    lockWithContentionTrace(lock, "svmAllocsManager");
     return SVMAllocs.get(ptr);
 }
 
 void SVMAllocsManager::insertSVMAlloc(const SvmAllocationData &svmAllocData) {
-    std::unique_lock<SpinLock> lock(mtx);
+    std::unique_lock<std::shared_mutex> lock(mtx, std::defer_lock);
+    lockWithContentionTrace(lock, "svmAllocsManager");
     SVMAllocs.insert(svmAllocData);
 }
 
 void SVMAllocsManager::removeSVMAlloc(const SvmAllocationData &svmAllocData) {
-    std::unique_lock<SpinLock> lock(mtx);
+    std::unique_lock<std::shared_mutex> lock(mtx, std::defer_lock);
+    lockWithContentionTrace(lock, "svmAllocsManager");
     SVMAllocs.remove(svmAllocData);
 }
 
@@ -325,12 +332,15 @@ bool SVMAllocsManager::freeSVMAlloc(void *ptr, bool blocking) {
         if (pageFaultManager) {
             pageFaultManager->removeAllocation(ptr);
         }
-        std::unique_lock<SpinLock> lock(mtx);
-        if (svmData->gpuAllocations.getAllocationType() == GraphicsAllocation::AllocationType::SVM_ZERO_COPY) {
+        if (svmData->isPooled()) {
+            freePooledUnifiedMemoryAllocation(svmData);
+        } else if (svmData->gpuAllocations.getAllocationType() == GraphicsAllocation::AllocationType::SVM_ZERO_COPY) {
             freeZeroCopySvmAllocation(svmData);
         } else {
             freeSvmAllocationWithDeviceStorage(svmData);
         }
+        // freed memory can be handed out again by the host allocator, so ranges bound before are not reused
+        invalidateSystemAllocations();
         return true;
     }
     return false;
@@ -360,7 +370,8 @@ void *SVMAllocsManager::createZeroCopySvmAllocation(size_t size, const SvmAlloca
     allocData.gpuAllocations.addAllocation(allocation);
     allocData.size = size;
 
-    std::unique_lock<SpinLock> lock(mtx);
+    std::unique_lock<std::shared_mutex> lock(mtx, std::defer_lock);
+    lockWithContentionTrace(lock, "svmAllocsManager");
     this->SVMAllocs.insert(allocData);
     return allocation->getUnderlyingBuffer();
 }
@@ -409,14 +420,15 @@ void *SVMAllocsManager::createUnifiedAllocationWithDeviceStorage(size_t size, co
     allocData.device = unifiedMemoryProperties.device;
     allocData.size = size;
 
-    std::unique_lock<SpinLock> lock(mtx);
+    std::unique_lock<std::shared_mutex> lock(mtx, std::defer_lock);
+    lockWithContentionTrace(lock, "svmAllocsManager");
     this->SVMAllocs.insert(allocData);
     return svmPtr;
 }
 
 void SVMAllocsManager::freeZeroCopySvmAllocation(SvmAllocationData *svmData) {
     GraphicsAllocation *gpuAllocation = svmData->gpuAllocations.getDefaultGraphicsAllocation();
-    SVMAllocs.remove(*svmData);
+    removeSVMAlloc(*svmData);
 
     memoryManager->freeGraphicsMemory(gpuAllocation);
 }
@@ -424,7 +436,7 @@ void SVMAllocsManager::freeZeroCopySvmAllocation(SvmAllocationData *svmData) {
 void SVMAllocsManager::freeSvmAllocationWithDeviceStorage(SvmAllocationData *svmData) {
     auto graphicsAllocations = svmData->gpuAllocations.getGraphicsAllocations();
     GraphicsAllocation *cpuAllocation = svmData->cpuAllocation;
-    SVMAllocs.remove(*svmData);
+    removeSVMAlloc(*svmData);
 
     for (auto gpuAllocation : graphicsAllocations) {
         memoryManager->freeGraphicsMemory(gpuAllocation);
@@ -432,8 +444,75 @@ void SVMAllocsManager::freeSvmAllocationWithDeviceStorage(SvmAllocationData *svm
     memoryManager->freeGraphicsMemory(cpuAllocation);
 }
 
+bool SVMAllocsManager::isDeviceUsmPoolingAllowed(size_t size, const UnifiedMemoryProperties &memoryProperties) const {
+    auto poolingMode = DebugManager.flags.EnableDeviceUsmAllocationPool.get();
+    if (poolingMode == 0 || (poolingMode == -1 && !memoryManager->isSmallAllocationPoolingPreferred())) {
+        return false;
+    }
+    if (memoryProperties.memoryType != InternalMemoryType::DEVICE_UNIFIED_MEMORY || memoryProperties.device == nullptr) {
+        return false;
+    }
+    if (poolingMode == -1 && size > UnifiedMemoryPool::defaultMaxPooledSize) {
+        return false;
+    }
+    auto &deviceBitfield = memoryProperties.subdeviceBitfields.at(memoryProperties.device->getRootDeviceIndex());
+    return UnifiedMemoryPool::isPoolableSize(size) &&
+           !memoryProperties.allocationFlags.flags.shareable &&
+           MemoryPropertiesHelper::getCacheRegion(memoryProperties.allocationFlags) == 0u &&
+           deviceBitfield.count() == 1;
+}
+
+void SVMAllocsManager::releaseDeviceUsmPools() {
+    std::unique_lock<std::mutex> lock(poolsMtx);
+    deviceUsmPools.clear();
+}
+
+void *SVMAllocsManager::createPooledUnifiedMemoryAllocation(size_t size, const UnifiedMemoryProperties &memoryProperties, const AllocationProperties &chunkProperties) {
+    UnifiedMemoryPool *pool = nullptr;
+    {
+        std::unique_lock<std::mutex> lock(poolsMtx);
+        auto &devicePool = deviceUsmPools[memoryProperties.device];
+        if (!devicePool) {
+            devicePool = std::make_unique<UnifiedMemoryPool>(memoryManager, chunkProperties);
+        }
+        pool = devicePool.get();
+    }
+
+    size_t offsetInChunk = 0u;
+    GraphicsAllocation *chunk = pool->allocate(size, offsetInChunk);
+    if (!chunk) {
+        return nullptr;
+    }
+
+    SvmAllocationData allocData(chunk->getRootDeviceIndex());
+    allocData.gpuAllocations.addAllocation(chunk);
+    allocData.cpuAllocation = nullptr;
+    allocData.size = size;
+    allocData.memoryType = memoryProperties.memoryType;
+    allocData.allocationFlagsProperty = memoryProperties.allocationFlags;
+    allocData.device = memoryProperties.device;
+    allocData.pool = pool;
+    allocData.offsetInAllocation = offsetInChunk;
+
+    std::unique_lock<std::shared_mutex> lock(mtx, std::defer_lock);
+    lockWithContentionTrace(lock, "svmAllocsManager");
+    this->SVMAllocs.insert(allocData);
+    return reinterpret_cast<void *>(allocData.getGpuAddress());
+}
+
+void SVMAllocsManager::freePooledUnifiedMemoryAllocation(SvmAllocationData *svmData) {
+    auto pool = svmData->pool;
+    auto chunk = svmData->gpuAllocations.getDefaultGraphicsAllocation();
+    auto offsetInChunk = svmData->offsetInAllocation;
+    auto size = svmData->size;
+    removeSVMAlloc(*svmData);
+
+    pool->free(chunk, offsetInChunk, size);
+}
+
 bool SVMAllocsManager::hasHostAllocations() {
-    std::unique_lock<SpinLock> lock(mtx);
+    std::shared_lock<std::shared_mutex> lock(mtx, std::defer_lock);
+    lockWithContentionTrace(lock, "svmAllocsManager");
     for (auto &allocation : this->SVMAllocs.allocations) {
         if (allocation.second.memoryType == InternalMemoryType::HOST_UNIFIED_MEMORY) {
             return true;
@@ -442,8 +521,115 @@ bool SVMAllocsManager::hasHostAllocations() {
     return false;
 }
 
+void SVMAllocsManager::setMemAdviseFlags(const void *ptr, MemAdviseFlags memAdviseFlags) {
+    auto svmData = getSVMAlloc(ptr);
+    if (svmData == nullptr) {
+        return;
+    }
+    svmData->memAdviseFlags = memAdviseFlags;
+
+    auto pageFaultManager = this->memoryManager->getPageFaultManager();
+    if (pageFaultManager && svmData->memoryType == InternalMemoryType::SHARED_UNIFIED_MEMORY) {
+        pageFaultManager->setMemAdviseFlags(const_cast<void *>(ptr), memAdviseFlags);
+    }
+}
+
+size_t SVMAllocsManager::getSystemAllocationBindGranularity() {
+    size_t granularity = MemoryConstants::pageSize64k;
+    if (DebugManager.flags.SharedSystemUsmBindGranularity.get() != -1) {
+        granularity = alignUp(static_cast<size_t>(DebugManager.flags.SharedSystemUsmBindGranularity.get()), MemoryConstants::pageSize);
+    }
+    return std::max(granularity, MemoryConstants::pageSize);
+}
+
+GraphicsAllocation *SVMAllocsManager::getSystemAllocationForGpuAccess(const void *ptr, uint32_t rootDeviceIndex, DeviceBitfield deviceBitfield) {
+    if (!memoryManager->peekExecutionEnvironment().rootDeviceEnvironments[rootDeviceIndex]->isFullRangeSvm()) {
+        // kernels get the CPU pointer as is, so the range has to be bound at the same GPU address
+        return nullptr;
+    }
+
+    std::unique_lock<std::mutex> lock(systemAllocationsMtx);
+    auto cached = systemAllocations.upper_bound(std::make_pair(rootDeviceIndex, ptr));
+    if (cached != systemAllocations.begin()) {
+        cached--;
+        auto &systemAllocation = cached->second;
+        if (cached->first.first == rootDeviceIndex && ptr < ptrOffset(cached->first.second, systemAllocation.allocation->getUnderlyingBufferSize())) {
+            if (systemAllocation.generation == systemAllocationsGeneration) {
+                systemAllocation.lastUse = ++systemAllocationsUseCounter;
+                return systemAllocation.allocation;
+            }
+            // the range may have been freed and mapped again since it was bound, so it is bound anew
+            memoryManager->checkGpuUsageAndDestroyGraphicsAllocations(systemAllocation.allocation);
+            systemAllocations.erase(cached);
+        }
+    }
+
+    // a range reaching unmapped memory cannot be bound, so the page of the pointer is tried alone next
+    auto address = reinterpret_cast<uintptr_t>(ptr);
+    for (auto rangeSize : {getSystemAllocationBindGranularity(), MemoryConstants::pageSize}) {
+        auto rangeStart = reinterpret_cast<const void *>(address - address % rangeSize);
+        auto key = std::make_pair(rootDeviceIndex, rangeStart);
+        auto existing = systemAllocations.find(key);
+        if (existing != systemAllocations.end()) {
+            if (existing->second.generation == systemAllocationsGeneration) {
+                continue;
+            }
+            memoryManager->checkGpuUsageAndDestroyGraphicsAllocations(existing->second.allocation);
+            systemAllocations.erase(existing);
+        }
+        // SVM_CPU keeps host pointer fragments at their CPU address, unlike EXTERNAL_HOST_PTR on platforms without host pointer tracking
+        AllocationProperties properties{rootDeviceIndex,
+                                        false, // allocateMemory
+                                        rangeSize, GraphicsAllocation::AllocationType::SVM_CPU,
+                                        false, // isMultiStorageAllocation
+                                        deviceBitfield};
+        auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(properties, rangeStart);
+        if (allocation) {
+            if (systemAllocations.size() >= maxSystemAllocations) {
+                evictSystemAllocation();
+            }
+            systemAllocations.insert(std::make_pair(key, SystemAllocation{allocation, systemAllocationsGeneration, ++systemAllocationsUseCounter}));
+            return allocation;
+        }
+    }
+    return nullptr;
+}
+
+void SVMAllocsManager::evictSystemAllocation() {
+    auto leastRecentlyUsed = systemAllocations.begin();
+    for (auto it = systemAllocations.begin(); it != systemAllocations.end(); it++) {
+        if (it->second.generation != systemAllocationsGeneration) {
+            leastRecentlyUsed = it;
+            break;
+        }
+        if (it->second.lastUse < leastRecentlyUsed->second.lastUse) {
+            leastRecentlyUsed = it;
+        }
+    }
+    memoryManager->checkGpuUsageAndDestroyGraphicsAllocations(leastRecentlyUsed->second.allocation);
+    systemAllocations.erase(leastRecentlyUsed);
+}
+
+void SVMAllocsManager::invalidateSystemAllocations() {
+    std::unique_lock<std::mutex> lock(systemAllocationsMtx);
+    systemAllocationsGeneration++;
+}
+
+void SVMAllocsManager::releaseSystemAllocations() {
+    std::unique_lock<std::mutex> lock(systemAllocationsMtx);
+    for (auto &systemAllocation : systemAllocations) {
+        memoryManager->checkGpuUsageAndDestroyGraphicsAllocations(systemAllocation.second.allocation);
+    }
+    systemAllocations.clear();
+}
+
+size_t SVMAllocsManager::getNumSystemAllocations() {
+    std::unique_lock<std::mutex> lock(systemAllocationsMtx);
+    return systemAllocations.size();
+}
+
 SvmMapOperation *SVMAllocsManager::getSvmMapOperation(const void *ptr) {
-    std::unique_lock<SpinLock> lock(mtx);
+    std::shared_lock<std::shared_mutex> lock(mapOperationsMtx);
     return svmMapOperations.get(ptr);
 }
 
@@ -454,12 +640,12 @@ void SVMAllocsManager::insertSvmMapOperation(void *regionSvmPtr, size_t regionSi
     svmMapOperation.offset = offset;
     svmMapOperation.regionSize = regionSize;
     svmMapOperation.readOnlyMap = readOnlyMap;
-    std::unique_lock<SpinLock> lock(mtx);
+    std::unique_lock<std::shared_mutex> lock(mapOperationsMtx);
     svmMapOperations.insert(svmMapOperation);
 }
 
 void SVMAllocsManager::removeSvmMapOperation(const void *regionSvmPtr) {
-    std::unique_lock<SpinLock> lock(mtx);
+    std::unique_lock<std::shared_mutex> lock(mapOperationsMtx);
     svmMapOperations.remove(regionSvmPtr);
 }
 
@@ -7,17 +7,20 @@
 
 #pragma once
 #include "shared/source/helpers/common_types.h"
+#include "shared/source/memory_manager/memadvise_flags.h"
 #include "shared/source/memory_manager/multi_graphics_allocation.h"
 #include "shared/source/memory_manager/residency_container.h"
+#include "shared/source/memory_manager/unified_memory_pool.h"
 #include "shared/source/unified_memory/unified_memory.h"
-#include "shared/source/utilities/spinlock.h"
 
 #include "memory_properties_flags.h"
 
 #include <cstdint>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <set>
+#include <shared_mutex>
 
 namespace NEO {
 class CommandStreamReceiver;
@@ -33,6 +36,9 @@ struct SvmAllocationData {
         this->device = svmAllocData.device;
         this->size = svmAllocData.size;
         this->memoryType = svmAllocData.memoryType;
+        this->pool = svmAllocData.pool;
+        this->offsetInAllocation = svmAllocData.offsetInAllocation;
+        this->memAdviseFlags = svmAllocData.memAdviseFlags;
         for (auto allocation : svmAllocData.gpuAllocations.getGraphicsAllocations()) {
             if (allocation) {
                 this->gpuAllocations.addAllocation(allocation);
@@ -40,12 +46,19 @@ struct SvmAllocationData {
         }
     }
     SvmAllocationData &operator=(const SvmAllocationData &) = delete;
+    uint64_t getGpuAddress() const {
+        return gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress() + offsetInAllocation;
+    }
+    bool isPooled() const { return pool != nullptr; }
     GraphicsAllocation *cpuAllocation = nullptr;
     MultiGraphicsAllocation gpuAllocations;
     size_t size = 0;
     InternalMemoryType memoryType = InternalMemoryType::SVM;
     MemoryProperties allocationFlagsProperty;
     Device *device = nullptr;
+    UnifiedMemoryPool *pool = nullptr;
+    size_t offsetInAllocation = 0u;
+    MemAdviseFlags memAdviseFlags;
 
   protected:
     const uint32_t maxRootDeviceIndex;
@@ -140,19 +153,46 @@ class SVMAllocsManager {
     void *createUnifiedAllocationWithDeviceStorage(size_t size, const SvmAllocationProperties &svmProperties, const UnifiedMemoryProperties &unifiedMemoryProperties);
     void freeSvmAllocationWithDeviceStorage(SvmAllocationData *svmData);
     bool hasHostAllocations();
+    void releaseDeviceUsmPools();
+    void setMemAdviseFlags(const void *ptr, MemAdviseFlags memAdviseFlags);
+    GraphicsAllocation *getSystemAllocationForGpuAccess(const void *ptr, uint32_t rootDeviceIndex, DeviceBitfield deviceBitfield);
+    void invalidateSystemAllocations();
+    void releaseSystemAllocations();
+    size_t getNumSystemAllocations();
+
+    static constexpr size_t maxSystemAllocations = 64;
 
   protected:
     void *createZeroCopySvmAllocation(size_t size, const SvmAllocationProperties &svmProperties,
                                       const std::set<uint32_t> &rootDeviceIndices,
                                       const std::map<uint32_t, DeviceBitfield> &subdeviceBitfields);
     GraphicsAllocation::AllocationType getGraphicsAllocationType(const UnifiedMemoryProperties &unifiedMemoryProperties) const;
+    bool isDeviceUsmPoolingAllowed(size_t size, const UnifiedMemoryProperties &memoryProperties) const;
+    void *createPooledUnifiedMemoryAllocation(size_t size, const UnifiedMemoryProperties &memoryProperties, const AllocationProperties &chunkProperties);
+    void freePooledUnifiedMemoryAllocation(SvmAllocationData *svmData);
 
     void freeZeroCopySvmAllocation(SvmAllocationData *svmData);
+    static size_t getSystemAllocationBindGranularity();
+    void evictSystemAllocation();
+
+    struct SystemAllocation {
+        GraphicsAllocation *allocation;
+        uint64_t generation;
+        uint64_t lastUse;
+    };
 
     MapBasedAllocationTracker SVMAllocs;
     MapOperationsTracker svmMapOperations;
+    std::map<Device *, std::unique_ptr<UnifiedMemoryPool>> deviceUsmPools;
+    std::mutex poolsMtx;
+    // host ranges of malloc'd memory bound on demand, keyed by root device index and aligned range start
+    std::map<std::pair<uint32_t, const void *>, SystemAllocation> systemAllocations;
+    std::mutex systemAllocationsMtx;
+    uint64_t systemAllocationsGeneration = 0;
+    uint64_t systemAllocationsUseCounter = 0;
     MemoryManager *memoryManager;
-    SpinLock mtx;
+    std::shared_mutex mtx;
+    std::shared_mutex mapOperationsMtx;
     bool multiOsContextSupport;
 };
 } // namespace NEO
@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/unified_memory_pool.h"
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/os_interface/os_context.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+UnifiedMemoryPool::UnifiedMemoryPool(MemoryManager *memoryManager, const AllocationProperties &chunkProperties)
+    : memoryManager(memoryManager), chunkProperties(chunkProperties) {
+    this->chunkProperties.size = chunkSize;
+    this->chunkProperties.alignment = chunkSize;
+}
+
+UnifiedMemoryPool::~UnifiedMemoryPool() {
+    for (auto chunk : chunks) {
+        memoryManager->waitForEnginesCompletion(*chunk);
+        memoryManager->freeGraphicsMemory(chunk);
+    }
+}
+
+size_t UnifiedMemoryPool::getSizeClass(size_t size) {
+    return std::max(static_cast<size_t>(Math::nextPowerOfTwo(static_cast<uint64_t>(size))), minSizeClass);
+}
+
+GraphicsAllocation *UnifiedMemoryPool::allocate(size_t size, size_t &offsetInChunk) {
+    UNRECOVERABLE_IF(!isPoolableSize(size));
+    auto sizeClass = getSizeClass(size);
+
+    std::unique_lock<std::mutex> lock(mtx);
+    auto &slots = freeSlots[sizeClass];
+    auto slot = std::find_if(slots.rbegin(), slots.rend(), [this](const FreeSlot &freeSlot) { return isSlotCompleted(freeSlot); });
+    if (slot == slots.rend()) {
+        auto chunk = allocateChunk();
+        if (!chunk) {
+            return nullptr;
+        }
+        chunks.push_back(chunk);
+        for (size_t offset = chunkSize - sizeClass; offset > 0u; offset -= sizeClass) {
+            slots.push_back({chunk, offset, {}});
+        }
+        offsetInChunk = 0u;
+        return chunk;
+    }
+
+    auto chunk = slot->chunk;
+    offsetInChunk = slot->offsetInChunk;
+    slots.erase(std::next(slot).base());
+    return chunk;
+}
+
+void UnifiedMemoryPool::free(GraphicsAllocation *chunk, size_t offsetInChunk, size_t size) {
+    FreeSlot slot{chunk, offsetInChunk, {}};
+    for (auto &engine : memoryManager->getRegisteredEngines()) {
+        auto osContextId = engine.osContext->getContextId();
+        auto chunkTaskCount = chunk->getTaskCount(osContextId);
+        if (chunk->isUsedByOsContext(osContextId) &&
+            chunkTaskCount > *engine.commandStreamReceiver->getTagAddress()) {
+            slot.pendingTaskCounts.push_back({osContextId, chunkTaskCount});
+        }
+    }
+
+    std::unique_lock<std::mutex> lock(mtx);
+    freeSlots[getSizeClass(size)].push_back(std::move(slot));
+}
+
+size_t UnifiedMemoryPool::getNumChunks() const {
+    std::unique_lock<std::mutex> lock(mtx);
+    return chunks.size();
+}
+
+size_t UnifiedMemoryPool::getNumFreeSlots(size_t size) const {
+    std::unique_lock<std::mutex> lock(mtx);
+    auto slots = freeSlots.find(getSizeClass(size));
+    return slots == freeSlots.end() ? 0u : slots->second.size();
+}
+
+bool UnifiedMemoryPool::isSlotCompleted(const FreeSlot &slot) const {
+    auto &engines = memoryManager->getRegisteredEngines();
+    for (auto &pendingTaskCount : slot.pendingTaskCounts) {
+        for (auto &engine : engines) {
+            if (engine.osContext->getContextId() == pendingTaskCount.first &&
+                pendingTaskCount.second > *engine.commandStreamReceiver->getTagAddress()) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+GraphicsAllocation *UnifiedMemoryPool::allocateChunk() {
+    auto chunk = memoryManager->allocateGraphicsMemoryWithProperties(chunkProperties);
+    if (chunk) {
+        chunk->setMemObjectsAllocationWithWritableFlags(true);
+        chunk->setCoherent(false);
+    }
+    return chunk;
+}
+
+} // namespace NEO
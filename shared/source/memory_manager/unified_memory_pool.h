@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/constants.h"
+#include "shared/source/memory_manager/allocation_properties.h"
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace NEO {
+class GraphicsAllocation;
+class MemoryManager;
+
+class UnifiedMemoryPool {
+  public:
+    static constexpr size_t chunkSize = 2 * MemoryConstants::megaByte;
+    static constexpr size_t minSizeClass = MemoryConstants::pageSize;
+    static constexpr size_t maxSizeClass = MemoryConstants::megaByte;
+    static constexpr size_t defaultMaxPooledSize = 64 * MemoryConstants::kiloByte;
+
+    UnifiedMemoryPool(MemoryManager *memoryManager, const AllocationProperties &chunkProperties);
+    MOCKABLE_VIRTUAL ~UnifiedMemoryPool();
+
+    UnifiedMemoryPool(const UnifiedMemoryPool &) = delete;
+    UnifiedMemoryPool &operator=(const UnifiedMemoryPool &) = delete;
+
+    static bool isPoolableSize(size_t size) { return size > 0u && size <= maxSizeClass; }
+    static size_t getSizeClass(size_t size);
+
+    GraphicsAllocation *allocate(size_t size, size_t &offsetInChunk);
+    void free(GraphicsAllocation *chunk, size_t offsetInChunk, size_t size);
+
+    size_t getNumChunks() const;
+    size_t getNumFreeSlots(size_t size) const;
+
+  protected:
+    struct FreeSlot {
+        GraphicsAllocation *chunk = nullptr;
+        size_t offsetInChunk = 0u;
+        std::vector<std::pair<uint32_t, uint32_t>> pendingTaskCounts;
+    };
+    using FreeSlots = std::vector<FreeSlot>;
+
+    bool isSlotCompleted(const FreeSlot &slot) const;
+    MOCKABLE_VIRTUAL GraphicsAllocation *allocateChunk();
+
+    MemoryManager *memoryManager;
+    AllocationProperties chunkProperties;
+    std::vector<GraphicsAllocation *> chunks;
+    std::map<size_t, FreeSlots> freeSlots;
+    mutable std::mutex mtx;
+};
+} // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,8 +9,36 @@
 
 #include "shared/source/utilities/io_functions.h"
 
+#include <cstring>
+
 namespace NEO {
 
+EnvironmentVariableReader::EnvironmentVariableReader(bool useEnvironmentSnapshot) {
+    if (!useEnvironmentSnapshot) {
+        return;
+    }
+    auto environment = IoFunctions::getEnvironmentPtr();
+    if (environment == nullptr) {
+        return;
+    }
+    for (auto entry = environment; *entry != nullptr; entry++) {
+        auto separator = strchr(*entry, '=');
+        if (separator == nullptr) {
+            continue;
+        }
+        environmentSnapshot.emplace(std::string(*entry, separator), std::string(separator + 1));
+    }
+    environmentSnapshotAvailable = true;
+}
+
+const char *EnvironmentVariableReader::getValue(const char *settingName) {
+    if (!environmentSnapshotAvailable) {
+        return IoFunctions::getenvPtr(settingName);
+    }
+    auto it = environmentSnapshot.find(settingName);
+    return it != environmentSnapshot.end() ? it->second.c_str() : nullptr;
+}
+
 const char *EnvironmentVariableReader::appSpecificLocation(const std::string &name) {
     return name.c_str();
 }
@@ -25,9 +53,7 @@ int32_t EnvironmentVariableReader::getSetting(const char *settingName, int32_t d
 
 int64_t EnvironmentVariableReader::getSetting(const char *settingName, int64_t defaultValue) {
     int64_t value = defaultValue;
-    char *envValue;
-
-    envValue = IoFunctions::getenvPtr(settingName);
+    auto envValue = getValue(settingName);
     if (envValue) {
         value = atoi(envValue);
     }
@@ -35,11 +61,10 @@ int64_t EnvironmentVariableReader::getSetting(const char *settingName, int64_t d
 }
 
 std::string EnvironmentVariableReader::getSetting(const char *settingName, const std::string &value) {
-    char *envValue;
     std::string keyValue;
     keyValue.assign(value);
 
-    envValue = IoFunctions::getenvPtr(settingName);
+    auto envValue = getValue(settingName);
     if (envValue) {
         keyValue.assign(envValue);
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,14 +10,26 @@
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/utilities/debug_settings_reader.h"
 
+#include <unordered_map>
+
 namespace NEO {
 
 class EnvironmentVariableReader : public SettingsReader {
   public:
+    EnvironmentVariableReader() = default;
+    // reads the whole environment once, for readers queried for many settings
+    EnvironmentVariableReader(bool useEnvironmentSnapshot);
+
     int32_t getSetting(const char *settingName, int32_t defaultValue) override;
     int64_t getSetting(const char *settingName, int64_t defaultValue) override;
     bool getSetting(const char *settingName, bool defaultValue) override;
     std::string getSetting(const char *settingName, const std::string &value) override;
     const char *appSpecificLocation(const std::string &name) override;
+
+  protected:
+    const char *getValue(const char *settingName);
+
+    bool environmentSnapshotAvailable = false;
+    std::unordered_map<std::string, std::string> environmentSnapshot;
 };
 } // namespace NEO
@@ -11,14 +11,20 @@
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/device/root_device.h"
+#include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/os_interface/aub_memory_operations_handler.h"
 #include "shared/source/os_interface/hw_info_config.h"
 #include "shared/source/os_interface/os_interface.h"
+#include "shared/source/utilities/parallel_for.h"
+#include "shared/source/utilities/trace_events.h"
 
 #include "hw_device_id.h"
 
+#include <algorithm>
+#include <thread>
+
 namespace NEO {
 
 bool DeviceFactory::prepareDeviceEnvironmentsForProductFamilyOverride(ExecutionEnvironment &executionEnvironment) {
@@ -91,8 +97,16 @@ bool DeviceFactory::isHwModeSelected() {
     }
 }
 
+uint32_t DeviceFactory::getRootDeviceInitializationWorkersCount(size_t numRootDevices) {
+    if (DebugManager.flags.ParallelRootDeviceInitialization.get() == 0) {
+        return 1u;
+    }
+    return static_cast<uint32_t>(std::min(numRootDevices, static_cast<size_t>(std::max(std::thread::hardware_concurrency(), 1u))));
+}
+
 bool DeviceFactory::prepareDeviceEnvironments(ExecutionEnvironment &executionEnvironment) {
     using HwDeviceIds = std::vector<std::unique_ptr<HwDeviceId>>;
+    ScopedTraceEvent traceEvent("deviceDiscovery", TraceEvents::Category::initialization);
 
     HwDeviceIds hwDeviceIds = OSInterface::discoverDevices(executionEnvironment);
     if (hwDeviceIds.empty()) {
@@ -101,24 +115,40 @@ bool DeviceFactory::prepareDeviceEnvironments(ExecutionEnvironment &executionEnv
 
     executionEnvironment.prepareRootDeviceEnvironments(static_cast<uint32_t>(hwDeviceIds.size()));
 
-    uint32_t rootDeviceIndex = 0u;
+    auto initRootDeviceEnvironment = [&](size_t rootDeviceIndex) {
+        // devices masked out by ZE_AFFINITY_MASK are filtered out by parseAffinityMask, skip their full initialization
+        if (!ExecutionEnvironment::isRootDeviceSelectedByAffinityMask(static_cast<uint32_t>(rootDeviceIndex))) {
+            return true;
+        }
 
-    for (auto &hwDeviceId : hwDeviceIds) {
-        if (!executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->initOsInterface(std::move(hwDeviceId), rootDeviceIndex)) {
+        auto rootDeviceEnvironment = executionEnvironment.rootDeviceEnvironments[rootDeviceIndex].get();
+        if (!rootDeviceEnvironment->initOsInterface(std::move(hwDeviceIds[rootDeviceIndex]), static_cast<uint32_t>(rootDeviceIndex))) {
             return false;
         }
 
         if (DebugManager.flags.OverrideGpuAddressSpace.get() != -1) {
-            executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->getMutableHardwareInfo()->capabilityTable.gpuAddressSpace =
+            rootDeviceEnvironment->getMutableHardwareInfo()->capabilityTable.gpuAddressSpace =
                 maxNBitValue(static_cast<uint64_t>(DebugManager.flags.OverrideGpuAddressSpace.get()));
         }
 
         if (DebugManager.flags.OverrideRevision.get() != -1) {
-            executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->getMutableHardwareInfo()->platform.usRevId =
+            rootDeviceEnvironment->getMutableHardwareInfo()->platform.usRevId =
                 static_cast<unsigned short>(DebugManager.flags.OverrideRevision.get());
         }
+        return true;
+    };
+
+    // each root device opens and queries its own device node, so they can be initialized concurrently;
+    // results are stored by index to keep the device order
+    std::vector<uint8_t> initResults(hwDeviceIds.size(), 0u);
+    ParallelFor::run(hwDeviceIds.size(), getRootDeviceInitializationWorkersCount(hwDeviceIds.size()), [&](size_t rootDeviceIndex) {
+        initResults[rootDeviceIndex] = initRootDeviceEnvironment(rootDeviceIndex);
+    });
 
-        rootDeviceIndex++;
+    for (auto initResult : initResults) {
+        if (!initResult) {
+            return false;
+        }
     }
 
     executionEnvironment.parseAffinityMask();
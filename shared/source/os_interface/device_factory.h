@@ -6,6 +6,7 @@
  */
 
 #pragma once
+#include <cstdint>
 #include <cstdlib>
 #include <memory>
 #include <vector>
@@ -21,6 +22,7 @@ class DeviceFactory {
     static bool prepareDeviceEnvironmentsForProductFamilyOverride(ExecutionEnvironment &executionEnvironment);
     static std::vector<std::unique_ptr<Device>> createDevices(ExecutionEnvironment &executionEnvironment);
     static bool isHwModeSelected();
+    static uint32_t getRootDeviceInitializationWorkersCount(size_t numRootDevices);
 
     static std::unique_ptr<Device> (*createRootDeviceFunc)(ExecutionEnvironment &executionEnvironment, uint32_t rootDeviceIndex);
     static bool (*createMemoryManagerFunc)(ExecutionEnvironment &executionEnvironment);
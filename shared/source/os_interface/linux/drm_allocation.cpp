@@ -50,26 +50,30 @@ bool DrmAllocation::setCacheAdvice(Drm *drm, size_t regionSize, CacheRegion regi
     return true;
 }
 
-void DrmAllocation::makeBOsResident(OsContext *osContext, uint32_t vmHandleId, std::vector<BufferObject *> *bufferObjects, bool bind) {
+int DrmAllocation::makeBOsResident(OsContext *osContext, uint32_t vmHandleId, std::vector<BufferObject *> *bufferObjects, bool bind) {
     if (this->fragmentsStorage.fragmentCount) {
         for (unsigned int f = 0; f < this->fragmentsStorage.fragmentCount; f++) {
             if (!this->fragmentsStorage.fragmentStorageData[f].residency->resident[osContext->getContextId()]) {
-                bindBO(this->fragmentsStorage.fragmentStorageData[f].osHandleStorage->bo, osContext, vmHandleId, bufferObjects, bind);
+                auto retVal = bindBO(this->fragmentsStorage.fragmentStorageData[f].osHandleStorage->bo, osContext, vmHandleId, bufferObjects, bind);
+                if (retVal) {
+                    return retVal;
+                }
                 this->fragmentsStorage.fragmentStorageData[f].residency->resident[osContext->getContextId()] = true;
             }
         }
-    } else {
-        bindBOs(osContext, vmHandleId, bufferObjects, bind);
+        return 0;
     }
+    return bindBOs(osContext, vmHandleId, bufferObjects, bind);
 }
 
-void DrmAllocation::bindBO(BufferObject *bo, OsContext *osContext, uint32_t vmHandleId, std::vector<BufferObject *> *bufferObjects, bool bind) {
+int DrmAllocation::bindBO(BufferObject *bo, OsContext *osContext, uint32_t vmHandleId, std::vector<BufferObject *> *bufferObjects, bool bind) {
+    auto retVal = 0;
     if (bo) {
         if (bufferObjects) {
             if (bo->peekIsReusableAllocation()) {
                 for (auto bufferObject : *bufferObjects) {
                     if (bufferObject == bo) {
-                        return;
+                        return 0;
                     }
                 }
             }
@@ -77,15 +81,14 @@ void DrmAllocation::bindBO(BufferObject *bo, OsContext *osContext, uint32_t vmHa
             bufferObjects->push_back(bo);
 
         } else {
-            auto retVal = 0;
             if (bind) {
                 retVal = bo->bind(osContext, vmHandleId);
             } else {
                 retVal = bo->unbind(osContext, vmHandleId);
             }
-            UNRECOVERABLE_IF(retVal);
         }
     }
+    return retVal;
 }
 
 void DrmAllocation::registerBOBindExtHandle(Drm *drm) {
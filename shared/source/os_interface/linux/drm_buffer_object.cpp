@@ -13,7 +13,9 @@
 #include "shared/source/os_interface/linux/drm_neo.h"
 #include "shared/source/os_interface/linux/os_time_linux.h"
 #include "shared/source/os_interface/os_context.h"
+#include "shared/source/utilities/launch_overhead_profiler.h"
 #include "shared/source/utilities/stackvec.h"
+#include "shared/source/utilities/trace_events.h"
 
 #include "drm/i915_drm.h"
 
@@ -112,29 +114,38 @@ uint32_t BufferObject::getOsContextId(OsContext *osContext) {
     return perContextVmsUsed ? osContext->getContextId() : 0u;
 }
 
+uint64_t BufferObject::getExecObjectFlags() const {
+    uint64_t flags = EXEC_OBJECT_PINNED | EXEC_OBJECT_SUPPORTS_48B_ADDRESS;
+
+    if (DebugManager.flags.UseAsyncDrmExec.get() == 1) {
+        flags |= EXEC_OBJECT_ASYNC;
+    }
+
+    if (this->allowCapture) {
+        flags |= EXEC_OBJECT_CAPTURE;
+    }
+    return flags;
+}
+
 void BufferObject::fillExecObject(drm_i915_gem_exec_object2 &execObject, OsContext *osContext, uint32_t vmHandleId, uint32_t drmContextId) {
     execObject.handle = this->handle;
     execObject.relocation_count = 0; //No relocations, we are SoftPinning
     execObject.relocs_ptr = 0ul;
     execObject.alignment = 0;
     execObject.offset = this->gpuAddress;
-    execObject.flags = EXEC_OBJECT_PINNED | EXEC_OBJECT_SUPPORTS_48B_ADDRESS;
-
-    if (DebugManager.flags.UseAsyncDrmExec.get() == 1) {
-        execObject.flags |= EXEC_OBJECT_ASYNC;
-    }
-
-    if (this->isMarkedForCapture()) {
-        execObject.flags |= EXEC_OBJECT_CAPTURE;
-    }
+    execObject.flags = getExecObjectFlags();
     execObject.rsvd1 = drmContextId;
     execObject.rsvd2 = 0;
 
     this->fillExecObjectImpl(execObject, osContext, vmHandleId);
 }
 
-int BufferObject::exec(uint32_t used, size_t startOffset, unsigned int flags, bool requiresCoherency, OsContext *osContext, uint32_t vmHandleId, uint32_t drmContextId, BufferObject *const residency[], size_t residencyCount, drm_i915_gem_exec_object2 *execObjectsStorage) {
+int BufferObject::exec(uint32_t used, size_t startOffset, unsigned int flags, bool requiresCoherency, OsContext *osContext, uint32_t vmHandleId, uint32_t drmContextId, BufferObject *const residency[], size_t residencyCount, drm_i915_gem_exec_object2 *execObjectsStorage, bool reuseFilledExecObjects) {
     for (size_t i = 0; i < residencyCount; i++) {
+        // exec object storage persists between submissions, only slots which changed since last exec have to be filled
+        if (reuseFilledExecObjects && residency[i]->isExecObjectFilled(execObjectsStorage[i], drmContextId)) {
+            continue;
+        }
         residency[i]->fillExecObject(execObjectsStorage[i], osContext, vmHandleId, drmContextId);
     }
     this->fillExecObject(execObjectsStorage[residencyCount], osContext, vmHandleId, drmContextId);
@@ -151,6 +162,8 @@ int BufferObject::exec(uint32_t used, size_t startOffset, unsigned int flags, bo
         printExecutionBuffer(execbuf, residencyCount, execObjectsStorage, residency);
     }
 
+    ScopedTraceEvent traceEvent("execbuffer", TraceEvents::Category::ioctl);
+    ScopedLaunchPhase launchPhase(LaunchOverheadProfiler::Phase::execIoctl);
     int ret = this->drm->ioctl(DRM_IOCTL_I915_GEM_EXECBUFFER2, &execbuf);
     if (ret == 0) {
         return 0;
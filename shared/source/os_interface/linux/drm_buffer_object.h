@@ -47,7 +47,7 @@ class BufferObject {
     int pin(BufferObject *const boToPin[], size_t numberOfBos, OsContext *osContext, uint32_t vmHandleId, uint32_t drmContextId);
     MOCKABLE_VIRTUAL int validateHostPtr(BufferObject *const boToPin[], size_t numberOfBos, OsContext *osContext, uint32_t vmHandleId, uint32_t drmContextId);
 
-    int exec(uint32_t used, size_t startOffset, unsigned int flags, bool requiresCoherency, OsContext *osContext, uint32_t vmHandleId, uint32_t drmContextId, BufferObject *const residency[], size_t residencyCount, drm_i915_gem_exec_object2 *execObjectsStorage);
+    int exec(uint32_t used, size_t startOffset, unsigned int flags, bool requiresCoherency, OsContext *osContext, uint32_t vmHandleId, uint32_t drmContextId, BufferObject *const residency[], size_t residencyCount, drm_i915_gem_exec_object2 *execObjectsStorage, bool reuseFilledExecObjects = false);
 
     int bind(OsContext *osContext, uint32_t vmHandleId);
     int unbind(OsContext *osContext, uint32_t vmHandleId);
@@ -79,6 +79,12 @@ class BufferObject {
     bool isMarkedForCapture() {
         return allowCapture;
     }
+    bool isExecObjectFilled(const drm_i915_gem_exec_object2 &execObject, uint32_t drmContextId) const {
+        return execObject.handle == static_cast<uint32_t>(this->handle) &&
+               execObject.offset == this->gpuAddress &&
+               execObject.flags == getExecObjectFlags() &&
+               execObject.rsvd1 == drmContextId;
+    }
     void setCacheRegion(CacheRegion regionIndex) { cacheRegion = regionIndex; }
     CacheRegion peekCacheRegion() const { return cacheRegion; }
 
@@ -98,6 +104,7 @@ class BufferObject {
     uint32_t getOsContextId(OsContext *osContext);
     MOCKABLE_VIRTUAL void fillExecObject(drm_i915_gem_exec_object2 &execObject, OsContext *osContext, uint32_t vmHandleId, uint32_t drmContextId);
     void fillExecObjectImpl(drm_i915_gem_exec_object2 &execObject, OsContext *osContext, uint32_t vmHandleId);
+    uint64_t getExecObjectFlags() const;
 
     uint64_t gpuAddress = 0llu;
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,7 @@
 #include "shared/source/os_interface/linux/drm_gem_close_worker.h"
 
 #include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/os_interface/linux/drm_allocation.h"
 #include "shared/source/os_interface/linux/drm_buffer_object.h"
 #include "shared/source/os_interface/linux/drm_memory_manager.h"
 #include "shared/source/os_interface/os_thread.h"
@@ -49,6 +50,14 @@ void DrmGemCloseWorker::push(BufferObject *bo) {
     condition.notify_one();
 }
 
+void DrmGemCloseWorker::pushAllocation(DrmAllocation *allocation) {
+    std::unique_lock<std::mutex> lock(closeWorkerMutex);
+    workCount++;
+    allocationQueue.push(allocation);
+    lock.unlock();
+    condition.notify_one();
+}
+
 void DrmGemCloseWorker::close(bool blocking) {
     active = false;
     condition.notify_all();
@@ -67,10 +76,31 @@ inline void DrmGemCloseWorker::close(BufferObject *bo) {
     workCount--;
 }
 
+void DrmGemCloseWorker::release(std::queue<DrmAllocation *> &allocations) {
+    std::queue<DrmAllocation *> idleAllocations;
+    while (!allocations.empty()) {
+        auto allocation = allocations.front();
+        allocations.pop();
+        for (auto bo : allocation->getBOs()) {
+            if (bo) {
+                bo->wait(-1);
+            }
+        }
+        idleAllocations.push(allocation);
+    }
+
+    while (!idleAllocations.empty()) {
+        memoryManager.releaseDeferredAllocation(idleAllocations.front());
+        idleAllocations.pop();
+        workCount--;
+    }
+}
+
 void *DrmGemCloseWorker::worker(void *arg) {
     DrmGemCloseWorker *self = reinterpret_cast<DrmGemCloseWorker *>(arg);
     BufferObject *workItem = nullptr;
     std::queue<BufferObject *> localQueue;
+    std::queue<DrmAllocation *> localAllocationQueue;
     std::unique_lock<std::mutex> lock(self->closeWorkerMutex);
     lock.unlock();
 
@@ -78,13 +108,16 @@ void *DrmGemCloseWorker::worker(void *arg) {
         lock.lock();
         workItem = nullptr;
 
-        while (self->queue.empty() && self->active) {
+        while (self->queue.empty() && self->allocationQueue.empty() && self->active) {
             self->condition.wait(lock);
         }
 
         if (!self->queue.empty()) {
             localQueue.swap(self->queue);
         }
+        if (!self->allocationQueue.empty()) {
+            localAllocationQueue.swap(self->allocationQueue);
+        }
 
         lock.unlock();
         while (!localQueue.empty()) {
@@ -92,6 +125,7 @@ void *DrmGemCloseWorker::worker(void *arg) {
             localQueue.pop();
             self->close(workItem);
         }
+        self->release(localAllocationQueue);
     }
 
     lock.lock();
@@ -100,6 +134,7 @@ void *DrmGemCloseWorker::worker(void *arg) {
         self->queue.pop();
         self->close(workItem);
     }
+    self->release(self->allocationQueue);
 
     lock.unlock();
     self->workerDone.store(true);
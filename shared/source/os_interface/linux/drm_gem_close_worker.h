@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -16,6 +16,7 @@
 
 namespace NEO {
 class DrmMemoryManager;
+class DrmAllocation;
 class BufferObject;
 class Thread;
 
@@ -33,12 +34,15 @@ class DrmGemCloseWorker {
     DrmGemCloseWorker &operator=(const DrmGemCloseWorker &) = delete;
 
     void push(BufferObject *allocation);
+    void pushAllocation(DrmAllocation *allocation);
     void close(bool blocking);
 
     bool isEmpty();
+    bool isActive() const { return active; }
 
   protected:
     void close(BufferObject *workItem);
+    void release(std::queue<DrmAllocation *> &allocations);
     void closeThread();
     static void *worker(void *arg);
     std::atomic<bool> active{true};
@@ -46,6 +50,7 @@ class DrmGemCloseWorker {
     std::unique_ptr<Thread> thread;
 
     std::queue<BufferObject *> queue;
+    std::queue<DrmAllocation *> allocationQueue;
     std::atomic<uint32_t> workCount{0};
 
     DrmMemoryManager &memoryManager;
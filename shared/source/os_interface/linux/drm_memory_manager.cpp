@@ -28,7 +28,10 @@
 
 #include <cstring>
 #include <iostream>
+#include <linux/mempolicy.h>
 #include <memory>
+#include <sys/syscall.h>
+#include <unistd.h>
 
 namespace NEO {
 
@@ -64,6 +67,10 @@ void DrmMemoryManager::initialize(gemCloseWorkerMode mode) {
         gemCloseWorker.reset(new DrmGemCloseWorker(*this));
     }
 
+    if (DebugManager.flags.UserptrCacheSize.get() > 0) {
+        userptrCache = std::make_unique<DrmUserptrCache>(static_cast<size_t>(DebugManager.flags.UserptrCacheSize.get()));
+    }
+
     for (uint32_t rootDeviceIndex = 0; rootDeviceIndex < gfxPartitions.size(); ++rootDeviceIndex) {
         BufferObject *bo = nullptr;
         if (forcePinEnabled || validateHostPtrMemory) {
@@ -101,9 +108,21 @@ DrmMemoryManager::~DrmMemoryManager() {
     }
 }
 
+void DrmMemoryManager::prepareForFastTeardown() {
+    MemoryManager::prepareForFastTeardown();
+    gemCloseWorker.reset();
+}
+
 void DrmMemoryManager::commonCleanup() {
     if (gemCloseWorker) {
-        gemCloseWorker->close(false);
+        gemCloseWorker->close(DebugManager.flags.EnableGemCloseWorkerAllocationFree.get() == 1);
+    }
+
+    if (userptrCache) {
+        for (auto bo : userptrCache->takeAll()) {
+            bo->wait(-1);
+            unreference(bo, true);
+        }
     }
 
     for (uint32_t rootDeviceIndex = 0; rootDeviceIndex < pinBBs.size(); ++rootDeviceIndex) {
@@ -232,6 +251,12 @@ DrmAllocation *DrmMemoryManager::allocateGraphicsMemoryWithAlignment(const Alloc
     // It's needed to prevent overlapping pages with user pointers
     size_t cSize = std::max(alignUp(allocationData.size, minAlignment), minAlignment);
 
+    auto useHugePages = isHugePageAllocationPreferred(allocationData);
+    if (useHugePages) {
+        cAlignment = std::max(cAlignment, MemoryConstants::pageSize2Mb);
+        cSize = alignUp(cSize, MemoryConstants::pageSize2Mb);
+    }
+
     uint64_t gpuAddress = 0;
     size_t alignedSize = cSize;
     auto svmCpuAllocation = allocationData.type == GraphicsAllocation::AllocationType::SVM_CPU;
@@ -242,7 +267,8 @@ DrmAllocation *DrmMemoryManager::allocateGraphicsMemoryWithAlignment(const Alloc
 
     // if limitedRangeAlloction is enabled, memory allocation for bo in the limited Range heap is required
     if ((isLimitedRange(allocationData.rootDeviceIndex) || svmCpuAllocation) && !allocationData.flags.isUSMHostAllocation) {
-        gpuAddress = acquireGpuRange(alignedSize, allocationData.rootDeviceIndex, HeapIndex::HEAP_STANDARD);
+        auto heapIndex = (useHugePages && !svmCpuAllocation) ? HeapIndex::HEAP_STANDARD2MB : HeapIndex::HEAP_STANDARD;
+        gpuAddress = acquireGpuRange(alignedSize, allocationData.rootDeviceIndex, heapIndex);
         if (!gpuAddress) {
             return nullptr;
         }
@@ -255,12 +281,100 @@ DrmAllocation *DrmMemoryManager::allocateGraphicsMemoryWithAlignment(const Alloc
     return createAllocWithAlignment(allocationData, cSize, cAlignment, alignedSize, gpuAddress);
 }
 
+bool DrmMemoryManager::isLocalMemoryOversubscriptionEnabled() const {
+    return DebugManager.flags.EnableLocalMemoryOversubscription.get() == 1;
+}
+
+bool DrmMemoryManager::evictColdLocalMemoryAllocation(uint32_t rootDeviceIndex) {
+    if (!isLocalMemoryOversubscriptionEnabled()) {
+        return false;
+    }
+    auto memoryOperationsInterface = static_cast<DrmMemoryOperationsHandler *>(executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->memoryOperationsInterface.get());
+    if (!memoryOperationsInterface) {
+        return false;
+    }
+    return memoryOperationsInterface->evictColdAllocation(true);
+}
+
+bool DrmMemoryManager::isHugePageAllocationPreferred(const AllocationData &allocationData) const {
+    if (DebugManager.flags.HugePageAllocationThreshold.get() < 0 ||
+        allocationData.size < static_cast<size_t>(DebugManager.flags.HugePageAllocationThreshold.get())) {
+        return false;
+    }
+    if (allocationData.alignment > MemoryConstants::pageSize2Mb) {
+        return false;
+    }
+    switch (allocationData.type) {
+    case GraphicsAllocation::AllocationType::BUFFER:
+    case GraphicsAllocation::AllocationType::BUFFER_HOST_MEMORY:
+    case GraphicsAllocation::AllocationType::SVM_CPU:
+    case GraphicsAllocation::AllocationType::SVM_ZERO_COPY:
+        return true;
+    default:
+        return false;
+    }
+}
+
+int DrmMemoryManager::getPreferredNumaNode(const AllocationData &allocationData) const {
+    if (DebugManager.flags.EnableHostMemoryNumaBinding.get() != 1) {
+        return -1;
+    }
+
+    bool bindingAllowed = false;
+    if (DebugManager.flags.NumaBindingAllocationTypeMask.get()) {
+        bindingAllowed = (1llu << (static_cast<int64_t>(allocationData.type) - 1)) & DebugManager.flags.NumaBindingAllocationTypeMask.get();
+    } else {
+        switch (allocationData.type) {
+        case GraphicsAllocation::AllocationType::BUFFER_HOST_MEMORY:
+        case GraphicsAllocation::AllocationType::COMMAND_BUFFER:
+        case GraphicsAllocation::AllocationType::PROFILING_TAG_BUFFER:
+        case GraphicsAllocation::AllocationType::SVM_CPU:
+        case GraphicsAllocation::AllocationType::SVM_ZERO_COPY:
+        case GraphicsAllocation::AllocationType::TAG_BUFFER:
+        case GraphicsAllocation::AllocationType::TIMESTAMP_PACKET_TAG_BUFFER:
+            bindingAllowed = true;
+            break;
+        default:
+            break;
+        }
+    }
+    if (!bindingAllowed) {
+        return -1;
+    }
+
+    if (DebugManager.flags.ForceNumaNode.get() != -1) {
+        return DebugManager.flags.ForceNumaNode.get();
+    }
+    return getDrm(allocationData.rootDeviceIndex).getNumaNode();
+}
+
+void DrmMemoryManager::bindToNumaNode(void *ptr, size_t size, int numaNode) {
+    constexpr auto bitsPerMaskEntry = sizeof(unsigned long) * 8;
+    if (numaNode < 0 || static_cast<size_t>(numaNode) >= bitsPerMaskEntry) {
+        return;
+    }
+
+    unsigned long nodeMask = 1ul << numaNode;
+    // Preferred policy falls back to other nodes when the device node runs out of memory
+    [[maybe_unused]] auto retVal = this->mbindFunction(ptr, size, MPOL_PREFERRED, &nodeMask, bitsPerMaskEntry, MPOL_MF_MOVE);
+}
+
+long DrmMemoryManager::mbindSyscall(void *addr, unsigned long len, int mode, const unsigned long *nodemask, unsigned long maxnode, unsigned int flags) {
+    return syscall(SYS_mbind, addr, len, mode, nodemask, maxnode, flags);
+}
+
 DrmAllocation *DrmMemoryManager::createAllocWithAlignmentFromUserptr(const AllocationData &allocationData, size_t size, size_t alignment, size_t alignedSVMSize, uint64_t gpuAddress) {
     auto res = alignedMallocWrapper(size, alignment);
     if (!res) {
         return nullptr;
     }
 
+    if (isHugePageAllocationPreferred(allocationData)) {
+        // Advisory only, allocation stays valid when transparent huge pages are not available
+        [[maybe_unused]] auto retVal = this->madviseFunction(res, size, MADV_HUGEPAGE);
+    }
+    bindToNumaNode(res, size, getPreferredNumaNode(allocationData));
+
     std::unique_ptr<BufferObject, BufferObject::Deleter> bo(allocUserptr(reinterpret_cast<uintptr_t>(res), size, 0, allocationData.rootDeviceIndex));
     if (!bo) {
         alignedFreeWrapper(res);
@@ -364,6 +478,7 @@ GraphicsAllocation *DrmMemoryManager::allocateGraphicsMemoryWithGpuVa(const Allo
 
     BufferObject *boPtr = bo.get();
     if (forcePinEnabled && pinBBs.at(allocationData.rootDeviceIndex) != nullptr && alignedSize >= this->pinThreshold) {
+        osContextLinux->ensureContextInitialized();
         pinBBs.at(allocationData.rootDeviceIndex)->pin(&boPtr, 1, osContextLinux, 0, osContextLinux->getDrmContextIds()[0]);
     }
 
@@ -548,10 +663,11 @@ DrmAllocation *DrmMemoryManager::allocate32BitGraphicsMemoryImpl(const Allocatio
     return allocation;
 }
 
-BufferObject *DrmMemoryManager::findAndReferenceSharedBufferObject(int boHandle) {
+BufferObject *DrmMemoryManager::findAndReferenceSharedBufferObject(int boHandle, uint32_t rootDeviceIndex) {
     BufferObject *bo = nullptr;
+    // gem handles are only unique per drm device
     for (const auto &i : sharingBufferObjects) {
-        if (i->handle == boHandle) {
+        if (i->handle == boHandle && i->drm == &getDrm(rootDeviceIndex)) {
             bo = i;
             bo->reference();
             break;
@@ -578,7 +694,7 @@ GraphicsAllocation *DrmMemoryManager::createGraphicsAllocationFromSharedHandle(o
     }
 
     auto boHandle = openFd.handle;
-    auto bo = findAndReferenceSharedBufferObject(boHandle);
+    auto bo = findAndReferenceSharedBufferObject(boHandle, properties.rootDeviceIndex);
 
     if (bo == nullptr) {
         size_t size = lseekFunction(handle, 0, SEEK_END);
@@ -628,6 +744,20 @@ GraphicsAllocation *DrmMemoryManager::createGraphicsAllocationFromSharedHandle(o
     return drmAllocation;
 }
 
+GraphicsAllocation *DrmMemoryManager::createPeerAllocation(GraphicsAllocation &allocation, uint32_t rootDeviceIndex) {
+    auto handle = static_cast<osHandle>(allocation.peekInternalHandle(this));
+    if (handle == 0) {
+        return nullptr;
+    }
+
+    AllocationProperties properties(rootDeviceIndex, false, allocation.getUnderlyingBufferSize(), allocation.getAllocationType(), false, systemMemoryBitfield);
+    auto peerAllocation = createGraphicsAllocationFromSharedHandle(handle, properties, false);
+    if (peerAllocation == nullptr) {
+        closeFunction(handle);
+    }
+    return peerAllocation;
+}
+
 void DrmMemoryManager::closeSharedHandle(GraphicsAllocation *gfxAllocation) {
     DrmAllocation *drmAllocation = static_cast<DrmAllocation *>(gfxAllocation);
     if (drmAllocation->peekSharedHandle() != Sharing::nonSharedResource) {
@@ -691,7 +821,8 @@ void DrmMemoryManager::freeGraphicsMemoryImpl(GraphicsAllocation *gfxAllocation)
     DrmAllocation *drmAlloc = static_cast<DrmAllocation *>(gfxAllocation);
     this->unregisterAllocation(gfxAllocation);
 
-    if (drmAlloc->getMmapPtr()) {
+    bool deferRelease = isAllocationReleaseDeferrable(*drmAlloc);
+    if (drmAlloc->getMmapPtr() && !deferRelease) {
         this->munmapFunction(drmAlloc->getMmapPtr(), drmAlloc->getMmapSize());
     }
 
@@ -704,6 +835,12 @@ void DrmMemoryManager::freeGraphicsMemoryImpl(GraphicsAllocation *gfxAllocation)
         delete gfxAllocation->getGmm(handleId);
     }
 
+    if (deferRelease) {
+        drmAlloc->freeRegisteredBOBindExtHandles(&getDrm(drmAlloc->getRootDeviceIndex()));
+        gemCloseWorker->pushAllocation(drmAlloc);
+        return;
+    }
+
     if (gfxAllocation->fragmentsStorage.fragmentCount) {
         cleanGraphicsMemoryCreatedFromHostPtr(gfxAllocation);
     } else {
@@ -722,6 +859,38 @@ void DrmMemoryManager::freeGraphicsMemoryImpl(GraphicsAllocation *gfxAllocation)
     delete gfxAllocation;
 }
 
+bool DrmMemoryManager::isAllocationReleaseDeferrable(DrmAllocation &drmAllocation) const {
+    if (DebugManager.flags.EnableGemCloseWorkerAllocationFree.get() != 1) {
+        return false;
+    }
+    if (!gemCloseWorker || !gemCloseWorker->isActive()) {
+        return false;
+    }
+    if (drmAllocation.fragmentsStorage.fragmentCount || drmAllocation.peekSharedHandle() != Sharing::nonSharedResource) {
+        return false;
+    }
+    for (auto bo : drmAllocation.getBOs()) {
+        if (bo && bo->isReused) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void DrmMemoryManager::releaseDeferredAllocation(DrmAllocation *drmAllocation) {
+    if (drmAllocation->getMmapPtr()) {
+        this->munmapFunction(drmAllocation->getMmapPtr(), drmAllocation->getMmapSize());
+    }
+    for (auto bo : drmAllocation->getBOs()) {
+        unreference(bo, true);
+    }
+
+    releaseGpuRange(drmAllocation->getReservedAddressPtr(), drmAllocation->getReservedAddressSize(), drmAllocation->getRootDeviceIndex());
+    alignedFreeWrapper(drmAllocation->getDriverAllocatedCpuPtr());
+
+    delete drmAllocation;
+}
+
 void DrmMemoryManager::handleFenceCompletion(GraphicsAllocation *allocation) {
     static_cast<DrmAllocation *>(allocation)->getBO()->wait(-1);
 }
@@ -786,9 +955,13 @@ MemoryManager::AllocationStatus DrmMemoryManager::populateOsHandles(OsHandleStor
             handleStorage.fragmentStorageData[i].osHandleStorage = new OsHandle();
             handleStorage.fragmentStorageData[i].residency = new ResidencyData(maxOsContextCount);
 
-            handleStorage.fragmentStorageData[i].osHandleStorage->bo = allocUserptr((uintptr_t)handleStorage.fragmentStorageData[i].cpuPtr,
-                                                                                    handleStorage.fragmentStorageData[i].fragmentSize,
-                                                                                    0, rootDeviceIndex);
+            auto fragmentAddress = reinterpret_cast<uintptr_t>(handleStorage.fragmentStorageData[i].cpuPtr);
+            auto fragmentSize = handleStorage.fragmentStorageData[i].fragmentSize;
+            BufferObject *bo = userptrCache ? userptrCache->take(rootDeviceIndex, fragmentAddress, fragmentSize) : nullptr;
+            if (!bo) {
+                bo = allocUserptr(fragmentAddress, fragmentSize, 0, rootDeviceIndex);
+            }
+            handleStorage.fragmentStorageData[i].osHandleStorage->bo = bo;
             if (!handleStorage.fragmentStorageData[i].osHandleStorage->bo) {
                 handleStorage.fragmentStorageData[i].freeTheFragment = true;
                 return AllocationStatus::Error;
@@ -805,7 +978,13 @@ MemoryManager::AllocationStatus DrmMemoryManager::populateOsHandles(OsHandleStor
 
         if (result == EFAULT) {
             for (uint32_t i = 0; i < numberOfBosAllocated; i++) {
-                handleStorage.fragmentStorageData[indexesOfAllocatedBos[i]].freeTheFragment = true;
+                auto &fragment = handleStorage.fragmentStorageData[indexesOfAllocatedBos[i]];
+                fragment.freeTheFragment = true;
+                if (userptrCache) {
+                    // never cache BOs backing an invalid host pointer
+                    unreference(fragment.osHandleStorage->bo, true);
+                    fragment.osHandleStorage->bo = nullptr;
+                }
             }
             return AllocationStatus::InvalidHostPointer;
         } else if (result != 0) {
@@ -822,8 +1001,12 @@ MemoryManager::AllocationStatus DrmMemoryManager::populateOsHandles(OsHandleStor
 void DrmMemoryManager::cleanOsHandles(OsHandleStorage &handleStorage, uint32_t rootDeviceIndex) {
     for (unsigned int i = 0; i < maxFragmentsCount; i++) {
         if (handleStorage.fragmentStorageData[i].freeTheFragment) {
-            if (handleStorage.fragmentStorageData[i].osHandleStorage->bo) {
-                BufferObject *search = handleStorage.fragmentStorageData[i].osHandleStorage->bo;
+            BufferObject *search = handleStorage.fragmentStorageData[i].osHandleStorage->bo;
+            if (search && userptrCache) {
+                search = userptrCache->store(rootDeviceIndex, reinterpret_cast<uintptr_t>(handleStorage.fragmentStorageData[i].cpuPtr),
+                                             handleStorage.fragmentStorageData[i].fragmentSize, search);
+            }
+            if (search) {
                 search->wait(-1);
                 auto refCount = unreference(search, true);
                 DEBUG_BREAK_IF(refCount != 1u);
@@ -918,6 +1101,7 @@ int DrmMemoryManager::obtainFdFromHandle(int boHandle, uint32_t rootDeviceindex)
 
 uint32_t DrmMemoryManager::getDefaultDrmContextId() const {
     auto osContextLinux = static_cast<OsContextLinux *>(registeredEngines[defaultEngineIndex].osContext);
+    osContextLinux->ensureContextInitialized();
     return osContextLinux->getDrmContextIds()[0];
 }
 
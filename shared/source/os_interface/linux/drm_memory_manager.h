@@ -10,6 +10,7 @@
 #include "shared/source/os_interface/linux/drm_allocation.h"
 #include "shared/source/os_interface/linux/drm_buffer_object.h"
 #include "shared/source/os_interface/linux/drm_neo.h"
+#include "shared/source/os_interface/linux/drm_userptr_cache.h"
 
 #include "drm_gem_close_worker.h"
 
@@ -33,9 +34,11 @@ class DrmMemoryManager : public MemoryManager {
     void addAllocationToHostPtrManager(GraphicsAllocation *gfxAllocation) override;
     void removeAllocationFromHostPtrManager(GraphicsAllocation *gfxAllocation) override;
     void freeGraphicsMemoryImpl(GraphicsAllocation *gfxAllocation) override;
+    void releaseDeferredAllocation(DrmAllocation *drmAllocation);
     void handleFenceCompletion(GraphicsAllocation *allocation) override;
     GraphicsAllocation *createGraphicsAllocationFromExistingStorage(AllocationProperties &properties, void *ptr, MultiGraphicsAllocation &multiGraphicsAllocation) override;
     GraphicsAllocation *createGraphicsAllocationFromSharedHandle(osHandle handle, const AllocationProperties &properties, bool requireSpecificBitness) override;
+    GraphicsAllocation *createPeerAllocation(GraphicsAllocation &allocation, uint32_t rootDeviceIndex) override;
     void closeSharedHandle(GraphicsAllocation *gfxAllocation) override;
     GraphicsAllocation *createPaddedAllocation(GraphicsAllocation *inputGraphicsAllocation, size_t sizeWithPadding) override;
     GraphicsAllocation *createGraphicsAllocationFromNTHandle(void *handle, uint32_t rootDeviceIndex) override { return nullptr; }
@@ -46,6 +49,7 @@ class DrmMemoryManager : public MemoryManager {
     AllocationStatus populateOsHandles(OsHandleStorage &handleStorage, uint32_t rootDeviceIndex) override;
     void cleanOsHandles(OsHandleStorage &handleStorage, uint32_t rootDeviceIndex) override;
     void commonCleanup() override;
+    void prepareForFastTeardown() override;
 
     // drm/i915 ioctl wrappers
     MOCKABLE_VIRTUAL uint32_t unreference(BufferObject *bo, bool synchronousDestroy);
@@ -72,7 +76,7 @@ class DrmMemoryManager : public MemoryManager {
     void unregisterAllocation(GraphicsAllocation *allocation);
 
   protected:
-    BufferObject *findAndReferenceSharedBufferObject(int boHandle);
+    BufferObject *findAndReferenceSharedBufferObject(int boHandle, uint32_t rootDeviceIndex);
     void eraseSharedBufferObject(BufferObject *bo);
     void pushSharedBufferObject(BufferObject *bo);
     BufferObject *allocUserptr(uintptr_t address, size_t size, uint64_t flags, uint32_t rootDeviceIndex);
@@ -106,6 +110,13 @@ class DrmMemoryManager : public MemoryManager {
     DrmAllocation *allocate32BitGraphicsMemoryImpl(const AllocationData &allocationData, bool useLocalMemory) override;
     GraphicsAllocation *allocateGraphicsMemoryInDevicePool(const AllocationData &allocationData, AllocationStatus &status) override;
     bool createDrmAllocation(Drm *drm, DrmAllocation *allocation, uint64_t gpuAddress, size_t maxOsContextCount);
+    bool isAllocationReleaseDeferrable(DrmAllocation &drmAllocation) const;
+    bool isHugePageAllocationPreferred(const AllocationData &allocationData) const;
+    bool isLocalMemoryOversubscriptionEnabled() const;
+    MOCKABLE_VIRTUAL bool evictColdLocalMemoryAllocation(uint32_t rootDeviceIndex);
+    int getPreferredNumaNode(const AllocationData &allocationData) const;
+    void bindToNumaNode(void *ptr, size_t size, int numaNode);
+    static long mbindSyscall(void *addr, unsigned long len, int mode, const unsigned long *nodemask, unsigned long maxnode, unsigned int flags);
     void registerAllocationInOs(GraphicsAllocation *allocation) override;
 
     Drm &getDrm(uint32_t rootDeviceIndex) const;
@@ -117,8 +128,11 @@ class DrmMemoryManager : public MemoryManager {
     bool forcePinEnabled = false;
     const bool validateHostPtrMemory;
     std::unique_ptr<DrmGemCloseWorker> gemCloseWorker;
+    std::unique_ptr<DrmUserptrCache> userptrCache;
     decltype(&mmap) mmapFunction = mmap;
     decltype(&munmap) munmapFunction = munmap;
+    decltype(&madvise) madviseFunction = madvise;
+    decltype(&mbindSyscall) mbindFunction = mbindSyscall;
     decltype(&lseek) lseekFunction = lseek;
     decltype(&close) closeFunction = close;
     std::vector<BufferObject *> sharingBufferObjects;
@@ -16,6 +16,8 @@
 #include "shared/source/os_interface/linux/drm_memory_manager.h"
 #include "shared/source/os_interface/linux/memory_info_impl.h"
 
+#include <algorithm>
+
 namespace NEO {
 
 BufferObject *DrmMemoryManager::createBufferObjectInMemoryRegion(Drm *drm,
@@ -33,13 +35,22 @@ BufferObject *DrmMemoryManager::createBufferObjectInMemoryRegion(Drm *drm,
         return nullptr;
     }
 
-    drm_i915_gem_memory_class_instance memRegions{};
-    memRegions.memory_class = regionClassAndInstance.memory_class;
-    memRegions.memory_instance = regionClassAndInstance.memory_instance;
+    drm_i915_gem_memory_class_instance memRegions[2]{};
+    memRegions[0].memory_class = regionClassAndInstance.memory_class;
+    memRegions[0].memory_instance = regionClassAndInstance.memory_instance;
+    uint32_t numRegions = 1;
+
+    if (memoryBanks != 0 && isLocalMemoryOversubscriptionEnabled()) {
+        // System memory as second placement lets kernel migrate cold objects out of local memory
+        auto systemRegion = memoryInfo->getMemoryRegionClassAndInstance(0);
+        if (systemRegion.memory_class != MemoryInfoImpl::invalidMemoryRegion()) {
+            memRegions[numRegions++] = systemRegion;
+        }
+    }
 
     drm_i915_gem_object_param regionParam{};
-    regionParam.size = 1;
-    regionParam.data = reinterpret_cast<uintptr_t>(&memRegions);
+    regionParam.size = numRegions;
+    regionParam.data = reinterpret_cast<uintptr_t>(memRegions);
     regionParam.param = I915_OBJECT_PARAM | I915_PARAM_MEMORY_REGIONS;
 
     drm_i915_gem_create_ext_setparam setparamRegion{};
@@ -65,7 +76,85 @@ BufferObject *DrmMemoryManager::createBufferObjectInMemoryRegion(Drm *drm,
 }
 
 GraphicsAllocation *DrmMemoryManager::createSharedUnifiedMemoryAllocation(const AllocationData &allocationData) {
-    return nullptr;
+    auto &drm = this->getDrm(allocationData.rootDeviceIndex);
+    auto memoryInfo = static_cast<MemoryInfoImpl *>(drm.getMemoryInfo());
+    if (!memoryInfo) {
+        return nullptr;
+    }
+
+    // object placeable in both regions is migrated by the kernel driver on access,
+    // the first region is only a hint for the initial placement
+    drm_i915_gem_memory_class_instance memRegions[2]{};
+    memRegions[0] = memoryInfo->getMemoryRegionClassAndInstance(1u);
+    memRegions[1] = memoryInfo->getMemoryRegionClassAndInstance(0u);
+    if (memRegions[0].memory_class == MemoryInfoImpl::invalidMemoryRegion() ||
+        memRegions[1].memory_class == MemoryInfoImpl::invalidMemoryRegion()) {
+        return nullptr;
+    }
+    if (allocationData.flags.preferSystemPlacement) {
+        std::swap(memRegions[0], memRegions[1]);
+    }
+
+    drm_i915_gem_object_param regionParam{};
+    regionParam.size = 2;
+    regionParam.data = reinterpret_cast<uintptr_t>(memRegions);
+    regionParam.param = I915_OBJECT_PARAM | I915_PARAM_MEMORY_REGIONS;
+
+    drm_i915_gem_create_ext_setparam setparamRegion{};
+    setparamRegion.base.name = I915_GEM_CREATE_EXT_SETPARAM;
+    setparamRegion.param = regionParam;
+
+    auto alignment = std::max(allocationData.alignment, MemoryConstants::pageSize64k);
+    auto size = alignUp(allocationData.size, MemoryConstants::pageSize64k);
+
+    drm_i915_gem_create_ext createExt{};
+    createExt.size = size;
+    createExt.extensions = reinterpret_cast<uintptr_t>(&setparamRegion);
+    if (drm.ioctl(DRM_IOCTL_I915_GEM_CREATE_EXT, &createExt) != 0) {
+        return nullptr;
+    }
+
+    std::unique_ptr<BufferObject, BufferObject::Deleter> bo(new (std::nothrow) BufferObject(&drm, createExt.handle, size, maxOsContextCount));
+    if (!bo) {
+        return nullptr;
+    }
+
+    // the same pointer is used by CPU and GPU, so the object is bound at its CPU address
+    auto totalSizeToAlloc = size + alignment;
+    auto cpuBasePointer = this->mmapFunction(0, totalSizeToAlloc, PROT_NONE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (cpuBasePointer == MAP_FAILED) {
+        return nullptr;
+    }
+    auto cpuPointer = alignUp(cpuBasePointer, alignment);
+    auto pointerDiff = ptrDiff(cpuPointer, cpuBasePointer);
+
+    drm_i915_gem_mmap_offset gemMmap{};
+    gemMmap.handle = bo->peekHandle();
+    gemMmap.flags = I915_MMAP_OFFSET_WB;
+    if (drm.ioctl(DRM_IOCTL_I915_GEM_MMAP_OFFSET, &gemMmap) != 0) {
+        this->munmapFunction(cpuBasePointer, totalSizeToAlloc);
+        return nullptr;
+    }
+
+    [[maybe_unused]] auto retPtr = this->mmapFunction(cpuPointer, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, drm.getFileDescriptor(), static_cast<off_t>(gemMmap.offset));
+    DEBUG_BREAK_IF(retPtr != cpuPointer);
+
+    auto gpuAddress = reinterpret_cast<uint64_t>(cpuPointer);
+    bo->setAddress(gpuAddress);
+
+    auto allocation = new DrmAllocation(allocationData.rootDeviceIndex, allocationData.type, bo.get(), cpuPointer, gpuAddress, size, MemoryPool::System4KBPages);
+    allocation->setMmapPtr(cpuPointer);
+    allocation->setMmapSize(size);
+    if (pointerDiff != 0) {
+        [[maybe_unused]] auto retCode = this->munmapFunction(cpuBasePointer, pointerDiff);
+        DEBUG_BREAK_IF(retCode != 0);
+    }
+    [[maybe_unused]] auto retCode = this->munmapFunction(ptrOffset(cpuPointer, size), alignment - pointerDiff);
+    DEBUG_BREAK_IF(retCode != 0);
+
+    bo.release();
+
+    return allocation;
 }
 
 DrmAllocation *DrmMemoryManager::createAllocWithAlignment(const AllocationData &allocationData, size_t size, size_t alignment, size_t alignedSize, uint64_t gpuAddress) {
@@ -185,6 +274,12 @@ GraphicsAllocation *DrmMemoryManager::allocateGraphicsMemoryInDevicePool(const A
         return nullptr;
     }
 
+    if (allocationData.type == GraphicsAllocation::AllocationType::UNIFIED_SHARED_MEMORY) {
+        auto allocation = this->createSharedUnifiedMemoryAllocation(allocationData);
+        status = allocation ? AllocationStatus::Success : AllocationStatus::Error;
+        return allocation;
+    }
+
     std::unique_ptr<Gmm> gmm;
     size_t sizeAligned = 0;
     auto numHandles = allocationData.storageInfo.getNumBanks();
@@ -218,12 +313,16 @@ GraphicsAllocation *DrmMemoryManager::allocateGraphicsMemoryInDevicePool(const A
     allocation->setFlushL3Required(allocationData.flags.flushL3);
     allocation->setReservedAddressRange(reinterpret_cast<void *>(gpuAddress), sizeAllocated);
 
-    if (!createDrmAllocation(&getDrm(allocationData.rootDeviceIndex), allocation.get(), gpuAddress, maxOsContextCount)) {
+    auto allocated = createDrmAllocation(&getDrm(allocationData.rootDeviceIndex), allocation.get(), gpuAddress, maxOsContextCount);
+    while (!allocated && evictColdLocalMemoryAllocation(allocationData.rootDeviceIndex)) {
+        allocated = createDrmAllocation(&getDrm(allocationData.rootDeviceIndex), allocation.get(), gpuAddress, maxOsContextCount);
+    }
+    if (!allocated) {
         for (auto handleId = 0u; handleId < allocationData.storageInfo.getNumBanks(); handleId++) {
             delete allocation->getGmm(handleId);
         }
         gfxPartition->freeGpuAddressRange(GmmHelper::decanonize(gpuAddress), sizeAllocated);
-        status = AllocationStatus::Error;
+        status = isLocalMemoryOversubscriptionEnabled() ? AllocationStatus::RetryInNonDevicePool : AllocationStatus::Error;
         return nullptr;
     }
     if (allocationData.type == GraphicsAllocation::AllocationType::WRITE_COMBINED) {
@@ -37,18 +37,36 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::makeResidentWithinOsConte
     std::lock_guard<std::mutex> lock(mutex);
     for (auto gfxAllocation = gfxAllocations.begin(); gfxAllocation != gfxAllocations.end(); gfxAllocation++) {
         auto drmAllocation = static_cast<DrmAllocation *>(*gfxAllocation);
-        for (auto drmIterator = 0u; drmIterator < osContext->getDeviceBitfield().size(); drmIterator++) {
-            if (osContext->getDeviceBitfield().test(drmIterator)) {
-                drmAllocation->makeBOsResident(osContext, drmIterator, nullptr, true);
-            }
+        auto retVal = bindWithinOsContext(osContext, *drmAllocation, true);
+        while (retVal && evictLeastRecentlyUsedAllocation()) {
+            retVal = bindWithinOsContext(osContext, *drmAllocation, true);
+        }
+        if (retVal) {
+            return MemoryOperationsStatus::OUT_OF_MEMORY;
         }
-        if (!evictable) {
+
+        if (evictable) {
+            touchLru(drmAllocation);
+        } else {
+            removeFromLru(drmAllocation);
             drmAllocation->updateResidencyTaskCount(GraphicsAllocation::objectAlwaysResident, osContext->getContextId());
         }
     }
     return MemoryOperationsStatus::SUCCESS;
 }
 
+int DrmMemoryOperationsHandlerBind::bindWithinOsContext(OsContext *osContext, DrmAllocation &drmAllocation, bool bind) {
+    for (auto drmIterator = 0u; drmIterator < osContext->getDeviceBitfield().size(); drmIterator++) {
+        if (osContext->getDeviceBitfield().test(drmIterator)) {
+            auto retVal = drmAllocation.makeBOsResident(osContext, drmIterator, nullptr, bind);
+            if (retVal) {
+                return retVal;
+            }
+        }
+    }
+    return 0;
+}
+
 MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evict(Device *device, GraphicsAllocation &gfxAllocation) {
     auto engines = device->getEngines();
     auto retVal = MemoryOperationsStatus::SUCCESS;
@@ -71,10 +89,66 @@ void DrmMemoryOperationsHandlerBind::evictImpl(OsContext *osContext, GraphicsAll
     auto drmAllocation = static_cast<DrmAllocation *>(&gfxAllocation);
     for (auto drmIterator = 0u; drmIterator < deviceBitfield.size(); drmIterator++) {
         if (deviceBitfield.test(drmIterator)) {
-            drmAllocation->makeBOsResident(osContext, drmIterator, nullptr, false);
+            auto retVal = drmAllocation->makeBOsResident(osContext, drmIterator, nullptr, false);
+            UNRECOVERABLE_IF(retVal);
         }
     }
     drmAllocation->updateResidencyTaskCount(GraphicsAllocation::objectNotResident, osContext->getContextId());
+    removeFromLru(drmAllocation);
+}
+
+void DrmMemoryOperationsHandlerBind::touchLru(GraphicsAllocation *gfxAllocation) {
+    auto position = lruPositions.find(gfxAllocation);
+    if (position != lruPositions.end()) {
+        lruAllocations.splice(lruAllocations.end(), lruAllocations, position->second);
+        return;
+    }
+    lruPositions[gfxAllocation] = lruAllocations.insert(lruAllocations.end(), gfxAllocation);
+}
+
+void DrmMemoryOperationsHandlerBind::removeFromLru(GraphicsAllocation *gfxAllocation) {
+    auto position = lruPositions.find(gfxAllocation);
+    if (position != lruPositions.end()) {
+        lruAllocations.erase(position->second);
+        lruPositions.erase(position);
+    }
+}
+
+bool DrmMemoryOperationsHandlerBind::isAllocationIdle(GraphicsAllocation &gfxAllocation) const {
+    const auto &engines = this->rootDeviceEnvironment.executionEnvironment.memoryManager->getRegisteredEngines();
+    for (const auto &engine : engines) {
+        if (this->rootDeviceIndex == engine.commandStreamReceiver->getRootDeviceIndex() &&
+            !gfxAllocation.isResidencyTaskCountBelow(*engine.commandStreamReceiver->getTagAddress(), engine.osContext->getContextId())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool DrmMemoryOperationsHandlerBind::evictLeastRecentlyUsedAllocation(bool localMemoryOnly) {
+    // Called with mutex acquired
+    for (auto allocation : lruAllocations) {
+        if (localMemoryOnly && allocation->getMemoryPool() != MemoryPool::LocalMemory) {
+            continue;
+        }
+        if (!isAllocationIdle(*allocation)) {
+            continue;
+        }
+        const auto &engines = this->rootDeviceEnvironment.executionEnvironment.memoryManager->getRegisteredEngines();
+        for (const auto &engine : engines) {
+            if (this->rootDeviceIndex == engine.commandStreamReceiver->getRootDeviceIndex()) {
+                this->evictImpl(engine.osContext, *allocation, engine.osContext->getDeviceBitfield());
+            }
+        }
+        removeFromLru(allocation);
+        return true;
+    }
+    return false;
+}
+
+bool DrmMemoryOperationsHandlerBind::evictColdAllocation(bool localMemoryOnly) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return evictLeastRecentlyUsedAllocation(localMemoryOnly);
 }
 
 MemoryOperationsStatus DrmMemoryOperationsHandlerBind::isResident(Device *device, GraphicsAllocation &gfxAllocation) {
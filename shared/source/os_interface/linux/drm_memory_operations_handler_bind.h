@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,7 +9,11 @@
 #include "shared/source/helpers/common_types.h"
 #include "shared/source/os_interface/linux/drm_memory_operations_handler.h"
 
+#include <list>
+#include <unordered_map>
+
 namespace NEO {
+class DrmAllocation;
 struct RootDeviceEnvironment;
 class DrmMemoryOperationsHandlerBind : public DrmMemoryOperationsHandler {
   public:
@@ -24,14 +28,28 @@ class DrmMemoryOperationsHandlerBind : public DrmMemoryOperationsHandler {
 
     void mergeWithResidencyContainer(OsContext *osContext, ResidencyContainer &residencyContainer) override;
     std::unique_lock<std::mutex> lockHandlerIfUsed() override;
+    bool evictColdAllocation(bool localMemoryOnly) override;
 
     MOCKABLE_VIRTUAL void evictUnusedAllocations();
 
+    size_t getLruSize() const { return lruAllocations.size(); }
+
   protected:
+    using LruList = std::list<GraphicsAllocation *>;
+
+    int bindWithinOsContext(OsContext *osContext, DrmAllocation &drmAllocation, bool bind);
     void evictImpl(OsContext *osContext, GraphicsAllocation &gfxAllocation, DeviceBitfield deviceBitfield);
     void evictUnusedAllocationsImpl(std::vector<GraphicsAllocation *> &allocationsForEviction);
+    bool evictLeastRecentlyUsedAllocation(bool localMemoryOnly = false);
+    bool isAllocationIdle(GraphicsAllocation &gfxAllocation) const;
+    void touchLru(GraphicsAllocation *gfxAllocation);
+    void removeFromLru(GraphicsAllocation *gfxAllocation);
 
     RootDeviceEnvironment &rootDeviceEnvironment;
     uint32_t rootDeviceIndex = 0;
+
+    // Evictable allocations bound to the VM, ordered from the least to the most recently used
+    LruList lruAllocations;
+    std::unordered_map<GraphicsAllocation *, LruList::iterator> lruPositions;
 };
 } // namespace NEO
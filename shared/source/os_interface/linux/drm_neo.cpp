@@ -7,6 +7,7 @@
 
 #include "drm_neo.h"
 
+#include "shared/source/command_stream/csr_definitions.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
@@ -21,6 +22,7 @@
 #include "shared/source/os_interface/linux/system_info.h"
 #include "shared/source/os_interface/os_environment.h"
 #include "shared/source/os_interface/os_interface.h"
+#include "shared/source/utilities/cpuintrinsics.h"
 #include "shared/source/utilities/directory.h"
 
 #include "drm_query_flags.h"
@@ -28,6 +30,7 @@
 #include <cstdio>
 #include <cstring>
 #include <linux/limits.h>
+#include <sys/utsname.h>
 
 namespace NEO {
 
@@ -156,6 +159,17 @@ void Drm::setLowPriorityContextParam(uint32_t drmContextId) {
     UNRECOVERABLE_IF(retVal != 0);
 }
 
+bool Drm::setHighPriorityContextParam(uint32_t drmContextId) {
+    drm_i915_gem_context_param gcp = {};
+    gcp.ctx_id = drmContextId;
+    gcp.param = I915_CONTEXT_PARAM_PRIORITY;
+    gcp.value = 1023;
+
+    // raising priority above default requires CAP_SYS_NICE, without it the context keeps default priority
+    auto retVal = ioctl(DRM_IOCTL_I915_GEM_CONTEXT_SETPARAM, &gcp);
+    return retVal == 0;
+}
+
 int Drm::getQueueSliceCount(drm_i915_gem_context_param_sseu *sseu) {
     drm_i915_gem_context_param contextParam = {};
     contextParam.param = I915_CONTEXT_PARAM_SSEU;
@@ -173,6 +187,10 @@ uint64_t Drm::getSliceMask(uint64_t sliceCount) {
 bool Drm::setQueueSliceCount(uint64_t sliceCount) {
     if (sliceCountChangeSupported) {
         drm_i915_gem_context_param contextParam = {};
+        // default slice count restores all slices after a queue restricted them
+        if (sliceCount == QueueSliceCount::defaultSliceCount) {
+            sliceCount = getRootDeviceEnvironment().getHardwareInfo()->gtSystemInfo.SliceCount;
+        }
         sseu.slice_mask = getSliceMask(sliceCount);
 
         contextParam.param = I915_CONTEXT_PARAM_SSEU;
@@ -463,6 +481,52 @@ uint32_t Drm::getVirtualMemoryAddressSpace(uint32_t vmId) {
     return 0;
 }
 
+bool Drm::queryTopology(const HardwareInfo &hwInfo, int &sliceCount, int &subSliceCount, int &euCount) {
+    if (!topology) {
+        std::unique_ptr<TopologyCache> topologyCache;
+        auto cacheDir = DebugManager.flags.TopologyCacheDir.get();
+        if (cacheDir != "unk" && deviceId != 0) {
+            topologyCache = std::make_unique<TopologyCache>(cacheDir, getTopologyCacheKey());
+        }
+
+        auto entry = std::make_unique<TopologyCacheEntry>();
+        if (!topologyCache || !topologyCache->load(*entry)) {
+            if (!queryTopologyInfo(hwInfo, entry->sliceCount, entry->subSliceCount, entry->euCount)) {
+                sliceCount = entry->sliceCount;
+                subSliceCount = entry->subSliceCount;
+                euCount = entry->euCount;
+                return false;
+            }
+            if (topologyCache) {
+                topologyCache->store(*entry);
+            }
+        }
+        topology = std::move(entry);
+    }
+
+    sliceCount = topology->sliceCount;
+    subSliceCount = topology->subSliceCount;
+    euCount = topology->euCount;
+    return true;
+}
+
+std::string Drm::getTopologyCacheKey() {
+    char driverName[16] = {};
+    drm_version_t version = {};
+    version.name = driverName;
+    version.name_len = sizeof(driverName) - 1;
+    SysCalls::ioctl(getFileDescriptor(), DRM_IOCTL_VERSION, &version);
+
+    struct utsname systemName = {};
+    uname(&systemName);
+
+    // pci path keeps identical devices on different buses apart
+    std::string key = std::to_string(deviceId) + ";" + std::to_string(revisionId) + ";" + getPciPath() + ";" + systemName.release + ";" +
+                      driverName + " " + std::to_string(version.version_major) + "." +
+                      std::to_string(version.version_minor) + "." + std::to_string(version.version_patchlevel);
+    return key;
+}
+
 bool Drm::translateTopologyInfo(const drm_i915_query_topology_info *queryTopologyInfo, int &sliceCount, int &subSliceCount, int &euCount) {
     sliceCount = 0;
     subSliceCount = 0;
@@ -495,6 +559,13 @@ bool Drm::translateTopologyInfo(const drm_i915_query_topology_info *queryTopolog
     return (sliceCount && subSliceCount && euCount);
 }
 
+void Drm::waitForBind(uint32_t vmHandleId) {
+    auto fenceAddress = static_cast<volatile uint64_t *>(&pagingFence[vmHandleId]);
+    while (*fenceAddress < fenceVal[vmHandleId]) {
+        CpuIntrinsics::pause();
+    }
+}
+
 Drm::~Drm() {
     destroyVirtualMemoryAddressSpace();
 }
@@ -11,6 +11,7 @@
 #include "shared/source/os_interface/linux/engine_info.h"
 #include "shared/source/os_interface/linux/hw_device_id.h"
 #include "shared/source/os_interface/linux/memory_info.h"
+#include "shared/source/os_interface/linux/topology_cache.h"
 #include "shared/source/utilities/api_intercept.h"
 #include "shared/source/utilities/stackvec.h"
 
@@ -91,6 +92,7 @@ class Drm {
     void destroyDrmContext(uint32_t drmContextId);
     int queryVmId(uint32_t drmContextId, uint32_t &vmId);
     void setLowPriorityContextParam(uint32_t drmContextId);
+    bool setHighPriorityContextParam(uint32_t drmContextId);
 
     unsigned int bindDrmContext(uint32_t drmContextId, uint32_t deviceIndex, aub_stream::EngineType engineType);
 
@@ -175,6 +177,9 @@ class Drm {
     std::string getPciPath() {
         return hwDeviceId->getPciPath();
     }
+    int getNumaNode() const {
+        return hwDeviceId->getNumaNode();
+    }
 
     void waitForBind(uint32_t vmHandleId);
     uint64_t getNextFenceVal(uint32_t vmHandleId) { return ++fenceVal[vmHandleId]; }
@@ -183,6 +188,8 @@ class Drm {
   protected:
     int getQueueSliceCount(drm_i915_gem_context_param_sseu *sseu);
     bool translateTopologyInfo(const drm_i915_query_topology_info *queryTopologyInfo, int &sliceCount, int &subSliceCount, int &euCount);
+    bool queryTopologyInfo(const HardwareInfo &hwInfo, int &sliceCount, int &subSliceCount, int &euCount);
+    std::string getTopologyCacheKey();
     std::string generateUUID();
     std::string generateElfUUID(const void *data);
     bool sliceCountChangeSupported = false;
@@ -207,6 +214,8 @@ class Drm {
     std::unique_ptr<EngineInfo> engineInfo;
     std::unique_ptr<MemoryInfo> memoryInfo;
     std::vector<uint32_t> virtualMemoryIds;
+    // topology is queried both by Drm::create and HwInfoConfig::configureHwInfo, keep the first result
+    std::unique_ptr<TopologyCacheEntry> topology;
 
     std::array<uint64_t, EngineLimits::maxHandleCount> pagingFence;
     std::array<uint64_t, EngineLimits::maxHandleCount> fenceVal;
@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/linux/drm_userptr_cache.h"
+
+namespace NEO {
+
+BufferObject *DrmUserptrCache::take(uint32_t rootDeviceIndex, uintptr_t address, size_t size) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto entry = entries.find(Key{rootDeviceIndex, address, size});
+    if (entry == entries.end()) {
+        return nullptr;
+    }
+    auto bo = entry->second->bo;
+    lru.erase(entry->second);
+    entries.erase(entry);
+    return bo;
+}
+
+BufferObject *DrmUserptrCache::store(uint32_t rootDeviceIndex, uintptr_t address, size_t size, BufferObject *bo) {
+    if (capacity == 0u) {
+        return bo;
+    }
+
+    std::lock_guard<std::mutex> lock(mtx);
+    BufferObject *evictedBo = nullptr;
+    if (lru.size() >= capacity) {
+        auto &oldest = lru.front();
+        auto range = entries.equal_range(oldest.key);
+        for (auto entry = range.first; entry != range.second; ++entry) {
+            if (entry->second == lru.begin()) {
+                entries.erase(entry);
+                break;
+            }
+        }
+        evictedBo = oldest.bo;
+        lru.pop_front();
+    }
+
+    Key key{rootDeviceIndex, address, size};
+    lru.push_back({key, bo});
+    entries.emplace(key, std::prev(lru.end()));
+    return evictedBo;
+}
+
+std::vector<BufferObject *> DrmUserptrCache::takeAll() {
+    std::lock_guard<std::mutex> lock(mtx);
+    std::vector<BufferObject *> bos;
+    bos.reserve(lru.size());
+    for (auto &entry : lru) {
+        bos.push_back(entry.bo);
+    }
+    lru.clear();
+    entries.clear();
+    return bos;
+}
+
+size_t DrmUserptrCache::getSize() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return lru.size();
+}
+
+} // namespace NEO
@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+namespace NEO {
+class BufferObject;
+
+class DrmUserptrCache {
+  public:
+    DrmUserptrCache(size_t capacity) : capacity(capacity) {}
+
+    BufferObject *take(uint32_t rootDeviceIndex, uintptr_t address, size_t size);
+    BufferObject *store(uint32_t rootDeviceIndex, uintptr_t address, size_t size, BufferObject *bo);
+    std::vector<BufferObject *> takeAll();
+
+    size_t getCapacity() const { return capacity; }
+    size_t getSize() const;
+
+  protected:
+    using Key = std::tuple<uint32_t, uintptr_t, size_t>;
+    struct Entry {
+        Key key;
+        BufferObject *bo;
+    };
+    using LruList = std::list<Entry>;
+
+    const size_t capacity;
+    LruList lru;
+    std::multimap<Key, LruList::iterator> entries;
+    mutable std::mutex mtx;
+};
+} // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -13,13 +13,17 @@ namespace NEO {
 
 class HwDeviceId : NonCopyableClass {
   public:
-    HwDeviceId(int fileDescriptorIn, const char *pciPathIn) : fileDescriptor(fileDescriptorIn), pciPath(pciPathIn) {}
+    HwDeviceId(int fileDescriptorIn, const char *pciPathIn);
     ~HwDeviceId();
     int getFileDescriptor() const { return fileDescriptor; }
     const char *getPciPath() const { return pciPath.c_str(); }
+    int getNumaNode() const { return numaNode; }
 
   protected:
+    static int queryNumaNode(const std::string &pciPath);
+
     const int fileDescriptor;
     const std::string pciPath;
+    const int numaNode;
 };
 } // namespace NEO
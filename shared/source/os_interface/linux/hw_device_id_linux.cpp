@@ -1,17 +1,40 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "shared/source/os_interface/linux/hw_device_id.h"
+#include "shared/source/os_interface/linux/os_inc.h"
 #include "shared/source/os_interface/linux/sys_calls.h"
 
+#include <fstream>
+
 namespace NEO {
 
+HwDeviceId::HwDeviceId(int fileDescriptorIn, const char *pciPathIn) : fileDescriptor(fileDescriptorIn),
+                                                                      pciPath(pciPathIn),
+                                                                      numaNode(queryNumaNode(pciPath)) {}
+
 HwDeviceId::~HwDeviceId() {
     SysCalls::close(fileDescriptor);
 }
 
+int HwDeviceId::queryNumaNode(const std::string &pciPath) {
+    std::string numaNodeSysFsPath = std::string(Os::sysFsPciPathPrefix) + pciPath + "/numa_node";
+
+    std::ifstream ifs(numaNodeSysFsPath.c_str(), std::ifstream::in);
+    if (ifs.fail()) {
+        return -1;
+    }
+
+    int node = -1;
+    ifs >> node;
+    if (ifs.fail()) {
+        return -1;
+    }
+    return node;
+}
+
 } // namespace NEO
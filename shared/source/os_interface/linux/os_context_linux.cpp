@@ -32,10 +32,12 @@ OsContextLinux::OsContextLinux(Drm &drm, uint32_t contextId, DeviceBitfield devi
     auto hwInfo = drm.getRootDeviceEnvironment().getHardwareInfo();
     auto defaultEngineType = getChosenEngineType(*hwInfo);
 
-    if (engineType == defaultEngineType && !isLowPriority() && !isInternalEngine()) {
+    if (engineType == defaultEngineType && !isLowPriority() && !isHighPriority() && !isInternalEngine()) {
         this->setDefaultContext(true);
     }
+}
 
+void OsContextLinux::initializeContext() {
     bool submitDirect = false;
     this->isDirectSubmissionAvailable(*drm.getRootDeviceEnvironment().getHardwareInfo(), submitDirect);
 
@@ -54,6 +56,8 @@ OsContextLinux::OsContextLinux(Drm &drm, uint32_t contextId, DeviceBitfield devi
             if ((drm.isPreemptionSupported() && isLowPriority()) ||
                 (this->isDirectSubmissionActive() && EngineHelpers::isBcs(engineType))) {
                 drm.setLowPriorityContextParam(drmContextId);
+            } else if (drm.isPreemptionSupported() && isHighPriority()) {
+                drm.setHighPriorityContextParam(drmContextId);
             }
 
             this->engineFlag = drm.bindDrmContext(drmContextId, deviceIndex, engineType);
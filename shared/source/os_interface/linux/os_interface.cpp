@@ -13,6 +13,7 @@
 #include "shared/source/os_interface/hw_info_config.h"
 #include "shared/source/os_interface/linux/drm_memory_operations_handler.h"
 #include "shared/source/os_interface/linux/drm_neo.h"
+#include "shared/source/utilities/trace_events.h"
 
 namespace NEO {
 
@@ -63,8 +64,11 @@ bool RootDeviceEnvironment::initOsInterface(std::unique_ptr<HwDeviceId> &&hwDevi
     osInterface->get()->setDrm(drm);
     auto hardwareInfo = getMutableHardwareInfo();
     HwInfoConfig *hwConfig = HwInfoConfig::get(hardwareInfo->platform.eProductFamily);
-    if (hwConfig->configureHwInfo(hardwareInfo, hardwareInfo, osInterface.get())) {
-        return false;
+    {
+        ScopedTraceEvent traceEvent("hardwareInfoSetup", TraceEvents::Category::initialization);
+        if (hwConfig->configureHwInfo(hardwareInfo, hardwareInfo, osInterface.get())) {
+            return false;
+        }
     }
     memoryOperationsInterface = DrmMemoryOperationsHandler::create(*drm, rootDeviceIndex);
     return true;
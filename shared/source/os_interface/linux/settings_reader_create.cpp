@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -13,6 +13,10 @@ SettingsReader *SettingsReader::createOsReader(bool userScope, const std::string
     return new EnvironmentVariableReader;
 }
 
+SettingsReader *SettingsReader::createOsReaderForDebugVariables(const std::string &regKey) {
+    return new EnvironmentVariableReader(true);
+}
+
 char *SettingsReader::getenv(const char *settingName) {
     return ::getenv(settingName);
 }
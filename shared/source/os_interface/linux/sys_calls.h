@@ -12,6 +12,7 @@
 namespace NEO {
 namespace SysCalls {
 int close(int fileDescriptor);
+int dup(int fileDescriptor);
 int open(const char *file, int flags);
 void *dlopen(const char *filename, int flag);
 int ioctl(int fileDescriptor, unsigned long int request, void *arg);
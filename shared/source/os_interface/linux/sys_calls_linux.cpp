@@ -21,6 +21,9 @@ namespace SysCalls {
 int close(int fileDescriptor) {
     return ::close(fileDescriptor);
 }
+int dup(int fileDescriptor) {
+    return ::dup(fileDescriptor);
+}
 int open(const char *file, int flags) {
     return ::open(file, flags);
 }
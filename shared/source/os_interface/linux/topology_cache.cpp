@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/linux/topology_cache.h"
+
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <unistd.h>
+
+namespace NEO {
+
+TopologyCache::TopologyCache(const std::string &cacheDir, const std::string &key)
+    : cacheDir(cacheDir), key(std::to_string(formatVersion) + ";" + key) {}
+
+std::string TopologyCache::getFilePath() const {
+    return cacheDir + "/topology_" + std::to_string(std::hash<std::string>{}(key)) + ".cache";
+}
+
+bool TopologyCache::load(TopologyCacheEntry &entry) const {
+    std::ifstream file(getFilePath());
+    if (!file.good()) {
+        return false;
+    }
+
+    std::string storedKey;
+    std::getline(file, storedKey);
+    if (storedKey != key) {
+        return false;
+    }
+
+    TopologyCacheEntry storedEntry;
+    file >> storedEntry.sliceCount >> storedEntry.subSliceCount >> storedEntry.euCount;
+    if (file.fail() || storedEntry.sliceCount <= 0 || storedEntry.subSliceCount <= 0 || storedEntry.euCount <= 0) {
+        return false;
+    }
+
+    entry = storedEntry;
+    return true;
+}
+
+bool TopologyCache::store(const TopologyCacheEntry &entry) const {
+    auto filePath = getFilePath();
+    // write to a process-unique file first, so concurrent readers never see a partial entry
+    auto tmpFilePath = filePath + "." + std::to_string(getpid());
+    {
+        std::ofstream file(tmpFilePath, std::ios::trunc);
+        if (!file.good()) {
+            return false;
+        }
+        file << key << "\n"
+             << entry.sliceCount << " " << entry.subSliceCount << " " << entry.euCount << "\n";
+        if (!file.good()) {
+            std::remove(tmpFilePath.c_str());
+            return false;
+        }
+    }
+    if (std::rename(tmpFilePath.c_str(), filePath.c_str()) != 0) {
+        std::remove(tmpFilePath.c_str());
+        return false;
+    }
+    return true;
+}
+} // namespace NEO
@@ -0,0 +1,36 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstdint>
+#include <string>
+
+namespace NEO {
+
+struct TopologyCacheEntry {
+    int sliceCount = 0;
+    int subSliceCount = 0;
+    int euCount = 0;
+};
+
+// On-disk cache of the topology query results of a device.
+// Each file stores its full key, so a stale entry (e.g. after a kernel update) is simply ignored and overwritten.
+class TopologyCache {
+  public:
+    static constexpr uint32_t formatVersion = 1u;
+
+    TopologyCache(const std::string &cacheDir, const std::string &key);
+
+    bool load(TopologyCacheEntry &entry) const;
+    bool store(const TopologyCacheEntry &entry) const;
+    std::string getFilePath() const;
+
+  protected:
+    std::string cacheDir;
+    std::string key;
+};
+} // namespace NEO
@@ -13,6 +13,20 @@
 #include "shared/source/helpers/hw_info.h"
 
 namespace NEO {
+void OsContext::ensureContextInitialized() {
+    std::call_once(contextInitializedFlag, [this] {
+        initializeContext();
+        contextInitialized = true;
+    });
+}
+
+bool OsContext::isImmediateContextInitializationEnabled(bool isDefaultEngine) const {
+    if (DebugManager.flags.DeferOsContextInitialization.get() == 0) {
+        return true;
+    }
+    return isDefaultEngine;
+}
+
 bool OsContext::isDirectSubmissionAvailable(const HardwareInfo &hwInfo, bool &submitOnInit) {
     if (DebugManager.flags.EnableDirectSubmission.get() == 1) {
         auto contextEngineType = this->getEngineType();
@@ -26,6 +40,10 @@ bool OsContext::isDirectSubmissionAvailable(const HardwareInfo &hwInfo, bool &su
         if (this->isLowPriority()) {
             startDirect = directSubmissionProperty.useLowPriority;
         }
+        // high priority contexts serve latency sensitive work, so they follow the default context setting
+        if (this->isHighPriority()) {
+            startDirect = true;
+        }
         if (this->isInternalEngine()) {
             startDirect = directSubmissionProperty.useInternal;
         }
@@ -13,7 +13,9 @@
 
 #include "engine_node.h"
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 
 namespace NEO {
 class OSInterface;
@@ -34,6 +36,7 @@ class OsContext : public ReferenceTrackedObject<OsContext> {
     aub_stream::EngineType &getEngineType() { return engineType; }
     bool isLowPriority() const { return engineUsage == EngineUsage::LowPriority; }
     bool isInternalEngine() const { return engineUsage == EngineUsage::Internal; }
+    bool isHighPriority() const { return engineUsage == EngineUsage::HighPriority; }
     bool isRootDevice() const { return rootDevice; }
     virtual bool isInitialized() const { return true; }
     bool isDefaultContext() const { return defaultContext; }
@@ -41,6 +44,12 @@ class OsContext : public ReferenceTrackedObject<OsContext> {
     bool isDirectSubmissionActive() { return directSubmissionActive; }
     void setDirectSubmissionActive() { directSubmissionActive = true; }
 
+    void ensureContextInitialized();
+    bool isContextInitialized() const { return contextInitialized; }
+    bool isImmediateContextInitializationEnabled(bool isDefaultEngine) const;
+    bool isEngineInitializationPending() const { return engineInitializationPending; }
+    void setEngineInitializationPending(bool pending) { engineInitializationPending = pending; }
+
     bool isDirectSubmissionAvailable(const HardwareInfo &hwInfo, bool &submitOnInit);
     bool checkDirectSubmissionSupportsEngine(const DirectSubmissionProperties &directSubmissionProperty,
                                              aub_stream::EngineType contextEngineType,
@@ -57,6 +66,9 @@ class OsContext : public ReferenceTrackedObject<OsContext> {
           engineUsage(typeUsage.second),
           rootDevice(rootDevice) {}
 
+    // creates the OS side of the context; deferred until the engine is first used
+    virtual void initializeContext() {}
+
     const uint32_t contextId;
     const DeviceBitfield deviceBitfield;
     const PreemptionMode preemptionMode;
@@ -66,5 +78,8 @@ class OsContext : public ReferenceTrackedObject<OsContext> {
     const bool rootDevice = false;
     bool defaultContext = false;
     bool directSubmissionActive = false;
+    std::once_flag contextInitializedFlag;
+    std::atomic<bool> contextInitialized{false};
+    std::atomic<bool> engineInitializationPending{false};
 };
 } // namespace NEO
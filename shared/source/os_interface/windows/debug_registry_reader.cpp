@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -20,6 +20,10 @@ SettingsReader *SettingsReader::createOsReader(bool userScope, const std::string
     return new RegistryReader(userScope, regKey);
 }
 
+SettingsReader *SettingsReader::createOsReaderForDebugVariables(const std::string &regKey) {
+    return createOsReader(false, regKey);
+}
+
 char *SettingsReader::getenv(const char *settingName) {
     return SysCalls::getenv(settingName);
 }
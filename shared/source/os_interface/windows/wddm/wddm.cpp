@@ -31,10 +31,14 @@
 #include "shared/source/os_interface/windows/wddm_engine_mapper.h"
 #include "shared/source/os_interface/windows/wddm_residency_allocations_container.h"
 #include "shared/source/sku_info/operations/windows/sku_info_receiver.h"
+#include "shared/source/utilities/cpuintrinsics.h"
+#include "shared/source/utilities/launch_overhead_profiler.h"
 #include "shared/source/utilities/stackvec.h"
 
 #include "gmm_memory.h"
 
+#include <algorithm>
+#include <chrono>
 #include <dxgi.h>
 
 namespace NEO {
@@ -424,6 +428,10 @@ bool Wddm::mapGpuVirtualAddress(Gmm *gmm, D3DKMT_HANDLE handle, D3DGPU_VIRTUAL_A
     kmDafListener->notifyMapGpuVA(featureTable->ftrKmdDaf, getAdapter(), device, handle, MapGPUVA.VirtualAddress, getGdi()->escape);
 
     if (gmm->isRenderCompressed && rootDeviceEnvironment.pageTableManager.get()) {
+        if (DebugManager.flags.BatchAuxTableUpdates.get() == 1) {
+            rootDeviceEnvironment.pageTableManager->deferAuxTableMap(gpuPtr, gmm);
+            return true;
+        }
         return rootDeviceEnvironment.pageTableManager->updateAuxTable(gpuPtr, gmm, true);
     }
 
@@ -808,7 +816,10 @@ bool Wddm::submit(uint64_t commandBuffer, size_t size, void *commandHeader, Wddm
     }
     DBG_LOG(ResidencyDebugEnable, "Residency:", __FUNCTION__, "currentFenceValue =", submitArguments.monitorFence->currentFenceValue);
 
-    status = wddmInterface->submit(commandBuffer, size, commandHeader, submitArguments);
+    {
+        ScopedLaunchPhase launchPhase(LaunchOverheadProfiler::Phase::execIoctl);
+        status = wddmInterface->submit(commandBuffer, size, commandHeader, submitArguments);
+    }
     if (status) {
         submitArguments.monitorFence->lastSubmittedFence = submitArguments.monitorFence->currentFenceValue;
         submitArguments.monitorFence->currentFenceValue++;
@@ -862,10 +873,34 @@ bool Wddm::waitOnGPU(D3DKMT_HANDLE context) {
     return status == STATUS_SUCCESS;
 }
 
+bool Wddm::spinOnMonitoredFence(uint64_t lastFenceValue, const MonitoredFence &monitoredFence) {
+    int64_t maxSpinTime = defaultMaxWaitFromCpuSpinTimeUs;
+    if (DebugManager.flags.WddmWaitFromCpuSpinTime.get() != -1) {
+        maxSpinTime = DebugManager.flags.WddmWaitFromCpuSpinTime.get();
+    }
+    if (maxSpinTime <= 0) {
+        return false;
+    }
+
+    // the window doubles after waits that completed while spinning and halves after waits that needed the KMD
+    auto spinTime = std::min(waitFromCpuSpinTimeUs.load(), maxSpinTime);
+    auto spinStart = std::chrono::steady_clock::now();
+    bool completed = false;
+    while (!(completed = lastFenceValue <= *monitoredFence.cpuAddress)) {
+        if (std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - spinStart).count() >= spinTime) {
+            break;
+        }
+        CpuIntrinsics::pause();
+    }
+
+    waitFromCpuSpinTimeUs.store(completed ? std::min(spinTime * 2, maxSpinTime) : std::max(spinTime / 2, int64_t{1}));
+    return completed;
+}
+
 bool Wddm::waitFromCpu(uint64_t lastFenceValue, const MonitoredFence &monitoredFence) {
     NTSTATUS status = STATUS_SUCCESS;
 
-    if (lastFenceValue > *monitoredFence.cpuAddress) {
+    if (lastFenceValue > *monitoredFence.cpuAddress && !spinOnMonitoredFence(lastFenceValue, monitoredFence)) {
         D3DKMT_WAITFORSYNCHRONIZATIONOBJECTFROMCPU waitFromCpu = {0};
         waitFromCpu.ObjectCount = 1;
         waitFromCpu.ObjectHandleArray = &monitoredFence.fenceHandle;
@@ -80,6 +80,7 @@ class Wddm {
 
     MOCKABLE_VIRTUAL bool submit(uint64_t commandBuffer, size_t size, void *commandHeader, WddmSubmitArguments &submitArguments);
     MOCKABLE_VIRTUAL bool waitFromCpu(uint64_t lastFenceValue, const MonitoredFence &monitoredFence);
+    int64_t getWaitFromCpuSpinTime() const { return waitFromCpuSpinTimeUs.load(); }
 
     NTSTATUS escape(D3DKMT_ESCAPE &escapeCommand);
     MOCKABLE_VIRTUAL VOID *registerTrimCallback(PFND3DKMT_TRIMNOTIFICATIONCALLBACK callback, WddmResidencyController &residencyController);
@@ -174,6 +175,9 @@ class Wddm {
     uint64_t *pagingFenceAddress = nullptr;
     std::atomic<std::uint64_t> currentPagingFenceValue{0};
 
+    static constexpr int64_t defaultMaxWaitFromCpuSpinTimeUs = 50;
+    std::atomic<int64_t> waitFromCpuSpinTimeUs{defaultMaxWaitFromCpuSpinTimeUs};
+
     // Adapter information
     std::unique_ptr<PLATFORM> gfxPlatform;
     std::unique_ptr<GT_SYSTEM_INFO> gtSystemInfo;
@@ -196,6 +200,7 @@ class Wddm {
 
     Wddm(std::unique_ptr<HwDeviceId> hwDeviceId, RootDeviceEnvironment &rootDeviceEnvironment);
     MOCKABLE_VIRTUAL bool waitOnGPU(D3DKMT_HANDLE context);
+    bool spinOnMonitoredFence(uint64_t lastFenceValue, const MonitoredFence &monitoredFence);
     bool createDevice(PreemptionMode preemptionMode);
     bool createPagingQueue();
     bool destroyPagingQueue();
@@ -443,8 +443,10 @@ void WddmMemoryManager::freeGraphicsMemoryImpl(GraphicsAllocation *gfxAllocation
     auto defaultGmm = gfxAllocation->getDefaultGmm();
     if (defaultGmm) {
         auto index = gfxAllocation->getRootDeviceIndex();
-        if (defaultGmm->isRenderCompressed && executionEnvironment.rootDeviceEnvironments[index]->pageTableManager.get()) {
-            auto status = executionEnvironment.rootDeviceEnvironments[index]->pageTableManager->updateAuxTable(input->getGpuAddress(), defaultGmm, false);
+        auto pageTableManager = executionEnvironment.rootDeviceEnvironments[index]->pageTableManager.get();
+        // a map still pending was never applied, so there is nothing to unmap
+        if (defaultGmm->isRenderCompressed && pageTableManager && !pageTableManager->removePendingAuxTableMap(input->getGpuAddress())) {
+            auto status = pageTableManager->updateAuxTable(input->getGpuAddress(), defaultGmm, false);
             DEBUG_BREAK_IF(!status);
         }
     }
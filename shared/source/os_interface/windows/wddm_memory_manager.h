@@ -53,6 +53,7 @@ class WddmMemoryManager : public MemoryManager {
     bool tryDeferDeletions(const D3DKMT_HANDLE *handles, uint32_t allocationCount, D3DKMT_HANDLE resourceHandle, uint32_t rootDeviceIndex);
 
     bool isMemoryBudgetExhausted() const override;
+    bool isSmallAllocationPoolingPreferred() const override { return true; }
 
     AlignedMallocRestrictions *getAlignedMallocRestrictions() override;
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,20 +27,27 @@ MemoryOperationsStatus WddmMemoryOperationsHandler::makeResident(Device *device,
 
     for (const auto &allocation : gfxAllocations) {
         WddmAllocation *wddmAllocation = reinterpret_cast<WddmAllocation *>(allocation);
+        // allocations made resident by an earlier call stay resident until evicted, resubmitting them only costs a kernel call
+        if (isResident(device, *wddmAllocation) == MemoryOperationsStatus::SUCCESS) {
+            continue;
+        }
         totalSize += wddmAllocation->getAlignedSize();
 
         if (wddmAllocation->fragmentsStorage.fragmentCount > 0) {
             for (uint32_t allocationId = 0; allocationId < wddmAllocation->fragmentsStorage.fragmentCount; allocationId++) {
-                handlesForResidency[totalHandlesCount++] = wddmAllocation->fragmentsStorage.fragmentStorageData[allocationId].osHandleStorage->handle;
+                handlesForResidency.push_back(wddmAllocation->fragmentsStorage.fragmentStorageData[allocationId].osHandleStorage->handle);
+                totalHandlesCount++;
             }
         } else {
-            memcpy_s(&handlesForResidency[totalHandlesCount],
-                     wddmAllocation->getNumGmms() * sizeof(D3DKMT_HANDLE),
-                     &wddmAllocation->getHandles()[0],
-                     wddmAllocation->getNumGmms() * sizeof(D3DKMT_HANDLE));
-            totalHandlesCount += wddmAllocation->getNumGmms();
+            for (uint32_t gmmId = 0; gmmId < wddmAllocation->getNumGmms(); gmmId++) {
+                handlesForResidency.push_back(wddmAllocation->getHandle(gmmId));
+                totalHandlesCount++;
+            }
         }
     }
+    if (totalHandlesCount == 0) {
+        return MemoryOperationsStatus::SUCCESS;
+    }
     return residentAllocations->makeResidentResources(handlesForResidency.begin(), totalHandlesCount, totalSize);
 }
 
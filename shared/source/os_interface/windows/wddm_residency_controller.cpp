@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -48,15 +48,18 @@ std::unique_lock<SpinLock> WddmResidencyController::acquireTrimCallbackLock() {
 }
 
 WddmAllocation *WddmResidencyController::getTrimCandidateHead() {
-    uint32_t i = 0;
     const size_t size = trimCandidateList.size();
 
-    if (size == 0) {
-        return nullptr;
-    }
-    while ((trimCandidateList[i] == nullptr) && (i < size))
+    // entries before the cached head are already removed, trimming loops resume the scan instead of restarting it
+    size_t i = trimCandidateHeadPosition < size ? trimCandidateHeadPosition : 0;
+    while (i < size && trimCandidateList[i] == nullptr)
         i++;
 
+    if (i == size) {
+        trimCandidateHeadPosition = 0;
+        return nullptr;
+    }
+    trimCandidateHeadPosition = i;
     return static_cast<WddmAllocation *>(trimCandidateList[i]);
 }
 
@@ -67,6 +70,9 @@ void WddmResidencyController::addToTrimCandidateList(GraphicsAllocation *allocat
     DEBUG_BREAK_IF(trimCandidatesCount > trimCandidateList.size());
 
     if (wddmAllocation->getTrimCandidateListPosition(this->osContextId) == trimListUnusedPosition) {
+        if (trimCandidatesCount == 0) {
+            trimCandidateHeadPosition = position;
+        }
         trimCandidatesCount++;
         trimCandidateList.push_back(allocation);
         wddmAllocation->setTrimCandidateListPosition(this->osContextId, position);
@@ -169,6 +175,7 @@ void WddmResidencyController::compactTrimCandidateList() {
     }
     DEBUG_BREAK_IF(trimCandidatesCount > trimCandidateList.size());
     DEBUG_BREAK_IF(trimCandidatesCount != previousCount);
+    trimCandidateHeadPosition = 0;
 
     checkTrimCandidateCount();
 }
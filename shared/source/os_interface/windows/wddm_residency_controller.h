@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -73,6 +73,7 @@ class WddmResidencyController {
     uint64_t lastTrimFenceValue = 0u;
     ResidencyContainer trimCandidateList;
     uint32_t trimCandidatesCount = 0;
+    size_t trimCandidateHeadPosition = 0;
 
     VOID *trimCallbackHandle = nullptr;
 };
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/windows/wddm_submission_worker.h"
+
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/os_interface/os_thread.h"
+#include "shared/source/os_interface/windows/gdi_interface.h"
+#include "shared/source/os_interface/windows/os_interface.h"
+#include "shared/source/os_interface/windows/wddm/wddm.h"
+
+namespace NEO {
+
+WddmSubmissionWorker::WddmSubmissionWorker(Wddm &wddm) : wddm(wddm) {
+    thread = Thread::create(worker, reinterpret_cast<void *>(this));
+}
+
+WddmSubmissionWorker::~WddmSubmissionWorker() {
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        active = false;
+    }
+    condition.notify_one();
+    thread->join();
+}
+
+void WddmSubmissionWorker::submit(uint64_t commandBuffer, size_t size, const COMMAND_BUFFER_HEADER_REC &header, WddmSubmitArguments &submitArguments) {
+    Submission submission = {commandBuffer, size, std::make_unique<COMMAND_BUFFER_HEADER_REC>(header), submitArguments, *submitArguments.monitorFence};
+
+    auto &monitorFence = *submitArguments.monitorFence;
+    monitorFence.lastSubmittedFence = monitorFence.currentFenceValue;
+    monitorFence.currentFenceValue++;
+
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        queue.push(std::move(submission));
+    }
+    condition.notify_one();
+}
+
+void WddmSubmissionWorker::drain() {
+    std::unique_lock<std::mutex> lock(queueMutex);
+    idleCondition.wait(lock, [this]() { return queue.empty() && inFlight == 0; });
+}
+
+void WddmSubmissionWorker::process(Submission &submission) {
+    // submit against the snapshot, the shared fence already points past this submission
+    submission.arguments.monitorFence = &submission.fence;
+    if (!wddm.submit(submission.commandBuffer, submission.size, submission.header.get(), submission.arguments)) {
+        // the error is reported by later flushes and waits, waiters of the reserved value must not block forever
+        failedSubmissions++;
+        signalFenceFromCpu(submission.fence);
+    }
+}
+
+void WddmSubmissionWorker::signalFenceFromCpu(const MonitoredFence &fence) {
+    D3DKMT_HANDLE fenceHandle = fence.fenceHandle;
+    uint64_t fenceValue = fence.currentFenceValue;
+
+    D3DKMT_SIGNALSYNCHRONIZATIONOBJECTFROMCPU signalFromCpu = {};
+    signalFromCpu.hDevice = wddm.getDevice();
+    signalFromCpu.ObjectCount = 1;
+    signalFromCpu.ObjectHandleArray = &fenceHandle;
+    signalFromCpu.FenceValueArray = &fenceValue;
+    auto status = wddm.getGdi()->signalSynchronizationObjectFromCpu(&signalFromCpu);
+    DEBUG_BREAK_IF(status != STATUS_SUCCESS);
+    UNUSED_VARIABLE(status);
+}
+
+void *WddmSubmissionWorker::worker(void *arg) {
+    auto self = reinterpret_cast<WddmSubmissionWorker *>(arg);
+    std::unique_lock<std::mutex> lock(self->queueMutex);
+    while (true) {
+        self->condition.wait(lock, [self]() { return !self->active || !self->queue.empty(); });
+        if (self->queue.empty()) {
+            break;
+        }
+        std::queue<Submission> submissions;
+        submissions.swap(self->queue);
+        self->inFlight = static_cast<uint32_t>(submissions.size());
+        lock.unlock();
+
+        while (!submissions.empty()) {
+            self->process(submissions.front());
+            submissions.pop();
+        }
+
+        lock.lock();
+        self->inFlight = 0;
+        self->idleCondition.notify_all();
+    }
+    return nullptr;
+}
+
+} // namespace NEO
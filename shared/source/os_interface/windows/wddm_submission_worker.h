@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/os_interface/windows/wddm/wddm_defs.h"
+#include "shared/source/os_interface/windows/windows_defs.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <queue>
+
+struct COMMAND_BUFFER_HEADER_REC;
+
+namespace NEO {
+class Thread;
+class Wddm;
+
+// Issues command buffer submissions to the kernel mode driver from a dedicated thread.
+// The fence value of a submission is reserved on the calling thread, so flush stamps and
+// residency bookkeeping behave as after a synchronous submit.
+class WddmSubmissionWorker {
+  public:
+    WddmSubmissionWorker(Wddm &wddm);
+    ~WddmSubmissionWorker();
+
+    WddmSubmissionWorker(const WddmSubmissionWorker &) = delete;
+    WddmSubmissionWorker &operator=(const WddmSubmissionWorker &) = delete;
+
+    void submit(uint64_t commandBuffer, size_t size, const COMMAND_BUFFER_HEADER_REC &header, WddmSubmitArguments &submitArguments);
+    void drain();
+
+    uint32_t getFailedSubmissionsCount() const { return failedSubmissions.load(); }
+    bool hasFailedSubmission() const { return failedSubmissions.load() > 0; }
+
+  protected:
+    struct Submission {
+        uint64_t commandBuffer;
+        size_t size;
+        std::unique_ptr<COMMAND_BUFFER_HEADER_REC> header;
+        WddmSubmitArguments arguments;
+        MonitoredFence fence;
+    };
+
+    void process(Submission &submission);
+    void signalFenceFromCpu(const MonitoredFence &fence);
+    static void *worker(void *arg);
+
+    Wddm &wddm;
+    std::unique_ptr<Thread> thread;
+
+    std::mutex queueMutex;
+    std::condition_variable condition;
+    std::condition_variable idleCondition;
+    std::queue<Submission> queue;
+    uint32_t inFlight = 0;
+    bool active = true;
+
+    std::atomic<uint32_t> failedSubmissions{0};
+};
+} // namespace NEO
@@ -8,11 +8,13 @@
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/options.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 
+#include <algorithm>
 #include <mutex>
 
 namespace NEO {
@@ -20,8 +22,13 @@ void PageFaultManager::insertAllocation(void *ptr, size_t size, SVMAllocsManager
     const bool initialPlacementCpu = !memoryProperties.allocFlags.usmInitialPlacementGpu;
     const auto domain = initialPlacementCpu ? AllocationDomain::Cpu : AllocationDomain::None;
 
-    std::unique_lock<SpinLock> lock{mtx};
-    this->memoryData.insert(std::make_pair(ptr, PageFaultData{size, unifiedMemoryManager, cmdQ, domain}));
+    PageFaultData pageFaultData{size, unifiedMemoryManager, cmdQ, domain};
+    pageFaultData.blockSize = getMigrationBlockSize(size);
+
+    std::unique_lock<std::shared_mutex> lock{mtx};
+    this->memoryData.insert(std::make_pair(ptr, std::move(pageFaultData)));
+    this->nonGpuDomainAllocations.insert(ptr);
+    this->registerCPUMemory(ptr, size);
     if (!initialPlacementCpu) {
         this->setAubWritable(false, ptr, unifiedMemoryManager);
         this->protectCPUMemoryAccess(ptr, size);
@@ -29,79 +36,258 @@ void PageFaultManager::insertAllocation(void *ptr, size_t size, SVMAllocsManager
 }
 
 void PageFaultManager::removeAllocation(void *ptr) {
-    std::unique_lock<SpinLock> lock{mtx};
+    std::unique_lock<std::shared_mutex> lock{mtx};
     auto alloc = memoryData.find(ptr);
     if (alloc != memoryData.end()) {
         auto &pageFaultData = alloc->second;
-        if (pageFaultData.domain == AllocationDomain::Gpu) {
+        bool isProtected = pageFaultData.domain == AllocationDomain::Gpu;
+        if (pageFaultData.domain == AllocationDomain::Cpu) {
+            for (auto blockDomain : pageFaultData.blockDomains) {
+                isProtected |= blockDomain != AllocationDomain::Cpu;
+            }
+        }
+        if (isProtected) {
             allowCPUMemoryAccess(ptr, pageFaultData.size);
         }
+        unregisterCPUMemory(ptr, pageFaultData.size);
         this->memoryData.erase(ptr);
+        this->nonGpuDomainAllocations.erase(ptr);
     }
 }
 
 void PageFaultManager::moveAllocationToGpuDomain(void *ptr) {
-    std::unique_lock<SpinLock> lock{mtx};
+    std::shared_lock<std::shared_mutex> lock{mtx};
     auto alloc = memoryData.find(ptr);
     if (alloc != memoryData.end()) {
+        std::unique_lock<std::mutex> allocationLock{getAllocationLock(ptr)};
+        auto &pageFaultData = alloc->second;
+        if (pageFaultData.domain != AllocationDomain::Gpu) {
+            this->moveToGpuDomain(ptr, pageFaultData);
+        }
+        this->waitForPendingTransfer(pageFaultData);
+        this->eraseNonGpuDomainAllocation(ptr);
+    }
+}
+
+void PageFaultManager::moveAllocationToGpuDomainAsync(void *ptr) {
+    std::shared_lock<std::shared_mutex> lock{mtx};
+    auto alloc = findAllocation(ptr);
+    if (alloc != memoryData.end()) {
+        auto allocPtr = alloc->first;
+        std::unique_lock<std::mutex> allocationLock{getAllocationLock(allocPtr)};
         auto &pageFaultData = alloc->second;
         if (pageFaultData.domain != AllocationDomain::Gpu) {
-            this->setAubWritable(false, ptr, pageFaultData.unifiedMemoryManager);
+            this->setAubWritable(false, allocPtr, pageFaultData.unifiedMemoryManager);
             if (pageFaultData.domain == AllocationDomain::Cpu) {
-                this->transferToGpu(ptr, pageFaultData.cmdQ);
-                this->protectCPUMemoryAccess(ptr, pageFaultData.size);
+                this->moveCpuBlocksToGpuDomain(allocPtr, pageFaultData, true);
             }
             pageFaultData.domain = AllocationDomain::Gpu;
+            pageFaultData.blockDomains.clear();
+            if (!pageFaultData.transferPending) {
+                this->eraseNonGpuDomainAllocation(allocPtr);
+            }
         }
     }
 }
 
 void PageFaultManager::moveAllocationsWithinUMAllocsManagerToGpuDomain(SVMAllocsManager *unifiedMemoryManager) {
-    std::unique_lock<SpinLock> lock{mtx};
-    for (auto &alloc : this->memoryData) {
-        auto allocPtr = alloc.first;
-        auto &pageFaultData = alloc.second;
-        if (pageFaultData.unifiedMemoryManager == unifiedMemoryManager && pageFaultData.domain != AllocationDomain::Gpu) {
-            this->setAubWritable(false, allocPtr, pageFaultData.unifiedMemoryManager);
-            if (pageFaultData.domain == AllocationDomain::Cpu) {
-                this->transferToGpu(allocPtr, pageFaultData.cmdQ);
-                this->protectCPUMemoryAccess(allocPtr, pageFaultData.size);
+    std::shared_lock<std::shared_mutex> lock{mtx};
+    std::vector<void *> allocations;
+    {
+        std::unique_lock<SpinLock> nonGpuDomainAllocationsLock{nonGpuDomainAllocationsMtx};
+        allocations.assign(this->nonGpuDomainAllocations.begin(), this->nonGpuDomainAllocations.end());
+    }
+    for (auto allocPtr : allocations) {
+        auto &pageFaultData = this->memoryData.find(allocPtr)->second;
+        if (pageFaultData.unifiedMemoryManager != unifiedMemoryManager) {
+            continue;
+        }
+        std::unique_lock<std::mutex> allocationLock{getAllocationLock(allocPtr)};
+        if (pageFaultData.domain != AllocationDomain::Gpu) {
+            this->moveToGpuDomain(allocPtr, pageFaultData);
+        }
+        this->waitForPendingTransfer(pageFaultData);
+        this->eraseNonGpuDomainAllocation(allocPtr);
+    }
+}
+
+void PageFaultManager::moveToGpuDomain(void *allocPtr, PageFaultData &pageFaultData) {
+    this->setAubWritable(false, allocPtr, pageFaultData.unifiedMemoryManager);
+    if (pageFaultData.domain == AllocationDomain::Cpu) {
+        this->moveCpuBlocksToGpuDomain(allocPtr, pageFaultData, false);
+    }
+    pageFaultData.domain = AllocationDomain::Gpu;
+    pageFaultData.blockDomains.clear();
+}
+
+void PageFaultManager::waitForPendingTransfer(PageFaultData &pageFaultData) {
+    if (pageFaultData.transferPending) {
+        this->waitForTransfersToGpu(pageFaultData.cmdQ);
+        pageFaultData.transferPending = false;
+    }
+}
+
+void PageFaultManager::moveCpuBlocksToGpuDomain(void *allocPtr, PageFaultData &pageFaultData, bool async) {
+    // adjacent blocks in the same domain are handled as one range,
+    // blocks written by the CPU are transferred, duplicated ones only lose CPU access
+    const auto blocksCount = getBlocksCount(pageFaultData);
+    size_t blockIndex = 0;
+    while (blockIndex < blocksCount) {
+        const auto rangeDomain = getBlockDomain(pageFaultData, blockIndex);
+        const auto rangeStart = blockIndex * pageFaultData.blockSize;
+        while (blockIndex < blocksCount && getBlockDomain(pageFaultData, blockIndex) == rangeDomain) {
+            blockIndex++;
+        }
+        if (rangeDomain != AllocationDomain::Cpu && rangeDomain != AllocationDomain::Duplicated) {
+            continue;
+        }
+        auto rangeSize = std::min(blockIndex * pageFaultData.blockSize, pageFaultData.size) - rangeStart;
+        auto rangePtr = ptrOffset(allocPtr, rangeStart);
+
+        if (rangeDomain == AllocationDomain::Cpu) {
+            if (async) {
+                this->startTransferToGpu(rangePtr, rangeSize, pageFaultData.cmdQ);
+                pageFaultData.transferPending = true;
+            } else {
+                this->transferToGpu(rangePtr, rangeSize, pageFaultData.cmdQ);
             }
-            pageFaultData.domain = AllocationDomain::Gpu;
         }
+        this->protectCPUMemoryAccess(rangePtr, rangeSize);
+    }
+}
+
+PageFaultManager::MemoryDataIterator PageFaultManager::findAllocation(void *ptr) {
+    auto alloc = this->memoryData.upper_bound(ptr);
+    if (alloc == this->memoryData.begin()) {
+        return this->memoryData.end();
+    }
+    alloc--;
+    if (ptr < ptrOffset(alloc->first, alloc->second.size)) {
+        return alloc;
     }
+    return this->memoryData.end();
+}
+
+std::mutex &PageFaultManager::getAllocationLock(void *allocPtr) {
+    return this->allocationLocks[(reinterpret_cast<uintptr_t>(allocPtr) / MemoryConstants::pageSize) % allocationLocksCount];
+}
+
+void PageFaultManager::insertNonGpuDomainAllocation(void *allocPtr) {
+    std::unique_lock<SpinLock> lock{nonGpuDomainAllocationsMtx};
+    this->nonGpuDomainAllocations.insert(allocPtr);
+}
+
+void PageFaultManager::eraseNonGpuDomainAllocation(void *allocPtr) {
+    std::unique_lock<SpinLock> lock{nonGpuDomainAllocationsMtx};
+    this->nonGpuDomainAllocations.erase(allocPtr);
 }
 
 bool PageFaultManager::verifyPageFault(void *ptr) {
-    std::unique_lock<SpinLock> lock{mtx};
-    for (auto &alloc : this->memoryData) {
-        auto allocPtr = alloc.first;
-        auto &pageFaultData = alloc.second;
-        if (ptr >= allocPtr && ptr < ptrOffset(allocPtr, pageFaultData.size)) {
-            this->setAubWritable(true, allocPtr, pageFaultData.unifiedMemoryManager);
-
-            gpuDomainHandler(this, allocPtr, pageFaultData);
-            return true;
-        }
+    std::shared_lock<std::shared_mutex> lock{mtx};
+    auto alloc = findAllocation(ptr);
+    if (alloc == this->memoryData.end()) {
+        return false;
     }
-    return false;
+    auto allocPtr = alloc->first;
+    std::unique_lock<std::mutex> allocationLock{getAllocationLock(allocPtr)};
+    auto &pageFaultData = alloc->second;
+    auto blockIndex = ptrDiff(ptr, allocPtr) / pageFaultData.blockSize;
+
+    this->setAubWritable(true, allocPtr, pageFaultData.unifiedMemoryManager);
+
+    gpuDomainHandler(this, allocPtr, pageFaultData, blockIndex);
+    return true;
 }
 
-void PageFaultManager::handleGpuDomainTransferForHw(PageFaultManager *pageFaultHandler, void *allocPtr, PageFaultData &pageFaultData) {
-    if (pageFaultData.domain == AllocationDomain::Gpu) {
-        pageFaultHandler->transferToCpu(allocPtr, pageFaultData.size, pageFaultData.cmdQ);
+size_t PageFaultManager::getMigrationBlockSize(size_t size) {
+    size_t blockSize = defaultMigrationBlockSize;
+    if (DebugManager.flags.UsmMigrationBlockSize.get() != -1) {
+        blockSize = static_cast<size_t>(DebugManager.flags.UsmMigrationBlockSize.get());
     }
-    pageFaultData.domain = AllocationDomain::Cpu;
-    pageFaultHandler->allowCPUMemoryAccess(allocPtr, pageFaultData.size);
+    if (blockSize == 0 || blockSize >= size) {
+        return size;
+    }
+    return alignUp(blockSize, MemoryConstants::pageSize);
+}
+
+size_t PageFaultManager::getBlocksCount(const PageFaultData &pageFaultData) {
+    return pageFaultData.blockSize ? (pageFaultData.size + pageFaultData.blockSize - 1) / pageFaultData.blockSize : 1u;
 }
 
-void PageFaultManager::handleGpuDomainTransferForTbx(PageFaultManager *pageFaultHandler, void *allocPtr, PageFaultData &pageFaultData) {
-    pageFaultHandler->allowCPUMemoryAccess(allocPtr, pageFaultData.size);
+PageFaultManager::AllocationDomain PageFaultManager::getBlockDomain(const PageFaultData &pageFaultData, size_t blockIndex) {
+    if (pageFaultData.domain != AllocationDomain::Cpu) {
+        return pageFaultData.domain;
+    }
+    return pageFaultData.blockDomains.empty() ? AllocationDomain::Cpu : pageFaultData.blockDomains[blockIndex];
+}
+
+PageFaultManager::AllocationDomain PageFaultManager::getBlockDomainAfterCpuAccess(const PageFaultData &pageFaultData, AllocationDomain previousDomain) {
+    // advised allocations keep a read only copy on the CPU, so blocks which are only read are not written back
+    const bool duplicateOnRead = pageFaultData.memAdviseFlags.readMostly || pageFaultData.memAdviseFlags.devicePreferredLocation;
+    if (duplicateOnRead && (previousDomain == AllocationDomain::Gpu || previousDomain == AllocationDomain::None)) {
+        return AllocationDomain::Duplicated;
+    }
+    return AllocationDomain::Cpu;
+}
 
-    if (pageFaultData.domain == AllocationDomain::Gpu) {
-        pageFaultHandler->transferToCpu(allocPtr, pageFaultData.size, pageFaultData.cmdQ);
+void PageFaultManager::setBlockDomain(void *allocPtr, PageFaultData &pageFaultData, size_t blockIndex, AllocationDomain blockDomain) {
+    const auto blocksCount = getBlocksCount(pageFaultData);
+    if (pageFaultData.domain != AllocationDomain::Cpu) {
+        pageFaultData.blockDomains.clear();
+    }
+    if (pageFaultData.blockDomains.empty() && (blocksCount > 1 || blockDomain != AllocationDomain::Cpu)) {
+        pageFaultData.blockDomains.assign(blocksCount, pageFaultData.domain);
+    }
+    if (!pageFaultData.blockDomains.empty()) {
+        pageFaultData.blockDomains[blockIndex] = blockDomain;
     }
     pageFaultData.domain = AllocationDomain::Cpu;
+    this->insertNonGpuDomainAllocation(allocPtr);
+}
+
+void PageFaultManager::handleGpuDomainTransferForHw(PageFaultManager *pageFaultHandler, void *allocPtr, PageFaultData &pageFaultData, size_t blockIndex) {
+    const auto blockOffset = blockIndex * pageFaultData.blockSize;
+    const auto blockPtr = ptrOffset(allocPtr, blockOffset);
+    const auto blockSize = std::min(pageFaultData.blockSize, pageFaultData.size - blockOffset);
+    const auto previousDomain = getBlockDomain(pageFaultData, blockIndex);
+    const auto blockDomain = getBlockDomainAfterCpuAccess(pageFaultData, previousDomain);
+
+    if (previousDomain == AllocationDomain::Gpu) {
+        pageFaultHandler->transferToCpu(blockPtr, blockSize, pageFaultData.cmdQ);
+    }
+    pageFaultHandler->setBlockDomain(allocPtr, pageFaultData, blockIndex, blockDomain);
+    if (blockDomain == AllocationDomain::Duplicated) {
+        pageFaultHandler->allowCPUMemoryReadAccess(blockPtr, blockSize);
+    } else {
+        pageFaultHandler->allowCPUMemoryAccess(blockPtr, blockSize);
+    }
+}
+
+void PageFaultManager::handleGpuDomainTransferForTbx(PageFaultManager *pageFaultHandler, void *allocPtr, PageFaultData &pageFaultData, size_t blockIndex) {
+    const auto blockOffset = blockIndex * pageFaultData.blockSize;
+    const auto blockPtr = ptrOffset(allocPtr, blockOffset);
+    const auto blockSize = std::min(pageFaultData.blockSize, pageFaultData.size - blockOffset);
+    const auto previousDomain = getBlockDomain(pageFaultData, blockIndex);
+    const auto blockDomain = getBlockDomainAfterCpuAccess(pageFaultData, previousDomain);
+
+    pageFaultHandler->allowCPUMemoryAccess(blockPtr, blockSize);
+
+    if (previousDomain == AllocationDomain::Gpu) {
+        pageFaultHandler->transferToCpu(blockPtr, blockSize, pageFaultData.cmdQ);
+    }
+    pageFaultHandler->setBlockDomain(allocPtr, pageFaultData, blockIndex, blockDomain);
+    if (blockDomain == AllocationDomain::Duplicated) {
+        pageFaultHandler->allowCPUMemoryReadAccess(blockPtr, blockSize);
+    }
+}
+
+void PageFaultManager::setMemAdviseFlags(void *ptr, MemAdviseFlags memAdviseFlags) {
+    std::shared_lock<std::shared_mutex> lock{mtx};
+    auto alloc = findAllocation(ptr);
+    if (alloc != this->memoryData.end()) {
+        std::unique_lock<std::mutex> allocationLock{getAllocationLock(alloc->first)};
+        alloc->second.memAdviseFlags = memAdviseFlags;
+    }
 }
 
 void PageFaultManager::selectGpuDomainHandler() {
@@ -7,13 +7,20 @@
 
 #pragma once
 
+#include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/memory_manager/memadvise_flags.h"
 #include "shared/source/utilities/spinlock.h"
 
 #include "memory_properties_flags.h"
 
+#include <array>
+#include <map>
 #include <memory>
-#include <unordered_map>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_set>
+#include <vector>
 
 namespace NEO {
 class GraphicsAllocation;
@@ -27,40 +34,79 @@ class PageFaultManager : public NonCopyableOrMovableClass {
     virtual ~PageFaultManager() = default;
 
     MOCKABLE_VIRTUAL void moveAllocationToGpuDomain(void *ptr);
+    void moveAllocationToGpuDomainAsync(void *ptr);
     void moveAllocationsWithinUMAllocsManagerToGpuDomain(SVMAllocsManager *unifiedMemoryManager);
     void insertAllocation(void *ptr, size_t size, SVMAllocsManager *unifiedMemoryManager, void *cmdQ, const MemoryProperties &memoryProperties);
     void removeAllocation(void *ptr);
+    void setMemAdviseFlags(void *ptr, MemAdviseFlags memAdviseFlags);
 
     enum class AllocationDomain {
         None,
         Cpu,
         Gpu,
+        // valid on both sides, Cpu can only read
+        Duplicated,
     };
 
+    static constexpr size_t defaultMigrationBlockSize = 2 * MemoryConstants::megaByte;
+    static constexpr size_t allocationLocksCount = 64;
+
   protected:
     struct PageFaultData {
         size_t size;
         SVMAllocsManager *unifiedMemoryManager;
         void *cmdQ;
         AllocationDomain domain;
+        size_t blockSize = 0;
+        bool transferPending = false;
+        MemAdviseFlags memAdviseFlags;
+        // valid while domain is Cpu, empty means that all blocks are in Cpu domain
+        std::vector<AllocationDomain> blockDomains;
     };
+    using MemoryDataIterator = std::map<void *, PageFaultData>::iterator;
+
+    static size_t getMigrationBlockSize(size_t size);
+    static size_t getBlocksCount(const PageFaultData &pageFaultData);
+    static AllocationDomain getBlockDomain(const PageFaultData &pageFaultData, size_t blockIndex);
+    static AllocationDomain getBlockDomainAfterCpuAccess(const PageFaultData &pageFaultData, AllocationDomain previousDomain);
+    void setBlockDomain(void *allocPtr, PageFaultData &pageFaultData, size_t blockIndex, AllocationDomain blockDomain);
+    MemoryDataIterator findAllocation(void *ptr);
+    std::mutex &getAllocationLock(void *allocPtr);
+    void insertNonGpuDomainAllocation(void *allocPtr);
+    void eraseNonGpuDomainAllocation(void *allocPtr);
+    void moveToGpuDomain(void *allocPtr, PageFaultData &pageFaultData);
+    void moveCpuBlocksToGpuDomain(void *allocPtr, PageFaultData &pageFaultData, bool async);
+    void waitForPendingTransfer(PageFaultData &pageFaultData);
 
     virtual void allowCPUMemoryAccess(void *ptr, size_t size) = 0;
+    virtual void allowCPUMemoryReadAccess(void *ptr, size_t size) = 0;
     virtual void protectCPUMemoryAccess(void *ptr, size_t size) = 0;
+    virtual void registerCPUMemory(void *ptr, size_t size) {}
+    virtual void unregisterCPUMemory(void *ptr, size_t size) {}
 
     virtual void evictMemoryAfterImplCopy(GraphicsAllocation *allocation, Device *device) = 0;
 
     MOCKABLE_VIRTUAL bool verifyPageFault(void *ptr);
     MOCKABLE_VIRTUAL void transferToCpu(void *ptr, size_t size, void *cmdQ);
-    MOCKABLE_VIRTUAL void transferToGpu(void *ptr, void *cmdQ);
+    MOCKABLE_VIRTUAL void transferToGpu(void *ptr, size_t size, void *cmdQ);
+    MOCKABLE_VIRTUAL void startTransferToGpu(void *ptr, size_t size, void *cmdQ);
+    MOCKABLE_VIRTUAL void waitForTransfersToGpu(void *cmdQ);
     MOCKABLE_VIRTUAL void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager);
 
-    static void handleGpuDomainTransferForHw(PageFaultManager *pageFaultHandler, void *alloc, PageFaultData &pageFaultData);
-    static void handleGpuDomainTransferForTbx(PageFaultManager *pageFaultHandler, void *alloc, PageFaultData &pageFaultData);
+    static void handleGpuDomainTransferForHw(PageFaultManager *pageFaultHandler, void *alloc, PageFaultData &pageFaultData, size_t blockIndex);
+    static void handleGpuDomainTransferForTbx(PageFaultManager *pageFaultHandler, void *alloc, PageFaultData &pageFaultData, size_t blockIndex);
     void selectGpuDomainHandler();
 
     decltype(&handleGpuDomainTransferForHw) gpuDomainHandler = &handleGpuDomainTransferForHw;
-    std::unordered_map<void *, PageFaultData> memoryData;
-    SpinLock mtx;
+    std::map<void *, PageFaultData> memoryData;
+    // allocations which are not in Gpu domain or have a transfer to Gpu in flight,
+    // the only ones that may need migration before a submission
+    std::unordered_set<void *> nonGpuDomainAllocations;
+    // mtx is taken exclusively only to insert or remove allocations, state of a single
+    // allocation is guarded by its allocation lock, so faults on different allocations do not wait for each other
+    std::shared_mutex mtx;
+    // allocation locks are held across transfers, so waiters block instead of spinning
+    std::array<std::mutex, allocationLocksCount> allocationLocks;
+    SpinLock nonGpuDomainAllocationsMtx;
 };
 } // namespace NEO
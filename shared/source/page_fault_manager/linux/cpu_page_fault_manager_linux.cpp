@@ -9,10 +9,26 @@
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
+#include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/memory_manager/memory_operations_handler.h"
 
+#include <cerrno>
+#include <fcntl.h>
+#include <linux/userfaultfd.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/ioctl.h>
 #include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#ifndef UFFD_USER_MODE_ONLY
+#define UFFD_USER_MODE_ONLY 1
+#endif
+#ifndef UFFD_FEATURE_WP_UNPOPULATED
+#define UFFD_FEATURE_WP_UNPOPULATED (1 << 13)
+#endif
 
 namespace NEO {
 std::unique_ptr<PageFaultManager> PageFaultManager::create() {
@@ -40,9 +56,14 @@ PageFaultManagerLinux::PageFaultManagerLinux() {
 
     this->evictMemoryAfterCopy = DebugManager.flags.EnableDirectSubmission.get() &&
                                  DebugManager.flags.USMEvictAfterMigration.get();
+
+    if (DebugManager.flags.EnableUserFaultFdPageFaults.get() == 1) {
+        this->createUserFaultFd();
+    }
 }
 
 PageFaultManagerLinux::~PageFaultManagerLinux() {
+    destroyUserFaultFd();
     if (!previousHandlerRestored) {
         auto retVal = sigaction(SIGSEGV, &previousPageFaultHandler, nullptr);
         UNRECOVERABLE_IF(retVal != 0);
@@ -56,11 +77,140 @@ void PageFaultManagerLinux::pageFaultHandlerWrapper(int signal, siginfo_t *info,
 void PageFaultManagerLinux::allowCPUMemoryAccess(void *ptr, size_t size) {
     auto retVal = mprotect(ptr, size, PROT_READ | PROT_WRITE);
     UNRECOVERABLE_IF(retVal != 0);
+    writeProtectCPUMemory(ptr, size, false);
+}
+
+void PageFaultManagerLinux::allowCPUMemoryReadAccess(void *ptr, size_t size) {
+    // write protection is set before the range becomes writable, so no write can slip through
+    if (writeProtectCPUMemory(ptr, size, true)) {
+        auto retVal = mprotect(ptr, size, PROT_READ | PROT_WRITE);
+        UNRECOVERABLE_IF(retVal != 0);
+        return;
+    }
+    auto retVal = mprotect(ptr, size, PROT_READ);
+    UNRECOVERABLE_IF(retVal != 0);
 }
 
 void PageFaultManagerLinux::protectCPUMemoryAccess(void *ptr, size_t size) {
     auto retVal = mprotect(ptr, size, PROT_NONE);
     UNRECOVERABLE_IF(retVal != 0);
+    // GPU to CPU copies write the range from the faulting thread, they must not wait for userFaultFdThread
+    writeProtectCPUMemory(ptr, size, false);
+}
+
+void PageFaultManagerLinux::registerCPUMemory(void *ptr, size_t size) {
+    if (userFaultFd < 0) {
+        return;
+    }
+    uffdio_register registerRange = {};
+    registerRange.range.start = alignDown(reinterpret_cast<uint64_t>(ptr), MemoryConstants::pageSize);
+    registerRange.range.len = alignUp(reinterpret_cast<uint64_t>(ptr) + size, MemoryConstants::pageSize) - registerRange.range.start;
+    registerRange.mode = UFFDIO_REGISTER_MODE_WP;
+    // ranges which can not be registered fall back to read only protection
+    ioctl(userFaultFd, UFFDIO_REGISTER, &registerRange);
+}
+
+void PageFaultManagerLinux::unregisterCPUMemory(void *ptr, size_t size) {
+    if (userFaultFd < 0) {
+        return;
+    }
+    uffdio_range range = {};
+    range.start = alignDown(reinterpret_cast<uint64_t>(ptr), MemoryConstants::pageSize);
+    range.len = alignUp(reinterpret_cast<uint64_t>(ptr) + size, MemoryConstants::pageSize) - range.start;
+    ioctl(userFaultFd, UFFDIO_UNREGISTER, &range);
+}
+
+bool PageFaultManagerLinux::writeProtectCPUMemory(void *ptr, size_t size, bool writeProtect) {
+    if (userFaultFd < 0) {
+        return false;
+    }
+    uffdio_writeprotect writeProtectRange = {};
+    writeProtectRange.range.start = reinterpret_cast<uint64_t>(ptr);
+    writeProtectRange.range.len = size;
+    writeProtectRange.mode = writeProtect ? UFFDIO_WRITEPROTECT_MODE_WP : 0;
+    return ioctl(userFaultFd, UFFDIO_WRITEPROTECT, &writeProtectRange) == 0;
+}
+
+bool PageFaultManagerLinux::createUserFaultFd() {
+    auto fd = static_cast<int>(syscall(__NR_userfaultfd, O_CLOEXEC | O_NONBLOCK | UFFD_USER_MODE_ONLY));
+    if (fd < 0) {
+        return false;
+    }
+    // write protection of pages not touched yet is needed for copies created without a transfer
+    uffdio_api api = {};
+    api.api = UFFD_API;
+    api.features = UFFD_FEATURE_PAGEFAULT_FLAG_WP | UFFD_FEATURE_WP_UNPOPULATED;
+    if (ioctl(fd, UFFDIO_API, &api) != 0) {
+        close(fd);
+        return false;
+    }
+    auto stopEvent = eventfd(0, EFD_CLOEXEC);
+    if (stopEvent < 0) {
+        close(fd);
+        return false;
+    }
+    this->userFaultFd = fd;
+    this->userFaultFdStopEvent = stopEvent;
+    this->userFaultFdThread = Thread::create(userFaultFdWorker, reinterpret_cast<void *>(this));
+    return true;
+}
+
+void PageFaultManagerLinux::destroyUserFaultFd() {
+    if (userFaultFdThread) {
+        uint64_t stop = 1;
+        auto retVal = write(userFaultFdStopEvent, &stop, sizeof(stop));
+        UNRECOVERABLE_IF(retVal != sizeof(stop));
+        userFaultFdThread->join();
+        userFaultFdThread.reset();
+    }
+    if (userFaultFd >= 0) {
+        close(userFaultFdStopEvent);
+        close(userFaultFd);
+        userFaultFdStopEvent = -1;
+        userFaultFd = -1;
+    }
+}
+
+void *PageFaultManagerLinux::userFaultFdWorker(void *arg) {
+    auto pageFaultManager = reinterpret_cast<PageFaultManagerLinux *>(arg);
+    pollfd fds[2] = {{pageFaultManager->userFaultFd, POLLIN, 0},
+                     {pageFaultManager->userFaultFdStopEvent, POLLIN, 0}};
+    while (true) {
+        if (poll(fds, 2, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        if (fds[1].revents != 0) {
+            break;
+        }
+        if (fds[0].revents & POLLIN) {
+            pageFaultManager->handleUserFaultFdMessages();
+        }
+    }
+    return nullptr;
+}
+
+void PageFaultManagerLinux::handleUserFaultFdMessages() {
+    // every fault queued since the last wake up is resolved in one pass
+    constexpr size_t maxMessages = 64;
+    uffd_msg messages[maxMessages];
+    auto bytesRead = read(userFaultFd, messages, sizeof(messages));
+    if (bytesRead <= 0) {
+        return;
+    }
+    auto messagesCount = static_cast<size_t>(bytesRead) / sizeof(uffd_msg);
+    for (auto i = 0u; i < messagesCount; i++) {
+        if (messages[i].event != UFFD_EVENT_PAGEFAULT) {
+            continue;
+        }
+        auto address = reinterpret_cast<void *>(messages[i].arg.pagefault.address);
+        if (!this->verifyPageFault(address)) {
+            // allocation is no longer tracked, the faulting thread only has to be woken up
+            writeProtectCPUMemory(alignDown(address, MemoryConstants::pageSize), MemoryConstants::pageSize, false);
+        }
+    }
 }
 
 void PageFaultManagerLinux::callPreviousHandler(int signal, siginfo_t *info, void *context) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "shared/source/os_interface/os_thread.h"
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
 #include <csignal>
@@ -22,11 +23,20 @@ class PageFaultManagerLinux : public PageFaultManager {
 
   protected:
     void allowCPUMemoryAccess(void *ptr, size_t size) override;
+    void allowCPUMemoryReadAccess(void *ptr, size_t size) override;
     void protectCPUMemoryAccess(void *ptr, size_t size) override;
+    void registerCPUMemory(void *ptr, size_t size) override;
+    void unregisterCPUMemory(void *ptr, size_t size) override;
 
     void evictMemoryAfterImplCopy(GraphicsAllocation *allocation, Device *device) override;
 
     void callPreviousHandler(int signal, siginfo_t *info, void *context);
+
+    bool createUserFaultFd();
+    void destroyUserFaultFd();
+    bool writeProtectCPUMemory(void *ptr, size_t size, bool writeProtect);
+    static void *userFaultFdWorker(void *arg);
+    void handleUserFaultFdMessages();
     bool previousHandlerRestored = false;
 
     static std::function<void(int signal, siginfo_t *info, void *context)> pageFaultHandler;
@@ -34,5 +44,11 @@ class PageFaultManagerLinux : public PageFaultManager {
     struct sigaction previousPageFaultHandler = {};
 
     bool evictMemoryAfterCopy = false;
+
+    // read only copies are write protected with userfaultfd when available,
+    // writes to them are then resolved on userFaultFdThread without a signal
+    int userFaultFd = -1;
+    int userFaultFdStopEvent = -1;
+    std::unique_ptr<Thread> userFaultFdThread;
 };
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -34,46 +34,117 @@ void PrintFormatter::printKernelOutput(const std::function<void(char *)> &print)
     uint32_t stringIndex = 0;
     while (currentOffset + 4 <= printfOutputBufferSize) {
         read(&stringIndex);
-        const char *formatString = queryPrintfString(stringIndex);
-        if (formatString != nullptr) {
-            printString(formatString, print);
+        auto parsedString = getParsedPrintfString(stringIndex);
+        if (parsedString != nullptr) {
+            printString(*parsedString, print);
         }
     }
 }
 
-void PrintFormatter::printString(const char *formatString, const std::function<void(char *)> &print) {
-    size_t length = strnlen_s(formatString, maxSinglePrintStringLength - 1);
+const ParsedPrintfString *PrintFormatter::getParsedPrintfString(uint32_t index) {
+    auto parsedEntry = parsedPrintfStrings.find(index);
+    if (parsedEntry != parsedPrintfStrings.end()) {
+        return &parsedEntry->second;
+    }
+    const char *formatString = queryPrintfString(index);
+    if (formatString == nullptr) {
+        return nullptr;
+    }
+    return &parsedPrintfStrings.emplace(index, parsePrintfString(formatString)).first->second;
+}
 
-    size_t cursor = 0;
-    std::unique_ptr<char[]> dataFormat(new char[length + 1]);
+ParsedPrintfString PrintFormatter::parsePrintfString(const char *formatString) {
+    size_t length = strnlen_s(formatString, maxSinglePrintStringLength - 1);
 
-    for (size_t i = 0; i <= length; i++) {
-        if (formatString[i] == '\\')
-            output[cursor++] = escapeChar(formatString[++i]);
-        else if (formatString[i] == '%') {
-            size_t end = i;
-            if (end + 1 <= length && formatString[end + 1] == '%') {
-                output[cursor++] = '%';
+    ParsedPrintfString parsedString;
+    PrintfSegment segment;
+    for (size_t i = 0; i < length; i++) {
+        if (formatString[i] == '\\') {
+            segment.text += escapeChar(formatString[++i]);
+        } else if (formatString[i] == '%') {
+            if (i + 1 < length && formatString[i + 1] == '%') {
+                segment.text += '%';
+                i++;
                 continue;
             }
 
+            size_t end = i;
             while (isConversionSpecifier(formatString[end++]) == false && end < length)
                 ;
 
-            memcpy_s(dataFormat.get(), length, formatString + i, end - i);
-            dataFormat[end - i] = '\0';
+            segment.conversion = parseConversion(std::string(formatString + i, end - i));
+            segment.isString = formatString[end - 1] == 's';
 
-            if (formatString[end - 1] == 's')
-                cursor += printStringToken(output.get() + cursor, maxSinglePrintStringLength - cursor, dataFormat.get());
-            else
-                cursor += printToken(output.get() + cursor, maxSinglePrintStringLength - cursor, dataFormat.get());
+            std::unique_ptr<char[]> elementFormat(new char[end - i + 1]);
+            stripVectorFormat(segment.conversion.format.c_str(), elementFormat.get());
+            stripVectorTypeConversion(elementFormat.get());
+            segment.vectorElementConversion = parseConversion(elementFormat.get());
 
+            parsedString.push_back(std::move(segment));
+            segment = {};
             i = end - 1;
         } else {
-            output[cursor++] = formatString[i];
+            segment.text += formatString[i];
+        }
+    }
+    parsedString.push_back(std::move(segment));
+    return parsedString;
+}
+
+PrintfConversion PrintFormatter::parseConversion(std::string format) {
+    PrintfConversion conversion;
+    conversion.format = std::move(format);
+
+    auto &conversionFormat = conversion.format;
+    if (conversionFormat.size() < 2) {
+        return conversion;
+    }
+    auto lengthModifier = conversionFormat.substr(1, conversionFormat.size() - 2);
+    if (!lengthModifier.empty() && lengthModifier != "l" && lengthModifier != "ll") {
+        return conversion;
+    }
+    conversion.longModifier = !lengthModifier.empty();
+
+    switch (conversionFormat.back()) {
+    case 'd':
+    case 'i':
+        conversion.integerFormat = IntegerFormat::signedDecimal;
+        break;
+    case 'u':
+        conversion.integerFormat = IntegerFormat::unsignedDecimal;
+        break;
+    case 'x':
+        conversion.integerFormat = IntegerFormat::hexadecimal;
+        break;
+    case 'X':
+        conversion.integerFormat = IntegerFormat::upperHexadecimal;
+        break;
+    default:
+        break;
+    }
+    return conversion;
+}
+
+void PrintFormatter::printString(const ParsedPrintfString &parsedString, const std::function<void(char *)> &print) {
+    size_t cursor = 0;
+    const size_t maxCursor = maxSinglePrintStringLength - 1;
+
+    for (auto &segment : parsedString) {
+        auto textLength = std::min(segment.text.size(), maxCursor - cursor);
+        memcpy_s(output.get() + cursor, maxSinglePrintStringLength - cursor, segment.text.c_str(), textLength);
+        cursor += textLength;
+
+        if (segment.conversion.format.empty()) {
+            continue;
+        }
+        if (segment.isString) {
+            cursor += printStringToken(output.get() + cursor, maxSinglePrintStringLength - cursor, segment.conversion.format.c_str());
+        } else {
+            cursor += printToken(output.get() + cursor, maxSinglePrintStringLength - cursor, segment);
         }
+        cursor = std::min(cursor, maxCursor);
     }
-    output[maxSinglePrintStringLength - 1] = '\0';
+    output[cursor] = '\0';
     print(output.get());
 }
 
@@ -103,37 +174,37 @@ void PrintFormatter::stripVectorTypeConversion(char *format) {
     }
 }
 
-size_t PrintFormatter::printToken(char *output, size_t size, const char *formatString) {
+size_t PrintFormatter::printToken(char *output, size_t size, const PrintfSegment &segment) {
     PRINTF_DATA_TYPE type(PRINTF_DATA_TYPE::INVALID);
     read(&type);
 
     switch (type) {
     case PRINTF_DATA_TYPE::BYTE:
-        return typedPrintToken<int8_t>(output, size, formatString);
+        return typedPrintToken<int8_t>(output, size, segment.conversion);
     case PRINTF_DATA_TYPE::SHORT:
-        return typedPrintToken<int16_t>(output, size, formatString);
+        return typedPrintToken<int16_t>(output, size, segment.conversion);
     case PRINTF_DATA_TYPE::INT:
-        return typedPrintToken<int>(output, size, formatString);
+        return typedPrintToken<int>(output, size, segment.conversion);
     case PRINTF_DATA_TYPE::FLOAT:
-        return typedPrintToken<float>(output, size, formatString);
+        return typedPrintToken<float>(output, size, segment.conversion);
     case PRINTF_DATA_TYPE::LONG:
-        return typedPrintToken<int64_t>(output, size, formatString);
+        return typedPrintToken<int64_t>(output, size, segment.conversion);
     case PRINTF_DATA_TYPE::POINTER:
-        return printPointerToken(output, size, formatString);
+        return printPointerToken(output, size, segment.conversion.format.c_str());
     case PRINTF_DATA_TYPE::DOUBLE:
-        return typedPrintToken<double>(output, size, formatString);
+        return typedPrintToken<double>(output, size, segment.conversion);
     case PRINTF_DATA_TYPE::VECTOR_BYTE:
-        return typedPrintVectorToken<int8_t>(output, size, formatString);
+        return typedPrintVectorToken<int8_t>(output, size, segment.vectorElementConversion);
     case PRINTF_DATA_TYPE::VECTOR_SHORT:
-        return typedPrintVectorToken<int16_t>(output, size, formatString);
+        return typedPrintVectorToken<int16_t>(output, size, segment.vectorElementConversion);
     case PRINTF_DATA_TYPE::VECTOR_INT:
-        return typedPrintVectorToken<int>(output, size, formatString);
+        return typedPrintVectorToken<int>(output, size, segment.vectorElementConversion);
     case PRINTF_DATA_TYPE::VECTOR_LONG:
-        return typedPrintVectorToken<int64_t>(output, size, formatString);
+        return typedPrintVectorToken<int64_t>(output, size, segment.vectorElementConversion);
     case PRINTF_DATA_TYPE::VECTOR_FLOAT:
-        return typedPrintVectorToken<float>(output, size, formatString);
+        return typedPrintVectorToken<float>(output, size, segment.vectorElementConversion);
     case PRINTF_DATA_TYPE::VECTOR_DOUBLE:
-        return typedPrintVectorToken<double>(output, size, formatString);
+        return typedPrintVectorToken<double>(output, size, segment.vectorElementConversion);
     default:
         return 0;
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -13,10 +13,13 @@
 
 #include <algorithm>
 #include <cctype>
+#include <charconv>
 #include <cstdint>
 #include <functional>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 extern int memcpy_s(void *dst, size_t destSize, const void *src, size_t count);
 
@@ -42,6 +45,31 @@ enum class PRINTF_DATA_TYPE : int {
     VECTOR_DOUBLE
 };
 
+// integer conversions without flags, width or precision are printed with std::to_chars instead of snprintf
+enum class IntegerFormat : uint8_t {
+    none,
+    signedDecimal,
+    unsignedDecimal,
+    hexadecimal,
+    upperHexadecimal
+};
+
+struct PrintfConversion {
+    std::string format;
+    IntegerFormat integerFormat = IntegerFormat::none;
+    bool longModifier = false;
+};
+
+// literal text followed by a single conversion, format strings are parsed once per formatter
+struct PrintfSegment {
+    std::string text;
+    PrintfConversion conversion;
+    PrintfConversion vectorElementConversion;
+    bool isString = false;
+};
+
+using ParsedPrintfString = std::vector<PrintfSegment>;
+
 class PrintFormatter {
   public:
     PrintFormatter(const uint8_t *printfOutputBuffer, uint32_t printfOutputBufferMaxSize,
@@ -52,8 +80,11 @@ class PrintFormatter {
 
   protected:
     const char *queryPrintfString(uint32_t index) const;
-    void printString(const char *formatString, const std::function<void(char *)> &print);
-    size_t printToken(char *output, size_t size, const char *formatString);
+    const ParsedPrintfString *getParsedPrintfString(uint32_t index);
+    ParsedPrintfString parsePrintfString(const char *formatString);
+    PrintfConversion parseConversion(std::string format);
+    void printString(const ParsedPrintfString &parsedString, const std::function<void(char *)> &print);
+    size_t printToken(char *output, size_t size, const PrintfSegment &segment);
     size_t printStringToken(char *output, size_t size, const char *formatString);
     size_t printPointerToken(char *output, size_t size, const char *formatString);
 
@@ -80,29 +111,60 @@ class PrintFormatter {
     }
 
     template <class T>
-    size_t typedPrintToken(char *output, size_t size, const char *formatString) {
+    size_t printValue(char *output, size_t size, const PrintfConversion &conversion, T value) {
+        if constexpr (std::is_integral_v<T>) {
+            // values narrower than long are promoted to int by the printf calling convention
+            if (conversion.integerFormat != IntegerFormat::none && conversion.longModifier == (sizeof(T) > sizeof(int32_t))) {
+                using SignedType = std::conditional_t<(sizeof(T) > sizeof(int32_t)), int64_t, int32_t>;
+                using UnsignedType = std::make_unsigned_t<SignedType>;
+                auto signedValue = static_cast<SignedType>(value);
+
+                char digits[24];
+                std::to_chars_result result;
+                if (conversion.integerFormat == IntegerFormat::signedDecimal) {
+                    result = std::to_chars(digits, digits + sizeof(digits), signedValue);
+                } else {
+                    int base = conversion.integerFormat == IntegerFormat::unsignedDecimal ? 10 : 16;
+                    result = std::to_chars(digits, digits + sizeof(digits), static_cast<UnsignedType>(signedValue), base);
+                }
+                size_t length = result.ptr - digits;
+                if (conversion.integerFormat == IntegerFormat::upperHexadecimal) {
+                    std::transform(digits, result.ptr, digits, [](char c) { return static_cast<char>(std::toupper(c)); });
+                }
+                // same truncation and return value as snprintf
+                if (size > 0) {
+                    auto copied = std::min(length, size - 1);
+                    memcpy_s(output, size, digits, copied);
+                    output[copied] = '\0';
+                }
+                return length;
+            }
+        }
+        return simple_sprintf(output, size, conversion.format.c_str(), value);
+    }
+
+    template <class T>
+    size_t typedPrintToken(char *output, size_t size, const PrintfConversion &conversion) {
         T value = {0};
         read(&value);
-        return simple_sprintf(output, size, formatString, value);
+        return printValue(output, size, conversion, value);
     }
 
     template <class T>
-    size_t typedPrintVectorToken(char *output, size_t size, const char *formatString) {
+    size_t typedPrintVectorToken(char *output, size_t size, const PrintfConversion &elementConversion) {
         T value = {0};
         int valueCount = 0;
         read(&valueCount);
 
         size_t charactersPrinted = 0;
-        char strippedFormat[1024];
-
-        stripVectorFormat(formatString, strippedFormat);
-        stripVectorTypeConversion(strippedFormat);
 
         for (int i = 0; i < valueCount; i++) {
             read(&value);
-            charactersPrinted += simple_sprintf(output + charactersPrinted, size - charactersPrinted, strippedFormat, value);
+            charactersPrinted += printValue(output + charactersPrinted, size - charactersPrinted, elementConversion, value);
+            charactersPrinted = std::min(charactersPrinted, size - 1);
             if (i < valueCount - 1) {
                 charactersPrinted += simple_sprintf(output + charactersPrinted, size - charactersPrinted, "%c", ',');
+                charactersPrinted = std::min(charactersPrinted, size - 1);
             }
         }
 
@@ -122,5 +184,7 @@ class PrintFormatter {
     bool using32BitPointers = false;
 
     uint32_t currentOffset = 0; // current position in currently parsed buffer
+
+    std::unordered_map<uint32_t, ParsedPrintfString> parsedPrintfStrings;
 };
 }; // namespace NEO
@@ -0,0 +1,481 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/program/program_info_serializer.h"
+
+#include "shared/source/device_binary_format/elf/elf_decoder.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/kernel/kernel_descriptor.h"
+#include "shared/source/program/program_info.h"
+
+#include "opencl/source/program/kernel_info.h"
+
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+namespace NEO {
+
+namespace ProgramInfoSerialization {
+
+using DispatchTraits = decltype(KernelDescriptor::PayloadMappings::dispatchTraits);
+using BindingTable = decltype(KernelDescriptor::PayloadMappings::bindingTable);
+using SamplerTable = decltype(KernelDescriptor::PayloadMappings::samplerTable);
+using ImplicitArgs = decltype(KernelDescriptor::PayloadMappings::implicitArgs);
+using EntryPoints = decltype(KernelDescriptor::entryPoints);
+using ByValueArgument = decltype(KernelDescriptor::kernelMetadata)::ByValueArgument;
+
+enum class PointerBase : uint8_t {
+    Null = 0,
+    DeviceBinary,
+    GeneratedHeaps
+};
+
+uint64_t getLayoutSignature() {
+    const size_t sizes[] = {sizeof(Header), sizeof(KernelDescriptor::KernelAttributes), sizeof(EntryPoints), sizeof(DispatchTraits),
+                            sizeof(BindingTable), sizeof(SamplerTable), sizeof(ImplicitArgs), sizeof(ArgDescPointer), sizeof(ArgDescImage),
+                            sizeof(ArgDescSampler), sizeof(ArgDescValue::Element), sizeof(ArgTypeTraits), sizeof(ArgDescriptor::ExtendedTypeInfo),
+                            sizeof(ByValueArgument), sizeof(HeapInfo)};
+    uint64_t signature = 0U;
+    for (auto size : sizes) {
+        signature = signature * 131 + size;
+    }
+    return signature;
+}
+
+class BlobWriter {
+  public:
+    BlobWriter(std::vector<uint8_t> &out) : out(out) {}
+
+    template <typename T>
+    void write(const T &value) {
+        static_assert(std::is_trivially_copyable<T>::value, "");
+        writeBytes(&value, sizeof(T));
+    }
+
+    void writeBytes(const void *data, size_t size) {
+        auto bytes = reinterpret_cast<const uint8_t *>(data);
+        out.insert(out.end(), bytes, bytes + size);
+    }
+
+    void writeString(const std::string &str) {
+        write(static_cast<uint32_t>(str.size()));
+        writeBytes(str.data(), str.size());
+    }
+
+  protected:
+    std::vector<uint8_t> &out;
+};
+
+class BlobReader {
+  public:
+    BlobReader(ArrayRef<const uint8_t> blob) : blob(blob) {}
+
+    template <typename T>
+    bool read(T &value) {
+        static_assert(std::is_trivially_copyable<T>::value, "");
+        return readBytes(&value, sizeof(T));
+    }
+
+    bool readBytes(void *dst, size_t size) {
+        if (size > blob.size() - pos) {
+            return false;
+        }
+        memcpy(dst, blob.begin() + pos, size);
+        pos += size;
+        return true;
+    }
+
+    bool readString(std::string &str) {
+        uint32_t size = 0U;
+        if ((false == read(size)) || (size > blob.size() - pos)) {
+            return false;
+        }
+        str.assign(reinterpret_cast<const char *>(blob.begin() + pos), size);
+        pos += size;
+        return true;
+    }
+
+    template <typename T>
+    bool readCount(T &count, size_t minElementSize) {
+        return read(count) && (static_cast<uint64_t>(count) * minElementSize <= blob.size() - pos);
+    }
+
+    bool isFullyConsumed() const {
+        return blob.size() == pos;
+    }
+
+  protected:
+    ArrayRef<const uint8_t> blob;
+    size_t pos = 0U;
+};
+
+bool isInRange(const void *ptr, size_t size, ArrayRef<const uint8_t> range) {
+    auto rangeBegin = reinterpret_cast<uintptr_t>(range.begin());
+    auto rangeEnd = reinterpret_cast<uintptr_t>(range.end());
+    auto address = reinterpret_cast<uintptr_t>(ptr);
+    return (address >= rangeBegin) && (address <= rangeEnd) && (size <= rangeEnd - address);
+}
+
+bool writePointer(BlobWriter &writer, const void *ptr, size_t size, ArrayRef<const uint8_t> deviceBinary, ArrayRef<const uint8_t> generatedHeaps) {
+    PointerBase base = PointerBase::Null;
+    uint64_t offset = 0U;
+    if (nullptr != ptr) {
+        if (isInRange(ptr, size, deviceBinary)) {
+            base = PointerBase::DeviceBinary;
+            offset = ptrDiff(ptr, deviceBinary.begin());
+        } else if (isInRange(ptr, size, generatedHeaps)) {
+            base = PointerBase::GeneratedHeaps;
+            offset = ptrDiff(ptr, generatedHeaps.begin());
+        } else {
+            return false;
+        }
+    }
+    writer.write(base);
+    writer.write(offset);
+    return true;
+}
+
+bool readPointer(BlobReader &reader, const void *&ptr, size_t size, ArrayRef<const uint8_t> deviceBinary, ArrayRef<const uint8_t> generatedHeaps) {
+    PointerBase base = PointerBase::Null;
+    uint64_t offset = 0U;
+    if ((false == reader.read(base)) || (false == reader.read(offset))) {
+        return false;
+    }
+
+    ArrayRef<const uint8_t> range;
+    switch (base) {
+    default:
+        return false;
+    case PointerBase::Null:
+        ptr = nullptr;
+        return true;
+    case PointerBase::DeviceBinary:
+        range = deviceBinary;
+        break;
+    case PointerBase::GeneratedHeaps:
+        range = generatedHeaps;
+        break;
+    }
+
+    if ((offset > range.size()) || (size > range.size() - offset)) {
+        return false;
+    }
+    ptr = range.begin() + offset;
+    return true;
+}
+
+bool isSerializable(const KernelInfo &kernelInfo) {
+    const auto &desc = kernelInfo.kernelDescriptor;
+    if ((nullptr != desc.external.debugData) || (nullptr != desc.external.relocatedDebugData) || (nullptr != desc.external.igcInfoForGtpin) ||
+        (nullptr != desc.extendedInfo) || (nullptr != kernelInfo.igcInfoForGtpin) || (nullptr != kernelInfo.crossThreadData) ||
+        (nullptr != kernelInfo.kernelAllocation) || (false == kernelInfo.kernelArgInfo.empty()) || (false == kernelInfo.kernelNonArgInfo.empty())) {
+        return false;
+    }
+    for (const auto &extendedDescriptor : desc.payloadMappings.explicitArgsExtendedDescriptors) {
+        if (nullptr != extendedDescriptor) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void writeArg(BlobWriter &writer, const ArgDescriptor &arg) {
+    writer.write(arg.type);
+    writer.write(arg.getTraits());
+    writer.write(arg.getExtendedTypeInfo());
+    switch (arg.type) {
+    default:
+        break;
+    case ArgDescriptor::ArgTPointer:
+        writer.write(arg.as<ArgDescPointer>());
+        break;
+    case ArgDescriptor::ArgTImage:
+        writer.write(arg.as<ArgDescImage>());
+        break;
+    case ArgDescriptor::ArgTSampler:
+        writer.write(arg.as<ArgDescSampler>());
+        break;
+    case ArgDescriptor::ArgTValue: {
+        const auto &elements = arg.as<ArgDescValue>().elements;
+        writer.write(static_cast<uint32_t>(elements.size()));
+        for (const auto &element : elements) {
+            writer.write(element);
+        }
+    } break;
+    }
+}
+
+bool readArg(BlobReader &reader, ArgDescriptor &arg) {
+    ArgDescriptor::ArgType type = ArgDescriptor::ArgTUnknown;
+    if (false == reader.read(type)) {
+        return false;
+    }
+    if (type > ArgDescriptor::ArgTValue) {
+        return false;
+    }
+
+    arg = ArgDescriptor(type);
+    bool valid = reader.read(arg.getTraits()) && reader.read(arg.getExtendedTypeInfo());
+    switch (type) {
+    default:
+        break;
+    case ArgDescriptor::ArgTPointer:
+        valid &= reader.read(arg.as<ArgDescPointer>());
+        break;
+    case ArgDescriptor::ArgTImage:
+        valid &= reader.read(arg.as<ArgDescImage>());
+        break;
+    case ArgDescriptor::ArgTSampler:
+        valid &= reader.read(arg.as<ArgDescSampler>());
+        break;
+    case ArgDescriptor::ArgTValue: {
+        uint32_t numElements = 0U;
+        valid &= reader.readCount(numElements, sizeof(ArgDescValue::Element));
+        auto &elements = arg.as<ArgDescValue>().elements;
+        for (uint32_t i = 0; valid && (i < numElements); ++i) {
+            ArgDescValue::Element element;
+            valid &= reader.read(element);
+            elements.push_back(element);
+        }
+    } break;
+    }
+    return valid;
+}
+
+bool writeKernelInfo(BlobWriter &writer, const KernelInfo &kernelInfo, ArrayRef<const uint8_t> deviceBinary) {
+    const auto &desc = kernelInfo.kernelDescriptor;
+    const auto &heapInfo = kernelInfo.heapInfo;
+
+    writer.write(static_cast<uint64_t>(desc.generatedHeaps.size()));
+    writer.writeBytes(desc.generatedHeaps.data(), desc.generatedHeaps.size());
+    ArrayRef<const uint8_t> generatedHeaps(desc.generatedHeaps.data(), desc.generatedHeaps.size());
+
+    writer.write(heapInfo.KernelHeapSize);
+    writer.write(heapInfo.GeneralStateHeapSize);
+    writer.write(heapInfo.DynamicStateHeapSize);
+    writer.write(heapInfo.SurfaceStateHeapSize);
+    writer.write(heapInfo.KernelUnpaddedSize);
+    if ((false == writePointer(writer, heapInfo.pKernelHeap, heapInfo.KernelHeapSize, deviceBinary, generatedHeaps)) ||
+        (false == writePointer(writer, heapInfo.pGsh, heapInfo.GeneralStateHeapSize, deviceBinary, generatedHeaps)) ||
+        (false == writePointer(writer, heapInfo.pDsh, heapInfo.DynamicStateHeapSize, deviceBinary, generatedHeaps)) ||
+        (false == writePointer(writer, heapInfo.pSsh, heapInfo.SurfaceStateHeapSize, deviceBinary, generatedHeaps))) {
+        return false;
+    }
+
+    writer.write(desc.kernelAttributes);
+    writer.write(desc.entryPoints);
+    writer.write(desc.payloadMappings.dispatchTraits);
+    writer.write(desc.payloadMappings.bindingTable);
+    writer.write(desc.payloadMappings.samplerTable);
+    writer.write(desc.payloadMappings.implicitArgs);
+
+    writer.write(static_cast<uint32_t>(desc.payloadMappings.explicitArgs.size()));
+    for (const auto &arg : desc.payloadMappings.explicitArgs) {
+        writeArg(writer, arg);
+    }
+    writer.write(static_cast<uint32_t>(desc.payloadMappings.explicitArgsExtendedDescriptors.size()));
+
+    writer.write(static_cast<uint32_t>(desc.explicitArgsExtendedMetadata.size()));
+    for (const auto &argMetadata : desc.explicitArgsExtendedMetadata) {
+        writer.writeString(argMetadata.argName);
+        writer.writeString(argMetadata.type);
+        writer.writeString(argMetadata.accessQualifier);
+        writer.writeString(argMetadata.addressQualifier);
+        writer.writeString(argMetadata.typeQualifiers);
+    }
+
+    const auto &metadata = desc.kernelMetadata;
+    writer.writeString(metadata.kernelName);
+    writer.writeString(metadata.kernelLanguageAttributes);
+    writer.write(static_cast<uint32_t>(metadata.printfStringsMap.size()));
+    for (const auto &printfString : metadata.printfStringsMap) {
+        writer.write(printfString.first);
+        writer.writeString(printfString.second);
+    }
+    writer.write(static_cast<uint32_t>(metadata.deviceSideEnqueueChildrenKernelsIdOffset.size()));
+    for (const auto &childIdOffset : metadata.deviceSideEnqueueChildrenKernelsIdOffset) {
+        writer.write(childIdOffset.first);
+        writer.write(childIdOffset.second);
+    }
+    writer.write(metadata.deviceSideEnqueueBlockInterfaceDescriptorOffset);
+    writer.write(static_cast<uint32_t>(metadata.allByValueKernelArguments.size()));
+    for (const auto &byValueArg : metadata.allByValueKernelArguments) {
+        writer.write(byValueArg);
+    }
+    writer.write(metadata.compiledSubGroupsNumber);
+    writer.write(metadata.requiredSubGroupSize);
+    return true;
+}
+
+bool readKernelInfo(BlobReader &reader, KernelInfo &kernelInfo, ArrayRef<const uint8_t> deviceBinary) {
+    auto &desc = kernelInfo.kernelDescriptor;
+    auto &heapInfo = kernelInfo.heapInfo;
+
+    uint64_t generatedHeapsSize = 0U;
+    if (false == reader.readCount(generatedHeapsSize, 1U)) {
+        return false;
+    }
+    desc.generatedHeaps.resize(static_cast<size_t>(generatedHeapsSize));
+    if (false == reader.readBytes(desc.generatedHeaps.data(), desc.generatedHeaps.size())) {
+        return false;
+    }
+    ArrayRef<const uint8_t> generatedHeaps(desc.generatedHeaps.data(), desc.generatedHeaps.size());
+
+    bool valid = reader.read(heapInfo.KernelHeapSize) && reader.read(heapInfo.GeneralStateHeapSize) && reader.read(heapInfo.DynamicStateHeapSize) &&
+                 reader.read(heapInfo.SurfaceStateHeapSize) && reader.read(heapInfo.KernelUnpaddedSize);
+    valid = valid && readPointer(reader, heapInfo.pKernelHeap, heapInfo.KernelHeapSize, deviceBinary, generatedHeaps) &&
+            readPointer(reader, heapInfo.pGsh, heapInfo.GeneralStateHeapSize, deviceBinary, generatedHeaps) &&
+            readPointer(reader, heapInfo.pDsh, heapInfo.DynamicStateHeapSize, deviceBinary, generatedHeaps) &&
+            readPointer(reader, heapInfo.pSsh, heapInfo.SurfaceStateHeapSize, deviceBinary, generatedHeaps);
+
+    valid = valid && reader.read(desc.kernelAttributes) && reader.read(desc.entryPoints) && reader.read(desc.payloadMappings.dispatchTraits) &&
+            reader.read(desc.payloadMappings.bindingTable) && reader.read(desc.payloadMappings.samplerTable) && reader.read(desc.payloadMappings.implicitArgs);
+
+    uint32_t numArgs = 0U;
+    valid = valid && reader.readCount(numArgs, sizeof(ArgDescriptor::ArgType));
+    for (uint32_t i = 0; valid && (i < numArgs); ++i) {
+        ArgDescriptor arg;
+        valid &= readArg(reader, arg);
+        desc.payloadMappings.explicitArgs.push_back(arg);
+    }
+    uint32_t numExtendedDescriptors = 0U;
+    valid = valid && reader.read(numExtendedDescriptors) && (numExtendedDescriptors <= numArgs);
+    if (false == valid) {
+        return false;
+    }
+    desc.payloadMappings.explicitArgsExtendedDescriptors.resize(numExtendedDescriptors);
+
+    uint32_t numArgsMetadata = 0U;
+    valid = reader.readCount(numArgsMetadata, 5 * sizeof(uint32_t));
+    for (uint32_t i = 0; valid && (i < numArgsMetadata); ++i) {
+        ArgTypeMetadataExtended argMetadata;
+        valid &= reader.readString(argMetadata.argName) && reader.readString(argMetadata.type) && reader.readString(argMetadata.accessQualifier) &&
+                 reader.readString(argMetadata.addressQualifier) && reader.readString(argMetadata.typeQualifiers);
+        desc.explicitArgsExtendedMetadata.push_back(std::move(argMetadata));
+    }
+
+    auto &metadata = desc.kernelMetadata;
+    valid = valid && reader.readString(metadata.kernelName) && reader.readString(metadata.kernelLanguageAttributes);
+    uint32_t numPrintfStrings = 0U;
+    valid = valid && reader.readCount(numPrintfStrings, 2 * sizeof(uint32_t));
+    for (uint32_t i = 0; valid && (i < numPrintfStrings); ++i) {
+        uint32_t index = 0U;
+        std::string printfString;
+        valid &= reader.read(index) && reader.readString(printfString);
+        metadata.printfStringsMap[index] = std::move(printfString);
+    }
+    uint32_t numChildren = 0U;
+    valid = valid && reader.readCount(numChildren, 2 * sizeof(uint32_t));
+    for (uint32_t i = 0; valid && (i < numChildren); ++i) {
+        std::pair<uint32_t, uint32_t> childIdOffset;
+        valid &= reader.read(childIdOffset.first) && reader.read(childIdOffset.second);
+        metadata.deviceSideEnqueueChildrenKernelsIdOffset.push_back(childIdOffset);
+    }
+    valid = valid && reader.read(metadata.deviceSideEnqueueBlockInterfaceDescriptorOffset);
+    uint32_t numByValueArgs = 0U;
+    valid = valid && reader.readCount(numByValueArgs, sizeof(ByValueArgument));
+    for (uint32_t i = 0; valid && (i < numByValueArgs); ++i) {
+        ByValueArgument byValueArg;
+        valid &= reader.read(byValueArg);
+        metadata.allByValueKernelArguments.push_back(byValueArg);
+    }
+    valid = valid && reader.read(metadata.compiledSubGroupsNumber) && reader.read(metadata.requiredSubGroupSize);
+    return valid;
+}
+
+} // namespace ProgramInfoSerialization
+
+bool serializeProgramInfo(const ProgramInfo &programInfo, ArrayRef<const uint8_t> deviceBinary, std::vector<uint8_t> &outBlob) {
+    using namespace ProgramInfoSerialization;
+
+    if (nullptr != programInfo.linkerInput) {
+        return false;
+    }
+    for (const auto &kernelInfo : programInfo.kernelInfos) {
+        if (false == isSerializable(*kernelInfo)) {
+            return false;
+        }
+    }
+
+    std::vector<uint8_t> blob;
+    BlobWriter writer(blob);
+    Header header;
+    header.layoutSignature = getLayoutSignature();
+    header.deviceBinarySize = deviceBinary.size();
+    writer.write(header);
+
+    uint8_t hasDecodedElf = (nullptr != programInfo.decodedElf.elfFileHeader) ? 1U : 0U;
+    writer.write(hasDecodedElf);
+
+    ArrayRef<const uint8_t> noGeneratedHeaps;
+    writer.write(static_cast<uint64_t>(programInfo.globalConstants.size));
+    writer.write(static_cast<uint64_t>(programInfo.globalVariables.size));
+    if ((false == writePointer(writer, programInfo.globalConstants.initData, programInfo.globalConstants.size, deviceBinary, noGeneratedHeaps)) ||
+        (false == writePointer(writer, programInfo.globalVariables.initData, programInfo.globalVariables.size, deviceBinary, noGeneratedHeaps))) {
+        return false;
+    }
+
+    writer.write(static_cast<uint32_t>(programInfo.kernelInfos.size()));
+    for (const auto &kernelInfo : programInfo.kernelInfos) {
+        if (false == writeKernelInfo(writer, *kernelInfo, deviceBinary)) {
+            return false;
+        }
+    }
+
+    outBlob = std::move(blob);
+    return true;
+}
+
+bool deserializeProgramInfo(ArrayRef<const uint8_t> blob, ArrayRef<const uint8_t> deviceBinary, ProgramInfo &dst) {
+    using namespace ProgramInfoSerialization;
+
+    BlobReader reader(blob);
+    Header header;
+    if ((false == reader.read(header)) || (magic != header.magic) || (version != header.version) ||
+        (getLayoutSignature() != header.layoutSignature) || (deviceBinary.size() != header.deviceBinarySize)) {
+        return false;
+    }
+
+    ProgramInfo programInfo;
+    uint8_t hasDecodedElf = 0U;
+    uint64_t globalConstantsSize = 0U;
+    uint64_t globalVariablesSize = 0U;
+    ArrayRef<const uint8_t> noGeneratedHeaps;
+    bool valid = reader.read(hasDecodedElf) && reader.read(globalConstantsSize) && reader.read(globalVariablesSize);
+    programInfo.globalConstants.size = static_cast<size_t>(globalConstantsSize);
+    programInfo.globalVariables.size = static_cast<size_t>(globalVariablesSize);
+    valid = valid && readPointer(reader, programInfo.globalConstants.initData, programInfo.globalConstants.size, deviceBinary, noGeneratedHeaps) &&
+            readPointer(reader, programInfo.globalVariables.initData, programInfo.globalVariables.size, deviceBinary, noGeneratedHeaps);
+
+    uint32_t numKernels = 0U;
+    valid = valid && reader.readCount(numKernels, sizeof(uint64_t));
+    programInfo.kernelInfos.reserve(valid ? numKernels : 0U);
+    for (uint32_t i = 0; valid && (i < numKernels); ++i) {
+        auto kernelInfo = std::make_unique<KernelInfo>();
+        valid &= readKernelInfo(reader, *kernelInfo, deviceBinary);
+        programInfo.kernelInfos.push_back(kernelInfo.release());
+    }
+
+    if ((false == valid) || (false == reader.isFullyConsumed())) {
+        return false;
+    }
+
+    if (0U != hasDecodedElf) {
+        std::string errors;
+        std::string warnings;
+        programInfo.decodedElf = Elf::decodeElf<Elf::EI_CLASS_64>(deviceBinary, errors, warnings);
+        if (nullptr == programInfo.decodedElf.elfFileHeader) {
+            return false;
+        }
+    }
+
+    dst = std::move(programInfo);
+    return true;
+}
+
+} // namespace NEO
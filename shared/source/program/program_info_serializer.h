@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/utilities/arrayref.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace NEO {
+struct ProgramInfo;
+
+namespace ProgramInfoSerialization {
+constexpr uint32_t magic = 0x504F454E; // "NEOP"
+constexpr uint32_t version = 1U;
+constexpr const char *cacheEntrySuffix = "_program_info";
+
+struct Header {
+    uint32_t magic = ProgramInfoSerialization::magic;
+    uint32_t version = ProgramInfoSerialization::version;
+    uint64_t layoutSignature = 0U;
+    uint64_t deviceBinarySize = 0U;
+};
+
+uint64_t getLayoutSignature();
+} // namespace ProgramInfoSerialization
+
+// Serializes decoded (but not yet applied/linked) program info into a flat blob.
+// All pointers into deviceBinary are stored as offsets, so the blob is relocatable
+// and can be restored against any copy of the same device binary.
+// Returns false if programInfo holds state that cannot be represented (e.g. linker input,
+// debug data or extended descriptors) - such programs need to be decoded from device binary.
+bool serializeProgramInfo(const ProgramInfo &programInfo, ArrayRef<const uint8_t> deviceBinary, std::vector<uint8_t> &outBlob);
+
+// Restores program info from a blob created by serializeProgramInfo.
+// Returns false (leaving dst empty) on version/layout mismatch or malformed blob.
+bool deserializeProgramInfo(ArrayRef<const uint8_t> blob, ArrayRef<const uint8_t> deviceBinary, ProgramInfo &dst);
+
+} // namespace NEO
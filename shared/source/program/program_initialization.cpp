@@ -10,11 +10,15 @@
 #include "shared/source/compiler_interface/linker.h"
 #include "shared/source/device/device.h"
 #include "shared/source/helpers/blit_commands_helper.h"
+#include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/program/program_info.h"
+#include "shared/source/utilities/parallel_for.h"
+
+#include <algorithm>
 
 namespace NEO {
 
@@ -71,4 +75,26 @@ GraphicsAllocation *allocateGlobalsSurface(NEO::SVMAllocsManager *const svmAlloc
     return gpuAllocation;
 }
 
+uint32_t getKernelAllocationWorkersCount(const Device &device, size_t kernelsCount) {
+    auto &hwInfo = device.getHardwareInfo();
+    if (HwHelper::get(hwInfo.platform.eRenderCoreFamily).getEnableLocalMemory(hwInfo)) {
+        // ISA copies to local memory may be submitted through the copy engine, which is not thread safe
+        return 1u;
+    }
+    return ParallelFor::getWorkersCount(kernelsCount);
+}
+
+uint32_t getProgramUploadWorkersCount(const Device &device, size_t kernelsCount, size_t globalsSize) {
+    auto workersCount = getKernelAllocationWorkersCount(device, kernelsCount);
+    auto &hwInfo = device.getHardwareInfo();
+    if (HwHelper::get(hwInfo.platform.eRenderCoreFamily).getEnableLocalMemory(hwInfo)) {
+        return workersCount;
+    }
+    // large initial globals get a worker of their own, so they are copied while the ISA is uploaded
+    if (globalsSize >= MemoryConstants::pageSize64k) {
+        return std::max(workersCount, 2u);
+    }
+    return workersCount;
+}
+
 } // namespace NEO
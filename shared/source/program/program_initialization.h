@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 
 namespace NEO {
 
@@ -20,4 +21,7 @@ GraphicsAllocation *allocateGlobalsSurface(SVMAllocsManager *const svmAllocManag
                                            size_t size, bool constant,
                                            LinkerInput *const linkerInput, const void *initData);
 
+uint32_t getKernelAllocationWorkersCount(const Device &device, size_t kernelsCount);
+uint32_t getProgramUploadWorkersCount(const Device &device, size_t kernelsCount, size_t globalsSize);
+
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,8 +8,10 @@
 #include "shared/source/program/sync_buffer_handler.h"
 
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/helpers/engine_control.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/os_interface/os_context.h"
 
 #include "opencl/source/kernel/kernel.h"
 
@@ -17,6 +19,9 @@ namespace NEO {
 
 SyncBufferHandler::~SyncBufferHandler() {
     memoryManager.checkGpuUsageAndDestroyGraphicsAllocations(graphicsAllocation);
+    for (auto recycledBuffer : recycledBuffers) {
+        memoryManager.checkGpuUsageAndDestroyGraphicsAllocations(recycledBuffer);
+    }
 };
 SyncBufferHandler::SyncBufferHandler(Device &device)
     : device(device), memoryManager(*device.getMemoryManager()) {
@@ -25,19 +30,32 @@ SyncBufferHandler::SyncBufferHandler(Device &device)
 }
 
 void SyncBufferHandler::prepareForEnqueue(size_t workGroupsCount, Kernel &kernel) {
-    auto requiredSize = workGroupsCount;
+    auto allocationAndOffset = obtainAllocationAndOffset(workGroupsCount);
+    kernel.patchSyncBuffer(device, allocationAndOffset.first, allocationAndOffset.second);
+}
+
+std::pair<GraphicsAllocation *, size_t> SyncBufferHandler::obtainAllocationAndOffset(size_t requiredSize) {
     std::lock_guard<std::mutex> guard(this->mutex);
 
     bool isCurrentBufferFull = (usedBufferSize + requiredSize > bufferSize);
     if (isCurrentBufferFull) {
-        memoryManager.checkGpuUsageAndDestroyGraphicsAllocations(graphicsAllocation);
-        allocateNewBuffer();
+        auto fullBuffer = graphicsAllocation;
+        graphicsAllocation = obtainRecycledBuffer();
+        if (graphicsAllocation == nullptr) {
+            allocateNewBuffer();
+        }
+
+        recycledBuffers.push_back(fullBuffer);
+        if (recycledBuffers.size() > maxRecycledBuffers) {
+            memoryManager.checkGpuUsageAndDestroyGraphicsAllocations(recycledBuffers.front());
+            recycledBuffers.erase(recycledBuffers.begin());
+        }
         usedBufferSize = 0;
     }
 
-    kernel.patchSyncBuffer(device, graphicsAllocation, usedBufferSize);
-
+    auto offset = usedBufferSize;
     usedBufferSize += requiredSize;
+    return {graphicsAllocation, offset};
 }
 
 void SyncBufferHandler::makeResident(CommandStreamReceiver &csr) {
@@ -55,4 +73,36 @@ void SyncBufferHandler::allocateNewBuffer() {
     std::memset(cpuPointer, 0, bufferSize);
 }
 
+GraphicsAllocation *SyncBufferHandler::obtainRecycledBuffer() {
+    for (auto it = recycledBuffers.begin(); it != recycledBuffers.end(); it++) {
+        auto recycledBuffer = *it;
+        if (!isBufferUsedByGpu(*recycledBuffer)) {
+            recycledBuffers.erase(it);
+            // the buffer is host accessible and idle, so zeroing it is cheaper than a new allocation
+            std::memset(recycledBuffer->getUnderlyingBuffer(), 0, bufferSize);
+            return recycledBuffer;
+        }
+    }
+    return nullptr;
+}
+
+bool SyncBufferHandler::isBufferUsedByGpu(GraphicsAllocation &allocation) const {
+    for (auto &engine : memoryManager.getRegisteredEngines()) {
+        auto csr = engine.commandStreamReceiver;
+        if (csr->getRootDeviceIndex() != allocation.getRootDeviceIndex()) {
+            continue;
+        }
+        auto contextId = engine.osContext->getContextId();
+        auto completedTaskCount = *csr->getTagAddress();
+        if (allocation.isUsedByOsContext(contextId) && allocation.getTaskCount(contextId) > completedTaskCount) {
+            return true;
+        }
+        // a batched submission makes the buffer resident before its task count is updated
+        if (allocation.isResident(contextId) && allocation.getResidencyTaskCount(contextId) > completedTaskCount) {
+            return true;
+        }
+    }
+    return false;
+}
+
 } // namespace NEO
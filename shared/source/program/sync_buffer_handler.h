@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,6 +10,8 @@
 #include "shared/source/helpers/constants.h"
 
 #include <mutex>
+#include <utility>
+#include <vector>
 
 namespace NEO {
 
@@ -27,16 +29,22 @@ class SyncBufferHandler {
     SyncBufferHandler(Device &device);
 
     void prepareForEnqueue(size_t workGroupsCount, Kernel &kernel);
+    std::pair<GraphicsAllocation *, size_t> obtainAllocationAndOffset(size_t requiredSize);
     void makeResident(CommandStreamReceiver &csr);
 
   protected:
     void allocateNewBuffer();
+    GraphicsAllocation *obtainRecycledBuffer();
+    bool isBufferUsedByGpu(GraphicsAllocation &allocation) const;
 
     Device &device;
     MemoryManager &memoryManager;
     GraphicsAllocation *graphicsAllocation;
     const size_t bufferSize = 64 * KB;
     size_t usedBufferSize = 0;
+    // full buffers, zeroed and reused once the GPU is done with them
+    std::vector<GraphicsAllocation *> recycledBuffers;
+    static constexpr size_t maxRecycledBuffers = 4u;
     std::mutex mutex;
 };
 
@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/cpu_copy.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/helpers/string.h"
+#include "shared/source/utilities/cpuintrinsics.h"
+#include "shared/source/utilities/parallel_for.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace NEO {
+
+void CpuCopy::copy(void *dst, const void *src, size_t size) {
+    if (size < getLargeCopyThreshold()) {
+        memcpy_s(dst, size, src, size);
+        return;
+    }
+
+    auto chunksCount = (size + chunkSize - 1) / chunkSize;
+    ParallelFor::run(chunksCount, getWorkersCount(size), [&](size_t chunk) {
+        auto offset = chunk * chunkSize;
+        CpuIntrinsics::streamingCopy(ptrOffset(dst, offset), ptrOffset(src, offset), std::min(chunkSize, size - offset));
+    });
+}
+
+size_t CpuCopy::getLargeCopyThreshold() {
+    if (DebugManager.flags.CpuCopyLargeTransferThreshold.get() != -1) {
+        return static_cast<size_t>(DebugManager.flags.CpuCopyLargeTransferThreshold.get());
+    }
+    return minSizeForLargeCopy;
+}
+
+uint32_t CpuCopy::getWorkersCount(size_t size) {
+    if (DebugManager.flags.CpuCopyWorkers.get() != -1) {
+        return static_cast<uint32_t>(std::max(DebugManager.flags.CpuCopyWorkers.get(), 1));
+    }
+    // a few cores are enough to saturate memory bandwidth
+    auto workersCount = std::min(std::max(std::thread::hardware_concurrency(), 1u), maxDefaultWorkersCount);
+    return static_cast<uint32_t>(std::min(static_cast<size_t>(workersCount), (size + chunkSize - 1) / chunkSize));
+}
+} // namespace NEO
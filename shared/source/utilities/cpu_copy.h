@@ -0,0 +1,29 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/constants.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace NEO {
+
+class CpuCopy {
+  public:
+    static constexpr size_t minSizeForLargeCopy = static_cast<size_t>(4 * MemoryConstants::megaByte);
+    static constexpr size_t chunkSize = static_cast<size_t>(MemoryConstants::megaByte);
+    static constexpr uint32_t maxDefaultWorkersCount = 4u;
+
+    // copies below the large copy threshold use memcpy on the calling thread, larger ones are split into chunks
+    // copied by several threads with streaming stores, so that they neither pollute caches nor stay bound to one core
+    static void copy(void *dst, const void *src, size_t size);
+
+    static size_t getLargeCopyThreshold();
+    static uint32_t getWorkersCount(size_t size);
+};
+} // namespace NEO
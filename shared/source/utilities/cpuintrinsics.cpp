@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,7 +7,22 @@
 
 #include "shared/source/utilities/cpuintrinsics.h"
 
+#include <algorithm>
+#include <cstring>
 #include <emmintrin.h>
+#include <immintrin.h>
+
+#if defined(_WIN32)
+#include <intrin.h>
+#define NEO_TARGET_WAITPKG
+#define NEO_TARGET_CLFLUSHOPT
+#define NEO_TARGET_CLWB
+#else
+#include <x86intrin.h>
+#define NEO_TARGET_WAITPKG __attribute__((target("waitpkg")))
+#define NEO_TARGET_CLFLUSHOPT __attribute__((target("clflushopt")))
+#define NEO_TARGET_CLWB __attribute__((target("clwb")))
+#endif
 
 namespace NEO {
 namespace CpuIntrinsics {
@@ -16,9 +31,54 @@ void clFlush(void const *ptr) {
     _mm_clflush(ptr);
 }
 
+NEO_TARGET_CLFLUSHOPT void clFlushOpt(void const *ptr) {
+    _mm_clflushopt(const_cast<void *>(ptr));
+}
+
+NEO_TARGET_CLWB void clWb(void const *ptr) {
+    _mm_clwb(const_cast<void *>(ptr));
+}
+
 void pause() {
     _mm_pause();
 }
 
+void sfence() {
+    _mm_sfence();
+}
+
+uint64_t rdtsc() {
+    return __rdtsc();
+}
+
+NEO_TARGET_WAITPKG void umonitor(volatile void *address) {
+    _umonitor(const_cast<void *>(address));
+}
+
+NEO_TARGET_WAITPKG void umwait(uint32_t control, uint64_t counter) {
+    _umwait(control, counter);
+}
+
+void streamingCopy(void *dst, const void *src, size_t size) {
+    auto dstBytes = static_cast<uint8_t *>(dst);
+    auto srcBytes = static_cast<const uint8_t *>(src);
+
+    auto headSize = std::min(size, (sizeof(__m128i) - (reinterpret_cast<uintptr_t>(dstBytes) & (sizeof(__m128i) - 1))) & (sizeof(__m128i) - 1));
+    memcpy(dstBytes, srcBytes, headSize);
+    dstBytes += headSize;
+    srcBytes += headSize;
+    size -= headSize;
+
+    for (; size >= sizeof(__m128i); size -= sizeof(__m128i)) {
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dstBytes), _mm_loadu_si128(reinterpret_cast<const __m128i *>(srcBytes)));
+        dstBytes += sizeof(__m128i);
+        srcBytes += sizeof(__m128i);
+    }
+    memcpy(dstBytes, srcBytes, size);
+
+    // streaming stores are weakly ordered
+    _mm_sfence();
+}
+
 } // namespace CpuIntrinsics
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,12 +7,32 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+
 namespace NEO {
 namespace CpuIntrinsics {
 
 void clFlush(void const *ptr);
 
+// clFlushOpt / clWb require CpuInfo::featureClflushopt / featureClwb and are weakly ordered, sfence orders them with later stores
+void clFlushOpt(void const *ptr);
+
+void clWb(void const *ptr);
+
 void pause();
 
+void sfence();
+
+uint64_t rdtsc();
+
+// umonitor / umwait require CpuInfo::featureWaitpkg
+void umonitor(volatile void *address);
+
+void umwait(uint32_t control, uint64_t counter);
+
+// copies with non-temporal stores, bypassing the cache for destination lines
+void streamingCopy(void *dst, const void *src, size_t size);
+
 } // namespace CpuIntrinsics
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,6 +23,8 @@ class SettingsReader {
         return createOsReader(false, regKey);
     }
     static SettingsReader *createOsReader(bool userScope, const std::string &regKey);
+    // for readers queried for every debug variable, may snapshot the settings source once
+    static SettingsReader *createOsReaderForDebugVariables(const std::string &regKey);
     static SettingsReader *createFileReader();
     virtual int32_t getSetting(const char *settingName, int32_t defaultValue) = 0;
     virtual int64_t getSetting(const char *settingName, int64_t defaultValue) = 0;
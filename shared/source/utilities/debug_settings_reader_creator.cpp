@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,6 +9,10 @@
 
 namespace NEO {
 std::unique_ptr<SettingsReader> SettingsReaderCreator::create(const std::string &regKey) {
-    return std::unique_ptr<SettingsReader>(SettingsReader::create(regKey));
+    SettingsReader *readerImpl = SettingsReader::createFileReader();
+    if (readerImpl == nullptr) {
+        readerImpl = SettingsReader::createOsReaderForDebugVariables(regKey);
+    }
+    return std::unique_ptr<SettingsReader>(readerImpl);
 }
 }; // namespace NEO
@@ -11,6 +11,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -121,6 +122,30 @@ class HeapAllocator {
         return static_cast<double>(size - availableSize) / size;
     }
 
+    size_t getNumFreedChunks() const {
+        std::lock_guard<std::mutex> lock(mtx);
+        return freedChunksSmall.size() + freedChunksBig.size();
+    }
+
+    uint64_t getLargestFreeBlockSize() const {
+        std::lock_guard<std::mutex> lock(mtx);
+        uint64_t largestFreeBlock = pRightBound - pLeftBound;
+        for (auto freedChunks : {&freedChunksSmall, &freedChunksBig}) {
+            for (auto &freedChunk : *freedChunks) {
+                largestFreeBlock = std::max(largestFreeBlock, static_cast<uint64_t>(freedChunk.size));
+            }
+        }
+        return largestFreeBlock;
+    }
+
+    double getFragmentation() const {
+        auto freeSize = getLeftSize();
+        if (freeSize == 0u) {
+            return 0.0;
+        }
+        return 1.0 - static_cast<double>(getLargestFreeBlockSize()) / freeSize;
+    }
+
   protected:
     const uint64_t size;
     uint64_t availableSize;
@@ -131,7 +156,7 @@ class HeapAllocator {
 
     std::vector<HeapChunk> freedChunksSmall;
     std::vector<HeapChunk> freedChunksBig;
-    std::mutex mtx;
+    mutable std::mutex mtx;
 
     uint64_t getFromFreedChunks(size_t size, std::vector<HeapChunk> &freedChunks, size_t &sizeOfFreedChunk) {
         size_t elements = freedChunks.size();
@@ -174,16 +199,28 @@ class HeapAllocator {
     }
 
     void storeInFreedChunks(uint64_t ptr, size_t size, std::vector<HeapChunk> &freedChunks) {
-        for (auto &freedChunk : freedChunks) {
-            if (freedChunk.ptr == ptr + size) {
-                freedChunk.ptr = ptr;
-                freedChunk.size += size;
-                return;
+        auto leftNeighbour = freedChunks.end();
+        auto rightNeighbour = freedChunks.end();
+        for (auto freedChunk = freedChunks.begin(); freedChunk != freedChunks.end(); ++freedChunk) {
+            if (freedChunk->ptr + freedChunk->size == ptr) {
+                leftNeighbour = freedChunk;
+            } else if (freedChunk->ptr == ptr + size) {
+                rightNeighbour = freedChunk;
             }
-            if (freedChunk.ptr + freedChunk.size == ptr) {
-                freedChunk.size += size;
-                return;
+        }
+
+        if (leftNeighbour != freedChunks.end()) {
+            leftNeighbour->size += size;
+            if (rightNeighbour != freedChunks.end()) {
+                leftNeighbour->size += rightNeighbour->size;
+                freedChunks.erase(rightNeighbour);
             }
+            return;
+        }
+        if (rightNeighbour != freedChunks.end()) {
+            rightNeighbour->ptr = ptr;
+            rightNeighbour->size += size;
+            return;
         }
 
         freedChunks.emplace_back(ptr, size);
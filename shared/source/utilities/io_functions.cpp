@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,11 +7,24 @@
 
 #include "shared/source/utilities/io_functions.h"
 
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
 namespace NEO {
 namespace IoFunctions {
+static char **getEnvironment() {
+#ifdef _WIN32
+    return _environ;
+#else
+    return environ;
+#endif
+}
+
 fopenFuncPtr fopenPtr = &fopen;
 vfprintfFuncPtr vfprintfPtr = &vfprintf;
 fcloseFuncPtr fclosePtr = &fclose;
 getenvFuncPtr getenvPtr = &getenv;
+getEnvironmentFuncPtr getEnvironmentPtr = &getEnvironment;
 } // namespace IoFunctions
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -16,11 +16,14 @@ using fopenFuncPtr = FILE *(*)(const char *, const char *);
 using vfprintfFuncPtr = int (*)(FILE *, char const *const formatStr, va_list arg);
 using fcloseFuncPtr = int (*)(FILE *);
 using getenvFuncPtr = decltype(&getenv);
+using getEnvironmentFuncPtr = char **(*)();
 
 extern fopenFuncPtr fopenPtr;
 extern vfprintfFuncPtr vfprintfPtr;
 extern fcloseFuncPtr fclosePtr;
 extern getenvFuncPtr getenvPtr;
+// returns the process environment block, nullptr when it can't be enumerated
+extern getEnvironmentFuncPtr getEnvironmentPtr;
 
 inline int fprintf(FILE *fileDesc, char const *const formatStr, ...) {
     va_list args;
@@ -0,0 +1,177 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/launch_overhead_profiler.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+namespace NEO {
+
+namespace {
+thread_local ScopedLaunchPhase *currentPhase = nullptr;
+
+uint64_t elapsedNs(std::chrono::steady_clock::time_point start) {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+}
+} // namespace
+
+thread_local LaunchOverheadProfiler::ThreadLaunch LaunchOverheadProfiler::threadLaunch;
+
+LaunchOverheadProfiler *LaunchOverheadProfiler::get() {
+    static std::unique_ptr<LaunchOverheadProfiler> profiler = []() -> std::unique_ptr<LaunchOverheadProfiler> {
+        auto reportedKernels = DebugManager.flags.PrintKernelLaunchOverhead.get();
+        if (reportedKernels <= 0) {
+            return nullptr;
+        }
+        return std::make_unique<LaunchOverheadProfiler>(static_cast<size_t>(reportedKernels), std::cout);
+    }();
+    return profiler.get();
+}
+
+LaunchOverheadProfiler::LaunchOverheadProfiler(size_t reportedKernelsCount, std::ostream &out)
+    : reportedKernelsCount(reportedKernelsCount), out(out) {
+}
+
+LaunchOverheadProfiler::~LaunchOverheadProfiler() {
+    printReport();
+}
+
+void LaunchOverheadProfiler::beginLaunch(const char *kernelName) {
+    if (threadLaunch.depth++ > 0) {
+        return;
+    }
+    threadLaunch.kernelName = kernelName;
+    threadLaunch.phaseNs.fill(0u);
+    threadLaunch.start = std::chrono::steady_clock::now();
+}
+
+void LaunchOverheadProfiler::endLaunch() {
+    if (threadLaunch.depth == 0 || --threadLaunch.depth > 0) {
+        return;
+    }
+    auto totalNs = elapsedNs(threadLaunch.start);
+
+    std::lock_guard<std::mutex> lock(statsMutex);
+    auto &stats = kernelStats[threadLaunch.kernelName];
+    stats.launches++;
+    stats.totalNs += totalNs;
+    for (size_t phase = 0; phase < stats.phaseNs.size(); phase++) {
+        stats.phaseNs[phase] += threadLaunch.phaseNs[phase];
+    }
+}
+
+bool LaunchOverheadProfiler::isLaunchActive() const {
+    return threadLaunch.depth > 0;
+}
+
+void LaunchOverheadProfiler::addPhaseTime(Phase phase, uint64_t ns) {
+    threadLaunch.phaseNs[static_cast<size_t>(phase)] += ns;
+}
+
+void LaunchOverheadProfiler::addSubmissionTime(const std::vector<std::string> &kernelNames, uint64_t ns) {
+    if (kernelNames.empty()) {
+        return;
+    }
+    auto nsPerKernel = ns / kernelNames.size();
+
+    std::lock_guard<std::mutex> lock(statsMutex);
+    for (auto &kernelName : kernelNames) {
+        auto &stats = kernelStats[kernelName];
+        stats.totalNs += nsPerKernel;
+        stats.phaseNs[static_cast<size_t>(Phase::flush)] += nsPerKernel;
+    }
+}
+
+void LaunchOverheadProfiler::printReport() {
+    std::vector<std::pair<std::string, KernelStats>> sortedStats;
+    {
+        std::lock_guard<std::mutex> lock(statsMutex);
+        sortedStats.assign(kernelStats.begin(), kernelStats.end());
+    }
+    std::sort(sortedStats.begin(), sortedStats.end(), [](const auto &a, const auto &b) { return a.second.totalNs > b.second.totalNs; });
+    sortedStats.resize(std::min(sortedStats.size(), reportedKernelsCount));
+
+    out << "Kernel launch host overhead, average per launch in us:\n"
+        << std::left << std::setw(40) << "kernel" << std::right << std::setw(10) << "launches" << std::setw(12) << "total";
+    for (size_t phase = 0; phase < static_cast<size_t>(Phase::count); phase++) {
+        out << std::setw(18) << getPhaseName(static_cast<Phase>(phase));
+    }
+    out << "\n";
+    for (auto &entry : sortedStats) {
+        auto &stats = entry.second;
+        auto toAverageUs = [&stats](uint64_t ns) { return static_cast<double>(ns) / 1000.0 / static_cast<double>(stats.launches); };
+        out << std::left << std::setw(40) << entry.first << std::right << std::setw(10) << stats.launches
+            << std::fixed << std::setprecision(2) << std::setw(12) << toAverageUs(stats.totalNs);
+        for (auto phaseNs : stats.phaseNs) {
+            out << std::setw(18) << toAverageUs(phaseNs);
+        }
+        out << "\n";
+    }
+    out.flush();
+}
+
+const char *LaunchOverheadProfiler::getPhaseName(Phase phase) {
+    switch (phase) {
+    case Phase::argumentPatching:
+        return "argumentPatching";
+    case Phase::encoding:
+        return "encoding";
+    case Phase::residency:
+        return "residency";
+    case Phase::flush:
+        return "flush";
+    default:
+        return "execIoctl";
+    }
+}
+
+ScopedLaunchSubmission::ScopedLaunchSubmission() : profiler(LaunchOverheadProfiler::get()) {
+    if (profiler) {
+        start = std::chrono::steady_clock::now();
+    }
+}
+
+ScopedLaunchSubmission::~ScopedLaunchSubmission() {
+    if (profiler) {
+        profiler->addSubmissionTime(kernelNames, elapsedNs(start));
+    }
+}
+
+void ScopedLaunchSubmission::addKernels(const std::vector<std::string> &names) {
+    if (profiler) {
+        kernelNames.insert(kernelNames.end(), names.begin(), names.end());
+    }
+}
+
+ScopedLaunchPhase::ScopedLaunchPhase(LaunchOverheadProfiler::Phase phase) : profiler(LaunchOverheadProfiler::get()), phase(phase) {
+    if (profiler && profiler->isLaunchActive()) {
+        parent = currentPhase;
+        currentPhase = this;
+        start = std::chrono::steady_clock::now();
+    } else {
+        profiler = nullptr;
+    }
+}
+
+ScopedLaunchPhase::~ScopedLaunchPhase() {
+    if (profiler) {
+        auto ns = elapsedNs(start);
+        profiler->addPhaseTime(phase, ns - std::min(ns, nestedNs));
+        if (parent) {
+            parent->nestedNs += ns;
+        }
+        currentPhase = parent;
+    }
+}
+
+} // namespace NEO
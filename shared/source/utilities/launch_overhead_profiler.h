@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace NEO {
+
+// Attributes host time of kernel launches to phases and aggregates it per kernel name.
+// A launch is the outermost ScopedKernelLaunch on a thread; phases record exclusive time,
+// so a nested phase (e.g. exec ioctl inside flush) is not counted twice.
+class LaunchOverheadProfiler {
+  public:
+    enum class Phase : uint8_t {
+        argumentPatching,
+        encoding,
+        residency,
+        flush,
+        execIoctl,
+        count
+    };
+
+    struct KernelStats {
+        uint64_t launches = 0u;
+        uint64_t totalNs = 0u;
+        std::array<uint64_t, static_cast<size_t>(Phase::count)> phaseNs = {};
+    };
+
+    static LaunchOverheadProfiler *get();
+
+    LaunchOverheadProfiler(size_t reportedKernelsCount, std::ostream &out);
+    ~LaunchOverheadProfiler();
+
+    void beginLaunch(const char *kernelName);
+    void endLaunch();
+    bool isLaunchActive() const;
+    void addPhaseTime(Phase phase, uint64_t ns);
+    // flush time of a later submission, split evenly over the kernels it executes
+    void addSubmissionTime(const std::vector<std::string> &kernelNames, uint64_t ns);
+    void printReport();
+
+    static const char *getPhaseName(Phase phase);
+
+  protected:
+    struct ThreadLaunch {
+        uint32_t depth = 0u;
+        std::string kernelName;
+        std::chrono::steady_clock::time_point start;
+        std::array<uint64_t, static_cast<size_t>(Phase::count)> phaseNs = {};
+    };
+    static thread_local ThreadLaunch threadLaunch;
+
+    const size_t reportedKernelsCount;
+    std::ostream &out;
+    std::mutex statsMutex;
+    std::unordered_map<std::string, KernelStats> kernelStats;
+};
+
+struct ScopedKernelLaunch {
+    // launches without a kernel name (e.g. markers) are not profiled
+    ScopedKernelLaunch(const char *kernelName) : profiler(kernelName ? LaunchOverheadProfiler::get() : nullptr) {
+        if (profiler) {
+            profiler->beginLaunch(kernelName);
+        }
+    }
+
+    ~ScopedKernelLaunch() {
+        if (profiler) {
+            profiler->endLaunch();
+        }
+    }
+
+    LaunchOverheadProfiler *profiler;
+};
+
+struct ScopedLaunchSubmission {
+    ScopedLaunchSubmission();
+    ~ScopedLaunchSubmission();
+
+    void addKernels(const std::vector<std::string> &names);
+
+    LaunchOverheadProfiler *profiler;
+    std::vector<std::string> kernelNames;
+    std::chrono::steady_clock::time_point start;
+};
+
+struct ScopedLaunchPhase {
+    ScopedLaunchPhase(LaunchOverheadProfiler::Phase phase);
+    ~ScopedLaunchPhase();
+
+    LaunchOverheadProfiler *profiler;
+    LaunchOverheadProfiler::Phase phase;
+    ScopedLaunchPhase *parent = nullptr;
+    uint64_t nestedNs = 0u;
+    std::chrono::steady_clock::time_point start;
+};
+
+} // namespace NEO
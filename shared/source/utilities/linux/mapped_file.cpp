@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/mapped_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace NEO {
+
+std::unique_ptr<MappedFile> MappedFile::create(const std::string &filePath) {
+    int fileDescriptor = open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fileDescriptor < 0) {
+        return nullptr;
+    }
+
+    struct stat fileStat = {};
+    if (0 != fstat(fileDescriptor, &fileStat) || fileStat.st_size <= 0) {
+        close(fileDescriptor);
+        return nullptr;
+    }
+
+    auto fileSize = static_cast<size_t>(fileStat.st_size);
+    void *mappedData = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE | MAP_POPULATE, fileDescriptor, 0);
+    close(fileDescriptor);
+    if (mappedData == MAP_FAILED) {
+        return nullptr;
+    }
+
+    std::unique_ptr<MappedFile> mappedFile(new MappedFile);
+    mappedFile->data = static_cast<const uint8_t *>(mappedData);
+    mappedFile->size = fileSize;
+    return mappedFile;
+}
+
+MappedFile::~MappedFile() {
+    if (data != nullptr) {
+        munmap(const_cast<uint8_t *>(data), size);
+    }
+}
+} // namespace NEO
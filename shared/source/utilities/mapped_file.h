@@ -0,0 +1,36 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/utilities/arrayref.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace NEO {
+
+class MappedFile : NonCopyableOrMovableClass {
+  public:
+    static std::unique_ptr<MappedFile> create(const std::string &filePath);
+    ~MappedFile();
+
+    ArrayRef<const uint8_t> getData() const {
+        return ArrayRef<const uint8_t>(data, size);
+    }
+
+  protected:
+    MappedFile() = default;
+
+    static constexpr intptr_t invalidHandle = -1;
+    intptr_t osFileHandle = invalidHandle;
+    intptr_t osMappingHandle = invalidHandle;
+    const uint8_t *data = nullptr;
+    size_t size = 0u;
+};
+} // namespace NEO
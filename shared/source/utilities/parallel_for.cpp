@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/parallel_for.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/os_interface/os_thread.h"
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace NEO {
+
+uint32_t ParallelFor::getWorkersCount(size_t itemsCount) {
+    uint32_t workersCount = 1u;
+    if (DebugManager.flags.ParallelKernelProcessingWorkers.get() != -1) {
+        workersCount = static_cast<uint32_t>(std::max(DebugManager.flags.ParallelKernelProcessingWorkers.get(), 1));
+    } else if (itemsCount >= minItemsCountForParallelExecution) {
+        workersCount = std::min(std::max(std::thread::hardware_concurrency(), 1u), maxDefaultWorkersCount);
+    }
+    return workersCount;
+}
+
+void ParallelFor::run(size_t itemsCount, uint32_t workersCount, const std::function<void(size_t)> &func) {
+    WorkContext context;
+    context.itemsCount = itemsCount;
+    context.func = &func;
+
+    std::vector<std::unique_ptr<Thread>> workers;
+    for (uint32_t i = 1u; i < std::min(static_cast<size_t>(workersCount), itemsCount); i++) {
+        workers.push_back(Thread::create(worker, reinterpret_cast<void *>(&context)));
+    }
+
+    processItems(context);
+
+    for (auto &thread : workers) {
+        thread->join();
+    }
+}
+
+void *ParallelFor::worker(void *arg) {
+    processItems(*reinterpret_cast<WorkContext *>(arg));
+    return nullptr;
+}
+
+void ParallelFor::processItems(WorkContext &context) {
+    for (auto item = context.nextItem++; item < context.itemsCount; item = context.nextItem++) {
+        (*context.func)(item);
+    }
+}
+} // namespace NEO
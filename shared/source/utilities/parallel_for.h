@@ -0,0 +1,34 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace NEO {
+
+class ParallelFor {
+  public:
+    static constexpr size_t minItemsCountForParallelExecution = 32u;
+    static constexpr uint32_t maxDefaultWorkersCount = 8u;
+
+    static uint32_t getWorkersCount(size_t itemsCount);
+    static void run(size_t itemsCount, uint32_t workersCount, const std::function<void(size_t)> &func);
+
+  protected:
+    struct WorkContext {
+        std::atomic<size_t> nextItem{0u};
+        size_t itemsCount = 0u;
+        const std::function<void(size_t)> *func = nullptr;
+    };
+
+    static void *worker(void *arg);
+    static void processItems(WorkContext &context);
+};
+} // namespace NEO
@@ -128,6 +128,31 @@ void PipeControlReasonTag::bxml(std::ostream &os) {
     os << "</Instruction>\n";
 }
 
+void UserRangeBeginTag::bxml(std::ostream &os) {
+    os << "<Instruction Name=\"UserRangeBegin\" Source=\"Driver\" Project=\"All\" LengthBias=\"2\">\n";
+    os << "  <Description>Start of a range marked by the application.</Description>\n";
+
+    BaseTag::bxml(os, OpCode::UserRangeBegin, sizeof(UserRangeBeginTag), "USER_RANGE_BEGIN");
+
+    unsigned int stringDWORDSize = RANGE_NAME_STR_LENGTH / sizeof(uint32_t);
+    os << "  <Dword Name=\"2.." << 2 + stringDWORDSize << "\">\n";
+    os << "    <BitField Name=\"RangeName\" HighBit=\"" << 32 * stringDWORDSize - 1 << "\" LowBit=\"0\" Format=\"string\">\n";
+    os << "      <Description>Name of the range.</Description>\n";
+    os << "    </BitField>\n";
+    os << "  </Dword>\n";
+
+    os << "</Instruction>\n";
+}
+
+void UserRangeEndTag::bxml(std::ostream &os) {
+    os << "<Instruction Name=\"UserRangeEnd\" Source=\"Driver\" Project=\"All\" LengthBias=\"2\">\n";
+    os << "  <Description>End of the innermost range marked by the application.</Description>\n";
+
+    BaseTag::bxml(os, OpCode::UserRangeEnd, sizeof(UserRangeEndTag), "USER_RANGE_END");
+
+    os << "</Instruction>\n";
+}
+
 SWTagBXML::SWTagBXML() {
     std::ostringstream ss;
 
@@ -139,6 +164,8 @@ SWTagBXML::SWTagBXML() {
 
     KernelNameTag::bxml(ss);
     PipeControlReasonTag::bxml(ss);
+    UserRangeBeginTag::bxml(ss);
+    UserRangeEndTag::bxml(ss);
 
     ss << "</BSpec>";
 
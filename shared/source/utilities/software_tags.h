@@ -17,7 +17,9 @@ namespace SWTags {
 enum class OpCode : uint32_t {
     Unknown,
     KernelName,
-    PipeControlReason
+    PipeControlReason,
+    UserRangeBegin,
+    UserRangeEnd
 };
 
 enum class Component : uint32_t {
@@ -110,6 +112,28 @@ struct PipeControlReasonTag : public BaseTag {
     char reasonString[REASON_STR_LENGTH] = {};
 };
 
+struct UserRangeBeginTag : public BaseTag {
+  public:
+    UserRangeBeginTag(const char *name)
+        : BaseTag(OpCode::UserRangeBegin, sizeof(UserRangeBeginTag)) {
+        strncpy_s(rangeName, RANGE_NAME_STR_LENGTH, name, RANGE_NAME_STR_LENGTH - 1);
+    }
+
+    static void bxml(std::ostream &os);
+
+  private:
+    static constexpr unsigned int RANGE_NAME_STR_LENGTH = sizeof(uint32_t) * 16; // Dword aligned
+    char rangeName[RANGE_NAME_STR_LENGTH] = {};
+};
+
+struct UserRangeEndTag : public BaseTag {
+  public:
+    UserRangeEndTag()
+        : BaseTag(OpCode::UserRangeEnd, sizeof(UserRangeEndTag)) {}
+
+    static void bxml(std::ostream &os);
+};
+
 struct SWTagBXML {
     SWTagBXML();
 
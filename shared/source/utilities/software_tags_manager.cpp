@@ -7,6 +7,10 @@
 
 #include "shared/source/utilities/software_tags_manager.h"
 
+#include "shared/source/helpers/aligned_memory.h"
+
+#include <algorithm>
+
 namespace NEO {
 
 void SWTagsManager::initialize(Device &device) {
@@ -41,16 +45,44 @@ void SWTagsManager::allocateBXMLHeap(Device &device) {
 }
 
 void SWTagsManager::allocateSWTagHeap(Device &device) {
+    if (DebugManager.flags.SWTagsHeapSize.get() != -1) {
+        auto requestedHeapSize = std::max(DebugManager.flags.SWTagsHeapSize.get(), static_cast<int32_t>(MIN_TAG_HEAP_SIZE));
+        // heap info describes the size in dwords
+        tagHeapSize = alignDown(std::min(static_cast<unsigned int>(requestedHeapSize), MAX_TAG_HEAP_SIZE), sizeof(uint32_t));
+    }
+
     const AllocationProperties properties{
         device.getRootDeviceIndex(),
-        MAX_TAG_HEAP_SIZE,
+        tagHeapSize,
         GraphicsAllocation::AllocationType::LINEAR_STREAM,
         device.getDeviceBitfield()};
     tagHeap = memoryManager->allocateGraphicsMemoryWithProperties(properties);
 
-    SWTags::SWTagHeapInfo tagHeapInfo(MAX_TAG_HEAP_SIZE / sizeof(uint32_t));
+    SWTags::SWTagHeapInfo tagHeapInfo(tagHeapSize / sizeof(uint32_t));
     MemoryTransferHelper::transferMemoryToAllocation(false, device, tagHeap, 0, &tagHeapInfo, sizeof(tagHeapInfo));
-    currentHeapOffset += sizeof(tagHeapInfo);
+    currentHeapOffset = sizeof(tagHeapInfo);
+}
+
+unsigned int SWTagsManager::reserveTagOffset(Device &device, const void *tag, unsigned int tagSize) {
+    std::string tagContents(reinterpret_cast<const char *>(tag), tagSize);
+
+    std::lock_guard<std::mutex> lock(tagHeapMutex);
+    auto cachedOffset = tagOffsets.find(tagContents);
+    if (cachedOffset != tagOffsets.end()) {
+        return cachedOffset->second;
+    }
+
+    // the heap is a ring, the oldest tags are overwritten once it is full
+    if (currentHeapOffset + tagSize > tagHeapSize) {
+        currentHeapOffset = sizeof(SWTags::SWTagHeapInfo);
+        tagOffsets.clear();
+    }
+
+    auto tagOffset = currentHeapOffset;
+    MemoryTransferHelper::transferMemoryToAllocation(false, device, tagHeap, tagOffset, tag, tagSize);
+    currentHeapOffset += tagSize;
+    tagOffsets.emplace(std::move(tagContents), tagOffset);
+    return tagOffset;
 }
 
 } // namespace NEO
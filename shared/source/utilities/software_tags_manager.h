@@ -10,6 +10,10 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/utilities/software_tags.h"
 
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
 namespace NEO {
 
 class Device;
@@ -26,6 +30,7 @@ class SWTagsManager {
 
     GraphicsAllocation *getBXMLHeapAllocation() { return bxmlHeap; }
     GraphicsAllocation *getSWTagHeapAllocation() { return tagHeap; }
+    uint32_t getSWTagHeapSize() const { return tagHeapSize; }
 
     template <typename GfxFamily>
     void insertBXMLHeapAddress(LinearStream &cmdStream);
@@ -35,21 +40,27 @@ class SWTagsManager {
     void insertTag(LinearStream &cmdStream, Device &device, Params... params);
 
     template <typename GfxFamily>
-    static size_t estimateSpaceForSWTags();
+    static size_t estimateSpaceForSWTags(size_t tagCount);
 
-    static const unsigned int MAX_TAG_COUNT = 20;
-    static const unsigned int MAX_TAG_HEAP_SIZE = 1024;
+    static const unsigned int DEFAULT_TAG_HEAP_SIZE = 64 * 1024;
+    static const unsigned int MIN_TAG_HEAP_SIZE = 1024;
+    static const unsigned int MAX_TAG_HEAP_SIZE = 1024 * 1024;
 
   private:
     void allocateBXMLHeap(Device &device);
     void allocateSWTagHeap(Device &device);
+    unsigned int reserveTagOffset(Device &device, const void *tag, unsigned int tagSize);
 
     MemoryManager *memoryManager;
     GraphicsAllocation *tagHeap = nullptr;
     GraphicsAllocation *bxmlHeap = nullptr;
+    unsigned int tagHeapSize = DEFAULT_TAG_HEAP_SIZE;
     unsigned int currentHeapOffset = 0;
-    unsigned int currentTagCount = 0;
     bool initialized = false;
+
+    // contents of tags already in the heap, so repeated tags only cost the two MI_NOOPs
+    std::mutex tagHeapMutex;
+    std::unordered_map<std::string, unsigned int> tagOffsets;
 };
 
 template <typename GfxFamily>
@@ -88,22 +99,19 @@ void SWTagsManager::insertTag(LinearStream &cmdStream, Device &device, Params...
 
     unsigned int tagSize = sizeof(Tag);
 
-    if (currentTagCount >= MAX_TAG_COUNT || currentHeapOffset + tagSize > MAX_TAG_HEAP_SIZE) {
+    if (sizeof(SWTags::SWTagHeapInfo) + tagSize > tagHeapSize) {
         return;
     }
-    ++currentTagCount;
 
     Tag tag(std::forward<Params>(params)...);
-
-    MemoryTransferHelper::transferMemoryToAllocation(false, device, tagHeap, currentHeapOffset, &tag, tagSize);
+    auto tagOffset = reserveTagOffset(device, &tag, tagSize);
 
     MI_NOOP marker = GfxFamily::cmdInitNoop;
     marker.setIdentificationNumber(tag.getMarkerNoopID(tag.getOpCode()));
     marker.setIdentificationNumberRegisterWriteEnable(true);
 
     MI_NOOP offset = GfxFamily::cmdInitNoop;
-    offset.setIdentificationNumber(tag.getOffsetNoopID(currentHeapOffset));
-    currentHeapOffset += tagSize;
+    offset.setIdentificationNumber(tag.getOffsetNoopID(tagOffset));
 
     MI_NOOP *pNoop = cmdStream.getSpaceForCmd<MI_NOOP>();
     *pNoop = marker;
@@ -112,11 +120,11 @@ void SWTagsManager::insertTag(LinearStream &cmdStream, Device &device, Params...
 }
 
 template <typename GfxFamily>
-size_t SWTagsManager::estimateSpaceForSWTags() {
+size_t SWTagsManager::estimateSpaceForSWTags(size_t tagCount) {
     using MI_STORE_DATA_IMM = typename GfxFamily::MI_STORE_DATA_IMM;
     using MI_NOOP = typename GfxFamily::MI_NOOP;
 
-    return 2 * sizeof(MI_STORE_DATA_IMM) + 2 * MAX_TAG_COUNT * sizeof(MI_NOOP);
+    return 2 * sizeof(MI_STORE_DATA_IMM) + 2 * tagCount * sizeof(MI_NOOP);
 }
 
 } // namespace NEO
@@ -140,6 +140,7 @@ class StackVec {
 
         if (usesDynamicMem()) {
             this->dynamicMem->assign(rhs.begin(), rhs.end());
+            rhs.clear();
             return *this;
         }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -104,14 +104,20 @@ class TagAllocator {
     }
 
     NodeType *getTag() {
-        if (freeTags.peekIsEmpty()) {
-            releaseDeferredTags();
-        }
+        // fast path takes the free list lock once, deferred tags are only scanned when it runs dry
         NodeType *node = freeTags.removeFrontOne().release();
         if (!node) {
+            releaseDeferredTags();
+            node = freeTags.removeFrontOne().release();
+        }
+        while (!node) {
             std::unique_lock<std::mutex> lock(allocatorMutex);
-            populateFreeTags();
+            // another thread may have populated the pool while this one was waiting for the lock
             node = freeTags.removeFrontOne().release();
+            if (!node) {
+                populateFreeTags();
+                node = freeTags.removeFrontOne().release();
+            }
         }
         usedTags.pushFrontOne(*node);
         node->incRefCount();
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/tiled_memcpy.h"
+
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/ptr_math.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace NEO {
+
+namespace {
+// TileY: 16B wide, 32 row high columns, placed left to right
+size_t getOffsetInTileY(size_t x, size_t y) {
+    return (x / TiledMemcpy::chunkWidthInBytes) * (TiledMemcpy::chunkWidthInBytes * TiledMemcpy::tileHeight) +
+           y * TiledMemcpy::chunkWidthInBytes + (x % TiledMemcpy::chunkWidthInBytes);
+}
+
+// Tile4: 16B x 4 row blocks, interleaved in Z order inside the 4KB tile
+size_t getOffsetInTile4(size_t x, size_t y) {
+    return (x & 0xf) |
+           ((y & 0x3) << 4) |
+           (((x >> 4) & 0x1) << 6) |
+           (((y >> 2) & 0x1) << 7) |
+           (((x >> 5) & 0x1) << 8) |
+           (((y >> 3) & 0x1) << 9) |
+           (((x >> 6) & 0x1) << 10) |
+           (((y >> 4) & 0x1) << 11);
+}
+
+template <bool toTiled>
+void copyTiled(TileLayout layout, void *tiled, size_t tiledPitch, size_t xInBytes, size_t y,
+               void *linear, size_t linearRowPitch, size_t widthInBytes, size_t height) {
+    for (size_t row = 0; row < height; row++) {
+        auto linearRow = ptrOffset(linear, row * linearRowPitch);
+        size_t column = 0;
+        while (column < widthInBytes) {
+            auto x = xInBytes + column;
+            auto copySize = std::min(TiledMemcpy::chunkWidthInBytes - (x % TiledMemcpy::chunkWidthInBytes), widthInBytes - column);
+            auto tiledPtr = ptrOffset(tiled, TiledMemcpy::getTiledOffset(layout, x, y + row, tiledPitch));
+            auto linearPtr = ptrOffset(linearRow, column);
+            if (copySize == TiledMemcpy::chunkWidthInBytes) {
+                // fixed size copies compile to a single vector load and store
+                if (toTiled) {
+                    memcpy(tiledPtr, linearPtr, TiledMemcpy::chunkWidthInBytes);
+                } else {
+                    memcpy(linearPtr, tiledPtr, TiledMemcpy::chunkWidthInBytes);
+                }
+            } else {
+                if (toTiled) {
+                    memcpy(tiledPtr, linearPtr, copySize);
+                } else {
+                    memcpy(linearPtr, tiledPtr, copySize);
+                }
+            }
+            column += copySize;
+        }
+    }
+}
+} // namespace
+
+size_t TiledMemcpy::getTiledOffset(TileLayout layout, size_t xInBytes, size_t y, size_t tiledPitch) {
+    DEBUG_BREAK_IF(tiledPitch % tileWidthInBytes != 0);
+    if (layout == TileLayout::Linear) {
+        return y * tiledPitch + xInBytes;
+    }
+    auto tileOffset = ((y / tileHeight) * (tiledPitch / tileWidthInBytes) + (xInBytes / tileWidthInBytes)) * tileSize;
+    auto x = xInBytes % tileWidthInBytes;
+    auto yInTile = y % tileHeight;
+    return tileOffset + (layout == TileLayout::TileY ? getOffsetInTileY(x, yInTile) : getOffsetInTile4(x, yInTile));
+}
+
+void TiledMemcpy::copyFromTiled(TileLayout layout, void *dst, size_t dstRowPitch,
+                                const void *tiledSrc, size_t tiledPitch, size_t xInBytes, size_t y,
+                                size_t widthInBytes, size_t height) {
+    copyTiled<false>(layout, const_cast<void *>(tiledSrc), tiledPitch, xInBytes, y, dst, dstRowPitch, widthInBytes, height);
+}
+
+void TiledMemcpy::copyToTiled(TileLayout layout, void *tiledDst, size_t tiledPitch, size_t xInBytes, size_t y,
+                              const void *src, size_t srcRowPitch,
+                              size_t widthInBytes, size_t height) {
+    copyTiled<true>(layout, tiledDst, tiledPitch, xInBytes, y, const_cast<void *>(src), srcRowPitch, widthInBytes, height);
+}
+} // namespace NEO
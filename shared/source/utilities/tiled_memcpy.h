@@ -0,0 +1,39 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace NEO {
+
+enum class TileLayout : uint32_t {
+    Linear,
+    TileY,
+    Tile4
+};
+
+// Copies between linear memory and the raw 4KB tiles of a Y-tiled or Tile4 surface,
+// so tiled allocations locked by the CPU can be accessed without a GPU staging copy.
+// Both layouts keep 16 byte wide, row contiguous chunks, which are copied as a whole.
+class TiledMemcpy {
+  public:
+    static constexpr size_t tileWidthInBytes = 128u;
+    static constexpr size_t tileHeight = 32u;
+    static constexpr size_t tileSize = tileWidthInBytes * tileHeight;
+    static constexpr size_t chunkWidthInBytes = 16u;
+
+    static size_t getTiledOffset(TileLayout layout, size_t xInBytes, size_t y, size_t tiledPitch);
+
+    static void copyFromTiled(TileLayout layout, void *dst, size_t dstRowPitch,
+                              const void *tiledSrc, size_t tiledPitch, size_t xInBytes, size_t y,
+                              size_t widthInBytes, size_t height);
+    static void copyToTiled(TileLayout layout, void *tiledDst, size_t tiledPitch, size_t xInBytes, size_t y,
+                            const void *src, size_t srcRowPitch,
+                            size_t widthInBytes, size_t height);
+};
+} // namespace NEO
@@ -0,0 +1,202 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/trace_events.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+
+#include <fstream>
+#include <iomanip>
+
+namespace NEO {
+
+namespace {
+// Chrome trace timestamps are in microseconds
+void writeMicroseconds(std::ostream &out, uint64_t ns) {
+    out << ns / 1000 << "." << std::setw(3) << std::setfill('0') << ns % 1000;
+}
+
+// destroyed explicitly at library teardown, after the platforms and drivers that record events
+std::once_flag traceEventsCreated;
+TraceEvents *traceEventsImpl = nullptr;
+} // namespace
+
+std::atomic<uint64_t> TraceEvents::tracerIdCounter{1u};
+thread_local TraceEvents::ThreadBufferCache TraceEvents::threadBufferCache = {0u, nullptr};
+
+TraceEvents *TraceEvents::get() {
+    std::call_once(traceEventsCreated, []() {
+        auto fileName = DebugManager.flags.TraceEventsFile.get();
+        if (fileName != "unk") {
+            traceEventsImpl = new TraceEvents(std::make_unique<std::ofstream>(fileName));
+        }
+    });
+    return traceEventsImpl;
+}
+
+void TraceEvents::destroy() {
+    delete traceEventsImpl;
+    traceEventsImpl = nullptr;
+}
+
+TraceEvents::TraceEvents(std::unique_ptr<std::ostream> out)
+    : tracerId(tracerIdCounter++), osTime(OSTime::create(nullptr)), out(std::move(out)) {
+    gpuBuffer.threadId = gpuThreadId;
+    *this->out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n"
+               << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << gpuThreadId << ",\"args\":{\"name\":\"GPU\"}}";
+    writerThread = Thread::create(writerThreadFunc, this);
+}
+
+TraceEvents::~TraceEvents() {
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex);
+        keepRunning = false;
+    }
+    pendingCondition.notify_one();
+    writerThread->join();
+
+    flush();
+    *out << "\n]}\n";
+    out->flush();
+}
+
+uint64_t TraceEvents::getTimestamp() {
+    uint64_t timestamp = 0u;
+    osTime->getCpuTime(&timestamp);
+    return timestamp;
+}
+
+void TraceEvents::recordRange(const char *name, Category category, uint64_t startNs, uint64_t endNs) {
+    appendEvent(*getThreadBuffer(), name, category, startNs, endNs);
+}
+
+void TraceEvents::recordGpuRange(const char *name, uint64_t startNs, uint64_t endNs) {
+    appendEvent(gpuBuffer, name, Category::gpu, startNs, endNs);
+}
+
+void TraceEvents::flush() {
+    std::vector<std::vector<Event>> events;
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex);
+        events.swap(pendingEvents);
+    }
+    {
+        std::lock_guard<std::mutex> lock(buffersMutex);
+        for (auto &buffer : threadBuffers) {
+            takeEvents(*buffer, events);
+        }
+    }
+    takeEvents(gpuBuffer, events);
+
+    std::lock_guard<std::mutex> lock(outMutex);
+    for (auto &bufferEvents : events) {
+        writeEvents(bufferEvents);
+    }
+    out->flush();
+}
+
+const char *TraceEvents::getCategoryName(Category category) {
+    switch (category) {
+    case Category::api:
+        return "api";
+    case Category::submission:
+        return "submission";
+    case Category::ioctl:
+        return "ioctl";
+    case Category::wait:
+        return "wait";
+    case Category::allocation:
+        return "allocation";
+    case Category::compile:
+        return "compile";
+    case Category::initialization:
+        return "initialization";
+    case Category::lock:
+        return "lock";
+    default:
+        return "gpu";
+    }
+}
+
+TraceEvents::ThreadBuffer *TraceEvents::getThreadBuffer() {
+    if (threadBufferCache.tracerId != tracerId) {
+        auto buffer = std::make_unique<ThreadBuffer>();
+        buffer->events.reserve(eventsPerBuffer);
+
+        std::lock_guard<std::mutex> lock(buffersMutex);
+        buffer->threadId = static_cast<uint32_t>(threadBuffers.size()) + gpuThreadId + 1;
+        threadBufferCache = {tracerId, buffer.get()};
+        threadBuffers.push_back(std::move(buffer));
+    }
+    return threadBufferCache.buffer;
+}
+
+void TraceEvents::appendEvent(ThreadBuffer &buffer, const char *name, Category category, uint64_t startNs, uint64_t endNs) {
+    std::vector<Event> fullEvents;
+    {
+        std::lock_guard<std::mutex> lock(buffer.mutex);
+        buffer.events.push_back({name, startNs, endNs > startNs ? endNs - startNs : 0u, buffer.threadId, category});
+        if (buffer.events.size() < eventsPerBuffer) {
+            return;
+        }
+        fullEvents.swap(buffer.events);
+        buffer.events.reserve(eventsPerBuffer);
+    }
+    submitEvents(std::move(fullEvents));
+}
+
+void TraceEvents::submitEvents(std::vector<Event> &&events) {
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex);
+        pendingEvents.push_back(std::move(events));
+    }
+    pendingCondition.notify_one();
+}
+
+void TraceEvents::takeEvents(ThreadBuffer &buffer, std::vector<std::vector<Event>> &events) {
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+    if (!buffer.events.empty()) {
+        events.push_back(std::move(buffer.events));
+        buffer.events.clear();
+        buffer.events.reserve(eventsPerBuffer);
+    }
+}
+
+void TraceEvents::writeEvents(const std::vector<Event> &events) {
+    for (auto &event : events) {
+        *out << ",\n{\"name\":\"" << event.name << "\",\"cat\":\"" << getCategoryName(event.category)
+             << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << event.threadId << ",\"ts\":";
+        writeMicroseconds(*out, event.startNs);
+        *out << ",\"dur\":";
+        writeMicroseconds(*out, event.durationNs);
+        *out << "}";
+    }
+}
+
+void *TraceEvents::writerThreadFunc(void *arg) {
+    auto traceEvents = static_cast<TraceEvents *>(arg);
+    std::unique_lock<std::mutex> lock(traceEvents->pendingMutex);
+    while (true) {
+        traceEvents->pendingCondition.wait(lock, [&]() { return !traceEvents->keepRunning || !traceEvents->pendingEvents.empty(); });
+        if (traceEvents->pendingEvents.empty()) {
+            break;
+        }
+        std::vector<std::vector<Event>> events;
+        events.swap(traceEvents->pendingEvents);
+        // taken before releasing pendingMutex, so flush() waits for this batch to be written
+        std::unique_lock<std::mutex> outLock(traceEvents->outMutex);
+        lock.unlock();
+        for (auto &bufferEvents : events) {
+            traceEvents->writeEvents(bufferEvents);
+        }
+        outLock.unlock();
+        lock.lock();
+    }
+    return nullptr;
+}
+
+} // namespace NEO
@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/os_interface/os_thread.h"
+#include "shared/source/os_interface/os_time.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace NEO {
+
+// Collects duration events from runtime threads and writes them in Chrome trace JSON format.
+// Each thread appends to its own buffer; full buffers are handed to a writer thread,
+// so recording an event never touches the output stream.
+class TraceEvents {
+  public:
+    enum class Category : uint8_t {
+        api,
+        submission,
+        ioctl,
+        wait,
+        allocation,
+        compile,
+        initialization,
+        lock,
+        gpu,
+    };
+
+    struct Event {
+        const char *name;
+        uint64_t startNs;
+        uint64_t durationNs;
+        uint32_t threadId;
+        Category category;
+    };
+
+    static constexpr size_t eventsPerBuffer = 4096u;
+    static constexpr uint32_t gpuThreadId = 0u;
+
+    static TraceEvents *get();
+    // writes out the remaining events, get() returns nullptr afterwards
+    static void destroy();
+
+    TraceEvents(std::unique_ptr<std::ostream> out);
+    ~TraceEvents();
+
+    uint64_t getTimestamp();
+    // name must stay valid for the lifetime of the tracer, i.e. a string literal
+    void recordRange(const char *name, Category category, uint64_t startNs, uint64_t endNs);
+    // start and end are GPU ranges already converted to the OSTime CPU domain
+    void recordGpuRange(const char *name, uint64_t startNs, uint64_t endNs);
+    void flush();
+
+    static const char *getCategoryName(Category category);
+
+  protected:
+    struct ThreadBuffer {
+        std::mutex mutex;
+        std::vector<Event> events;
+        uint32_t threadId = 0u;
+    };
+
+    struct ThreadBufferCache {
+        uint64_t tracerId;
+        ThreadBuffer *buffer;
+    };
+
+    ThreadBuffer *getThreadBuffer();
+    void appendEvent(ThreadBuffer &buffer, const char *name, Category category, uint64_t startNs, uint64_t endNs);
+    void submitEvents(std::vector<Event> &&events);
+    static void takeEvents(ThreadBuffer &buffer, std::vector<std::vector<Event>> &events);
+    // outMutex has to be held by the caller
+    void writeEvents(const std::vector<Event> &events);
+    static void *writerThreadFunc(void *arg);
+
+    static std::atomic<uint64_t> tracerIdCounter;
+    static thread_local ThreadBufferCache threadBufferCache;
+    const uint64_t tracerId;
+
+    std::unique_ptr<OSTime> osTime;
+
+    std::mutex outMutex;
+    std::unique_ptr<std::ostream> out;
+
+    std::mutex buffersMutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> threadBuffers;
+    ThreadBuffer gpuBuffer;
+
+    std::mutex pendingMutex;
+    std::condition_variable pendingCondition;
+    std::vector<std::vector<Event>> pendingEvents;
+    bool keepRunning = true;
+    std::unique_ptr<Thread> writerThread;
+};
+
+struct ScopedTraceEvent {
+    ScopedTraceEvent(const char *name, TraceEvents::Category category)
+        : traceEvents(TraceEvents::get()), name(name), category(category) {
+        if (traceEvents) {
+            start = traceEvents->getTimestamp();
+        }
+    }
+
+    ~ScopedTraceEvent() {
+        if (traceEvents) {
+            traceEvents->recordRange(name, category, start, traceEvents->getTimestamp());
+        }
+    }
+
+    TraceEvents *traceEvents;
+    const char *name;
+    TraceEvents::Category category;
+    uint64_t start = 0u;
+};
+
+// Takes a lock created with std::defer_lock; only the time spent blocked on a contended mutex is recorded
+template <typename LockType>
+void lockWithContentionTrace(LockType &lock, const char *name) {
+    if (!lock.try_lock()) {
+        ScopedTraceEvent traceEvent(name, TraceEvents::Category::lock);
+        lock.lock();
+    }
+}
+
+} // namespace NEO
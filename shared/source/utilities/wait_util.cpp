@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/wait_util.h"
+
+#include "shared/source/utilities/cpu_info.h"
+#include "shared/source/utilities/cpuintrinsics.h"
+
+#include <chrono>
+#include <thread>
+
+namespace NEO {
+namespace WaitUtils {
+
+bool isUmwaitSupported() {
+    return CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureWaitpkg);
+}
+
+void waitForCompletion(volatile uint32_t *pollAddress, uint32_t expectedValue, const WaitPolicy &policy, WaitStatistics &statistics) {
+    if (expectedValue <= *pollAddress) {
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    uint64_t iteration = 0u;
+    const uint64_t pauseLimit = static_cast<uint64_t>(policy.spinCount) + policy.pauseCount;
+
+    while (expectedValue > *pollAddress) {
+        if (iteration < policy.spinCount) {
+            iteration++;
+        } else if (iteration < pauseLimit) {
+            iteration++;
+            statistics.pauseCount++;
+            if (policy.useUmwait) {
+                CpuIntrinsics::umonitor(pollAddress);
+                if (expectedValue > *pollAddress) {
+                    CpuIntrinsics::umwait(0u, CpuIntrinsics::rdtsc() + policy.umwaitTscDelta);
+                }
+            } else {
+                CpuIntrinsics::pause();
+            }
+        } else {
+            statistics.yieldCount++;
+            std::this_thread::yield();
+        }
+    }
+
+    statistics.waitCount++;
+    statistics.waitTimeNs += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace WaitUtils
+} // namespace NEO
@@ -0,0 +1,40 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace NEO {
+namespace WaitUtils {
+
+constexpr uint32_t defaultSpinCount = 128u;
+constexpr uint32_t defaultPauseCount = 4096u;
+constexpr uint64_t defaultUmwaitTscDelta = 2048u;
+
+// Polling is performed in three phases: tight spin, spin with pause (or umwait when enabled and supported)
+// and finally yielding the CPU to other threads until the expected value is observed.
+struct WaitPolicy {
+    uint32_t spinCount = defaultSpinCount;
+    uint32_t pauseCount = defaultPauseCount;
+    uint64_t umwaitTscDelta = defaultUmwaitTscDelta;
+    bool useUmwait = false;
+};
+
+struct WaitStatistics {
+    uint64_t waitCount = 0u;
+    uint64_t waitTimeNs = 0u;
+    uint64_t pauseCount = 0u;
+    uint64_t yieldCount = 0u;
+};
+
+bool isUmwaitSupported();
+
+void waitForCompletion(volatile uint32_t *pollAddress, uint32_t expectedValue, const WaitPolicy &policy, WaitStatistics &statistics);
+
+} // namespace WaitUtils
+} // namespace NEO
@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/mapped_file.h"
+
+#include "shared/source/os_interface/windows/windows_wrapper.h"
+
+namespace NEO {
+
+std::unique_ptr<MappedFile> MappedFile::create(const std::string &filePath) {
+    HANDLE fileHandle = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE) {
+        return nullptr;
+    }
+
+    LARGE_INTEGER fileSize = {};
+    if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart <= 0) {
+        CloseHandle(fileHandle);
+        return nullptr;
+    }
+
+    HANDLE mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mappingHandle == nullptr) {
+        CloseHandle(fileHandle);
+        return nullptr;
+    }
+
+    void *mappedData = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+    if (mappedData == nullptr) {
+        CloseHandle(mappingHandle);
+        CloseHandle(fileHandle);
+        return nullptr;
+    }
+
+    std::unique_ptr<MappedFile> mappedFile(new MappedFile);
+    mappedFile->osFileHandle = reinterpret_cast<intptr_t>(fileHandle);
+    mappedFile->osMappingHandle = reinterpret_cast<intptr_t>(mappingHandle);
+    mappedFile->data = static_cast<const uint8_t *>(mappedData);
+    mappedFile->size = static_cast<size_t>(fileSize.QuadPart);
+    return mappedFile;
+}
+
+MappedFile::~MappedFile() {
+    if (data != nullptr) {
+        UnmapViewOfFile(data);
+    }
+    if (osMappingHandle != invalidHandle) {
+        CloseHandle(reinterpret_cast<HANDLE>(osMappingHandle));
+    }
+    if (osFileHandle != invalidHandle) {
+        CloseHandle(reinterpret_cast<HANDLE>(osFileHandle));
+    }
+}
+} // namespace NEO
@@ -15,6 +15,8 @@
 using namespace NEO;
 
 extern std::atomic<uintptr_t> lastClFlushedPtr;
+extern std::atomic<uint32_t> clWbCounter;
+extern std::atomic<uint32_t> sfenceCounter;
 
 struct DirectSubmissionFixture : public DeviceFixture {
     void SetUp() {
@@ -86,6 +86,62 @@ TEST_F(BindlessHeapsHelperTests, givenBindlessHeapHelperWhenAllocateSsInHeapTwic
     EXPECT_NE(ssInHeapInfo1.surfaceStateOffset, ssInHeapInfo2.surfaceStateOffset);
 }
 
+TEST_F(BindlessHeapsHelperTests, givenBindlessHeapHelperWhenAllocateSsInHeapForDifferentViewsOfTheSameAllocationThenEachViewGetsItsOwnOffset) {
+    auto bindlessHeapHelper = std::make_unique<MockBindlesHeapsHelper>(pDevice->getMemoryManager(), pDevice->getNumAvailableDevices() > 1, pDevice->getRootDeviceIndex());
+
+    MockGraphicsAllocation alloc;
+    size_t size = 0x40;
+    SurfaceStateView view1 = {0x1000, 0x100, 2};
+    SurfaceStateView view2 = {0x1040, 0xc0, 2};
+    auto ssInHeapInfo1 = bindlessHeapHelper->allocateSSInHeap(size, &alloc, BindlessHeapsHelper::BindlesHeapType::GLOBAL_SSH, view1);
+    auto ssInHeapInfo2 = bindlessHeapHelper->allocateSSInHeap(size, &alloc, BindlessHeapsHelper::BindlesHeapType::GLOBAL_SSH, view2);
+    auto ssInHeapInfo3 = bindlessHeapHelper->allocateSSInHeap(size, &alloc, BindlessHeapsHelper::BindlesHeapType::GLOBAL_SSH, view1);
+
+    EXPECT_NE(ssInHeapInfo1.surfaceStateOffset, ssInHeapInfo2.surfaceStateOffset);
+    EXPECT_EQ(ssInHeapInfo1.surfaceStateOffset, ssInHeapInfo3.surfaceStateOffset);
+    EXPECT_EQ(2u, bindlessHeapHelper->surfaceStateInHeapAllocationMap[&alloc].size());
+}
+
+TEST_F(BindlessHeapsHelperTests, givenMaxViewsOfAllocationInHeapWhenAllocateSsInHeapForNewViewThenOldestViewSlotIsReused) {
+    auto bindlessHeapHelper = std::make_unique<MockBindlesHeapsHelper>(pDevice->getMemoryManager(), pDevice->getNumAvailableDevices() > 1, pDevice->getRootDeviceIndex());
+
+    MockGraphicsAllocation alloc;
+    size_t size = 0x40;
+    SurfaceStateView view = {0x1000, 0x100, 2};
+    auto firstSsInHeapInfo = bindlessHeapHelper->allocateSSInHeap(size, &alloc, BindlessHeapsHelper::BindlesHeapType::GLOBAL_SSH, view);
+    for (size_t i = 1; i < BindlessHeapsHelper::maxViewsPerAllocation; i++) {
+        view.gpuAddress += MemoryConstants::pageSize;
+        bindlessHeapHelper->allocateSSInHeap(size, &alloc, BindlessHeapsHelper::BindlesHeapType::GLOBAL_SSH, view);
+    }
+    auto usedBeforeNewView = bindlessHeapHelper->getHeap(BindlessHeapsHelper::BindlesHeapType::GLOBAL_SSH)->getUsed();
+
+    view.gpuAddress += MemoryConstants::pageSize;
+    auto newSsInHeapInfo = bindlessHeapHelper->allocateSSInHeap(size, &alloc, BindlessHeapsHelper::BindlesHeapType::GLOBAL_SSH, view);
+
+    EXPECT_EQ(firstSsInHeapInfo.surfaceStateOffset, newSsInHeapInfo.surfaceStateOffset);
+    EXPECT_EQ(usedBeforeNewView, bindlessHeapHelper->getHeap(BindlessHeapsHelper::BindlesHeapType::GLOBAL_SSH)->getUsed());
+    EXPECT_EQ(BindlessHeapsHelper::maxViewsPerAllocation, bindlessHeapHelper->surfaceStateInHeapAllocationMap[&alloc].size());
+}
+
+TEST_F(BindlessHeapsHelperTests, givenBindlessHeapHelperWhenAllocatingSamplerStatesWithTheSameContentThenTheyAreStoredOnce) {
+    auto bindlessHeapHelper = std::make_unique<MockBindlesHeapsHelper>(pDevice->getMemoryManager(), pDevice->getNumAvailableDevices() > 1, pDevice->getRootDeviceIndex());
+    auto dsh = bindlessHeapHelper->getHeap(BindlessHeapsHelper::BindlesHeapType::GLOBAL_DSH);
+
+    uint8_t samplerStates[0x20];
+    memset(samplerStates, 0x11, sizeof(samplerStates));
+    auto samplerInfo1 = bindlessHeapHelper->allocateSamplerStatesInHeap(samplerStates, sizeof(samplerStates));
+    auto usedAfterFirstAllocation = dsh->getUsed();
+    auto samplerInfo2 = bindlessHeapHelper->allocateSamplerStatesInHeap(samplerStates, sizeof(samplerStates));
+    EXPECT_EQ(samplerInfo1.surfaceStateOffset, samplerInfo2.surfaceStateOffset);
+    EXPECT_EQ(usedAfterFirstAllocation, dsh->getUsed());
+    EXPECT_EQ(0, memcmp(samplerInfo1.ssPtr, samplerStates, sizeof(samplerStates)));
+
+    samplerStates[0] = 0x22;
+    auto samplerInfo3 = bindlessHeapHelper->allocateSamplerStatesInHeap(samplerStates, sizeof(samplerStates));
+    EXPECT_NE(samplerInfo1.surfaceStateOffset, samplerInfo3.surfaceStateOffset);
+    EXPECT_EQ(2u, bindlessHeapHelper->samplerStatesInHeap.size());
+}
+
 TEST_F(BindlessHeapsHelperTests, givenBindlessHeapHelperWhenAllocatingMoreSsThenNewHeapAllocationCreated) {
     auto bindlessHeapHelper = std::make_unique<MockBindlesHeapsHelper>(pDevice->getMemoryManager(), pDevice->getNumAvailableDevices() > 1, pDevice->getRootDeviceIndex());
     size_t ssSize = 0x40;
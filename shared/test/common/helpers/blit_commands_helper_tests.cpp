@@ -85,6 +85,73 @@ TEST(BlitCommandsHelperTest, GivenCopySizeYAndZEqual0WhenConstructingPropertiesF
     EXPECT_EQ(blitProperties.copySize, expectedSize);
 }
 
+TEST(BlitCommandsHelperTest, GivenFillPatternWhenConstructingPropertiesForColorFillThenPixelCountAndPatternAreSet) {
+    uint32_t dst[16] = {};
+    uint32_t clear[] = {5, 6, 7, 8};
+    uint64_t dstGpuAddr = 0x54320;
+    uint64_t clearGpuAddr = 0x5678;
+    std::unique_ptr<MockGraphicsAllocation> dstAlloc(new MockGraphicsAllocation(dst, dstGpuAddr, sizeof(dst)));
+    std::unique_ptr<GraphicsAllocation> clearColorAllocation(new MockGraphicsAllocation(clear, clearGpuAddr, sizeof(clear)));
+    uint32_t fillPattern[4] = {1, 2, 0, 0};
+
+    auto blitProperties = NEO::BlitProperties::constructPropertiesForColorFill(dstAlloc.get(), dstGpuAddr + 8, fillPattern, 8,
+                                                                               sizeof(dst) - 8, clearColorAllocation.get());
+
+    EXPECT_EQ(BlitterConstants::BlitDirection::PatternToBuffer, blitProperties.blitDirection);
+    EXPECT_EQ(dstAlloc.get(), blitProperties.dstAllocation);
+    EXPECT_EQ(dstAlloc.get(), blitProperties.srcAllocation);
+    EXPECT_EQ(dstGpuAddr + 8, blitProperties.dstGpuAddress);
+    Vec3<size_t> expectedSize{(sizeof(dst) - 8) / 8, 1, 1};
+    EXPECT_EQ(expectedSize, blitProperties.copySize);
+    EXPECT_EQ(8u, blitProperties.fillPatternSize);
+    EXPECT_EQ(0, memcmp(fillPattern, blitProperties.fillPattern, sizeof(fillPattern)));
+}
+
+TEST(BlitHelperTest, GivenNotPowerOfTwoPatternSizeWhenNarrowingFillPatternThenZeroIsReturned) {
+    uint8_t pattern[12] = {};
+    uint32_t colorFillPattern[4] = {};
+    EXPECT_EQ(0u, BlitHelper::narrowFillPattern(colorFillPattern, pattern, 3, 16));
+    EXPECT_EQ(0u, BlitHelper::narrowFillPattern(colorFillPattern, pattern, 12, 16));
+}
+
+TEST(BlitHelperTest, GivenPatternWiderThanMaxColorDepthWhenNarrowingFillPatternThenRepeatedPatternIsNarrowedAndOtherIsRejected) {
+    uint32_t repeatedPattern[32] = {};
+    for (auto i = 0u; i < 32; i++) {
+        repeatedPattern[i] = 0x01020304 + i % 2;
+    }
+    uint32_t colorFillPattern[4] = {};
+    EXPECT_EQ(16u, BlitHelper::narrowFillPattern(colorFillPattern, repeatedPattern, sizeof(repeatedPattern), 16));
+    EXPECT_EQ(0, memcmp(repeatedPattern, colorFillPattern, sizeof(colorFillPattern)));
+
+    repeatedPattern[31] = 0;
+    EXPECT_EQ(0u, BlitHelper::narrowFillPattern(colorFillPattern, repeatedPattern, sizeof(repeatedPattern), 16));
+
+    uint32_t pattern[4] = {1, 2, 3, 4};
+    EXPECT_EQ(16u, BlitHelper::narrowFillPattern(colorFillPattern, pattern, sizeof(pattern), 16));
+    EXPECT_EQ(0u, BlitHelper::narrowFillPattern(colorFillPattern, pattern, sizeof(pattern), 4));
+}
+
+TEST(BlitHelperTest, GivenNarrowPatternWhenWideningFillPatternThenPatternIsReplicatedAsFarAsAlignmentAllows) {
+    uint32_t colorFillPattern[4] = {0xAB, 0, 0, 0};
+    EXPECT_EQ(16u, BlitHelper::widenFillPattern(colorFillPattern, 1, 0x1000, 0x100, 16));
+    for (auto dword : colorFillPattern) {
+        EXPECT_EQ(0xABABABABu, dword);
+    }
+
+    uint32_t unalignedPattern[4] = {0xAB, 0, 0, 0};
+    EXPECT_EQ(4u, BlitHelper::widenFillPattern(unalignedPattern, 1, 0x1004, 0x100, 16));
+    EXPECT_EQ(0xABABABABu, unalignedPattern[0]);
+    EXPECT_EQ(0u, unalignedPattern[1]);
+
+    uint32_t oddSizePattern[4] = {0xAB, 0, 0, 0};
+    EXPECT_EQ(2u, BlitHelper::widenFillPattern(oddSizePattern, 1, 0x1000, 0x102, 4));
+    EXPECT_EQ(0xABABu, oddSizePattern[0]);
+
+    uint32_t limitedPattern[4] = {0xAB, 0, 0, 0};
+    EXPECT_EQ(4u, BlitHelper::widenFillPattern(limitedPattern, 1, 0x1000, 0x100, 4));
+    EXPECT_EQ(0u, limitedPattern[1]);
+}
+
 using BlitTests = Test<DeviceFixture>;
 
 HWTEST_F(BlitTests, givenDebugVariablesWhenGettingMaxBlitSizeThenHonorUseProvidedValues) {
@@ -193,7 +260,7 @@ HWTEST_F(BlitTests, givenMemoryWhenFillPatternWithBlitThenCommandIsProgrammed) {
     MockGraphicsAllocation mockAllocation(0, GraphicsAllocation::AllocationType::INTERNAL_HOST_MEMORY,
                                           reinterpret_cast<void *>(0x1234), 0x1000, 0, sizeof(uint32_t),
                                           MemoryPool::System4KBPages, mockMaxOsContextCount);
-    BlitCommandsHelper<FamilyType>::dispatchBlitMemoryColorFill(&mockAllocation, pattern, sizeof(uint32_t), stream, mockAllocation.getUnderlyingBufferSize(), *pDevice->getExecutionEnvironment()->rootDeviceEnvironments[pDevice->getRootDeviceIndex()]);
+    BlitCommandsHelper<FamilyType>::dispatchBlitMemoryColorFill(&mockAllocation, mockAllocation.getGpuAddress(), pattern, sizeof(uint32_t), stream, mockAllocation.getUnderlyingBufferSize(), *pDevice->getExecutionEnvironment()->rootDeviceEnvironments[pDevice->getRootDeviceIndex()]);
     GenCmdList cmdList;
     ASSERT_TRUE(FamilyType::PARSE::parseCommandBuffer(
         cmdList, ptrOffset(stream.getCpuBase(), 0), stream.getUsed()));
@@ -210,7 +277,7 @@ HWTEST_F(BlitTests, givenMemorySizeBiggerThanMaxWidthButLessThanTwiceMaxWidthWhe
     MockGraphicsAllocation mockAllocation(0, GraphicsAllocation::AllocationType::INTERNAL_HOST_MEMORY,
                                           reinterpret_cast<void *>(0x1234), 0x1000, 0, (2 * BlitterConstants::maxBlitWidth) - 1,
                                           MemoryPool::System4KBPages, mockMaxOsContextCount);
-    BlitCommandsHelper<FamilyType>::dispatchBlitMemoryColorFill(&mockAllocation, pattern, sizeof(uint32_t), stream, mockAllocation.getUnderlyingBufferSize(), *pDevice->getExecutionEnvironment()->rootDeviceEnvironments[pDevice->getRootDeviceIndex()]);
+    BlitCommandsHelper<FamilyType>::dispatchBlitMemoryColorFill(&mockAllocation, mockAllocation.getGpuAddress(), pattern, sizeof(uint32_t), stream, mockAllocation.getUnderlyingBufferSize(), *pDevice->getExecutionEnvironment()->rootDeviceEnvironments[pDevice->getRootDeviceIndex()]);
     GenCmdList cmdList;
     ASSERT_TRUE(FamilyType::PARSE::parseCommandBuffer(
         cmdList, ptrOffset(stream.getCpuBase(), 0), stream.getUsed()));
@@ -229,9 +296,9 @@ HWTEST_F(BlitTests, givenMemorySizeTwiceBiggerThanMaxWidthWhenFillPatternWithBli
     uint32_t streamBuffer[100] = {};
     LinearStream stream(streamBuffer, sizeof(streamBuffer));
     MockGraphicsAllocation mockAllocation(0, GraphicsAllocation::AllocationType::INTERNAL_HOST_MEMORY,
-                                          reinterpret_cast<void *>(0x1234), 0x1000, 0, (2 * BlitterConstants::maxBlitWidth * sizeof(uint32_t)),
+                                          reinterpret_cast<void *>(0x1234), 0x1000, 0, (2 * BlitterConstants::maxBlitWidth),
                                           MemoryPool::System4KBPages, mockMaxOsContextCount);
-    BlitCommandsHelper<FamilyType>::dispatchBlitMemoryColorFill(&mockAllocation, pattern, sizeof(uint32_t), stream, mockAllocation.getUnderlyingBufferSize(), *pDevice->getExecutionEnvironment()->rootDeviceEnvironments[pDevice->getRootDeviceIndex()]);
+    BlitCommandsHelper<FamilyType>::dispatchBlitMemoryColorFill(&mockAllocation, mockAllocation.getGpuAddress(), pattern, sizeof(uint32_t), stream, mockAllocation.getUnderlyingBufferSize(), *pDevice->getExecutionEnvironment()->rootDeviceEnvironments[pDevice->getRootDeviceIndex()]);
     GenCmdList cmdList;
     ASSERT_TRUE(FamilyType::PARSE::parseCommandBuffer(
         cmdList, ptrOffset(stream.getCpuBase(), 0), stream.getUsed()));
@@ -251,9 +318,9 @@ HWTEST_F(BlitTests, givenMemorySizeIsLessThanTwicenMaxWidthWhenFillPatternWithBl
     uint32_t streamBuffer[100] = {};
     LinearStream stream(streamBuffer, sizeof(streamBuffer));
     MockGraphicsAllocation mockAllocation(0, GraphicsAllocation::AllocationType::INTERNAL_HOST_MEMORY,
-                                          reinterpret_cast<void *>(0x1234), 0x1000, 0, ((BlitterConstants::maxBlitWidth + 1) * sizeof(uint32_t)),
+                                          reinterpret_cast<void *>(0x1234), 0x1000, 0, (BlitterConstants::maxBlitWidth + sizeof(uint32_t)),
                                           MemoryPool::System4KBPages, mockMaxOsContextCount);
-    BlitCommandsHelper<FamilyType>::dispatchBlitMemoryColorFill(&mockAllocation, pattern, sizeof(uint32_t), stream, mockAllocation.getUnderlyingBufferSize(), *pDevice->getExecutionEnvironment()->rootDeviceEnvironments[pDevice->getRootDeviceIndex()]);
+    BlitCommandsHelper<FamilyType>::dispatchBlitMemoryColorFill(&mockAllocation, mockAllocation.getGpuAddress(), pattern, sizeof(uint32_t), stream, mockAllocation.getUnderlyingBufferSize(), *pDevice->getExecutionEnvironment()->rootDeviceEnvironments[pDevice->getRootDeviceIndex()]);
     GenCmdList cmdList;
     ASSERT_TRUE(FamilyType::PARSE::parseCommandBuffer(
         cmdList, ptrOffset(stream.getCpuBase(), 0), stream.getUsed()));
@@ -276,7 +343,7 @@ HWTEST2_F(BlitTests, givenMemoryWhenFillPatternSizeIs4BytesThen32BitMaskISSetCor
     MockGraphicsAllocation mockAllocation(0, GraphicsAllocation::AllocationType::INTERNAL_HOST_MEMORY,
                                           reinterpret_cast<void *>(0x1234), 0x1000, 0, sizeof(uint32_t),
                                           MemoryPool::System4KBPages, mockMaxOsContextCount);
-    BlitCommandsHelper<FamilyType>::dispatchBlitMemoryColorFill(&mockAllocation, &pattern, sizeof(uint32_t), stream, mockAllocation.getUnderlyingBufferSize(), *pDevice->getExecutionEnvironment()->rootDeviceEnvironments[pDevice->getRootDeviceIndex()]);
+    BlitCommandsHelper<FamilyType>::dispatchBlitMemoryColorFill(&mockAllocation, mockAllocation.getGpuAddress(), &pattern, sizeof(uint32_t), stream, mockAllocation.getUnderlyingBufferSize(), *pDevice->getExecutionEnvironment()->rootDeviceEnvironments[pDevice->getRootDeviceIndex()]);
     GenCmdList cmdList;
     ASSERT_TRUE(FamilyType::PARSE::parseCommandBuffer(
         cmdList, ptrOffset(stream.getCpuBase(), 0), stream.getUsed()));
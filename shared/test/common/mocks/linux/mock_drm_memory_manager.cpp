@@ -22,6 +22,11 @@ std::atomic<int> lseekCalledCount(0);
 int closeInputFd = 0;
 std::atomic<int> closeCalledCount(0);
 StackVec<void *, 10> mmapVector;
+std::atomic<int> madviseCalledCount(0);
+int madviseAdvice = 0;
+std::atomic<int> mbindCalledCount(0);
+unsigned long mbindNodeMask = 0;
+int mbindMode = 0;
 
 TestedDrmMemoryManager::TestedDrmMemoryManager(ExecutionEnvironment &executionEnvironment) : MemoryManagerCreate(gemCloseWorkerMode::gemCloseWorkerInactive,
                                                                                                                  false,
@@ -29,12 +34,19 @@ TestedDrmMemoryManager::TestedDrmMemoryManager(ExecutionEnvironment &executionEn
                                                                                                                  executionEnvironment) {
     this->mmapFunction = &mmapMock;
     this->munmapFunction = &munmapMock;
+    this->madviseFunction = &madviseMock;
+    this->mbindFunction = &mbindMock;
     this->lseekFunction = &lseekMock;
     this->closeFunction = &closeMock;
     lseekReturn = 4096;
     lseekCalledCount = 0;
     closeInputFd = 0;
     closeCalledCount = 0;
+    madviseCalledCount = 0;
+    madviseAdvice = 0;
+    mbindCalledCount = 0;
+    mbindNodeMask = 0;
+    mbindMode = 0;
     hostPtrManager.reset(new MockHostPtrManager);
 };
 
@@ -48,12 +60,19 @@ TestedDrmMemoryManager::TestedDrmMemoryManager(bool enableLocalMemory,
                                                                                                                  executionEnvironment) {
     this->mmapFunction = &mmapMock;
     this->munmapFunction = &munmapMock;
+    this->madviseFunction = &madviseMock;
+    this->mbindFunction = &mbindMock;
     this->lseekFunction = &lseekMock;
     this->closeFunction = &closeMock;
     lseekReturn = 4096;
     lseekCalledCount = 0;
     closeInputFd = 0;
     closeCalledCount = 0;
+    madviseCalledCount = 0;
+    madviseAdvice = 0;
+    mbindCalledCount = 0;
+    mbindNodeMask = 0;
+    mbindMode = 0;
 }
 
 void TestedDrmMemoryManager::injectPinBB(BufferObject *newPinBB, uint32_t rootDeviceIndex) {
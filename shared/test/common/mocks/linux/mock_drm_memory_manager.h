@@ -18,6 +18,11 @@ extern std::atomic<int> lseekCalledCount;
 extern int closeInputFd;
 extern std::atomic<int> closeCalledCount;
 extern StackVec<void *, 10> mmapVector;
+extern std::atomic<int> madviseCalledCount;
+extern int madviseAdvice;
+extern std::atomic<int> mbindCalledCount;
+extern unsigned long mbindNodeMask;
+extern int mbindMode;
 
 inline void *mmapMock(void *addr, size_t length, int prot, int flags, int fd, off_t offset) noexcept {
     if (addr) {
@@ -41,6 +46,19 @@ inline int munmapMock(void *addr, size_t length) noexcept {
     return 0;
 }
 
+inline int madviseMock(void *addr, size_t length, int advice) noexcept {
+    madviseCalledCount++;
+    madviseAdvice = advice;
+    return 0;
+}
+
+inline long mbindMock(void *addr, unsigned long len, int mode, const unsigned long *nodemask, unsigned long maxnode, unsigned int flags) noexcept {
+    mbindCalledCount++;
+    mbindMode = mode;
+    mbindNodeMask = *nodemask;
+    return 0;
+}
+
 inline off_t lseekMock(int fd, off_t offset, int whence) noexcept {
     lseekCalledCount++;
     if ((fd == closeInputFd) && (closeCalledCount > 0)) {
@@ -75,12 +93,16 @@ class TestedDrmMemoryManager : public MemoryManagerCreate<DrmMemoryManager> {
     using DrmMemoryManager::eraseSharedBufferObject;
     using DrmMemoryManager::getDefaultDrmContextId;
     using DrmMemoryManager::getDrm;
+    using DrmMemoryManager::getPreferredNumaNode;
     using DrmMemoryManager::getRootDeviceIndex;
     using DrmMemoryManager::getUserptrAlignment;
+    using DrmMemoryManager::isHugePageAllocationPreferred;
     using DrmMemoryManager::gfxPartitions;
     using DrmMemoryManager::lockResourceInLocalMemoryImpl;
     using DrmMemoryManager::memoryForPinBBs;
     using DrmMemoryManager::mmapFunction;
+    using DrmMemoryManager::madviseFunction;
+    using DrmMemoryManager::mbindFunction;
     using DrmMemoryManager::munmapFunction;
     using DrmMemoryManager::pinBBs;
     using DrmMemoryManager::pinThreshold;
@@ -24,6 +24,7 @@ class MockBindlesHeapsHelper : public BindlessHeapsHelper {
     using BaseClass::isMultiOsContextCapable;
     using BaseClass::memManager;
     using BaseClass::rootDeviceIndex;
+    using BaseClass::samplerStatesInHeap;
     using BaseClass::ssHeapsAllocations;
     using BaseClass::surfaceStateHeaps;
     using BaseClass::surfaceStateInHeapAllocationMap;
@@ -16,8 +16,9 @@ template <typename GfxFamily, typename Dispatcher>
 struct MockDirectSubmissionHw : public DirectSubmissionHw<GfxFamily, Dispatcher> {
     using BaseClass = DirectSubmissionHw<GfxFamily, Dispatcher>;
     using BaseClass::allocateResources;
-    using BaseClass::completionRingBuffers;
     using BaseClass::cpuCachelineFlush;
+    using BaseClass::cpuCachelineFlushFence;
+    using BaseClass::cpuCachelineFlushFunc;
     using BaseClass::currentQueueWorkCount;
     using BaseClass::currentRingBuffer;
     using BaseClass::deallocateResources;
@@ -43,10 +44,11 @@ struct MockDirectSubmissionHw : public DirectSubmissionHw<GfxFamily, Dispatcher>
     using BaseClass::getSizeStartSection;
     using BaseClass::getSizeSwitchRingBufferSection;
     using BaseClass::hwInfo;
+    using BaseClass::maxRingBufferCount;
     using BaseClass::osContext;
     using BaseClass::performDiagnosticMode;
-    using BaseClass::ringBuffer;
-    using BaseClass::ringBuffer2;
+    using BaseClass::ringBuffers;
+    using BaseClass::ringBuffersExhaustedCount;
     using BaseClass::ringCommandStream;
     using BaseClass::ringStart;
     using BaseClass::semaphoreData;
@@ -90,6 +92,10 @@ struct MockDirectSubmissionHw : public DirectSubmissionHw<GfxFamily, Dispatcher>
 
     void handleSwitchRingBuffers() override {}
 
+    bool isCompleted(uint32_t ringBufferIndex) override {
+        return isCompletedReturn;
+    }
+
     uint64_t updateTagValue() override {
         return updateTagValueReturn;
     }
@@ -122,5 +128,6 @@ struct MockDirectSubmissionHw : public DirectSubmissionHw<GfxFamily, Dispatcher>
     bool allocateOsResourcesReturn = true;
     bool submitReturn = true;
     bool handleResidencyReturn = true;
+    bool isCompletedReturn = true;
 };
 } // namespace NEO
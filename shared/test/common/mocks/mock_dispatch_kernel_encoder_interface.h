@@ -52,6 +52,9 @@ struct MockDispatchKernelEncoder : public DispatchKernelEncoderI {
     uint32_t getNumThreadsPerThreadGroup() const override {
         return 1;
     }
+    uint64_t getIsaOffsetInParentAllocation() const override {
+        return 0lu;
+    }
 
     void expectAnyMockFunctionCall();
 
@@ -46,6 +46,19 @@ __kernel void CopyBufferToBufferMiddle(
     vstore4(loaded, gid, pDst);
 }
 
+__kernel void CopyBufferToBufferMiddleWide(
+    const __global uint* pSrc,
+    __global uint* pDst,
+    uint srcOffsetInBytes,
+    uint dstOffsetInBytes)
+{
+    unsigned int gid = get_global_id(0);
+    pDst += dstOffsetInBytes >> 2;
+    pSrc += srcOffsetInBytes >> 2;
+    uint16 loaded = vload16(gid, pSrc);
+    vstore16(loaded, gid, pDst);
+}
+
 __kernel void CopyBufferToBufferMiddleMisaligned(
     __global const uint* pSrc,
      __global uint* pDst,
@@ -145,6 +158,19 @@ __kernel void FillBufferMiddle(
     ((__global uint*)(pDst + dstOffsetInBytes))[gid] = pPattern[ gid & (patternSizeInEls - 1) ];
 }
 
+__kernel void FillBufferMiddleWide(
+    __global uchar* pDst,
+    uint dstOffsetInBytes,
+    const __global uint* pPattern,
+    const uint patternSizeInEls )
+{
+    uint firstEl = get_global_id(0) * 16;
+    __global uint* pDstWide = (__global uint*)(pDst + dstOffsetInBytes) + firstEl;
+    for (uint i = 0; i < 16; i++) {
+        pDstWide[i] = pPattern[ (firstEl + i) & (patternSizeInEls - 1) ];
+    }
+}
+
 __kernel void FillBufferRightLeftover(
     __global uchar* pDst,
     uint dstOffsetInBytes,
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,9 +8,11 @@
 #include "shared/source/compiler_interface/compiler_cache.h"
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/file_io.h"
 #include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/string.h"
+#include "shared/source/utilities/mapped_file.h"
 
 #include "opencl/source/compiler_interface/default_cl_cache_config.h"
 #include "opencl/test/unit_test/global_environment.h"
@@ -19,7 +21,10 @@
 #include "opencl/test/unit_test/mocks/mock_program.h"
 #include "test.h"
 
+#include "os_inc.h"
+
 #include <array>
+#include <cstdlib>
 #include <list>
 #include <memory>
 
@@ -36,12 +41,20 @@ class CompilerCacheMock : public CompilerCache {
     }
 
     std::unique_ptr<char[]> loadCachedBinary(const std::string kernelFileHash, size_t &cachedBinarySize) override {
+        loadInvoked++;
         return loadResult ? std::unique_ptr<char[]>{new char[1]} : nullptr;
     }
 
+    std::unique_ptr<MappedFile> loadCachedBinaryMapped(const std::string kernelFileHash) override {
+        loadMappedInvoked++;
+        return nullptr;
+    }
+
     bool cacheResult = false;
     uint32_t cacheInvoked = 0u;
     bool loadResult = false;
+    uint32_t loadInvoked = 0u;
+    uint32_t loadMappedInvoked = 0u;
 };
 
 TEST(HashGeneration, givenMisalignedBufferWhenPassedToUpdateFunctionThenProperPtrDataIsUsed) {
@@ -219,6 +232,26 @@ TEST(CompilerCacheHashTests, GivenCompilingOptionsWhenGettingCacheThenCorrectCac
     EXPECT_STREQ(hash.c_str(), hash2.c_str());
 }
 
+TEST(CompilerCacheHashTests, GivenSpecConstantsWhenHashingThenSpecConstantsAreIncludedInHash) {
+    HardwareInfo hwInfo;
+    const char src[] = "spirv";
+    const char options[] = "options";
+    const char internalOptions[] = "internal";
+    const uint64_t specConstants1[] = {1u, 10u};
+    const uint64_t specConstants2[] = {1u, 20u};
+
+    auto hashWithoutSpecConstants = CompilerCache::getCachedFileName(hwInfo, src, options, internalOptions);
+    auto hashWithEmptySpecConstants = CompilerCache::getCachedFileName(hwInfo, src, options, internalOptions, ArrayRef<const char>());
+    auto hashWithSpecConstants1 = CompilerCache::getCachedFileName(hwInfo, src, options, internalOptions,
+                                                                   ArrayRef<const char>(reinterpret_cast<const char *>(specConstants1), sizeof(specConstants1)));
+    auto hashWithSpecConstants2 = CompilerCache::getCachedFileName(hwInfo, src, options, internalOptions,
+                                                                   ArrayRef<const char>(reinterpret_cast<const char *>(specConstants2), sizeof(specConstants2)));
+
+    EXPECT_EQ(hashWithoutSpecConstants, hashWithEmptySpecConstants);
+    EXPECT_NE(hashWithoutSpecConstants, hashWithSpecConstants1);
+    EXPECT_NE(hashWithSpecConstants1, hashWithSpecConstants2);
+}
+
 TEST(CompilerCacheTests, GivenEmptyBinaryWhenCachingThenBinaryIsNotCached) {
     CompilerCache cache(CompilerCacheConfig{});
     bool ret = cache.cacheBinary("some_hash", nullptr, 12u);
@@ -253,6 +286,189 @@ TEST(CompilerCacheTests, GivenExistingConfigWhenLoadingFromCacheThenBinaryIsLoad
     EXPECT_NE(0U, size);
 }
 
+class CompilerCacheWhiteBox : public CompilerCache {
+  public:
+    using CompilerCache::CompilerCache;
+    using CompilerCache::getCachedFilePath;
+    using CompilerCache::getIndexFilePath;
+    using CompilerCache::loadIndex;
+};
+
+std::string getTemporaryCacheDir() {
+    static const std::string temporaryCacheDir = [] {
+        const char *baseDir = nullptr;
+        for (auto envName : {"TMPDIR", "TEMP", "TMP"}) {
+            baseDir = std::getenv(envName);
+            if (baseDir != nullptr) {
+                break;
+            }
+        }
+        std::string cacheDir = std::string(baseDir != nullptr ? baseDir : "/tmp") + PATH_SEPARATOR + "compiler_cache_tests" + CompilerCacheOsHelper::getUniqueFileSuffix();
+        CompilerCacheOsHelper::createDirectory(cacheDir);
+        return cacheDir;
+    }();
+    return temporaryCacheDir;
+}
+
+CompilerCacheConfig getSizeLimitedCacheConfig(const std::string &subDir, uint64_t cacheSize) {
+    auto config = getDefaultClCompilerCacheConfig();
+    config.cacheDir = getTemporaryCacheDir() + PATH_SEPARATOR + subDir;
+    config.cacheSize = cacheSize;
+    CompilerCacheOsHelper::createDirectory(config.cacheDir);
+    return config;
+}
+
+TEST(CompilerCacheTests, GivenKernelFileHashWhenCachingThenBinaryIsStoredInShardSubdirectory) {
+    auto config = getSizeLimitedCacheConfig("shard", 0u);
+    CompilerCacheWhiteBox cache(config);
+    static const char *hash = "ab_SHARD_HASH";
+    const char data[16] = {};
+
+    EXPECT_TRUE(cache.cacheBinary(hash, data, sizeof(data)));
+
+    std::string expectedPath = config.cacheDir + PATH_SEPARATOR + "ab" + PATH_SEPARATOR + hash + ".cl_cache";
+    EXPECT_EQ(expectedPath, cache.getCachedFilePath(hash));
+    EXPECT_TRUE(fileExists(expectedPath));
+
+    size_t size = 0;
+    auto loadedBin = cache.loadCachedBinary(hash, size);
+    EXPECT_NE(nullptr, loadedBin);
+    EXPECT_EQ(sizeof(data), size);
+}
+
+TEST(CompilerCacheTests, GivenBinaryBiggerThanMaxCacheSizeWhenCachingThenBinaryIsNotCached) {
+    CompilerCacheWhiteBox cache(getSizeLimitedCacheConfig("too_big", 8u));
+    const char data[16] = {};
+
+    EXPECT_FALSE(cache.cacheBinary("too_big_hash", data, sizeof(data)));
+    EXPECT_FALSE(fileExists(cache.getCachedFilePath("too_big_hash")));
+}
+
+TEST(CompilerCacheTests, GivenMaxCacheSizeWhenCacheIsFullThenLeastRecentlyUsedEntryIsEvicted) {
+    CompilerCacheWhiteBox cache(getSizeLimitedCacheConfig("lru_eviction", 32u));
+    const char data[16] = {};
+    std::remove(cache.getIndexFilePath().c_str());
+
+    EXPECT_TRUE(cache.cacheBinary("first_hash", data, sizeof(data)));
+    EXPECT_TRUE(cache.cacheBinary("second_hash", data, sizeof(data)));
+
+    size_t size = 0;
+    EXPECT_NE(nullptr, cache.loadCachedBinary("first_hash", size));
+
+    EXPECT_TRUE(cache.cacheBinary("third_hash", data, sizeof(data)));
+
+    EXPECT_TRUE(fileExists(cache.getCachedFilePath("first_hash")));
+    EXPECT_FALSE(fileExists(cache.getCachedFilePath("second_hash")));
+    EXPECT_TRUE(fileExists(cache.getCachedFilePath("third_hash")));
+
+    std::vector<CompilerCacheIndexEntry> entries;
+    uint64_t lastAccess = 0u;
+    EXPECT_TRUE(CompilerCacheWhiteBox::loadIndex(cache.getIndexFilePath(), entries, lastAccess));
+    EXPECT_EQ(2u, entries.size());
+    EXPECT_EQ(3u, lastAccess);
+    uint64_t totalSize = 0u;
+    for (const auto &entry : entries) {
+        EXPECT_NE(std::string("second_hash"), entry.kernelFileHash);
+        totalSize += entry.fileSize;
+    }
+    EXPECT_LE(totalSize, 32u);
+}
+
+TEST(CompilerCacheTests, GivenEvictedEntryWhenCacheIsFullThenEntryLockFileIsRemoved) {
+    CompilerCacheWhiteBox cache(getSizeLimitedCacheConfig("lock_removed", 16u));
+    const char data[16] = {};
+    std::remove(cache.getIndexFilePath().c_str());
+
+    EXPECT_TRUE(cache.cacheBinary("evicted_hash", data, sizeof(data)));
+    EXPECT_TRUE(cache.cacheBinary("kept_hash", data, sizeof(data)));
+
+    EXPECT_FALSE(fileExists(cache.getCachedFilePath("evicted_hash")));
+    EXPECT_FALSE(fileExists(cache.getCachedFilePath("evicted_hash") + ".lock"));
+    EXPECT_TRUE(fileExists(cache.getCachedFilePath("kept_hash")));
+}
+
+TEST(CompilerCacheTests, GivenLockedEntryWhenCacheIsFullThenLockedEntryIsSkippedByEviction) {
+    CompilerCacheWhiteBox cache(getSizeLimitedCacheConfig("locked_entry", 16u));
+    const char data[16] = {};
+    std::remove(cache.getIndexFilePath().c_str());
+
+    EXPECT_TRUE(cache.cacheBinary("locked_hash", data, sizeof(data)));
+    {
+        CompilerCacheFileLock entryLock(cache.getCachedFilePath("locked_hash") + ".lock");
+        ASSERT_TRUE(entryLock.isLocked());
+        EXPECT_TRUE(cache.cacheBinary("other_hash", data, sizeof(data)));
+    }
+
+    EXPECT_TRUE(fileExists(cache.getCachedFilePath("locked_hash")));
+    EXPECT_TRUE(fileExists(cache.getCachedFilePath("locked_hash") + ".lock"));
+    EXPECT_FALSE(fileExists(cache.getCachedFilePath("other_hash")));
+}
+
+TEST(CompilerCacheTests, GivenUnlimitedCacheSizeWhenCachingThenIndexFileIsNotCreated) {
+    CompilerCacheWhiteBox cache(getSizeLimitedCacheConfig("no_index", 0u));
+    const char data[16] = {};
+
+    EXPECT_TRUE(cache.cacheBinary("no_index_hash", data, sizeof(data)));
+    EXPECT_FALSE(fileExists(cache.getIndexFilePath()));
+}
+
+TEST(CompilerCacheTests, GivenCachedBinaryWhenLoadingMappedThenMappedDataMatchesCachedBinary) {
+    CompilerCacheWhiteBox cache(getDefaultClCompilerCacheConfig());
+    static const char *hash = "MAPPED_HASH";
+    char data[32];
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = static_cast<char>(i);
+    }
+
+    EXPECT_TRUE(cache.cacheBinary(hash, data, sizeof(data)));
+
+    auto mappedBinary = cache.loadCachedBinaryMapped(hash);
+    ASSERT_NE(nullptr, mappedBinary);
+    ASSERT_EQ(sizeof(data), mappedBinary->getData().size());
+    EXPECT_EQ(0, memcmp(data, mappedBinary->getData().begin(), sizeof(data)));
+}
+
+TEST(CompilerCacheTests, GivenNonExistingBinaryWhenLoadingMappedThenNullIsReturned) {
+    CompilerCache cache(getDefaultClCompilerCacheConfig());
+    EXPECT_EQ(nullptr, cache.loadCachedBinaryMapped("----do-not-exists----"));
+}
+
+TEST(CompilerCacheTests, GivenSizeLimitedCacheWhenLoadingMappedThenIndexIsNotRewritten) {
+    CompilerCacheWhiteBox cache(getSizeLimitedCacheConfig("mapped_index", 64u));
+    const char data[16] = {};
+    std::remove(cache.getIndexFilePath().c_str());
+
+    EXPECT_TRUE(cache.cacheBinary("mapped_index_hash", data, sizeof(data)));
+    auto storedTime = CompilerCacheOsHelper::getLastModificationTime(cache.getCachedFilePath("mapped_index_hash"));
+    EXPECT_NE(nullptr, cache.loadCachedBinaryMapped("mapped_index_hash"));
+    EXPECT_LE(storedTime, CompilerCacheOsHelper::getLastModificationTime(cache.getCachedFilePath("mapped_index_hash")));
+
+    std::vector<CompilerCacheIndexEntry> entries;
+    uint64_t lastAccess = 0u;
+    EXPECT_TRUE(CompilerCacheWhiteBox::loadIndex(cache.getIndexFilePath(), entries, lastAccess));
+    ASSERT_EQ(1u, entries.size());
+    EXPECT_EQ(1u, lastAccess);
+    EXPECT_EQ(1u, entries[0].lastAccess);
+}
+
+TEST(CompilerCacheFileLockTests, GivenNonExistingDirectoryWhenLockingThenLockIsNotAcquired) {
+    CompilerCacheFileLock fileLock("----do-not-exists----/file.lock");
+    EXPECT_FALSE(fileLock.isLocked());
+}
+
+TEST(CompilerCacheFileLockTests, GivenHeldLockWhenLockingWithoutBlockingThenLockIsNotAcquired) {
+    std::string lockFilePath = getTemporaryCacheDir() + PATH_SEPARATOR + "try_lock.lock";
+
+    {
+        CompilerCacheFileLock heldLock(lockFilePath);
+        ASSERT_TRUE(heldLock.isLocked());
+        CompilerCacheFileLock tryLock(lockFilePath, false);
+        EXPECT_FALSE(tryLock.isLocked());
+    }
+    CompilerCacheFileLock tryLock(lockFilePath, false);
+    EXPECT_TRUE(tryLock.isLocked());
+}
+
 TEST(CompilerInterfaceCachedTests, GivenNoCachedBinaryWhenBuildingThenErrorIsReturned) {
     TranslationInput inputArgs{IGC::CodeType::oclC, IGC::CodeType::oclGenBin};
 
@@ -311,6 +527,65 @@ TEST(CompilerInterfaceCachedTests, GivenCachedBinaryWhenBuildingThenSuccessIsRet
     gEnvironment->igcPopDebugVars();
 }
 
+TEST(CompilerInterfaceCachedTests, givenCacheLookupsWhenBuildingThenHitAndMissCountersAreUpdated) {
+    TranslationInput inputArgs{IGC::CodeType::oclC, IGC::CodeType::oclGenBin};
+
+    auto src = "__kernel k() {}";
+    inputArgs.src = ArrayRef<const char>(src, strlen(src));
+    inputArgs.allowCaching = true;
+
+    MockCompilerDebugVars fclDebugVars;
+    fclDebugVars.fileName = gEnvironment->fclGetMockFile();
+    fclDebugVars.forceBuildFailure = true;
+    gEnvironment->fclPushDebugVars(fclDebugVars);
+
+    auto cache = new CompilerCacheMock();
+    auto compilerInterface = std::unique_ptr<CompilerInterface>(CompilerInterface::createInstance(std::unique_ptr<CompilerCache>(cache), true));
+    MockDevice device;
+    EXPECT_EQ(0u, compilerInterface->getCacheHitsCount());
+    EXPECT_EQ(0u, compilerInterface->getCacheMissesCount());
+
+    TranslationOutput missOutput;
+    EXPECT_EQ(TranslationOutput::ErrorCode::BuildFailure, compilerInterface->build(device, inputArgs, missOutput));
+    EXPECT_EQ(0u, compilerInterface->getCacheHitsCount());
+    EXPECT_EQ(1u, compilerInterface->getCacheMissesCount());
+
+    cache->loadResult = true;
+    TranslationOutput hitOutput;
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, compilerInterface->build(device, inputArgs, hitOutput));
+    EXPECT_EQ(1u, compilerInterface->getCacheHitsCount());
+    EXPECT_EQ(1u, compilerInterface->getCacheMissesCount());
+
+    gEnvironment->fclPopDebugVars();
+}
+
+TEST(CompilerInterfaceCachedTests, givenMappedCachedBinaryAllowedWhenBuildingThenCacheIsLoadedThroughMapping) {
+    TranslationInput inputArgs{IGC::CodeType::oclC, IGC::CodeType::oclGenBin};
+
+    auto src = "__kernel k() {}";
+    inputArgs.src = ArrayRef<const char>(src, strlen(src));
+
+    MockCompilerDebugVars fclDebugVars;
+    fclDebugVars.fileName = gEnvironment->fclGetMockFile();
+    fclDebugVars.forceBuildFailure = true;
+    gEnvironment->fclPushDebugVars(fclDebugVars);
+
+    auto cache = new CompilerCacheMock();
+    cache->loadResult = true;
+    auto compilerInterface = std::unique_ptr<CompilerInterface>(CompilerInterface::createInstance(std::unique_ptr<CompilerCache>(cache), true));
+    TranslationOutput translationOutput;
+    inputArgs.allowCaching = true;
+    inputArgs.allowMappedCachedBinary = true;
+    MockDevice device;
+    auto retVal = compilerInterface->build(device, inputArgs, translationOutput);
+    EXPECT_EQ(TranslationOutput::ErrorCode::BuildFailure, retVal);
+    EXPECT_EQ(1u, cache->loadMappedInvoked);
+    EXPECT_EQ(0u, cache->loadInvoked);
+    EXPECT_EQ(nullptr, translationOutput.mappedDeviceBinary);
+
+    gEnvironment->fclPopDebugVars();
+}
+
 TEST(CompilerInterfaceCachedTests, givenKernelWithoutIncludesAndBinaryInCacheWhenCompilationRequestedThenFCLIsNotCalled) {
     MockClDevice device{new MockDevice};
     MockContext context(&device, true);
@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_jobs_queue.h"
+
+#include "test.h"
+
+#include <atomic>
+#include <thread>
+
+using namespace NEO;
+
+TEST(CompilerJobsQueueTests, GivenZeroWorkersWhenCreatingQueueThenOneWorkerIsUsed) {
+    CompilerJobsQueue queue(0U);
+    EXPECT_EQ(1U, queue.getNumWorkers());
+}
+
+TEST(CompilerJobsQueueTests, WhenGettingDefaultNumberOfWorkersThenItIsWithinLimits) {
+    auto numWorkers = CompilerJobsQueue::getDefaultNumWorkers();
+    EXPECT_LE(1U, numWorkers);
+    EXPECT_GE(CompilerJobsQueue::maxWorkers, numWorkers);
+}
+
+TEST(CompilerJobsQueueTests, GivenNoJobsEnqueuedThenDispatcherIsNotCreatedAndDrainReturnsImmediately) {
+    CompilerJobsQueue queue(2U);
+    queue.drain();
+    EXPECT_FALSE(queue.isDispatcherCreated());
+}
+
+TEST(CompilerJobsQueueTests, GivenEnqueuedJobsWhenDrainingThenAllJobsAreExecutedOnWorkerThreads) {
+    CompilerJobsQueue queue(2U);
+    std::atomic<uint32_t> jobsExecuted{0U};
+    std::atomic<uint32_t> jobsOnCallerThread{0U};
+    auto callerThreadId = std::this_thread::get_id();
+
+    constexpr uint32_t numJobs = 16U;
+    for (uint32_t i = 0; i < numJobs; ++i) {
+        queue.enqueue([&] {
+            if (std::this_thread::get_id() == callerThreadId) {
+                ++jobsOnCallerThread;
+            }
+            ++jobsExecuted;
+        });
+    }
+    queue.drain();
+
+    EXPECT_EQ(numJobs, jobsExecuted.load());
+    EXPECT_EQ(0U, jobsOnCallerThread.load());
+    EXPECT_TRUE(queue.isDispatcherCreated());
+}
+
+TEST(CompilerJobsQueueTests, GivenPendingJobsWhenQueueIsDestroyedThenPendingJobsAreCompletedFirst) {
+    std::atomic<uint32_t> jobsExecuted{0U};
+    {
+        CompilerJobsQueue queue(1U);
+        for (uint32_t i = 0; i < 4U; ++i) {
+            queue.enqueue([&] { ++jobsExecuted; });
+        }
+    }
+    EXPECT_EQ(4U, jobsExecuted.load());
+}
+
+TEST(CompilerJobsQueueTests, GivenJobEnqueuingAnotherJobWhenDrainingThenBothJobsAreExecuted) {
+    CompilerJobsQueue queue(1U);
+    std::atomic<uint32_t> jobsExecuted{0U};
+    queue.enqueue([&] {
+        queue.enqueue([&] { ++jobsExecuted; });
+        ++jobsExecuted;
+    });
+    queue.drain();
+    EXPECT_EQ(2U, jobsExecuted.load());
+}
+
+TEST(CompilerJobsQueueTests, GivenJobWithRetireFunctionWhenJobCompletesThenRetireIsRunOnlyWhenRetiringOnCallerThread) {
+    CompilerJobsQueue queue(2U);
+    std::atomic<uint32_t> retireCalls{0U};
+    std::atomic<bool> retiredOnCallerThread{false};
+    auto callerThreadId = std::this_thread::get_id();
+    std::atomic<bool> jobDone{false};
+
+    queue.enqueue([&] { jobDone = true; },
+                  [&] {
+                      retiredOnCallerThread = (std::this_thread::get_id() == callerThreadId);
+                      ++retireCalls;
+                  });
+    while (false == jobDone) {
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(0U, retireCalls.load());
+
+    queue.drain();
+    EXPECT_EQ(1U, retireCalls.load());
+    EXPECT_TRUE(retiredOnCallerThread);
+
+    queue.retireCompletedJobs();
+    EXPECT_EQ(1U, retireCalls.load());
+}
+
+TEST(CompilerJobsQueueTests, GivenJobRetiringCompletedJobsWhenItRunsThenRetireFunctionsAreNotRunOnCompilerThread) {
+    CompilerJobsQueue queue(1U);
+    std::atomic<uint32_t> retireCalls{0U};
+    std::atomic<uint32_t> retireCallsOnCompilerThread{0U};
+    auto callerThreadId = std::this_thread::get_id();
+    auto retire = [&] {
+        if (std::this_thread::get_id() != callerThreadId) {
+            ++retireCallsOnCompilerThread;
+        }
+        ++retireCalls;
+    };
+
+    for (uint32_t i = 0; i < 8U; ++i) {
+        queue.enqueue([] {}, retire);
+        queue.enqueue([&] { queue.retireCompletedJobs(); });
+    }
+    queue.drain();
+    EXPECT_EQ(8U, retireCalls.load());
+    EXPECT_EQ(0U, retireCallsOnCompilerThread.load());
+}
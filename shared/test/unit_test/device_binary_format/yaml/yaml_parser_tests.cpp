@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -226,6 +226,18 @@ TEST(YamlConsumeNameIdentifier, GivenNameIdentifierBeginningCharacterThenConsume
     }
 }
 
+TEST(YamlConsumeSpaces, GivenSpacesThenConsumeAllConsecutiveSpaces) {
+    ConstStringRef noSpaces = "abc";
+    ConstStringRef leadingSpaces = "    abc";
+    ConstStringRef onlySpaces = "   ";
+    ConstStringRef spacesAndTab = "  \tabc";
+
+    EXPECT_EQ(noSpaces.begin(), NEO::Yaml::consumeSpaces(noSpaces.begin(), noSpaces.end()));
+    EXPECT_EQ(leadingSpaces.begin() + 4, NEO::Yaml::consumeSpaces(leadingSpaces.begin(), leadingSpaces.end()));
+    EXPECT_EQ(onlySpaces.end(), NEO::Yaml::consumeSpaces(onlySpaces.begin(), onlySpaces.end()));
+    EXPECT_EQ(spacesAndTab.begin() + 2, NEO::Yaml::consumeSpaces(spacesAndTab.begin(), spacesAndTab.end()));
+}
+
 TEST(YamlConsumeStringLiteral, GivenQuotedStringThenConsumeUntilEndingMarkIsMet) {
     ConstStringRef notQuoted = "a+5";
     ConstStringRef singleQuote = "\'abc de fg\'ijkl";
@@ -378,6 +390,39 @@ TEST(YamlTokenize, GivenTabsAsIndentThenEmitsWarning) {
     EXPECT_STREQ("NEO::Yaml : Tabs used as indent at line : 0\nNEO::Yaml : text tokenized to 0 tokens\n", warnings.c_str());
 }
 
+TEST(YamlTokenize, GivenIndentedLinesThenIndentIsCountedInSpaces) {
+    NEO::Yaml::LinesCache lines;
+    NEO::Yaml::TokensCache tokens;
+    std::string warnings;
+    std::string errors;
+    bool success = NEO::Yaml::tokenize("a:\n  b:\n        c: d   e\n", lines, tokens, errors, warnings);
+    EXPECT_TRUE(success);
+    ASSERT_EQ(3U, lines.size());
+    EXPECT_EQ(0U, lines[0].indent);
+    EXPECT_EQ(2U, lines[1].indent);
+    EXPECT_EQ(8U, lines[2].indent);
+    EXPECT_TRUE(errors.empty()) << errors;
+    EXPECT_TRUE(warnings.empty()) << warnings;
+}
+
+TEST(YamlTokenize, GivenTextWithManyLinesThenCachesAreReservedUpFront) {
+    std::string text;
+    constexpr size_t linesCount = 1024U;
+    for (size_t i = 0; i < linesCount; ++i) {
+        text += "key : value\n";
+    }
+    NEO::Yaml::LinesCache lines;
+    NEO::Yaml::TokensCache tokens;
+    std::string warnings;
+    std::string errors;
+    bool success = NEO::Yaml::tokenize(text, lines, tokens, errors, warnings);
+    EXPECT_TRUE(success);
+    EXPECT_EQ(linesCount, lines.size());
+    EXPECT_EQ(linesCount * 4U, tokens.size());
+    EXPECT_LE(linesCount + 1, lines.capacity());
+    EXPECT_LE((linesCount + 1) * NEO::Yaml::estimatedTokensPerLine, tokens.capacity());
+}
+
 TEST(YamlTokenize, WhenTextDoesNotEndWithNewlineThenEmitsWarning) {
     NEO::Yaml::LinesCache lines;
     NEO::Yaml::TokensCache tokens;
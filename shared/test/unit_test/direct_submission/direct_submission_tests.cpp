@@ -58,6 +58,33 @@ HWTEST_F(DirectSubmissionTest, whenDebugCacheFlushDisabledNotSetThenExpectCpuCac
     EXPECT_EQ(expectedPtrVal, lastClFlushedPtr);
 }
 
+HWTEST_F(DirectSubmissionTest, givenClflushCachelineFlushModeWhenDirectSubmissionIsCreatedThenClflushWithoutFenceIsUsed) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.DirectSubmissionCpuCachelineFlushMode.set(0);
+
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
+                                                                                      *osContext.get());
+    EXPECT_EQ(&CpuIntrinsics::clFlush, directSubmission.cpuCachelineFlushFunc);
+    EXPECT_FALSE(directSubmission.cpuCachelineFlushFence);
+}
+
+HWTEST_F(DirectSubmissionTest, givenWeaklyOrderedCachelineFlushWhenFlushingRangeThenEveryLineIsFlushedAndSingleFenceIsIssued) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.DirectSubmissionDisableCpuCacheFlush.set(0);
+
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
+                                                                                      *osContext.get());
+    directSubmission.cpuCachelineFlushFunc = CpuIntrinsics::clWb;
+    directSubmission.cpuCachelineFlushFence = true;
+
+    uint32_t clWbCountBefore = clWbCounter.load();
+    uint32_t sfenceCountBefore = sfenceCounter.load();
+    void *ptr = reinterpret_cast<void *>(0xABCD00u);
+    directSubmission.cpuCachelineFlush(ptr, 3 * MemoryConstants::cacheLineSize);
+    EXPECT_EQ(clWbCountBefore + 3, clWbCounter);
+    EXPECT_EQ(sfenceCountBefore + 1, sfenceCounter);
+}
+
 HWTEST_F(DirectSubmissionTest, givenDirectSubmissionInitializedWhenRingIsStartedThenExpectAllocationsCreatedAndCommandsDispatched) {
     MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
                                                                                       *osContext.get());
@@ -67,8 +94,8 @@ HWTEST_F(DirectSubmissionTest, givenDirectSubmissionInitializedWhenRingIsStarted
     EXPECT_TRUE(ret);
     EXPECT_TRUE(directSubmission.ringStart);
 
-    EXPECT_NE(nullptr, directSubmission.ringBuffer);
-    EXPECT_NE(nullptr, directSubmission.ringBuffer2);
+    EXPECT_NE(nullptr, directSubmission.ringBuffers[0].ringBuffer);
+    EXPECT_NE(nullptr, directSubmission.ringBuffers[1].ringBuffer);
     EXPECT_NE(nullptr, directSubmission.semaphores);
 
     EXPECT_NE(0u, directSubmission.ringCommandStream.getUsed());
@@ -82,43 +109,97 @@ HWTEST_F(DirectSubmissionTest, givenDirectSubmissionInitializedWhenRingIsNotStar
     EXPECT_TRUE(ret);
     EXPECT_FALSE(directSubmission.ringStart);
 
-    EXPECT_NE(nullptr, directSubmission.ringBuffer);
-    EXPECT_NE(nullptr, directSubmission.ringBuffer2);
+    EXPECT_NE(nullptr, directSubmission.ringBuffers[0].ringBuffer);
+    EXPECT_NE(nullptr, directSubmission.ringBuffers[1].ringBuffer);
     EXPECT_NE(nullptr, directSubmission.semaphores);
 
     EXPECT_EQ(0u, directSubmission.ringCommandStream.getUsed());
 }
 
 HWTEST_F(DirectSubmissionTest, givenDirectSubmissionSwitchBuffersWhenCurrentIsPrimaryThenExpectNextSecondary) {
-    using RingBufferUse = typename MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>>::RingBufferUse;
     MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
                                                                                       *osContext.get());
 
     bool ret = directSubmission.initialize(false);
     EXPECT_TRUE(ret);
-    EXPECT_EQ(RingBufferUse::FirstBuffer, directSubmission.currentRingBuffer);
+    EXPECT_EQ(0u, directSubmission.currentRingBuffer);
 
     GraphicsAllocation *nextRing = directSubmission.switchRingBuffersAllocations();
-    EXPECT_EQ(directSubmission.ringBuffer2, nextRing);
-    EXPECT_EQ(RingBufferUse::SecondBuffer, directSubmission.currentRingBuffer);
+    EXPECT_EQ(directSubmission.ringBuffers[1].ringBuffer, nextRing);
+    EXPECT_EQ(1u, directSubmission.currentRingBuffer);
 }
 
 HWTEST_F(DirectSubmissionTest, givenDirectSubmissionSwitchBuffersWhenCurrentIsSecondaryThenExpectNextPrimary) {
-    using RingBufferUse = typename MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>>::RingBufferUse;
     MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
                                                                                       *osContext.get());
 
     bool ret = directSubmission.initialize(false);
     EXPECT_TRUE(ret);
-    EXPECT_EQ(RingBufferUse::FirstBuffer, directSubmission.currentRingBuffer);
+    EXPECT_EQ(0u, directSubmission.currentRingBuffer);
 
     GraphicsAllocation *nextRing = directSubmission.switchRingBuffersAllocations();
-    EXPECT_EQ(directSubmission.ringBuffer2, nextRing);
-    EXPECT_EQ(RingBufferUse::SecondBuffer, directSubmission.currentRingBuffer);
+    EXPECT_EQ(directSubmission.ringBuffers[1].ringBuffer, nextRing);
+    EXPECT_EQ(1u, directSubmission.currentRingBuffer);
 
     nextRing = directSubmission.switchRingBuffersAllocations();
-    EXPECT_EQ(directSubmission.ringBuffer, nextRing);
-    EXPECT_EQ(RingBufferUse::FirstBuffer, directSubmission.currentRingBuffer);
+    EXPECT_EQ(directSubmission.ringBuffers[0].ringBuffer, nextRing);
+    EXPECT_EQ(0u, directSubmission.currentRingBuffer);
+}
+
+HWTEST_F(DirectSubmissionTest, givenAllRingBuffersInUseWhenSwitchingRingBuffersThenNewRingBufferIsAllocatedUpToMaxCount) {
+    MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
+                                                                                      *osContext.get());
+    directSubmission.maxRingBufferCount = 3u;
+
+    bool ret = directSubmission.initialize(false);
+    EXPECT_TRUE(ret);
+    EXPECT_EQ(2u, directSubmission.ringBuffers.size());
+
+    directSubmission.isCompletedReturn = false;
+    GraphicsAllocation *nextRing = directSubmission.switchRingBuffersAllocations();
+    EXPECT_EQ(3u, directSubmission.ringBuffers.size());
+    EXPECT_EQ(2u, directSubmission.currentRingBuffer);
+    EXPECT_EQ(directSubmission.ringBuffers[2].ringBuffer, nextRing);
+    EXPECT_NE(directSubmission.ringBuffers[0].ringBuffer, nextRing);
+    EXPECT_NE(directSubmission.ringBuffers[1].ringBuffer, nextRing);
+    EXPECT_EQ(0u, directSubmission.ringBuffersExhaustedCount);
+
+    nextRing = directSubmission.switchRingBuffersAllocations();
+    EXPECT_EQ(3u, directSubmission.ringBuffers.size());
+    EXPECT_EQ(0u, directSubmission.currentRingBuffer);
+    EXPECT_EQ(directSubmission.ringBuffers[0].ringBuffer, nextRing);
+    EXPECT_EQ(1u, directSubmission.ringBuffersExhaustedCount);
+
+    directSubmission.isCompletedReturn = true;
+    nextRing = directSubmission.switchRingBuffersAllocations();
+    EXPECT_EQ(3u, directSubmission.ringBuffers.size());
+    EXPECT_EQ(1u, directSubmission.currentRingBuffer);
+    EXPECT_EQ(directSubmission.ringBuffers[1].ringBuffer, nextRing);
+    EXPECT_EQ(1u, directSubmission.ringBuffersExhaustedCount);
+}
+
+HWTEST_F(DirectSubmissionTest, givenMaxRingBuffersDebugFlagWhenCreatingDirectSubmissionThenMaxRingBufferCountIsOverriddenAndNotLowerThanInitialCount) {
+    using RingBufferUse = typename MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>>::RingBufferUse;
+    DebugManagerStateRestore restorer;
+    {
+        MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
+                                                                                          *osContext.get());
+        EXPECT_EQ(RingBufferUse::defaultMaxRingBufferCount, directSubmission.maxRingBufferCount);
+    }
+
+    DebugManager.flags.DirectSubmissionMaxRingBuffers.set(5);
+    {
+        MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
+                                                                                          *osContext.get());
+        EXPECT_EQ(5u, directSubmission.maxRingBufferCount);
+    }
+
+    DebugManager.flags.DirectSubmissionMaxRingBuffers.set(1);
+    {
+        MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
+                                                                                          *osContext.get());
+        EXPECT_EQ(RingBufferUse::initialRingBufferCount, directSubmission.maxRingBufferCount);
+    }
 }
 HWTEST_F(DirectSubmissionTest, givenDirectSubmissionAllocateFailWhenRingIsStartedThenExpectRingNotStarted) {
     MockDirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>> directSubmission(*pDevice,
@@ -653,8 +734,8 @@ HWTEST_F(DirectSubmissionTest, whenDirectSubmissionInitializedThenExpectCreatedA
     bool ret = directSubmission->initialize(false);
     EXPECT_TRUE(ret);
 
-    GraphicsAllocation *nulledAllocation = directSubmission->ringBuffer;
-    directSubmission->ringBuffer = nullptr;
+    GraphicsAllocation *nulledAllocation = directSubmission->ringBuffers[0].ringBuffer;
+    directSubmission->ringBuffers[0].ringBuffer = nullptr;
     directSubmission.reset(nullptr);
     memoryManager->freeGraphicsMemory(nulledAllocation);
 
@@ -664,8 +745,8 @@ HWTEST_F(DirectSubmissionTest, whenDirectSubmissionInitializedThenExpectCreatedA
     ret = directSubmission->initialize(false);
     EXPECT_TRUE(ret);
 
-    nulledAllocation = directSubmission->ringBuffer2;
-    directSubmission->ringBuffer2 = nullptr;
+    nulledAllocation = directSubmission->ringBuffers[1].ringBuffer;
+    directSubmission->ringBuffers[1].ringBuffer = nullptr;
     directSubmission.reset(nullptr);
     memoryManager->freeGraphicsMemory(nulledAllocation);
 
@@ -8,6 +8,7 @@
 #include "shared/source/direct_submission/dispatchers/render_dispatcher.h"
 #include "shared/source/direct_submission/linux/drm_direct_submission.h"
 #include "shared/source/os_interface/linux/os_context_linux.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/ult_hw_config.h"
 #include "shared/test/common/mocks/mock_device.h"
 
@@ -30,6 +31,7 @@ struct DrmDirectSubmissionTest : public DrmMemoryManagerBasic {
         osContext = std::make_unique<OsContextLinux>(*executionEnvironment.rootDeviceEnvironments[0]->osInterface->get()->getDrm(),
                                                      0u, device->getDeviceBitfield(), EngineTypeUsage{aub_stream::ENGINE_RCS, EngineUsage::Regular}, PreemptionMode::ThreadGroup,
                                                      false);
+        osContext->ensureContextInitialized();
     }
 
     void TearDown() override {
@@ -48,10 +50,17 @@ struct MockDrmDirectSubmission : public DrmDirectSubmission<GfxFamily, Dispatche
     using BaseClass::DrmDirectSubmission;
     using BaseClass::getTagAddressValue;
     using BaseClass::handleResidency;
+    using BaseClass::isCompleted;
+    using BaseClass::maxRingBufferCount;
+    using BaseClass::ringBuffers;
+    using BaseClass::ringBuffersExhaustedCount;
     using BaseClass::submit;
     using BaseClass::switchRingBuffers;
     using BaseClass::tagAddress;
     using BaseClass::updateTagValue;
+    using BaseClass::wait;
+    using BaseClass::waitPolicy;
+    using BaseClass::waitStatistics;
 };
 
 using namespace NEO;
@@ -78,6 +87,82 @@ HWTEST_F(DrmDirectSubmissionTest, givenDrmDirectSubmissionWhenCallingLinuxImplem
     EXPECT_EQ(drmDirectSubmission.currentTagData.tagValue + 1, tagData.tagValue);
 }
 
+HWTEST_F(DrmDirectSubmissionTest, givenRingBufferCompletionFenceWhenCheckingCompletionThenTagAddressValueIsCompared) {
+    MockDrmDirectSubmission<FamilyType, RenderDispatcher<FamilyType>> drmDirectSubmission(*device.get(),
+                                                                                          *osContext.get());
+
+    EXPECT_TRUE(drmDirectSubmission.allocateResources());
+    EXPECT_TRUE(drmDirectSubmission.isCompleted(0u));
+
+    drmDirectSubmission.ringBuffers[0].completionFence = 2ull;
+    *drmDirectSubmission.tagAddress = 1u;
+    EXPECT_FALSE(drmDirectSubmission.isCompleted(0u));
+
+    *drmDirectSubmission.tagAddress = 2u;
+    EXPECT_TRUE(drmDirectSubmission.isCompleted(0u));
+}
+
+HWTEST_F(DrmDirectSubmissionTest, givenAllRingBuffersInUseWhenSwitchingRingBuffersThenRingBufferPoolGrowsUntilMaxCountIsReached) {
+    MockDrmDirectSubmission<FamilyType, RenderDispatcher<FamilyType>> drmDirectSubmission(*device.get(),
+                                                                                          *osContext.get());
+    drmDirectSubmission.maxRingBufferCount = 3u;
+
+    EXPECT_TRUE(drmDirectSubmission.allocateResources());
+    EXPECT_EQ(2u, drmDirectSubmission.ringBuffers.size());
+
+    *drmDirectSubmission.tagAddress = 0u;
+    for (auto &ringBuffer : drmDirectSubmission.ringBuffers) {
+        ringBuffer.completionFence = 1ull;
+    }
+
+    auto nextRingBuffer = drmDirectSubmission.switchRingBuffersAllocations();
+    EXPECT_EQ(3u, drmDirectSubmission.ringBuffers.size());
+    EXPECT_EQ(drmDirectSubmission.ringBuffers[2].ringBuffer, nextRingBuffer);
+    EXPECT_EQ(0u, drmDirectSubmission.ringBuffersExhaustedCount);
+
+    drmDirectSubmission.ringBuffers[2].completionFence = 1ull;
+    nextRingBuffer = drmDirectSubmission.switchRingBuffersAllocations();
+    EXPECT_EQ(3u, drmDirectSubmission.ringBuffers.size());
+    EXPECT_EQ(drmDirectSubmission.ringBuffers[0].ringBuffer, nextRingBuffer);
+    EXPECT_EQ(1u, drmDirectSubmission.ringBuffersExhaustedCount);
+
+    *drmDirectSubmission.tagAddress = 1u;
+    nextRingBuffer = drmDirectSubmission.switchRingBuffersAllocations();
+    EXPECT_EQ(3u, drmDirectSubmission.ringBuffers.size());
+    EXPECT_EQ(drmDirectSubmission.ringBuffers[1].ringBuffer, nextRingBuffer);
+    EXPECT_EQ(1u, drmDirectSubmission.ringBuffersExhaustedCount);
+}
+
+HWTEST_F(DrmDirectSubmissionTest, givenWaitPolicyDebugFlagsWhenCreatingDrmDirectSubmissionThenWaitPolicyIsOverridden) {
+    DebugManagerStateRestore restorer;
+    {
+        MockDrmDirectSubmission<FamilyType, RenderDispatcher<FamilyType>> drmDirectSubmission(*device.get(),
+                                                                                              *osContext.get());
+        EXPECT_EQ(WaitUtils::defaultSpinCount, drmDirectSubmission.waitPolicy.spinCount);
+        EXPECT_EQ(WaitUtils::defaultPauseCount, drmDirectSubmission.waitPolicy.pauseCount);
+        EXPECT_FALSE(drmDirectSubmission.waitPolicy.useUmwait);
+    }
+
+    DebugManager.flags.DirectSubmissionWaitSpinCount.set(0);
+    DebugManager.flags.DirectSubmissionWaitPauseCount.set(16);
+    DebugManager.flags.DirectSubmissionWaitUseUmwait.set(1);
+    MockDrmDirectSubmission<FamilyType, RenderDispatcher<FamilyType>> drmDirectSubmission(*device.get(),
+                                                                                          *osContext.get());
+    EXPECT_EQ(0u, drmDirectSubmission.waitPolicy.spinCount);
+    EXPECT_EQ(16u, drmDirectSubmission.waitPolicy.pauseCount);
+    EXPECT_EQ(WaitUtils::isUmwaitSupported(), drmDirectSubmission.waitPolicy.useUmwait);
+}
+
+HWTEST_F(DrmDirectSubmissionTest, givenTagValueAlreadyReachedWhenWaitingThenWaitStatisticsAreNotUpdated) {
+    MockDrmDirectSubmission<FamilyType, RenderDispatcher<FamilyType>> drmDirectSubmission(*device.get(),
+                                                                                          *osContext.get());
+    EXPECT_TRUE(drmDirectSubmission.allocateResources());
+
+    *drmDirectSubmission.tagAddress = 2u;
+    drmDirectSubmission.wait(2u);
+    EXPECT_EQ(0u, drmDirectSubmission.waitStatistics.waitCount);
+}
+
 HWTEST_F(DrmDirectSubmissionTest, whenCreateDirectSubmissionThenValidObjectIsReturned) {
     auto directSubmission = DirectSubmissionHw<FamilyType, RenderDispatcher<FamilyType>>::create(*device.get(),
                                                                                                  *osContext.get());
@@ -607,6 +607,37 @@ HWCMDTEST_F(IGFX_GEN8_CORE, CommandEncodeStatesTest, givenForceBtpPrefetchModeDe
     }
 }
 
+HWCMDTEST_F(IGFX_GEN8_CORE, CommandEncodeStatesTest, givenInterfaceDescriptorTemplateWhenDispatchingKernelTwiceThenKernelInvariantFieldsAreTakenFromTemplate) {
+    using INTERFACE_DESCRIPTOR_DATA = typename FamilyType::INTERFACE_DESCRIPTOR_DATA;
+    struct MockDispatchKernelEncoderWithTemplate : public MockDispatchKernelEncoder {
+        InterfaceDescriptorTemplate *getInterfaceDescriptorTemplate() override { return &iddTemplate; }
+        InterfaceDescriptorTemplate iddTemplate;
+    };
+
+    uint32_t dims[] = {2, 1, 1};
+    std::unique_ptr<MockDispatchKernelEncoderWithTemplate> dispatchInterface(new MockDispatchKernelEncoderWithTemplate());
+    dispatchInterface->kernelDescriptor.kernelAttributes.barrierCount = 1;
+
+    bool requiresUncachedMocs = false;
+    uint32_t partitionCount = 0;
+
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dims, false, false, dispatchInterface.get(), 0, false, pDevice,
+                                             NEO::PreemptionMode::Disabled, requiresUncachedMocs, partitionCount, false);
+    EXPECT_TRUE(dispatchInterface->iddTemplate.valid);
+
+    auto iddTemplate = reinterpret_cast<INTERFACE_DESCRIPTOR_DATA *>(dispatchInterface->iddTemplate.data);
+    EXPECT_TRUE(iddTemplate->getBarrierEnable());
+    iddTemplate->setKernelStartPointer(0x1000u);
+
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dims, false, false, dispatchInterface.get(), 0, false, pDevice,
+                                             NEO::PreemptionMode::Disabled, requiresUncachedMocs, partitionCount, false);
+
+    auto interfaceDescriptorData = static_cast<INTERFACE_DESCRIPTOR_DATA *>(cmdContainer->getIddBlock());
+    EXPECT_NE(0x1000u, interfaceDescriptorData[0].getKernelStartPointer());
+    EXPECT_EQ(0x1000u, interfaceDescriptorData[1].getKernelStartPointer());
+    EXPECT_TRUE(interfaceDescriptorData[1].getBarrierEnable());
+}
+
 HWCMDTEST_F(IGFX_GEN8_CORE, CommandEncodeStatesTest, givenCleanHeapsAndSlmNotChangedWhenDispatchKernelThenFlushNotAdded) {
     using PIPE_CONTROL = typename FamilyType::PIPE_CONTROL;
     uint32_t dims[] = {2, 1, 1};
@@ -806,6 +837,155 @@ HWTEST2_F(EncodeDispatchKernelTest, givenBindfulKernelWhenDispatchingKernelThenS
     EXPECT_NE(usedAfter, usedBefore);
 }
 
+HWTEST2_F(EncodeDispatchKernelTest, givenBindfulKernelWhenDispatchingItTwiceWithTheSameSurfaceStatesThenBindingTableIsReused, Platforms) {
+    using BINDING_TABLE_STATE = typename FamilyType::BINDING_TABLE_STATE;
+    uint32_t numBindingTable = 1;
+    BINDING_TABLE_STATE bindingTableState[2];
+    bindingTableState[0].sInit();
+    bindingTableState[1].sInit();
+
+    uint32_t dims[] = {1, 1, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+
+    dispatchInterface->kernelDescriptor.payloadMappings.bindingTable.numEntries = numBindingTable;
+    dispatchInterface->kernelDescriptor.payloadMappings.bindingTable.tableOffset = 0U;
+    dispatchInterface->kernelDescriptor.kernelAttributes.bufferAddressingMode = KernelDescriptor::BindfulAndStateless;
+
+    const uint8_t *sshData = reinterpret_cast<uint8_t *>(&bindingTableState[0]);
+    EXPECT_CALL(*dispatchInterface.get(), getSurfaceStateHeapData()).WillRepeatedly(::testing::Return(sshData));
+    EXPECT_CALL(*dispatchInterface.get(), getSurfaceStateHeapDataSize()).WillRepeatedly(::testing::Return(static_cast<uint32_t>(sizeof(BINDING_TABLE_STATE))));
+
+    bool requiresUncachedMocs = false;
+    uint32_t partitionCount = 0;
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dims, false, false, dispatchInterface.get(), 0, false, pDevice,
+                                             NEO::PreemptionMode::Disabled, requiresUncachedMocs, partitionCount, false);
+    auto usedAfterFirstDispatch = cmdContainer->getIndirectHeap(HeapType::SURFACE_STATE)->getUsed();
+
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dims, false, false, dispatchInterface.get(), 0, false, pDevice,
+                                             NEO::PreemptionMode::Disabled, requiresUncachedMocs, partitionCount, false);
+    EXPECT_EQ(usedAfterFirstDispatch, cmdContainer->getIndirectHeap(HeapType::SURFACE_STATE)->getUsed());
+
+    sshData = reinterpret_cast<uint8_t *>(&bindingTableState[1]);
+    bindingTableState[1].setSurfaceStatePointer(0x40);
+    EXPECT_CALL(*dispatchInterface.get(), getSurfaceStateHeapData()).WillRepeatedly(::testing::Return(sshData));
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dims, false, false, dispatchInterface.get(), 0, false, pDevice,
+                                             NEO::PreemptionMode::Disabled, requiresUncachedMocs, partitionCount, false);
+    EXPECT_NE(usedAfterFirstDispatch, cmdContainer->getIndirectHeap(HeapType::SURFACE_STATE)->getUsed());
+}
+
+HWTEST2_F(EncodeDispatchKernelTest, givenKernelDispatchedTwiceWithTheSameIndirectDataThenIndirectDataIsReused, Platforms) {
+    uint32_t dims[] = {1, 1, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+    memset(dispatchInterface->dataCrossThread, 0, sizeof(dispatchInterface->dataCrossThread));
+
+    bool requiresUncachedMocs = false;
+    uint32_t partitionCount = 0;
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dims, false, false, dispatchInterface.get(), 0, false, pDevice,
+                                             NEO::PreemptionMode::Disabled, requiresUncachedMocs, partitionCount, false);
+    auto usedAfterFirstDispatch = cmdContainer->getIndirectHeap(HeapType::INDIRECT_OBJECT)->getUsed();
+
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dims, false, false, dispatchInterface.get(), 0, false, pDevice,
+                                             NEO::PreemptionMode::Disabled, requiresUncachedMocs, partitionCount, false);
+    EXPECT_EQ(usedAfterFirstDispatch, cmdContainer->getIndirectHeap(HeapType::INDIRECT_OBJECT)->getUsed());
+
+    dispatchInterface->dataCrossThread[0] = 1u;
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dims, false, false, dispatchInterface.get(), 0, false, pDevice,
+                                             NEO::PreemptionMode::Disabled, requiresUncachedMocs, partitionCount, false);
+    EXPECT_NE(usedAfterFirstDispatch, cmdContainer->getIndirectHeap(HeapType::INDIRECT_OBJECT)->getUsed());
+}
+
+HWTEST2_F(EncodeDispatchKernelTest, givenReuseIndirectDataDisabledWhenDispatchingKernelTwiceThenIndirectDataIsCopiedAgain, Platforms) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.ReuseIndirectDataOfRepeatedDispatches.set(0);
+
+    uint32_t dims[] = {1, 1, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+    memset(dispatchInterface->dataCrossThread, 0, sizeof(dispatchInterface->dataCrossThread));
+
+    bool requiresUncachedMocs = false;
+    uint32_t partitionCount = 0;
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dims, false, false, dispatchInterface.get(), 0, false, pDevice,
+                                             NEO::PreemptionMode::Disabled, requiresUncachedMocs, partitionCount, false);
+    auto usedAfterFirstDispatch = cmdContainer->getIndirectHeap(HeapType::INDIRECT_OBJECT)->getUsed();
+
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dims, false, false, dispatchInterface.get(), 0, false, pDevice,
+                                             NEO::PreemptionMode::Disabled, requiresUncachedMocs, partitionCount, false);
+    EXPECT_NE(usedAfterFirstDispatch, cmdContainer->getIndirectHeap(HeapType::INDIRECT_OBJECT)->getUsed());
+}
+
+HWTEST2_F(EncodeDispatchKernelTest, givenKernelsAlternatingBetweenSamplersWhenDispatchedThenSamplerStatesCopiedEarlierAreReused, Platforms) {
+    using SAMPLER_STATE = typename FamilyType::SAMPLER_STATE;
+    using INTERFACE_DESCRIPTOR_DATA = typename FamilyType::INTERFACE_DESCRIPTOR_DATA;
+    SAMPLER_STATE samplerStates[2];
+    memset(&samplerStates[0], 2, sizeof(SAMPLER_STATE));
+    memset(&samplerStates[1], 3, sizeof(SAMPLER_STATE));
+
+    uint32_t dims[] = {1, 1, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+    dispatchInterface->kernelDescriptor.payloadMappings.samplerTable.numSamplers = 1u;
+    dispatchInterface->kernelDescriptor.payloadMappings.samplerTable.tableOffset = 0u;
+    dispatchInterface->kernelDescriptor.payloadMappings.samplerTable.borderColor = 0u;
+
+    bool requiresUncachedMocs = false;
+    uint32_t partitionCount = 0;
+    auto dispatchWithSampler = [&](SAMPLER_STATE &samplerState) {
+        EXPECT_CALL(*dispatchInterface.get(), getDynamicStateHeapData()).WillRepeatedly(::testing::Return(reinterpret_cast<uint8_t *>(&samplerState)));
+        EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dims, false, false, dispatchInterface.get(), 0, false, pDevice,
+                                                 NEO::PreemptionMode::Disabled, requiresUncachedMocs, partitionCount, false);
+        auto interfaceDescriptorData = static_cast<INTERFACE_DESCRIPTOR_DATA *>(cmdContainer->getIddBlock()) + cmdContainer->nextIddInBlock - 1;
+        return interfaceDescriptorData->getSamplerStatePointer();
+    };
+
+    auto firstSamplerOffset = dispatchWithSampler(samplerStates[0]);
+    auto secondSamplerOffset = dispatchWithSampler(samplerStates[1]);
+    EXPECT_NE(firstSamplerOffset, secondSamplerOffset);
+    auto usedAfterBothSamplers = cmdContainer->getIndirectHeap(HeapType::DYNAMIC_STATE)->getUsed();
+
+    EXPECT_EQ(firstSamplerOffset, dispatchWithSampler(samplerStates[0]));
+    EXPECT_EQ(secondSamplerOffset, dispatchWithSampler(samplerStates[1]));
+    EXPECT_EQ(usedAfterBothSamplers, cmdContainer->getIndirectHeap(HeapType::DYNAMIC_STATE)->getUsed());
+
+    DebugManagerStateRestore restore;
+    DebugManager.flags.ReuseSamplerStatesOfRepeatedDispatches.set(0);
+    EXPECT_NE(firstSamplerOffset, dispatchWithSampler(samplerStates[0]));
+}
+
+HWTEST2_F(EncodeDispatchKernelTest, givenMoreSamplersThanReusableEntriesWhenDispatchedThenOldestSamplerStatesAreEvicted, Platforms) {
+    using SAMPLER_STATE = typename FamilyType::SAMPLER_STATE;
+    using INTERFACE_DESCRIPTOR_DATA = typename FamilyType::INTERFACE_DESCRIPTOR_DATA;
+    // one more than the container keeps for reuse
+    constexpr size_t samplerCount = 9u;
+    SAMPLER_STATE samplerStates[samplerCount];
+    for (size_t i = 0; i < samplerCount; i++) {
+        memset(&samplerStates[i], static_cast<int>(i + 2), sizeof(SAMPLER_STATE));
+    }
+
+    uint32_t dims[] = {1, 1, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+    dispatchInterface->kernelDescriptor.payloadMappings.samplerTable.numSamplers = 1u;
+    dispatchInterface->kernelDescriptor.payloadMappings.samplerTable.tableOffset = 0u;
+    dispatchInterface->kernelDescriptor.payloadMappings.samplerTable.borderColor = 0u;
+
+    bool requiresUncachedMocs = false;
+    uint32_t partitionCount = 0;
+    auto dispatchWithSampler = [&](SAMPLER_STATE &samplerState) {
+        EXPECT_CALL(*dispatchInterface.get(), getDynamicStateHeapData()).WillRepeatedly(::testing::Return(reinterpret_cast<uint8_t *>(&samplerState)));
+        EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dims, false, false, dispatchInterface.get(), 0, false, pDevice,
+                                                 NEO::PreemptionMode::Disabled, requiresUncachedMocs, partitionCount, false);
+        auto interfaceDescriptorData = static_cast<INTERFACE_DESCRIPTOR_DATA *>(cmdContainer->getIddBlock()) + cmdContainer->nextIddInBlock - 1;
+        return interfaceDescriptorData->getSamplerStatePointer();
+    };
+
+    uint32_t samplerOffsets[samplerCount];
+    for (size_t i = 0; i < samplerCount; i++) {
+        samplerOffsets[i] = dispatchWithSampler(samplerStates[i]);
+    }
+
+    EXPECT_EQ(samplerOffsets[samplerCount - 1], dispatchWithSampler(samplerStates[samplerCount - 1]));
+    EXPECT_EQ(samplerOffsets[1], dispatchWithSampler(samplerStates[1]));
+    EXPECT_NE(samplerOffsets[0], dispatchWithSampler(samplerStates[0]));
+}
+
 HWTEST2_F(EncodeDispatchKernelTest, givenBindlessKernelWhenDispatchingKernelThenThenSshFromContainerIsNotUsed, Platforms) {
     using BINDING_TABLE_STATE = typename FamilyType::BINDING_TABLE_STATE;
     using INTERFACE_DESCRIPTOR_DATA = typename FamilyType::INTERFACE_DESCRIPTOR_DATA;
@@ -1292,3 +1472,58 @@ HWTEST_F(BindlessCommandEncodeStatesTest, givenBindlessModeDisabledelWithSampler
 
     EXPECT_EQ(std::find(cmdContainer->getResidencyContainer().begin(), cmdContainer->getResidencyContainer().end(), pDevice->getBindlessHeapsHelper()->getHeap(BindlessHeapsHelper::GLOBAL_DSH)->getGraphicsAllocation()), cmdContainer->getResidencyContainer().end());
 }
+
+HWTEST2_F(CommandEncodeStatesTest, givenKernelsWithSameGrfWhenDispatchingThenStateComputeModeIsProgrammedOnlyOnce, IsGen12LP) {
+    using STATE_COMPUTE_MODE = typename FamilyType::STATE_COMPUTE_MODE;
+    uint32_t dims[] = {2, 1, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+    bool requiresUncachedMocs = false;
+    uint32_t partitionCount = 0;
+
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dims, false, false, dispatchInterface.get(), 0, false, pDevice,
+                                             NEO::PreemptionMode::Disabled, requiresUncachedMocs, partitionCount, false);
+    EXPECT_EQ(GrfConfig::DefaultGrfNumber, cmdContainer->lastSentNumGrfRequired);
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dims, false, false, dispatchInterface.get(), 0, false, pDevice,
+                                             NEO::PreemptionMode::Disabled, requiresUncachedMocs, partitionCount, false);
+
+    GenCmdList commands;
+    CmdParse<FamilyType>::parseCommandBuffer(commands, ptrOffset(cmdContainer->getCommandStream()->getCpuBase(), 0), cmdContainer->getCommandStream()->getUsed());
+    EXPECT_EQ(1u, findAll<STATE_COMPUTE_MODE *>(commands.begin(), commands.end()).size());
+
+    cmdContainer->reset();
+    EXPECT_EQ(0u, cmdContainer->lastSentNumGrfRequired);
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dims, false, false, dispatchInterface.get(), 0, false, pDevice,
+                                             NEO::PreemptionMode::Disabled, requiresUncachedMocs, partitionCount, false);
+
+    commands.clear();
+    CmdParse<FamilyType>::parseCommandBuffer(commands, ptrOffset(cmdContainer->getCommandStream()->getCpuBase(), 0), cmdContainer->getCommandStream()->getUsed());
+    EXPECT_EQ(1u, findAll<STATE_COMPUTE_MODE *>(commands.begin(), commands.end()).size());
+}
+
+HWCMDTEST_F(IGFX_GEN8_CORE, CommandEncodeStatesTest, givenSlmEnabledL3ConfigKeptWhenDispatchingKernelWithoutSlmThenFlushNotAddedAndSlmConfigKept) {
+    using PIPE_CONTROL = typename FamilyType::PIPE_CONTROL;
+    uint32_t dims[] = {2, 1, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+    cmdContainer->keepSlmEnabledL3Config = true;
+    cmdContainer->slmSize = 1;
+    EXPECT_CALL(*dispatchInterface.get(), getSlmTotalSize()).WillRepeatedly(::testing::Return(0u));
+    cmdContainer->setDirtyStateForAllHeaps(false);
+
+    bool requiresUncachedMocs = false;
+    uint32_t partitionCount = 0;
+
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dims, false, false, dispatchInterface.get(), 0, false, pDevice,
+                                             NEO::PreemptionMode::Disabled, requiresUncachedMocs, partitionCount, false);
+    EXPECT_EQ(1u, cmdContainer->slmSize);
+
+    GenCmdList commands;
+    CmdParse<FamilyType>::parseCommandBuffer(commands, ptrOffset(cmdContainer->getCommandStream()->getCpuBase(), 0), cmdContainer->getCommandStream()->getUsed());
+
+    if (MemorySynchronizationCommands<FamilyType>::isPipeControlPriorToPipelineSelectWArequired(pDevice->getHardwareInfo())) {
+        auto itorPC = findAll<PIPE_CONTROL *>(commands.begin(), commands.end());
+        EXPECT_EQ(2u, itorPC.size());
+    } else {
+        auto itorPC = find<PIPE_CONTROL *>(commands.begin(), commands.end());
+        ASSERT_EQ(itorPC, commands.end());
+    }
+}
@@ -217,6 +217,47 @@ HWTEST_F(CommandEncoderMathTest, givenOffsetAndValueWhenEncodeBitwiseAndValIsCal
     EXPECT_EQ(cmdMem->getMemoryAddress(), dstAddress);
 }
 
+HWTEST_F(CommandEncoderMathTest, givenThresholdsWhenEncodeDurationHistogramUpdateIsCalledThenEachBucketIsLoadedUpdatedAndStored) {
+    using MI_LOAD_REGISTER_REG = typename FamilyType::MI_LOAD_REGISTER_REG;
+    using MI_LOAD_REGISTER_MEM = typename FamilyType::MI_LOAD_REGISTER_MEM;
+    using MI_MATH = typename FamilyType::MI_MATH;
+    using MI_STORE_REGISTER_MEM = typename FamilyType::MI_STORE_REGISTER_MEM;
+
+    CommandContainer cmdContainer;
+    cmdContainer.initialize(pDevice);
+    constexpr uint64_t bucketsAddress = 0xDEADCAF0u;
+    constexpr uint32_t thresholds[] = {10u, 20u};
+    constexpr uint32_t bucketCount = 3u;
+
+    EncodeDurationHistogram<FamilyType>::encodeStart(cmdContainer);
+    EncodeDurationHistogram<FamilyType>::encodeUpdate(cmdContainer, bucketsAddress, thresholds, bucketCount);
+
+    GenCmdList commands;
+    CmdParse<FamilyType>::parseCommandBuffer(commands, ptrOffset(cmdContainer.getCommandStream()->getCpuBase(), 0), cmdContainer.getCommandStream()->getUsed());
+
+    auto loadRegs = findAll<MI_LOAD_REGISTER_REG *>(commands.begin(), commands.end());
+    ASSERT_EQ(2u, loadRegs.size());
+    for (auto &itor : loadRegs) {
+        EXPECT_EQ(REG_GLOBAL_TIMESTAMP_LDW, genCmdCast<MI_LOAD_REGISTER_REG *>(*itor)->getSourceRegisterAddress());
+    }
+
+    // duration and mask, compare, mask and add for each bucket with a threshold, add for the last bucket
+    EXPECT_EQ(2u + 3u * (bucketCount - 1) + 1u, findAll<MI_MATH *>(commands.begin(), commands.end()).size());
+
+    auto loadMems = findAll<MI_LOAD_REGISTER_MEM *>(commands.begin(), commands.end());
+    auto storeMems = findAll<MI_STORE_REGISTER_MEM *>(commands.begin(), commands.end());
+    ASSERT_EQ(bucketCount, loadMems.size());
+    ASSERT_EQ(bucketCount, storeMems.size());
+    for (uint32_t i = 0; i < bucketCount; i++) {
+        auto loadMem = genCmdCast<MI_LOAD_REGISTER_MEM *>(*loadMems[i]);
+        auto storeMem = genCmdCast<MI_STORE_REGISTER_MEM *>(*storeMems[i]);
+        EXPECT_EQ(CS_GPR_R12, loadMem->getRegisterAddress());
+        EXPECT_EQ(bucketsAddress + i * sizeof(uint32_t), loadMem->getMemoryAddress());
+        EXPECT_EQ(CS_GPR_R12, storeMem->getRegisterAddress());
+        EXPECT_EQ(bucketsAddress + i * sizeof(uint32_t), storeMem->getMemoryAddress());
+    }
+}
+
 HWTEST_F(CommandEncoderMathTest, setGroupSizeIndirect) {
     using MI_MATH = typename FamilyType::MI_MATH;
     using MI_MATH_ALU_INST_INLINE = typename FamilyType::MI_MATH_ALU_INST_INLINE;
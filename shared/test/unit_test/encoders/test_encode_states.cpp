@@ -71,6 +71,25 @@ HWTEST_F(BindlessCommandEncodeStatesTest, GivenBindlessEnabledWhenBorderColorWit
     EXPECT_EQ(pSmplr->getIndirectStatePointer(), expectedValue);
 }
 
+HWTEST_F(BindlessCommandEncodeStatesTest, GivenBindlessEnabledWhenCopyingTheSameSamplerStatesTwiceThenGlobalDshSpaceIsReused) {
+    using SAMPLER_BORDER_COLOR_STATE = typename FamilyType::SAMPLER_BORDER_COLOR_STATE;
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.UseBindlessMode.set(1);
+    uint32_t numSamplers = 1;
+    pDevice->getExecutionEnvironment()->rootDeviceEnvironments[pDevice->getRootDeviceIndex()]->createBindlessHeapsHelper(pDevice->getMemoryManager(), pDevice->getNumAvailableDevices() > 1, pDevice->getRootDeviceIndex());
+
+    uint32_t borderColorSize = 0x40;
+    SAMPLER_BORDER_COLOR_STATE samplerState;
+    samplerState.init();
+    auto dsh = pDevice->getBindlessHeapsHelper()->getHeap(BindlessHeapsHelper::BindlesHeapType::GLOBAL_DSH);
+    auto offset1 = EncodeStates<FamilyType>::copySamplerState(dsh, borderColorSize, numSamplers, 0, &samplerState, pDevice->getBindlessHeapsHelper());
+    auto usedAfterFirstCopy = dsh->getUsed();
+    auto offset2 = EncodeStates<FamilyType>::copySamplerState(dsh, borderColorSize, numSamplers, 0, &samplerState, pDevice->getBindlessHeapsHelper());
+
+    EXPECT_EQ(offset1, offset2);
+    EXPECT_EQ(usedAfterFirstCopy, dsh->getUsed());
+}
+
 HWTEST_F(BindlessCommandEncodeStatesTest, GivenBindlessEnabledWhenBorderColorsRedChanelIsNotZeroThenExceptionThrown) {
     using SAMPLER_BORDER_COLOR_STATE = typename FamilyType::SAMPLER_BORDER_COLOR_STATE;
     DebugManagerStateRestore restorer;
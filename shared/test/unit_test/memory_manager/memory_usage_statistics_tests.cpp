@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/constants.h"
+#include "shared/source/memory_manager/memory_usage_statistics.h"
+
+#include "gtest/gtest.h"
+
+#include <csignal>
+#include <sstream>
+
+using namespace NEO;
+
+TEST(MemoryUsageStatisticsTest, givenRecordedAllocationsWhenFreeingThenLiveBytesDropAndPeakBytesStay) {
+    MemoryUsageStatistics statistics;
+    GraphicsAllocation firstAllocation(0u, GraphicsAllocation::AllocationType::BUFFER, nullptr, 0u, 0u, MemoryConstants::pageSize, MemoryPool::LocalMemory, 1u);
+    GraphicsAllocation secondAllocation(0u, GraphicsAllocation::AllocationType::BUFFER, nullptr, 0u, 0u, 2 * MemoryConstants::pageSize, MemoryPool::LocalMemory, 1u);
+
+    statistics.recordAllocation(firstAllocation);
+    statistics.recordAllocation(secondAllocation);
+
+    auto usage = statistics.getUsage(GraphicsAllocation::AllocationType::BUFFER, MemoryPool::LocalMemory);
+    EXPECT_EQ(3 * MemoryConstants::pageSize, usage.liveBytes);
+    EXPECT_EQ(3 * MemoryConstants::pageSize, usage.peakBytes);
+    EXPECT_EQ(2u, usage.allocationCount);
+    EXPECT_EQ(2u, usage.osHandleCount);
+
+    statistics.recordFree(secondAllocation);
+    usage = statistics.getUsage(GraphicsAllocation::AllocationType::BUFFER, MemoryPool::LocalMemory);
+    EXPECT_EQ(MemoryConstants::pageSize, usage.liveBytes);
+    EXPECT_EQ(3 * MemoryConstants::pageSize, usage.peakBytes);
+    EXPECT_EQ(1u, usage.allocationCount);
+
+    auto total = statistics.getTotalUsage(true);
+    EXPECT_EQ(MemoryConstants::pageSize, total.liveBytes);
+    EXPECT_EQ(3 * MemoryConstants::pageSize, total.peakBytes);
+    EXPECT_EQ(0u, statistics.getTotalUsage(false).peakBytes);
+
+    statistics.recordFree(firstAllocation);
+    EXPECT_EQ(0u, statistics.getTotalUsage(true).liveBytes);
+    EXPECT_EQ(0u, statistics.getTotalUsage(true).allocationCount);
+}
+
+TEST(MemoryUsageStatisticsTest, givenAllocationTypeChangedAfterRecordingWhenFreeingThenOriginalCountersAreDecremented) {
+    MemoryUsageStatistics statistics;
+    GraphicsAllocation allocation(0u, GraphicsAllocation::AllocationType::BUFFER, nullptr, 0u, 0u, MemoryConstants::pageSize, MemoryPool::System4KBPages, 1u);
+
+    statistics.recordAllocation(allocation);
+    allocation.setAllocationType(GraphicsAllocation::AllocationType::IMAGE);
+    statistics.recordFree(allocation);
+
+    EXPECT_EQ(0u, statistics.getUsage(GraphicsAllocation::AllocationType::BUFFER, MemoryPool::System4KBPages).liveBytes);
+    EXPECT_EQ(0u, statistics.getUsage(GraphicsAllocation::AllocationType::IMAGE, MemoryPool::System4KBPages).peakBytes);
+}
+
+TEST(MemoryUsageStatisticsTest, givenNotRecordedAllocationWhenFreeingThenCountersAreNotChanged) {
+    MemoryUsageStatistics statistics;
+    GraphicsAllocation recordedAllocation(0u, GraphicsAllocation::AllocationType::BUFFER, nullptr, 0u, 0u, MemoryConstants::pageSize, MemoryPool::System4KBPages, 1u);
+    GraphicsAllocation notRecordedAllocation(0u, GraphicsAllocation::AllocationType::BUFFER, nullptr, 0u, 0u, MemoryConstants::pageSize, MemoryPool::System4KBPages, 1u);
+
+    statistics.recordAllocation(recordedAllocation);
+    statistics.recordFree(notRecordedAllocation);
+
+    auto usage = statistics.getTotalUsage(false);
+    EXPECT_EQ(MemoryConstants::pageSize, usage.liveBytes);
+    EXPECT_EQ(1u, usage.allocationCount);
+}
+
+TEST(MemoryUsageStatisticsTest, givenRecordedAllocationWhenDumpingThenAllocationTypeIsPrinted) {
+    MemoryUsageStatistics statistics;
+    GraphicsAllocation allocation(0u, GraphicsAllocation::AllocationType::COMMAND_BUFFER, nullptr, 0u, 0u, MemoryConstants::pageSize, MemoryPool::System4KBPages, 1u);
+    statistics.recordAllocation(allocation);
+
+    std::stringstream out;
+    statistics.dump(out, 0u);
+
+    EXPECT_NE(std::string::npos, out.str().find("COMMAND_BUFFER"));
+    EXPECT_EQ(std::string::npos, out.str().find("KERNEL_ISA"));
+    statistics.recordFree(allocation);
+}
+
+TEST(MemoryUsageStatisticsTest, givenDumpEnabledOnSignalWhenSignalIsRaisedThenDumpIsRequestedOnce) {
+    MemoryUsageStatistics::enableDumpOnSignal(SIGTERM);
+    EXPECT_FALSE(MemoryUsageStatistics::isDumpRequested());
+
+    std::raise(SIGTERM);
+    EXPECT_TRUE(MemoryUsageStatistics::isDumpRequested());
+    EXPECT_FALSE(MemoryUsageStatistics::isDumpRequested());
+
+    std::signal(SIGTERM, SIG_DFL);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/memory_manager/multi_graphics_allocation.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 
 #include "opencl/test/unit_test/mocks/mock_memory_manager.h"
 
@@ -20,6 +21,21 @@ struct MockMultiGraphicsAllocation : public MultiGraphicsAllocation {
     using MultiGraphicsAllocation::MultiGraphicsAllocation;
 };
 
+struct PeerCopyMemoryManager : public MockMemoryManager {
+    using MockMemoryManager::MockMemoryManager;
+
+    bool copyFromPeerAllocation(GraphicsAllocation &dstAllocation, GraphicsAllocation &srcAllocation) override {
+        copyFromPeerAllocationCalled++;
+        if (copyFromPeerAllocationResult) {
+            return true;
+        }
+        return MockMemoryManager::copyFromPeerAllocation(dstAllocation, srcAllocation);
+    }
+
+    uint32_t copyFromPeerAllocationCalled = 0u;
+    bool copyFromPeerAllocationResult = false;
+};
+
 TEST(MultiGraphicsAllocationTest, whenCreatingMultiGraphicsAllocationThenTheAllocationIsObtainableAsADefault) {
     GraphicsAllocation graphicsAllocation(1, // rootDeviceIndex
                                           GraphicsAllocation::AllocationType::BUFFER,
@@ -174,3 +190,70 @@ TEST(MultiGraphicsAllocationTest, givenMultiGraphicsAllocationWhenEnsureMemoryOn
     EXPECT_EQ(mockMemoryManager.lockResourceCalled, 2u);
     EXPECT_EQ(mockMemoryManager.unlockResourceCalled, 2u);
 }
+
+TEST(MultiGraphicsAllocationTest, givenP2PMemoryMigrationDisabledWhenEnsureMemoryOnDeviceIsCalledThenPeerCopyIsNotUsed) {
+    uint8_t hostBuffer[4] = {};
+    uint8_t refBuffer[4] = {};
+    MemoryAllocation allocation1(1u, GraphicsAllocation::AllocationType::BUFFER, hostBuffer, sizeof(hostBuffer), 0, MemoryPool::LocalMemory, 0);
+    MemoryAllocation allocation2(2u, GraphicsAllocation::AllocationType::BUFFER, refBuffer, sizeof(refBuffer), 0, MemoryPool::LocalMemory, 0);
+
+    MockMultiGraphicsAllocation multiGraphicsAllocation(2u);
+    multiGraphicsAllocation.addAllocation(&allocation1);
+    multiGraphicsAllocation.addAllocation(&allocation2);
+
+    MockExecutionEnvironment mockExecutionEnvironment(defaultHwInfo.get());
+    PeerCopyMemoryManager memoryManager(mockExecutionEnvironment);
+    memoryManager.copyFromPeerAllocationResult = true;
+
+    multiGraphicsAllocation.lastUsedRootDeviceIndex = 1u;
+    multiGraphicsAllocation.ensureMemoryOnDevice(memoryManager, 2u);
+    EXPECT_EQ(0u, memoryManager.copyFromPeerAllocationCalled);
+    EXPECT_EQ(2u, memoryManager.lockResourceCalled);
+}
+
+TEST(MultiGraphicsAllocationTest, givenP2PMemoryMigrationEnabledWhenPeerCopySucceedsThenAllocationsAreNotLocked) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableP2PMemoryMigration.set(true);
+
+    uint8_t hostBuffer[4] = {};
+    uint8_t refBuffer[4] = {};
+    MemoryAllocation allocation1(1u, GraphicsAllocation::AllocationType::BUFFER, hostBuffer, sizeof(hostBuffer), 0, MemoryPool::LocalMemory, 0);
+    MemoryAllocation allocation2(2u, GraphicsAllocation::AllocationType::BUFFER, refBuffer, sizeof(refBuffer), 0, MemoryPool::LocalMemory, 0);
+
+    MockMultiGraphicsAllocation multiGraphicsAllocation(2u);
+    multiGraphicsAllocation.addAllocation(&allocation1);
+    multiGraphicsAllocation.addAllocation(&allocation2);
+
+    MockExecutionEnvironment mockExecutionEnvironment(defaultHwInfo.get());
+    PeerCopyMemoryManager memoryManager(mockExecutionEnvironment);
+    memoryManager.copyFromPeerAllocationResult = true;
+
+    multiGraphicsAllocation.lastUsedRootDeviceIndex = 1u;
+    multiGraphicsAllocation.ensureMemoryOnDevice(memoryManager, 2u);
+    EXPECT_EQ(1u, memoryManager.copyFromPeerAllocationCalled);
+    EXPECT_EQ(0u, memoryManager.lockResourceCalled);
+    EXPECT_EQ(2u, multiGraphicsAllocation.getLastUsedRootDeviceIndex());
+}
+
+TEST(MultiGraphicsAllocationTest, givenP2PMemoryMigrationEnabledWhenPeerAllocationCannotBeCreatedThenDataIsCopiedThroughHost) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableP2PMemoryMigration.set(true);
+
+    uint8_t hostBuffer[4] = {1u, 1u, 1u, 1u};
+    uint8_t refBuffer[4] = {3u, 3u, 3u, 3u};
+    MemoryAllocation allocation1(1u, GraphicsAllocation::AllocationType::BUFFER, hostBuffer, sizeof(hostBuffer), 0, MemoryPool::LocalMemory, 0);
+    MemoryAllocation allocation2(2u, GraphicsAllocation::AllocationType::BUFFER, refBuffer, sizeof(refBuffer), 0, MemoryPool::LocalMemory, 0);
+
+    MockMultiGraphicsAllocation multiGraphicsAllocation(2u);
+    multiGraphicsAllocation.addAllocation(&allocation1);
+    multiGraphicsAllocation.addAllocation(&allocation2);
+
+    MockExecutionEnvironment mockExecutionEnvironment(defaultHwInfo.get());
+    PeerCopyMemoryManager memoryManager(mockExecutionEnvironment);
+
+    multiGraphicsAllocation.lastUsedRootDeviceIndex = 1u;
+    multiGraphicsAllocation.ensureMemoryOnDevice(memoryManager, 2u);
+    EXPECT_EQ(1u, memoryManager.copyFromPeerAllocationCalled);
+    EXPECT_EQ(2u, memoryManager.lockResourceCalled);
+    EXPECT_EQ(0, memcmp(hostBuffer, refBuffer, sizeof(hostBuffer)));
+}
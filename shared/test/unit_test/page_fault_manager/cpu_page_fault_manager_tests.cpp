@@ -5,6 +5,7 @@
  *
  */
 
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/unified_memory/unified_memory.h"
@@ -140,6 +141,96 @@ TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocsWhenMovingToGpuDomainAllocs
     EXPECT_FALSE(pageFaultManager->isAubWritable);
 }
 
+TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocsMovedToGpuDomainWhenMovingAllocsToGpuDomainAgainThenOnlyAllocsAccessedByCpuAreVisited) {
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+
+    void *alloc1 = reinterpret_cast<void *>(0x1);
+    void *alloc2 = reinterpret_cast<void *>(0x100);
+
+    pageFaultManager->insertAllocation(alloc1, 10, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), cmdQ, {});
+    pageFaultManager->insertAllocation(alloc2, 20, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), cmdQ, {});
+    EXPECT_EQ(pageFaultManager->nonGpuDomainAllocations.size(), 2u);
+
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager));
+    EXPECT_EQ(pageFaultManager->transferToGpuCalled, 2);
+    EXPECT_TRUE(pageFaultManager->nonGpuDomainAllocations.empty());
+
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager));
+    EXPECT_EQ(pageFaultManager->transferToGpuCalled, 2);
+
+    pageFaultManager->verifyPageFault(alloc2);
+    EXPECT_EQ(pageFaultManager->nonGpuDomainAllocations.size(), 1u);
+    EXPECT_EQ(pageFaultManager->nonGpuDomainAllocations.count(alloc2), 1u);
+
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager));
+    EXPECT_EQ(pageFaultManager->transferToGpuCalled, 3);
+    EXPECT_EQ(pageFaultManager->transferToGpuAddress, alloc2);
+    EXPECT_TRUE(pageFaultManager->nonGpuDomainAllocations.empty());
+
+    pageFaultManager->removeAllocation(alloc1);
+    pageFaultManager->removeAllocation(alloc2);
+    EXPECT_TRUE(pageFaultManager->nonGpuDomainAllocations.empty());
+}
+
+TEST_F(PageFaultManagerTest, givenAllocInCpuDomainWhenMovingToGpuDomainAsyncThenTransferIsStartedAndWaitedForOnNextMove) {
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+    void *alloc = reinterpret_cast<void *>(0x100);
+
+    pageFaultManager->insertAllocation(alloc, 10, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), cmdQ, {});
+
+    pageFaultManager->moveAllocationToGpuDomainAsync(ptrOffset(alloc, 4));
+    EXPECT_EQ(pageFaultManager->startTransferToGpuCalled, 1);
+    EXPECT_EQ(pageFaultManager->transferToGpuCalled, 0);
+    EXPECT_EQ(pageFaultManager->waitForTransfersToGpuCalled, 0);
+    EXPECT_EQ(pageFaultManager->transferToGpuAddress, alloc);
+    EXPECT_EQ(pageFaultManager->transferToGpuSize, 10u);
+    EXPECT_EQ(pageFaultManager->protectMemoryCalled, 1);
+    EXPECT_EQ(pageFaultManager->protectedMemoryAccessAddress, alloc);
+    EXPECT_EQ(pageFaultManager->memoryData[alloc].domain, PageFaultManager::AllocationDomain::Gpu);
+    EXPECT_TRUE(pageFaultManager->memoryData[alloc].transferPending);
+    EXPECT_FALSE(pageFaultManager->isAubWritable);
+
+    pageFaultManager->moveAllocationToGpuDomainAsync(alloc);
+    EXPECT_EQ(pageFaultManager->startTransferToGpuCalled, 1);
+
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(pageFaultManager->transferToGpuCalled, 0);
+    EXPECT_EQ(pageFaultManager->waitForTransfersToGpuCalled, 1);
+    EXPECT_FALSE(pageFaultManager->memoryData[alloc].transferPending);
+    EXPECT_TRUE(pageFaultManager->nonGpuDomainAllocations.empty());
+
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(pageFaultManager->waitForTransfersToGpuCalled, 1);
+}
+
+TEST_F(PageFaultManagerTest, givenAllocWithPendingTransferWhenMovingAllocsWithinManagerToGpuDomainThenTransferIsWaitedFor) {
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+    void *alloc = reinterpret_cast<void *>(0x100);
+
+    pageFaultManager->insertAllocation(alloc, 10, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), cmdQ, {});
+    pageFaultManager->moveAllocationToGpuDomainAsync(alloc);
+    EXPECT_EQ(pageFaultManager->nonGpuDomainAllocations.size(), 1u);
+
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager));
+    EXPECT_EQ(pageFaultManager->transferToGpuCalled, 0);
+    EXPECT_EQ(pageFaultManager->waitForTransfersToGpuCalled, 1);
+    EXPECT_TRUE(pageFaultManager->nonGpuDomainAllocations.empty());
+}
+
+TEST_F(PageFaultManagerTest, givenAllocInNoneDomainWhenMovingToGpuDomainAsyncThenNothingIsTransferred) {
+    void *alloc = reinterpret_cast<void *>(0x100);
+
+    MemoryProperties memoryProperties{};
+    memoryProperties.allocFlags.usmInitialPlacementGpu = 1;
+    pageFaultManager->insertAllocation(alloc, 10, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), nullptr, memoryProperties);
+
+    pageFaultManager->moveAllocationToGpuDomainAsync(alloc);
+    EXPECT_EQ(pageFaultManager->startTransferToGpuCalled, 0);
+    EXPECT_EQ(pageFaultManager->memoryData[alloc].domain, PageFaultManager::AllocationDomain::Gpu);
+    EXPECT_FALSE(pageFaultManager->memoryData[alloc].transferPending);
+    EXPECT_TRUE(pageFaultManager->nonGpuDomainAllocations.empty());
+}
+
 TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocWhenMoveToGpuDomainThenTransferToGpuIsCalled) {
     void *cmdQ = reinterpret_cast<void *>(0xFFFF);
 
@@ -208,6 +299,32 @@ TEST_F(PageFaultManagerTest, givenHandlerRegisteredAndUntrackedPageFaultAddressW
     EXPECT_FALSE(retVal);
 }
 
+TEST_F(PageFaultManagerTest, givenPageFaultAddressInsideOrBetweenTrackedAllocsWhenVerifyingThenOnlyAddressesInsideAllocsAreHandled) {
+    void *alloc1 = reinterpret_cast<void *>(0x1000);
+    void *alloc2 = reinterpret_cast<void *>(0x3000);
+
+    pageFaultManager->insertAllocation(alloc1, 0x1000, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), nullptr, {});
+    pageFaultManager->insertAllocation(alloc2, 0x1000, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), nullptr, {});
+
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(0x800)));
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(0x2000)));
+    EXPECT_FALSE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(0x4000)));
+    EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 0);
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(reinterpret_cast<void *>(0x3fff)));
+    EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 1);
+    EXPECT_EQ(pageFaultManager->allowedMemoryAccessAddress, alloc2);
+    EXPECT_EQ(pageFaultManager->accessAllowedSize, 0x1000u);
+}
+
+TEST_F(PageFaultManagerTest, givenAdjacentPageAlignedAllocsWhenGettingAllocationLockThenDifferentLocksAreReturned) {
+    void *alloc1 = reinterpret_cast<void *>(0x10000);
+    void *alloc2 = reinterpret_cast<void *>(0x11000);
+
+    EXPECT_NE(&pageFaultManager->getAllocationLock(alloc1), &pageFaultManager->getAllocationLock(alloc2));
+    EXPECT_EQ(&pageFaultManager->getAllocationLock(alloc1), &pageFaultManager->getAllocationLock(alloc1));
+}
+
 TEST_F(PageFaultManagerTest, givenTrackedPageFaultAddressWhenVerifyingThenProperAllocIsTransferredToCpuDomain) {
     void *alloc1 = reinterpret_cast<void *>(0x1);
     void *alloc2 = reinterpret_cast<void *>(0x100);
@@ -398,6 +515,144 @@ TEST_F(PageFaultManagerTest, givenAllocationMovedToGpuDomainWhenVerifyingPagefau
     EXPECT_TRUE(pageFaultManager->isAubWritable);
 }
 
+TEST_F(PageFaultManagerTest, givenAllocationBiggerThanMigrationBlockWhenVerifyingPagefaultThenOnlyFaultedBlockIsMovedToCpuDomain) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.UsmMigrationBlockSize.set(static_cast<int32_t>(MemoryConstants::pageSize));
+    constexpr size_t blockSize = MemoryConstants::pageSize;
+
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+    void *alloc = reinterpret_cast<void *>(0x10000);
+
+    MemoryProperties memoryProperties{};
+    memoryProperties.allocFlags.usmInitialPlacementGpu = 1;
+    pageFaultManager->insertAllocation(alloc, 3 * blockSize, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), cmdQ, memoryProperties);
+    EXPECT_EQ(pageFaultManager->memoryData[alloc].blockSize, blockSize);
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+
+    pageFaultManager->verifyPageFault(ptrOffset(alloc, blockSize + 8));
+    EXPECT_EQ(pageFaultManager->transferToCpuCalled, 1);
+    EXPECT_EQ(pageFaultManager->transferToCpuAddress, ptrOffset(alloc, blockSize));
+    EXPECT_EQ(pageFaultManager->transferToCpuSize, blockSize);
+    EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 1);
+    EXPECT_EQ(pageFaultManager->allowedMemoryAccessAddress, ptrOffset(alloc, blockSize));
+    EXPECT_EQ(pageFaultManager->accessAllowedSize, blockSize);
+    EXPECT_EQ(pageFaultManager->memoryData[alloc].domain, PageFaultManager::AllocationDomain::Cpu);
+
+    pageFaultManager->protectMemoryCalled = 0;
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(pageFaultManager->transferToGpuCalled, 1);
+    EXPECT_EQ(pageFaultManager->transferToGpuAddress, ptrOffset(alloc, blockSize));
+    EXPECT_EQ(pageFaultManager->transferToGpuSize, blockSize);
+    EXPECT_EQ(pageFaultManager->protectMemoryCalled, 1);
+    EXPECT_EQ(pageFaultManager->protectedMemoryAccessAddress, ptrOffset(alloc, blockSize));
+    EXPECT_EQ(pageFaultManager->protectedSize, blockSize);
+    EXPECT_EQ(pageFaultManager->memoryData[alloc].domain, PageFaultManager::AllocationDomain::Gpu);
+}
+
+TEST_F(PageFaultManagerTest, givenAdjacentBlocksInCpuDomainWhenMovingToGpuDomainThenBlocksAreTransferredAsOneRange) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.UsmMigrationBlockSize.set(static_cast<int32_t>(MemoryConstants::pageSize));
+    constexpr size_t blockSize = MemoryConstants::pageSize;
+
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+    void *alloc = reinterpret_cast<void *>(0x10000);
+
+    pageFaultManager->insertAllocation(alloc, 3 * blockSize, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), cmdQ, {});
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(pageFaultManager->transferToGpuCalled, 1);
+    EXPECT_EQ(pageFaultManager->transferToGpuSize, 3 * blockSize);
+
+    pageFaultManager->verifyPageFault(alloc);
+    pageFaultManager->verifyPageFault(ptrOffset(alloc, blockSize));
+    EXPECT_EQ(pageFaultManager->transferToCpuCalled, 2);
+
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(pageFaultManager->transferToGpuCalled, 2);
+    EXPECT_EQ(pageFaultManager->transferToGpuAddress, alloc);
+    EXPECT_EQ(pageFaultManager->transferToGpuSize, 2 * blockSize);
+
+    pageFaultManager->verifyPageFault(alloc);
+    pageFaultManager->allowMemoryAccessCalled = 0;
+    pageFaultManager->removeAllocation(alloc);
+    EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 1);
+    EXPECT_EQ(pageFaultManager->allowedMemoryAccessAddress, alloc);
+    EXPECT_EQ(pageFaultManager->accessAllowedSize, 3 * blockSize);
+}
+
+TEST_F(PageFaultManagerTest, givenMigrationBlockSizeSetToZeroWhenVerifyingPagefaultThenWholeAllocationIsMovedToCpuDomain) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.UsmMigrationBlockSize.set(0);
+
+    void *alloc = reinterpret_cast<void *>(0x10000);
+    const size_t size = 4 * PageFaultManager::defaultMigrationBlockSize;
+
+    MemoryProperties memoryProperties{};
+    memoryProperties.allocFlags.usmInitialPlacementGpu = 1;
+    pageFaultManager->insertAllocation(alloc, size, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), nullptr, memoryProperties);
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+
+    pageFaultManager->verifyPageFault(ptrOffset(alloc, size - 1));
+    EXPECT_EQ(pageFaultManager->transferToCpuCalled, 1);
+    EXPECT_EQ(pageFaultManager->transferToCpuAddress, alloc);
+    EXPECT_EQ(pageFaultManager->transferToCpuSize, size);
+}
+
+TEST_F(PageFaultManagerTest, givenReadMostlyAllocInGpuDomainWhenVerifyingPagefaultThenReadOnlyCopyIsKeptWithoutWriteBack) {
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+    void *alloc = reinterpret_cast<void *>(0x1);
+
+    MemoryProperties memoryProperties{};
+    memoryProperties.allocFlags.usmInitialPlacementGpu = 1;
+    pageFaultManager->insertAllocation(alloc, 10, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), cmdQ, memoryProperties);
+    MemAdviseFlags memAdviseFlags;
+    memAdviseFlags.readMostly = 1;
+    pageFaultManager->setMemAdviseFlags(alloc, memAdviseFlags);
+    pageFaultManager->memoryData[alloc].domain = PageFaultManager::AllocationDomain::Gpu;
+
+    pageFaultManager->verifyPageFault(alloc);
+    EXPECT_EQ(pageFaultManager->transferToCpuCalled, 1);
+    EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 0);
+    EXPECT_EQ(pageFaultManager->allowMemoryReadAccessCalled, 1);
+    EXPECT_EQ(pageFaultManager->allowedMemoryReadAccessAddress, alloc);
+    EXPECT_EQ(pageFaultManager->accessReadAllowedSize, 10u);
+    EXPECT_EQ(pageFaultManager->memoryData[alloc].domain, PageFaultManager::AllocationDomain::Cpu);
+
+    pageFaultManager->protectMemoryCalled = 0;
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(pageFaultManager->transferToGpuCalled, 0);
+    EXPECT_EQ(pageFaultManager->protectMemoryCalled, 1);
+    EXPECT_EQ(pageFaultManager->protectedMemoryAccessAddress, alloc);
+    EXPECT_EQ(pageFaultManager->protectedSize, 10u);
+    EXPECT_EQ(pageFaultManager->memoryData[alloc].domain, PageFaultManager::AllocationDomain::Gpu);
+}
+
+TEST_F(PageFaultManagerTest, givenReadMostlyAllocWithReadOnlyCopyWhenCpuWritesThenAllocIsWrittenBackOnMoveToGpuDomain) {
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+    void *alloc = reinterpret_cast<void *>(0x1);
+
+    MemoryProperties memoryProperties{};
+    memoryProperties.allocFlags.usmInitialPlacementGpu = 1;
+    pageFaultManager->insertAllocation(alloc, 10, reinterpret_cast<SVMAllocsManager *>(unifiedMemoryManager), cmdQ, memoryProperties);
+    MemAdviseFlags memAdviseFlags;
+    memAdviseFlags.devicePreferredLocation = 1;
+    pageFaultManager->setMemAdviseFlags(alloc, memAdviseFlags);
+
+    pageFaultManager->verifyPageFault(alloc);
+    EXPECT_EQ(pageFaultManager->transferToCpuCalled, 0);
+    EXPECT_EQ(pageFaultManager->allowMemoryReadAccessCalled, 1);
+
+    pageFaultManager->verifyPageFault(alloc);
+    EXPECT_EQ(pageFaultManager->transferToCpuCalled, 0);
+    EXPECT_EQ(pageFaultManager->allowMemoryReadAccessCalled, 1);
+    EXPECT_EQ(pageFaultManager->allowMemoryAccessCalled, 1);
+    EXPECT_EQ(pageFaultManager->allowedMemoryAccessAddress, alloc);
+
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(pageFaultManager->transferToGpuCalled, 1);
+    EXPECT_EQ(pageFaultManager->transferToGpuAddress, alloc);
+    EXPECT_EQ(pageFaultManager->transferToGpuSize, 10u);
+}
+
 TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocWhenSetAubWritableIsCalledThenAllocIsAubWritable) {
     MockExecutionEnvironment executionEnvironment;
     REQUIRE_SVM_OR_SKIP(executionEnvironment.rootDeviceEnvironments[0]->getHardwareInfo());
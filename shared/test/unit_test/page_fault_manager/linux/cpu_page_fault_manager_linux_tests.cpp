@@ -120,6 +120,43 @@ TEST_F(PageFaultManagerLinuxTest, givenProtectedMemoryWhenTryingToAccessThenPage
     EXPECT_EQ(ptr[0], 10);
 }
 
+class MockPageFaultManagerLinuxUserFaultFd : public MockPageFaultManagerLinux {
+  public:
+    using PageFaultManagerLinux::registerCPUMemory;
+    using PageFaultManagerLinux::unregisterCPUMemory;
+    using PageFaultManagerLinux::userFaultFd;
+    using PageFaultManagerLinux::userFaultFdThread;
+};
+
+TEST_F(PageFaultManagerLinuxTest, givenUserFaultFdPageFaultsDisabledWhenCreatingPageFaultManagerThenUserFaultFdIsNotUsed) {
+    auto pageFaultManager = std::make_unique<MockPageFaultManagerLinuxUserFaultFd>();
+    EXPECT_EQ(-1, pageFaultManager->userFaultFd);
+    EXPECT_EQ(nullptr, pageFaultManager->userFaultFdThread.get());
+}
+
+TEST_F(PageFaultManagerLinuxTest, givenUserFaultFdPageFaultsEnabledWhenWritingToReadOnlyCopyThenPageFaultIsHandledAndMemoryIsWritableAfterHandling) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableUserFaultFdPageFaults.set(1);
+
+    auto pageFaultManager = std::make_unique<MockPageFaultManagerLinuxUserFaultFd>();
+    EXPECT_EQ(pageFaultManager->userFaultFd >= 0, pageFaultManager->userFaultFdThread != nullptr);
+    pageFaultManager->allowCPUMemoryAccessOnPageFault = true;
+    auto ptr = static_cast<int *>(mmap(nullptr, pageFaultManager->size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0));
+    pageFaultManager->registerCPUMemory(ptr, pageFaultManager->size);
+
+    ptr[0] = 10;
+    pageFaultManager->allowCPUMemoryReadAccess(ptr, pageFaultManager->size);
+
+    EXPECT_EQ(ptr[0], 10);
+    EXPECT_FALSE(pageFaultManager->handlerInvoked);
+    ptr[0] = 20;
+    EXPECT_TRUE(pageFaultManager->handlerInvoked);
+    EXPECT_EQ(ptr[0], 20);
+
+    pageFaultManager->unregisterCPUMemory(ptr, pageFaultManager->size);
+    munmap(ptr, pageFaultManager->size);
+}
+
 class MockFailPageFaultManager : public PageFaultManagerLinux {
   public:
     using PageFaultManagerLinux::callPreviousHandler;
@@ -13,10 +13,12 @@ using namespace NEO;
 
 class MockPageFaultManager : public PageFaultManager {
   public:
+    using PageFaultManager::getAllocationLock;
     using PageFaultManager::gpuDomainHandler;
     using PageFaultManager::handleGpuDomainTransferForHw;
     using PageFaultManager::handleGpuDomainTransferForTbx;
     using PageFaultManager::memoryData;
+    using PageFaultManager::nonGpuDomainAllocations;
     using PageFaultManager::PageFaultData;
     using PageFaultManager::PageFaultManager;
     using PageFaultManager::selectGpuDomainHandler;
@@ -27,6 +29,11 @@ class MockPageFaultManager : public PageFaultManager {
         allowedMemoryAccessAddress = ptr;
         accessAllowedSize = size;
     }
+    void allowCPUMemoryReadAccess(void *ptr, size_t size) override {
+        allowMemoryReadAccessCalled++;
+        allowedMemoryReadAccessAddress = ptr;
+        accessReadAllowedSize = size;
+    }
     void protectCPUMemoryAccess(void *ptr, size_t size) override {
         protectMemoryCalled++;
         protectedMemoryAccessAddress = ptr;
@@ -37,9 +44,18 @@ class MockPageFaultManager : public PageFaultManager {
         transferToCpuAddress = ptr;
         transferToCpuSize = size;
     }
-    void transferToGpu(void *ptr, void *cmdQ) override {
+    void transferToGpu(void *ptr, size_t size, void *cmdQ) override {
         transferToGpuCalled++;
         transferToGpuAddress = ptr;
+        transferToGpuSize = size;
+    }
+    void startTransferToGpu(void *ptr, size_t size, void *cmdQ) override {
+        startTransferToGpuCalled++;
+        transferToGpuAddress = ptr;
+        transferToGpuSize = size;
+    }
+    void waitForTransfersToGpu(void *cmdQ) override {
+        waitForTransfersToGpuCalled++;
     }
     void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager) override {
         isAubWritable = writable;
@@ -50,8 +66,14 @@ class MockPageFaultManager : public PageFaultManager {
     void baseCpuTransfer(void *ptr, size_t size, void *cmdQ) {
         PageFaultManager::transferToCpu(ptr, size, cmdQ);
     }
-    void baseGpuTransfer(void *ptr, void *cmdQ) {
-        PageFaultManager::transferToGpu(ptr, cmdQ);
+    void baseGpuTransfer(void *ptr, size_t size, void *cmdQ) {
+        PageFaultManager::transferToGpu(ptr, size, cmdQ);
+    }
+    void baseStartGpuTransfer(void *ptr, size_t size, void *cmdQ) {
+        PageFaultManager::startTransferToGpu(ptr, size, cmdQ);
+    }
+    void baseWaitForGpuTransfers(void *cmdQ) {
+        PageFaultManager::waitForTransfersToGpu(cmdQ);
     }
     void evictMemoryAfterImplCopy(GraphicsAllocation *allocation, Device *device) override {}
 
@@ -64,15 +86,21 @@ class MockPageFaultManager : public PageFaultManager {
     }
 
     int allowMemoryAccessCalled = 0;
+    int allowMemoryReadAccessCalled = 0;
     int protectMemoryCalled = 0;
     int transferToCpuCalled = 0;
     int transferToGpuCalled = 0;
+    int startTransferToGpuCalled = 0;
+    int waitForTransfersToGpuCalled = 0;
     void *transferToCpuAddress = nullptr;
     void *transferToGpuAddress = nullptr;
     void *allowedMemoryAccessAddress = nullptr;
+    void *allowedMemoryReadAccessAddress = nullptr;
     void *protectedMemoryAccessAddress = nullptr;
     size_t transferToCpuSize = 0;
+    size_t transferToGpuSize = 0;
     size_t accessAllowedSize = 0;
+    size_t accessReadAllowedSize = 0;
     size_t protectedSize = 0;
     bool isAubWritable = true;
 };
@@ -81,6 +109,7 @@ template <class T>
 class MockPageFaultManagerHandlerInvoke : public T {
   public:
     using T::allowCPUMemoryAccess;
+    using T::allowCPUMemoryReadAccess;
     using T::evictMemoryAfterImplCopy;
     using T::protectCPUMemoryAccess;
     using T::T;
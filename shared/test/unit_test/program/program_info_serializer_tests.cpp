@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/program/program_info.h"
+#include "shared/source/program/program_info_serializer.h"
+
+#include "opencl/source/program/kernel_info.h"
+
+#include "gtest/gtest.h"
+
+#include <numeric>
+
+using namespace NEO;
+
+struct ProgramInfoSerializerFixture : public ::testing::Test {
+    void SetUp() override {
+        deviceBinary.resize(256);
+        std::iota(deviceBinary.begin(), deviceBinary.end(), static_cast<uint8_t>(0));
+
+        programInfo.globalConstants.initData = deviceBinary.data() + 16;
+        programInfo.globalConstants.size = 16;
+
+        auto kernelInfo = new KernelInfo();
+        auto &desc = kernelInfo->kernelDescriptor;
+        desc.kernelMetadata.kernelName = "kernel";
+        desc.kernelMetadata.printfStringsMap[3] = "%d\n";
+        desc.kernelMetadata.allByValueKernelArguments.push_back({{8, 4, 0}, 1});
+        desc.kernelMetadata.requiredSubGroupSize = 16;
+        desc.kernelAttributes.simdSize = 16;
+        desc.kernelAttributes.crossThreadDataSize = 64;
+        desc.kernelAttributes.flags.usesPrintf = true;
+        desc.entryPoints.skipPerThreadDataLoad = 128;
+        desc.payloadMappings.dispatchTraits.globalWorkSize[1] = 12;
+        desc.payloadMappings.implicitArgs.printfSurfaceAddress.stateless = 32;
+
+        desc.payloadMappings.explicitArgs.resize(2);
+        auto &ptrArg = desc.payloadMappings.explicitArgs[0].as<ArgDescPointer>(true);
+        ptrArg.stateless = 0;
+        ptrArg.pointerSize = 8;
+        desc.payloadMappings.explicitArgs[0].getTraits().addressQualifier = KernelArgMetadata::AddrConstant;
+        auto &valueArg = desc.payloadMappings.explicitArgs[1].as<ArgDescValue>(true);
+        valueArg.elements.push_back({8, 4, 0});
+        valueArg.elements.push_back({12, 4, 4});
+        desc.explicitArgsExtendedMetadata.resize(2);
+        desc.explicitArgsExtendedMetadata[1].argName = "value";
+
+        desc.generatedHeaps.resize(64, 7U);
+        kernelInfo->heapInfo.pKernelHeap = deviceBinary.data() + 128;
+        kernelInfo->heapInfo.KernelHeapSize = 64;
+        kernelInfo->heapInfo.KernelUnpaddedSize = 60;
+        kernelInfo->heapInfo.pSsh = desc.generatedHeaps.data();
+        kernelInfo->heapInfo.SurfaceStateHeapSize = 64;
+        programInfo.kernelInfos.push_back(kernelInfo);
+    }
+
+    ArrayRef<const uint8_t> getDeviceBinary() const {
+        return ArrayRef<const uint8_t>(deviceBinary.data(), deviceBinary.size());
+    }
+
+    std::vector<uint8_t> deviceBinary;
+    ProgramInfo programInfo;
+};
+
+using ProgramInfoSerializerTests = ProgramInfoSerializerFixture;
+
+TEST_F(ProgramInfoSerializerTests, GivenDecodedProgramInfoWhenSerializedAndDeserializedAgainstCopyOfBinaryThenProgramInfoIsRestoredAndRebased) {
+    std::vector<uint8_t> blob;
+    ASSERT_TRUE(serializeProgramInfo(programInfo, getDeviceBinary(), blob));
+
+    std::vector<uint8_t> binaryCopy = deviceBinary;
+    ArrayRef<const uint8_t> binaryCopyRef(binaryCopy.data(), binaryCopy.size());
+    ProgramInfo restored;
+    ASSERT_TRUE(deserializeProgramInfo(ArrayRef<const uint8_t>(blob.data(), blob.size()), binaryCopyRef, restored));
+
+    EXPECT_EQ(binaryCopy.data() + 16, restored.globalConstants.initData);
+    EXPECT_EQ(16U, restored.globalConstants.size);
+    EXPECT_EQ(nullptr, restored.globalVariables.initData);
+    EXPECT_EQ(nullptr, restored.linkerInput);
+    EXPECT_EQ(nullptr, restored.decodedElf.elfFileHeader);
+
+    ASSERT_EQ(1U, restored.kernelInfos.size());
+    const auto &kernelInfo = *restored.kernelInfos[0];
+    const auto &desc = kernelInfo.kernelDescriptor;
+    EXPECT_EQ(binaryCopy.data() + 128, kernelInfo.heapInfo.pKernelHeap);
+    EXPECT_EQ(64U, kernelInfo.heapInfo.KernelHeapSize);
+    EXPECT_EQ(60U, kernelInfo.heapInfo.KernelUnpaddedSize);
+    ASSERT_EQ(64U, desc.generatedHeaps.size());
+    EXPECT_EQ(desc.generatedHeaps.data(), kernelInfo.heapInfo.pSsh);
+    EXPECT_EQ(7U, desc.generatedHeaps[63]);
+    EXPECT_EQ(nullptr, kernelInfo.heapInfo.pDsh);
+
+    EXPECT_STREQ("kernel", desc.kernelMetadata.kernelName.c_str());
+    EXPECT_STREQ("%d\n", desc.kernelMetadata.printfStringsMap.at(3).c_str());
+    ASSERT_EQ(1U, desc.kernelMetadata.allByValueKernelArguments.size());
+    EXPECT_EQ(1U, desc.kernelMetadata.allByValueKernelArguments[0].argNum);
+    EXPECT_EQ(16U, desc.kernelMetadata.requiredSubGroupSize);
+    EXPECT_EQ(16U, desc.kernelAttributes.simdSize);
+    EXPECT_EQ(64U, desc.kernelAttributes.crossThreadDataSize);
+    EXPECT_TRUE(desc.kernelAttributes.flags.usesPrintf);
+    EXPECT_EQ(128U, desc.entryPoints.skipPerThreadDataLoad);
+    EXPECT_EQ(12U, desc.payloadMappings.dispatchTraits.globalWorkSize[1]);
+    EXPECT_EQ(32U, desc.payloadMappings.implicitArgs.printfSurfaceAddress.stateless);
+
+    ASSERT_EQ(2U, desc.payloadMappings.explicitArgs.size());
+    ASSERT_TRUE(desc.payloadMappings.explicitArgs[0].is<ArgDescriptor::ArgTPointer>());
+    EXPECT_EQ(8U, desc.payloadMappings.explicitArgs[0].as<ArgDescPointer>().pointerSize);
+    EXPECT_TRUE(desc.payloadMappings.explicitArgs[0].isReadOnly());
+    ASSERT_TRUE(desc.payloadMappings.explicitArgs[1].is<ArgDescriptor::ArgTValue>());
+    const auto &elements = desc.payloadMappings.explicitArgs[1].as<ArgDescValue>().elements;
+    ASSERT_EQ(2U, elements.size());
+    EXPECT_EQ(12U, elements[1].offset);
+    EXPECT_EQ(4U, elements[1].sourceOffset);
+    ASSERT_EQ(2U, desc.explicitArgsExtendedMetadata.size());
+    EXPECT_STREQ("value", desc.explicitArgsExtendedMetadata[1].argName.c_str());
+}
+
+TEST_F(ProgramInfoSerializerTests, GivenLinkerInputWhenSerializingThenFail) {
+    programInfo.prepareLinkerInputStorage();
+    std::vector<uint8_t> blob;
+    EXPECT_FALSE(serializeProgramInfo(programInfo, getDeviceBinary(), blob));
+    EXPECT_TRUE(blob.empty());
+}
+
+TEST_F(ProgramInfoSerializerTests, GivenKernelWithExtendedInfoWhenSerializingThenFail) {
+    programInfo.kernelInfos[0]->kernelDescriptor.extendedInfo = std::make_unique<ExtendedInfoBase>();
+    std::vector<uint8_t> blob;
+    EXPECT_FALSE(serializeProgramInfo(programInfo, getDeviceBinary(), blob));
+}
+
+TEST_F(ProgramInfoSerializerTests, GivenHeapOutsideOfDeviceBinaryWhenSerializingThenFail) {
+    uint8_t externalHeap[8] = {};
+    programInfo.kernelInfos[0]->heapInfo.pDsh = externalHeap;
+    programInfo.kernelInfos[0]->heapInfo.DynamicStateHeapSize = sizeof(externalHeap);
+    std::vector<uint8_t> blob;
+    EXPECT_FALSE(serializeProgramInfo(programInfo, getDeviceBinary(), blob));
+}
+
+TEST_F(ProgramInfoSerializerTests, GivenBlobWithDifferentVersionWhenDeserializingThenFail) {
+    std::vector<uint8_t> blob;
+    ASSERT_TRUE(serializeProgramInfo(programInfo, getDeviceBinary(), blob));
+    reinterpret_cast<ProgramInfoSerialization::Header *>(blob.data())->version += 1;
+
+    ProgramInfo restored;
+    EXPECT_FALSE(deserializeProgramInfo(ArrayRef<const uint8_t>(blob.data(), blob.size()), getDeviceBinary(), restored));
+    EXPECT_TRUE(restored.kernelInfos.empty());
+}
+
+TEST_F(ProgramInfoSerializerTests, GivenDifferentDeviceBinarySizeWhenDeserializingThenFail) {
+    std::vector<uint8_t> blob;
+    ASSERT_TRUE(serializeProgramInfo(programInfo, getDeviceBinary(), blob));
+
+    ProgramInfo restored;
+    EXPECT_FALSE(deserializeProgramInfo(ArrayRef<const uint8_t>(blob.data(), blob.size()), ArrayRef<const uint8_t>(deviceBinary.data(), deviceBinary.size() - 1), restored));
+    EXPECT_TRUE(restored.kernelInfos.empty());
+}
+
+TEST_F(ProgramInfoSerializerTests, GivenTruncatedBlobWhenDeserializingThenFail) {
+    std::vector<uint8_t> blob;
+    ASSERT_TRUE(serializeProgramInfo(programInfo, getDeviceBinary(), blob));
+
+    for (size_t size = 0; size < blob.size(); ++size) {
+        ProgramInfo restored;
+        EXPECT_FALSE(deserializeProgramInfo(ArrayRef<const uint8_t>(blob.data(), size), getDeviceBinary(), restored));
+        EXPECT_TRUE(restored.kernelInfos.empty());
+    }
+}
@@ -252,3 +252,20 @@ TEST(AllocateGlobalSurfaceTest, GivenAllocationInLocalMemoryWhichRequiresBlitter
         }
     }
 }
+
+TEST(ProgramUploadWorkersCountTest, GivenLargeGlobalsAndLocalMemoryDisabledWhenGettingWorkersCountThenGlobalsGetOwnWorker) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableLocalMemory.set(0);
+    MockDevice device;
+
+    EXPECT_EQ(getKernelAllocationWorkersCount(device, 3u), getProgramUploadWorkersCount(device, 3u, MemoryConstants::pageSize));
+    EXPECT_LE(2u, getProgramUploadWorkersCount(device, 3u, MemoryConstants::pageSize64k));
+}
+
+TEST(ProgramUploadWorkersCountTest, GivenLargeGlobalsAndLocalMemoryEnabledWhenGettingWorkersCountThenUploadsAreNotParallelized) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableLocalMemory.set(1);
+    MockDevice device;
+
+    EXPECT_EQ(1u, getProgramUploadWorkersCount(device, 3u, MemoryConstants::pageSize64k));
+}
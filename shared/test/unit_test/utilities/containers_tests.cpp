@@ -1198,6 +1198,7 @@ TEST(StackVec, WhenMovingByAssignmentThenObjectIsCorrect) {
 
             ASSERT_EQ(srcSc, dst.size());
             EXPECT_EQ(0, memcmp(refData, &*dst.begin(), srcSc));
+            EXPECT_TRUE(src.empty());
         }
     }
 }
@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/cpu_copy.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <numeric>
+#include <vector>
+
+extern std::atomic<uint32_t> streamingCopyCounter;
+
+using namespace NEO;
+
+TEST(CpuCopyTest, givenCopyBelowLargeCopyThresholdWhenCopyingThenStreamingStoresAreNotUsed) {
+    std::vector<uint8_t> src(CpuCopy::chunkSize);
+    std::iota(src.begin(), src.end(), static_cast<uint8_t>(0u));
+    std::vector<uint8_t> dst(src.size(), 0u);
+
+    auto streamingCopies = streamingCopyCounter.load();
+    CpuCopy::copy(dst.data(), src.data(), src.size());
+
+    EXPECT_EQ(streamingCopies, streamingCopyCounter);
+    EXPECT_EQ(src, dst);
+}
+
+TEST(CpuCopyTest, givenLargeCopyWhenCopyingThenEachChunkIsCopiedWithStreamingStores) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.CpuCopyLargeTransferThreshold.set(static_cast<int32_t>(CpuCopy::chunkSize));
+    DebugManager.flags.CpuCopyWorkers.set(2);
+
+    std::vector<uint8_t> src(3 * CpuCopy::chunkSize + 5u);
+    std::iota(src.begin(), src.end(), static_cast<uint8_t>(0u));
+    std::vector<uint8_t> dst(src.size(), 0u);
+
+    auto streamingCopies = streamingCopyCounter.load();
+    CpuCopy::copy(dst.data(), src.data(), src.size());
+
+    EXPECT_EQ(streamingCopies + 4u, streamingCopyCounter);
+    EXPECT_EQ(src, dst);
+}
+
+TEST(CpuCopyTest, givenDefaultSettingsWhenGettingWorkersCountThenItIsLimitedByChunksCount) {
+    EXPECT_EQ(1u, CpuCopy::getWorkersCount(CpuCopy::chunkSize));
+    EXPECT_GE(CpuCopy::maxDefaultWorkersCount, CpuCopy::getWorkersCount(64 * CpuCopy::chunkSize));
+}
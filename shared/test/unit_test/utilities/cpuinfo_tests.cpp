@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2020 Intel Corporation
+ * Copyright (C) 2017-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -71,7 +71,10 @@ TEST(CpuInfoTest, giveFunctionIsNotAvailableWhenFeatureIsNotSupportedThenMaskBit
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureLzcnt));
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureHle));
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureRtm));
+    EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureWaitpkg));
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX2));
+    EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX512F));
+    EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX512Bw));
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureClflush));
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureTsc));
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureRdtscp));
@@ -107,7 +110,10 @@ TEST(CpuInfoTest, giveFunctionIsAvailableWhenFeatureIsNotSupportedThenMaskBitIsO
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureLzcnt));
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureHle));
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureRtm));
+    EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureWaitpkg));
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX2));
+    EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX512F));
+    EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX512Bw));
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureClflush));
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureTsc));
     EXPECT_FALSE(testCpuInfo.isFeatureSupported(CpuInfo::featureRdtscp));
@@ -143,7 +149,12 @@ TEST(CpuInfoTest, whenFeatureIsSupportedThenMaskBitIsOn) {
     EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureLzcnt));
     EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureHle));
     EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureRtm));
+    EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureWaitpkg));
     EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX2));
+    EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX512F));
+    EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureAvX512Bw));
+    EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureClflushopt));
+    EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureClwb));
     EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureClflush));
     EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureTsc));
     EXPECT_TRUE(testCpuInfo.isFeatureSupported(CpuInfo::featureRdtscp));
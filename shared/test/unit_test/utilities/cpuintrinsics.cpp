@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,10 +9,31 @@
 
 #include <atomic>
 #include <cstdint>
+#include <cstring>
 
 //std::atomic is used for sake of sanitation in MT tests
 std::atomic<uintptr_t> lastClFlushedPtr(0u);
+std::atomic<uint32_t> clFlushOptCounter(0u);
+std::atomic<uint32_t> clWbCounter(0u);
 std::atomic<uint32_t> pauseCounter(0u);
+std::atomic<uint32_t> sfenceCounter(0u);
+std::atomic<uint32_t> umwaitCounter(0u);
+std::atomic<uintptr_t> lastUmonitorPtr(0u);
+std::atomic<uint64_t> rdtscValue(0u);
+std::atomic<uint32_t> streamingCopyCounter(0u);
+
+//when set, pauseValue is stored under pauseAddress once pause or umwait was called pauseOffset times
+volatile uint32_t *pauseAddress = nullptr;
+uint32_t pauseValue = 0u;
+uint32_t pauseOffset = 0u;
+
+namespace {
+void storePauseValueIfRequested(uint32_t waitCount) {
+    if (pauseAddress != nullptr && waitCount >= pauseOffset) {
+        *pauseAddress = pauseValue;
+    }
+}
+} // namespace
 
 namespace NEO {
 namespace CpuIntrinsics {
@@ -21,8 +42,39 @@ void clFlush(void const *ptr) {
     lastClFlushedPtr = reinterpret_cast<uintptr_t>(ptr);
 }
 
+void clFlushOpt(void const *ptr) {
+    lastClFlushedPtr = reinterpret_cast<uintptr_t>(ptr);
+    clFlushOptCounter++;
+}
+
+void clWb(void const *ptr) {
+    lastClFlushedPtr = reinterpret_cast<uintptr_t>(ptr);
+    clWbCounter++;
+}
+
 void pause() {
-    pauseCounter++;
+    storePauseValueIfRequested(++pauseCounter + umwaitCounter);
+}
+
+void sfence() {
+    sfenceCounter++;
+}
+
+uint64_t rdtsc() {
+    return rdtscValue++;
+}
+
+void umonitor(volatile void *address) {
+    lastUmonitorPtr = reinterpret_cast<uintptr_t>(address);
+}
+
+void umwait(uint32_t control, uint64_t counter) {
+    storePauseValueIfRequested(pauseCounter + ++umwaitCounter);
+}
+
+void streamingCopy(void *dst, const void *src, size_t size) {
+    streamingCopyCounter++;
+    memcpy(dst, src, size);
 }
 
 } // namespace CpuIntrinsics
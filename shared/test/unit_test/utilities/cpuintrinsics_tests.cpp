@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2021 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -14,6 +14,8 @@
 
 extern std::atomic<uintptr_t> lastClFlushedPtr;
 extern std::atomic<uint32_t> pauseCounter;
+extern std::atomic<uint32_t> umwaitCounter;
+extern std::atomic<uintptr_t> lastUmonitorPtr;
 
 TEST(CpuIntrinsicsTest, whenClFlushIsCalledThenExpectToPassPtrToSystemCall) {
     uintptr_t flushAddr = 0x1234;
@@ -27,3 +29,13 @@ TEST(CpuIntrinsicsTest, whenPauseCalledThenExpectToIncreaseCounter) {
     NEO::CpuIntrinsics::pause();
     EXPECT_EQ(oldCount + 1, pauseCounter);
 }
+
+TEST(CpuIntrinsicsTest, whenUmonitorAndUmwaitAreCalledThenExpectAddressPassedAndCounterIncreased) {
+    uintptr_t monitorAddr = 0x4321;
+    NEO::CpuIntrinsics::umonitor(reinterpret_cast<volatile void *>(monitorAddr));
+    EXPECT_EQ(monitorAddr, lastUmonitorPtr);
+
+    uint32_t oldCount = umwaitCounter.load();
+    NEO::CpuIntrinsics::umwait(0u, NEO::CpuIntrinsics::rdtsc());
+    EXPECT_EQ(oldCount + 1, umwaitCounter);
+}
@@ -277,6 +277,52 @@ TEST(HeapAllocatorTest, GivenStoredChunkNotAdjacentToIncomingChunkWhenStoreIsCal
     EXPECT_EQ(sizeToStore, freedChunks[2].size);
 }
 
+TEST(HeapAllocatorTest, GivenStoredChunksAdjacentToBothBoundariesOfIncomingChunkWhenStoreIsCalledThenAllChunksAreMerged) {
+    uint64_t ptrBase = 0x100000llu;
+    size_t size = 1024 * 4096;
+
+    auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
+
+    std::vector<HeapChunk> freedChunks;
+    freedChunks.emplace_back(ptrBase, 4096);
+    freedChunks.emplace_back(ptrBase + 3 * 4096, 5 * 4096);
+
+    heapAllocator->storeInFreedChunks(ptrBase + 4096, 2 * 4096, freedChunks);
+
+    ASSERT_EQ(1u, freedChunks.size());
+    EXPECT_EQ(ptrBase, freedChunks[0].ptr);
+    EXPECT_EQ(8u * 4096, freedChunks[0].size);
+}
+
+TEST(HeapAllocatorTest, GivenFragmentedHeapWhenGettingFragmentationStatisticsThenFreedChunksAndLargestFreeBlockAreReported) {
+    uint64_t ptrBase = 0x100000llu;
+    size_t size = 16 * 4096;
+    auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
+    EXPECT_EQ(0u, heapAllocator->getNumFreedChunks());
+    EXPECT_EQ(size, heapAllocator->getLargestFreeBlockSize());
+    EXPECT_EQ(0.0, heapAllocator->getFragmentation());
+
+    uint64_t ptrs[4] = {};
+    for (auto &ptr : ptrs) {
+        size_t allocSize = 4 * 4096;
+        ptr = heapAllocator->allocate(allocSize);
+        EXPECT_NE(0llu, ptr);
+    }
+    EXPECT_EQ(0u, heapAllocator->getLargestFreeBlockSize());
+    EXPECT_EQ(0.0, heapAllocator->getFragmentation());
+
+    heapAllocator->free(ptrs[0], 4 * 4096);
+    heapAllocator->free(ptrs[2], 4 * 4096);
+    EXPECT_EQ(2u, heapAllocator->getNumFreedChunks());
+    EXPECT_EQ(4u * 4096, heapAllocator->getLargestFreeBlockSize());
+    EXPECT_DOUBLE_EQ(0.5, heapAllocator->getFragmentation());
+
+    heapAllocator->free(ptrs[1], 4 * 4096);
+    EXPECT_EQ(1u, heapAllocator->getNumFreedChunks());
+    EXPECT_EQ(12u * 4096, heapAllocator->getLargestFreeBlockSize());
+    EXPECT_EQ(0.0, heapAllocator->getFragmentation());
+}
+
 TEST(HeapAllocatorTest, WhenAllocatingThenEntryIsAddedToMap) {
     uint64_t ptrBase = 0x100000llu;
     size_t size = 1024 * 4096;
@@ -770,11 +816,9 @@ TEST(HeapAllocatorTest, GivenLargeAllocationsWhenFreeingThenSpaceIsDefragmented)
     heapAllocator->free(ptrs[7], allocSize);
     heapAllocator->free(ptrs[8], doubleallocSize);
 
-    // 0,1  merged on free,
-    // 2
-    // 6,7 - merged on free
-    // 8, 10 - merged on free
-    EXPECT_EQ(4u, freedChunks.size());
+    // 0, 1, 2 - merged on free with both neighbours
+    // 6, 7, 8, 10 - merged on free with both neighbours
+    EXPECT_EQ(2u, freedChunks.size());
 
     heapAllocator->defragment();
 
@@ -827,11 +871,9 @@ TEST(HeapAllocatorTest, GivenSmallAllocationsWhenFreeingThenSpaceIsDefragmented)
     heapAllocator->free(ptrs[7], allocSize);
     heapAllocator->free(ptrs[10], allocSize);
 
-    // 0,1  merged on free,
-    // 2
-    // 6, - merged on free
-    // 7, 8, 10 - merged on free
-    EXPECT_EQ(4u, freedChunks.size());
+    // 0, 1, 2 - merged on free with both neighbours
+    // 6, 7, 8, 10 - merged on free with both neighbours
+    EXPECT_EQ(2u, freedChunks.size());
 
     heapAllocator->defragment();
 
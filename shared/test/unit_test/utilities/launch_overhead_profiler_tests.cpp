@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/launch_overhead_profiler.h"
+
+#include "test.h"
+
+#include "gtest/gtest.h"
+
+#include <sstream>
+
+using namespace NEO;
+
+TEST(LaunchOverheadProfilerTest, GivenPrintKernelLaunchOverheadNotSetWhenGettingProfilerThenNullptrIsReturned) {
+    EXPECT_EQ(nullptr, LaunchOverheadProfiler::get());
+}
+
+TEST(LaunchOverheadProfilerTest, WhenScopedLaunchPhaseIsCreatedWithoutProfilerThenNothingIsRecorded) {
+    ScopedLaunchPhase launchPhase(LaunchOverheadProfiler::Phase::flush);
+    EXPECT_EQ(nullptr, launchPhase.profiler);
+}
+
+TEST(LaunchOverheadProfilerTest, GivenLaunchesOfTwoKernelsWhenReportIsPrintedThenKernelWithHigherOverheadIsListedFirst) {
+    std::stringstream output;
+    LaunchOverheadProfiler profiler(2u, output);
+
+    profiler.beginLaunch("cheapKernel");
+    profiler.addPhaseTime(LaunchOverheadProfiler::Phase::encoding, 1000u);
+    profiler.endLaunch();
+
+    profiler.beginLaunch("expensiveKernel");
+    profiler.addPhaseTime(LaunchOverheadProfiler::Phase::execIoctl, 2000000u);
+    profiler.endLaunch();
+
+    profiler.printReport();
+    auto text = output.str();
+    EXPECT_NE(std::string::npos, text.find("cheapKernel"));
+    EXPECT_LT(text.find("expensiveKernel"), text.find("cheapKernel"));
+    EXPECT_NE(std::string::npos, text.find("2000.00"));
+}
+
+TEST(LaunchOverheadProfilerTest, GivenNestedLaunchWhenEndedThenTimeIsAttributedToOutermostKernel) {
+    std::stringstream output;
+    LaunchOverheadProfiler profiler(1u, output);
+
+    profiler.beginLaunch("userKernel");
+    EXPECT_TRUE(profiler.isLaunchActive());
+    profiler.beginLaunch("builtinKernel");
+    profiler.endLaunch();
+    EXPECT_TRUE(profiler.isLaunchActive());
+    profiler.endLaunch();
+    EXPECT_FALSE(profiler.isLaunchActive());
+
+    profiler.printReport();
+    auto text = output.str();
+    EXPECT_NE(std::string::npos, text.find("userKernel"));
+    EXPECT_EQ(std::string::npos, text.find("builtinKernel"));
+}
+
+TEST(LaunchOverheadProfilerTest, GivenMoreKernelsThanReportedCountWhenReportIsPrintedThenOnlyTopKernelsAreListed) {
+    std::stringstream output;
+    LaunchOverheadProfiler profiler(1u, output);
+
+    profiler.beginLaunch("firstKernel");
+    profiler.endLaunch();
+    profiler.beginLaunch("secondKernel");
+    profiler.endLaunch();
+
+    profiler.printReport();
+    auto text = output.str();
+    EXPECT_NE(std::string::npos, text.find("Kernel"));
+    EXPECT_EQ(1u, static_cast<size_t>(text.find("firstKernel") != std::string::npos) + static_cast<size_t>(text.find("secondKernel") != std::string::npos));
+}
+
+TEST(LaunchOverheadProfilerTest, GivenSubmissionOfLaunchedKernelsWhenSubmissionTimeIsAddedThenItIsSplitOverKernelsAsFlushTime) {
+    std::stringstream output;
+    LaunchOverheadProfiler profiler(2u, output);
+
+    profiler.beginLaunch("listKernel");
+    profiler.endLaunch();
+    profiler.addSubmissionTime({"listKernel", "listKernel"}, 4000000u);
+    profiler.addSubmissionTime({}, 1000000u);
+
+    profiler.printReport();
+    auto text = output.str();
+    EXPECT_NE(std::string::npos, text.find("listKernel"));
+    EXPECT_NE(std::string::npos, text.find("4000.00"));
+}
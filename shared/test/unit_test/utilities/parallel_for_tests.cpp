@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/parallel_for.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <vector>
+
+using namespace NEO;
+
+TEST(ParallelForTest, givenMultipleWorkersWhenRunningThenEachItemIsProcessedExactlyOnce) {
+    constexpr size_t itemsCount = 100u;
+    std::vector<std::atomic<uint32_t>> processedCounts(itemsCount);
+    for (auto &count : processedCounts) {
+        count = 0u;
+    }
+
+    ParallelFor::run(itemsCount, 4u, [&](size_t item) {
+        processedCounts[item]++;
+    });
+
+    for (auto &count : processedCounts) {
+        EXPECT_EQ(1u, count.load());
+    }
+}
+
+TEST(ParallelForTest, givenSingleWorkerWhenRunningThenItemsAreProcessedInOrder) {
+    std::vector<size_t> processedItems;
+
+    ParallelFor::run(5u, 1u, [&](size_t item) {
+        processedItems.push_back(item);
+    });
+
+    std::vector<size_t> expectedItems = {0u, 1u, 2u, 3u, 4u};
+    EXPECT_EQ(expectedItems, processedItems);
+}
+
+TEST(ParallelForTest, givenNoItemsWhenRunningThenFunctionIsNotCalled) {
+    uint32_t calls = 0u;
+    ParallelFor::run(0u, 4u, [&](size_t item) {
+        calls++;
+    });
+    EXPECT_EQ(0u, calls);
+}
+
+TEST(ParallelForTest, givenFewItemsWhenGettingDefaultWorkersCountThenSingleWorkerIsReturned) {
+    EXPECT_EQ(1u, ParallelFor::getWorkersCount(ParallelFor::minItemsCountForParallelExecution - 1));
+}
+
+TEST(ParallelForTest, givenManyItemsWhenGettingDefaultWorkersCountThenWorkersCountIsLimited) {
+    auto workersCount = ParallelFor::getWorkersCount(ParallelFor::minItemsCountForParallelExecution);
+    EXPECT_LE(1u, workersCount);
+    EXPECT_GE(ParallelFor::maxDefaultWorkersCount, workersCount);
+}
+
+TEST(ParallelForTest, givenDebugFlagSetWhenGettingWorkersCountThenFlagValueIsReturned) {
+    DebugManagerStateRestore restorer;
+
+    DebugManager.flags.ParallelKernelProcessingWorkers.set(3);
+    EXPECT_EQ(3u, ParallelFor::getWorkersCount(1u));
+
+    DebugManager.flags.ParallelKernelProcessingWorkers.set(0);
+    EXPECT_EQ(1u, ParallelFor::getWorkersCount(ParallelFor::minItemsCountForParallelExecution));
+}
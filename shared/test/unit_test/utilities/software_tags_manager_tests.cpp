@@ -12,6 +12,8 @@
 
 #include "test.h"
 
+#include <limits>
+
 using namespace NEO;
 using namespace SWTags;
 
@@ -35,6 +37,7 @@ struct VeryLargeTag : public BaseTag {
 struct SoftwareTagsManagerTests : public DeviceFixture, public ::testing::Test {
     void SetUp() override {
         DebugManager.flags.EnableSWTags.set(true);
+        DebugManager.flags.SWTagsHeapSize.set(testTagHeapSize);
         DeviceFixture::SetUp();
 
         tagsManager = pDevice->getRootDeviceEnvironment().tagsManager.get();
@@ -52,7 +55,7 @@ struct SoftwareTagsManagerTests : public DeviceFixture, public ::testing::Test {
     void initializeTestCmdStream() {
         const AllocationProperties properties{
             pDevice->getRootDeviceIndex(),
-            SWTagsManager::estimateSpaceForSWTags<GfxFamily>(),
+            SWTagsManager::estimateSpaceForSWTags<GfxFamily>(maxTestTags),
             GraphicsAllocation::AllocationType::LINEAR_STREAM,
             pDevice->getDeviceBitfield()};
 
@@ -64,6 +67,9 @@ struct SoftwareTagsManagerTests : public DeviceFixture, public ::testing::Test {
         pDevice->getMemoryManager()->freeGraphicsMemory(testCmdStream->getGraphicsAllocation());
     }
 
+    static constexpr int32_t testTagHeapSize = 1024;
+    static constexpr size_t maxTestTags = 32;
+
     SWTagsManager *tagsManager;
     std::unique_ptr<LinearStream> testCmdStream;
     DebugManagerStateRestore dbgRestorer;
@@ -73,7 +79,8 @@ TEST_F(SoftwareTagsManagerTests, whenSWTagsMangerIsInitializedThenHeapAllocation
     auto memoryMgr = pDevice->getMemoryManager();
     SWTagBXML bxml;
     BXMLHeapInfo bxmlInfo((sizeof(BXMLHeapInfo) + bxml.str.size() + 1) / sizeof(uint32_t));
-    SWTagHeapInfo tagInfo(SWTagsManager::MAX_TAG_HEAP_SIZE / sizeof(uint32_t));
+    EXPECT_EQ(static_cast<uint32_t>(testTagHeapSize), tagsManager->getSWTagHeapSize());
+    SWTagHeapInfo tagInfo(tagsManager->getSWTagHeapSize() / sizeof(uint32_t));
     auto bxmlHeap = tagsManager->getBXMLHeapAllocation();
     auto tagHeap = tagsManager->getSWTagHeapAllocation();
 
@@ -166,26 +173,64 @@ HWTEST_F(SoftwareTagsManagerTests, whenVeryLargeTagIsInsertedThenItIsNotSuccessf
     freeTestCmdStream();
 }
 
-HWTEST_F(SoftwareTagsManagerTests, givenSoftwareManagerWithMaxTagsReachedWhenTagIsInsertedThenItIsNotSuccessful) {
+HWTEST_F(SoftwareTagsManagerTests, givenTagAlreadyInHeapWhenSameTagIsInsertedAgainThenHeapOffsetIsReused) {
     using MI_NOOP = typename FamilyType::MI_NOOP;
 
     initializeTestCmdStream<FamilyType>();
 
-    EXPECT_TRUE(tagsManager->MAX_TAG_HEAP_SIZE > (tagsManager->MAX_TAG_COUNT + 1) * sizeof(TestTag));
+    tagsManager->insertTag<FamilyType, KernelNameTag>(*testCmdStream.get(), *pDevice, "kernelA");
+    tagsManager->insertTag<FamilyType, KernelNameTag>(*testCmdStream.get(), *pDevice, "kernelB");
+    tagsManager->insertTag<FamilyType, KernelNameTag>(*testCmdStream.get(), *pDevice, "kernelA");
 
-    for (unsigned int i = 0; i <= tagsManager->MAX_TAG_COUNT; ++i) {
-        tagsManager->insertTag<FamilyType, TestTag>(*testCmdStream.get(), *pDevice);
-    }
+    ASSERT_EQ(testCmdStream->getUsed(), 3 * 2 * sizeof(MI_NOOP));
+    auto noops = reinterpret_cast<MI_NOOP *>(testCmdStream->getCpuBase());
 
-    EXPECT_EQ(testCmdStream->getUsed(), tagsManager->MAX_TAG_COUNT * 2 * sizeof(MI_NOOP));
+    EXPECT_EQ(BaseTag::getOffsetNoopID(sizeof(SWTagHeapInfo)), noops[1].getIdentificationNumber());
+    EXPECT_EQ(BaseTag::getOffsetNoopID(sizeof(SWTagHeapInfo) + sizeof(KernelNameTag)), noops[3].getIdentificationNumber());
+    EXPECT_EQ(noops[1].getIdentificationNumber(), noops[5].getIdentificationNumber());
 
-    tagsManager->insertTag<FamilyType, TestTag>(*testCmdStream.get(), *pDevice);
+    freeTestCmdStream();
+}
+
+HWTEST_F(SoftwareTagsManagerTests, givenFullTagHeapWhenNewTagIsInsertedThenItWrapsToStartOfHeap) {
+    using MI_NOOP = typename FamilyType::MI_NOOP;
+
+    initializeTestCmdStream<FamilyType>();
 
-    EXPECT_EQ(testCmdStream->getUsed(), tagsManager->MAX_TAG_COUNT * 2 * sizeof(MI_NOOP));
+    const size_t tagsInHeap = (testTagHeapSize - sizeof(SWTagHeapInfo)) / sizeof(KernelNameTag);
+    ASSERT_LT(tagsInHeap, maxTestTags);
+
+    for (size_t i = 0; i <= tagsInHeap; ++i) {
+        auto name = "kernel" + std::to_string(i);
+        tagsManager->insertTag<FamilyType, KernelNameTag>(*testCmdStream.get(), *pDevice, name.c_str());
+    }
+
+    ASSERT_EQ(testCmdStream->getUsed(), (tagsInHeap + 1) * 2 * sizeof(MI_NOOP));
+    auto noops = reinterpret_cast<MI_NOOP *>(testCmdStream->getCpuBase());
+
+    auto lastTagInHeapOffset = sizeof(SWTagHeapInfo) + (tagsInHeap - 1) * sizeof(KernelNameTag);
+    EXPECT_EQ(BaseTag::getOffsetNoopID(static_cast<uint32_t>(lastTagInHeapOffset)), noops[2 * tagsInHeap - 1].getIdentificationNumber());
+    EXPECT_EQ(BaseTag::getOffsetNoopID(sizeof(SWTagHeapInfo)), noops[2 * tagsInHeap + 1].getIdentificationNumber());
 
     freeTestCmdStream();
 }
 
+TEST(SoftwareTagsManagerHeapSizeTests, givenSWTagsHeapSizeOutOfRangeWhenManagerIsInitializedThenHeapSizeIsClamped) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.EnableSWTags.set(true);
+
+    std::pair<int32_t, unsigned int> heapSizes[] = {
+        {0, 1024u},
+        {-2, 1024u},
+        {4097, 4096u},
+        {std::numeric_limits<int32_t>::max(), 1024u * 1024u}};
+    for (auto &heapSize : heapSizes) {
+        DebugManager.flags.SWTagsHeapSize.set(heapSize.first);
+        std::unique_ptr<MockDevice> device(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
+        EXPECT_EQ(heapSize.second, device->getRootDeviceEnvironment().tagsManager->getSWTagHeapSize());
+    }
+}
+
 TEST(SoftwareTagsManagerMultiDeviceTests, givenEnableSWTagsAndCreateMultipleSubDevicesWhenDeviceCreatedThenSWTagsManagerIsInitializedOnlyOnce) {
     DebugManagerStateRestore dbgRestorer;
     DebugManager.flags.EnableSWTags.set(true);
@@ -204,6 +249,8 @@ struct SoftwareTagsParametrizedTests : public ::testing::TestWithParam<SWTags::O
     void SetUp() override {
         tagMap.emplace(OpCode::KernelName, std::make_unique<KernelNameTag>(""));
         tagMap.emplace(OpCode::PipeControlReason, std::make_unique<PipeControlReasonTag>(""));
+        tagMap.emplace(OpCode::UserRangeBegin, std::make_unique<UserRangeBeginTag>(""));
+        tagMap.emplace(OpCode::UserRangeEnd, std::make_unique<UserRangeEndTag>());
     }
 
     std::map<OpCode, std::unique_ptr<BaseTag>> tagMap;
@@ -214,7 +261,9 @@ INSTANTIATE_TEST_CASE_P(
     SoftwareTagsParametrizedTests,
     testing::Values(
         OpCode::KernelName,
-        OpCode::PipeControlReason));
+        OpCode::PipeControlReason,
+        OpCode::UserRangeBegin,
+        OpCode::UserRangeEnd));
 
 TEST_P(SoftwareTagsParametrizedTests, whenGetOpCodeIsCalledThenCorrectValueIsReturned) {
     auto opcode = GetParam();
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/tiled_memcpy.h"
+
+#include "gtest/gtest.h"
+
+#include <numeric>
+#include <vector>
+
+using namespace NEO;
+
+TEST(TiledMemcpyTest, givenTileYLayoutWhenGettingTiledOffsetThenSixteenByteColumnsAreStoredContiguously) {
+    constexpr size_t pitch = 2 * TiledMemcpy::tileWidthInBytes;
+
+    EXPECT_EQ(0u, TiledMemcpy::getTiledOffset(TileLayout::TileY, 0, 0, pitch));
+    EXPECT_EQ(15u, TiledMemcpy::getTiledOffset(TileLayout::TileY, 15, 0, pitch));
+    EXPECT_EQ(16u, TiledMemcpy::getTiledOffset(TileLayout::TileY, 0, 1, pitch));
+    EXPECT_EQ(512u, TiledMemcpy::getTiledOffset(TileLayout::TileY, 16, 0, pitch));
+    EXPECT_EQ(512u + 31 * 16u + 1u, TiledMemcpy::getTiledOffset(TileLayout::TileY, 17, 31, pitch));
+    EXPECT_EQ(TiledMemcpy::tileSize, TiledMemcpy::getTiledOffset(TileLayout::TileY, 128, 0, pitch));
+    EXPECT_EQ(2 * TiledMemcpy::tileSize, TiledMemcpy::getTiledOffset(TileLayout::TileY, 0, 32, pitch));
+}
+
+TEST(TiledMemcpyTest, givenTile4LayoutWhenGettingTiledOffsetThenSixteenByteByFourRowBlocksAreInterleaved) {
+    constexpr size_t pitch = 2 * TiledMemcpy::tileWidthInBytes;
+
+    EXPECT_EQ(0u, TiledMemcpy::getTiledOffset(TileLayout::Tile4, 0, 0, pitch));
+    EXPECT_EQ(16u, TiledMemcpy::getTiledOffset(TileLayout::Tile4, 0, 1, pitch));
+    EXPECT_EQ(64u, TiledMemcpy::getTiledOffset(TileLayout::Tile4, 16, 0, pitch));
+    EXPECT_EQ(128u, TiledMemcpy::getTiledOffset(TileLayout::Tile4, 0, 4, pitch));
+    EXPECT_EQ(256u, TiledMemcpy::getTiledOffset(TileLayout::Tile4, 32, 0, pitch));
+    EXPECT_EQ(1024u, TiledMemcpy::getTiledOffset(TileLayout::Tile4, 64, 0, pitch));
+    EXPECT_EQ(2048u, TiledMemcpy::getTiledOffset(TileLayout::Tile4, 0, 16, pitch));
+    EXPECT_EQ(TiledMemcpy::tileSize - 1, TiledMemcpy::getTiledOffset(TileLayout::Tile4, 127, 31, pitch));
+    EXPECT_EQ(TiledMemcpy::tileSize, TiledMemcpy::getTiledOffset(TileLayout::Tile4, 128, 0, pitch));
+    EXPECT_EQ(2 * TiledMemcpy::tileSize, TiledMemcpy::getTiledOffset(TileLayout::Tile4, 0, 32, pitch));
+}
+
+TEST(TiledMemcpyTest, givenUnalignedRegionWhenCopyingToAndFromTiledMemoryThenDataIsPreservedAndPlacedAtTiledOffsets) {
+    constexpr size_t pitch = 2 * TiledMemcpy::tileWidthInBytes;
+    constexpr size_t tiledHeight = 2 * TiledMemcpy::tileHeight;
+    constexpr size_t x = 13;
+    constexpr size_t y = 29;
+    constexpr size_t width = 150;
+    constexpr size_t height = 7;
+    constexpr size_t rowPitch = width + 3;
+
+    std::vector<uint8_t> src(rowPitch * height);
+    std::iota(src.begin(), src.end(), static_cast<uint8_t>(1u));
+
+    for (auto layout : {TileLayout::TileY, TileLayout::Tile4}) {
+        std::vector<uint8_t> tiled(pitch * tiledHeight, 0u);
+        TiledMemcpy::copyToTiled(layout, tiled.data(), pitch, x, y, src.data(), rowPitch, width, height);
+
+        for (size_t row = 0; row < height; row++) {
+            for (size_t column = 0; column < width; column++) {
+                EXPECT_EQ(src[row * rowPitch + column], tiled[TiledMemcpy::getTiledOffset(layout, x + column, y + row, pitch)]);
+            }
+        }
+
+        std::vector<uint8_t> dst(src.size(), 0u);
+        TiledMemcpy::copyFromTiled(layout, dst.data(), rowPitch, tiled.data(), pitch, x, y, width, height);
+        for (size_t row = 0; row < height; row++) {
+            EXPECT_EQ(0, memcmp(&src[row * rowPitch], &dst[row * rowPitch], width));
+        }
+    }
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/trace_events.h"
+
+#include "test.h"
+
+#include "gtest/gtest.h"
+
+#include <sstream>
+#include <thread>
+
+using namespace NEO;
+
+namespace {
+size_t countOccurrences(const std::string &text, const std::string &pattern) {
+    size_t count = 0;
+    for (auto pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + pattern.size())) {
+        count++;
+    }
+    return count;
+}
+} // namespace
+
+TEST(TraceEventsTest, GivenTraceEventsFileNotSetWhenGettingTracerThenNullptrIsReturned) {
+    EXPECT_EQ(nullptr, TraceEvents::get());
+}
+
+TEST(TraceEventsTest, WhenTracerIsDestroyedThenGettingTracerReturnsNullptr) {
+    TraceEvents::get();
+    TraceEvents::destroy();
+    EXPECT_EQ(nullptr, TraceEvents::get());
+}
+
+TEST(TraceEventsTest, WhenRangeIsRecordedAndFlushedThenChromeTraceEventIsWritten) {
+    auto stream = std::make_unique<std::stringstream>();
+    auto output = stream.get();
+    TraceEvents traceEvents(std::move(stream));
+
+    traceEvents.recordRange("flushTask", TraceEvents::Category::submission, 1234567u, 1235567u);
+    traceEvents.flush();
+
+    auto text = output->str();
+    EXPECT_EQ(0u, text.find("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["));
+    EXPECT_NE(std::string::npos, text.find("{\"name\":\"flushTask\",\"cat\":\"submission\",\"ph\":\"X\",\"pid\":0,\"tid\":1,\"ts\":1234.567,\"dur\":1.000}"));
+}
+
+TEST(TraceEventsTest, GivenGpuRangeWhenFlushedThenEventIsWrittenOnGpuTrack) {
+    auto stream = std::make_unique<std::stringstream>();
+    auto output = stream.get();
+    TraceEvents traceEvents(std::move(stream));
+
+    traceEvents.recordGpuRange("gpuCommand", 2000u, 1000u);
+    traceEvents.flush();
+
+    EXPECT_NE(std::string::npos, output->str().find("{\"name\":\"gpuCommand\",\"cat\":\"gpu\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":2.000,\"dur\":0.000}"));
+}
+
+TEST(TraceEventsTest, GivenRangesRecordedFromTwoThreadsWhenFlushedThenEachThreadHasItsOwnTrack) {
+    auto stream = std::make_unique<std::stringstream>();
+    auto output = stream.get();
+    TraceEvents traceEvents(std::move(stream));
+
+    traceEvents.recordRange("mainThread", TraceEvents::Category::api, 0u, 1u);
+    std::thread worker([&traceEvents]() {
+        traceEvents.recordRange("workerThread", TraceEvents::Category::wait, 0u, 1u);
+    });
+    worker.join();
+    traceEvents.flush();
+
+    auto text = output->str();
+    EXPECT_NE(std::string::npos, text.find("\"name\":\"mainThread\",\"cat\":\"api\",\"ph\":\"X\",\"pid\":0,\"tid\":1,"));
+    EXPECT_NE(std::string::npos, text.find("\"name\":\"workerThread\",\"cat\":\"wait\",\"ph\":\"X\",\"pid\":0,\"tid\":2,"));
+}
+
+TEST(TraceEventsTest, GivenMoreEventsThanBufferCapacityWhenFlushedThenAllEventsAreWrittenOnce) {
+    auto stream = std::make_unique<std::stringstream>();
+    auto output = stream.get();
+    TraceEvents traceEvents(std::move(stream));
+
+    for (size_t i = 0; i < TraceEvents::eventsPerBuffer + 1; i++) {
+        traceEvents.recordRange("allocateGraphicsMemory", TraceEvents::Category::allocation, i, i + 1);
+    }
+    traceEvents.flush();
+
+    EXPECT_EQ(TraceEvents::eventsPerBuffer + 1, countOccurrences(output->str(), "\"name\":\"allocateGraphicsMemory\""));
+}
+
+TEST(TraceEventsTest, WhenScopedTraceEventIsCreatedWithoutTracerThenNothingIsRecorded) {
+    ScopedTraceEvent traceEvent("build", TraceEvents::Category::compile);
+    EXPECT_EQ(nullptr, traceEvent.traceEvents);
+}
+
+TEST(TraceEventsTest, WhenInitializationRangeIsRecordedThenInitializationCategoryIsWritten) {
+    auto stream = std::make_unique<std::stringstream>();
+    auto output = stream.get();
+    TraceEvents traceEvents(std::move(stream));
+
+    traceEvents.recordRange("deviceDiscovery", TraceEvents::Category::initialization, 0u, 1000u);
+    traceEvents.flush();
+
+    EXPECT_NE(std::string::npos, output->str().find("{\"name\":\"deviceDiscovery\",\"cat\":\"initialization\",\"ph\":\"X\""));
+}
+
+TEST(TraceEventsTest, WhenLockRangeIsRecordedThenLockCategoryIsWritten) {
+    auto stream = std::make_unique<std::stringstream>();
+    auto output = stream.get();
+    TraceEvents traceEvents(std::move(stream));
+
+    traceEvents.recordRange("csrOwnership", TraceEvents::Category::lock, 0u, 1000u);
+    traceEvents.flush();
+
+    EXPECT_NE(std::string::npos, output->str().find("{\"name\":\"csrOwnership\",\"cat\":\"lock\",\"ph\":\"X\""));
+}
+
+TEST(TraceEventsTest, GivenUncontendedMutexWhenLockingWithContentionTraceThenLockIsOwned) {
+    std::mutex mutex;
+    std::unique_lock<std::mutex> lock(mutex, std::defer_lock);
+    lockWithContentionTrace(lock, "testLock");
+    EXPECT_TRUE(lock.owns_lock());
+}
+
+TEST(TraceEventsTest, GivenContendedMutexWhenLockingWithContentionTraceThenLockIsOwnedAfterRelease) {
+    std::mutex mutex;
+    std::unique_lock<std::mutex> ownerLock(mutex);
+    std::atomic<bool> acquired{false};
+    std::thread waiter([&]() {
+        std::unique_lock<std::mutex> lock(mutex, std::defer_lock);
+        lockWithContentionTrace(lock, "testLock");
+        acquired = lock.owns_lock();
+    });
+    ownerLock.unlock();
+    waiter.join();
+    EXPECT_TRUE(acquired);
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/wait_util.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <cstdint>
+
+extern std::atomic<uint32_t> pauseCounter;
+extern std::atomic<uint32_t> umwaitCounter;
+extern std::atomic<uintptr_t> lastUmonitorPtr;
+extern volatile uint32_t *pauseAddress;
+extern uint32_t pauseValue;
+extern uint32_t pauseOffset;
+
+using namespace NEO;
+
+struct WaitUtilsTest : public ::testing::Test {
+    void SetUp() override {
+        pauseCounterStart = pauseCounter;
+        umwaitCounterStart = umwaitCounter;
+    }
+
+    void TearDown() override {
+        pauseAddress = nullptr;
+        pauseValue = 0u;
+        pauseOffset = 0u;
+    }
+
+    void storeValueAfterWaits(uint32_t value, uint32_t waitCount) {
+        pauseAddress = &pollValue;
+        pauseValue = value;
+        pauseOffset = pauseCounterStart + umwaitCounterStart + waitCount;
+    }
+
+    volatile uint32_t pollValue = 0u;
+    uint32_t pauseCounterStart = 0u;
+    uint32_t umwaitCounterStart = 0u;
+    WaitUtils::WaitPolicy policy;
+    WaitUtils::WaitStatistics statistics;
+};
+
+TEST_F(WaitUtilsTest, givenValueAlreadyReachedWhenWaitingThenReturnImmediatelyWithoutUpdatingStatistics) {
+    pollValue = 2u;
+    WaitUtils::waitForCompletion(&pollValue, 2u, policy, statistics);
+
+    EXPECT_EQ(pauseCounterStart, pauseCounter);
+    EXPECT_EQ(0u, statistics.waitCount);
+    EXPECT_EQ(0u, statistics.pauseCount);
+    EXPECT_EQ(0u, statistics.yieldCount);
+}
+
+TEST_F(WaitUtilsTest, givenValueReachedDuringPausePhaseWhenWaitingThenPausesAreCountedAndYieldIsNotUsed) {
+    policy.spinCount = 4u;
+    policy.pauseCount = 16u;
+    storeValueAfterWaits(1u, 3u);
+
+    WaitUtils::waitForCompletion(&pollValue, 1u, policy, statistics);
+
+    EXPECT_EQ(1u, pollValue);
+    EXPECT_EQ(pauseCounterStart + 3u, pauseCounter);
+    EXPECT_EQ(umwaitCounterStart, umwaitCounter);
+    EXPECT_EQ(1u, statistics.waitCount);
+    EXPECT_EQ(3u, statistics.pauseCount);
+    EXPECT_EQ(0u, statistics.yieldCount);
+}
+
+TEST_F(WaitUtilsTest, givenUmwaitPolicyWhenWaitingThenUmonitorAndUmwaitAreUsedInsteadOfPause) {
+    policy.spinCount = 0u;
+    policy.pauseCount = 16u;
+    policy.useUmwait = true;
+    storeValueAfterWaits(1u, 2u);
+
+    WaitUtils::waitForCompletion(&pollValue, 1u, policy, statistics);
+
+    EXPECT_EQ(pauseCounterStart, pauseCounter);
+    EXPECT_EQ(umwaitCounterStart + 2u, umwaitCounter);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(&pollValue), lastUmonitorPtr);
+    EXPECT_EQ(1u, statistics.waitCount);
+    EXPECT_EQ(2u, statistics.pauseCount);
+}